@@ -78,8 +78,10 @@ function(Xi_getCurTargetName rst)
 endfunction()
 
 # Create a target
+# BENCHMARK (EXE only): also add 'bench_<target>', a headless run with --benchmark
+# writing bin/bench/<target>.json, and add it to the 'benchmark' target
 function(Xi_addTargetRaw)
-	cmake_parse_arguments("ARG" "" "MODE" "SOURCES;LIBS" ${ARGN})
+	cmake_parse_arguments("ARG" "BENCHMARK" "MODE" "SOURCES;LIBS" ${ARGN})
 
 	# target info
 	file(RELATIVE_PATH targetRelPath "${PROJECT_SOURCE_DIR}/src" "${CMAKE_CURRENT_SOURCE_DIR}/..")
@@ -140,12 +142,32 @@ function(Xi_addTargetRaw)
 		RUNTIME DESTINATION "bin"
 		ARCHIVE DESTINATION "lib"
 		LIBRARY DESTINATION "lib")
+
+	# benchmark run, from bin like the debugger so relative data paths resolve
+	if(ARG_BENCHMARK AND ${ARG_MODE} STREQUAL "EXE")
+		file(MAKE_DIRECTORY "${PROJECT_SOURCE_DIR}/bin/bench")
+		add_custom_target(bench_${targetName}
+			COMMAND ${targetName} --benchmark --frames ${XI_BENCHMARK_FRAMES} --out "${PROJECT_SOURCE_DIR}/bin/bench/${targetName}.json"
+			WORKING_DIRECTORY "${PROJECT_SOURCE_DIR}/bin"
+			DEPENDS ${targetName}
+			COMMENT "Benchmarking ${targetName}")
+		set_target_properties(bench_${targetName} PROPERTIES FOLDER "${PROJECT_NAME}/benchmark")
+		if(NOT TARGET benchmark)
+			add_custom_target(benchmark)
+		endif()
+		add_dependencies(benchmark bench_${targetName})
+		message(STATUS "- benchmark: bench_${targetName}")
+	endif()
 endfunction()
 
 # Specific version
 function(Xi_addTarget)
-	cmake_parse_arguments("ARG" "" "MODE" "LIBS" ${ARGN})
-	Xi_addTargetRaw(MODE ${ARG_MODE} LIBS ${ARG_LIBS})
+	cmake_parse_arguments("ARG" "BENCHMARK" "MODE" "LIBS" ${ARGN})
+	if(ARG_BENCHMARK)
+		Xi_addTargetRaw(MODE ${ARG_MODE} BENCHMARK LIBS ${ARG_LIBS})
+	else()
+		Xi_addTargetRaw(MODE ${ARG_MODE} LIBS ${ARG_LIBS})
+	endif()
 endfunction()
 
 # Basic setting
@@ -175,6 +197,9 @@ macro(Xi_projectInit)
 	# Open folder function of VS
 	set_property(GLOBAL PROPERTY USE_FOLDERS ON)
 
+	# frames measured by the bench_<target> runs (see Xi_addTargetRaw)
+	set(XI_BENCHMARK_FRAMES 600 CACHE STRING "Frames rendered by each headless benchmark run")
+
 	# set include folders
 	include_directories (
 		${PROJECT_SOURCE_DIR}/include
@@ -205,6 +230,21 @@ macro(Xi_QtInit)
 	find_package(Qt5Widgets REQUIRED)
 endmacro()
 
+# Find OpenGL and GLFW and set what targets link against them:
+# XI_GL_LIBS and XI_GLFW_LIBS, the import libraries in lib/ on Windows, the package targets elsewhere
+macro(Xi_findGL)
+	Xi_findPackage(OpenGL)
+	if(WIN32)
+		Xi_findPackage(GLFW3)
+		set(XI_GL_LIBS opengl32)
+		set(XI_GLFW_LIBS glfw3dll)
+	else()
+		Xi_findPackage(glfw3)
+		set(XI_GL_LIBS OpenGL::GL)
+		set(XI_GLFW_LIBS glfw)
+	endif()
+endmacro()
+
 function(Xi_findPackage packageName)
 	message(STATUS "")
 	message(STATUS "Finding package: ${packageName}")
@@ -1,8 +1,10 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <chapterBench.h>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cstring>
 
 using namespace std;
 
@@ -60,7 +62,7 @@ bool linkOutput(unsigned int shaderProgram)
     return success;
 }
 
-int main()
+int main(int argc, char** argv)
 {
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -68,23 +70,35 @@ int main()
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     //glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 
-    GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
-    if (window == NULL)
+    ChapterBench bench;
+    GLFWwindow* window = NULL;
+    if (bench.init(argc, argv, "2_triangle"))
     {
-        cout << "Failed to create GLFW window" << endl;
-        glfwTerminate();
-        return -1;
+        // benchmark mode renders headless: no window, input or presenting
+        if (!bench.createContext(800, 600))
+            return -1;
     }
-    glfwMakeContextCurrent(window);
-
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    else
     {
-        cout << "Failed to initialize GLAD" << endl;
-        return -1;
+        window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+        if (window == NULL)
+        {
+            cout << "Failed to create GLFW window" << endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwMakeContextCurrent(window);
+        glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        {
+            cout << "Failed to initialize GLAD" << endl;
+            return -1;
+        }
     }
+    bench.setup();
 
     glViewport(0, 0, 800, 600);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
     //-------data--------
     float vertices[] = {
@@ -143,10 +157,14 @@ int main()
     linkOutput(shaderProgram);
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
+    delete[] vertexShaderSource;
+    delete[] fragmentShaderSource;
 
-    while (!glfwWindowShouldClose(window))
+    while (bench.running(window))
     {
-        processInput(window);
+        bench.beginFrame();
+        if (window)
+            processInput(window);
 
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
@@ -155,8 +173,8 @@ int main()
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, NULL);
         glBindVertexArray(0);
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        bench.present(window);
+        bench.endFrame();
     }
 
     glfwTerminate();
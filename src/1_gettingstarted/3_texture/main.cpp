@@ -1,9 +1,11 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <stb_image.h>
+#include <chapterBench.h>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cstring>
 
 using namespace std;
 
@@ -45,7 +47,7 @@ char* openGLSLProgram(const char* filename)
     buf << f.rdbuf();
     f.close();
     int length = buf.str().size();
-    char* res = new char[length];
+    char* res = new char[length + 1];
     strcpy(res, buf.str().c_str());
     return res;
 }
@@ -89,7 +91,7 @@ unsigned int loadTexture(const char* filename, GLenum texID)
     return texture;
 }
 
-int main()
+int main(int argc, char** argv)
 {
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -97,23 +99,35 @@ int main()
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     //glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 
-    GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
-    if (window == NULL)
+    ChapterBench bench;
+    GLFWwindow* window = NULL;
+    if (bench.init(argc, argv, "3_texture"))
     {
-        cout << "Failed to create GLFW window" << endl;
-        glfwTerminate();
-        return -1;
+        // benchmark mode renders headless: no window, input or presenting
+        if (!bench.createContext(800, 600))
+            return -1;
     }
-    glfwMakeContextCurrent(window);
-
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    else
     {
-        cout << "Failed to initialize GLAD" << endl;
-        return -1;
+        window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+        if (window == NULL)
+        {
+            cout << "Failed to create GLFW window" << endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwMakeContextCurrent(window);
+        glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        {
+            cout << "Failed to initialize GLAD" << endl;
+            return -1;
+        }
     }
+    bench.setup();
 
     glViewport(0, 0, 800, 600);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
     //-------data--------
     float vertices[] = {
@@ -181,15 +195,19 @@ int main()
     linkOutput(shaderProgram);
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
+    delete[] vertexShaderSource;
+    delete[] fragmentShaderSource;
 
     glUseProgram(shaderProgram);
     glUniform1i(glGetUniformLocation(shaderProgram, "texture0"), 0);
     glUniform1i(glGetUniformLocation(shaderProgram, "texture1"), 1);
     glUseProgram(0);
 
-    while (!glfwWindowShouldClose(window))
+    while (bench.running(window))
     {
-        processInput(window);
+        bench.beginFrame();
+        if (window)
+            processInput(window);
 
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
@@ -199,8 +217,8 @@ int main()
         glBindVertexArray(0);
         glUseProgram(0);
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        bench.present(window);
+        bench.endFrame();
     }
 
     glfwTerminate();
@@ -4,9 +4,11 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <stb_image.h>
+#include <chapterBench.h>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cstring>
 
 using namespace std;
 
@@ -53,7 +55,7 @@ char* openGLSLProgram(const char* filename)
     buf << f.rdbuf();
     f.close();
     int length = buf.str().size();
-    char* res = new char[length];
+    char* res = new char[length + 1];
     strcpy(res, buf.str().c_str());
     return res;
 }
@@ -97,7 +99,7 @@ unsigned int loadTexture(const char* filename, GLenum texID)
     return texture;
 }
 
-int main()
+int main(int argc, char** argv)
 {
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -105,23 +107,35 @@ int main()
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     //glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 
-    GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
-    if (window == NULL)
+    ChapterBench bench;
+    GLFWwindow* window = NULL;
+    if (bench.init(argc, argv, "5_coordinate"))
     {
-        cout << "Failed to create GLFW window" << endl;
-        glfwTerminate();
-        return -1;
+        // benchmark mode renders headless: no window, input or presenting
+        if (!bench.createContext(800, 600))
+            return -1;
     }
-    glfwMakeContextCurrent(window);
-
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    else
     {
-        cout << "Failed to initialize GLAD" << endl;
-        return -1;
+        window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+        if (window == NULL)
+        {
+            cout << "Failed to create GLFW window" << endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwMakeContextCurrent(window);
+        glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        {
+            cout << "Failed to initialize GLAD" << endl;
+            return -1;
+        }
     }
+    bench.setup();
 
     glViewport(0, 0, 800, 600);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
     //-------data--------
     float vertices[] = {
@@ -230,6 +244,8 @@ int main()
     linkOutput(shaderProgram);
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
+    delete[] vertexShaderSource;
+    delete[] fragmentShaderSource;
 
     glUseProgram(shaderProgram);
     glUniform1i(glGetUniformLocation(shaderProgram, "texture0"), 0);
@@ -238,9 +254,11 @@ int main()
 
     glEnable(GL_DEPTH_TEST);
 
-    while (!glfwWindowShouldClose(window))
+    while (bench.running(window))
     {
-        processInput(window);
+        bench.beginFrame();
+        if (window)
+            processInput(window);
 
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -256,7 +274,7 @@ int main()
         {
             glm::mat4 model = glm::rotate(
                 glm::translate(glm::identity<glm::mat4>(), positions[i]),
-                i + (float)glfwGetTime(), glm::vec3(1.0f, 0.3f, 0.5f));
+                i + (float)bench.time(), glm::vec3(1.0f, 0.3f, 0.5f));
             glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
             glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, NULL);
         }
@@ -264,8 +282,8 @@ int main()
         glBindVertexArray(0);
         glUseProgram(0);
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        bench.present(window);
+        bench.endFrame();
     }
 
     glfwTerminate();
@@ -4,9 +4,12 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <stb_image.h>
+#include <batchMath.h>
+#include <chapterBench.h>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cstring>
 
 using namespace std;
 
@@ -31,6 +34,11 @@ float lastX = 400, lastY = 300;
 float cursorSensitivity = 0.1;
 bool cursorFocus = false;
 
+//------- render -------
+// true: MVPs are composed on the CPU in one batch pass and shaderMVP.vert only applies them
+// false: shader.vert multiplies projection * view * model for every vertex
+bool precomputeMVP = true;
+
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
@@ -114,7 +122,7 @@ char* openGLSLProgram(const char* filename)
     buf << f.rdbuf();
     f.close();
     int length = buf.str().size();
-    char* res = new char[length];
+    char* res = new char[length + 1];
     strcpy(res, buf.str().c_str());
     return res;
 }
@@ -158,7 +166,7 @@ unsigned int loadTexture(const char* filename, GLenum texID)
     return texture;
 }
 
-int main()
+int main(int argc, char** argv)
 {
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -166,25 +174,37 @@ int main()
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     //glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 
-    GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
-    if (window == NULL)
+    ChapterBench bench;
+    GLFWwindow* window = NULL;
+    if (bench.init(argc, argv, "6_camera"))
     {
-        cout << "Failed to create GLFW window" << endl;
-        glfwTerminate();
-        return -1;
+        // benchmark mode renders headless: no window, input or presenting
+        if (!bench.createContext(800, 600))
+            return -1;
     }
-    glfwMakeContextCurrent(window);
-    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
-
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    else
     {
-        cout << "Failed to initialize GLAD" << endl;
-        return -1;
+        window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+        if (window == NULL)
+        {
+            cout << "Failed to create GLFW window" << endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwMakeContextCurrent(window);
+        glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+        glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+        glfwSetCursorPosCallback(window, mouse_callback);
+
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        {
+            cout << "Failed to initialize GLAD" << endl;
+            return -1;
+        }
     }
+    bench.setup();
 
     glViewport(0, 0, 800, 600);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-    glfwSetCursorPosCallback(window, mouse_callback);
 
     //------- data --------
     float vertices[] = {
@@ -266,7 +286,8 @@ int main()
     loadTexture("../data/awesomeface.png", GL_TEXTURE1);
 
     //load glsl programs
-    char* vertexShaderSource =
+    char* vertexShaderSource = precomputeMVP ?
+        openGLSLProgram("../src/1_gettingstarted/6_camera/shaders/shaderMVP.vert") :
         openGLSLProgram("../src/1_gettingstarted/6_camera/shaders/shader.vert");
     char* fragmentShaderSource =
         openGLSLProgram("../src/1_gettingstarted/6_camera/shaders/shader.frag");
@@ -293,6 +314,8 @@ int main()
     linkOutput(shaderProgram);
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
+    delete[] vertexShaderSource;
+    delete[] fragmentShaderSource;
 
     glUseProgram(shaderProgram);
     glUniform1i(glGetUniformLocation(shaderProgram, "texture0"), 0);
@@ -301,13 +324,25 @@ int main()
 
     glEnable(GL_DEPTH_TEST);
 
-    while (!glfwWindowShouldClose(window))
+    glm::quat rotations[10];
+    glm::vec3 scales[10];
+    glm::mat4 mvps[10];
+    for (int i = 0; i < 10; i++)
+    {
+        rotations[i] = glm::angleAxis((float)(i), glm::normalize(glm::vec3(1.0f, 0.3f, 0.5f)));
+        scales[i] = glm::vec3(1.0f);
+    }
+
+    while (bench.running(window))
     {
-        float currentFrame = glfwGetTime();
+        bench.beginFrame();
+        float currentFrame = bench.time();
         deltaTime = currentFrame - lastFrame;
         lastFrame = currentFrame;
 
-        processInput(window);
+        if (window)
+            processInput(window);
+        bench.cameraPose(cameraPos, cameraFront);
 
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -315,24 +350,37 @@ int main()
         glBindVertexArray(VAO);
 
         glm::mat4 view = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(view));
         glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)screenWidth / screenHeight, 0.1f, 100.0f);
-        glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
 
-        for (int i = 0; i < 10; i++)
+        if (precomputeMVP)
+        {
+            composeMVPBatch(projection * view, positions, rotations, scales, NULL, mvps, 10);
+            int mvpLocation = glGetUniformLocation(shaderProgram, "mvp");
+            for (int i = 0; i < 10; i++)
+            {
+                glUniformMatrix4fv(mvpLocation, 1, GL_FALSE, glm::value_ptr(mvps[i]));
+                glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, NULL);
+            }
+        }
+        else
         {
-            glm::mat4 model = glm::rotate(
-                glm::translate(glm::identity<glm::mat4>(), positions[i]),
-                (float)(i), glm::vec3(1.0f, 0.3f, 0.5f));
-            glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-            glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, NULL);
+            glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(view));
+            glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
+            for (int i = 0; i < 10; i++)
+            {
+                glm::mat4 model = glm::rotate(
+                    glm::translate(glm::identity<glm::mat4>(), positions[i]),
+                    (float)(i), glm::vec3(1.0f, 0.3f, 0.5f));
+                glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
+                glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, NULL);
+            }
         }
 
         glBindVertexArray(0);
         glUseProgram(0);
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        bench.present(window);
+        bench.endFrame();
     }
 
     glfwTerminate();
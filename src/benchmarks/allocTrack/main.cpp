@@ -0,0 +1,185 @@
+#include <allocTracker.h>
+#include <cpuProfiler.h>
+#include <frameAllocator.h>
+#include <benchUtils.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// keeps the compiler from removing allocation pairs
+char* volatile sink;
+
+// nanoseconds per new/delete pair through the hooks, in the tracker's current mode
+double measureNew(int count, size_t size)
+{
+    Timer timer;
+    for (int i = 0; i < count; i++)
+    {
+        char* p = new char[size];
+        p[0] = (char)i;
+        sink = p;
+        delete[] p;
+    }
+    return timer.seconds() * 1e9 / count;
+}
+
+double measureMalloc(int count, size_t size)
+{
+    Timer timer;
+    for (int i = 0; i < count; i++)
+    {
+        char* p = (char*)malloc(size);
+        p[0] = (char)i;
+        sink = p;
+        free(p);
+    }
+    return timer.seconds() * 1e9 / count;
+}
+
+// a frame in two versions: containers and strings from the heap, or from the frame allocator
+struct FrameWork
+{
+    int objectNum;
+
+    int heapFrame(int frame)
+    {
+        int visible;
+        {
+            PROFILE_SCOPE("cull");
+            vector<int> list;
+            list.reserve(objectNum);
+            for (int i = 0; i < objectNum; i++)
+                if ((i + frame) % 3)
+                    list.push_back(i);
+            visible = (int)list.size();
+        }
+        {
+            PROFILE_SCOPE("label");
+            string label = "frame " + to_string(frame) + " with a label too long for the small string buffer";
+            visible += (int)label.size() & 1;
+        }
+        return visible;
+    }
+
+    int arenaFrame(int frame)
+    {
+        FrameAllocator::instance().beginFrame();
+        int visible;
+        {
+            PROFILE_SCOPE("cull");
+            ArenaVector<int> list(FrameAllocator::instance().arena());
+            list.reserve(objectNum);
+            for (int i = 0; i < objectNum; i++)
+                if ((i + frame) % 3)
+                    list.push_back(i);
+            visible = (int)list.size();
+        }
+        {
+            PROFILE_SCOPE("label");
+            char label[96];
+            snprintf(label, sizeof(label), "frame %d with a label too long for the small string buffer", frame);
+            visible += (int)strlen(label) & 1;
+        }
+        return visible;
+    }
+};
+
+// Cost of the operator new hook disabled, counting and capturing call sites, then a frame loop
+// that allocates per frame against one that does not, with per-scope attribution and the guard.
+// usage: allocTrack [--objects N] [--frames N] [--warmup N]
+int main(int argc, char** argv)
+{
+    int objectNum = 10000;
+    int frames = 300;
+    int warmup = 30;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--objects") && i + 1 < argc)
+            objectNum = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--warmup") && i + 1 < argc)
+            warmup = atoi(argv[++i]);
+    }
+    bool pass = true;
+    AllocTracker& tracker = AllocTracker::instance();
+    CpuProfiler::instance().setThreadName("main");
+
+    //------- hook cost -------
+    {
+        const int count = 2000000;
+        PROFILE_SCOPE("hook cost");
+        double plain = measureMalloc(count, 64);
+        double disabled = measureNew(count, 64);
+        tracker.enable();
+        double counting = measureNew(count, 64);
+        tracker.enable(true);
+        double sites = measureNew(count / 10, 64);
+        tracker.disable();
+        printf("new/delete of 64 bytes: malloc/free %.1f ns, tracker disabled %.1f ns, counting %.1f ns, "
+            "call sites %.1f ns\n", plain, disabled, counting, sites);
+    }
+
+    //------- frame loop -------
+    FrameWork work = { objectNum };
+    FrameAllocator::instance().configure(2, 64 * 1024);
+    tracker.enable(true);
+    tracker.guard(warmup, AllocViolation::Count);
+    uint64_t firstFrame = tracker.frameNum();
+    size_t result = 0;
+    for (int f = 0; f < frames; f++)
+    {
+        tracker.beginFrame();
+        {
+            PROFILE_SCOPE("frame");
+            result += work.heapFrame(f);
+        }
+        tracker.endFrame();
+    }
+    AllocTracker::Counters heapLast = tracker.lastFrame();
+    uint64_t heapViolations = tracker.violationNum();
+    printf("heap frames: ");
+    tracker.printFrame();
+    tracker.print(3);
+    // cull: one reserve; label: the concatenations, at least one past the small string buffer
+    bool attributed = heapLast.count >= 2 && heapViolations == (uint64_t)(frames - warmup) * heapLast.count &&
+        tracker.frameNum() - firstFrame == (uint64_t)frames;
+    printf("%s: %llu allocations per frame attributed to scopes, %llu in %d guarded frames\n",
+        attributed ? "PASS" : "FAIL", (unsigned long long)heapLast.count, (unsigned long long)heapViolations,
+        frames - warmup);
+    pass = attributed && pass;
+
+    tracker.guard(warmup, AllocViolation::Log);
+    uint64_t violations = tracker.violationNum();
+    for (int f = 0; f < frames; f++)
+    {
+        tracker.beginFrame();
+        {
+            PROFILE_SCOPE("frame");
+            result += work.arenaFrame(f);
+        }
+        if (f == frames - 1)
+        {
+            // known allocations are allowed, other threads are counted but not guarded
+            AllocAllowScope allow;
+            string report = "last frame " + to_string(f) + ", a string past the small buffer";
+            thread worker([]() { vector<int> v(1000); });
+            worker.join();
+        }
+        tracker.endFrame();
+    }
+    printf("arena frames: ");
+    tracker.printFrame();
+    bool heapFree = tracker.violationNum() == violations && tracker.lastFrame().count >= 2;
+    printf("%s: no allocation in %d guarded arena frames, allowed and worker allocations counted\n",
+        heapFree ? "PASS" : "FAIL", frames - warmup);
+    pass = heapFree && pass;
+    tracker.disable();
+    return pass && result ? 0 : 1;
+}
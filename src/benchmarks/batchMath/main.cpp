@@ -0,0 +1,123 @@
+#include <batchMath.h>
+#include <benchUtils.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+float maxDifference(const float* a, const float* b, size_t n)
+{
+    float m = 0.0f;
+    for (size_t i = 0; i < n; i++)
+        m = fmax(m, fabs(a[i] - b[i]));
+    return m;
+}
+
+template<typename F>
+double bestOf(int repeat, F fn)
+{
+    double best = 1e30;
+    for (int r = 0; r < repeat; r++)
+    {
+        Timer timer;
+        fn();
+        double t = timer.milliseconds();
+        best = t < best ? t : best;
+    }
+    return best;
+}
+
+void report(const char* name, double scalarMs, double batchMs, size_t count, float error)
+{
+    printf("  %-16s scalar %8.3f ms  batch %8.3f ms  %5.2fx  %7.1f M/s  max diff %g\n",
+        name, scalarMs, batchMs, scalarMs / batchMs, count / batchMs / 1000.0, error);
+}
+
+// usage: batchMath [--count N] [--repeat N]
+int main(int argc, char** argv)
+{
+    size_t count = 100000;
+    int repeat = 20;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--count") && i + 1 < argc)
+            count = (size_t)atol(argv[++i]);
+        else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+    }
+
+    mt19937 rng(42);
+    uniform_real_distribution<float> uniform(-10.0f, 10.0f);
+    vector<glm::vec3> positions(count), scales(count);
+    vector<glm::quat> rotations(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        positions[i] = glm::vec3(uniform(rng), uniform(rng), uniform(rng));
+        scales[i] = glm::vec3(1.0f + fabs(uniform(rng)) * 0.1f);
+        rotations[i] = glm::angleAxis(uniform(rng), glm::normalize(glm::vec3(1.0f, 0.3f, 0.5f)));
+    }
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 3.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 800.0f / 600.0f, 0.1f, 100.0f);
+    glm::mat4 viewProjection = projection * view;
+
+    vector<glm::mat4> modelsRef(count), models(count), mvpRef(count), mvp(count);
+    vector<glm::mat3> normalsRef(count), normals(count);
+
+    printf("%zu objects, kernels: %s\n", count, batchMathPath());
+
+    double tScalar = bestOf(repeat, [&] {
+        for (size_t i = 0; i < count; i++)
+        {
+            // as the chapters do: translate, rotate, scale one call at a time
+            glm::mat4 m = glm::translate(glm::identity<glm::mat4>(), positions[i]);
+            m = m * glm::mat4_cast(rotations[i]);
+            modelsRef[i] = glm::scale(m, scales[i]);
+        }
+    });
+    double tBatch = bestOf(repeat, [&] {
+        composeTRSBatch(positions.data(), rotations.data(), scales.data(), models.data(), count);
+    });
+    report("compose TRS", tScalar, tBatch, count,
+        maxDifference(&modelsRef[0][0][0], &models[0][0][0], count * 16));
+
+    tScalar = bestOf(repeat, [&] {
+        for (size_t i = 0; i < count; i++)
+            mvpRef[i] = viewProjection * modelsRef[i];
+    });
+    tBatch = bestOf(repeat, [&] {
+        mulMat4Batch(viewProjection, modelsRef.data(), mvp.data(), count);
+    });
+    report("VP * model", tScalar, tBatch, count,
+        maxDifference(&mvpRef[0][0][0], &mvp[0][0][0], count * 16));
+
+    tScalar = bestOf(repeat, [&] {
+        for (size_t i = 0; i < count; i++)
+            normalsRef[i] = glm::transpose(glm::inverse(glm::mat3(modelsRef[i])));
+    });
+    tBatch = bestOf(repeat, [&] {
+        normalMatrixBatch(modelsRef.data(), normals.data(), count);
+    });
+    report("normal matrix", tScalar, tBatch, count,
+        maxDifference(&normalsRef[0][0][0], &normals[0][0][0], count * 9));
+
+    tScalar = bestOf(repeat, [&] {
+        for (size_t i = 0; i < count; i++)
+        {
+            glm::mat4 m = glm::translate(glm::identity<glm::mat4>(), positions[i]);
+            m = m * glm::mat4_cast(rotations[i]);
+            mvpRef[i] = projection * view * glm::scale(m, scales[i]);
+        }
+    });
+    tBatch = bestOf(repeat, [&] {
+        composeMVPBatch(viewProjection, positions.data(), rotations.data(), scales.data(),
+            nullptr, mvp.data(), count);
+    });
+    report("TRS + MVP pass", tScalar, tBatch, count,
+        maxDifference(&mvpRef[0][0][0], &mvp[0][0][0], count * 16));
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <renderTarget.h>
+#include <cubeScene.h>
+#include <videoCapture.h>
+#include <yuvConvert.h>
+#include <frameLimiter.h>
+#include <benchUtils.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+enum class Mode
+{
+    Off,
+    Capture,        // VideoCapture: PBO ring + worker
+    Sync,           // glReadPixels, convert and write on the render thread (file discarded)
+};
+
+struct RunResult
+{
+    vector<double> workMs;
+    uint64_t dropped = 0;
+};
+
+void report(const char* name, RunResult& r, double budgetMs)
+{
+    vector<double>& w = r.workMs;
+    sort(w.begin(), w.end());
+    double mean = 0.0;
+    for (double t : w)
+        mean += t;
+    mean /= w.size();
+    size_t late = w.end() - upper_bound(w.begin(), w.end(), budgetMs);
+    printf("  %-8s frame work mean %6.2f ms  p99 %6.2f ms  max %6.2f ms  over budget %3zu  dropped %llu\n",
+        name, mean, w[(size_t)(w.size() * 0.99)], w.back(), late, (unsigned long long)r.dropped);
+}
+
+// One 60 Hz run of the cube scene. The frame's work ends with glFinish, standing in for the
+// swap of a vsynced window, so readbacks that stall the pipeline show up in the frame time.
+RunResult run(Mode mode, CubeScene& scene, RenderTarget& target, int frames, double fps, const char* path)
+{
+    RunResult result;
+    int width = target.width(), height = target.height();
+    VideoCapture capture;
+    FILE* syncFile = NULL;
+    vector<unsigned char> rgba((size_t)width * height * 4), yuv((size_t)width * height * 3 / 2);
+    if (mode == Mode::Capture && !capture.start(path, width, height, (int)fps))
+        return result;
+    if (mode == Mode::Sync)
+        syncFile = fopen((string(path) + ".sync").c_str(), "wb");
+
+    FrameLimiter limiter(fps);
+    for (int f = 0; f < frames; f++)
+    {
+        limiter.wait();
+        Timer timer;
+        target.bind();
+        scene.draw(CubeScene::orbitView(f * 0.01f), (float)width / height);
+        if (mode == Mode::Capture)
+            capture.capture(target.framebuffer());
+        else if (mode == Mode::Sync)
+        {
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, target.framebuffer());
+            glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, rgba.data());
+            size_t luma = (size_t)width * height;
+            rgbaToYuv420(rgba.data(), width, height, (size_t)width * 4, true, yuv.data(), yuv.data() + luma, yuv.data() + luma * 5 / 4);
+            if (syncFile)
+                fwrite(yuv.data(), 1, yuv.size(), syncFile);
+        }
+        glFinish();
+        result.workMs.push_back(timer.milliseconds());
+    }
+    if (mode == Mode::Capture)
+    {
+        capture.stop();
+        capture.print();
+        result.dropped = capture.droppedNum();
+    }
+    if (syncFile)
+    {
+        fclose(syncFile);
+        remove((string(path) + ".sync").c_str());
+    }
+    return result;
+}
+
+// usage: capture [--frames N] [--size WxH] [--fps N] [--out file.y4m|file.yuv] [--keep]
+int main(int argc, char** argv)
+{
+    int frames = 300;
+    int width = 1920, height = 1080;
+    double fps = 60.0;
+    const char* path = "capture_bench.y4m";
+    bool keep = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--size") && i + 1 < argc)
+            sscanf(argv[++i], "%dx%d", &width, &height);
+        else if (!strcmp(argv[i], "--fps") && i + 1 < argc)
+            fps = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+            path = argv[++i];
+        else if (!strcmp(argv[i], "--keep"))
+            keep = true;
+    }
+
+    //------- color conversion -------
+    {
+        vector<unsigned char> rgba((size_t)width * height * 4), yuv((size_t)width * height * 3 / 2);
+        mt19937 rng(1);
+        for (unsigned char& c : rgba)
+            c = (unsigned char)rng();
+        size_t luma = (size_t)width * height;
+        const int reps = 20;
+        Timer timer;
+        for (int r = 0; r < reps; r++)
+            rgbaToYuv420Scalar(rgba.data(), width, height, (size_t)width * 4, true, yuv.data(), yuv.data() + luma, yuv.data() + luma * 5 / 4);
+        double scalarMs = timer.milliseconds() / reps;
+        timer.reset();
+        for (int r = 0; r < reps; r++)
+            rgbaToYuv420(rgba.data(), width, height, (size_t)width * 4, true, yuv.data(), yuv.data() + luma, yuv.data() + luma * 5 / 4);
+        double simdMs = timer.milliseconds() / reps;
+        printf("RGBA -> YUV420 %dx%d: scalar %.2f ms, %s %.2f ms (%.1fx, %.0f Mpixel/s)\n", width, height,
+            scalarMs, yuvConvertPath(), simdMs, scalarMs / simdMs, luma / simdMs / 1000.0);
+    }
+
+    //------- frame time impact -------
+    ContextDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.visible = false;
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    unique_ptr<GLContext> context = GLContext::create(backend, desc);
+    if (!context)
+        return -1;
+    printf("%d frames %dx%d at %.0f fps on %s\n", frames, width, height, fps, (const char*)glGetString(GL_RENDERER));
+    {
+        RenderTarget target;
+        CubeScene scene;
+        if (!target.create(width, height) || !scene.init(NULL))
+            return -1;
+        double budget = 1000.0 / fps;
+        RunResult off = run(Mode::Off, scene, target, frames, fps, path);
+        RunResult captured = run(Mode::Capture, scene, target, frames, fps, path);
+        RunResult sync = run(Mode::Sync, scene, target, frames, fps, path);
+        report("off", off, budget);
+        report("capture", captured, budget);
+        report("sync", sync, budget);
+        RenderTarget::unbind();
+    }
+    if (!keep)
+        remove(path);
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include <world.h>
+#include <threadPool.h>
+#include <benchUtils.h>
+#include <glm/glm.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+struct Position { glm::vec3 value; };
+struct Velocity { glm::vec3 value; };
+struct Spin { float angle; float speed; };
+struct Health { float value; float decay; };
+struct Tint { glm::vec4 color; };
+
+// Object-per-allocation baseline, the usual alternative to an ECS
+struct GameObject
+{
+    glm::vec3 position;
+    glm::vec3 velocity;
+    float angle, speed;
+    float health, decay;
+    glm::vec4 color;
+    bool hasSpin, hasHealth;
+};
+
+const float dt = 1.0f / 60.0f;
+
+// usage: ecs [--entities N] [--frames N]
+int main(int argc, char** argv)
+{
+    size_t entityNum = 1000000;
+    int frames = 20;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--entities") && i + 1 < argc)
+            entityNum = (size_t)atol(argv[++i]);
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+    }
+    ThreadPool& pool = ThreadPool::global();
+    printf("%zu entities, %u threads, %d frames\n", entityNum, pool.size() + 1, frames);
+
+    //------- setup -------
+    World world;
+    vector<Entity> entities(entityNum);
+    Timer timer;
+    for (size_t i = 0; i < entityNum; i++)
+    {
+        glm::vec3 p((float)i, 0.0f, 0.0f);
+        if (i % 2 == 0)
+            entities[i] = world.create(Position{ p }, Velocity{ glm::vec3(1.0f) }, Spin{ 0.0f, 1.0f }, Health{ 100.0f, 0.5f });
+        else if (i % 4 == 1)
+            entities[i] = world.create(Position{ p }, Velocity{ glm::vec3(1.0f) }, Tint{ glm::vec4(1.0f) });
+        else
+            entities[i] = world.create(Position{ p }, Velocity{ glm::vec3(1.0f) }, Spin{ 0.0f, 2.0f });
+    }
+    printf("  create:            %8.2f ms (%zu archetypes)\n", timer.milliseconds(), world.archetypeNum());
+
+    vector<unique_ptr<GameObject>> objects(entityNum);
+    for (size_t i = 0; i < entityNum; i++)
+    {
+        objects[i].reset(new GameObject());
+        objects[i]->position = glm::vec3((float)i, 0.0f, 0.0f);
+        objects[i]->velocity = glm::vec3(1.0f);
+        objects[i]->hasSpin = i % 4 != 1;
+        objects[i]->hasHealth = i % 2 == 0;
+        objects[i]->speed = 1.0f;
+        objects[i]->decay = 0.5f;
+        objects[i]->health = 100.0f;
+    }
+
+    //------- systems -------
+    Scheduler scheduler;
+    scheduler.add("movement", Scheduler::Read<Velocity>(), Scheduler::Write<Position>(), [&](World& w) {
+        w.parallelEach<Position, Velocity>(pool, [](Position& p, const Velocity& v) { p.value += v.value * dt; });
+    });
+    scheduler.add("spin", Scheduler::Read<>(), Scheduler::Write<Spin>(), [&](World& w) {
+        w.parallelEach<Spin>(pool, [](Spin& s) { s.angle += s.speed * dt; });
+    });
+    scheduler.add("health", Scheduler::Read<>(), Scheduler::Write<Health>(), [&](World& w) {
+        w.parallelEach<Health>(pool, [](Health& h) { h.value -= h.decay * dt; });
+    });
+    scheduler.add("bounds", Scheduler::Read<Position>(), Scheduler::Write<Velocity>(), [&](World& w) {
+        w.parallelEach<Position, Velocity>(pool, [](const Position& p, Velocity& v) {
+            if (p.value.y > 100.0f)
+                v.value.y = -v.value.y;
+        });
+    });
+    printf("  scheduler stages:  %zu for 4 systems\n", scheduler.stages().size());
+
+    //------- iterate -------
+    double tObjects = 0, tSerial = 0, tParallel = 0;
+    for (int f = 0; f < frames; f++)
+    {
+        timer.reset();
+        for (auto& o : objects)
+        {
+            o->position += o->velocity * dt;
+            if (o->hasSpin)
+                o->angle += o->speed * dt;
+            if (o->hasHealth)
+                o->health -= o->decay * dt;
+            if (o->position.y > 100.0f)
+                o->velocity.y = -o->velocity.y;
+        }
+        tObjects += timer.milliseconds();
+
+        timer.reset();
+        world.each<Position, Velocity>([](Position& p, const Velocity& v) { p.value += v.value * dt; });
+        world.each<Spin>([](Spin& s) { s.angle += s.speed * dt; });
+        world.each<Health>([](Health& h) { h.value -= h.decay * dt; });
+        world.each<Position, Velocity>([](const Position& p, Velocity& v) {
+            if (p.value.y > 100.0f)
+                v.value.y = -v.value.y;
+        });
+        tSerial += timer.milliseconds();
+
+        timer.reset();
+        scheduler.run(world, &pool);
+        tParallel += timer.milliseconds();
+    }
+    printf("  iterate (objects): %8.2f ms/frame\n", tObjects / frames);
+    printf("  iterate (ecs):     %8.2f ms/frame\n", tSerial / frames);
+    printf("  iterate (jobs):    %8.2f ms/frame\n", tParallel / frames);
+
+    //------- mutate -------
+    // move 10% of the entities between archetypes and back
+    timer.reset();
+    for (size_t i = 0; i < entityNum; i += 10)
+        world.add<Tint>(entities[i], Tint{ glm::vec4(0.5f) });
+    for (size_t i = 0; i < entityNum; i += 10)
+        world.remove<Tint>(entities[i]);
+    double tMutate = timer.milliseconds();
+    printf("  add+remove 10%%:    %8.2f ms (%.1f ns/change)\n", tMutate, tMutate * 1e6 / (entityNum / 5));
+
+    timer.reset();
+    for (size_t i = 0; i < entityNum; i += 2)
+        world.destroy(entities[i]);
+    printf("  destroy 50%%:       %8.2f ms, %zu alive\n", timer.milliseconds(), world.size());
+    return 0;
+}
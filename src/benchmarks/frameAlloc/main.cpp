@@ -0,0 +1,239 @@
+#include <frameAllocator.h>
+#include <benchUtils.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+//------- heap counting -------
+// replaces the global allocation functions of this program: every new and STL allocation counts
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"   // operator delete frees what operator new mallocs
+#endif
+atomic<uint64_t> heapAllocations{ 0 };
+atomic<uint64_t> heapBytes{ 0 };
+
+void* operator new(size_t size)
+{
+    heapAllocations.fetch_add(1, memory_order_relaxed);
+    heapBytes.fetch_add(size, memory_order_relaxed);
+    if (void* p = malloc(size ? size : 1))
+        return p;
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+//------- a frame's transient data -------
+const int kMaterialNum = 16;
+
+struct Object
+{
+    glm::vec3 position;
+    float radius;
+    int material;
+};
+
+struct DrawCommand
+{
+    uint64_t key;               // material, then depth
+    int object;
+};
+
+struct FrameConstants
+{
+    glm::mat4 viewProjection;
+    glm::vec4 planes[6];
+};
+
+// culling results, matrices, per-material lists and a sorted command list, allocated the way
+// Make says: std::vector and new, or ArenaVector from the frame allocator
+template <typename Make>
+size_t buildFrame(const vector<Object>& objects, float time, Make make)
+{
+    FrameConstants* constants = make.template object<FrameConstants>();
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 200.0f);
+    glm::vec3 eye(sinf(time) * 20.0f, 5.0f, cosf(time) * 20.0f);
+    constants->viewProjection = projection * glm::lookAt(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+    auto visible = make.template vector<int>();
+    for (int i = 0; i < (int)objects.size(); i++)
+    {
+        glm::vec4 clip = constants->viewProjection * glm::vec4(objects[i].position, 1.0f);
+        if (clip.w > 0.0f && fabsf(clip.x) < clip.w + objects[i].radius && fabsf(clip.y) < clip.w + objects[i].radius)
+            visible.push_back(i);
+    }
+    auto matrices = make.template vector<glm::mat4>();
+    for (int i : visible)
+        matrices.push_back(glm::translate(constants->viewProjection, objects[i].position));
+    auto buckets = make.template buckets<int>(kMaterialNum);
+    for (int i : visible)
+        buckets[objects[i].material].push_back(i);
+    auto commands = make.template vector<DrawCommand>();
+    for (size_t m = 0; m < buckets.size(); m++)
+    {
+        for (int i : buckets[m])
+        {
+            float depth = glm::length(objects[i].position - eye);
+            commands.push_back({ (uint64_t)m << 32 | (uint32_t)(depth * 1000.0f), i });
+        }
+    }
+    sort(commands.begin(), commands.end(), [](const DrawCommand& a, const DrawCommand& b) { return a.key < b.key; });
+    make.release(constants);
+    return commands.size() + matrices.size();
+}
+
+struct HeapMake
+{
+    template <typename T> T* object() { return new T(); }
+    template <typename T> void release(T* p) { delete p; }
+    template <typename T> vector<T> vector() { return std::vector<T>(); }
+    template <typename T> std::vector<std::vector<T>> buckets(int n) { return std::vector<std::vector<T>>(n); }
+};
+
+struct FrameMake
+{
+    LinearArena& arena;
+    template <typename T> T* object() { return new (arena.allocateArray<T>(1)) T(); }
+    template <typename T> void release(T* p) { p->~T(); }
+    template <typename T> ArenaVector<T> vector() { return ArenaVector<T>(arena); }
+    template <typename T> ArenaVector<ArenaVector<T>> buckets(int n)
+    {
+        return ArenaVector<ArenaVector<T>>(n, ArenaVector<T>(arena), arena);
+    }
+};
+
+struct Result
+{
+    double ms;
+    double allocations;         // per frame, after warm-up
+    double bytes;
+};
+
+template <typename Run>
+Result measure(int frames, int warmup, Run run)
+{
+    for (int f = 0; f < warmup; f++)
+        run(f);
+    uint64_t allocations = heapAllocations, bytes = heapBytes;
+    Timer timer;
+    for (int f = warmup; f < warmup + frames; f++)
+        run(f);
+    return { timer.milliseconds() / frames, (double)(heapAllocations - allocations) / frames,
+        (double)(heapBytes - bytes) / frames };
+}
+
+// Per-frame transient data through std::vector and new, against the per-thread frame arenas,
+// counting heap allocations with a replaced global operator new. Then checks that a frame's
+// data survives 'latency' frames and that worker threads get their own arenas.
+// usage: frameAlloc [--objects N] [--frames N] [--latency N]
+int main(int argc, char** argv)
+{
+    int objectNum = 20000;
+    int frames = 200;
+    int latency = 2;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--objects") && i + 1 < argc)
+            objectNum = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--latency") && i + 1 < argc)
+            latency = atoi(argv[++i]);
+    }
+
+    mt19937 rng(1234);
+    uniform_real_distribution<float> uniform(-50.0f, 50.0f);
+    vector<Object> objects(objectNum);
+    for (int i = 0; i < objectNum; i++)
+        objects[i] = { glm::vec3(uniform(rng), uniform(rng) * 0.2f, uniform(rng)), 1.0f, i % kMaterialNum };
+
+    FrameAllocator& frameAllocator = FrameAllocator::instance();
+    frameAllocator.configure(latency, 64 * 1024);
+    const int warmup = 10;
+    size_t checksum[2] = {};
+    Result heap = measure(frames, warmup, [&](int f) {
+        checksum[0] += buildFrame(objects, f * 0.01f, HeapMake());
+    });
+    Result arena = measure(frames, warmup, [&](int f) {
+        frameAllocator.beginFrame();
+        checksum[1] += buildFrame(objects, f * 0.01f, FrameMake{ frameAllocator.arena() });
+    });
+    printf("%d objects, %d frames after %d warm-up frames, frame latency %d\n", objectNum, frames, warmup, latency);
+    printf("  %-16s %8.3f ms/frame  %8.1f allocations/frame  %10.0f bytes/frame\n", "std::vector, new", heap.ms,
+        heap.allocations, heap.bytes);
+    printf("  %-16s %8.3f ms/frame  %8.1f allocations/frame  %10.0f bytes/frame\n", "frame arena", arena.ms,
+        arena.allocations, arena.bytes);
+    frameAllocator.print();
+    bool pass = arena.allocations == 0.0 && checksum[0] == checksum[1];
+    printf("%s: no heap allocation in steady-state frames, same results\n", pass ? "PASS" : "FAIL");
+
+    //------- latency -------
+    // what frame N allocated is intact until frame N + latency starts
+    {
+        frameAllocator.beginFrame();
+        const int count = 4096;
+        int* data = frameAllocator.allocateArray<int>(count);
+        for (int i = 0; i < count; i++)
+            data[i] = i * 7;
+        for (int f = 1; f < frameAllocator.latency(); f++)
+        {
+            frameAllocator.beginFrame();
+            buildFrame(objects, f * 0.01f, FrameMake{ frameAllocator.arena() });
+        }
+        bool intact = true;
+        for (int i = 0; i < count; i++)
+            intact = intact && data[i] == i * 7;
+        printf("%s: frame data intact %d frames later\n", intact ? "PASS" : "FAIL", frameAllocator.latency() - 1);
+        pass = intact && pass;
+    }
+
+    //------- threads -------
+    // each thread allocates from its own arena; arenas of finished threads are reused
+    {
+        const int threadNum = 4;
+        for (int round = 0; round < 3; round++)
+        {
+            frameAllocator.beginFrame();
+            vector<int*> blocks(threadNum);
+            vector<thread> workers;
+            for (int t = 0; t < threadNum; t++)
+            {
+                workers.emplace_back([&, t]() {
+                    blocks[t] = frameAllocator.allocateArray<int>(1024);
+                    for (int i = 0; i < 1024; i++)
+                        blocks[t][i] = t;
+                });
+            }
+            for (thread& w : workers)
+                w.join();
+            for (int t = 0; t < threadNum; t++)
+            {
+                for (int i = 0; i < 1024; i++)
+                    pass = pass && blocks[t][i] == t;
+            }
+        }
+        FrameAllocator::Stats s = frameAllocator.stats();
+        bool reused = s.threads <= threadNum + 1;
+        printf("%s: %d threads x 3 rounds used %d arena sets\n", reused ? "PASS" : "FAIL", threadNum, s.threads);
+        pass = reused && pass;
+    }
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include <frameLimiter.h>
+#include <frameStats.h>
+#include <benchUtils.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+using namespace std;
+
+typedef FrameLimiter::Clock Clock;
+
+// Frame work of random length, up to half the frame budget
+void work(mt19937& rng, double budget)
+{
+    uniform_real_distribution<double> length(0.0, budget * 0.5);
+    Timer timer;
+    double ms = length(rng) * 1000.0;
+    while (timer.milliseconds() < ms)
+        ;
+}
+
+void report(const char* name, const FrameStats& stats, double targetMs)
+{
+    stats.print(name);
+    printf("  %-10s error vs %.3f ms: mean %+.3f ms, p99 %.3f ms\n", "",
+        targetMs, stats.meanFrameMs() - targetMs, stats.percentileFrameMs(99.0) - targetMs);
+}
+
+// usage: frameLimiter [--fps N] [--frames N]
+int main(int argc, char** argv)
+{
+    double fps = 144.0;
+    int frames = 600;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (!strcmp(argv[i], "--fps"))
+            fps = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--frames"))
+            frames = atoi(argv[++i]);
+    }
+    double period = 1.0 / fps;
+    Clock::duration step = chrono::duration_cast<Clock::duration>(chrono::duration<double>(period));
+    printf("%d frames at %.1f fps (%.3f ms)\n", frames, fps, period * 1000.0);
+
+    //------- OS sleep only -------
+    {
+        mt19937 rng(1);
+        FrameStats stats;
+        Clock::time_point next = Clock::now();
+        for (int f = 0; f <= frames; f++)
+        {
+            stats.frame();
+            stats.beginWork();
+            work(rng, period);
+            stats.endWork();
+            next += step;
+            FrameLimiter::sleepUntil(next);
+        }
+        report("sleep", stats, period * 1000.0);
+    }
+
+    //------- spin only -------
+    {
+        mt19937 rng(1);
+        FrameStats stats;
+        Clock::time_point next = Clock::now();
+        for (int f = 0; f <= frames; f++)
+        {
+            stats.frame();
+            stats.beginWork();
+            work(rng, period);
+            stats.endWork();
+            next += step;
+            while (Clock::now() < next)
+                ;
+        }
+        report("spin", stats, period * 1000.0);
+    }
+
+    //------- hybrid -------
+    {
+        mt19937 rng(1);
+        FrameStats stats;
+        FrameLimiter limiter(fps);
+        for (int f = 0; f <= frames; f++)
+        {
+            stats.frame();
+            stats.beginWork();
+            work(rng, period);
+            stats.endWork();
+            limiter.wait();
+        }
+        report("hybrid", stats, period * 1000.0);
+        printf("  %-10s measured sleep overshoot %.3f ms\n", "", limiter.sleepOvershoot() * 1000.0);
+    }
+    return 0;
+}
@@ -0,0 +1,9 @@
+#ifndef GL_DEBUG_LAYER
+#define GL_DEBUG_LAYER
+#endif
+#include <glDebug.h>
+#include "drawWorkload.h"
+
+#define DRAW_WORKLOAD_NAME drawChecked
+#define EMPTY_CALLS_NAME emptyCallsChecked
+#include "drawWorkload.inl"
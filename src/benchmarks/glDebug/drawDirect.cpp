@@ -0,0 +1,7 @@
+#undef GL_DEBUG_LAYER
+#include <glDebug.h>
+#include "drawWorkload.h"
+
+#define DRAW_WORKLOAD_NAME drawDirect
+#define EMPTY_CALLS_NAME emptyCallsDirect
+#include "drawWorkload.inl"
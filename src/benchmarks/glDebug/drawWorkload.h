@@ -0,0 +1,22 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+// The draw loop of the chapters (per object: uniform upload and draw) with every call wrapped
+// in GL_CHECK. It is compiled twice, with and without GL_DEBUG_LAYER, so one executable
+// measures both builds.
+struct DrawWorkload
+{
+    unsigned int vao;
+    unsigned int program;
+    int mvpLocation;
+    const glm::mat4* mvps;
+    int objectNum;
+};
+
+void drawDirect(const DrawWorkload& w);     // GL_CHECK compiled out
+void drawChecked(const DrawWorkload& w);    // GL_CHECK compiled in
+
+// callNum calls through an empty function pointer, like a GLAD entry point: the layer's own cost
+void emptyCallsDirect(int callNum);
+void emptyCallsChecked(int callNum);
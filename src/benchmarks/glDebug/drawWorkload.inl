@@ -0,0 +1,28 @@
+// body of the Direct and Checked functions, see drawWorkload.h
+#include <glad/glad.h>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace
+{
+    void APIENTRY emptyFunction(GLuint) {}
+    void (APIENTRYP volatile emptyPointer)(GLuint) = emptyFunction;
+}
+
+void EMPTY_CALLS_NAME(int callNum)
+{
+    for (int i = 0; i < callNum; i++)
+        GL_CHECK(emptyPointer((GLuint)i));
+}
+
+void DRAW_WORKLOAD_NAME(const DrawWorkload& w)
+{
+    GL_CHECK(glUseProgram(w.program));
+    GL_CHECK(glBindVertexArray(w.vao));
+    for (int i = 0; i < w.objectNum; i++)
+    {
+        GL_CHECK(glUniformMatrix4fv(w.mvpLocation, 1, GL_FALSE, glm::value_ptr(w.mvps[i])));
+        GL_CHECK(glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, NULL));
+    }
+    GL_CHECK(glBindVertexArray(0));
+    GL_CHECK(glUseProgram(0));
+}
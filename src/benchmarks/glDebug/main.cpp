@@ -0,0 +1,200 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <renderTarget.h>
+#include <cubeSceneData.h>
+#include <benchUtils.h>
+#include <glDebug.h>
+#include "drawWorkload.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+const char* kVertexSource =
+    "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "uniform mat4 mvp;\n"
+    "void main() { gl_Position = mvp * vec4(aPos, 1.0); }\n";
+const char* kFragmentSource =
+    "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "void main() { FragColor = vec4(1.0, 0.5, 0.2, 1.0); }\n";
+
+unsigned int createProgram()
+{
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &kVertexSource, NULL);
+    glCompileShader(vertexShader);
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &kFragmentSource, NULL);
+    glCompileShader(fragmentShader);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        printf("ERROR: Link failed.\n");
+        return 0;
+    }
+    return program;
+}
+
+unsigned int createCube()
+{
+    unsigned int vao, vbo, ebo;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kCubeVertices), kCubeVertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glGenBuffers(1, &ebo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kCubeIndices), kCubeIndices, GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    return vao;
+}
+
+// CPU time to submit one frame; the GPU work is finished outside the measurement
+double measure(void (*draw)(const DrawWorkload&), const DrawWorkload& workload, int frames)
+{
+    vector<double> ms;
+    for (int f = 0; f < frames; f++)
+    {
+        Timer timer;
+        draw(workload);
+        ms.push_back(timer.milliseconds());
+        glFinish();
+    }
+    sort(ms.begin(), ms.end());
+    return ms[ms.size() / 2];
+}
+
+// usage: glDebug [--frames N] [--objects N]
+int main(int argc, char** argv)
+{
+    int frames = 200;
+    int objectNum = 2000;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--objects") && i + 1 < argc)
+            objectNum = atoi(argv[++i]);
+    }
+
+    ContextDesc desc;
+    desc.visible = false;
+    desc.debug = true;
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    unique_ptr<GLContext> context = GLContext::create(backend, desc);
+    if (!context)
+        return -1;
+    printf("%s, GL_KHR_debug %s\n", (const char*)glGetString(GL_RENDERER), GLAD_GL_KHR_debug ? "yes" : "no");
+
+    // small target and tiny cubes: the frame is bound by call submission, not by the rasterizer
+    RenderTarget target;
+    unsigned int program = createProgram();
+    if (!program || !target.create(64, 64))
+        return -1;
+    target.bind();
+    vector<glm::mat4> mvps(objectNum);
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 100.0f);
+    for (int i = 0; i < objectNum; i++)
+        mvps[i] = glm::scale(glm::translate(projection, glm::vec3((i % 50) * 0.1f - 2.5f, (i / 50 % 50) * 0.1f - 2.5f, -10.0f)), glm::vec3(0.02f));
+    DrawWorkload workload = { createCube(), program, glGetUniformLocation(program, "mvp"), mvps.data(), objectNum };
+    int callNum = objectNum * 2 + 4;
+
+    //------- overhead -------
+    GLDebug& debug = GLDebug::instance();
+    struct Run
+    {
+        const char* name;
+        void (*draw)(const DrawWorkload&);
+        int mode;           // 0 layer idle, 1 synchronous callback, 2 asynchronous callback, 3 glGetError
+    };
+    const Run runs[] = {
+        { "release (direct calls)", drawDirect, 0 },
+        { "debug, layer idle", drawChecked, 0 },
+        { "debug, KHR_debug sync", drawChecked, 1 },
+        { "debug, KHR_debug async", drawChecked, 2 },
+        { "debug, glGetError", drawChecked, 3 },
+    };
+    // rounds alternate the modes, so drift in the machine's speed hits them all alike
+    const int roundNum = 5;
+    const int runNum = sizeof(runs) / sizeof(runs[0]);
+    double best[runNum];
+    for (int r = 0; r < runNum; r++)
+        best[r] = 1e30;
+    for (int round = 0; round < roundNum; round++)
+    {
+        for (int r = 0; r < runNum; r++)
+        {
+            const Run& run = runs[r];
+            if (run.mode == 1 || run.mode == 2)
+            {
+                if (!debug.init(run.mode == 1))
+                    continue;
+            }
+            else if (run.mode == 3)
+                debug.init(true, false);
+            measure(run.draw, workload, 5);
+            best[r] = min(best[r], measure(run.draw, workload, max(frames / roundNum, 1)));
+            debug.shutdown();
+        }
+    }
+    printf("%d objects, %d GL calls per frame, best of %d rounds of the median frame\n", objectNum, callNum, roundNum);
+    for (int r = 0; r < runNum; r++)
+    {
+        if (best[r] == 1e30)
+            continue;
+        printf("  %-24s %7.3f ms/frame  %6.1f ns/call  %+6.1f%%\n", runs[r].name, best[r], best[r] * 1e6 / callNum,
+            (best[r] / best[0] - 1.0) * 100.0);
+    }
+
+    //------- wrapper alone -------
+    {
+        const int emptyNum = 10000000;
+        double wrapped[2] = { 1e30, 1e30 };
+        for (int round = 0; round < roundNum; round++)
+        {
+            Timer timer;
+            emptyCallsDirect(emptyNum);
+            wrapped[0] = min(wrapped[0], timer.milliseconds());
+            timer.reset();
+            emptyCallsChecked(emptyNum);
+            wrapped[1] = min(wrapped[1], timer.milliseconds());
+        }
+        printf("empty call: direct %.2f ns, GL_CHECK %.2f ns (layer idle)\n",
+            wrapped[0] * 1e6 / emptyNum, wrapped[1] * 1e6 / emptyNum);
+    }
+
+    //------- reporting -------
+    // an invalid call at a known place, repeated: reported once with its location, then as a count
+    debug.init();
+    for (int i = 0; i < 100; i++)
+    {
+        GLCallSite site(__FILE__, __LINE__, "glBindBuffer(GL_ARRAY_BUFFER, 0xdead)");
+        glBindBuffer(GL_ARRAY_BUFFER, 0xdead);
+        if (i == 0 || i == 99)
+            debug.flush();
+    }
+    bool reported = debug.errorNum() == 100;
+    printf("%s: %llu errors recorded for 100 invalid calls\n", reported ? "PASS" : "FAIL", (unsigned long long)debug.errorNum());
+    debug.shutdown();
+
+    RenderTarget::unbind();
+    return reported || !GLAD_GL_KHR_debug ? 0 : 1;
+}
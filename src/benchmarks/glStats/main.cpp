@@ -0,0 +1,223 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <renderTarget.h>
+#include <cubeSceneData.h>
+#include <benchUtils.h>
+#include <glStats.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+const char* kVertexSource =
+    "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "uniform mat4 mvp;\n"
+    "void main() { gl_Position = mvp * vec4(aPos, 1.0); }\n";
+const char* kFragmentSource =
+    "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "void main() { FragColor = vec4(1.0, 0.5, 0.2, 1.0); }\n";
+
+unsigned int createProgram()
+{
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &kVertexSource, NULL);
+    glCompileShader(vertexShader);
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &kFragmentSource, NULL);
+    glCompileShader(fragmentShader);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        printf("ERROR: Link failed.\n");
+        return 0;
+    }
+    return program;
+}
+
+unsigned int createCube()
+{
+    unsigned int vao, vbo, ebo;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kCubeVertices), kCubeVertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glGenBuffers(1, &ebo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kCubeIndices), kCubeIndices, GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    return vao;
+}
+
+struct Workload
+{
+    unsigned int vao;
+    unsigned int program;
+    int mvpLocation;
+    const glm::mat4* mvps;
+    int objectNum;
+    bool lookUpLocation;        // the anti-pattern: a uniform location query per draw
+};
+
+void draw(const Workload& w)
+{
+    GLStats& stats = GLStats::instance();
+    stats.beginFrame();
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glUseProgram(w.program);
+    glBindVertexArray(w.vao);
+    for (int i = 0; i < w.objectNum; i++)
+    {
+        int location = w.lookUpLocation ? glGetUniformLocation(w.program, "mvp") : w.mvpLocation;
+        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(w.mvps[i]));
+        glDrawElements(GL_TRIANGLES, kCubeIndexNum, GL_UNSIGNED_INT, NULL);
+    }
+    glBindVertexArray(0);
+    stats.endFrame();
+}
+
+// CPU time to submit one frame; the GPU work is finished outside the measurement
+double measure(const Workload& workload, int frames)
+{
+    vector<double> ms;
+    for (int f = 0; f < frames; f++)
+    {
+        Timer timer;
+        draw(workload);
+        ms.push_back(timer.milliseconds());
+        glFinish();
+    }
+    sort(ms.begin(), ms.end());
+    return ms[ms.size() / 2];
+}
+
+void APIENTRY emptyActiveTexture(GLenum /*texture*/)
+{
+}
+
+double emptyCalls(int num, bool direct)
+{
+    Timer timer;
+    for (int i = 0; i < num; i++)
+    {
+        if (direct)
+            glad_glActiveTexture(GL_TEXTURE0);
+        else
+            glActiveTexture(GL_TEXTURE0);
+    }
+    return timer.milliseconds() * 1e6 / num;
+}
+
+// usage: glStats [--frames N] [--objects N]
+int main(int argc, char** argv)
+{
+    int frames = 200;
+    int objectNum = 2000;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--objects") && i + 1 < argc)
+            objectNum = atoi(argv[++i]);
+    }
+
+    ContextDesc desc;
+    desc.visible = false;
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    unique_ptr<GLContext> context = GLContext::create(backend, desc);
+    if (!context)
+        return -1;
+    printf("%s\n", (const char*)glGetString(GL_RENDERER));
+
+    // small target and tiny cubes: the frame is bound by call submission, not by the rasterizer
+    RenderTarget target;
+    unsigned int program = createProgram();
+    if (!program || !target.create(64, 64))
+        return -1;
+    target.bind();
+    vector<glm::mat4> mvps(objectNum);
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 100.0f);
+    for (int i = 0; i < objectNum; i++)
+        mvps[i] = glm::scale(glm::translate(projection, glm::vec3((i % 50) * 0.1f - 2.5f, (i / 50 % 50) * 0.1f - 2.5f, -10.0f)), glm::vec3(0.02f));
+    Workload workload = { createCube(), program, glGetUniformLocation(program, "mvp"), mvps.data(), objectNum, false };
+    int callNum = objectNum * 2 + 4;
+
+    //------- overhead -------
+    GLStats& stats = GLStats::instance();
+    const int roundNum = 5;
+    double best[2] = { 1e30, 1e30 };
+    for (int round = 0; round < roundNum; round++)
+    {
+        for (int r = 0; r < 2; r++)
+        {
+            if (r)
+                stats.enable();
+            measure(workload, 5);
+            best[r] = min(best[r], measure(workload, max(frames / roundNum, 1)));
+            stats.disable();
+        }
+    }
+    printf("%d objects, %d GL calls per frame, best of %d rounds of the median frame\n", objectNum, callNum, roundNum);
+    printf("  %-16s %7.3f ms/frame  %6.1f ns/call\n", "stats disabled", best[0], best[0] * 1e6 / callNum);
+    printf("  %-16s %7.3f ms/frame  %6.1f ns/call  %+6.1f%%\n", "stats enabled", best[1], best[1] * 1e6 / callNum,
+        (best[1] / best[0] - 1.0) * 100.0);
+
+    //------- hooks alone -------
+    {
+        // an empty function behind glActiveTexture, so only the call path is timed
+        PFNGLACTIVETEXTUREPROC real = glad_glActiveTexture;
+        glad_glActiveTexture = emptyActiveTexture;
+        gladUninstallGLDebug();
+        const int emptyNum = 10000000;
+        double ns[3] = { 1e30, 1e30, 1e30 };
+        for (int round = 0; round < roundNum; round++)
+        {
+            ns[0] = min(ns[0], emptyCalls(emptyNum, true));
+            ns[1] = min(ns[1], emptyCalls(emptyNum, false));
+            stats.enable();
+            ns[2] = min(ns[2], emptyCalls(emptyNum, false));
+            stats.disable();
+        }
+        glad_glActiveTexture = real;
+        gladUninstallGLDebug();
+        printf("empty call: glad_ pointer %.2f ns, hooks uninstalled %.2f ns, counted %.2f ns\n", ns[0], ns[1], ns[2]);
+    }
+
+    //------- reporting -------
+    // a uniform location looked up per draw is flagged in the frame report
+    stats.reset();
+    stats.enable();
+    workload.lookUpLocation = true;
+    draw(workload);
+    glFinish();
+    stats.printFrame(4);
+    stats.disable();
+    const GLStats::Entry* lookup = stats.find("glGetUniformLocation");
+    const GLStats::Entry* draws = stats.find("glDrawElements");
+    bool flagged = lookup && lookup->synchronizing && lookup->lastFrameCalls == (uint64_t)objectNum &&
+        draws && draws->lastFrameCalls == (uint64_t)objectNum && stats.lastFrame().synchronizing == (uint64_t)objectNum &&
+        !stats.find("glFinish")->lastFrameCalls;
+    printf("%s: %d per-draw glGetUniformLocation calls flagged, glFinish outside the frame not\n",
+        flagged ? "PASS" : "FAIL", objectNum);
+
+    RenderTarget::unbind();
+    return flagged ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+#include <gltfLoader.h>
+#include <jsonSax.h>
+#include <benchUtils.h>
+#include <stb_image.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Write a GLB with meshNum grid meshes of gridSize x gridSize quads each.
+// Every mesh gets its own interleaved vertex bufferView (position, normal, uv)
+// and a 16-bit index bufferView, every 8th mesh uses 8-bit indices to exercise conversion.
+void writeSyntheticGlb(const char* filename, int meshNum, int gridSize)
+{
+    vector<unsigned char> bin;
+    string json = "{\"asset\":{\"version\":\"2.0\",\"generator\":\"LearnOpenGL benchmark\"},\"scene\":0,";
+    string views, accessors, meshes, nodes, sceneNodes;
+    int row = gridSize + 1;
+    int vertexNum = row * row;
+    for (int m = 0; m < meshNum; m++)
+    {
+        bool byteIndices = m % 8 == 7 && vertexNum <= 256;
+        size_t vertexOffset = bin.size();
+        for (int y = 0; y <= gridSize; y++)
+        {
+            for (int x = 0; x <= gridSize; x++)
+            {
+                float v[8] = { (float)x / gridSize, (float)y / gridSize, (float)m, 0, 0, 1,
+                    (float)x / gridSize, (float)y / gridSize };
+                bin.insert(bin.end(), (unsigned char*)v, (unsigned char*)(v + 8));
+            }
+        }
+        size_t indexOffset = bin.size();
+        int indexNum = gridSize * gridSize * 6;
+        for (int y = 0; y < gridSize; y++)
+        {
+            for (int x = 0; x < gridSize; x++)
+            {
+                unsigned short a = (unsigned short)(y * row + x), b = a + 1, c = a + row + 1, d = a + row;
+                unsigned short quad[6] = { a, b, c, a, c, d };
+                for (unsigned short i : quad)
+                {
+                    if (byteIndices)
+                        bin.push_back((unsigned char)i);
+                    else
+                        bin.insert(bin.end(), (unsigned char*)&i, (unsigned char*)&i + 2);
+                }
+            }
+        }
+        while (bin.size() % 4)
+            bin.push_back(0);
+
+        char buf[512];
+        int view = m * 2;
+        snprintf(buf, sizeof(buf),
+            "%s{\"buffer\":0,\"byteOffset\":%zu,\"byteLength\":%zu,\"byteStride\":32,\"target\":34962},"
+            "{\"buffer\":0,\"byteOffset\":%zu,\"byteLength\":%d,\"target\":34963}",
+            m ? "," : "", vertexOffset, indexOffset - vertexOffset, indexOffset, indexNum * (byteIndices ? 1 : 2));
+        views += buf;
+        int acc = m * 4;
+        snprintf(buf, sizeof(buf),
+            "%s{\"bufferView\":%d,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\",\"min\":[0,0,%d],\"max\":[1,1,%d]},"
+            "{\"bufferView\":%d,\"byteOffset\":12,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\"},"
+            "{\"bufferView\":%d,\"byteOffset\":24,\"componentType\":5126,\"count\":%d,\"type\":\"VEC2\"},"
+            "{\"bufferView\":%d,\"componentType\":%d,\"count\":%d,\"type\":\"SCALAR\"}",
+            m ? "," : "", view, vertexNum, m, m, view, vertexNum, view, vertexNum,
+            view + 1, byteIndices ? 5121 : 5123, indexNum);
+        accessors += buf;
+        snprintf(buf, sizeof(buf),
+            "%s{\"name\":\"grid%d\",\"primitives\":[{\"attributes\":{\"POSITION\":%d,\"NORMAL\":%d,\"TEXCOORD_0\":%d},\"indices\":%d}]}",
+            m ? "," : "", m, acc, acc + 1, acc + 2, acc + 3);
+        meshes += buf;
+        snprintf(buf, sizeof(buf), "%s{\"mesh\":%d,\"translation\":[%d,0,0]}", m ? "," : "", m, m);
+        nodes += buf;
+        snprintf(buf, sizeof(buf), "%s%d", m ? "," : "", m);
+        sceneNodes += buf;
+    }
+    json += "\"buffers\":[{\"byteLength\":" + to_string(bin.size()) + "}],";
+    json += "\"bufferViews\":[" + views + "],";
+    json += "\"accessors\":[" + accessors + "],";
+    json += "\"meshes\":[" + meshes + "],";
+    json += "\"nodes\":[" + nodes + "],";
+    json += "\"scenes\":[{\"nodes\":[" + sceneNodes + "]}]}";
+    while (json.size() % 4)
+        json += ' ';
+
+    uint32_t header[3] = { 0x46546C67, 2, (uint32_t)(12 + 8 + json.size() + 8 + bin.size()) };
+    uint32_t jsonChunk[2] = { (uint32_t)json.size(), 0x4E4F534A };
+    uint32_t binChunk[2] = { (uint32_t)bin.size(), 0x004E4942 };
+    ofstream f(filename, ios::binary);
+    f.write((const char*)header, 12);
+    f.write((const char*)jsonChunk, 8);
+    f.write(json.data(), json.size());
+    f.write((const char*)binChunk, 8);
+    f.write((const char*)bin.data(), bin.size());
+}
+
+// usage: gltfLoader [scene.glb|scene.gltf] [--meshes N] [--grid N] [--repeat N]
+int main(int argc, char** argv)
+{
+    string filename;
+    int meshNum = 20000;
+    int gridSize = 10;
+    int repeat = 5;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--meshes") && i + 1 < argc)
+            meshNum = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--grid") && i + 1 < argc)
+            gridSize = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else
+            filename = argv[i];
+    }
+    bool synthetic = filename.empty();
+    if (synthetic)
+    {
+        filename = "synthetic.glb";
+        cout << "Generating " << filename << " (" << meshNum << " meshes)...\n";
+        writeSyntheticGlb(filename.c_str(), meshNum, gridSize);
+    }
+
+    ifstream probe(filename, ios::binary | ios::ate);
+    size_t fileSize = (size_t)probe.tellg();
+    cout << "File: " << filename << ", " << toMB(fileSize) << " MB\n";
+
+    double best = 1e30;
+    GltfAsset asset;
+    for (int i = 0; i < repeat; i++)
+    {
+        Timer timer;
+        if (!loadGltf(filename.c_str(), asset))
+            return -1;
+        double t = timer.seconds();
+        if (t < best)
+            best = t;
+    }
+
+    // JSON throughput alone, without building the asset
+    const MappedFile& file = *asset.mappedFiles[0];
+    const char* json = file.data();
+    size_t jsonSize = file.size();
+    if (file.size() >= 20 && memcmp(file.data(), "glTF", 4) == 0)
+    {
+        uint32_t chunkLength;
+        memcpy(&chunkLength, file.data() + 12, 4);
+        json = file.data() + 20;
+        jsonSize = chunkLength;
+    }
+    JsonSaxHandler nullHandler;
+    double bestJson = 1e30;
+    for (int i = 0; i < repeat; i++)
+    {
+        Timer timer;
+        parseJson(json, jsonSize, nullHandler);
+        double t = timer.seconds();
+        if (t < bestJson)
+            bestJson = t;
+    }
+
+    size_t direct = 0, converted = 0;
+    for (const GltfMesh& mesh : asset.meshes)
+    {
+        for (const GltfPrimitive& p : mesh.primitives)
+        {
+            for (const auto& attribute : p.attributes)
+                (gltfAccessorIsGpuCompatible(asset, attribute.second, false) ? direct : converted)++;
+            if (p.indices >= 0)
+                (gltfAccessorIsGpuCompatible(asset, p.indices, true) ? direct : converted)++;
+        }
+    }
+
+    Timer imageTimer;
+    size_t pixels = 0;
+    for (size_t i = 0; i < asset.images.size(); i++)
+    {
+        int width, height;
+        unsigned char* data = decodeGltfImage(asset, (int)i, width, height, 4);
+        if (data)
+            pixels += (size_t)width * height;
+        stbi_image_free(data);
+    }
+    double imageSeconds = imageTimer.seconds();
+
+    printf("  load:        %8.2f ms  %8.1f MB/s (file)\n", best * 1000.0, toMB(fileSize) / best);
+    printf("  json (SAX):  %8.2f ms  %8.1f MB/s (%.1f MB JSON)\n", bestJson * 1000.0, toMB(jsonSize) / bestJson, toMB(jsonSize));
+    printf("  meshes: %zu, accessors: %zu, in-place: %zu, converted: %zu\n",
+        asset.meshes.size(), asset.accessors.size(), direct, converted);
+    printf("  images: %zu decoded in %.2f ms (%.1f Mpixel/s)\n",
+        asset.images.size(), imageSeconds * 1000.0, pixels / 1e6 / (imageSeconds > 0 ? imageSeconds : 1));
+    printf("  peak memory: %.1f MB\n", toMB(peakMemoryBytes()));
+
+    asset = GltfAsset();
+    if (synthetic)
+        remove(filename.c_str());
+    return 0;
+}
@@ -0,0 +1,197 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <renderTarget.h>
+#include <cubeSceneData.h>
+#include <benchUtils.h>
+#include <gpuMemory.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+struct Objects
+{
+    unsigned int vao, vbo, ebo, ubo;
+    unsigned int texture, cubeMap, multisample;
+};
+
+// one object of each kind, the sizes the accounting has to arrive at are in main
+Objects createObjects(int textureSize, int cubeMapSize, int multisampleSize, int samples)
+{
+    Objects o;
+    {
+        GpuMemoryTag tag("cube");
+        glGenVertexArrays(1, &o.vao);
+        glBindVertexArray(o.vao);
+        glGenBuffers(1, &o.vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, o.vbo);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(kCubeVertices), kCubeVertices, GL_STATIC_DRAW);
+        glGenBuffers(1, &o.ebo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, o.ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kCubeIndices), kCubeIndices, GL_STATIC_DRAW);
+        glBindVertexArray(0);
+    }
+
+    glGenBuffers(1, &o.ubo);
+    glBindBuffer(GL_UNIFORM_BUFFER, o.ubo);
+    glBufferData(GL_UNIFORM_BUFFER, 1024, NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    GpuMemoryTag tag("textures");
+    vector<unsigned char> pixels((size_t)textureSize * textureSize * 3, 128);
+    glGenTextures(1, &o.texture);
+    glBindTexture(GL_TEXTURE_2D, o.texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, textureSize, textureSize, 0, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenTextures(1, &o.cubeMap);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, o.cubeMap);
+    for (int face = 0; face < 6; face++)
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, GL_RGBA16F, cubeMapSize, cubeMapSize, 0, GL_RGBA, GL_FLOAT, NULL);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    if (glObjectLabel)
+        glObjectLabel(GL_TEXTURE, o.cubeMap, -1, "environment");
+    else
+        GpuMemory::instance().tag(GL_TEXTURE, o.cubeMap, "environment");
+
+    glGenTextures(1, &o.multisample);
+    glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, o.multisample);
+    glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, samples, GL_RGBA8, multisampleSize, multisampleSize, GL_TRUE);
+    glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
+    return o;
+}
+
+size_t mipChainBytes(int size, size_t texel)
+{
+    size_t bytes = 0;
+    for (; size >= 1; size /= 2)
+        bytes += (size_t)size * size * texel;
+    return bytes;
+}
+
+bool check(const char* what, size_t got, size_t expected)
+{
+    bool pass = got == expected;
+    printf("%s: %-28s %10zu bytes, expected %zu\n", pass ? "PASS" : "FAIL", what, got, expected);
+    return pass;
+}
+
+// CPU time of one glBufferData re-specifying a small buffer
+double bufferDataNs(unsigned int buffer, int num)
+{
+    vector<char> data(4096, 1);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    Timer timer;
+    for (int i = 0; i < num; i++)
+        glBufferData(GL_ARRAY_BUFFER, data.size(), data.data(), GL_STREAM_DRAW);
+    double ns = timer.milliseconds() * 1e6 / num;
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return ns;
+}
+
+// Checks the accounting against sizes known up front: a render target, a mipmapped texture,
+// a cube map, a multisample texture, vertex, index and uniform buffers, then the leak report
+// and the overhead of the wrapped glBufferData. Exit code 0 when every total matches.
+// usage: gpuMemory [--size WxH] [--json FILE]
+int main(int argc, char** argv)
+{
+    int width = 640, height = 480;
+    const char* jsonFile = NULL;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--size") && i + 1 < argc)
+            sscanf(argv[++i], "%dx%d", &width, &height);
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc)
+            jsonFile = argv[++i];
+    }
+
+    ContextDesc desc;
+    desc.visible = false;
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    unique_ptr<GLContext> context = GLContext::create(backend, desc);
+    if (!context)
+        return -1;
+    printf("%s\n", (const char*)glGetString(GL_RENDERER));
+
+    GpuMemory& memory = GpuMemory::instance();
+    memory.enable();
+    bool pass = true;
+    {
+        const int textureSize = 256, cubeMapSize = 64, multisampleSize = 128, samples = 4;
+        RenderTarget target;
+        {
+            GpuMemoryTag tag("render target");
+            if (!target.create(width, height))
+                return -1;
+        }
+        Objects o = createObjects(textureSize, cubeMapSize, multisampleSize, samples);
+        memory.endFrame();
+
+        size_t renderTargetBytes = (size_t)width * height * 4 * 2;     // RGBA8 color, depth 24 stencil 8
+        size_t textureBytes = mipChainBytes(textureSize, 4) + (size_t)cubeMapSize * cubeMapSize * 8 * 6 +
+            (size_t)multisampleSize * multisampleSize * 4 * samples;
+        size_t bufferBytes = sizeof(kCubeVertices) + sizeof(kCubeIndices) + 1024;
+        pass = check("render target", memory.totals(GpuMemoryCategory::RenderTarget).bytes, renderTargetBytes) && pass;
+        pass = check("texture (mip + cube + MSAA)", memory.totals(GpuMemoryCategory::Texture).bytes, textureBytes) && pass;
+        pass = check("vertex buffer", memory.totals(GpuMemoryCategory::VertexBuffer).bytes, sizeof(kCubeVertices)) && pass;
+        pass = check("index buffer", memory.totals(GpuMemoryCategory::IndexBuffer).bytes, sizeof(kCubeIndices)) && pass;
+        pass = check("uniform buffer", memory.totals(GpuMemoryCategory::UniformBuffer).bytes, 1024) && pass;
+        pass = check("total", memory.totals().bytes, renderTargetBytes + textureBytes + bufferBytes) && pass;
+        memory.print(8);
+        if (jsonFile && !memory.writeJson(jsonFile))
+            pass = false;
+
+        // re-specifying replaces, deleting releases; the peak stays
+        size_t peak = memory.totals().peakBytes;
+        glBindBuffer(GL_UNIFORM_BUFFER, o.ubo);
+        glBufferData(GL_UNIFORM_BUFFER, 256, NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        pass = check("uniform buffer re-specified", memory.totals(GpuMemoryCategory::UniformBuffer).bytes, 256) && pass;
+        glDeleteTextures(1, &o.texture);
+        glDeleteTextures(1, &o.cubeMap);
+        glDeleteTextures(1, &o.multisample);
+        glDeleteBuffers(1, &o.vbo);
+        glDeleteBuffers(1, &o.ebo);
+        glDeleteVertexArrays(1, &o.vao);
+        target.destroy();
+        pass = check("peak", memory.totals().peakBytes, peak) && pass;
+
+        // the uniform buffer is left for the leak report
+        memory.endFrame();
+        size_t leaks = memory.reportLeaks();
+        printf("%s: %zu leaked object reported, expected 1\n", leaks == 1 ? "PASS" : "FAIL", leaks);
+        pass = leaks == 1 && pass;
+        glDeleteBuffers(1, &o.ubo);
+        pass = check("after deleting everything", memory.totals().bytes, 0) && pass;
+    }
+
+    //------- overhead -------
+    {
+        unsigned int buffer;
+        glGenBuffers(1, &buffer);
+        const int num = 20000, roundNum = 5;
+        double ns[2] = { 1e30, 1e30 };
+        for (int round = 0; round < roundNum; round++)
+        {
+            for (int r = 0; r < 2; r++)
+            {
+                if (r)
+                    memory.enable();
+                else
+                    memory.disable();
+                ns[r] = min(ns[r], bufferDataNs(buffer, num));
+            }
+        }
+        glDeleteBuffers(1, &buffer);
+        memory.disable();
+        printf("glBufferData 4 KB: %.0f ns untracked, %.0f ns tracked (%+.0f ns); binds are followed, draws are not wrapped\n",
+            ns[0], ns[1], ns[1] - ns[0]);
+    }
+    return pass ? 0 : 1;
+}
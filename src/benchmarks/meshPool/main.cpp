@@ -0,0 +1,383 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <renderTarget.h>
+#include <benchUtils.h>
+#include <meshPool.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+struct Vertex
+{
+    float position[3];
+    float color[3];
+};
+
+struct MeshData
+{
+    vector<Vertex> vertices;
+    vector<uint32_t> indices;
+};
+
+const char* kVertexShader = R"(#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+uniform mat4 viewProjection;
+out vec3 color;
+void main()
+{
+    gl_Position = viewProjection * vec4(aPos, 1.0);
+    color = aColor;
+}
+)";
+
+const char* kFragmentShader = R"(#version 330 core
+in vec3 color;
+out vec4 FragColor;
+void main()
+{
+    FragColor = vec4(color, 1.0);
+}
+)";
+
+unsigned int createProgram()
+{
+    unsigned int shaders[2] = { glCreateShader(GL_VERTEX_SHADER), glCreateShader(GL_FRAGMENT_SHADER) };
+    const char* sources[2] = { kVertexShader, kFragmentShader };
+    unsigned int program = glCreateProgram();
+    for (int i = 0; i < 2; i++)
+    {
+        glShaderSource(shaders[i], 1, &sources[i], NULL);
+        glCompileShader(shaders[i]);
+        glAttachShader(program, shaders[i]);
+    }
+    glLinkProgram(program);
+    int linked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    for (unsigned int shader : shaders)
+        glDeleteShader(shader);
+    if (!linked)
+    {
+        printf("ERROR: Cannot link the mesh shader.\n");
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+// a prism of 'sides' sides with jittered vertices, baked at its cell of a grid: every mesh is unique
+MeshData createMesh(mt19937& rng, int cell, int gridSize, int sides)
+{
+    uniform_real_distribution<float> unit(0.0f, 1.0f);
+    glm::vec3 center((cell % gridSize) + 0.5f, 0.0f, (cell / gridSize) + 0.5f);
+    float radius = 0.25f + 0.2f * unit(rng);
+    float height = 0.2f + unit(rng);
+    glm::vec3 color(unit(rng), unit(rng), unit(rng));
+    MeshData mesh;
+    for (int ring = 0; ring < 2; ring++)
+    {
+        for (int s = 0; s < sides; s++)
+        {
+            float angle = 6.2831853f * (s + 0.3f * unit(rng)) / sides;
+            glm::vec3 p = center + glm::vec3(cosf(angle) * radius, ring * height, sinf(angle) * radius);
+            glm::vec3 c = color * (0.6f + 0.4f * ring);
+            mesh.vertices.push_back({ { p.x, p.y, p.z }, { c.r, c.g, c.b } });
+        }
+        glm::vec3 c = color * (0.5f + 0.5f * ring);
+        mesh.vertices.push_back({ { center.x, ring * height, center.z }, { c.r, c.g, c.b } });
+    }
+    uint32_t top = sides + 1;
+    for (int s = 0; s < sides; s++)
+    {
+        uint32_t a = s, b = (s + 1) % sides;
+        uint32_t side[6] = { a, b, top + b, a, top + b, top + a };
+        mesh.indices.insert(mesh.indices.end(), side, side + 6);
+        uint32_t caps[6] = { (uint32_t)sides, b, a, top + (uint32_t)sides, top + a, top + b };
+        mesh.indices.insert(mesh.indices.end(), caps, caps + 6);
+    }
+    return mesh;
+}
+
+//------- one VAO, VBO and EBO per mesh -------
+struct SeparateMesh
+{
+    unsigned int vao, vbo, ebo;
+    GLsizei indexCount;
+};
+
+SeparateMesh uploadSeparate(const MeshData& mesh)
+{
+    SeparateMesh m;
+    glGenVertexArrays(1, &m.vao);
+    glBindVertexArray(m.vao);
+    glGenBuffers(1, &m.vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, m.vbo);
+    glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(Vertex), mesh.vertices.data(), GL_STATIC_DRAW);
+    glGenBuffers(1, &m.ebo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m.ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(uint32_t), mesh.indices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+    m.indexCount = (GLsizei)mesh.indices.size();
+    return m;
+}
+
+struct FrameTime
+{
+    double submitMs;
+    double totalMs;     // until the GPU finished
+};
+
+template <typename Draw>
+FrameTime drawFrames(RenderTarget& target, unsigned int program, const glm::mat4& viewProjection, int frames, Draw draw)
+{
+    FrameTime best = { 1e30, 1e30 };
+    for (int f = 0; f < frames; f++)
+    {
+        target.bind();
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glEnable(GL_DEPTH_TEST);
+        glUseProgram(program);
+        glUniformMatrix4fv(glGetUniformLocation(program, "viewProjection"), 1, GL_FALSE, glm::value_ptr(viewProjection));
+        glFinish();
+        Timer timer;
+        draw();
+        double submit = timer.milliseconds();
+        glFinish();
+        best.submitMs = min(best.submitMs, submit);
+        best.totalMs = min(best.totalMs, timer.milliseconds());
+    }
+    glBindVertexArray(0);
+    glUseProgram(0);
+    return best;
+}
+
+uint64_t imageHash(const RenderTarget& target)
+{
+    vector<unsigned char> rgba;
+    target.readPixels(rgba);
+    uint64_t h = 14695981039346656037ull;
+    for (unsigned char c : rgba)
+        h = (h ^ c) * 1099511628211ull;
+    return h;
+}
+
+// random allocations and frees against a map of which units are taken
+bool stressAllocator(int operations)
+{
+    const uint32_t size = 1 << 20;
+    OffsetAllocator allocator(size);
+    vector<unsigned char> taken(size, 0);
+    vector<OffsetAllocator::Allocation> live;
+    mt19937 rng(7);
+    bool ok = true;
+    for (int i = 0; i < operations && ok; i++)
+    {
+        if (live.empty() || rng() % 100 < 55)
+        {
+            uint32_t n = 1 + (rng() % 8 ? rng() % 64 : rng() % 4096);
+            OffsetAllocator::Allocation a = allocator.allocate(n);
+            if (a.offset == OffsetAllocator::kNoSpace)
+                continue;
+            for (uint32_t u = a.offset; u < a.offset + n && ok; u++)
+                ok = !taken[u]++;
+            live.push_back(a);
+        }
+        else
+        {
+            size_t k = rng() % live.size();
+            OffsetAllocator::Allocation a = live[k];
+            memset(taken.data() + a.offset, 0, allocator.allocationSize(a));
+            allocator.free(a);
+            live[k] = live.back();
+            live.pop_back();
+        }
+    }
+    OffsetAllocator::Stats before = allocator.stats();
+    for (OffsetAllocator::Allocation a : live)
+        allocator.free(a);
+    OffsetAllocator::Stats after = allocator.stats();
+    ok = ok && after.free == size && after.freeBlocks == 1 && after.largestFree == size && after.allocations == 0;
+    printf("%s: %d random operations without overlap, %u allocations at %.1f%% fragmentation, merged back into one block\n",
+        ok ? "PASS" : "FAIL", operations, before.allocations, before.fragmentation() * 100.0);
+    return ok;
+}
+
+// 50k unique meshes drawn from one VAO, VBO and EBO each against one MeshPool with
+// glDrawElementsBaseVertex per mesh and with one glMultiDrawElementsBaseVertex, then half of
+// them replaced by larger ones and a quarter removed to fragment the pool, and compacted.
+// Images must match.
+// usage: meshPool [--meshes N] [--size WxH] [--frames N]
+int main(int argc, char** argv)
+{
+    int meshNum = 50000;
+    int width = 512, height = 512;
+    int frames = 3;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--meshes") && i + 1 < argc)
+            meshNum = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--size") && i + 1 < argc)
+            sscanf(argv[++i], "%dx%d", &width, &height);
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+    }
+    bool pass = stressAllocator(200000);
+
+    ContextDesc desc;
+    desc.visible = false;
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    unique_ptr<GLContext> context = GLContext::create(backend, desc);
+    if (!context)
+        return -1;
+    printf("%s\n", (const char*)glGetString(GL_RENDERER));
+    RenderTarget target;
+    unsigned int program = createProgram();
+    if (!target.create(width, height) || !program)
+        return -1;
+
+    int gridSize = (int)ceil(sqrt((double)meshNum));
+    mt19937 rng(1234);
+    vector<MeshData> meshes(meshNum);
+    size_t vertexNum = 0, indexNum = 0;
+    for (int i = 0; i < meshNum; i++)
+    {
+        meshes[i] = createMesh(rng, i, gridSize, 3 + rng() % 14);
+        vertexNum += meshes[i].vertices.size();
+        indexNum += meshes[i].indices.size();
+    }
+    glm::mat4 viewProjection = glm::ortho(0.0f, (float)gridSize, 0.0f, (float)gridSize, -10.0f, 10.0f) *
+        glm::lookAt(glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+    printf("%d meshes, %zu vertices, %zu indices, %dx%d\n", meshNum, vertexNum, indexNum, width, height);
+
+    //------- separate buffers -------
+    vector<SeparateMesh> separate(meshNum);
+    Timer timer;
+    for (int i = 0; i < meshNum; i++)
+        separate[i] = uploadSeparate(meshes[i]);
+    glFinish();
+    double separateUploadMs = timer.milliseconds();
+    FrameTime separateTime = drawFrames(target, program, viewProjection, frames, [&]() {
+        for (const SeparateMesh& m : separate)
+        {
+            glBindVertexArray(m.vao);
+            glDrawElements(GL_TRIANGLES, m.indexCount, GL_UNSIGNED_INT, NULL);
+        }
+    });
+    uint64_t separateHash = imageHash(target);
+    for (SeparateMesh& m : separate)
+    {
+        glDeleteVertexArrays(1, &m.vao);
+        glDeleteBuffers(1, &m.vbo);
+        glDeleteBuffers(1, &m.ebo);
+    }
+
+    //------- pool -------
+    MeshAttribute attributes[2] = {
+        { 0, 3, GL_FLOAT, false, 0 },
+        { 1, 3, GL_FLOAT, false, (unsigned int)offsetof(Vertex, color) },
+    };
+    MeshPool pool;
+    // starts small on purpose: the pool grows while it is filled
+    if (!pool.create(attributes, 2, sizeof(Vertex), 1 << 16, 1 << 18))
+        return -1;
+    vector<MeshPool::MeshId> ids(meshNum);
+    timer.reset();
+    for (int i = 0; i < meshNum; i++)
+        ids[i] = pool.add(meshes[i].vertices.data(), (uint32_t)meshes[i].vertices.size(), meshes[i].indices.data(),
+            (uint32_t)meshes[i].indices.size());
+    glFinish();
+    double poolUploadMs = timer.milliseconds();
+    FrameTime poolTime = drawFrames(target, program, viewProjection, frames, [&]() {
+        pool.bind();
+        for (MeshPool::MeshId id : ids)
+            pool.draw(id);
+    });
+    uint64_t poolHash = imageHash(target);
+    FrameTime multiTime = drawFrames(target, program, viewProjection, frames, [&]() {
+        pool.bind();
+        pool.drawMany(ids.data(), (int)ids.size());
+    });
+    uint64_t multiHash = imageHash(target);
+
+    printf("  %-34s %10s %12s %12s\n", "", "upload ms", "submit ms", "frame ms");
+    printf("  %-34s %10.1f %12.2f %12.2f\n", "VAO/VBO/EBO per mesh", separateUploadMs, separateTime.submitMs, separateTime.totalMs);
+    printf("  %-34s %10.1f %12.2f %12.2f\n", "pool, glDrawElementsBaseVertex", poolUploadMs, poolTime.submitMs, poolTime.totalMs);
+    printf("  %-34s %10s %12.2f %12.2f\n", "pool, glMultiDrawElementsBaseVertex", "", multiTime.submitMs, multiTime.totalMs);
+    pool.print();
+    bool same = separateHash == poolHash && poolHash == multiHash && pool.meshNum() == (uint32_t)meshNum;
+    printf("%s: the pool draws the same image as separate buffers\n", same ? "PASS" : "FAIL");
+    pass = same && pass;
+
+    //------- churn -------
+    // half the meshes replaced by larger ones: the holes they leave are too small for the new ones
+    vector<int> order(meshNum);
+    for (int i = 0; i < meshNum; i++)
+        order[i] = i;
+    shuffle(order.begin(), order.end(), rng);
+    int replaced = meshNum / 2;
+    for (int k = 0; k < replaced; k++)
+        pool.remove(ids[order[k]]);
+    printf("after removing %d meshes:\n", replaced);
+    pool.print();
+    for (int k = 0; k < replaced; k++)
+    {
+        int i = order[k];
+        meshes[i] = createMesh(rng, i, gridSize, 10 + rng() % 20);
+        ids[i] = pool.add(meshes[i].vertices.data(), (uint32_t)meshes[i].vertices.size(), meshes[i].indices.data(),
+            (uint32_t)meshes[i].indices.size());
+    }
+    printf("after adding %d larger meshes:\n", replaced);
+    pool.print();
+    // growing compacted the pool, removing a quarter again leaves holes for defragment()
+    shuffle(order.begin(), order.end(), rng);
+    vector<MeshPool::MeshId> kept;
+    for (int k = 0; k < meshNum; k++)
+    {
+        if (k < meshNum / 4)
+            pool.remove(ids[order[k]]);
+        else
+            kept.push_back(ids[order[k]]);
+    }
+    ids = kept;
+    printf("after removing %d meshes:\n", meshNum / 4);
+    pool.print();
+    drawFrames(target, program, viewProjection, 1, [&]() {
+        pool.bind();
+        pool.drawMany(ids.data(), (int)ids.size());
+    });
+    uint64_t fragmentedHash = imageHash(target);
+
+    timer.reset();
+    pool.defragment();
+    glFinish();
+    double defragmentMs = timer.milliseconds();
+    printf("after defragmenting in %.1f ms:\n", defragmentMs);
+    pool.print();
+    drawFrames(target, program, viewProjection, 1, [&]() {
+        pool.bind();
+        pool.drawMany(ids.data(), (int)ids.size());
+    });
+    MeshPool::Stats s = pool.stats();
+    bool compacted = imageHash(target) == fragmentedHash && s.vertices.freeBlocks <= 1 && s.indices.freeBlocks <= 1;
+    printf("%s: defragmenting leaves one free block and the same image\n", compacted ? "PASS" : "FAIL");
+    pass = compacted && pass;
+
+    pool.destroy();
+    glDeleteProgram(program);
+    return pass ? 0 : 1;
+}
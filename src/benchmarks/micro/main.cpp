@@ -0,0 +1,397 @@
+#include <microBench.h>
+#include <mappedFile.h>
+#include <stb_image.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Microbenchmarks of the hot paths the chapters rely on: glm math, stb_image decode and
+// shader source loading. No GL context needed.
+// The same source is built twice, the _intrinsics target with GLM_FORCE_INTRINSICS:
+//     micro --json scalar.json
+//     micro_intrinsics --baseline scalar.json
+
+const size_t kBatch = 1024;
+
+//------- image encoders for test inputs -------
+
+void put16(vector<unsigned char>& out, unsigned v) { out.push_back(v & 0xff); out.push_back((v >> 8) & 0xff); }
+void put32(vector<unsigned char>& out, unsigned v) { put16(out, v & 0xffff); put16(out, v >> 16); }
+void put32BE(vector<unsigned char>& out, unsigned v)
+{
+    for (int s = 24; s >= 0; s -= 8)
+        out.push_back((v >> s) & 0xff);
+}
+
+// smooth gradients plus noise, compresses like a typical texture
+vector<unsigned char> makePixels(int w, int h)
+{
+    mt19937 rng(7);
+    vector<unsigned char> rgb((size_t)w * h * 3);
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+        {
+            unsigned char* p = &rgb[((size_t)y * w + x) * 3];
+            unsigned noise = rng() & 15;
+            p[0] = (unsigned char)(x * 255 / w + noise);
+            p[1] = (unsigned char)(y * 255 / h + noise);
+            p[2] = (unsigned char)((x ^ y) & 255);
+        }
+    return rgb;
+}
+
+vector<unsigned char> encodeBmp(const vector<unsigned char>& rgb, int w, int h)
+{
+    int stride = (w * 3 + 3) & ~3;
+    vector<unsigned char> out;
+    out.push_back('B');
+    out.push_back('M');
+    put32(out, 54 + stride * h);
+    put32(out, 0);
+    put32(out, 54);
+    put32(out, 40);
+    put32(out, w);
+    put32(out, h);
+    put16(out, 1);
+    put16(out, 24);
+    put32(out, 0);
+    put32(out, stride * h);
+    put32(out, 2835);
+    put32(out, 2835);
+    put32(out, 0);
+    put32(out, 0);
+    for (int y = h - 1; y >= 0; y--)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            const unsigned char* p = &rgb[((size_t)y * w + x) * 3];
+            out.push_back(p[2]);
+            out.push_back(p[1]);
+            out.push_back(p[0]);
+        }
+        for (int pad = w * 3; pad < stride; pad++)
+            out.push_back(0);
+    }
+    return out;
+}
+
+vector<unsigned char> encodeTga(const vector<unsigned char>& rgb, int w, int h)
+{
+    vector<unsigned char> out(18, 0);
+    out[2] = 2;     // uncompressed true color
+    out[12] = w & 0xff;
+    out[13] = w >> 8;
+    out[14] = h & 0xff;
+    out[15] = h >> 8;
+    out[16] = 24;
+    out[17] = 0x20; // top-left origin
+    for (size_t i = 0; i < rgb.size(); i += 3)
+    {
+        out.push_back(rgb[i + 2]);
+        out.push_back(rgb[i + 1]);
+        out.push_back(rgb[i]);
+    }
+    return out;
+}
+
+unsigned crc32(const unsigned char* data, size_t n, unsigned crc = 0)
+{
+    static unsigned table[256];
+    if (!table[1])
+        for (unsigned i = 0; i < 256; i++)
+        {
+            unsigned c = i;
+            for (int k = 0; k < 8; k++)
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+    crc = ~crc;
+    for (size_t i = 0; i < n; i++)
+        crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+void pngChunk(vector<unsigned char>& out, const char* type, const vector<unsigned char>& data)
+{
+    put32BE(out, (unsigned)data.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    put32BE(out, crc32(&out[start], out.size() - start));
+}
+
+// PNG with stored (uncompressed) deflate blocks and the Sub filter on every row
+vector<unsigned char> encodePng(const vector<unsigned char>& rgb, int w, int h)
+{
+    vector<unsigned char> raw;
+    raw.reserve((size_t)(w * 3 + 1) * h);
+    for (int y = 0; y < h; y++)
+    {
+        const unsigned char* row = &rgb[(size_t)y * w * 3];
+        raw.push_back(1);
+        for (int x = 0; x < w * 3; x++)
+            raw.push_back((unsigned char)(row[x] - (x >= 3 ? row[x - 3] : 0)));
+    }
+    vector<unsigned char> z = { 0x78, 0x01 };
+    for (size_t pos = 0; pos < raw.size();)
+    {
+        size_t len = min<size_t>(raw.size() - pos, 65535);
+        z.push_back(pos + len == raw.size() ? 1 : 0);
+        put16(z, (unsigned)len);
+        put16(z, (unsigned)~len & 0xffff);
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + len);
+        pos += len;
+    }
+    unsigned a = 1, b = 0;
+    for (unsigned char c : raw)
+    {
+        a = (a + c) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32BE(z, (b << 16) | a);
+
+    vector<unsigned char> out = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    vector<unsigned char> ihdr;
+    put32BE(ihdr, w);
+    put32BE(ihdr, h);
+    ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 });
+    pngChunk(out, "IHDR", ihdr);
+    pngChunk(out, "IDAT", z);
+    pngChunk(out, "IEND", vector<unsigned char>());
+    return out;
+}
+
+//------- shader source loading -------
+
+// what the chapters' openGLSLProgram does
+string loadStringStream(const char* filename)
+{
+    ifstream f(filename);
+    stringstream buf;
+    buf << f.rdbuf();
+    return buf.str();
+}
+
+string loadIfstreamRead(const char* filename)
+{
+    ifstream f(filename, ios::binary | ios::ate);
+    string s((size_t)f.tellg(), '\0');
+    f.seekg(0);
+    f.read(&s[0], s.size());
+    return s;
+}
+
+string loadFread(const char* filename)
+{
+    FILE* f = fopen(filename, "rb");
+    fseek(f, 0, SEEK_END);
+    string s((size_t)ftell(f), '\0');
+    fseek(f, 0, SEEK_SET);
+    size_t n = fread(&s[0], 1, s.size(), f);
+    fclose(f);
+    s.resize(n);
+    return s;
+}
+
+string loadMapped(const char* filename)
+{
+    MappedFile file(filename);
+    return string(file.data(), file.size());
+}
+
+//------- stb_image from memory -------
+// Decoding goes through the callback API: stbi_load_from_memory trips an assert in the
+// bundled stb_image's BMP path (its buffer_start is only set up for callback contexts).
+struct MemoryReader
+{
+    const unsigned char* data;
+    size_t size, pos;
+
+    static int read(void* user, char* out, int n)
+    {
+        MemoryReader* r = (MemoryReader*)user;
+        size_t count = min((size_t)n, r->size - r->pos);
+        memcpy(out, r->data + r->pos, count);
+        r->pos += count;
+        return (int)count;
+    }
+    static void skip(void* user, int n)
+    {
+        MemoryReader* r = (MemoryReader*)user;
+        r->pos = n < 0 ? r->pos - min((size_t)-n, r->pos) : min(r->pos + n, r->size);
+    }
+    static int eof(void* user)
+    {
+        MemoryReader* r = (MemoryReader*)user;
+        return r->pos >= r->size;
+    }
+};
+
+unsigned char* decodeImage(const vector<unsigned char>& bytes, int& w, int& h, int& channels)
+{
+    static const stbi_io_callbacks callbacks = { MemoryReader::read, MemoryReader::skip, MemoryReader::eof };
+    MemoryReader reader = { bytes.data(), bytes.size(), 0 };
+    return stbi_load_from_callbacks(&callbacks, &reader, &w, &h, &channels, 3);
+}
+
+bool fileExists(const char* filename)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f)
+        fclose(f);
+    return f != NULL;
+}
+
+// usage: micro [--filter s] [--samples N] [--min-time ms] [--json file] [--baseline file] [--image file]...
+int main(int argc, char** argv)
+{
+    MicroBench bench(argc, argv);
+#ifdef GLM_FORCE_INTRINSICS
+    bench.setTag("glm", "intrinsics");
+#else
+    bench.setTag("glm", "scalar");
+#endif
+
+    //------- glm -------
+    mt19937 rng(42);
+    uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    vector<glm::mat4> matA(kBatch), matB(kBatch), matOut(kBatch);
+    vector<glm::vec4> vecA(kBatch), vecOut(kBatch);
+    vector<glm::vec3> v3A(kBatch), v3B(kBatch), v3Out(kBatch);
+    vector<glm::quat> quats(kBatch);
+    for (size_t i = 0; i < kBatch; i++)
+    {
+        for (int c = 0; c < 4; c++)
+            for (int r = 0; r < 4; r++)
+            {
+                matA[i][c][r] = uniform(rng) + (c == r ? 4.0f : 0.0f);
+                matB[i][c][r] = uniform(rng);
+            }
+        vecA[i] = glm::vec4(uniform(rng), uniform(rng), uniform(rng), 1.0f);
+        v3A[i] = glm::vec3(uniform(rng), uniform(rng), uniform(rng));
+        v3B[i] = glm::vec3(uniform(rng), uniform(rng), uniform(rng)) * 2.0f + 3.0f;
+        quats[i] = glm::normalize(glm::quat(uniform(rng), uniform(rng), uniform(rng), uniform(rng)));
+    }
+    auto batch = [&](auto op) {
+        return [&, op](size_t n) {
+            for (size_t done = 0; done < n; done += kBatch)
+            {
+                size_t count = min(kBatch, n - done);
+                for (size_t i = 0; i < count; i++)
+                    op(i);
+                doNotOptimize(matOut[0]);
+                doNotOptimize(vecOut[0]);
+                doNotOptimize(v3Out[0]);
+            }
+        };
+    };
+    bench.run("glm/mat4 * mat4", batch([&](size_t i) { matOut[i] = matA[i] * matB[i]; }));
+    bench.run("glm/mat4 * vec4", batch([&](size_t i) { vecOut[i] = matA[i] * vecA[i]; }));
+    bench.run("glm/inverse(mat4)", batch([&](size_t i) { matOut[i] = glm::inverse(matA[i]); }));
+    bench.run("glm/transpose(mat4)", batch([&](size_t i) { matOut[i] = glm::transpose(matA[i]); }));
+    bench.run("glm/translate*rotate*scale", batch([&](size_t i) {
+        glm::mat4 m = glm::translate(glm::mat4(1.0f), v3A[i]);
+        m = glm::rotate(m, v3A[i].x, glm::vec3(1.0f, 0.3f, 0.5f));
+        matOut[i] = glm::scale(m, v3B[i]);
+    }));
+    bench.run("glm/mat4_cast(quat)", batch([&](size_t i) { matOut[i] = glm::mat4_cast(quats[i]); }));
+    bench.run("glm/lookAt", batch([&](size_t i) { matOut[i] = glm::lookAt(v3B[i], v3A[i], glm::vec3(0.0f, 1.0f, 0.0f)); }));
+    bench.run("glm/perspective", batch([&](size_t i) { matOut[i] = glm::perspective(0.8f, 1.0f + v3B[i].x, 0.1f, 100.0f); }));
+    bench.run("glm/normalize(vec3)", batch([&](size_t i) { v3Out[i] = glm::normalize(v3B[i]); }));
+    bench.run("glm/cross(vec3)", batch([&](size_t i) { v3Out[i] = glm::cross(v3A[i], v3B[i]); }));
+    bench.run("glm/dot(vec4)", batch([&](size_t i) { vecOut[i].x = glm::dot(vecA[i], vecOut[i]); }));
+
+    //------- image decode -------
+    struct Encoded
+    {
+        string name;
+        vector<unsigned char> bytes;
+    };
+    vector<Encoded> images;
+    const int sizes[] = { 256, 1024, 2048 };
+    for (int size : sizes)
+    {
+        if (!bench.enabled("stbi/"))
+            break;
+        vector<unsigned char> rgb = makePixels(size, size);
+        string suffix = " " + to_string(size) + "x" + to_string(size);
+        images.push_back({ "stbi/bmp" + suffix, encodeBmp(rgb, size, size) });
+        images.push_back({ "stbi/tga" + suffix, encodeTga(rgb, size, size) });
+        images.push_back({ "stbi/png stored" + suffix, encodePng(rgb, size, size) });
+    }
+    // compressed formats come from real files: the chapter textures if present, plus --image
+    vector<string> imageFiles = { "../data/container.jpg", "../data/awesomeface.png" };
+    for (int i = 1; i + 1 < argc; i++)
+        if (!strcmp(argv[i], "--image"))
+            imageFiles.push_back(argv[++i]);
+    for (const string& path : imageFiles)
+    {
+        MappedFile file;
+        if (!fileExists(path.c_str()) || !file.open(path.c_str()))
+            continue;
+        images.push_back({ "stbi/" + path.substr(path.find_last_of("/\\") + 1), vector<unsigned char>(file.data(), file.data() + file.size()) });
+    }
+    for (const Encoded& image : images)
+    {
+        int w = 0, h = 0, c = 0;
+        unsigned char* check = decodeImage(image.bytes, w, h, c);
+        if (!check)
+        {
+            printf("ERROR: stb_image cannot read %s: %s\n", image.name.c_str(), stbi_failure_reason());
+            continue;
+        }
+        stbi_image_free(check);
+        bench.run(image.name, [&](size_t n) {
+            for (size_t i = 0; i < n; i++)
+            {
+                int x, y, channels;
+                unsigned char* pixels = decodeImage(image.bytes, x, y, channels);
+                doNotOptimize(pixels);
+                stbi_image_free(pixels);
+            }
+        }, (double)w * h * 3);
+    }
+
+    //------- file loading -------
+    const size_t fileSizes[] = { 4 << 10, 256 << 10, 4 << 20 };
+    for (size_t fileSize : fileSizes)
+    {
+        if (!bench.enabled("file/"))
+            break;
+        string path = "micro_source_" + to_string(fileSize) + ".glsl";
+        {
+            string line = "    gl_Position = projection * view * model * vec4(aPos, 1.0); // padding\n";
+            string source = "#version 330 core\n";
+            while (source.size() < fileSize)
+                source += line;
+            source.resize(fileSize);
+            FILE* f = fopen(path.c_str(), "wb");
+            if (!f)
+            {
+                printf("ERROR: Cannot write \"%s\".\n", path.c_str());
+                return 1;
+            }
+            fwrite(source.data(), 1, source.size(), f);
+            fclose(f);
+        }
+        string suffix = " " + to_string(fileSize >> 10) + "KB";
+        const char* p = path.c_str();
+        bench.run("file/stringstream" + suffix, [&](size_t n) { for (size_t i = 0; i < n; i++) doNotOptimize(loadStringStream(p)); }, (double)fileSize);
+        bench.run("file/ifstream read" + suffix, [&](size_t n) { for (size_t i = 0; i < n; i++) doNotOptimize(loadIfstreamRead(p)); }, (double)fileSize);
+        bench.run("file/fread" + suffix, [&](size_t n) { for (size_t i = 0; i < n; i++) doNotOptimize(loadFread(p)); }, (double)fileSize);
+        bench.run("file/mmap" + suffix, [&](size_t n) { for (size_t i = 0; i < n; i++) doNotOptimize(loadMapped(p)); }, (double)fileSize);
+        remove(p);
+    }
+
+    return bench.finish();
+}
@@ -0,0 +1,129 @@
+#include <objLoader.h>
+#include <threadPool.h>
+#include <benchUtils.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+// Write a tessellated grid with positions, normals and texture coordinates.
+// gridSize x gridSize quads, i.e. 2 * gridSize^2 triangles.
+void writeSyntheticObj(const char* filename, int gridSize)
+{
+    ofstream f(filename, ios::binary);
+    f << "mtllib synthetic.mtl\n";
+    char line[256];
+    for (int y = 0; y <= gridSize; y++)
+    {
+        for (int x = 0; x <= gridSize; x++)
+        {
+            float u = (float)x / gridSize, v = (float)y / gridSize;
+            snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn 0.000000 0.000000 1.000000\n",
+                u * 2.0f - 1.0f, v * 2.0f - 1.0f, 0.25f * u * v, u, v);
+            f << line;
+        }
+    }
+    int row = gridSize + 1;
+    for (int y = 0; y < gridSize; y++)
+    {
+        if (y == gridSize / 2)
+            f << "usemtl second\n";
+        else if (y == 0)
+            f << "usemtl first\n";
+        for (int x = 0; x < gridSize; x++)
+        {
+            int a = y * row + x + 1, b = a + 1, c = a + row + 1, d = a + row;
+            snprintf(line, sizeof(line), "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n",
+                a, a, a, b, b, b, c, c, c, d, d, d);
+            f << line;
+        }
+    }
+}
+
+struct RunResult
+{
+    double seconds;
+    size_t peak;
+    bool ok;
+};
+
+RunResult run(const char* filename, bool multithread, size_t fileSize, int repeat)
+{
+    ObjLoadOptions options;
+    options.multithread = multithread;
+    RunResult best = { 1e30, 0, true };
+    for (int i = 0; i < repeat; i++)
+    {
+        ObjMesh mesh;
+        Timer timer;
+        bool ok = loadObj(filename, mesh, options);
+        double t = timer.seconds();
+        best.ok &= ok;
+        if (t < best.seconds)
+            best.seconds = t;
+        if (i == 0)
+        {
+            cout << "  vertices: " << mesh.vertexCount() << ", triangles: " << mesh.indices.size() / 3
+                 << ", submeshes: " << mesh.submeshes.size() << "\n";
+        }
+    }
+    best.peak = peakMemoryBytes();
+    printf("  %-15s %8.1f ms  %8.1f MB/s  peak %.1f MB\n",
+        multithread ? "multithreaded" : "single-thread",
+        best.seconds * 1000.0, toMB(fileSize) / best.seconds, toMB(best.peak));
+    return best;
+}
+
+// usage: objLoader [file.obj] [--grid N] [--mode single|multi|both] [--repeat N]
+// Peak memory is a process-wide high-water mark, run with a single mode to compare it fairly.
+int main(int argc, char** argv)
+{
+    string filename;
+    string mode = "both";
+    int gridSize = 1000;
+    int repeat = 3;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--grid") && i + 1 < argc)
+            gridSize = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--mode") && i + 1 < argc)
+            mode = argv[++i];
+        else if (!strcmp(argv[i], "--repeat") && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else
+            filename = argv[i];
+    }
+    bool synthetic = filename.empty();
+    if (synthetic)
+    {
+        filename = "synthetic.obj";
+        cout << "Generating " << filename << " (" << 2ll * gridSize * gridSize << " triangles)...\n";
+        writeSyntheticObj(filename.c_str(), gridSize);
+        ofstream mtl("synthetic.mtl");
+        mtl << "newmtl first\nKd 1 0 0\nnewmtl second\nKd 0 1 0\n";
+    }
+
+    ifstream probe(filename, ios::binary | ios::ate);
+    size_t fileSize = (size_t)probe.tellg();
+    cout << "File: " << filename << ", " << toMB(fileSize) << " MB, worker threads: "
+         << ThreadPool::global().size() + 1 << "\n";
+
+    RunResult single = { 0, 0, true }, multi = { 0, 0, true };
+    if (mode == "single" || mode == "both")
+        single = run(filename.c_str(), false, fileSize, repeat);
+    if (mode == "multi" || mode == "both")
+        multi = run(filename.c_str(), true, fileSize, repeat);
+    if (mode == "both")
+        printf("  speedup: %.2fx\n", single.seconds / multi.seconds);
+
+    if (synthetic)
+    {
+        remove("synthetic.obj");
+        remove("synthetic.mtl");
+    }
+    return single.ok && multi.ok ? 0 : -1;
+}
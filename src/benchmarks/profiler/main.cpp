@@ -0,0 +1,144 @@
+#include <cpuProfiler.h>
+#include <benchUtils.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+volatile uint64_t sink;
+
+// the same loop body with and without a marker, so the difference is the marker cost
+double emptyLoop(int n)
+{
+    Timer timer;
+    for (int i = 0; i < n; i++)
+        sink = sink + i;
+    return timer.seconds() * 1e9 / n;
+}
+
+double markerLoop(int n)
+{
+    Timer timer;
+    for (int i = 0; i < n; i++)
+    {
+        PROFILE_SCOPE("marker");
+        sink = sink + i;
+    }
+    return timer.seconds() * 1e9 / n;
+}
+
+double nestedLoop(int n)
+{
+    Timer timer;
+    for (int i = 0; i < n; i += 4)
+    {
+        PROFILE_SCOPE("outer");
+        {
+            PROFILE_SCOPE("a");
+            sink = sink + i;
+        }
+        {
+            PROFILE_SCOPE("b");
+            {
+                PROFILE_SCOPE("c");
+                sink = sink + i;
+            }
+        }
+    }
+    return timer.seconds() * 1e9 / n;
+}
+
+// usage: profiler [--markers N] [--threads N] [--trace file]
+int main(int argc, char** argv)
+{
+    int n = 10000000;
+    int threadNum = 4;
+    const char* tracePath = "profiler_trace.json";
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (!strcmp(argv[i], "--markers"))
+            n = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--threads"))
+            threadNum = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--trace"))
+            tracePath = argv[++i];
+    }
+    CpuProfiler& profiler = CpuProfiler::instance();
+    profiler.setThreadName("main");
+    printf("%d markers\n", n);
+
+    //------- clocks -------
+    {
+        Timer timer;
+        for (int i = 0; i < n; i++)
+            sink = sink + CpuProfiler::now();
+        printf("  profiler clock:        %6.2f ns/read (%.0f ticks/us)\n", timer.seconds() * 1e9 / n, profiler.ticksPerMicrosecond());
+        timer.reset();
+        for (int i = 0; i < n; i++)
+            sink = sink + chrono::steady_clock::now().time_since_epoch().count();
+        printf("  steady_clock:          %6.2f ns/read\n", timer.seconds() * 1e9 / n);
+    }
+
+    //------- single thread -------
+    double base = emptyLoop(n);
+    profiler.setEnabled(false);
+    double disabled = markerLoop(n) - base;
+    profiler.setEnabled(true);
+    double enabled = markerLoop(n) - base;
+    double nested = nestedLoop(n) - base;
+    printf("  marker disabled:       %6.2f ns\n", disabled);
+    printf("  marker enabled:        %6.2f ns\n", enabled);
+    printf("  nested markers:        %6.2f ns/marker\n", nested);
+
+    //------- threads -------
+    // every thread writes its own ring, the cost should not grow with the thread count
+    {
+        vector<double> cost(threadNum);
+        vector<thread> threads;
+        for (int t = 0; t < threadNum; t++)
+        {
+            threads.emplace_back([&, t] {
+                char name[32];
+                snprintf(name, sizeof(name), "worker %d", t);
+                CpuProfiler::instance().setThreadName(name);
+                cost[t] = markerLoop(n / threadNum);
+            });
+        }
+        for (thread& t : threads)
+            t.join();
+        double sum = 0.0;
+        for (double c : cost)
+            sum += c;
+        printf("  marker, %d threads:     %6.2f ns (loop included)\n", threadNum, sum / threadNum);
+    }
+
+    //------- export -------
+    // a few frames with realistic structure, then the trace of the last ones
+    for (int f = 0; f < 8; f++)
+    {
+        profiler.beginFrame();
+        PROFILE_SCOPE("frame");
+        {
+            PROFILE_SCOPE("input");
+            this_thread::sleep_for(chrono::microseconds(200));
+        }
+        {
+            PROFILE_SCOPE("simulate");
+            this_thread::sleep_for(chrono::microseconds(500));
+        }
+        {
+            PROFILE_SCOPE("submit");
+            this_thread::sleep_for(chrono::microseconds(300));
+        }
+    }
+    Timer timer;
+    uint32_t last = profiler.frame();
+    if (!profiler.writeChromeTrace(tracePath, last - 3, last))
+        return -1;
+    printf("  chrome trace of frames %u-%u: %.2f ms -> %s\n", last - 3, last, timer.milliseconds(), tracePath);
+    return 0;
+}
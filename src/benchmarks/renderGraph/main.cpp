@@ -0,0 +1,413 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <cubeScene.h>
+#include <gpuProfiler.h>
+#include <renderGraph.h>
+#include <benchUtils.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+const char* kFullscreenVertex = R"(#version 330 core
+out vec2 uv;
+void main()
+{
+    uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+const char* kGridFragment = R"(#version 330 core
+in vec2 uv;
+out vec4 FragColor;
+void main()
+{
+    vec2 cell = abs(fract(uv * 16.0) - 0.5);
+    FragColor = vec4(1.0, 0.9, 0.6, step(0.47, max(cell.x, cell.y)) * 0.3);
+}
+)";
+
+const char* kEdgeFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+out vec4 FragColor;
+void main()
+{
+    vec2 texel = 1.0 / vec2(textureSize(source, 0));
+    float d = texture(source, uv).r;
+    float dx = texture(source, uv + vec2(texel.x, 0.0)).r - d;
+    float dy = texture(source, uv + vec2(0.0, texel.y)).r - d;
+    FragColor = vec4(clamp((abs(dx) + abs(dy)) * 200.0, 0.0, 1.0));
+}
+)";
+
+const char* kBrightFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+out vec4 FragColor;
+void main()
+{
+    FragColor = vec4(max(texture(source, uv).rgb - 0.5, 0.0) * 2.0, 1.0);
+}
+)";
+
+const char* kBlurFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+uniform vec2 direction;
+out vec4 FragColor;
+void main()
+{
+    const float weights[5] = float[](0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216);
+    vec2 step = direction / vec2(textureSize(source, 0));
+    vec3 sum = texture(source, uv).rgb * weights[0];
+    for (int i = 1; i < 5; i++)
+        sum += (texture(source, uv + step * i).rgb + texture(source, uv - step * i).rgb) * weights[i];
+    FragColor = vec4(sum, 1.0);
+}
+)";
+
+const char* kLuminanceFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+out vec4 FragColor;
+void main()
+{
+    FragColor = vec4(dot(texture(source, uv).rgb, vec3(0.2126, 0.7152, 0.0722)));
+}
+)";
+
+const char* kCompositeFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D scene;
+uniform sampler2D bloom;
+uniform sampler2D edges;
+out vec4 FragColor;
+void main()
+{
+    vec3 c = (texture(scene, uv).rgb + texture(bloom, uv).rgb * 0.8) * (1.0 - 0.7 * texture(edges, uv).r);
+    FragColor = vec4(pow(c / (1.0 + c), vec3(1.0 / 2.2)), 1.0);
+}
+)";
+
+unsigned int createProgram(const char* fragmentSource)
+{
+    unsigned int shaders[2] = { glCreateShader(GL_VERTEX_SHADER), glCreateShader(GL_FRAGMENT_SHADER) };
+    const char* sources[2] = { kFullscreenVertex, fragmentSource };
+    unsigned int program = glCreateProgram();
+    for (int i = 0; i < 2; i++)
+    {
+        glShaderSource(shaders[i], 1, &sources[i], NULL);
+        glCompileShader(shaders[i]);
+        glAttachShader(program, shaders[i]);
+    }
+    glLinkProgram(program);
+    int linked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    for (unsigned int shader : shaders)
+        glDeleteShader(shader);
+    if (!linked)
+    {
+        char log[2048];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        printf("ERROR: Link failed.\n%s\n", log);
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+struct Programs
+{
+    unsigned int grid, edges, bright, blur, luminance, composite;
+    unsigned int vao;       // empty, the fullscreen triangle comes from gl_VertexID
+};
+
+// a fullscreen triangle sampling 'inputs' on units 0.. into the bound framebuffer
+void fullscreen(const Programs& programs, unsigned int program, const char* const* samplers, const unsigned int* inputs,
+    int inputNum)
+{
+    glDisable(GL_DEPTH_TEST);
+    glBindVertexArray(programs.vao);
+    glUseProgram(program);
+    for (int i = 0; i < inputNum; i++)
+    {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, inputs[i]);
+        glUniform1i(glGetUniformLocation(program, samplers[i]), i);
+    }
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+struct Frame
+{
+    vector<unsigned char> pixels;
+};
+
+// The scene with a grid drawn over it, edges from its depth, a half size bloom, a composite
+// and a readback, plus a luminance debug view nobody reads. 'scrambled' declares the passes
+// out of order: the compiled graph has to come out the same.
+void buildGraph(RenderGraph& graph, const Programs& programs, CubeScene& scene, Frame& frame, bool scrambled)
+{
+    typedef RenderGraph::Resource Resource;
+    Resource hdr = graph.createTarget("hdr", TargetDesc::screen(GL_RGBA16F));
+    Resource depth = graph.createTarget("depth", TargetDesc::screen(GL_DEPTH24_STENCIL8));
+    Resource edges = graph.createTarget("edges", TargetDesc::screen(GL_R8));
+    Resource bright = graph.createTarget("bright", TargetDesc::screen(GL_RGBA16F, 0.5f));
+    Resource blurX = graph.createTarget("blur x", TargetDesc::screen(GL_RGBA16F, 0.5f));
+    Resource bloom = graph.createTarget("bloom", TargetDesc::screen(GL_RGBA16F, 0.5f));
+    Resource luminance = graph.createTarget("luminance", TargetDesc::screen(GL_R16F, 0.5f));
+    Resource debugView = graph.createTarget("debug view", TargetDesc::screen(GL_RGBA8));
+    Resource ldr = graph.createTarget("ldr", TargetDesc::screen(GL_RGBA8));
+    static const char* source[] = { "source" };
+
+    auto addScene = [&]() {
+        graph.addPass("cubes", [&scene, hdr](const RenderGraph& g) {
+            scene.draw(CubeScene::orbitView(0.7f), (float)g.width(hdr) / g.height(hdr));
+        }).write(hdr).depth(depth);
+        graph.addPass("grid", [&programs](const RenderGraph&) {
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            fullscreen(programs, programs.grid, NULL, NULL, 0);
+            glDisable(GL_BLEND);
+        }).write(hdr).depth(depth);
+    };
+    auto addEdges = [&]() {
+        graph.addPass("edges", [&programs, depth](const RenderGraph& g) {
+            unsigned int input = g.texture(depth);
+            fullscreen(programs, programs.edges, source, &input, 1);
+        }).read(depth).write(edges);
+    };
+    auto addBright = [&]() {
+        graph.addPass("bright", [&programs, hdr](const RenderGraph& g) {
+            unsigned int input = g.texture(hdr);
+            fullscreen(programs, programs.bright, source, &input, 1);
+        }).read(hdr).write(bright);
+    };
+    auto addBlur = [&](const char* name, Resource from, Resource to, float x, float y) {
+        graph.addPass(name, [&programs, from, x, y](const RenderGraph& g) {
+            unsigned int input = g.texture(from);
+            glUseProgram(programs.blur);
+            glUniform2f(glGetUniformLocation(programs.blur, "direction"), x, y);
+            fullscreen(programs, programs.blur, source, &input, 1);
+        }).read(from).write(to);
+    };
+    auto addDebug = [&]() {
+        graph.addPass("luminance", [&programs, hdr](const RenderGraph& g) {
+            unsigned int input = g.texture(hdr);
+            fullscreen(programs, programs.luminance, source, &input, 1);
+        }).read(hdr).write(luminance);
+        graph.addPass("debug view", [&programs, luminance](const RenderGraph& g) {
+            unsigned int input = g.texture(luminance);
+            fullscreen(programs, programs.luminance, source, &input, 1);
+        }).read(luminance).write(debugView);
+    };
+    auto addComposite = [&]() {
+        graph.addPass("composite", [&programs, hdr, bloom, edges](const RenderGraph& g) {
+            static const char* samplers[] = { "scene", "bloom", "edges" };
+            unsigned int inputs[] = { g.texture(hdr), g.texture(bloom), g.texture(edges) };
+            fullscreen(programs, programs.composite, samplers, inputs, 3);
+        }).read(hdr).read(bloom).read(edges).write(ldr);
+        graph.addPass("readback", [&frame, ldr](const RenderGraph& g) {
+            frame.pixels.resize((size_t)g.width(ldr) * g.height(ldr) * 4);
+            glBindTexture(GL_TEXTURE_2D, g.texture(ldr));
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, frame.pixels.data());
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }).read(ldr).sideEffect();
+    };
+
+    addScene();
+    if (scrambled)
+    {
+        // readers before their writers; the two scene passes stay in order, both write hdr
+        addComposite();
+        addDebug();
+        addBlur("blur y", blurX, bloom, 0.0f, 1.0f);
+        addBlur("blur x", bright, blurX, 1.0f, 0.0f);
+        addEdges();
+        addBright();
+    }
+    else
+    {
+        addEdges();
+        addBright();
+        addBlur("blur x", bright, blurX, 1.0f, 0.0f);
+        addBlur("blur y", blurX, bloom, 0.0f, 1.0f);
+        addDebug();
+        addComposite();
+    }
+}
+
+vector<const char*> passNames(const RenderGraph& graph, const char* const* names)
+{
+    vector<const char*> result;
+    for (int pass : graph.executionOrder())
+        result.push_back(names[pass]);
+    return result;
+}
+
+// A depth prepass whose depth only the scene's depth test reads: the scene loads it, so no
+// pass is culled and the prepass runs first.
+bool depthPrepassKept()
+{
+    RenderGraph graph;
+    RenderGraph::Resource hdr = graph.createTarget("hdr", TargetDesc::screen(GL_RGBA16F));
+    RenderGraph::Resource depth = graph.createTarget("depth", TargetDesc::screen(GL_DEPTH24_STENCIL8));
+    RenderGraph::Resource screen = graph.importBackbuffer();
+    RenderGraph::Execute nothing = [](const RenderGraph&) {};
+    graph.addPass("depth prepass", nothing).depth(depth).clear(0, 0, 0);
+    graph.addPass("scene", nothing).write(hdr).depth(depth);
+    graph.addPass("tonemap", nothing).read(hdr).write(screen);
+    if (!graph.compile())
+        return false;
+    graph.print();
+    return graph.culledNum() == 0 && graph.executionOrder() == vector<int>{ 0, 1, 2 };
+}
+
+uint64_t imageHash(const vector<unsigned char>& bytes)
+{
+    uint64_t h = 14695981039346656037ull;
+    for (unsigned char c : bytes)
+        h = (h ^ c) * 1099511628211ull;
+    return h;
+}
+
+// Compiles the same post-processing graph declared in order and out of order, checks culling,
+// ordering and merging, runs it and reports per pass timings, the cost of the graph itself
+// and the memory its lifetimes save.
+// usage: renderGraph [--size WxH] [--frames N] [--dot file.dot]
+int main(int argc, char** argv)
+{
+    int width = 1280, height = 720;
+    int frames = 60;
+    const char* dotPath = NULL;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--size") && i + 1 < argc)
+            sscanf(argv[++i], "%dx%d", &width, &height);
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = max(atoi(argv[++i]), 1);
+        else if (!strcmp(argv[i], "--dot") && i + 1 < argc)
+            dotPath = argv[++i];
+    }
+
+    ContextDesc desc;
+    desc.visible = false;
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    unique_ptr<GLContext> context = GLContext::create(backend, desc);
+    if (!context)
+        return -1;
+    printf("%s, %dx%d\n", (const char*)glGetString(GL_RENDERER), width, height);
+
+    Programs programs = {};
+    programs.grid = createProgram(kGridFragment);
+    programs.edges = createProgram(kEdgeFragment);
+    programs.bright = createProgram(kBrightFragment);
+    programs.blur = createProgram(kBlurFragment);
+    programs.luminance = createProgram(kLuminanceFragment);
+    programs.composite = createProgram(kCompositeFragment);
+    glGenVertexArrays(1, &programs.vao);
+    CubeScene scene;
+    if (!programs.grid || !programs.edges || !programs.bright || !programs.blur || !programs.luminance ||
+        !programs.composite || !scene.init(NULL))
+        return -1;
+
+    TargetPool pool;
+    pool.setScreenSize(width, height);
+    GpuProfiler gpuProfiler;
+    gpuProfiler.init();
+    bool pass = true;
+
+    Frame natural, scrambled;
+    RenderGraph graphs[2];
+    uint64_t hashes[2];
+    vector<const char*> orders[2];
+    for (int g = 0; g < 2; g++)
+    {
+        RenderGraph& graph = graphs[g];
+        buildGraph(graph, programs, scene, g ? scrambled : natural, g == 1);
+        Timer timer;
+        bool compiled = graph.compile();
+        double compileUs = timer.milliseconds() * 1000.0;
+        if (!compiled)
+            return -1;
+        printf("%s declaration, compiled in %.1f us:\n", g ? "scrambled" : "natural", compileUs);
+        graph.print();
+        pool.beginFrame();
+        graph.execute(pool);
+        hashes[g] = imageHash((g ? scrambled : natural).pixels);
+    }
+    // pass names by declaration index, to compare the orders of both graphs
+    const char* naturalNames[] = { "cubes", "grid", "edges", "bright", "blur x", "blur y", "luminance", "debug view",
+        "composite", "readback" };
+    const char* scrambledNames[] = { "cubes", "grid", "composite", "readback", "luminance", "debug view", "blur y",
+        "blur x", "edges", "bright" };
+    orders[0] = passNames(graphs[0], naturalNames);
+    orders[1] = passNames(graphs[1], scrambledNames);
+    bool sameOrder = orders[0].size() == orders[1].size() &&
+        equal(orders[0].begin(), orders[0].end(), orders[1].begin(), [](const char* a, const char* b) { return !strcmp(a, b); });
+    for (const RenderGraph& graph : graphs)
+    {
+        bool shaped = graph.culledNum() == 2 && graph.executedNum() == 8 && graph.groupNum() == 7;
+        pass = pass && shaped;
+    }
+    printf("%s: both declarations cull 2 passes and run 8 in 7 framebuffer binds\n", pass ? "PASS" : "FAIL");
+    bool same = sameOrder && hashes[0] == hashes[1] && !natural.pixels.empty();
+    printf("%s: both declarations compile to the same order and image\n", same ? "PASS" : "FAIL");
+    pass = pass && same;
+    bool prepass = depthPrepassKept();
+    printf("%s: a depth prepass the scene depth tests against is kept\n", prepass ? "PASS" : "FAIL");
+    pass = pass && prepass;
+    if (dotPath)
+        graphs[1].writeDot(dotPath);
+
+    //------- timings -------
+    RenderGraph& graph = graphs[1];
+    double executeMs = 0.0, passesMs = 0.0;
+    for (int f = 0; f < frames; f++)
+    {
+        pool.beginFrame();
+        gpuProfiler.beginFrame();
+        Timer timer;
+        graph.execute(pool, &gpuProfiler);
+        executeMs += timer.milliseconds();
+        gpuProfiler.endFrame();
+        for (int p : graph.executionOrder())
+            passesMs += graph.timing(p).lastMs;
+    }
+    glFinish();
+    // the queries of the last frames come back over the next ones
+    for (int f = 0; f < 8; f++)
+    {
+        gpuProfiler.beginFrame();
+        gpuProfiler.endFrame();
+        glFinish();
+    }
+    printf("per pass, %d frames:\n", frames);
+    graph.printTimings(&gpuProfiler);
+    printf("execute %.3f ms per frame, of which %.3f ms outside the passes (binds, pool)\n", executeMs / frames,
+        (executeMs - passesMs) / frames);
+
+    pool.beginFrame();
+    TargetPool::Stats s = pool.stats();
+    printf("targets: %.2f MB requested per frame, %.2f MB held, %.0f%% saved by lifetimes\n", toMB(s.requestedBytes),
+        toMB(s.bytes), 100.0 * (1.0 - (double)s.bytes / s.requestedBytes));
+    pool.print();
+    printf("%s\n", pass ? "PASS" : "FAIL");
+
+    pool.destroy();
+    scene.destroy();
+    glDeleteVertexArrays(1, &programs.vao);
+    for (unsigned int program : { programs.grid, programs.edges, programs.bright, programs.blur, programs.luminance,
+        programs.composite })
+        glDeleteProgram(program);
+    return pass ? 0 : 1;
+}
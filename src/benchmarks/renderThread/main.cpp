@@ -0,0 +1,145 @@
+#include <snapshotBuffer.h>
+#include <renderThread.h>
+#include <frameStats.h>
+#include <benchUtils.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+using namespace std;
+
+// Simulation and rendering are stood in for by CPU work of a fixed length,
+// the swap by a blocking wait of a fixed length (GPU or vsync bound).
+
+const int kObjectNum = 1024;
+
+struct Snapshot
+{
+    unsigned long long frame;
+    float transforms[kObjectNum * 16];
+};
+
+double simulateMs = 4.0;
+double renderMs = 3.0;
+double swapMs = 5.0;
+
+void burn(double ms)
+{
+    Timer timer;
+    while (timer.milliseconds() < ms)
+        ;
+}
+
+void simulate(Snapshot& s, unsigned long long frame)
+{
+    burn(simulateMs);
+    s.frame = frame;
+    for (int i = 0; i < kObjectNum * 16; i++)
+        s.transforms[i] = (float)(frame + i);
+}
+
+float render(const Snapshot& s)
+{
+    float sum = 0.0f;
+    for (int i = 0; i < kObjectNum * 16; i += 16)
+        sum += s.transforms[i];
+    burn(renderMs);
+    return sum;
+}
+
+void swapBuffers()
+{
+    this_thread::sleep_for(chrono::microseconds((long long)(swapMs * 1000.0)));
+}
+
+void runSerial(int frames)
+{
+    static Snapshot snapshot;
+    FrameStats stats;
+    volatile float sink = 0.0f;
+    for (int f = 0; f <= frames; f++)
+    {
+        stats.frame();
+        stats.beginWork();
+        simulate(snapshot, f);
+        sink = sink + render(snapshot);
+        stats.endWork();
+        swapBuffers();
+    }
+    printf("serial (one thread does everything):\n");
+    stats.print("main");
+}
+
+void runThreaded(int frames, SnapshotBuffer<Snapshot>::Mode mode)
+{
+    static SnapshotBuffer<Snapshot>* buffer;
+    buffer = new SnapshotBuffer<Snapshot>(mode);
+    RenderThread renderThread;
+    atomic<unsigned long long> rendered{ 0 };
+    volatile float sink = 0.0f;
+    renderThread.start(nullptr, [&]() {
+        FrameStats& stats = renderThread.mutableStats();
+        // double buffering is lockstep: every snapshot is drawn exactly once
+        while (!buffer->acquire() && mode == SnapshotBuffer<Snapshot>::Double)
+        {
+            if (buffer->isClosed())
+                return false;
+            this_thread::yield();
+        }
+        stats.beginWork();
+        sink = sink + render(buffer->readSlot());
+        stats.endWork();
+        swapBuffers();
+        rendered++;
+        return true;
+    }, nullptr);
+
+    FrameStats stats;
+    for (int f = 0; f <= frames; f++)
+    {
+        stats.frame();
+        stats.beginWork();
+        simulate(buffer->writeSlot(), f);
+        stats.endWork();
+        buffer->publish();
+    }
+    buffer->close();
+    renderThread.stop();
+
+    printf("%s buffered render thread:\n", mode == SnapshotBuffer<Snapshot>::Double ? "double" : "triple");
+    stats.print("simulate");
+    renderThread.stats().print("render");
+    printf("  %llu snapshots published, %llu dropped, %llu frames rendered\n",
+        (unsigned long long)buffer->published(), (unsigned long long)buffer->dropped(), (unsigned long long)rendered);
+    printf("  cpu over both threads: %.1f%% of one core\n",
+        (stats.cpuRatio() + renderThread.stats().cpuRatio()) * 100.0);
+    delete buffer;
+}
+
+// usage: renderThread [--frames N] [--simulate MS] [--render MS] [--swap MS]
+int main(int argc, char** argv)
+{
+    int frames = 300;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (!strcmp(argv[i], "--frames"))
+            frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--simulate"))
+            simulateMs = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--render"))
+            renderMs = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--swap"))
+            swapMs = atof(argv[++i]);
+    }
+    printf("%d frames, simulate %.1f ms, render %.1f ms, swap %.1f ms\n", frames, simulateMs, renderMs, swapMs);
+    printf("expected frame time: serial %.1f ms, overlapped %.1f ms\n\n",
+        simulateMs + renderMs + swapMs, max(simulateMs, renderMs + swapMs));
+
+    runSerial(frames);
+    runThreaded(frames, SnapshotBuffer<Snapshot>::Double);
+    runThreaded(frames, SnapshotBuffer<Snapshot>::Triple);
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <softRaster.h>
+#include <softCubeScene.h>
+#include <cubeSceneData.h>
+#include <threadPool.h>
+#include <benchUtils.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+void report(const char* name, const SoftRasterizer& rasterizer, int frames, double ms)
+{
+    const SoftRasterStats& s = rasterizer.stats();
+    double seconds = ms / 1000.0;
+    printf("  %-22s %7.2f ms/frame  %8.1f ktri/s  %7.1f Mpixel/s shaded  %7.1f Mpixel/s covered  %5.1f tiles/tri\n",
+        name, ms / frames, s.triangles / seconds / 1e3, s.pixelsShaded / seconds / 1e6,
+        s.pixelsCovered / seconds / 1e6, s.rasterized ? (double)s.binned / s.rasterized : 0.0);
+}
+
+// The 6_camera cubes on a turntable, one full frame (clear, draw, finish) per iteration
+double runCubes(SoftRasterizer& rasterizer, SoftCubeScene& scene, int frames)
+{
+    float aspect = (float)rasterizer.width() / rasterizer.height();
+    rasterizer.resetStats();
+    Timer timer;
+    for (int f = 0; f < frames; f++)
+    {
+        scene.draw(rasterizer, CubeScene::orbitView(f * 0.05f), aspect);
+        rasterizer.finish();
+    }
+    return timer.milliseconds();
+}
+
+// A grid of small cubes: setup and binning bound rather than fill bound
+double runGrid(SoftRasterizer& rasterizer, const SoftTexture* textures, int side, int frames)
+{
+    vector<SoftVertex> vertices(kCubeVertexNum);
+    for (int v = 0; v < kCubeVertexNum; v++)
+    {
+        vertices[v].position = glm::vec3(kCubeVertices[v * 5], kCubeVertices[v * 5 + 1], kCubeVertices[v * 5 + 2]);
+        vertices[v].uv = glm::vec2(kCubeVertices[v * 5 + 3], kCubeVertices[v * 5 + 4]);
+    }
+    float aspect = (float)rasterizer.width() / rasterizer.height();
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), aspect, 0.1f, 500.0f);
+    rasterizer.resetStats();
+    Timer timer;
+    for (int f = 0; f < frames; f++)
+    {
+        glm::mat4 viewProjection = projection * glm::lookAt(glm::vec3(0.0f, 0.0f, side * 1.3f),
+            glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        rasterizer.clear(glm::vec4(0.2f, 0.3f, 0.3f, 1.0f));
+        rasterizer.setTextures(&textures[0], &textures[1]);
+        for (int y = 0; y < side; y++)
+        {
+            for (int x = 0; x < side; x++)
+            {
+                glm::vec3 position((x - side * 0.5f) * 1.5f, (y - side * 0.5f) * 1.5f, 0.0f);
+                glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+                model = glm::rotate(model, f * 0.05f + x * 0.3f + y * 0.1f, glm::vec3(1.0f, 0.3f, 0.5f));
+                model = glm::scale(model, glm::vec3(0.3f));
+                rasterizer.drawIndexed(vertices.data(), kCubeIndices, kCubeIndexNum, viewProjection * model);
+            }
+        }
+        rasterizer.finish();
+    }
+    return timer.milliseconds();
+}
+
+// usage: softRaster [--frames N] [--threads N] [--tile N] [--grid N]
+int main(int argc, char** argv)
+{
+    int frames = 30;
+    unsigned int threads = 0;
+    int tileSize = 64;
+    int gridSide = 40;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            threads = (unsigned int)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--tile") && i + 1 < argc)
+            tileSize = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--grid") && i + 1 < argc)
+            gridSide = atoi(argv[++i]);
+    }
+
+    ThreadPool pool(threads);
+    SoftCubeScene scene;
+    if (!scene.init(NULL))
+        return -1;
+    vector<unsigned char> rgb;
+    int texWidth, texHeight;
+    SoftTexture textures[2];
+    for (int t = 0; t < 2; t++)
+    {
+        if (!loadCubeTexture(NULL, t, rgb, texWidth, texHeight))
+            return -1;
+        textures[t].create(rgb.data(), texWidth, texHeight, 3);
+        textures[t].minFilter = SoftTexture::LinearMipmapLinear;
+    }
+    printf("%d frames, %dpx tiles, edge functions: %s, pool: %u workers + caller\n",
+        frames, tileSize, softRasterPath(), pool.size());
+
+    const int sizes[2][2] = { { 800, 600 }, { 1920, 1080 } };
+    for (auto& size : sizes)
+    {
+        printf("%dx%d\n", size[0], size[1]);
+        SoftRasterizer serial(NULL, tileSize), parallel(&pool, tileSize);
+        serial.resize(size[0], size[1]);
+        parallel.resize(size[0], size[1]);
+
+        scene.setMinFilter(SoftTexture::Linear);
+        report("cubes, 1 thread", serial, frames, runCubes(serial, scene, frames));
+        report("cubes, pool", parallel, frames, runCubes(parallel, scene, frames));
+        scene.setMinFilter(SoftTexture::LinearMipmapLinear);
+        report("cubes trilinear, pool", parallel, frames, runCubes(parallel, scene, frames));
+
+        char name[64];
+        snprintf(name, sizeof(name), "%d cubes, 1 thread", gridSide * gridSide);
+        report(name, serial, frames, runGrid(serial, textures, gridSide, frames));
+        snprintf(name, sizeof(name), "%d cubes, pool", gridSide * gridSide);
+        report(name, parallel, frames, runGrid(parallel, textures, gridSide, frames));
+    }
+    return 0;
+}
@@ -0,0 +1,343 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <renderTarget.h>
+#include <cubeScene.h>
+#include <targetPool.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+const char* kFullscreenVertex = R"(#version 330 core
+out vec2 uv;
+void main()
+{
+    uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+const char* kBrightFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+out vec4 FragColor;
+void main()
+{
+    FragColor = vec4(max(texture(source, uv).rgb - 0.5, 0.0) * 2.0, 1.0);
+}
+)";
+
+const char* kBlurFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+uniform vec2 direction;
+out vec4 FragColor;
+void main()
+{
+    const float weights[5] = float[](0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216);
+    vec2 step = direction / vec2(textureSize(source, 0));
+    vec3 sum = texture(source, uv).rgb * weights[0];
+    for (int i = 1; i < 5; i++)
+        sum += (texture(source, uv + step * i).rgb + texture(source, uv - step * i).rgb) * weights[i];
+    FragColor = vec4(sum, 1.0);
+}
+)";
+
+const char* kCopyFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+out vec4 FragColor;
+void main()
+{
+    FragColor = texture(source, uv);
+}
+)";
+
+const char* kEdgeFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+out vec4 FragColor;
+void main()
+{
+    vec2 texel = 1.0 / vec2(textureSize(source, 0));
+    float d = texture(source, uv).r;
+    float dx = texture(source, uv + vec2(texel.x, 0.0)).r - d;
+    float dy = texture(source, uv + vec2(0.0, texel.y)).r - d;
+    FragColor = vec4(clamp((abs(dx) + abs(dy)) * 200.0, 0.0, 1.0));
+}
+)";
+
+const char* kCompositeFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D scene;
+uniform sampler2D bloom0;
+uniform sampler2D bloom1;
+uniform sampler2D bloom2;
+uniform sampler2D edges;
+out vec4 FragColor;
+void main()
+{
+    vec3 c = texture(scene, uv).rgb + texture(bloom0, uv).rgb * 0.8 + texture(bloom1, uv).rgb * 0.6 +
+        texture(bloom2, uv).rgb * 0.4;
+    FragColor = vec4(c * (1.0 - 0.7 * texture(edges, uv).r), 1.0);
+}
+)";
+
+const char* kVignetteFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+out vec4 FragColor;
+void main()
+{
+    vec2 offset = (uv - 0.5) * 0.006;
+    vec3 c = vec3(texture(source, uv + offset).r, texture(source, uv).g, texture(source, uv - offset).b);
+    FragColor = vec4(c * (1.0 - 0.6 * dot(uv - 0.5, uv - 0.5)), 1.0);
+}
+)";
+
+const char* kTonemapFragment = R"(#version 330 core
+in vec2 uv;
+uniform sampler2D source;
+out vec4 FragColor;
+void main()
+{
+    vec3 c = texture(source, uv).rgb;
+    FragColor = vec4(pow(c / (1.0 + c), vec3(1.0 / 2.2)), 1.0);
+}
+)";
+
+unsigned int createProgram(const char* fragmentSource)
+{
+    unsigned int shaders[2] = { glCreateShader(GL_VERTEX_SHADER), glCreateShader(GL_FRAGMENT_SHADER) };
+    const char* sources[2] = { kFullscreenVertex, fragmentSource };
+    unsigned int program = glCreateProgram();
+    for (int i = 0; i < 2; i++)
+    {
+        glShaderSource(shaders[i], 1, &sources[i], NULL);
+        glCompileShader(shaders[i]);
+        glAttachShader(program, shaders[i]);
+    }
+    glLinkProgram(program);
+    int linked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    for (unsigned int shader : shaders)
+        glDeleteShader(shader);
+    if (!linked)
+    {
+        char log[2048];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        printf("ERROR: Link failed.\n%s\n", log);
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+struct Programs
+{
+    unsigned int bright, blur, copy, edges, composite, vignette, tonemap;
+    unsigned int vao;       // empty, the fullscreen triangle comes from gl_VertexID
+};
+
+// a fullscreen triangle reading 'inputs' on units 0.. into the bound framebuffer
+void fullscreen(unsigned int program, const char* const* samplers, const unsigned int* inputs, int inputNum)
+{
+    glUseProgram(program);
+    for (int i = 0; i < inputNum; i++)
+    {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, inputs[i]);
+        glUniform1i(glGetUniformLocation(program, samplers[i]), i);
+    }
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+void blur(TargetPool& pool, const Programs& programs, unsigned int target, unsigned int source, float x, float y)
+{
+    const char* samplers[] = { "source" };
+    pool.bindFramebuffer(&target, 1, 0);
+    glUseProgram(programs.blur);
+    glUniform2f(glGetUniformLocation(programs.blur, "direction"), x, y);
+    fullscreen(programs.blur, samplers, &source, 1);
+}
+
+// Scene, edge detection on its depth, bloom at a half, a quarter and an eighth of the size,
+// composite, vignette and tonemap into 'output': fourteen targets, of which few live at once. 'alias' releases each one after
+// its last reader, otherwise all are held to the end of the frame like dedicated targets.
+void renderFrame(TargetPool& pool, const Programs& programs, CubeScene& scene, RenderTarget& output, bool alias)
+{
+    const char* source[] = { "source" };
+    vector<unsigned int> held;
+    auto done = [&](unsigned int texture) {
+        if (alias)
+            pool.release(texture);
+        else
+            held.push_back(texture);
+    };
+    pool.beginFrame();
+
+    unsigned int hdr = pool.acquire(TargetDesc::screen(GL_RGBA16F));
+    unsigned int depth = pool.acquire(TargetDesc::screen(GL_DEPTH24_STENCIL8));
+    pool.bindFramebuffer(&hdr, 1, depth);
+    scene.draw(CubeScene::orbitView(0.7f), (float)pool.screenWidth() / pool.screenHeight());
+    glDisable(GL_DEPTH_TEST);
+    glBindVertexArray(programs.vao);
+
+    unsigned int edges = pool.acquire(TargetDesc::screen(GL_R8));
+    pool.bindFramebuffer(&edges, 1, 0);
+    fullscreen(programs.edges, source, &depth, 1);
+    done(depth);
+
+    // each level blurs the one above it, its result is kept for the composite
+    unsigned int bloom[3];
+    unsigned int above = hdr;
+    for (int level = 0; level < 3; level++)
+    {
+        float scale = 0.5f / (1 << level);
+        unsigned int down = pool.acquire(TargetDesc::screen(GL_RGBA16F, scale));
+        pool.bindFramebuffer(&down, 1, 0);
+        fullscreen(level ? programs.copy : programs.bright, source, &above, 1);
+        unsigned int blurX = pool.acquire(TargetDesc::screen(GL_RGBA16F, scale));
+        blur(pool, programs, blurX, down, 1.0f, 0.0f);
+        done(down);
+        bloom[level] = pool.acquire(TargetDesc::screen(GL_RGBA16F, scale));
+        blur(pool, programs, bloom[level], blurX, 0.0f, 1.0f);
+        done(blurX);
+        above = bloom[level];
+    }
+
+    unsigned int composite = pool.acquire(TargetDesc::screen(GL_RGBA16F));
+    pool.bindFramebuffer(&composite, 1, 0);
+    const char* compositeSamplers[] = { "scene", "bloom0", "bloom1", "bloom2", "edges" };
+    unsigned int compositeInputs[] = { hdr, bloom[0], bloom[1], bloom[2], edges };
+    fullscreen(programs.composite, compositeSamplers, compositeInputs, 5);
+    for (unsigned int texture : compositeInputs)
+        done(texture);
+
+    unsigned int vignette = pool.acquire(TargetDesc::screen(GL_RGBA16F));
+    pool.bindFramebuffer(&vignette, 1, 0);
+    fullscreen(programs.vignette, source, &composite, 1);
+    done(composite);
+
+    output.bind();
+    fullscreen(programs.tonemap, source, &vignette, 1);
+    done(vignette);
+
+    for (unsigned int texture : held)
+        pool.release(texture);
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+uint64_t imageHash(const RenderTarget& target)
+{
+    vector<unsigned char> rgba;
+    target.readPixels(rgba);
+    uint64_t h = 14695981039346656037ull;
+    for (unsigned char c : rgba)
+        h = (h ^ c) * 1099511628211ull;
+    return h;
+}
+
+double megabytes(size_t bytes)
+{
+    return bytes / (1024.0 * 1024.0);
+}
+
+// A bloom and edge post-processing chain through a TargetPool, with dedicated targets and with
+// aliasing, over a sequence of window sizes. Images must match, steady frames must not create
+// textures, and a resize must re-create the screen-sized ones once.
+// usage: targetPool [--frames N_per_size]
+int main(int argc, char** argv)
+{
+    int frames = 8;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = max(atoi(argv[++i]), 3);
+    }
+
+    ContextDesc desc;
+    desc.visible = false;
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    unique_ptr<GLContext> context = GLContext::create(backend, desc);
+    if (!context)
+        return -1;
+    printf("%s\n", (const char*)glGetString(GL_RENDERER));
+
+    Programs programs = {};
+    programs.bright = createProgram(kBrightFragment);
+    programs.blur = createProgram(kBlurFragment);
+    programs.copy = createProgram(kCopyFragment);
+    programs.edges = createProgram(kEdgeFragment);
+    programs.composite = createProgram(kCompositeFragment);
+    programs.vignette = createProgram(kVignetteFragment);
+    programs.tonemap = createProgram(kTonemapFragment);
+    glGenVertexArrays(1, &programs.vao);
+    CubeScene scene;
+    if (!programs.bright || !programs.blur || !programs.copy || !programs.edges || !programs.composite ||
+        !programs.vignette || !programs.tonemap || !scene.init(NULL))
+        return -1;
+
+    const int sizes[][2] = { { 1280, 720 }, { 1920, 1080 }, { 800, 600 }, { 1280, 720 } };
+    // the same pool for every size: resizing has to re-create lazily
+    TargetPool pool;
+    bool pass = true;
+    printf("  %-10s %14s %14s %10s %10s\n", "size", "dedicated MB", "aliased MB", "saved", "textures");
+    for (const int* size : sizes)
+    {
+        RenderTarget output;
+        if (!output.create(size[0], size[1]))
+            return -1;
+        TargetPool dedicated, aliased;
+        dedicated.setScreenSize(size[0], size[1]);
+        renderFrame(dedicated, programs, scene, output, false);
+        uint64_t dedicatedHash = imageHash(output);
+        TargetPool::Stats d = dedicated.stats();
+
+        pool.setScreenSize(size[0], size[1]);
+        uint64_t createdBefore = pool.stats().created;
+        uint64_t steadyCreated = 0;
+        for (int f = 0; f < frames; f++)
+        {
+            renderFrame(pool, programs, scene, output, true);
+            if (f == 0)
+                steadyCreated = pool.stats().created;
+        }
+        steadyCreated = pool.stats().created - steadyCreated;
+        uint64_t aliasedHash = imageHash(output);
+        pool.beginFrame();      // closes the last frame's statistics, drops textures of the old size
+        TargetPool::Stats a = pool.stats();
+        printf("  %4dx%-5d %14.2f %14.2f %9.0f%% %4u -> %-3u\n", size[0], size[1], megabytes(d.bytes), megabytes(a.bytes),
+            100.0 * (1.0 - (double)a.bytes / d.bytes), d.textures, a.textures);
+
+        bool same = dedicatedHash == aliasedHash;
+        bool recycled = steadyCreated == 0 && a.created - createdBefore == a.textures && a.requestedBytes == d.bytes;
+        if (!same)
+            printf("FAIL: %dx%d aliased targets draw a different image\n", size[0], size[1]);
+        if (!recycled)
+            printf("FAIL: %dx%d created %llu textures for %u, %llu after the first frame\n", size[0], size[1],
+                (unsigned long long)(a.created - createdBefore), a.textures, (unsigned long long)steadyCreated);
+        pass = pass && same && recycled;
+        if (size == sizes[3])
+            pool.print();
+    }
+    printf("%s: aliased targets draw the same image, steady frames create no texture, resizes re-create once\n",
+        pass ? "PASS" : "FAIL");
+
+    pool.destroy();
+    scene.destroy();
+    glDeleteVertexArrays(1, &programs.vao);
+    for (unsigned int program : { programs.bright, programs.blur, programs.copy, programs.edges, programs.composite,
+        programs.vignette, programs.tonemap })
+        glDeleteProgram(program);
+    return pass ? 0 : 1;
+}
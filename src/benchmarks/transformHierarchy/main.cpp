@@ -0,0 +1,112 @@
+#include <transformHierarchy.h>
+#include <threadPool.h>
+#include <benchUtils.h>
+#include <glm/gtc/matrix_transform.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/component_wise.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// The chapters' way: rebuild every matrix with glm::translate/rotate/scale each frame
+void naiveRebuild(const TransformHierarchy& h, vector<glm::mat4>& worlds)
+{
+    for (size_t i = 0; i < h.size(); i++)
+    {
+        glm::mat4 local = glm::translate(glm::identity<glm::mat4>(), h.position((int)i));
+        local = local * glm::mat4_cast(h.rotation((int)i));
+        local = glm::scale(local, h.scale((int)i));
+        int p = h.parent((int)i);
+        worlds[i] = p == TransformHierarchy::kNoParent ? local : worlds[p] * local;
+    }
+}
+
+// usage: transformHierarchy [--nodes N] [--branch N] [--frames N]
+int main(int argc, char** argv)
+{
+    int nodeNum = 1000000;
+    int branch = 4;
+    int frames = 20;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--nodes") && i + 1 < argc)
+            nodeNum = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--branch") && i + 1 < argc)
+            branch = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = atoi(argv[++i]);
+    }
+
+    mt19937 rng(1234);
+    uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    TransformHierarchy h;
+    h.reserve(nodeNum);
+    for (int i = 0; i < nodeNum; i++)
+    {
+        int parent = i == 0 ? TransformHierarchy::kNoParent : (i - 1) / branch;
+        h.create(parent, glm::vec3(uniform(rng), uniform(rng), uniform(rng)),
+            glm::angleAxis(uniform(rng), glm::normalize(glm::vec3(1.0f, 0.3f, 0.5f))), glm::vec3(1.0f));
+    }
+    h.updateAll();
+
+    ThreadPool& pool = ThreadPool::global();
+    printf("%d nodes, %d-ary tree, %u threads, %d frames\n", nodeNum, branch, pool.size() + 1, frames);
+    printf("%-8s %12s %12s %12s %12s %10s\n", "changed", "naive(ms)", "all(ms)", "dirty(ms)", "parallel(ms)", "updated");
+
+    vector<glm::mat4> naive(nodeNum);
+    const float fractions[] = { 0.01f, 0.10f, 1.00f };
+    for (float fraction : fractions)
+    {
+        int changedNum = (int)(nodeNum * fraction);
+        uniform_int_distribution<int> pick(0, nodeNum - 1);
+        vector<int> touched(changedNum);
+
+        double tNaive = 0, tAll = 0, tDirty = 0, tParallel = 0;
+        size_t updated = 0;
+        for (int f = 0; f < frames; f++)
+        {
+            // same edit set for every variant of this frame
+            for (int& t : touched)
+                t = fraction >= 1.0f ? (int)(&t - touched.data()) : pick(rng);
+            glm::vec3 offset(0.001f * f, 0.0f, 0.0f);
+
+            Timer timer;
+            naiveRebuild(h, naive);
+            tNaive += timer.milliseconds();
+
+            for (int t : touched)
+                h.setPosition(t, h.position(t) + offset);
+            timer.reset();
+            h.updateAll();
+            tAll += timer.milliseconds();
+
+            for (int t : touched)
+                h.setPosition(t, h.position(t) + offset);
+            timer.reset();
+            h.update();
+            tDirty += timer.milliseconds();
+
+            for (int t : touched)
+                h.setPosition(t, h.position(t) + offset);
+            timer.reset();
+            h.update(&pool);
+            tParallel += timer.milliseconds();
+            updated += h.lastUpdatedNum();
+        }
+        printf("%7.0f%% %12.3f %12.3f %12.3f %12.3f %10zu\n", fraction * 100.0f,
+            tNaive / frames, tAll / frames, tDirty / frames, tParallel / frames, updated / frames);
+    }
+
+    // the incremental result must match a full rebuild
+    naiveRebuild(h, naive);
+    float maxError = 0.0f;
+    for (int i = 0; i < nodeNum; i++)
+        for (int c = 0; c < 4; c++)
+            maxError = glm::max(maxError, glm::compMax(glm::abs(naive[i][c] - h.world(i)[c])));
+    printf("max difference to full rebuild: %g\n", maxError);
+    return maxError < 1e-3f ? 0 : -1;
+}
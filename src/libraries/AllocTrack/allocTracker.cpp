@@ -0,0 +1,551 @@
+#include "allocTracker.h"
+
+#include <cpuProfiler.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__GLIBC__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+// the hook's return address: call sites start at the frame that called operator new or malloc
+#ifdef _MSC_VER
+#include <intrin.h>
+#define ALLOC_TRACK_CALLER _ReturnAddress()
+#else
+#define ALLOC_TRACK_CALLER __builtin_return_address(0)
+#endif
+
+#if defined(ALLOC_TRACK_MALLOC) && !defined(__GLIBC__)
+#undef ALLOC_TRACK_MALLOC       // only glibc lets the program replace malloc and call the original
+#endif
+
+#ifdef ALLOC_TRACK_MALLOC
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+extern "C" void* __libc_memalign(size_t alignment, size_t size);
+#endif
+
+using namespace std;
+
+namespace
+{
+    const char* const kNoScope = "(no scope)";
+    const char* const kOtherScopes = "(other scopes)";
+    const int kLoggedViolations = 16;
+    // frames of the tracker and the hook above the caller, at most
+    const int kHookFrames = 8;
+
+    std::atomic<AllocTracker*> active{ nullptr };
+
+    // set while the tracker records or reports: whatever it allocates itself is not counted
+    thread_local bool inHook = false;
+    thread_local bool inFrame = false;
+    thread_local int allowDepth = 0;
+
+    struct HookScope
+    {
+        bool outer;
+        HookScope() : outer(inHook) { inHook = true; }
+        ~HookScope() { inHook = outer; }
+    };
+
+    // up to depth frames from caller on, inlining and tail calls make the tracker's own
+    // frames vary
+    int captureStack(void** stack, int depth, void* caller)
+    {
+        void* frames[AllocTracker::kCallSiteDepth + kHookFrames];
+        depth = min(depth, AllocTracker::kCallSiteDepth);
+#if defined(_WIN32)
+        int n = CaptureStackBackTrace(0, depth + kHookFrames, frames, NULL);
+#elif defined(__GLIBC__)
+        int n = backtrace(frames, depth + kHookFrames);
+#else
+        int n = 0;
+#endif
+        int first = 0;
+        while (first < n && frames[first] != caller)
+            first++;
+        if (first == n)
+            first = 0;
+        n = min(n - first, depth);
+        memcpy(stack, frames + first, n * sizeof(void*));
+        return n;
+    }
+
+    // function name where the binary exports it, module and offset otherwise (addr2line -e)
+    string describe(void* address)
+    {
+        char text[64];
+        snprintf(text, sizeof(text), "%p", address);
+#if defined(__GLIBC__) && !defined(_WIN32)
+        Dl_info info;
+        if (dladdr(address, &info) && info.dli_fname)
+        {
+            if (info.dli_sname)
+            {
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(info.dli_sname, NULL, NULL, &status);
+                string name = status == 0 && demangled ? demangled : info.dli_sname;
+                free(demangled);
+                return name;
+            }
+            const char* module = strrchr(info.dli_fname, '/');
+            snprintf(text, sizeof(text), "%s+0x%zx", module ? module + 1 : info.dli_fname,
+                (size_t)((char*)address - (char*)info.dli_fbase));
+        }
+#endif
+        return text;
+    }
+
+    void printStack(void* const* stack, int depth, const char* indent)
+    {
+        for (int i = 0; i < depth; i++)
+            printf("%s%s\n", indent, describe(stack[i]).c_str());
+    }
+
+    uint64_t hashStack(void* const* stack, int depth)
+    {
+        uint64_t h = 14695981039346656037ull;
+        for (int i = 0; i < depth; i++)
+        {
+            h ^= (uint64_t)(uintptr_t)stack[i];
+            h *= 1099511628211ull;
+        }
+        return h ? h : 1;
+    }
+
+    double toKB(double bytes)
+    {
+        return bytes / 1024.0;
+    }
+}
+
+AllocTracker& AllocTracker::instance()
+{
+    static AllocTracker tracker;
+    return tracker;
+}
+
+void AllocTracker::enable(bool callSites)
+{
+    if (!isEnabled())
+    {
+        // a new measurement, the frame count goes on
+        lock_guard<mutex> lock(framesMutex);
+        for (Scope& s : scopes)
+        {
+            s.count.store(0, memory_order_relaxed);
+            s.bytes.store(0, memory_order_relaxed);
+            s.total = s.last = s.peak = {};
+            s.frames = 0;
+        }
+        for (CallSite& site : this->callSites)
+        {
+            site.ready.store(false, memory_order_relaxed);
+            site.count.store(0, memory_order_relaxed);
+            site.bytes.store(0, memory_order_relaxed);
+            site.hash.store(0, memory_order_release);
+        }
+        violations.store(0, memory_order_relaxed);
+        last = {};
+        enabledFrame = frames;
+    }
+    if (callSites)
+    {
+        // the first backtrace loads the unwinder, which allocates
+        HookScope hook;
+        void* stack[kCallSiteDepth];
+        captureStack(stack, kCallSiteDepth, nullptr);
+    }
+    callSitesEnabled.store(callSites, memory_order_relaxed);
+    enabled.store(true, memory_order_relaxed);
+    active.store(this, memory_order_release);
+}
+
+void AllocTracker::disable()
+{
+    active.store(nullptr, memory_order_release);
+    enabled.store(false, memory_order_relaxed);
+}
+
+void AllocTracker::guard(int warmupFrames, AllocViolation violationAction)
+{
+    lock_guard<mutex> lock(framesMutex);
+    action.store(violationAction, memory_order_relaxed);
+    guardedFrom.store(warmupFrames < 0 ? -1 : (int)frames + warmupFrames, memory_order_relaxed);
+}
+
+void AllocTracker::beginFrame()
+{
+    inFrame = true;
+}
+
+void AllocTracker::endFrame()
+{
+    inFrame = false;
+    HookScope hook;
+    lock_guard<mutex> lock(framesMutex);
+    Counters frame = {};
+    for (Scope& s : scopes)
+    {
+        if (!s.name.load(memory_order_acquire))
+            continue;
+        Counters c = { s.count.exchange(0, memory_order_relaxed), s.bytes.exchange(0, memory_order_relaxed) };
+        s.last = c;
+        s.total.count += c.count;
+        s.total.bytes += c.bytes;
+        s.peak.count = max(s.peak.count, c.count);
+        s.peak.bytes = max(s.peak.bytes, c.bytes);
+        s.frames += c.count > 0;
+        frame.count += c.count;
+        frame.bytes += c.bytes;
+    }
+    last = frame;
+    frames++;
+}
+
+AllocTracker::Counters AllocTracker::totals() const
+{
+    lock_guard<mutex> lock(framesMutex);
+    Counters all = {};
+    for (const Scope& s : scopes)
+    {
+        all.count += s.total.count;
+        all.bytes += s.total.bytes;
+    }
+    return all;
+}
+
+//------- recording -------
+void AllocTracker::record(size_t size, void* caller)
+{
+    if (AllocTracker* tracker = active.load(memory_order_relaxed))
+        tracker->recordAllocation(size, caller);
+}
+
+void AllocTracker::recordAllocation(size_t size, void* caller)
+{
+    if (inHook)
+        return;
+    HookScope hook;
+    const char* name = CpuProfiler::currentScope();
+    if (!name)
+        name = kNoScope;
+    Scope& s = scope(name);
+    s.count.fetch_add(1, memory_order_relaxed);
+    s.bytes.fetch_add(size, memory_order_relaxed);
+
+    // only the frame thread reads and writes frames while inFrame
+    int from = guardedFrom.load(memory_order_relaxed);
+    bool guarded = inFrame && allowDepth == 0 && from >= 0 && frames >= (uint64_t)from;
+    bool sites = callSitesEnabled.load(memory_order_relaxed);
+    if (!sites && !guarded)
+        return;
+
+    void* stack[kCallSiteDepth];
+    int depth = sites || action.load(memory_order_relaxed) != AllocViolation::Count ? captureStack(stack, kCallSiteDepth, caller) : 0;
+    if (sites)
+    {
+        if (CallSite* site = callSite(stack, depth, name))
+        {
+            site->count.fetch_add(1, memory_order_relaxed);
+            site->bytes.fetch_add(size, memory_order_relaxed);
+        }
+    }
+    if (guarded)
+        violation(size, name, stack, depth);
+}
+
+AllocTracker::Scope& AllocTracker::scope(const char* name)
+{
+    // open addressing on the name's address, scopes are string literals
+    const int slots = kMaxScopes - 1;
+    size_t start = (size_t)(((uintptr_t)name >> 3) * 0x9E3779B97F4A7C15ull >> 32) % slots;
+    for (int probe = 0; probe < slots; probe++)
+    {
+        Scope& s = scopes[(start + probe) % slots];
+        const char* key = s.name.load(memory_order_acquire);
+        if (key == name)
+            return s;
+        if (!key && s.name.compare_exchange_strong(key, name, memory_order_acq_rel))
+            return s;
+        if (key == name)
+            return s;
+    }
+    Scope& other = scopes[kMaxScopes - 1];
+    const char* key = nullptr;
+    other.name.compare_exchange_strong(key, kOtherScopes, memory_order_acq_rel);
+    return other;
+}
+
+AllocTracker::CallSite* AllocTracker::callSite(void* const* stack, int depth, const char* scopeName)
+{
+    uint64_t hash = hashStack(stack, depth);
+    for (int probe = 0; probe < kMaxCallSites; probe++)
+    {
+        CallSite& site = callSites[(hash + probe) % kMaxCallSites];
+        uint64_t key = site.hash.load(memory_order_acquire);
+        if (key == hash)
+            return &site;
+        if (!key && site.hash.compare_exchange_strong(key, hash, memory_order_acq_rel))
+        {
+            memcpy(site.stack, stack, depth * sizeof(void*));
+            site.depth = depth;
+            site.scope = scopeName;
+            site.ready.store(true, memory_order_release);
+            return &site;
+        }
+        if (key == hash)
+            return &site;
+    }
+    return nullptr;     // full: the site goes uncounted, its scope still counts it
+}
+
+void AllocTracker::violation(size_t size, const char* scopeName, void* const* stack, int depth)
+{
+    uint64_t n = violations.fetch_add(1, memory_order_relaxed) + 1;
+    AllocViolation act = action.load(memory_order_relaxed);
+    if (act == AllocViolation::Count || (act == AllocViolation::Log && n > kLoggedViolations))
+        return;
+    printf("ERROR: Heap allocation of %zu bytes in frame %llu, scope \"%s\"%s\n", size, (unsigned long long)frames,
+        scopeName, depth ? ":" : ".");
+    printStack(stack, depth, "    ");
+    if (act == AllocViolation::Log && n == kLoggedViolations)
+        printf("ERROR: Further heap allocations in guarded frames are only counted.\n");
+    if (act == AllocViolation::Abort)
+    {
+        fflush(stdout);
+        abort();
+    }
+}
+
+//------- reports -------
+void AllocTracker::printFrame() const
+{
+    HookScope hook;
+    vector<const Scope*> list;
+    lock_guard<mutex> lock(framesMutex);
+    for (const Scope& s : scopes)
+        if (s.name.load(memory_order_acquire) && s.last.count)
+            list.push_back(&s);
+    sort(list.begin(), list.end(), [](const Scope* a, const Scope* b) { return a->last.bytes > b->last.bytes; });
+    printf("allocations frame %llu: %llu (%.1f KB)", (unsigned long long)frames, (unsigned long long)last.count,
+        toKB((double)last.bytes));
+    for (const Scope* s : list)
+        printf("%s %s %llu (%.1f KB)", s == list.front() ? " -" : ",", s->name.load(memory_order_relaxed),
+            (unsigned long long)s->last.count, toKB((double)s->last.bytes));
+    printf("\n");
+}
+
+void AllocTracker::print(int topNum) const
+{
+    HookScope hook;
+    struct Row
+    {
+        string name;
+        Counters total, peak;
+        uint64_t frames;
+    };
+    vector<Row> rows;
+    Counters all = {};
+    uint64_t frameCount;
+    {
+        lock_guard<mutex> lock(framesMutex);
+        frameCount = frames - enabledFrame;
+        for (const Scope& s : scopes)
+        {
+            const char* name = s.name.load(memory_order_acquire);
+            if (!name || !s.total.count)
+                continue;
+            all.count += s.total.count;
+            all.bytes += s.total.bytes;
+            // the same name from different translation units is one scope
+            auto it = find_if(rows.begin(), rows.end(), [&](const Row& r) { return r.name == name; });
+            if (it == rows.end())
+            {
+                rows.push_back({ name, s.total, s.peak, s.frames });
+                continue;
+            }
+            it->total.count += s.total.count;
+            it->total.bytes += s.total.bytes;
+            it->peak.count = max(it->peak.count, s.peak.count);
+            it->peak.bytes = max(it->peak.bytes, s.peak.bytes);
+            it->frames = max(it->frames, s.frames);
+        }
+    }
+    sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.total.count > b.total.count; });
+    double perFrame = frameCount ? 1.0 / frameCount : 0.0;
+    printf("allocations after %llu frames: %.1f per frame, %.1f KB per frame, %llu in guarded frames\n",
+        (unsigned long long)frameCount, all.count * perFrame, toKB(all.bytes * perFrame), (unsigned long long)violationNum());
+    printf("  %-24s %10s %12s %10s %12s %8s\n", "scope", "per frame", "KB/frame", "peak", "peak KB", "frames");
+    for (const Row& r : rows)
+        printf("  %-24s %10.1f %12.2f %10llu %12.2f %8llu\n", r.name.c_str(), r.total.count * perFrame,
+            toKB(r.total.bytes * perFrame), (unsigned long long)r.peak.count, toKB((double)r.peak.bytes),
+            (unsigned long long)r.frames);
+
+    if (!callSitesEnabled.load(memory_order_relaxed) || topNum <= 0)
+        return;
+    vector<const CallSite*> sites;
+    for (const CallSite& site : callSites)
+        if (site.ready.load(memory_order_acquire))
+            sites.push_back(&site);
+    sort(sites.begin(), sites.end(), [](const CallSite* a, const CallSite* b) {
+        return a->count.load(memory_order_relaxed) > b->count.load(memory_order_relaxed);
+    });
+    printf("top call sites:\n");
+    for (int i = 0; i < topNum && i < (int)sites.size(); i++)
+    {
+        const CallSite& site = *sites[i];
+        printf("  %llu allocations, %.1f KB, scope \"%s\"\n", (unsigned long long)site.count.load(memory_order_relaxed),
+            toKB((double)site.bytes.load(memory_order_relaxed)), site.scope);
+        printStack(site.stack, site.depth, "      ");
+    }
+}
+
+AllocAllowScope::AllocAllowScope()
+{
+    allowDepth++;
+}
+
+AllocAllowScope::~AllocAllowScope()
+{
+    allowDepth--;
+}
+
+//------- hooks -------
+// replacements of the global allocation functions, they take effect in any program linking
+// this translation unit
+namespace
+{
+    // without counting again in the malloc hook
+    void* rawAllocate(size_t size, size_t alignment)
+    {
+#ifdef ALLOC_TRACK_MALLOC
+        return alignment ? __libc_memalign(alignment, size) : __libc_malloc(size);
+#elif defined(_MSC_VER)
+        return alignment ? _aligned_malloc(size, alignment) : malloc(size);
+#else
+        if (!alignment)
+            return malloc(size);
+        void* p = nullptr;
+        return posix_memalign(&p, max(alignment, sizeof(void*)), size) ? nullptr : p;
+#endif
+    }
+
+    void rawFree(void* pointer, bool aligned)
+    {
+#ifdef _MSC_VER
+        if (aligned)
+        {
+            _aligned_free(pointer);
+            return;
+        }
+#endif
+        (void)aligned;
+        free(pointer);
+    }
+
+    void* allocate(size_t size, size_t alignment, bool nothrow, void* caller)
+    {
+        AllocTracker::record(size, caller);
+        if (!size)
+            size = 1;
+        for (;;)
+        {
+            if (void* p = rawAllocate(size, alignment))
+                return p;
+            new_handler handler = get_new_handler();
+            if (!handler)
+            {
+                if (nothrow)
+                    return nullptr;
+                throw bad_alloc();
+            }
+            handler();
+        }
+    }
+}
+
+void* operator new(size_t size) { return allocate(size, 0, false, ALLOC_TRACK_CALLER); }
+void* operator new[](size_t size) { return allocate(size, 0, false, ALLOC_TRACK_CALLER); }
+void* operator new(size_t size, const nothrow_t&) noexcept { return allocate(size, 0, true, ALLOC_TRACK_CALLER); }
+void* operator new[](size_t size, const nothrow_t&) noexcept { return allocate(size, 0, true, ALLOC_TRACK_CALLER); }
+void* operator new(size_t size, align_val_t alignment) { return allocate(size, (size_t)alignment, false, ALLOC_TRACK_CALLER); }
+void* operator new[](size_t size, align_val_t alignment) { return allocate(size, (size_t)alignment, false, ALLOC_TRACK_CALLER); }
+void* operator new(size_t size, align_val_t alignment, const nothrow_t&) noexcept { return allocate(size, (size_t)alignment, true, ALLOC_TRACK_CALLER); }
+void* operator new[](size_t size, align_val_t alignment, const nothrow_t&) noexcept { return allocate(size, (size_t)alignment, true, ALLOC_TRACK_CALLER); }
+
+void operator delete(void* pointer) noexcept { rawFree(pointer, false); }
+void operator delete[](void* pointer) noexcept { rawFree(pointer, false); }
+void operator delete(void* pointer, size_t) noexcept { rawFree(pointer, false); }
+void operator delete[](void* pointer, size_t) noexcept { rawFree(pointer, false); }
+void operator delete(void* pointer, const nothrow_t&) noexcept { rawFree(pointer, false); }
+void operator delete[](void* pointer, const nothrow_t&) noexcept { rawFree(pointer, false); }
+void operator delete(void* pointer, align_val_t) noexcept { rawFree(pointer, true); }
+void operator delete[](void* pointer, align_val_t) noexcept { rawFree(pointer, true); }
+void operator delete(void* pointer, size_t, align_val_t) noexcept { rawFree(pointer, true); }
+void operator delete[](void* pointer, size_t, align_val_t) noexcept { rawFree(pointer, true); }
+void operator delete(void* pointer, align_val_t, const nothrow_t&) noexcept { rawFree(pointer, true); }
+void operator delete[](void* pointer, align_val_t, const nothrow_t&) noexcept { rawFree(pointer, true); }
+
+#ifdef ALLOC_TRACK_MALLOC
+// the whole process allocates through these: libc, the GL driver, the window system
+extern "C"
+{
+    void* malloc(size_t size) noexcept
+    {
+        AllocTracker::record(size, ALLOC_TRACK_CALLER);
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size) noexcept
+    {
+        AllocTracker::record(count * size, ALLOC_TRACK_CALLER);
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* pointer, size_t size) noexcept
+    {
+        if (size)
+            AllocTracker::record(size, ALLOC_TRACK_CALLER);
+        return __libc_realloc(pointer, size);
+    }
+
+    void* memalign(size_t alignment, size_t size) noexcept
+    {
+        AllocTracker::record(size, ALLOC_TRACK_CALLER);
+        return __libc_memalign(alignment, size);
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size) noexcept
+    {
+        AllocTracker::record(size, ALLOC_TRACK_CALLER);
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** pointer, size_t alignment, size_t size) noexcept
+    {
+        if (alignment < sizeof(void*) || (alignment & (alignment - 1)))
+            return EINVAL;
+        AllocTracker::record(size, ALLOC_TRACK_CALLER);
+        void* p = __libc_memalign(alignment, size);
+        if (!p)
+            return ENOMEM;
+        *pointer = p;
+        return 0;
+    }
+}
+#endif
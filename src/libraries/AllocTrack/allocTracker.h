@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+// Heap allocation instrumentation: counts every global operator new (and, built with
+// ALLOC_TRACK_MALLOC on glibc, every malloc/calloc/realloc) per frame and per profiler scope,
+// and enforces heap-free steady-state frames.
+//
+//     AllocTracker& allocs = AllocTracker::instance();
+//     allocs.enable();
+//     allocs.guard(60, AllocViolation::Log);              // after 60 warm-up frames
+//     while (running)
+//     {
+//         allocs.beginFrame();                             // the guarded thread
+//         { PROFILE_SCOPE("submit"); ... }
+//         allocs.endFrame();
+//     }
+//     allocs.print(10);
+//
+// Linking this library replaces the global operator new of the program; while disabled an
+// allocation pays one relaxed load. Allocations are attributed to the innermost PROFILE_SCOPE
+// of the allocating thread (CpuProfiler::currentScope(), so the profiler must be enabled) and,
+// with call sites enabled, to the stack that made them. Counts are process-wide: every thread
+// is counted. The guard only watches the thread between its beginFrame() and endFrame(): once
+// warm-up frames have passed, any allocation there is a violation, logged or aborting.
+// Allocations the frame loop knows about (periodic reports) go inside an AllocAllowScope.
+// Frees are not tracked; the tracker itself never allocates while recording.
+enum class AllocViolation
+{
+    Count,      // only count them
+    Log,        // print the first ones, with their call site
+    Abort,      // print and abort()
+};
+
+class AllocTracker
+{
+public:
+    static constexpr int kMaxScopes = 256;
+    static constexpr int kMaxCallSites = 4096;
+    static constexpr int kCallSiteDepth = 6;
+
+    struct Counters
+    {
+        uint64_t count;
+        uint64_t bytes;
+    };
+
+    static AllocTracker& instance();
+
+    // clears the counts when it was disabled; call sites unwind the stack on every allocation,
+    // microseconds each
+    void enable(bool callSites = false);
+    void disable();
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    void guard(int warmupFrames, AllocViolation action);
+
+    // by the thread driving the frame loop
+    void beginFrame();
+    void endFrame();
+    uint64_t frameNum() const { return frames; }
+
+    // of the last completed frame, every thread
+    Counters lastFrame() const { return last; }
+    // since enable()
+    Counters totals() const;
+    uint64_t violationNum() const { return violations.load(std::memory_order_relaxed); }
+
+    // the last frame by scope
+    void printFrame() const;
+    // per frame by scope since enable(), then the topNum call sites by count
+    void print(int topNum = 10) const;
+
+    // by the allocation hooks, caller is their return address
+    static void record(size_t size, void* caller);
+
+private:
+    struct Scope
+    {
+        std::atomic<const char*> name{ nullptr };
+        std::atomic<uint64_t> count{ 0 };       // in the open frame
+        std::atomic<uint64_t> bytes{ 0 };
+        Counters total{};                       // from closed frames
+        Counters last{};
+        Counters peak{};                        // largest frame
+        uint64_t frames = 0;                    // frames with allocations
+    };
+
+    struct CallSite
+    {
+        std::atomic<uint64_t> hash{ 0 };
+        void* stack[kCallSiteDepth] = {};
+        int depth = 0;                          // of stack
+        std::atomic<bool> ready{ false };       // stack written
+        const char* scope = nullptr;
+        std::atomic<uint64_t> count{ 0 };
+        std::atomic<uint64_t> bytes{ 0 };
+    };
+
+    AllocTracker() = default;
+    void recordAllocation(size_t size, void* caller);
+    Scope& scope(const char* name);
+    CallSite* callSite(void* const* stack, int depth, const char* scopeName);
+    void violation(size_t size, const char* scopeName, void* const* stack, int depth);
+
+    std::atomic<bool> enabled{ false };
+    std::atomic<bool> callSitesEnabled{ false };
+    std::atomic<int> guardedFrom{ -1 };         // first guarded frame, -1 when off
+    std::atomic<AllocViolation> action{ AllocViolation::Count };
+    std::atomic<uint64_t> violations{ 0 };
+    mutable std::mutex framesMutex;
+    uint64_t frames = 0;
+    uint64_t enabledFrame = 0;                  // frames when the counts were cleared
+    Counters last{};
+    Scope scopes[kMaxScopes];                   // the last one collects scopes that do not fit
+    CallSite callSites[kMaxCallSites];
+};
+
+// allocations inside are counted but never violations
+class AllocAllowScope
+{
+public:
+    AllocAllowScope();
+    ~AllocAllowScope();
+    AllocAllowScope(const AllocAllowScope&) = delete;
+    AllocAllowScope& operator=(const AllocAllowScope&) = delete;
+};
@@ -0,0 +1,253 @@
+#include "batchMath.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#define BATCH_MATH_AVX2 1
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BATCH_MATH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    //------- scalar reference -------
+
+    inline glm::mat4 composeTRS(const glm::vec3& p, const glm::quat& q, const glm::vec3& s)
+    {
+        glm::mat3 r = glm::mat3_cast(q);
+        return glm::mat4(glm::vec4(r[0] * s.x, 0.0f), glm::vec4(r[1] * s.y, 0.0f),
+            glm::vec4(r[2] * s.z, 0.0f), glm::vec4(p, 1.0f));
+    }
+
+#if BATCH_MATH_SSE2
+
+    //------- SSE2 -------
+
+    inline __m128 splat(__m128 v, int lane)
+    {
+        switch (lane)
+        {
+        case 0: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+        case 1: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+        case 2: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+        default: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+    }
+
+    // out = [a0 a1 a2 a3] * b, columns of a preloaded
+    inline void mulMat4Sse(const __m128 a[4], const float* b, float* out)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            __m128 bj = _mm_loadu_ps(b + 4 * j);
+            __m128 r = _mm_mul_ps(a[0], splat(bj, 0));
+            r = _mm_add_ps(r, _mm_mul_ps(a[1], splat(bj, 1)));
+            r = _mm_add_ps(r, _mm_mul_ps(a[2], splat(bj, 2)));
+            r = _mm_add_ps(r, _mm_mul_ps(a[3], splat(bj, 3)));
+            _mm_storeu_ps(out + 4 * j, r);
+        }
+    }
+
+    inline void loadMat4Sse(const float* m, __m128 cols[4])
+    {
+        for (int i = 0; i < 4; i++)
+            cols[i] = _mm_loadu_ps(m + 4 * i);
+    }
+
+    // cross(a, b) for xyz lanes
+    inline __m128 cross3(__m128 a, __m128 b)
+    {
+        __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+        return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+    }
+
+    // Compose four TRS matrices at once in structure-of-arrays form
+    inline void composeTRS4Sse(const glm::vec3* p, const glm::quat* q, const glm::vec3* s, float* out)
+    {
+        __m128 x = _mm_setr_ps(q[0].x, q[1].x, q[2].x, q[3].x);
+        __m128 y = _mm_setr_ps(q[0].y, q[1].y, q[2].y, q[3].y);
+        __m128 z = _mm_setr_ps(q[0].z, q[1].z, q[2].z, q[3].z);
+        __m128 w = _mm_setr_ps(q[0].w, q[1].w, q[2].w, q[3].w);
+        __m128 one = _mm_set1_ps(1.0f);
+        __m128 two = _mm_set1_ps(2.0f);
+        __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+        __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+        __m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+
+        __m128 sx = _mm_setr_ps(s[0].x, s[1].x, s[2].x, s[3].x);
+        __m128 sy = _mm_setr_ps(s[0].y, s[1].y, s[2].y, s[3].y);
+        __m128 sz = _mm_setr_ps(s[0].z, s[1].z, s[2].z, s[3].z);
+
+        __m128 col[4][4];
+        col[0][0] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+        col[0][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+        col[0][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+        col[1][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+        col[1][1] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+        col[1][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+        col[2][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+        col[2][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+        col[2][2] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+        col[3][0] = _mm_setr_ps(p[0].x, p[1].x, p[2].x, p[3].x);
+        col[3][1] = _mm_setr_ps(p[0].y, p[1].y, p[2].y, p[3].y);
+        col[3][2] = _mm_setr_ps(p[0].z, p[1].z, p[2].z, p[3].z);
+        col[0][3] = col[1][3] = col[2][3] = _mm_setzero_ps();
+        col[3][3] = one;
+
+        // transpose each column back to one vec4 per matrix
+        for (int c = 0; c < 4; c++)
+        {
+            __m128 r0 = col[c][0], r1 = col[c][1], r2 = col[c][2], r3 = col[c][3];
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(out + 0 * 16 + 4 * c, r0);
+            _mm_storeu_ps(out + 1 * 16 + 4 * c, r1);
+            _mm_storeu_ps(out + 2 * 16 + 4 * c, r2);
+            _mm_storeu_ps(out + 3 * 16 + 4 * c, r3);
+        }
+    }
+
+#endif
+
+#if BATCH_MATH_AVX2
+
+    //------- AVX2 + FMA: two result columns per instruction -------
+
+    inline __m256 dup128(__m128 v)
+    {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(v), v, 1);
+    }
+
+    inline void mulMat4Avx(const __m256 a[4], const float* b, float* out)
+    {
+        for (int j = 0; j < 4; j += 2)
+        {
+            __m256 bb = _mm256_loadu_ps(b + 4 * j);
+            __m256 r = _mm256_mul_ps(a[0], _mm256_permute_ps(bb, 0x00));
+            r = _mm256_fmadd_ps(a[1], _mm256_permute_ps(bb, 0x55), r);
+            r = _mm256_fmadd_ps(a[2], _mm256_permute_ps(bb, 0xAA), r);
+            r = _mm256_fmadd_ps(a[3], _mm256_permute_ps(bb, 0xFF), r);
+            _mm256_storeu_ps(out + 4 * j, r);
+        }
+    }
+
+    inline void loadMat4Avx(const float* m, __m256 cols[4])
+    {
+        for (int i = 0; i < 4; i++)
+            cols[i] = dup128(_mm_loadu_ps(m + 4 * i));
+    }
+
+#endif
+}
+
+const char* batchMathPath()
+{
+#if BATCH_MATH_AVX2
+    return "avx2";
+#elif BATCH_MATH_SSE2
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+void mulMat4Batch(const glm::mat4& lhs, const glm::mat4* in, glm::mat4* out, size_t count)
+{
+#if BATCH_MATH_AVX2
+    __m256 a[4];
+    loadMat4Avx(glm::value_ptr(lhs), a);
+    for (size_t i = 0; i < count; i++)
+        mulMat4Avx(a, glm::value_ptr(in[i]), glm::value_ptr(out[i]));
+#elif BATCH_MATH_SSE2
+    __m128 a[4];
+    loadMat4Sse(glm::value_ptr(lhs), a);
+    for (size_t i = 0; i < count; i++)
+        mulMat4Sse(a, glm::value_ptr(in[i]), glm::value_ptr(out[i]));
+#else
+    for (size_t i = 0; i < count; i++)
+        out[i] = lhs * in[i];
+#endif
+}
+
+void mulMat4PairBatch(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+#if BATCH_MATH_AVX2
+        __m256 cols[4];
+        loadMat4Avx(glm::value_ptr(a[i]), cols);
+        mulMat4Avx(cols, glm::value_ptr(b[i]), glm::value_ptr(out[i]));
+#elif BATCH_MATH_SSE2
+        __m128 cols[4];
+        loadMat4Sse(glm::value_ptr(a[i]), cols);
+        mulMat4Sse(cols, glm::value_ptr(b[i]), glm::value_ptr(out[i]));
+#else
+        out[i] = a[i] * b[i];
+#endif
+    }
+}
+
+void composeTRSBatch(const glm::vec3* position, const glm::quat* rotation, const glm::vec3* scale,
+    glm::mat4* out, size_t count)
+{
+    size_t i = 0;
+#if BATCH_MATH_SSE2
+    for (; i + 4 <= count; i += 4)
+        composeTRS4Sse(position + i, rotation + i, scale + i, glm::value_ptr(out[i]));
+#endif
+    for (; i < count; i++)
+        out[i] = composeTRS(position[i], rotation[i], scale[i]);
+}
+
+void normalMatrixBatch(const glm::mat4* model, glm::mat3* out, size_t count)
+{
+    size_t i = 0;
+#if BATCH_MATH_SSE2
+    // columns of inverse(M)^T are the cross products of the other two columns over det
+    for (; i < count; i++)
+    {
+        const float* m = glm::value_ptr(model[i]);
+        __m128 c0 = _mm_loadu_ps(m);
+        __m128 c1 = _mm_loadu_ps(m + 4);
+        __m128 c2 = _mm_loadu_ps(m + 8);
+        __m128 r0 = cross3(c1, c2);
+        __m128 r1 = cross3(c2, c0);
+        __m128 r2 = cross3(c0, c1);
+        __m128 d = _mm_mul_ps(c0, r0);
+        float det = _mm_cvtss_f32(d) + _mm_cvtss_f32(_mm_shuffle_ps(d, d, 1)) +
+            _mm_cvtss_f32(_mm_shuffle_ps(d, d, 2));
+        __m128 invDet = _mm_set1_ps(1.0f / det);
+        float* dst = glm::value_ptr(out[i]);
+        float last[4];
+        // the 4th lane of the first two stores is overwritten by the next column
+        _mm_storeu_ps(dst, _mm_mul_ps(r0, invDet));
+        _mm_storeu_ps(last, _mm_mul_ps(r2, invDet));
+        _mm_storeu_ps(dst + 3, _mm_mul_ps(r1, invDet));
+        dst[6] = last[0];
+        dst[7] = last[1];
+        dst[8] = last[2];
+    }
+#endif
+    for (; i < count; i++)
+        out[i] = glm::transpose(glm::inverse(glm::mat3(model[i])));
+}
+
+void composeMVPBatch(const glm::mat4& viewProjection,
+    const glm::vec3* position, const glm::quat* rotation, const glm::vec3* scale,
+    glm::mat4* model, glm::mat4* mvp, size_t count)
+{
+    // compose into a small stack block so the model matrices are still in L1 for the multiply
+    const size_t block = 64;
+    glm::mat4 local[block];
+    for (size_t begin = 0; begin < count; begin += block)
+    {
+        size_t n = count - begin < block ? count - begin : block;
+        glm::mat4* models = model ? model + begin : local;
+        composeTRSBatch(position + begin, rotation + begin, scale + begin, models, n);
+        mulMat4Batch(viewProjection, models, mvp + begin, n);
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstddef>
+
+// Array kernels for the per-object matrix work of a frame.
+// Compiled with AVX2 (+FMA) or SSE2 paths depending on the target flags
+// (see BATCH_MATH_AVX2 in CMakeLists.txt), scalar glm otherwise.
+// Inputs and outputs may be unaligned; out must not alias the inputs.
+
+// Name of the code path the library was compiled with: "avx2", "sse2" or "scalar"
+const char* batchMathPath();
+
+// out[i] = lhs * in[i]
+void mulMat4Batch(const glm::mat4& lhs, const glm::mat4* in, glm::mat4* out, size_t count);
+
+// out[i] = a[i] * b[i]
+void mulMat4PairBatch(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count);
+
+// out[i] = T(position[i]) * R(rotation[i]) * S(scale[i])
+void composeTRSBatch(const glm::vec3* position, const glm::quat* rotation, const glm::vec3* scale,
+    glm::mat4* out, size_t count);
+
+// out[i] = transpose(inverse(mat3(model[i])))
+void normalMatrixBatch(const glm::mat4* model, glm::mat3* out, size_t count);
+
+// One pass over the objects of a frame: model[i] = TRS, mvp[i] = viewProjection * model[i].
+// model may be nullptr when only the MVPs are needed.
+void composeMVPBatch(const glm::mat4& viewProjection,
+    const glm::vec3* position, const glm::quat* rotation, const glm::vec3* scale,
+    glm::mat4* model, glm::mat4* mvp, size_t count);
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+// Small helpers shared by the benchmark programs under src/benchmarks
+
+class Timer
+{
+public:
+    Timer() { reset(); }
+    void reset() { start = std::chrono::steady_clock::now(); }
+    double seconds() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    double milliseconds() const { return seconds() * 1000.0; }
+
+private:
+    std::chrono::steady_clock::time_point start;
+};
+
+// Peak resident set size of the process in bytes (0 if unsupported)
+size_t peakMemoryBytes();
+
+// Current resident set size of the process in bytes (0 if unsupported)
+size_t currentMemoryBytes();
+
+inline double toMB(size_t bytes) { return bytes / (1024.0 * 1024.0); }
@@ -0,0 +1,133 @@
+#include "microBench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+MicroBench::MicroBench(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--filter") && i + 1 < argc)
+            filter = argv[++i];
+        else if (!strcmp(argv[i], "--samples") && i + 1 < argc)
+            sampleNum = std::max(atoi(argv[++i]), 3);
+        else if (!strcmp(argv[i], "--min-time") && i + 1 < argc)
+            minTimeMs = std::max(atof(argv[++i]), 0.1);
+        else if (!strcmp(argv[i], "--json") && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (!strcmp(argv[i], "--baseline") && i + 1 < argc)
+            baselinePath = argv[++i];
+    }
+    if (!baselinePath.empty())
+        loadBaseline(baselinePath.c_str(), baseline);
+    printf("%-40s %12s %8s %12s %10s\n", "benchmark", "median", "mad", "min", baseline.empty() ? "" : "speedup");
+}
+
+bool MicroBench::enabled(const std::string& name) const
+{
+    return filter.empty() || name.find(filter) != std::string::npos;
+}
+
+void MicroBench::record(const std::string& name, size_t iterations, std::vector<double>& times, double bytesPerOp)
+{
+    Result r;
+    r.name = name;
+    r.iterations = iterations;
+    r.samples = (int)times.size();
+    r.bytesPerOp = bytesPerOp;
+
+    double sum = 0.0;
+    for (double t : times)
+        sum += t;
+    r.meanNs = sum / times.size();
+    double var = 0.0;
+    for (double t : times)
+        var += (t - r.meanNs) * (t - r.meanNs);
+    r.stddevNs = std::sqrt(var / times.size());
+    std::sort(times.begin(), times.end());
+    r.minNs = times.front();
+    r.maxNs = times.back();
+    r.medianNs = times[times.size() / 2];
+    std::vector<double> deviation(times.size());
+    for (size_t i = 0; i < times.size(); i++)
+        deviation[i] = std::fabs(times[i] - r.medianNs);
+    std::sort(deviation.begin(), deviation.end());
+    r.madNs = deviation[deviation.size() / 2];
+    resultList.push_back(r);
+
+    char median[32], minimum[32], extra[64] = "";
+    auto format = [](char* out, double ns) {
+        if (ns < 1e3)
+            snprintf(out, 32, "%.2f ns", ns);
+        else if (ns < 1e6)
+            snprintf(out, 32, "%.2f us", ns * 1e-3);
+        else
+            snprintf(out, 32, "%.2f ms", ns * 1e-6);
+    };
+    format(median, r.medianNs);
+    format(minimum, r.minNs);
+    auto it = baseline.find(name);
+    if (it != baseline.end())
+        snprintf(extra, sizeof(extra), "%9.2fx", it->second / r.medianNs);
+    if (bytesPerOp > 0.0)
+        snprintf(extra + strlen(extra), sizeof(extra) - strlen(extra), "  %9.1f MB/s", bytesPerOp / r.medianNs * 1e3);
+    printf("%-40s %12s %7.1f%% %12s %s\n", name.c_str(), median, r.madNs / r.medianNs * 100.0, minimum, extra);
+    fflush(stdout);
+}
+
+int MicroBench::finish()
+{
+    if (!jsonPath.empty() && !writeJson(jsonPath.c_str()))
+        return 1;
+    return 0;
+}
+
+bool MicroBench::writeJson(const char* filename) const
+{
+    FILE* f = fopen(filename, "w");
+    if (!f)
+    {
+        printf("ERROR: Cannot write \"%s\".\n", filename);
+        return false;
+    }
+    fprintf(f, "{\n  \"tags\": {");
+    bool first = true;
+    for (const auto& kv : tags)
+    {
+        fprintf(f, "%s\"%s\": \"%s\"", first ? " " : ", ", kv.first.c_str(), kv.second.c_str());
+        first = false;
+    }
+    fprintf(f, " },\n  \"results\": [\n");
+    // one result per line, loadBaseline() relies on it
+    for (size_t i = 0; i < resultList.size(); i++)
+    {
+        const Result& r = resultList[i];
+        fprintf(f, "    { \"name\": \"%s\", \"median_ns\": %.4f, \"mad_ns\": %.4f, \"mean_ns\": %.4f, \"stddev_ns\": %.4f, "
+            "\"min_ns\": %.4f, \"max_ns\": %.4f, \"iterations\": %zu, \"samples\": %d, \"bytes_per_op\": %.1f }%s\n",
+            r.name.c_str(), r.medianNs, r.madNs, r.meanNs, r.stddevNs, r.minNs, r.maxNs, r.iterations, r.samples, r.bytesPerOp,
+            i + 1 < resultList.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+}
+
+bool MicroBench::loadBaseline(const char* filename, std::map<std::string, double>& medians)
+{
+    FILE* f = fopen(filename, "r");
+    if (!f)
+    {
+        printf("ERROR: Cannot open baseline \"%s\".\n", filename);
+        return false;
+    }
+    char line[1024], name[512];
+    double median;
+    while (fgets(line, sizeof(line), f))
+        if (sscanf(line, " { \"name\": \"%511[^\"]\", \"median_ns\": %lf", name, &median) == 2)
+            medians[name] = median;
+    fclose(f);
+    return true;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "benchUtils.h"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+// Keep a value alive so the optimizer cannot drop the computation producing it
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Statistical microbenchmark runner.
+//
+//     MicroBench bench(argc, argv);
+//     bench.run("glm/mat4*mat4", [&](size_t n) { for (size_t i = 0; i < n; i++) ... });
+//     return bench.finish();
+//
+// Each case is calibrated to an iteration count that fills the per-sample time budget, then
+// timed for several samples. The median and the median absolute deviation are reported since
+// they hold up against the odd preempted sample, mean/stddev/min/max are kept in the JSON.
+//
+// Options: --filter substring, --samples N, --min-time ms (per sample),
+//          --json file, --baseline file.json (speedup against an earlier --json run)
+class MicroBench
+{
+public:
+    struct Result
+    {
+        std::string name;
+        size_t iterations;          // per sample
+        int samples;
+        double medianNs, madNs, meanNs, stddevNs, minNs, maxNs;     // per operation
+        double bytesPerOp;
+    };
+
+    MicroBench(int argc, char** argv);
+
+    // free form key/value pairs stored with the results, e.g. the build configuration
+    void setTag(const std::string& key, const std::string& value) { tags[key] = value; }
+
+    bool enabled(const std::string& name) const;
+
+    // fn(n) performs n operations; bytesPerOp > 0 adds a MB/s column
+    template<typename F>
+    void run(const std::string& name, F&& fn, double bytesPerOp = 0.0)
+    {
+        if (!enabled(name))
+            return;
+        size_t n = 1;
+        double budget = minTimeMs * 1e-3;
+        for (;;)
+        {
+            Timer timer;
+            fn(n);
+            double t = timer.seconds();
+            if (t >= budget || n >= ((size_t)1 << 40))
+                break;
+            // aim a bit past the budget, at most 100x growth per step
+            double scale = t > 0.0 ? budget * 1.2 / t : 100.0;
+            n = (size_t)(n * (scale < 2.0 ? 2.0 : scale > 100.0 ? 100.0 : scale));
+        }
+        std::vector<double> times(sampleNum);
+        for (int s = 0; s < sampleNum; s++)
+        {
+            Timer timer;
+            fn(n);
+            times[s] = timer.seconds() * 1e9 / n;
+        }
+        record(name, n, times, bytesPerOp);
+    }
+
+    const std::vector<Result>& results() const { return resultList; }
+
+    // prints the summary, writes JSON if requested; returns the process exit code
+    int finish();
+
+private:
+    void record(const std::string& name, size_t iterations, std::vector<double>& times, double bytesPerOp);
+    bool writeJson(const char* filename) const;
+    static bool loadBaseline(const char* filename, std::map<std::string, double>& medians);
+
+    std::string filter;
+    int sampleNum = 15;
+    double minTimeMs = 20.0;
+    std::string jsonPath;
+    std::string baselinePath;
+    std::map<std::string, double> baseline;
+    std::map<std::string, std::string> tags;
+    std::vector<Result> resultList;
+};
@@ -0,0 +1,233 @@
+#include "videoCapture.h"
+#include "yuvConvert.h"
+
+#include <glad/glad.h>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+namespace
+{
+    typedef chrono::steady_clock Clock;
+
+    double millisecondsSince(Clock::time_point start)
+    {
+        return chrono::duration<double, milli>(Clock::now() - start).count();
+    }
+}
+
+VideoCapture::VideoCapture(int ringSize)
+    : ringSize(ringSize < 2 ? 2 : ringSize), slots(ringSize < 2 ? 2 : ringSize)
+{
+}
+
+VideoCapture::~VideoCapture()
+{
+    if (recording())
+        stop();
+}
+
+bool VideoCapture::start(const char* filename, int w, int h, int fps)
+{
+    if (recording())
+        stop();
+    width = w & ~1;
+    height = h & ~1;
+    if (width <= 0 || height <= 0)
+    {
+        cout << "ERROR: Cannot capture a " << w << "x" << h << " framebuffer.\n";
+        return false;
+    }
+    file = fopen(filename, "wb");
+    if (!file)
+    {
+        cout << "ERROR: Cannot write video \"" << filename << "\".\n";
+        return false;
+    }
+    const char* dot = strrchr(filename, '.');
+    y4m = dot && !strcmp(dot, ".y4m");
+    if (y4m)
+        fprintf(file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg XYSCSS=420JPEG XCOLORRANGE=LIMITED\n", width, height, fps);
+
+    size_t frameBytes = (size_t)width * height * 4;
+    for (Slot& slot : slots)
+    {
+        glGenBuffers(1, &slot.pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, frameBytes, NULL, GL_STREAM_READ);
+        slot.state = Free;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    yuv.resize((size_t)width * height * 3 / 2);
+    next = 0;
+    captured = dropped = 0;
+    written = 0;
+    writeFailed = false;
+    captureTotalMs = convertTotalMs = writeTotalMs = 0.0;
+    stopping = false;
+    worker = thread(&VideoCapture::workerLoop, this);
+    return true;
+}
+
+void VideoCapture::capture(unsigned int framebuffer)
+{
+    if (!recording())
+        return;
+    Clock::time_point start = Clock::now();
+    poll(false);
+
+    Slot& slot = slots[next];
+    if (slot.state != Free)
+    {
+        dropped++;
+        captureTotalMs += millisecondsSince(start);
+        return;
+    }
+
+    GLint previousRead = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousRead);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glReadBuffer(framebuffer ? GL_COLOR_ATTACHMENT0 : GL_BACK);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, previousRead);
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.state = Reading;
+    reading.push_back(next);
+    next = (next + 1) % ringSize;
+    captured++;
+    captureTotalMs += millisecondsSince(start);
+}
+
+void VideoCapture::poll(bool wait)
+{
+    size_t frameBytes = (size_t)width * height * 4;
+    for (Slot& slot : slots)
+    {
+        if (slot.state.load(memory_order_acquire) == Converted)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            slot.mapped = nullptr;
+            slot.state = Free;
+        }
+    }
+
+    // frames must reach the file in order, so stop at the first fence still pending
+    while (!reading.empty())
+    {
+        Slot& slot = slots[reading.front()];
+        GLenum status = glClientWaitSync((GLsync)slot.fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+            wait ? 1000000000ull : 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            break;
+        glDeleteSync((GLsync)slot.fence);
+        slot.fence = nullptr;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        slot.mapped = (const unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frameBytes, GL_MAP_READ_BIT);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        int index = reading.front();
+        reading.pop_front();
+        if (!slot.mapped)
+        {
+            slot.state = Free;
+            dropped++;
+            continue;
+        }
+        slot.state = Converting;
+        lock_guard<std::mutex> lock(mutex);
+        converting.push_back(index);
+        ready.notify_one();
+    }
+}
+
+void VideoCapture::workerLoop()
+{
+    size_t lumaBytes = (size_t)width * height;
+    while (true)
+    {
+        int index;
+        {
+            unique_lock<std::mutex> lock(mutex);
+            ready.wait(lock, [&] { return stopping || !converting.empty(); });
+            if (converting.empty())
+                return;
+            index = converting.front();
+            converting.pop_front();
+        }
+        Slot& slot = slots[index];
+        Clock::time_point start = Clock::now();
+        rgbaToYuv420(slot.mapped, width, height, (size_t)width * 4, true,
+            yuv.data(), yuv.data() + lumaBytes, yuv.data() + lumaBytes + lumaBytes / 4);
+        // the PBO goes back to the render thread before the (possibly slow) disk write
+        slot.state.store(Converted, memory_order_release);
+        convertTotalMs += millisecondsSince(start);
+
+        start = Clock::now();
+        bool ok = !y4m || fputs("FRAME\n", file) >= 0;
+        ok = ok && fwrite(yuv.data(), 1, yuv.size(), file) == yuv.size();
+        if (!ok)
+            writeFailed = true;
+        else
+            written++;
+        writeTotalMs += millisecondsSince(start);
+    }
+}
+
+void VideoCapture::stop()
+{
+    if (!recording())
+        return;
+    // block on the remaining fences, then let the worker drain its queue
+    while (true)
+    {
+        poll(true);
+        if (!reading.empty())
+        {
+            // the oldest fence did not signal within poll's wait: the GPU is lost or hung,
+            // waiting longer would never return
+            cout << "WARNING: Video capture dropped " << reading.size() << " frames the GPU never finished.\n";
+            for (int index : reading)
+            {
+                glDeleteSync((GLsync)slots[index].fence);
+                slots[index].fence = nullptr;
+                slots[index].state = Free;
+                dropped++;
+            }
+            reading.clear();
+        }
+        bool busy = false;
+        for (Slot& slot : slots)
+            busy = busy || slot.state != Free;
+        if (!busy)
+            break;
+        this_thread::yield();
+    }
+    {
+        lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        ready.notify_one();
+    }
+    worker.join();
+    fclose(file);
+    file = NULL;
+    for (Slot& slot : slots)
+        glDeleteBuffers(1, &slot.pbo);
+    if (writeFailed)
+        cout << "ERROR: Writing the video failed, the disk may be full.\n";
+}
+
+void VideoCapture::print() const
+{
+    uint64_t n = written.load();
+    printf("capture: %llu frames %dx%d, %llu written, %llu dropped\n",
+        (unsigned long long)captured, width, height, (unsigned long long)n, (unsigned long long)dropped);
+    if (captured)
+        printf("  render thread %.3f ms/frame, worker convert %.2f ms (%s) + write %.2f ms per frame\n",
+            captureTotalMs / captured, n ? convertTotalMs / n : 0.0, yuvConvertPath(), n ? writeTotalMs / n : 0.0);
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Records the rendered frames to a Y4M (".y4m") or raw I420 (any other extension) file.
+// All GL calls happen on the render thread and none of them waits for the GPU:
+//
+//     capture.start("out.y4m", width, height, 60);    // render thread, context current
+//     ... draw ...
+//     capture.capture();                              // before the swap, reads the back buffer
+//     swap buffers
+//     capture.stop();                                 // drains what is still in flight
+//
+// Each frame is read into one PBO of a ring behind a fence. Later calls map the PBOs whose
+// fence has signaled and hand the mapped memory to a worker thread, which converts it to
+// YUV 4:2:0 and writes it out; the render thread unmaps the PBO once the worker is done.
+// When every PBO is still in flight (GPU or disk too slow) the frame is dropped, never waited for,
+// so memory stays at 'ringSize' RGBA frames plus one YUV frame.
+class VideoCapture
+{
+public:
+    explicit VideoCapture(int ringSize = 4);
+    ~VideoCapture();
+
+    VideoCapture(const VideoCapture&) = delete;
+    VideoCapture& operator=(const VideoCapture&) = delete;
+
+    // width and height are rounded down to even sizes
+    bool start(const char* filename, int width, int height, int fps);
+    bool recording() const { return file != NULL; }
+
+    // Queue a readback of the lower left width x height pixels of 'framebuffer' (0: back buffer)
+    void capture(unsigned int framebuffer = 0);
+
+    // Wait for in-flight frames, finish the file and release the GL objects
+    void stop();
+
+    uint64_t capturedNum() const { return captured; }
+    uint64_t writtenNum() const { return written.load(); }
+    uint64_t droppedNum() const { return dropped; }
+    // render thread time spent in capture(), the only cost the frame loop sees
+    double captureMs() const { return captureTotalMs; }
+    // worker time, read after stop()
+    double convertMs() const { return convertTotalMs; }
+    double writeMs() const { return writeTotalMs; }
+
+    void print() const;
+
+private:
+    enum SlotState
+    {
+        Free,
+        Reading,        // readback queued, fence pending
+        Converting,     // mapped, owned by the worker
+        Converted,      // worker done, waiting to be unmapped
+    };
+
+    struct Slot
+    {
+        unsigned int pbo = 0;
+        void* fence = nullptr;
+        const unsigned char* mapped = nullptr;
+        std::atomic<int> state{ Free };
+    };
+
+    // unmap finished slots and hand signaled ones to the worker, oldest first;
+    // 'wait' blocks on the oldest fence instead of polling it
+    void poll(bool wait);
+    void workerLoop();
+
+    int ringSize;
+    std::vector<Slot> slots;
+    std::deque<int> reading;        // slots in readback order
+    int next = 0;
+    int width = 0, height = 0;
+    bool y4m = false;
+    FILE* file = NULL;
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<int> converting;
+    bool stopping = false;
+    std::vector<unsigned char> yuv;
+
+    uint64_t captured = 0, dropped = 0;
+    std::atomic<uint64_t> written{ 0 };
+    std::atomic<bool> writeFailed{ false };
+    double captureTotalMs = 0.0;
+    double convertTotalMs = 0.0;
+    double writeTotalMs = 0.0;
+};
@@ -0,0 +1,154 @@
+#include "yuvConvert.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define YUV_CONVERT_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Fixed point BT.601, 8 fractional bits:
+//   Y = ( 66 R + 129 G +  25 B + 128) >> 8 + 16
+//   U = (-38 R -  74 G + 112 B + 128) >> 8 + 128
+//   V = (112 R -  94 G -  18 B + 128) >> 8 + 128
+// Chroma is computed from the sum of the 2x2 block, hence >> 10 and a rounding term of 512.
+
+namespace
+{
+    inline unsigned char clampByte(int v)
+    {
+        return (unsigned char)(v < 0 ? 0 : v > 255 ? 255 : v);
+    }
+
+    inline const unsigned char* sourceRow(const unsigned char* rgba, int height, size_t rowStride, bool bottomUp, int row)
+    {
+        return rgba + (bottomUp ? height - 1 - row : row) * rowStride;
+    }
+
+    // pixels [x0, x1) of one pair of rows
+    void convertRowPairScalar(const unsigned char* r0, const unsigned char* r1, int x0, int x1,
+        unsigned char* y0, unsigned char* y1, unsigned char* u, unsigned char* v)
+    {
+        for (int x = x0; x < x1; x += 2)
+        {
+            const unsigned char* p[4] = { r0 + x * 4, r0 + x * 4 + 4, r1 + x * 4, r1 + x * 4 + 4 };
+            unsigned char* dst[4] = { y0 + x, y0 + x + 1, y1 + x, y1 + x + 1 };
+            int r = 0, g = 0, b = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                *dst[i] = clampByte(((66 * p[i][0] + 129 * p[i][1] + 25 * p[i][2] + 128) >> 8) + 16);
+                r += p[i][0];
+                g += p[i][1];
+                b += p[i][2];
+            }
+            u[x / 2] = clampByte(((-38 * r - 74 * g + 112 * b + 512) >> 10) + 128);
+            v[x / 2] = clampByte(((112 * r - 94 * g - 18 * b + 512) >> 10) + 128);
+        }
+    }
+
+#if YUV_CONVERT_SSE2
+    // four Y values from four RGBA pixels
+    inline __m128i lumaX4(__m128i px, __m128i coef)
+    {
+        __m128i zero = _mm_setzero_si128();
+        __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(px, zero), coef);     // [66r+129g, 25b] x 2 pixels
+        __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(px, zero), coef);
+        __m128i even = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi), _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128i odd = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi), _MM_SHUFFLE(3, 1, 3, 1)));
+        __m128i sum = _mm_add_epi32(_mm_add_epi32(even, odd), _mm_set1_epi32(128));
+        return _mm_add_epi32(_mm_srai_epi32(sum, 8), _mm_set1_epi32(16));
+    }
+
+    // two chroma values from the two 2x2 blocks summed in 'blocks' (int16 RGBA sums, one block per 64 bits)
+    inline __m128i chromaX2(__m128i blocks, __m128i coef)
+    {
+        __m128i m = _mm_madd_epi16(blocks, coef);
+        __m128i sum = _mm_add_epi32(_mm_add_epi32(m, _mm_srli_si128(m, 4)), _mm_set1_epi32(512));
+        sum = _mm_add_epi32(_mm_srai_epi32(sum, 10), _mm_set1_epi32(128));
+        return _mm_shuffle_epi32(sum, _MM_SHUFFLE(3, 1, 2, 0));     // results in lanes 0 and 1
+    }
+
+    inline void store4(unsigned char* dst, __m128i values)
+    {
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(values, values), _mm_setzero_si128());
+        int bytes = _mm_cvtsi128_si32(packed);
+        dst[0] = (unsigned char)bytes;
+        dst[1] = (unsigned char)(bytes >> 8);
+        dst[2] = (unsigned char)(bytes >> 16);
+        dst[3] = (unsigned char)(bytes >> 24);
+    }
+
+    inline void store2(unsigned char* dst, __m128i values)
+    {
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(values, values), _mm_setzero_si128());
+        int bytes = _mm_cvtsi128_si32(packed);
+        dst[0] = (unsigned char)bytes;
+        dst[1] = (unsigned char)(bytes >> 8);
+    }
+
+    // four pixels (two chroma samples) of a row pair per iteration
+    int convertRowPairSSE2(const unsigned char* r0, const unsigned char* r1, int width,
+        unsigned char* y0, unsigned char* y1, unsigned char* u, unsigned char* v)
+    {
+        const __m128i coefY = _mm_setr_epi16(66, 129, 25, 0, 66, 129, 25, 0);
+        const __m128i coefU = _mm_setr_epi16(-38, -74, 112, 0, -38, -74, 112, 0);
+        const __m128i coefV = _mm_setr_epi16(112, -94, -18, 0, 112, -94, -18, 0);
+        const __m128i zero = _mm_setzero_si128();
+        int x = 0;
+        for (; x + 4 <= width; x += 4)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i*)(r0 + x * 4));
+            __m128i b = _mm_loadu_si128((const __m128i*)(r1 + x * 4));
+            store4(y0 + x, lumaX4(a, coefY));
+            store4(y1 + x, lumaX4(b, coefY));
+
+            __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+            __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+            lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+            hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+            __m128i blocks = _mm_unpacklo_epi64(lo, hi);
+            store2(u + x / 2, chromaX2(blocks, coefU));
+            store2(v + x / 2, chromaX2(blocks, coefV));
+        }
+        return x;
+    }
+#endif
+}
+
+void rgbaToYuv420Scalar(const unsigned char* rgba, int width, int height, size_t rowStride, bool bottomUp,
+    unsigned char* y, unsigned char* u, unsigned char* v)
+{
+    for (int row = 0; row + 1 < height; row += 2)
+    {
+        convertRowPairScalar(
+            sourceRow(rgba, height, rowStride, bottomUp, row), sourceRow(rgba, height, rowStride, bottomUp, row + 1),
+            0, width, y + row * width, y + (row + 1) * width, u + row / 2 * (width / 2), v + row / 2 * (width / 2));
+    }
+}
+
+void rgbaToYuv420(const unsigned char* rgba, int width, int height, size_t rowStride, bool bottomUp,
+    unsigned char* y, unsigned char* u, unsigned char* v)
+{
+#if YUV_CONVERT_SSE2
+    for (int row = 0; row + 1 < height; row += 2)
+    {
+        const unsigned char* r0 = sourceRow(rgba, height, rowStride, bottomUp, row);
+        const unsigned char* r1 = sourceRow(rgba, height, rowStride, bottomUp, row + 1);
+        unsigned char* y0 = y + row * width;
+        unsigned char* y1 = y0 + width;
+        unsigned char* uRow = u + row / 2 * (width / 2);
+        unsigned char* vRow = v + row / 2 * (width / 2);
+        int done = convertRowPairSSE2(r0, r1, width, y0, y1, uRow, vRow);
+        convertRowPairScalar(r0, r1, done, width, y0, y1, uRow, vRow);
+    }
+#else
+    rgbaToYuv420Scalar(rgba, width, height, rowStride, bottomUp, y, u, v);
+#endif
+}
+
+const char* yuvConvertPath()
+{
+#if YUV_CONVERT_SSE2
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
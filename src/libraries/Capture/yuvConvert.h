@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+// RGBA (8 bits per channel) to planar YUV 4:2:0, BT.601 limited range,
+// each chroma sample the average of a 2x2 block (centered siting, Y4M "C420jpeg").
+// width and height must be even. rowStride is the distance between source rows in bytes;
+// bottomUp reads the source rows last to first, as glReadPixels returns them.
+// Output planes are tightly packed: y is width*height, u and v are (width/2)*(height/2).
+void rgbaToYuv420(const unsigned char* rgba, int width, int height, size_t rowStride, bool bottomUp,
+    unsigned char* y, unsigned char* u, unsigned char* v);
+
+// Plain C++ version with bit-identical output, for comparison
+void rgbaToYuv420Scalar(const unsigned char* rgba, int width, int height, size_t rowStride, bool bottomUp,
+    unsigned char* y, unsigned char* u, unsigned char* v);
+
+// Name of the code path rgbaToYuv420 was compiled with: "sse2" or "scalar"
+const char* yuvConvertPath();
@@ -0,0 +1,273 @@
+#include "chapterBench.h"
+
+#include <glad/glad.h>
+#include <glHooks.h>
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    const double kFrameStep = 1.0 / 60.0;
+    const int kQueryRing = 8;
+
+    //------- draw counting -------
+    // GLAD calls through function pointers; benchmark mode swaps the draw entry points for
+    // counting trampolines, so chapters need no per-draw instrumentation
+    PFNGLDRAWARRAYSPROC realDrawArrays;
+    PFNGLDRAWELEMENTSPROC realDrawElements;
+    PFNGLDRAWARRAYSINSTANCEDPROC realDrawArraysInstanced;
+    PFNGLDRAWELEMENTSINSTANCEDPROC realDrawElementsInstanced;
+    unsigned long long drawCount = 0;
+    unsigned long long vertexCount = 0;
+
+    void APIENTRY countDrawArrays(GLenum mode, GLint first, GLsizei count)
+    {
+        drawCount++;
+        vertexCount += count;
+        realDrawArrays(mode, first, count);
+    }
+
+    void APIENTRY countDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+    {
+        drawCount++;
+        vertexCount += count;
+        realDrawElements(mode, count, type, indices);
+    }
+
+    void APIENTRY countDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instances)
+    {
+        drawCount++;
+        vertexCount += (unsigned long long)count * instances;
+        realDrawArraysInstanced(mode, first, count, instances);
+    }
+
+    void APIENTRY countDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instances)
+    {
+        drawCount++;
+        vertexCount += (unsigned long long)count * instances;
+        realDrawElementsInstanced(mode, count, type, indices, instances);
+    }
+}
+
+bool ChapterBench::init(int argc, char** argv, const char* targetName)
+{
+    target = targetName;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--benchmark"))
+            enabled = true;
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = std::max(atoi(argv[++i]), 1);
+        else if (!strcmp(argv[i], "--warmup") && i + 1 < argc)
+            warmup = std::max(atoi(argv[++i]), 0);
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+            outPath = argv[++i];
+    }
+    if (!enabled)
+        return false;
+    if (outPath.empty())
+        outPath = "bench_" + target + ".json";
+    cpuMs.reserve(frames);
+    gpuMs.reserve(frames);
+    draws.reserve(frames);
+    vertices.reserve(frames);
+    return true;
+}
+
+bool ChapterBench::createContext(int width, int height)
+{
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    ContextDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.visible = false;
+    desc.vsync = false;
+    context = GLContext::create(backend, desc);
+    if (!context || !offscreen.create(width, height))
+        return false;
+    // the chapters never bind a framebuffer, everything they draw lands in the offscreen target
+    offscreen.bind();
+    printf("%s: benchmarking on the %s context\n", target.c_str(), contextBackendName(backend));
+    return true;
+}
+
+void ChapterBench::setup()
+{
+    if (!enabled)
+        return;
+    const GLubyte* name = glGetString(GL_RENDERER);
+    renderer = name ? (const char*)name : "unknown";
+
+    glHookIn(glad_glDrawArrays, glad_debug_glDrawArrays, realDrawArrays, countDrawArrays);
+    glHookIn(glad_glDrawElements, glad_debug_glDrawElements, realDrawElements, countDrawElements);
+    glHookIn(glad_glDrawArraysInstanced, glad_debug_glDrawArraysInstanced, realDrawArraysInstanced, countDrawArraysInstanced);
+    glHookIn(glad_glDrawElementsInstanced, glad_debug_glDrawElementsInstanced, realDrawElementsInstanced, countDrawElementsInstanced);
+
+    queries.resize(kQueryRing);
+    queryFrame.assign(kQueryRing, -1);
+    glGenQueries(kQueryRing, queries.data());
+}
+
+bool ChapterBench::running(GLFWwindow* window) const
+{
+    return enabled ? !finished : !glfwWindowShouldClose(window);
+}
+
+void ChapterBench::present(GLFWwindow* window)
+{
+    if (!window)
+        return;
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+}
+
+double ChapterBench::time() const
+{
+    return enabled ? frame * kFrameStep : glfwGetTime();
+}
+
+void ChapterBench::cameraPose(glm::vec3& position, glm::vec3& front) const
+{
+    if (!enabled)
+        return;
+    // slow orbit around the scene with some height change, always looking at its center
+    double t = time();
+    float radius = 6.0f + 2.0f * (float)std::sin(t * 0.5);
+    position = glm::vec3(radius * (float)std::sin(t * 0.4), 1.5f * (float)std::sin(t * 0.3), radius * (float)std::cos(t * 0.4) - 4.0f);
+    front = glm::normalize(glm::vec3(0.0f, 0.0f, -4.0f) - position);
+}
+
+void ChapterBench::beginFrame()
+{
+    if (!enabled)
+        return;
+    frameTimer.reset();
+    drawCount = vertexCount = 0;
+    int slot = frame % kQueryRing;
+    if (queryFrame[slot] >= 0)
+        resolveGpu(true);
+    queryFrame[slot] = frame;
+    glBeginQuery(GL_TIME_ELAPSED, queries[slot]);
+}
+
+void ChapterBench::resolveGpu(bool wait)
+{
+    // oldest first so results land in frame order; with wait, block for the oldest one only
+    for (;;)
+    {
+        int slot = -1;
+        for (int i = 0; i < kQueryRing; i++)
+            if (queryFrame[i] >= 0 && (slot < 0 || queryFrame[i] < queryFrame[slot]))
+                slot = i;
+        if (slot < 0)
+            return;
+        if (!wait)
+        {
+            GLint available = 0;
+            glGetQueryObjectiv(queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                return;
+        }
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &ns);
+        if (queryFrame[slot] >= warmup)
+            gpuMs.push_back((float)(ns * 1e-6));
+        queryFrame[slot] = -1;
+        if (wait)
+            return;
+    }
+}
+
+void ChapterBench::endFrame()
+{
+    if (!enabled)
+        return;
+    glEndQuery(GL_TIME_ELAPSED);
+    if (frame >= warmup)
+    {
+        cpuMs.push_back((float)frameTimer.milliseconds());
+        draws.push_back(drawCount);
+        vertices.push_back(vertexCount);
+    }
+    resolveGpu(false);
+    frame++;
+    if (frame < warmup + frames)
+        return;
+
+    for (int i = 0; i < kQueryRing; i++)
+        resolveGpu(true);
+    writeJson();
+    glDeleteQueries(kQueryRing, queries.data());
+    offscreen.destroy();
+    context.reset();
+    finished = true;
+}
+
+ChapterBench::Summary ChapterBench::summarize(std::vector<float> values)
+{
+    Summary s = { 0, 0, 0, 0, 0 };
+    if (values.empty())
+        return s;
+    std::sort(values.begin(), values.end());
+    double sum = 0.0;
+    for (float v : values)
+        sum += v;
+    auto at = [&](double p) { return values[std::min(values.size() - 1, (size_t)(p * (values.size() - 1) + 0.5))]; };
+    s.mean = sum / values.size();
+    s.p50 = at(0.5);
+    s.p90 = at(0.9);
+    s.p99 = at(0.99);
+    s.max = values.back();
+    return s;
+}
+
+bool ChapterBench::writeJson() const
+{
+    FILE* f = fopen(outPath.c_str(), "w");
+    if (!f)
+    {
+        printf("ERROR: Cannot write benchmark results \"%s\".\n", outPath.c_str());
+        return false;
+    }
+    Summary cpu = summarize(cpuMs);
+    Summary gpu = summarize(gpuMs);
+    double drawMean = 0.0, vertexMean = 0.0;
+    for (size_t i = 0; i < draws.size(); i++)
+    {
+        drawMean += draws[i];
+        vertexMean += vertices[i];
+    }
+    if (!draws.empty())
+    {
+        drawMean /= draws.size();
+        vertexMean /= draws.size();
+    }
+    std::string escapedRenderer;
+    for (char c : renderer)
+    {
+        if (c == '"' || c == '\\')
+            escapedRenderer += '\\';
+        escapedRenderer += c;
+    }
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"target\": \"%s\",\n", target.c_str());
+    fprintf(f, "  \"renderer\": \"%s\",\n", escapedRenderer.c_str());
+    fprintf(f, "  \"frames\": %d,\n  \"warmup\": %d,\n", frames, warmup);
+    fprintf(f, "  \"cpu_ms\": { \"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n",
+        cpu.mean, cpu.p50, cpu.p90, cpu.p99, cpu.max);
+    fprintf(f, "  \"gpu_ms\": { \"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n",
+        gpu.mean, gpu.p50, gpu.p90, gpu.p99, gpu.max);
+    fprintf(f, "  \"draws_per_frame\": %.2f,\n  \"vertices_per_frame\": %.2f,\n", drawMean, vertexMean);
+    fprintf(f, "  \"peak_memory_mb\": %.2f\n", toMB(peakMemoryBytes()));
+    fprintf(f, "}\n");
+    fclose(f);
+    printf("%s: cpu p50 %.3f ms p99 %.3f ms, gpu p50 %.3f ms p99 %.3f ms, %.0f draws/frame -> %s\n",
+        target.c_str(), cpu.p50, cpu.p99, gpu.p50, gpu.p99, drawMean, outPath.c_str());
+    return true;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <glContext.h>
+#include <renderTarget.h>
+#include <benchUtils.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct GLFWwindow;
+
+// Headless benchmark mode for the chapter executables.
+//
+//     chapter --benchmark [--frames N] [--warmup N] [--out file.json]
+//
+// There is no window: createContext() makes a headless GLContext (EGL surfaceless or OSMesa,
+// a hidden GLFW window when neither is compiled in) and binds an offscreen RenderTarget, so
+// the chapters run without a display or presenting. Time advances by a fixed 1/60 s per frame
+// and the camera follows a scripted orbit, so two runs render exactly the same frames.
+// After the last frame the CPU and GPU frame time percentiles, draw and vertex counts
+// and the peak resident memory are written to JSON and running() turns false.
+//
+//     ChapterBench bench;
+//     GLFWwindow* window = NULL;
+//     if (bench.init(argc, argv, "6_camera"))
+//         bench.createContext(800, 600);
+//     else
+//         ... create the window, load GLAD ...
+//     bench.setup();
+//     while (bench.running(window))
+//     {
+//         bench.beginFrame();
+//         ... input only with a window, draw ...
+//         bench.present(window);
+//         bench.endFrame();
+//     }
+//
+// Outside benchmark mode every call is a pass-through (time() returns glfwGetTime()).
+class ChapterBench
+{
+public:
+    // returns whether benchmark mode is on, the chapter then creates no window
+    bool init(int argc, char** argv, const char* targetName);
+    bool active() const { return enabled; }
+
+    // benchmark mode: the headless context, current with GLAD loaded and an offscreen target bound
+    bool createContext(int width, int height);
+
+    // after the context is current and GL is loaded
+    void setup();
+
+    // the loop condition: until the window is closed, in benchmark mode until the last frame
+    bool running(GLFWwindow* window) const;
+    // swap and poll events, nothing in benchmark mode
+    void present(GLFWwindow* window);
+
+    // seconds since start: scripted in benchmark mode, glfwGetTime() otherwise
+    double time() const;
+
+    // scripted camera at the current frame; leaves the arguments alone outside benchmark mode
+    void cameraPose(glm::vec3& position, glm::vec3& front) const;
+
+    // bracket the whole frame, endFrame() goes after present()
+    void beginFrame();
+    void endFrame();
+
+private:
+    struct Summary
+    {
+        double mean, p50, p90, p99, max;
+    };
+    static Summary summarize(std::vector<float> values);
+    void resolveGpu(bool wait);
+    bool writeJson() const;
+
+    bool enabled = false;
+    bool finished = false;
+    std::unique_ptr<GLContext> context;
+    RenderTarget offscreen;
+    std::string target;
+    std::string outPath;
+    int frames = 600;
+    int warmup = 60;
+    int frame = 0;
+    Timer frameTimer;
+
+    std::vector<float> cpuMs;
+    std::vector<float> gpuMs;
+    std::vector<unsigned> queries;
+    std::vector<int> queryFrame;    // frame of the query in each ring slot, -1 when free
+    std::vector<unsigned long long> draws;
+    std::vector<unsigned long long> vertices;
+    std::string renderer;
+};
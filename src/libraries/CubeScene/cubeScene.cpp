@@ -0,0 +1,194 @@
+#include "cubeScene.h"
+#include "cubeSceneData.h"
+
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <batchMath.h>
+#include <glDebug.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    const char* kShaderDir = "../src/1_gettingstarted/6_camera/shaders/";
+
+    bool readText(const string& filename, string& text)
+    {
+        ifstream f(filename);
+        if (!f.is_open())
+        {
+            cout << "ERROR: Cannot open GLSL program \"" << filename << "\".\n";
+            return false;
+        }
+        stringstream buf;
+        buf << f.rdbuf();
+        text = buf.str();
+        return true;
+    }
+
+    unsigned int compileShader(GLenum type, const string& filename)
+    {
+        string source;
+        if (!readText(filename, source))
+            return 0;
+        const char* text = source.c_str();
+        unsigned int shader = glCreateShader(type);
+        glShaderSource(shader, 1, &text, NULL);
+        glCompileShader(shader);
+        int success;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if (!success)
+        {
+            char infoLog[2048];
+            glGetShaderInfoLog(shader, sizeof(infoLog), NULL, infoLog);
+            cout << "ERROR: Compilation of \"" << filename << "\" failed.\n" << infoLog << endl;
+            glDeleteShader(shader);
+            return 0;
+        }
+        return shader;
+    }
+
+    unsigned int createTexture(GLenum unit, const unsigned char* rgb, int width, int height)
+    {
+        unsigned int texture;
+        glGenTextures(1, &texture);
+        glActiveTexture(unit);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, rgb));
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        return texture;
+    }
+}
+
+bool CubeScene::init(const char* textureDir)
+{
+    destroy();
+
+    //------- geometry -------
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, sizeof(kCubeVertices), kCubeVertices, GL_STATIC_DRAW));
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(2);
+    glGenBuffers(1, &ebo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kCubeIndices), kCubeIndices, GL_STATIC_DRAW));
+    glBindVertexArray(0);
+    GL_DEBUG_LABEL(GL_BUFFER, vbo, "CubeScene vertices");
+    GL_DEBUG_LABEL(GL_BUFFER, ebo, "CubeScene indices");
+
+    for (int i = 0; i < kCubeNum; i++)
+    {
+        positions[i] = kCubePositions[i];
+        rotations[i] = cubeRotation(i);
+        scales[i] = glm::vec3(1.0f);
+    }
+
+    //------- textures -------
+    for (int t = 0; t < 2; t++)
+    {
+        vector<unsigned char> rgb;
+        int width, height;
+        if (!loadCubeTexture(textureDir, t, rgb, width, height))
+            return false;
+        textures[t] = createTexture(GL_TEXTURE0 + t, rgb.data(), width, height);
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+
+    //------- program -------
+    unsigned int vertexShader = compileShader(GL_VERTEX_SHADER, string(kShaderDir) + "shaderMVP.vert");
+    unsigned int fragmentShader = compileShader(GL_FRAGMENT_SHADER, string(kShaderDir) + "shader.frag");
+    if (!vertexShader || !fragmentShader)
+        return false;
+    program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        char infoLog[2048];
+        glGetProgramInfoLog(program, sizeof(infoLog), NULL, infoLog);
+        cout << "ERROR: Link failed.\n" << infoLog << endl;
+        return false;
+    }
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "texture0"), 0);
+    glUniform1i(glGetUniformLocation(program, "texture1"), 1);
+    mvpLocation = glGetUniformLocation(program, "mvp");
+    glUseProgram(0);
+    return true;
+}
+
+void CubeScene::destroy()
+{
+    if (program)
+        glDeleteProgram(program);
+    if (textures[0] || textures[1])
+        glDeleteTextures(2, textures);
+    if (ebo)
+        glDeleteBuffers(1, &ebo);
+    if (vbo)
+        glDeleteBuffers(1, &vbo);
+    if (vao)
+        glDeleteVertexArrays(1, &vao);
+    program = ebo = vbo = vao = 0;
+    textures[0] = textures[1] = 0;
+}
+
+void CubeScene::draw(const glm::mat4& view, float aspect)
+{
+    glEnable(GL_DEPTH_TEST);
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, textures[0]);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, textures[1]);
+    glUseProgram(program);
+    glBindVertexArray(vao);
+
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), aspect, 0.1f, 100.0f);
+    composeMVPBatch(projection * view, positions, rotations, scales, NULL, mvps, kCubeNum);
+    for (int i = 0; i < kCubeNum; i++)
+    {
+        glUniformMatrix4fv(mvpLocation, 1, GL_FALSE, glm::value_ptr(mvps[i]));
+        glDrawElements(GL_TRIANGLES, kCubeIndexNum, GL_UNSIGNED_INT, NULL);
+    }
+
+    glBindVertexArray(0);
+    glUseProgram(0);
+}
+
+glm::mat4 CubeScene::defaultView()
+{
+    glm::vec3 position(0.0f, 0.0f, 3.0f);
+    return glm::lookAt(position, position + glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+glm::mat4 CubeScene::orbitView(float angle, float radius)
+{
+    // around the middle of the cube cloud
+    glm::vec3 center(0.0f, 0.5f, -6.0f);
+    glm::vec3 position = center + glm::vec3(glm::sin(angle), 0.15f, glm::cos(angle)) * radius;
+    return glm::lookAt(position, center, glm::vec3(0.0f, 1.0f, 0.0f));
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// The ten textured cubes of 1_gettingstarted/6_camera, drawn with the chapter's own shaders,
+// for tools that render the scene without the chapter's window and input handling.
+// Paths are relative to bin/, like the chapters.
+class CubeScene
+{
+public:
+    ~CubeScene() { destroy(); }
+
+    // textureDir: directory holding container.jpg and awesomeface.png,
+    // null for generated textures (no data files needed, identical output on every machine)
+    bool init(const char* textureDir = "../data");
+    void destroy();
+
+    // draw into the bound framebuffer, clearing it first
+    void draw(const glm::mat4& view, float aspect);
+
+    // the chapter's starting camera
+    static glm::mat4 defaultView();
+    // camera on a circle of 'radius' around the cubes at 'angle' radians, for turntables
+    static glm::mat4 orbitView(float angle, float radius = 12.0f);
+
+    static const int kCubeNum = 10;
+
+private:
+    unsigned int vao = 0, vbo = 0, ebo = 0;
+    unsigned int textures[2] = {};
+    unsigned int program = 0;
+    int mvpLocation = -1;
+    glm::vec3 positions[kCubeNum];
+    glm::quat rotations[kCubeNum];
+    glm::vec3 scales[kCubeNum];
+    glm::mat4 mvps[kCubeNum];
+};
@@ -0,0 +1,125 @@
+#include "cubeSceneData.h"
+
+#include <stb_image.h>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+namespace
+{
+    const int kGeneratedSize = 128;
+
+    // Stand-ins for the two data textures: wooden planks with a metal frame, and a smiley
+    void generateTexture(int which, vector<unsigned char>& rgb)
+    {
+        const int n = kGeneratedSize;
+        rgb.resize(n * n * 3);
+        for (int y = 0; y < n; y++)
+        {
+            for (int x = 0; x < n; x++)
+            {
+                unsigned char* p = &rgb[(y * n + x) * 3];
+                if (which == 0)
+                {
+                    int border = n / 12;
+                    bool frame = x < border || y < border || x >= n - border || y >= n - border;
+                    bool seam = (y % (n / 4)) < 2;
+                    unsigned char grain = (unsigned char)(((x * 7 + y * 3) >> 2) % 16);
+                    p[0] = frame ? 110 : seam ? 90 : (unsigned char)(150 + grain);
+                    p[1] = frame ? 110 : seam ? 55 : (unsigned char)(100 + grain);
+                    p[2] = frame ? 120 : seam ? 25 : (unsigned char)(50 + grain / 2);
+                }
+                else
+                {
+                    float u = (x + 0.5f) / n * 2.0f - 1.0f, v = (y + 0.5f) / n * 2.0f - 1.0f;
+                    float r = u * u + v * v;
+                    bool face = r < 0.8f;
+                    bool eye = (glm::abs(u) - 0.3f) * (glm::abs(u) - 0.3f) + (v - 0.3f) * (v - 0.3f) < 0.01f;
+                    bool mouth = v < -0.2f && v > -0.5f && glm::abs(r - 0.3f) < 0.05f;
+                    bool ink = face && (eye || mouth);
+                    p[0] = ink ? 30 : face ? 250 : 0;
+                    p[1] = ink ? 30 : face ? 200 : 120;
+                    p[2] = ink ? 30 : face ? 20 : 200;
+                }
+            }
+        }
+    }
+}
+
+const float kCubeVertices[kCubeVertexNum * 5] = {
+     0.5f,  0.5f,  0.5f,   1.0f, 1.0f,
+     0.5f, -0.5f,  0.5f,   1.0f, 0.0f,
+    -0.5f, -0.5f,  0.5f,   0.0f, 0.0f,
+    -0.5f,  0.5f,  0.5f,   0.0f, 1.0f,
+    -0.5f,  0.5f, -0.5f,   1.0f, 1.0f,
+    -0.5f, -0.5f, -0.5f,   1.0f, 0.0f,
+     0.5f, -0.5f, -0.5f,   0.0f, 0.0f,
+     0.5f,  0.5f, -0.5f,   0.0f, 1.0f,
+    -0.5f,  0.5f,  0.5f,   1.0f, 1.0f,
+    -0.5f, -0.5f,  0.5f,   1.0f, 0.0f,
+    -0.5f, -0.5f, -0.5f,   0.0f, 0.0f,
+    -0.5f,  0.5f, -0.5f,   0.0f, 1.0f,
+     0.5f,  0.5f, -0.5f,   1.0f, 1.0f,
+     0.5f, -0.5f, -0.5f,   1.0f, 0.0f,
+     0.5f, -0.5f,  0.5f,   0.0f, 0.0f,
+     0.5f,  0.5f,  0.5f,   0.0f, 1.0f,
+     0.5f,  0.5f, -0.5f,   1.0f, 1.0f,
+     0.5f,  0.5f,  0.5f,   1.0f, 0.0f,
+    -0.5f,  0.5f,  0.5f,   0.0f, 0.0f,
+    -0.5f,  0.5f, -0.5f,   0.0f, 1.0f,
+     0.5f, -0.5f, -0.5f,   1.0f, 1.0f,
+     0.5f, -0.5f,  0.5f,   1.0f, 0.0f,
+    -0.5f, -0.5f,  0.5f,   0.0f, 0.0f,
+    -0.5f, -0.5f, -0.5f,   0.0f, 1.0f
+};
+
+const unsigned int kCubeIndices[kCubeIndexNum] = {
+    0, 1, 3,    1, 2, 3,
+    4, 5, 7,    5, 6, 7,
+    8, 9, 11,   9, 10, 11,
+    12, 13, 15, 13, 14, 15,
+    16, 17, 19, 17, 18, 19,
+    20, 21, 23, 21, 22, 23,
+};
+
+const glm::vec3 kCubePositions[CubeScene::kCubeNum] = {
+    glm::vec3(0.0f,  0.0f,  0.0f),
+    glm::vec3(2.0f,  5.0f, -15.0f),
+    glm::vec3(-1.5f, -2.2f, -2.5f),
+    glm::vec3(-3.8f, -2.0f, -12.3f),
+    glm::vec3(2.4f, -0.4f, -3.5f),
+    glm::vec3(-1.7f,  3.0f, -7.5f),
+    glm::vec3(1.3f, -2.0f, -2.5f),
+    glm::vec3(1.5f,  2.0f, -2.5f),
+    glm::vec3(1.5f,  0.2f, -1.5f),
+    glm::vec3(-1.3f,  1.0f, -1.5f)
+};
+
+glm::quat cubeRotation(int i)
+{
+    return glm::angleAxis((float)(i), glm::normalize(glm::vec3(1.0f, 0.3f, 0.5f)));
+}
+
+bool loadCubeTexture(const char* textureDir, int which, vector<unsigned char>& rgb, int& width, int& height)
+{
+    if (!textureDir)
+    {
+        generateTexture(which, rgb);
+        width = height = kGeneratedSize;
+        return true;
+    }
+    const char* names[2] = { "container.jpg", "awesomeface.png" };
+    string filename = string(textureDir) + "/" + names[which];
+    stbi_set_flip_vertically_on_load(true);
+    int channels;
+    unsigned char* data = stbi_load(filename.c_str(), &width, &height, &channels, 3);
+    if (!data)
+    {
+        cout << "ERROR: Failed to load texture \"" << filename << "\".\n";
+        return false;
+    }
+    rgb.assign(data, data + (size_t)width * height * 3);
+    stbi_image_free(data);
+    return true;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "cubeScene.h"
+#include <vector>
+
+// The scene description shared by CubeScene and SoftCubeScene, so both draw exactly the same cubes.
+
+const int kCubeVertexNum = 24;
+const int kCubeIndexNum = 36;
+
+// per vertex: position xyz, texture coordinate uv
+extern const float kCubeVertices[kCubeVertexNum * 5];
+extern const unsigned int kCubeIndices[kCubeIndexNum];
+extern const glm::vec3 kCubePositions[CubeScene::kCubeNum];
+
+glm::quat cubeRotation(int i);
+
+// RGB, rows bottom first; textureDir null for the generated stand-ins
+bool loadCubeTexture(const char* textureDir, int which, std::vector<unsigned char>& rgb, int& width, int& height);
@@ -0,0 +1,51 @@
+#include "softCubeScene.h"
+#include "cubeSceneData.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <batchMath.h>
+#include <vector>
+
+using namespace std;
+
+bool SoftCubeScene::init(const char* textureDir)
+{
+    static_assert(sizeof(vertices) / sizeof(vertices[0]) == kCubeVertexNum, "vertex count");
+    for (int v = 0; v < kCubeVertexNum; v++)
+    {
+        const float* src = &kCubeVertices[v * 5];
+        vertices[v].position = glm::vec3(src[0], src[1], src[2]);
+        vertices[v].uv = glm::vec2(src[3], src[4]);
+    }
+    for (int i = 0; i < CubeScene::kCubeNum; i++)
+    {
+        positions[i] = kCubePositions[i];
+        rotations[i] = cubeRotation(i);
+        scales[i] = glm::vec3(1.0f);
+    }
+    for (int t = 0; t < 2; t++)
+    {
+        vector<unsigned char> rgb;
+        int width, height;
+        if (!loadCubeTexture(textureDir, t, rgb, width, height))
+            return false;
+        textures[t].create(rgb.data(), width, height, 3);
+    }
+    return true;
+}
+
+void SoftCubeScene::setMinFilter(SoftTexture::Filter filter)
+{
+    textures[0].minFilter = filter;
+    textures[1].minFilter = filter;
+}
+
+void SoftCubeScene::draw(SoftRasterizer& rasterizer, const glm::mat4& view, float aspect)
+{
+    rasterizer.clear(glm::vec4(0.2f, 0.3f, 0.3f, 1.0f));
+    rasterizer.setTextures(&textures[0], &textures[1]);
+
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), aspect, 0.1f, 100.0f);
+    composeMVPBatch(projection * view, positions, rotations, scales, NULL, mvps, CubeScene::kCubeNum);
+    for (int i = 0; i < CubeScene::kCubeNum; i++)
+        rasterizer.drawIndexed(vertices, kCubeIndices, kCubeIndexNum, mvps[i]);
+}
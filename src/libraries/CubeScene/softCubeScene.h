@@ -0,0 +1,26 @@
+#pragma once
+
+#include "cubeScene.h"
+#include <softRaster.h>
+
+// CubeScene drawn by the software rasterizer: same cubes, camera and textures, no GL context needed.
+class SoftCubeScene
+{
+public:
+    // textureDir: as CubeScene::init
+    bool init(const char* textureDir = "../data");
+
+    // clear and draw into the rasterizer's framebuffer; call finish() or readPixels() to complete it
+    void draw(SoftRasterizer& rasterizer, const glm::mat4& view, float aspect);
+
+    // matches the GL_LINEAR minification CubeScene sets up; LinearMipmapLinear for trilinear
+    void setMinFilter(SoftTexture::Filter filter);
+
+private:
+    SoftTexture textures[2];
+    SoftVertex vertices[24];
+    glm::vec3 positions[CubeScene::kCubeNum];
+    glm::quat rotations[CubeScene::kCubeNum];
+    glm::vec3 scales[CubeScene::kCubeNum];
+    glm::mat4 mvps[CubeScene::kCubeNum];
+};
@@ -0,0 +1,293 @@
+#include "world.h"
+
+#include <threadPool.h>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+//------- component registry -------
+
+std::vector<ComponentInfo>& ComponentRegistry::types()
+{
+    static std::vector<ComponentInfo> list;
+    return list;
+}
+
+int ComponentRegistry::registerType(size_t size, size_t align, const char* name)
+{
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<ComponentInfo>& list = types();
+    if (list.size() >= (size_t)kMaxComponentTypes)
+    {
+        // every mask and archetype is sized for kMaxComponentTypes, an id past it cannot work
+        printf("ERROR: ECS component type limit (%d) reached registering %s.\n", kMaxComponentTypes, name);
+        abort();
+    }
+    list.push_back({ size, align, name });
+    return (int)list.size() - 1;
+}
+
+//------- component column -------
+
+ComponentColumn::~ComponentColumn()
+{
+    if (bytes)
+        ::operator delete(bytes, std::align_val_t(alignment));
+}
+
+ComponentColumn::ComponentColumn(ComponentColumn&& other) noexcept :
+    bytes(other.bytes), size(other.size), alignment(other.alignment), rowNum(other.rowNum), capacity(other.capacity)
+{
+    other.bytes = nullptr;
+    other.rowNum = other.capacity = 0;
+}
+
+ComponentColumn& ComponentColumn::operator=(ComponentColumn&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (bytes)
+            ::operator delete(bytes, std::align_val_t(alignment));
+        bytes = other.bytes;
+        size = other.size;
+        alignment = other.alignment;
+        rowNum = other.rowNum;
+        capacity = other.capacity;
+        other.bytes = nullptr;
+        other.rowNum = other.capacity = 0;
+    }
+    return *this;
+}
+
+void ComponentColumn::resize(size_t rows)
+{
+    if (rows > capacity)
+    {
+        size_t newCapacity = capacity ? capacity * 2 : 16;
+        if (newCapacity < rows)
+            newCapacity = rows;
+        unsigned char* grown = (unsigned char*)::operator new(newCapacity * size, std::align_val_t(alignment));
+        if (bytes)
+        {
+            memcpy(grown, bytes, rowNum * size);
+            ::operator delete(bytes, std::align_val_t(alignment));
+        }
+        bytes = grown;
+        capacity = newCapacity;
+    }
+    if (rows > rowNum)
+        memset(bytes + rowNum * size, 0, (rows - rowNum) * size);
+    rowNum = rows;
+}
+
+//------- archetype -------
+
+Archetype::Archetype(const ComponentMask& mask) : signature(mask)
+{
+    for (int i = 0; i < kMaxComponentTypes; i++)
+    {
+        columnIndex[i] = -1;
+        if (mask.test(i))
+        {
+            columnIndex[i] = (int)columns.size();
+            const ComponentInfo& info = ComponentRegistry::info(i);
+            columns.emplace_back(info.size, info.align);
+        }
+    }
+}
+
+size_t Archetype::pushRow(Entity entity)
+{
+    size_t row = entities.size();
+    entities.push_back(entity);
+    for (ComponentColumn& column : columns)
+        column.resize(row + 1);
+    return row;
+}
+
+Entity Archetype::eraseRow(size_t row)
+{
+    size_t last = entities.size() - 1;
+    Entity moved;
+    if (row != last)
+    {
+        entities[row] = entities[last];
+        moved = entities[row];
+        for (ComponentColumn& column : columns)
+        {
+            size_t size = column.elementSize();
+            memcpy(column.data() + row * size, column.data() + last * size, size);
+        }
+    }
+    entities.pop_back();
+    for (ComponentColumn& column : columns)
+        column.resize(last);
+    return moved;
+}
+
+void Archetype::copyRowTo(size_t row, Archetype& dst, size_t dstRow) const
+{
+    for (int i = 0; i < kMaxComponentTypes; i++)
+    {
+        int src = columnIndex[i];
+        int d = dst.columnIndex[i];
+        if (src < 0 || d < 0)
+            continue;
+        size_t size = columns[src].elementSize();
+        memcpy(dst.columns[d].data() + dstRow * size, columns[src].data() + row * size, size);
+    }
+}
+
+//------- world -------
+
+World::World()
+{
+    // archetype 0 holds entities without components
+    archetypeFor(ComponentMask());
+}
+
+size_t World::archetypeFor(const ComponentMask& mask)
+{
+    auto it = archetypeIndex.find(mask);
+    if (it != archetypeIndex.end())
+        return it->second;
+    archetypes.emplace_back(mask);
+    archetypeIndex.emplace(mask, archetypes.size() - 1);
+    return archetypes.size() - 1;
+}
+
+Entity World::createIn(size_t archetype)
+{
+    Entity e;
+    if (!freeList.empty())
+    {
+        e.index = freeList.back();
+        freeList.pop_back();
+    }
+    else
+    {
+        e.index = (uint32_t)records.size();
+        records.emplace_back();
+    }
+    Record& r = records[e.index];
+    e.generation = r.generation;
+    r.alive = true;
+    r.archetype = archetype;
+    r.row = archetypes[archetype].pushRow(e);
+    aliveNum++;
+    return e;
+}
+
+Entity World::create()
+{
+    return createIn(0);
+}
+
+bool World::alive(Entity entity) const
+{
+    return entity.index < records.size() && records[entity.index].alive &&
+        records[entity.index].generation == entity.generation;
+}
+
+void World::destroy(Entity entity)
+{
+    if (!alive(entity))
+        return;
+    Record& r = records[entity.index];
+    Entity moved = archetypes[r.archetype].eraseRow(r.row);
+    if (moved.index != UINT32_MAX)
+        records[moved.index].row = r.row;
+    r.alive = false;
+    r.generation++;
+    freeList.push_back(entity.index);
+    aliveNum--;
+}
+
+void World::move(Entity entity, int component, bool adding)
+{
+    Record& r = records[entity.index];
+    size_t srcIndex = r.archetype;
+    std::unordered_map<int, size_t>& edges = adding ?
+        archetypes[srcIndex].addEdges : archetypes[srcIndex].removeEdges;
+    size_t dstIndex;
+    auto it = edges.find(component);
+    if (it != edges.end())
+        dstIndex = it->second;
+    else
+    {
+        ComponentMask mask = archetypes[srcIndex].mask();
+        mask.set(component, adding);
+        dstIndex = archetypeFor(mask);
+        // archetypeFor may have grown the vector, look the edges up again
+        (adding ? archetypes[srcIndex].addEdges : archetypes[srcIndex].removeEdges)[component] = dstIndex;
+    }
+
+    Archetype& src = archetypes[srcIndex];
+    Archetype& dst = archetypes[dstIndex];
+    size_t row = dst.pushRow(entity);
+    src.copyRowTo(r.row, dst, row);
+    Entity moved = src.eraseRow(r.row);
+    if (moved.index != UINT32_MAX)
+        records[moved.index].row = r.row;
+    r.archetype = dstIndex;
+    r.row = row;
+}
+
+void World::parallelRows(ThreadPool& pool, size_t count, size_t grain,
+    const std::function<void(size_t, size_t)>& fn)
+{
+    pool.parallelFor(count, grain, fn);
+}
+
+//------- scheduler -------
+
+const std::vector<std::vector<size_t>>& Scheduler::stages()
+{
+    if (stagesValid)
+        return stageList;
+    // a system runs one stage after the last earlier system it conflicts with
+    std::vector<size_t> stageOf(systems.size(), 0);
+    stageList.clear();
+    for (size_t i = 0; i < systems.size(); i++)
+    {
+        const System& s = systems[i];
+        size_t stage = 0;
+        for (size_t j = 0; j < i; j++)
+        {
+            const System& o = systems[j];
+            bool conflict = (s.writes & (o.reads | o.writes)).any() || (o.writes & s.reads).any();
+            if (conflict && stageOf[j] + 1 > stage)
+                stage = stageOf[j] + 1;
+        }
+        stageOf[i] = stage;
+        if (stageList.size() <= stage)
+            stageList.resize(stage + 1);
+        stageList[stage].push_back(i);
+    }
+    stagesValid = true;
+    return stageList;
+}
+
+void Scheduler::run(World& world, ThreadPool* pool)
+{
+    if (!pool)
+    {
+        for (System& s : systems)
+            s.run(world);
+        return;
+    }
+    for (const std::vector<size_t>& stage : stages())
+    {
+        if (stage.size() == 1)
+        {
+            systems[stage[0]].run(world);
+            continue;
+        }
+        pool->parallelFor(stage.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                systems[stage[i]].run(world);
+        });
+    }
+}
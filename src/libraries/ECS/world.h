@@ -0,0 +1,284 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class ThreadPool;
+
+//------- entities and component types -------
+
+struct Entity
+{
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+const int kMaxComponentTypes = 64;
+typedef std::bitset<kMaxComponentTypes> ComponentMask;
+
+struct ComponentInfo
+{
+    size_t size;
+    size_t align;
+    const char* name;
+};
+
+// Components are plain data: trivially copyable so archetype columns can move rows with memcpy.
+// At most kMaxComponentTypes types, registering one more is a fatal error.
+class ComponentRegistry
+{
+public:
+    template<typename T>
+    static int id()
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "ECS components must be trivially copyable");
+        static const int value = registerType(sizeof(T), alignof(T), typeid(T).name());
+        return value;
+    }
+
+    static const ComponentInfo& info(int id) { return types()[id]; }
+
+    template<typename... Cs>
+    static ComponentMask mask()
+    {
+        ComponentMask m;
+        int ids[] = { 0, (m.set(id<Cs>()), 0)... };
+        (void)ids;
+        return m;
+    }
+
+private:
+    static int registerType(size_t size, size_t align, const char* name);
+    static std::vector<ComponentInfo>& types();
+};
+
+//------- archetype storage -------
+
+// One component of every row, contiguous and aligned to the component's alignment.
+// New rows are zeroed; growing moves the bytes, which components allow by being trivially copyable.
+class ComponentColumn
+{
+public:
+    ComponentColumn(size_t elementSize, size_t align) : size(elementSize), alignment(align) {}
+    ~ComponentColumn();
+    ComponentColumn(ComponentColumn&& other) noexcept;
+    ComponentColumn& operator=(ComponentColumn&& other) noexcept;
+    ComponentColumn(const ComponentColumn&) = delete;
+    ComponentColumn& operator=(const ComponentColumn&) = delete;
+
+    unsigned char* data() { return bytes; }
+    const unsigned char* data() const { return bytes; }
+    size_t elementSize() const { return size; }
+    void resize(size_t rows);
+
+private:
+    unsigned char* bytes = nullptr;
+    size_t size, alignment;
+    size_t rowNum = 0, capacity = 0;
+};
+
+// All entities with exactly the same component set.
+// Every component is one contiguous column, row i of every column belongs to entities[i].
+class Archetype
+{
+public:
+    explicit Archetype(const ComponentMask& mask);
+
+    const ComponentMask& mask() const { return signature; }
+    size_t size() const { return entities.size(); }
+    const Entity* entityData() const { return entities.data(); }
+
+    template<typename T>
+    T* column() { return (T*)columnData(ComponentRegistry::id<T>()); }
+    void* columnData(int component)
+    {
+        int c = columnIndex[component];
+        return c < 0 ? nullptr : columns[c].data();
+    }
+
+    // append a zeroed row
+    size_t pushRow(Entity entity);
+    // swap-remove, returns the entity moved into 'row' (or an invalid entity)
+    Entity eraseRow(size_t row);
+    // copy shared components of row 'row' into row 'dstRow' of 'dst'
+    void copyRowTo(size_t row, Archetype& dst, size_t dstRow) const;
+
+    // cached archetype transitions when adding/removing one component
+    std::unordered_map<int, size_t> addEdges;
+    std::unordered_map<int, size_t> removeEdges;
+
+private:
+    ComponentMask signature;
+    std::vector<Entity> entities;
+    std::vector<ComponentColumn> columns;
+    int columnIndex[kMaxComponentTypes];
+};
+
+//------- world -------
+
+class World
+{
+public:
+    World();
+
+    Entity create();
+    template<typename... Cs>
+    Entity create(const Cs&... components)
+    {
+        Entity e = createIn(archetypeFor(ComponentRegistry::mask<Cs...>()));
+        int unused[] = { 0, (*get<Cs>(e) = components, 0)... };
+        (void)unused;
+        return e;
+    }
+    void destroy(Entity entity);
+    bool alive(Entity entity) const;
+    size_t size() const { return aliveNum; }
+
+    template<typename T>
+    T* get(Entity entity)
+    {
+        if (!alive(entity))
+            return nullptr;
+        const Record& r = records[entity.index];
+        T* column = archetypes[r.archetype].column<T>();
+        return column ? column + r.row : nullptr;
+    }
+
+    template<typename T>
+    bool has(Entity entity) const
+    {
+        return alive(entity) && archetypes[records[entity.index].archetype].mask().test(ComponentRegistry::id<T>());
+    }
+
+    template<typename T>
+    T& add(Entity entity, const T& value = T())
+    {
+        int id = ComponentRegistry::id<T>();
+        if (!has<T>(entity))
+            move(entity, id, true);
+        T* p = get<T>(entity);
+        *p = value;
+        return *p;
+    }
+
+    template<typename T>
+    void remove(Entity entity)
+    {
+        if (has<T>(entity))
+            move(entity, ComponentRegistry::id<T>(), false);
+    }
+
+    // Call fn(n, entities, Cs*...) once per matching archetype with its columns.
+    // Structural changes (create/destroy/add/remove) are not allowed inside.
+    template<typename... Cs, typename F>
+    void eachChunk(F&& fn)
+    {
+        ComponentMask m = ComponentRegistry::mask<Cs...>();
+        for (Archetype& a : archetypes)
+            if (a.size() && (a.mask() & m) == m)
+                fn(a.size(), a.entityData(), a.column<Cs>()...);
+    }
+
+    // Call fn(Cs&...) for every entity owning all of Cs
+    template<typename... Cs, typename F>
+    void each(F&& fn)
+    {
+        eachChunk<Cs...>([&](size_t n, const Entity*, Cs*... columns) {
+            for (size_t i = 0; i < n; i++)
+                fn(columns[i]...);
+        });
+    }
+
+    // Like each, with rows split across the pool. fn must only touch its own entity.
+    template<typename... Cs, typename F>
+    void parallelEach(ThreadPool& pool, F&& fn, size_t grain = 4096)
+    {
+        ComponentMask m = ComponentRegistry::mask<Cs...>();
+        for (Archetype& a : archetypes)
+        {
+            if (!a.size() || (a.mask() & m) != m)
+                continue;
+            std::tuple<Cs*...> columns(a.column<Cs>()...);
+            parallelRows(pool, a.size(), grain, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                    fn(std::get<Cs*>(columns)[i]...);
+            });
+        }
+    }
+
+    size_t archetypeNum() const { return archetypes.size(); }
+
+private:
+    struct Record
+    {
+        size_t archetype = 0;
+        size_t row = 0;
+        uint32_t generation = 0;
+        bool alive = false;
+    };
+
+    size_t archetypeFor(const ComponentMask& mask);
+    Entity createIn(size_t archetype);
+    void move(Entity entity, int component, bool adding);
+    static void parallelRows(ThreadPool& pool, size_t count, size_t grain,
+        const std::function<void(size_t, size_t)>& fn);
+
+    std::vector<Archetype> archetypes;
+    std::unordered_map<ComponentMask, size_t> archetypeIndex;
+    std::vector<Record> records;
+    std::vector<uint32_t> freeList;
+    size_t aliveNum = 0;
+};
+
+//------- systems -------
+
+// A system declares which components it reads and writes so the scheduler
+// can run systems without conflicting access side by side.
+struct System
+{
+    std::string name;
+    ComponentMask reads;
+    ComponentMask writes;
+    std::function<void(World&)> run;
+};
+
+class Scheduler
+{
+public:
+    template<typename... Reads>
+    struct Read {};
+    template<typename... Writes>
+    struct Write {};
+
+    template<typename... Rs, typename... Ws>
+    void add(const std::string& name, Read<Rs...>, Write<Ws...>, std::function<void(World&)> fn)
+    {
+        systems.push_back({ name, ComponentRegistry::mask<Rs...>(), ComponentRegistry::mask<Ws...>(), std::move(fn) });
+        stagesValid = false;
+    }
+
+    // Run all systems once, in registration order where they conflict,
+    // in parallel where they do not. Without a pool everything runs in order.
+    void run(World& world, ThreadPool* pool = nullptr);
+
+    // Systems grouped into stages that can run concurrently
+    const std::vector<std::vector<size_t>>& stages();
+
+private:
+    std::vector<System> systems;
+    std::vector<std::vector<size_t>> stageList;
+    bool stagesValid = false;
+};
@@ -0,0 +1,102 @@
+#include "frameAllocator.h"
+
+#include <algorithm>
+#include <cstdio>
+
+using namespace std;
+
+namespace
+{
+    // the arenas this thread claimed, handed back when it exits
+    mutex claimsMutex;
+
+    struct ThreadClaim
+    {
+        void* arenas = nullptr;
+        bool* claimed = nullptr;
+
+        ~ThreadClaim()
+        {
+            lock_guard<mutex> lock(claimsMutex);
+            if (claimed)
+                *claimed = false;
+        }
+    };
+    thread_local ThreadClaim claim;
+}
+
+FrameAllocator& FrameAllocator::instance()
+{
+    static FrameAllocator allocator;
+    return allocator;
+}
+
+void FrameAllocator::configure(int latency, size_t capacity)
+{
+    frames = min(max(latency, 1), kMaxLatency);
+    arenaCapacity = capacity;
+}
+
+FrameAllocator::ThreadArenas& FrameAllocator::threadArenas()
+{
+    if (claim.arenas)
+        return *(ThreadArenas*)claim.arenas;
+    lock_guard<mutex> lock(threadsMutex);
+    lock_guard<mutex> claimLock(claimsMutex);
+    size_t i = 0;
+    while (i < threads.size() && threads[i]->claimed)
+        i++;
+    if (i == threads.size())
+    {
+        threads.emplace_back(new ThreadArenas());
+        for (int f = 0; f < frames; f++)
+            threads[i]->arenas[f].reserve(arenaCapacity);
+    }
+    threads[i]->claimed = true;
+    claim.arenas = threads[i].get();
+    claim.claimed = &threads[i]->claimed;
+    return *threads[i];
+}
+
+LinearArena& FrameAllocator::arena()
+{
+    return threadArenas().arenas[frame.load(memory_order_relaxed) % frames];
+}
+
+void FrameAllocator::beginFrame()
+{
+    lock_guard<mutex> lock(threadsMutex);
+    uint64_t next = frame.load(memory_order_relaxed) + 1;
+    for (const unique_ptr<ThreadArenas>& t : threads)
+        t->arenas[next % frames].reset();
+    frame.store(next, memory_order_release);
+}
+
+FrameAllocator::Stats FrameAllocator::stats() const
+{
+    lock_guard<mutex> lock(threadsMutex);
+    Stats s = {};
+    int current = (int)(frame.load(memory_order_relaxed) % frames);
+    for (const unique_ptr<ThreadArenas>& t : threads)
+    {
+        for (int f = 0; f < frames; f++)
+        {
+            const LinearArena& a = t->arenas[f];
+            if (f == current)
+                s.used += a.used();
+            s.highWater = max(s.highWater, a.highWater());
+            s.capacity += a.capacity();
+            s.heapAllocations += a.heapAllocationNum();
+        }
+    }
+    s.threads = (int)threads.size();
+    return s;
+}
+
+void FrameAllocator::print() const
+{
+    Stats s = stats();
+    printf("frame allocator: %d threads x %d frames, %.1f KB used this frame, high water %.1f KB per arena, "
+        "%.1f KB reserved, %llu heap allocations\n", s.threads, frames, s.used / 1024.0, s.highWater / 1024.0,
+        s.capacity / 1024.0, (unsigned long long)s.heapAllocations);
+}
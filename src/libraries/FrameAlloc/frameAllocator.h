@@ -0,0 +1,73 @@
+#pragma once
+
+#include "linearArena.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Per-frame transient memory: matrices, command lists, culling results.
+//
+//     FrameAllocator& frame = FrameAllocator::instance();
+//     frame.beginFrame();                                  // the frame loop, once per frame
+//     glm::mat4* mvps = frame.allocateArray<glm::mat4>(objectNum);
+//     ArenaVector<DrawCommand> commands(frame.arena());    // this thread's arena
+//
+// Every thread allocates from its own LinearArena, created on its first allocation, so
+// allocating takes no lock. There is one arena per thread for each of the last 'latency'
+// frames: what a frame allocates stays valid until beginFrame() starts the frame 'latency'
+// frames later, long enough for a consumer running behind (the render thread drawing the
+// simulation's previous frame, an upload the driver has not copied yet) to read it.
+// beginFrame() resets the arenas of the oldest frame, of every thread: no thread may allocate
+// from the frame allocator while it runs. Arenas of threads that exit are kept for reuse.
+class FrameAllocator
+{
+public:
+    static constexpr int kMaxLatency = 4;
+
+    struct Stats
+    {
+        size_t used;            // in the current frame, every thread
+        size_t highWater;       // largest frame of one arena
+        size_t capacity;        // every arena
+        uint64_t heapAllocations;
+        int threads;
+    };
+
+    static FrameAllocator& instance();
+
+    // before the first allocation; capacity is the initial size of each thread's arenas
+    void configure(int latency, size_t capacity);
+    int latency() const { return frames; }
+
+    void beginFrame();
+    uint64_t frameNum() const { return frame.load(std::memory_order_relaxed); }
+
+    // the calling thread's arena of the current frame
+    LinearArena& arena();
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) { return arena().allocate(size, alignment); }
+    template <typename T>
+    T* allocateArray(size_t count) { return arena().allocateArray<T>(count); }
+
+    Stats stats() const;
+    void print() const;
+
+private:
+    struct ThreadArenas
+    {
+        LinearArena arenas[kMaxLatency];
+        bool claimed = false;       // by a running thread
+    };
+
+    FrameAllocator() = default;
+    ThreadArenas& threadArenas();
+
+    mutable std::mutex threadsMutex;
+    std::vector<std::unique_ptr<ThreadArenas>> threads;
+    std::atomic<uint64_t> frame{ 0 };
+    int frames = 2;
+    size_t arenaCapacity = 256 * 1024;
+};
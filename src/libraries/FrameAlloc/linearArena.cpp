@@ -0,0 +1,112 @@
+#include "linearArena.h"
+
+#include <algorithm>
+#include <new>
+
+using namespace std;
+
+namespace
+{
+    // blocks are aligned for any fundamental type, larger alignments are padded inside
+    char* allocateBlock(size_t size)
+    {
+        return (char*)::operator new(size);
+    }
+
+    size_t alignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+LinearArena::LinearArena(size_t capacity)
+{
+    reserve(capacity);
+}
+
+LinearArena::~LinearArena()
+{
+    for (char* b : overflow)
+        ::operator delete(b);
+    ::operator delete(block);
+}
+
+void* LinearArena::allocate(size_t size, size_t alignment)
+{
+    if (overflow.empty())
+    {
+        // aligned within the block: its start is aligned to max_align_t at least
+        size_t start = (size_t)(uintptr_t)block;
+        size_t aligned = alignUp(start + offset, alignment) - start;
+        if (block && aligned + size <= blockSize)
+        {
+            offset = aligned + size;
+            peak = max(peak, offset);
+            return block + aligned;
+        }
+    }
+    return allocateOverflow(size, alignment);
+}
+
+void* LinearArena::allocateOverflow(size_t size, size_t alignment)
+{
+    char* current = overflow.empty() ? nullptr : overflow.back();
+    size_t start = (size_t)(uintptr_t)current;
+    size_t aligned = current ? alignUp(start + overflowOffset, alignment) - start : 0;
+    if (!current || aligned + size > overflowSize)
+    {
+        overflowSize = max(max(blockSize, (size_t)4096), size + alignment);
+        current = allocateBlock(overflowSize);
+        overflow.push_back(current);
+        heapAllocations++;
+        start = (size_t)(uintptr_t)current;
+        aligned = alignUp(start, alignment) - start;
+        overflowOffset = 0;
+    }
+    overflowBytes += aligned + size - overflowOffset;
+    overflowOffset = aligned + size;
+    peak = max(peak, offset + overflowBytes);
+    return current + aligned;
+}
+
+void LinearArena::deallocate(void* pointer, size_t size)
+{
+    char* p = (char*)pointer;
+    if (overflow.empty())
+    {
+        if (p + size == block + offset)
+            offset = p - block;
+    }
+    else if (p + size == overflow.back() + overflowOffset)
+    {
+        overflowBytes -= size;
+        overflowOffset = p - overflow.back();
+    }
+}
+
+// grows to the high-water mark, with room to spare, when the last use did not fit
+void LinearArena::reset()
+{
+    if (!overflow.empty())
+    {
+        for (char* b : overflow)
+            ::operator delete(b);
+        overflow.clear();
+        ::operator delete(block);
+        blockSize = alignUp(peak + peak / 2, 4096);
+        block = allocateBlock(blockSize);
+        heapAllocations++;
+    }
+    offset = 0;
+    overflowOffset = overflowSize = overflowBytes = 0;
+}
+
+void LinearArena::reserve(size_t capacity)
+{
+    if (capacity <= blockSize || used())
+        return;
+    ::operator delete(block);
+    block = allocateBlock(capacity);
+    blockSize = capacity;
+    heapAllocations++;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Bump allocator over one block: allocate() advances an offset, reset() frees everything at once.
+//
+//     LinearArena arena(1 << 20);
+//     float* weights = arena.allocateArray<float>(count);
+//     ArenaVector<int> visible(arena);                     // STL containers through ArenaAllocator
+//     arena.reset();                                       // once the data is no longer used
+//
+// Nothing is freed individually (deallocate() only takes back the most recent allocation, so
+// a growing vector on top of the arena reuses its space). When the block is full, overflow
+// blocks come from the heap and reset() replaces everything with one block large enough for
+// the high-water mark: after a warm-up, a workload that repeats needs no heap allocation.
+// Not synchronized: one arena per thread.
+class LinearArena
+{
+public:
+    explicit LinearArena(size_t capacity = 0);
+    ~LinearArena();
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    template <typename T>
+    T* allocateArray(size_t count) { return (T*)allocate(count * sizeof(T), alignof(T)); }
+    void deallocate(void* pointer, size_t size);
+
+    void reset();
+    // grows the block to at least capacity, when the arena is empty
+    void reserve(size_t capacity);
+
+    size_t used() const { return offset + overflowBytes; }
+    size_t capacity() const { return blockSize; }
+    size_t highWater() const { return peak; }
+    // heap allocations made for overflow blocks and growth, since construction
+    uint64_t heapAllocationNum() const { return heapAllocations; }
+
+private:
+    void* allocateOverflow(size_t size, size_t alignment);
+
+    char* block = nullptr;
+    size_t blockSize = 0;
+    size_t offset = 0;
+    std::vector<char*> overflow;    // the last one is being filled
+    size_t overflowOffset = 0;
+    size_t overflowSize = 0;
+    size_t overflowBytes = 0;       // handed out from overflow blocks
+    size_t peak = 0;
+    uint64_t heapAllocations = 0;
+};
+
+// STL allocator handing out memory of a LinearArena, deallocation is (almost) a no-op.
+// Containers must not outlive the arena's next reset.
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    ArenaAllocator(LinearArena& arena) : arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t n) { return arena->allocateArray<T>(n); }
+    void deallocate(T* pointer, size_t n) { arena->deallocate(pointer, n * sizeof(T)); }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+
+    LinearArena* arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
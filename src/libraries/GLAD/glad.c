@@ -2,21 +2,29 @@
 
     OpenGL loader generated by glad 0.1.33 on Sat Jul 18 14:58:54 2020.
 
-    Language/Generator: C/C++
+    Language/Generator: C/C++ Debug
     Specification: gl
     APIs: gl=3.3
     Profile: compatibility
     Extensions:
-        
+        GL_KHR_debug
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="compatibility" --api="gl=3.3" --generator="c-debug" --spec="gl" --extensions="GL_KHR_debug"
     Online:
-        https://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=compatibility&language=c-debug&specification=gl&extensions=GL_KHR_debug&loader=on&api=gl%3D3.3
+
+    Locally modified, not plain glad output; carry these over when regenerating:
+    - gladInstallGLDebug/gladUninstallGLDebug and _glad_debug_installed (after glad 2).
+      Uninstalled, the default, every glad_debug_* is a copy of its glad_* pointer;
+      installed, it points at the glad_debug_impl_* wrapper that runs the callbacks.
+    - gladLoadGLLoader ends by restoring that state instead of leaving the wrappers in.
+    - The loader (gladLoadGLLoader, get_exts) calls glad_glGetString, glad_glGetIntegerv
+      and glad_glGetStringi directly, so loading never runs the callbacks.
 */
 
 #include <stdio.h>
@@ -173,13 +181,13 @@ static int get_exts(void) {
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
+        exts = (const char *)glad_glGetString(GL_EXTENSIONS);
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
         unsigned int index;
 
         num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        glad_glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
         if (num_exts_i > 0) {
             exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
         }
@@ -189,7 +197,7 @@ static int get_exts(void) {
         }
 
         for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            const char *gl_str_tmp = (const char*)glad_glGetStringi(GL_EXTENSIONS, index);
             size_t len = strlen(gl_str_tmp);
 
             char *local_str = (char*)malloc((len+1) * sizeof(char));
@@ -267,730 +275,5239 @@ int GLAD_GL_VERSION_3_0 = 0;
 int GLAD_GL_VERSION_3_1 = 0;
 int GLAD_GL_VERSION_3_2 = 0;
 int GLAD_GL_VERSION_3_3 = 0;
+int GLAD_GL_KHR_debug = 0;
+void _pre_call_callback_default(const char *name, void *funcptr, int len_args, ...) {
+    (void) name;
+    (void) funcptr;
+    (void) len_args;
+}
+void _post_call_callback_default(const char *name, void *funcptr, int len_args, ...) {
+    GLenum error_code;
+
+    (void) funcptr;
+    (void) len_args;
+
+    error_code = glad_glGetError();
+
+    if (error_code != GL_NO_ERROR) {
+        fprintf(stderr, "ERROR %d in %s\n", error_code, name);
+    }
+}
+
+static GLADcallback _pre_call_callback = _pre_call_callback_default;
+void glad_set_pre_callback(GLADcallback cb) {
+    _pre_call_callback = cb;
+}
+
+static GLADcallback _post_call_callback = _post_call_callback_default;
+void glad_set_post_callback(GLADcallback cb) {
+    _post_call_callback = cb;
+}
+
 PFNGLACCUMPROC glad_glAccum = NULL;
+void APIENTRY glad_debug_impl_glAccum(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glAccum", (void*)glAccum, 2, arg0, arg1);
+    glad_glAccum(arg0, arg1);
+    _post_call_callback("glAccum", (void*)glAccum, 2, arg0, arg1);
+}
+PFNGLACCUMPROC glad_debug_glAccum = glad_debug_impl_glAccum;
 PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
+void APIENTRY glad_debug_impl_glActiveTexture(GLenum arg0) {
+    _pre_call_callback("glActiveTexture", (void*)glActiveTexture, 1, arg0);
+    glad_glActiveTexture(arg0);
+    _post_call_callback("glActiveTexture", (void*)glActiveTexture, 1, arg0);
+}
+PFNGLACTIVETEXTUREPROC glad_debug_glActiveTexture = glad_debug_impl_glActiveTexture;
 PFNGLALPHAFUNCPROC glad_glAlphaFunc = NULL;
+void APIENTRY glad_debug_impl_glAlphaFunc(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glAlphaFunc", (void*)glAlphaFunc, 2, arg0, arg1);
+    glad_glAlphaFunc(arg0, arg1);
+    _post_call_callback("glAlphaFunc", (void*)glAlphaFunc, 2, arg0, arg1);
+}
+PFNGLALPHAFUNCPROC glad_debug_glAlphaFunc = glad_debug_impl_glAlphaFunc;
 PFNGLARETEXTURESRESIDENTPROC glad_glAreTexturesResident = NULL;
+GLboolean APIENTRY glad_debug_impl_glAreTexturesResident(GLsizei arg0, const GLuint * arg1, GLboolean * arg2) {
+    GLboolean ret;
+    _pre_call_callback("glAreTexturesResident", (void*)glAreTexturesResident, 3, arg0, arg1, arg2);
+    ret = glad_glAreTexturesResident(arg0, arg1, arg2);
+    _post_call_callback("glAreTexturesResident", (void*)glAreTexturesResident, 3, arg0, arg1, arg2);
+    return ret;
+}
+PFNGLARETEXTURESRESIDENTPROC glad_debug_glAreTexturesResident = glad_debug_impl_glAreTexturesResident;
 PFNGLARRAYELEMENTPROC glad_glArrayElement = NULL;
+void APIENTRY glad_debug_impl_glArrayElement(GLint arg0) {
+    _pre_call_callback("glArrayElement", (void*)glArrayElement, 1, arg0);
+    glad_glArrayElement(arg0);
+    _post_call_callback("glArrayElement", (void*)glArrayElement, 1, arg0);
+}
+PFNGLARRAYELEMENTPROC glad_debug_glArrayElement = glad_debug_impl_glArrayElement;
 PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
+void APIENTRY glad_debug_impl_glAttachShader(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glAttachShader", (void*)glAttachShader, 2, arg0, arg1);
+    glad_glAttachShader(arg0, arg1);
+    _post_call_callback("glAttachShader", (void*)glAttachShader, 2, arg0, arg1);
+}
+PFNGLATTACHSHADERPROC glad_debug_glAttachShader = glad_debug_impl_glAttachShader;
 PFNGLBEGINPROC glad_glBegin = NULL;
+void APIENTRY glad_debug_impl_glBegin(GLenum arg0) {
+    _pre_call_callback("glBegin", (void*)glBegin, 1, arg0);
+    glad_glBegin(arg0);
+    _post_call_callback("glBegin", (void*)glBegin, 1, arg0);
+}
+PFNGLBEGINPROC glad_debug_glBegin = glad_debug_impl_glBegin;
 PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
+void APIENTRY glad_debug_impl_glBeginConditionalRender(GLuint arg0, GLenum arg1) {
+    _pre_call_callback("glBeginConditionalRender", (void*)glBeginConditionalRender, 2, arg0, arg1);
+    glad_glBeginConditionalRender(arg0, arg1);
+    _post_call_callback("glBeginConditionalRender", (void*)glBeginConditionalRender, 2, arg0, arg1);
+}
+PFNGLBEGINCONDITIONALRENDERPROC glad_debug_glBeginConditionalRender = glad_debug_impl_glBeginConditionalRender;
 PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
+void APIENTRY glad_debug_impl_glBeginQuery(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBeginQuery", (void*)glBeginQuery, 2, arg0, arg1);
+    glad_glBeginQuery(arg0, arg1);
+    _post_call_callback("glBeginQuery", (void*)glBeginQuery, 2, arg0, arg1);
+}
+PFNGLBEGINQUERYPROC glad_debug_glBeginQuery = glad_debug_impl_glBeginQuery;
 PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
+void APIENTRY glad_debug_impl_glBeginTransformFeedback(GLenum arg0) {
+    _pre_call_callback("glBeginTransformFeedback", (void*)glBeginTransformFeedback, 1, arg0);
+    glad_glBeginTransformFeedback(arg0);
+    _post_call_callback("glBeginTransformFeedback", (void*)glBeginTransformFeedback, 1, arg0);
+}
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_debug_glBeginTransformFeedback = glad_debug_impl_glBeginTransformFeedback;
 PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
+void APIENTRY glad_debug_impl_glBindAttribLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+    _pre_call_callback("glBindAttribLocation", (void*)glBindAttribLocation, 3, arg0, arg1, arg2);
+    glad_glBindAttribLocation(arg0, arg1, arg2);
+    _post_call_callback("glBindAttribLocation", (void*)glBindAttribLocation, 3, arg0, arg1, arg2);
+}
+PFNGLBINDATTRIBLOCATIONPROC glad_debug_glBindAttribLocation = glad_debug_impl_glBindAttribLocation;
 PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
+void APIENTRY glad_debug_impl_glBindBuffer(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBindBuffer", (void*)glBindBuffer, 2, arg0, arg1);
+    glad_glBindBuffer(arg0, arg1);
+    _post_call_callback("glBindBuffer", (void*)glBindBuffer, 2, arg0, arg1);
+}
+PFNGLBINDBUFFERPROC glad_debug_glBindBuffer = glad_debug_impl_glBindBuffer;
 PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
+void APIENTRY glad_debug_impl_glBindBufferBase(GLenum arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glBindBufferBase", (void*)glBindBufferBase, 3, arg0, arg1, arg2);
+    glad_glBindBufferBase(arg0, arg1, arg2);
+    _post_call_callback("glBindBufferBase", (void*)glBindBufferBase, 3, arg0, arg1, arg2);
+}
+PFNGLBINDBUFFERBASEPROC glad_debug_glBindBufferBase = glad_debug_impl_glBindBufferBase;
 PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
+void APIENTRY glad_debug_impl_glBindBufferRange(GLenum arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+    _pre_call_callback("glBindBufferRange", (void*)glBindBufferRange, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glBindBufferRange(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glBindBufferRange", (void*)glBindBufferRange, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLBINDBUFFERRANGEPROC glad_debug_glBindBufferRange = glad_debug_impl_glBindBufferRange;
 PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
+void APIENTRY glad_debug_impl_glBindFragDataLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+    _pre_call_callback("glBindFragDataLocation", (void*)glBindFragDataLocation, 3, arg0, arg1, arg2);
+    glad_glBindFragDataLocation(arg0, arg1, arg2);
+    _post_call_callback("glBindFragDataLocation", (void*)glBindFragDataLocation, 3, arg0, arg1, arg2);
+}
+PFNGLBINDFRAGDATALOCATIONPROC glad_debug_glBindFragDataLocation = glad_debug_impl_glBindFragDataLocation;
 PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
+void APIENTRY glad_debug_impl_glBindFragDataLocationIndexed(GLuint arg0, GLuint arg1, GLuint arg2, const GLchar * arg3) {
+    _pre_call_callback("glBindFragDataLocationIndexed", (void*)glBindFragDataLocationIndexed, 4, arg0, arg1, arg2, arg3);
+    glad_glBindFragDataLocationIndexed(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBindFragDataLocationIndexed", (void*)glBindFragDataLocationIndexed, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_debug_glBindFragDataLocationIndexed = glad_debug_impl_glBindFragDataLocationIndexed;
 PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
+void APIENTRY glad_debug_impl_glBindFramebuffer(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBindFramebuffer", (void*)glBindFramebuffer, 2, arg0, arg1);
+    glad_glBindFramebuffer(arg0, arg1);
+    _post_call_callback("glBindFramebuffer", (void*)glBindFramebuffer, 2, arg0, arg1);
+}
+PFNGLBINDFRAMEBUFFERPROC glad_debug_glBindFramebuffer = glad_debug_impl_glBindFramebuffer;
 PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
+void APIENTRY glad_debug_impl_glBindRenderbuffer(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBindRenderbuffer", (void*)glBindRenderbuffer, 2, arg0, arg1);
+    glad_glBindRenderbuffer(arg0, arg1);
+    _post_call_callback("glBindRenderbuffer", (void*)glBindRenderbuffer, 2, arg0, arg1);
+}
+PFNGLBINDRENDERBUFFERPROC glad_debug_glBindRenderbuffer = glad_debug_impl_glBindRenderbuffer;
 PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
+void APIENTRY glad_debug_impl_glBindSampler(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glBindSampler", (void*)glBindSampler, 2, arg0, arg1);
+    glad_glBindSampler(arg0, arg1);
+    _post_call_callback("glBindSampler", (void*)glBindSampler, 2, arg0, arg1);
+}
+PFNGLBINDSAMPLERPROC glad_debug_glBindSampler = glad_debug_impl_glBindSampler;
 PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
+void APIENTRY glad_debug_impl_glBindTexture(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glBindTexture", (void*)glBindTexture, 2, arg0, arg1);
+    glad_glBindTexture(arg0, arg1);
+    _post_call_callback("glBindTexture", (void*)glBindTexture, 2, arg0, arg1);
+}
+PFNGLBINDTEXTUREPROC glad_debug_glBindTexture = glad_debug_impl_glBindTexture;
 PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
+void APIENTRY glad_debug_impl_glBindVertexArray(GLuint arg0) {
+    _pre_call_callback("glBindVertexArray", (void*)glBindVertexArray, 1, arg0);
+    glad_glBindVertexArray(arg0);
+    _post_call_callback("glBindVertexArray", (void*)glBindVertexArray, 1, arg0);
+}
+PFNGLBINDVERTEXARRAYPROC glad_debug_glBindVertexArray = glad_debug_impl_glBindVertexArray;
 PFNGLBITMAPPROC glad_glBitmap = NULL;
+void APIENTRY glad_debug_impl_glBitmap(GLsizei arg0, GLsizei arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4, GLfloat arg5, const GLubyte * arg6) {
+    _pre_call_callback("glBitmap", (void*)glBitmap, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glBitmap(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glBitmap", (void*)glBitmap, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLBITMAPPROC glad_debug_glBitmap = glad_debug_impl_glBitmap;
 PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
+void APIENTRY glad_debug_impl_glBlendColor(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glBlendColor", (void*)glBlendColor, 4, arg0, arg1, arg2, arg3);
+    glad_glBlendColor(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBlendColor", (void*)glBlendColor, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBLENDCOLORPROC glad_debug_glBlendColor = glad_debug_impl_glBlendColor;
 PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
+void APIENTRY glad_debug_impl_glBlendEquation(GLenum arg0) {
+    _pre_call_callback("glBlendEquation", (void*)glBlendEquation, 1, arg0);
+    glad_glBlendEquation(arg0);
+    _post_call_callback("glBlendEquation", (void*)glBlendEquation, 1, arg0);
+}
+PFNGLBLENDEQUATIONPROC glad_debug_glBlendEquation = glad_debug_impl_glBlendEquation;
 PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
+void APIENTRY glad_debug_impl_glBlendEquationSeparate(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glBlendEquationSeparate", (void*)glBlendEquationSeparate, 2, arg0, arg1);
+    glad_glBlendEquationSeparate(arg0, arg1);
+    _post_call_callback("glBlendEquationSeparate", (void*)glBlendEquationSeparate, 2, arg0, arg1);
+}
+PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_glBlendEquationSeparate = glad_debug_impl_glBlendEquationSeparate;
 PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
+void APIENTRY glad_debug_impl_glBlendFunc(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glBlendFunc", (void*)glBlendFunc, 2, arg0, arg1);
+    glad_glBlendFunc(arg0, arg1);
+    _post_call_callback("glBlendFunc", (void*)glBlendFunc, 2, arg0, arg1);
+}
+PFNGLBLENDFUNCPROC glad_debug_glBlendFunc = glad_debug_impl_glBlendFunc;
 PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
+void APIENTRY glad_debug_impl_glBlendFuncSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+    _pre_call_callback("glBlendFuncSeparate", (void*)glBlendFuncSeparate, 4, arg0, arg1, arg2, arg3);
+    glad_glBlendFuncSeparate(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBlendFuncSeparate", (void*)glBlendFuncSeparate, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBLENDFUNCSEPARATEPROC glad_debug_glBlendFuncSeparate = glad_debug_impl_glBlendFuncSeparate;
 PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
+void APIENTRY glad_debug_impl_glBlitFramebuffer(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLbitfield arg8, GLenum arg9) {
+    _pre_call_callback("glBlitFramebuffer", (void*)glBlitFramebuffer, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    glad_glBlitFramebuffer(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    _post_call_callback("glBlitFramebuffer", (void*)glBlitFramebuffer, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+PFNGLBLITFRAMEBUFFERPROC glad_debug_glBlitFramebuffer = glad_debug_impl_glBlitFramebuffer;
 PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
+void APIENTRY glad_debug_impl_glBufferData(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+    _pre_call_callback("glBufferData", (void*)glBufferData, 4, arg0, arg1, arg2, arg3);
+    glad_glBufferData(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBufferData", (void*)glBufferData, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBUFFERDATAPROC glad_debug_glBufferData = glad_debug_impl_glBufferData;
 PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
+void APIENTRY glad_debug_impl_glBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+    _pre_call_callback("glBufferSubData", (void*)glBufferSubData, 4, arg0, arg1, arg2, arg3);
+    glad_glBufferSubData(arg0, arg1, arg2, arg3);
+    _post_call_callback("glBufferSubData", (void*)glBufferSubData, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLBUFFERSUBDATAPROC glad_debug_glBufferSubData = glad_debug_impl_glBufferSubData;
 PFNGLCALLLISTPROC glad_glCallList = NULL;
+void APIENTRY glad_debug_impl_glCallList(GLuint arg0) {
+    _pre_call_callback("glCallList", (void*)glCallList, 1, arg0);
+    glad_glCallList(arg0);
+    _post_call_callback("glCallList", (void*)glCallList, 1, arg0);
+}
+PFNGLCALLLISTPROC glad_debug_glCallList = glad_debug_impl_glCallList;
 PFNGLCALLLISTSPROC glad_glCallLists = NULL;
+void APIENTRY glad_debug_impl_glCallLists(GLsizei arg0, GLenum arg1, const void * arg2) {
+    _pre_call_callback("glCallLists", (void*)glCallLists, 3, arg0, arg1, arg2);
+    glad_glCallLists(arg0, arg1, arg2);
+    _post_call_callback("glCallLists", (void*)glCallLists, 3, arg0, arg1, arg2);
+}
+PFNGLCALLLISTSPROC glad_debug_glCallLists = glad_debug_impl_glCallLists;
 PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
+GLenum APIENTRY glad_debug_impl_glCheckFramebufferStatus(GLenum arg0) {
+    GLenum ret;
+    _pre_call_callback("glCheckFramebufferStatus", (void*)glCheckFramebufferStatus, 1, arg0);
+    ret = glad_glCheckFramebufferStatus(arg0);
+    _post_call_callback("glCheckFramebufferStatus", (void*)glCheckFramebufferStatus, 1, arg0);
+    return ret;
+}
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_glCheckFramebufferStatus = glad_debug_impl_glCheckFramebufferStatus;
 PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
+void APIENTRY glad_debug_impl_glClampColor(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glClampColor", (void*)glClampColor, 2, arg0, arg1);
+    glad_glClampColor(arg0, arg1);
+    _post_call_callback("glClampColor", (void*)glClampColor, 2, arg0, arg1);
+}
+PFNGLCLAMPCOLORPROC glad_debug_glClampColor = glad_debug_impl_glClampColor;
 PFNGLCLEARPROC glad_glClear = NULL;
+void APIENTRY glad_debug_impl_glClear(GLbitfield arg0) {
+    _pre_call_callback("glClear", (void*)glClear, 1, arg0);
+    glad_glClear(arg0);
+    _post_call_callback("glClear", (void*)glClear, 1, arg0);
+}
+PFNGLCLEARPROC glad_debug_glClear = glad_debug_impl_glClear;
 PFNGLCLEARACCUMPROC glad_glClearAccum = NULL;
+void APIENTRY glad_debug_impl_glClearAccum(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glClearAccum", (void*)glClearAccum, 4, arg0, arg1, arg2, arg3);
+    glad_glClearAccum(arg0, arg1, arg2, arg3);
+    _post_call_callback("glClearAccum", (void*)glClearAccum, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCLEARACCUMPROC glad_debug_glClearAccum = glad_debug_impl_glClearAccum;
 PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
+void APIENTRY glad_debug_impl_glClearBufferfi(GLenum arg0, GLint arg1, GLfloat arg2, GLint arg3) {
+    _pre_call_callback("glClearBufferfi", (void*)glClearBufferfi, 4, arg0, arg1, arg2, arg3);
+    glad_glClearBufferfi(arg0, arg1, arg2, arg3);
+    _post_call_callback("glClearBufferfi", (void*)glClearBufferfi, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCLEARBUFFERFIPROC glad_debug_glClearBufferfi = glad_debug_impl_glClearBufferfi;
 PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
+void APIENTRY glad_debug_impl_glClearBufferfv(GLenum arg0, GLint arg1, const GLfloat * arg2) {
+    _pre_call_callback("glClearBufferfv", (void*)glClearBufferfv, 3, arg0, arg1, arg2);
+    glad_glClearBufferfv(arg0, arg1, arg2);
+    _post_call_callback("glClearBufferfv", (void*)glClearBufferfv, 3, arg0, arg1, arg2);
+}
+PFNGLCLEARBUFFERFVPROC glad_debug_glClearBufferfv = glad_debug_impl_glClearBufferfv;
 PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
+void APIENTRY glad_debug_impl_glClearBufferiv(GLenum arg0, GLint arg1, const GLint * arg2) {
+    _pre_call_callback("glClearBufferiv", (void*)glClearBufferiv, 3, arg0, arg1, arg2);
+    glad_glClearBufferiv(arg0, arg1, arg2);
+    _post_call_callback("glClearBufferiv", (void*)glClearBufferiv, 3, arg0, arg1, arg2);
+}
+PFNGLCLEARBUFFERIVPROC glad_debug_glClearBufferiv = glad_debug_impl_glClearBufferiv;
 PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
+void APIENTRY glad_debug_impl_glClearBufferuiv(GLenum arg0, GLint arg1, const GLuint * arg2) {
+    _pre_call_callback("glClearBufferuiv", (void*)glClearBufferuiv, 3, arg0, arg1, arg2);
+    glad_glClearBufferuiv(arg0, arg1, arg2);
+    _post_call_callback("glClearBufferuiv", (void*)glClearBufferuiv, 3, arg0, arg1, arg2);
+}
+PFNGLCLEARBUFFERUIVPROC glad_debug_glClearBufferuiv = glad_debug_impl_glClearBufferuiv;
 PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
+void APIENTRY glad_debug_impl_glClearColor(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glClearColor", (void*)glClearColor, 4, arg0, arg1, arg2, arg3);
+    glad_glClearColor(arg0, arg1, arg2, arg3);
+    _post_call_callback("glClearColor", (void*)glClearColor, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCLEARCOLORPROC glad_debug_glClearColor = glad_debug_impl_glClearColor;
 PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
+void APIENTRY glad_debug_impl_glClearDepth(GLdouble arg0) {
+    _pre_call_callback("glClearDepth", (void*)glClearDepth, 1, arg0);
+    glad_glClearDepth(arg0);
+    _post_call_callback("glClearDepth", (void*)glClearDepth, 1, arg0);
+}
+PFNGLCLEARDEPTHPROC glad_debug_glClearDepth = glad_debug_impl_glClearDepth;
 PFNGLCLEARINDEXPROC glad_glClearIndex = NULL;
+void APIENTRY glad_debug_impl_glClearIndex(GLfloat arg0) {
+    _pre_call_callback("glClearIndex", (void*)glClearIndex, 1, arg0);
+    glad_glClearIndex(arg0);
+    _post_call_callback("glClearIndex", (void*)glClearIndex, 1, arg0);
+}
+PFNGLCLEARINDEXPROC glad_debug_glClearIndex = glad_debug_impl_glClearIndex;
 PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
+void APIENTRY glad_debug_impl_glClearStencil(GLint arg0) {
+    _pre_call_callback("glClearStencil", (void*)glClearStencil, 1, arg0);
+    glad_glClearStencil(arg0);
+    _post_call_callback("glClearStencil", (void*)glClearStencil, 1, arg0);
+}
+PFNGLCLEARSTENCILPROC glad_debug_glClearStencil = glad_debug_impl_glClearStencil;
 PFNGLCLIENTACTIVETEXTUREPROC glad_glClientActiveTexture = NULL;
+void APIENTRY glad_debug_impl_glClientActiveTexture(GLenum arg0) {
+    _pre_call_callback("glClientActiveTexture", (void*)glClientActiveTexture, 1, arg0);
+    glad_glClientActiveTexture(arg0);
+    _post_call_callback("glClientActiveTexture", (void*)glClientActiveTexture, 1, arg0);
+}
+PFNGLCLIENTACTIVETEXTUREPROC glad_debug_glClientActiveTexture = glad_debug_impl_glClientActiveTexture;
 PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
+GLenum APIENTRY glad_debug_impl_glClientWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+    GLenum ret;
+    _pre_call_callback("glClientWaitSync", (void*)glClientWaitSync, 3, arg0, arg1, arg2);
+    ret = glad_glClientWaitSync(arg0, arg1, arg2);
+    _post_call_callback("glClientWaitSync", (void*)glClientWaitSync, 3, arg0, arg1, arg2);
+    return ret;
+}
+PFNGLCLIENTWAITSYNCPROC glad_debug_glClientWaitSync = glad_debug_impl_glClientWaitSync;
 PFNGLCLIPPLANEPROC glad_glClipPlane = NULL;
+void APIENTRY glad_debug_impl_glClipPlane(GLenum arg0, const GLdouble * arg1) {
+    _pre_call_callback("glClipPlane", (void*)glClipPlane, 2, arg0, arg1);
+    glad_glClipPlane(arg0, arg1);
+    _post_call_callback("glClipPlane", (void*)glClipPlane, 2, arg0, arg1);
+}
+PFNGLCLIPPLANEPROC glad_debug_glClipPlane = glad_debug_impl_glClipPlane;
 PFNGLCOLOR3BPROC glad_glColor3b = NULL;
+void APIENTRY glad_debug_impl_glColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+    _pre_call_callback("glColor3b", (void*)glColor3b, 3, arg0, arg1, arg2);
+    glad_glColor3b(arg0, arg1, arg2);
+    _post_call_callback("glColor3b", (void*)glColor3b, 3, arg0, arg1, arg2);
+}
+PFNGLCOLOR3BPROC glad_debug_glColor3b = glad_debug_impl_glColor3b;
 PFNGLCOLOR3BVPROC glad_glColor3bv = NULL;
+void APIENTRY glad_debug_impl_glColor3bv(const GLbyte * arg0) {
+    _pre_call_callback("glColor3bv", (void*)glColor3bv, 1, arg0);
+    glad_glColor3bv(arg0);
+    _post_call_callback("glColor3bv", (void*)glColor3bv, 1, arg0);
+}
+PFNGLCOLOR3BVPROC glad_debug_glColor3bv = glad_debug_impl_glColor3bv;
 PFNGLCOLOR3DPROC glad_glColor3d = NULL;
+void APIENTRY glad_debug_impl_glColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glColor3d", (void*)glColor3d, 3, arg0, arg1, arg2);
+    glad_glColor3d(arg0, arg1, arg2);
+    _post_call_callback("glColor3d", (void*)glColor3d, 3, arg0, arg1, arg2);
+}
+PFNGLCOLOR3DPROC glad_debug_glColor3d = glad_debug_impl_glColor3d;
 PFNGLCOLOR3DVPROC glad_glColor3dv = NULL;
+void APIENTRY glad_debug_impl_glColor3dv(const GLdouble * arg0) {
+    _pre_call_callback("glColor3dv", (void*)glColor3dv, 1, arg0);
+    glad_glColor3dv(arg0);
+    _post_call_callback("glColor3dv", (void*)glColor3dv, 1, arg0);
+}
+PFNGLCOLOR3DVPROC glad_debug_glColor3dv = glad_debug_impl_glColor3dv;
 PFNGLCOLOR3FPROC glad_glColor3f = NULL;
+void APIENTRY glad_debug_impl_glColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glColor3f", (void*)glColor3f, 3, arg0, arg1, arg2);
+    glad_glColor3f(arg0, arg1, arg2);
+    _post_call_callback("glColor3f", (void*)glColor3f, 3, arg0, arg1, arg2);
+}
+PFNGLCOLOR3FPROC glad_debug_glColor3f = glad_debug_impl_glColor3f;
 PFNGLCOLOR3FVPROC glad_glColor3fv = NULL;
+void APIENTRY glad_debug_impl_glColor3fv(const GLfloat * arg0) {
+    _pre_call_callback("glColor3fv", (void*)glColor3fv, 1, arg0);
+    glad_glColor3fv(arg0);
+    _post_call_callback("glColor3fv", (void*)glColor3fv, 1, arg0);
+}
+PFNGLCOLOR3FVPROC glad_debug_glColor3fv = glad_debug_impl_glColor3fv;
 PFNGLCOLOR3IPROC glad_glColor3i = NULL;
+void APIENTRY glad_debug_impl_glColor3i(GLint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glColor3i", (void*)glColor3i, 3, arg0, arg1, arg2);
+    glad_glColor3i(arg0, arg1, arg2);
+    _post_call_callback("glColor3i", (void*)glColor3i, 3, arg0, arg1, arg2);
+}
+PFNGLCOLOR3IPROC glad_debug_glColor3i = glad_debug_impl_glColor3i;
 PFNGLCOLOR3IVPROC glad_glColor3iv = NULL;
+void APIENTRY glad_debug_impl_glColor3iv(const GLint * arg0) {
+    _pre_call_callback("glColor3iv", (void*)glColor3iv, 1, arg0);
+    glad_glColor3iv(arg0);
+    _post_call_callback("glColor3iv", (void*)glColor3iv, 1, arg0);
+}
+PFNGLCOLOR3IVPROC glad_debug_glColor3iv = glad_debug_impl_glColor3iv;
 PFNGLCOLOR3SPROC glad_glColor3s = NULL;
+void APIENTRY glad_debug_impl_glColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glColor3s", (void*)glColor3s, 3, arg0, arg1, arg2);
+    glad_glColor3s(arg0, arg1, arg2);
+    _post_call_callback("glColor3s", (void*)glColor3s, 3, arg0, arg1, arg2);
+}
+PFNGLCOLOR3SPROC glad_debug_glColor3s = glad_debug_impl_glColor3s;
 PFNGLCOLOR3SVPROC glad_glColor3sv = NULL;
+void APIENTRY glad_debug_impl_glColor3sv(const GLshort * arg0) {
+    _pre_call_callback("glColor3sv", (void*)glColor3sv, 1, arg0);
+    glad_glColor3sv(arg0);
+    _post_call_callback("glColor3sv", (void*)glColor3sv, 1, arg0);
+}
+PFNGLCOLOR3SVPROC glad_debug_glColor3sv = glad_debug_impl_glColor3sv;
 PFNGLCOLOR3UBPROC glad_glColor3ub = NULL;
+void APIENTRY glad_debug_impl_glColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+    _pre_call_callback("glColor3ub", (void*)glColor3ub, 3, arg0, arg1, arg2);
+    glad_glColor3ub(arg0, arg1, arg2);
+    _post_call_callback("glColor3ub", (void*)glColor3ub, 3, arg0, arg1, arg2);
+}
+PFNGLCOLOR3UBPROC glad_debug_glColor3ub = glad_debug_impl_glColor3ub;
 PFNGLCOLOR3UBVPROC glad_glColor3ubv = NULL;
+void APIENTRY glad_debug_impl_glColor3ubv(const GLubyte * arg0) {
+    _pre_call_callback("glColor3ubv", (void*)glColor3ubv, 1, arg0);
+    glad_glColor3ubv(arg0);
+    _post_call_callback("glColor3ubv", (void*)glColor3ubv, 1, arg0);
+}
+PFNGLCOLOR3UBVPROC glad_debug_glColor3ubv = glad_debug_impl_glColor3ubv;
 PFNGLCOLOR3UIPROC glad_glColor3ui = NULL;
+void APIENTRY glad_debug_impl_glColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glColor3ui", (void*)glColor3ui, 3, arg0, arg1, arg2);
+    glad_glColor3ui(arg0, arg1, arg2);
+    _post_call_callback("glColor3ui", (void*)glColor3ui, 3, arg0, arg1, arg2);
+}
+PFNGLCOLOR3UIPROC glad_debug_glColor3ui = glad_debug_impl_glColor3ui;
 PFNGLCOLOR3UIVPROC glad_glColor3uiv = NULL;
+void APIENTRY glad_debug_impl_glColor3uiv(const GLuint * arg0) {
+    _pre_call_callback("glColor3uiv", (void*)glColor3uiv, 1, arg0);
+    glad_glColor3uiv(arg0);
+    _post_call_callback("glColor3uiv", (void*)glColor3uiv, 1, arg0);
+}
+PFNGLCOLOR3UIVPROC glad_debug_glColor3uiv = glad_debug_impl_glColor3uiv;
 PFNGLCOLOR3USPROC glad_glColor3us = NULL;
+void APIENTRY glad_debug_impl_glColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+    _pre_call_callback("glColor3us", (void*)glColor3us, 3, arg0, arg1, arg2);
+    glad_glColor3us(arg0, arg1, arg2);
+    _post_call_callback("glColor3us", (void*)glColor3us, 3, arg0, arg1, arg2);
+}
+PFNGLCOLOR3USPROC glad_debug_glColor3us = glad_debug_impl_glColor3us;
 PFNGLCOLOR3USVPROC glad_glColor3usv = NULL;
+void APIENTRY glad_debug_impl_glColor3usv(const GLushort * arg0) {
+    _pre_call_callback("glColor3usv", (void*)glColor3usv, 1, arg0);
+    glad_glColor3usv(arg0);
+    _post_call_callback("glColor3usv", (void*)glColor3usv, 1, arg0);
+}
+PFNGLCOLOR3USVPROC glad_debug_glColor3usv = glad_debug_impl_glColor3usv;
 PFNGLCOLOR4BPROC glad_glColor4b = NULL;
+void APIENTRY glad_debug_impl_glColor4b(GLbyte arg0, GLbyte arg1, GLbyte arg2, GLbyte arg3) {
+    _pre_call_callback("glColor4b", (void*)glColor4b, 4, arg0, arg1, arg2, arg3);
+    glad_glColor4b(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColor4b", (void*)glColor4b, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLOR4BPROC glad_debug_glColor4b = glad_debug_impl_glColor4b;
 PFNGLCOLOR4BVPROC glad_glColor4bv = NULL;
+void APIENTRY glad_debug_impl_glColor4bv(const GLbyte * arg0) {
+    _pre_call_callback("glColor4bv", (void*)glColor4bv, 1, arg0);
+    glad_glColor4bv(arg0);
+    _post_call_callback("glColor4bv", (void*)glColor4bv, 1, arg0);
+}
+PFNGLCOLOR4BVPROC glad_debug_glColor4bv = glad_debug_impl_glColor4bv;
 PFNGLCOLOR4DPROC glad_glColor4d = NULL;
+void APIENTRY glad_debug_impl_glColor4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+    _pre_call_callback("glColor4d", (void*)glColor4d, 4, arg0, arg1, arg2, arg3);
+    glad_glColor4d(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColor4d", (void*)glColor4d, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLOR4DPROC glad_debug_glColor4d = glad_debug_impl_glColor4d;
 PFNGLCOLOR4DVPROC glad_glColor4dv = NULL;
+void APIENTRY glad_debug_impl_glColor4dv(const GLdouble * arg0) {
+    _pre_call_callback("glColor4dv", (void*)glColor4dv, 1, arg0);
+    glad_glColor4dv(arg0);
+    _post_call_callback("glColor4dv", (void*)glColor4dv, 1, arg0);
+}
+PFNGLCOLOR4DVPROC glad_debug_glColor4dv = glad_debug_impl_glColor4dv;
 PFNGLCOLOR4FPROC glad_glColor4f = NULL;
+void APIENTRY glad_debug_impl_glColor4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glColor4f", (void*)glColor4f, 4, arg0, arg1, arg2, arg3);
+    glad_glColor4f(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColor4f", (void*)glColor4f, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLOR4FPROC glad_debug_glColor4f = glad_debug_impl_glColor4f;
 PFNGLCOLOR4FVPROC glad_glColor4fv = NULL;
+void APIENTRY glad_debug_impl_glColor4fv(const GLfloat * arg0) {
+    _pre_call_callback("glColor4fv", (void*)glColor4fv, 1, arg0);
+    glad_glColor4fv(arg0);
+    _post_call_callback("glColor4fv", (void*)glColor4fv, 1, arg0);
+}
+PFNGLCOLOR4FVPROC glad_debug_glColor4fv = glad_debug_impl_glColor4fv;
 PFNGLCOLOR4IPROC glad_glColor4i = NULL;
+void APIENTRY glad_debug_impl_glColor4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glColor4i", (void*)glColor4i, 4, arg0, arg1, arg2, arg3);
+    glad_glColor4i(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColor4i", (void*)glColor4i, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLOR4IPROC glad_debug_glColor4i = glad_debug_impl_glColor4i;
 PFNGLCOLOR4IVPROC glad_glColor4iv = NULL;
+void APIENTRY glad_debug_impl_glColor4iv(const GLint * arg0) {
+    _pre_call_callback("glColor4iv", (void*)glColor4iv, 1, arg0);
+    glad_glColor4iv(arg0);
+    _post_call_callback("glColor4iv", (void*)glColor4iv, 1, arg0);
+}
+PFNGLCOLOR4IVPROC glad_debug_glColor4iv = glad_debug_impl_glColor4iv;
 PFNGLCOLOR4SPROC glad_glColor4s = NULL;
+void APIENTRY glad_debug_impl_glColor4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+    _pre_call_callback("glColor4s", (void*)glColor4s, 4, arg0, arg1, arg2, arg3);
+    glad_glColor4s(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColor4s", (void*)glColor4s, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLOR4SPROC glad_debug_glColor4s = glad_debug_impl_glColor4s;
 PFNGLCOLOR4SVPROC glad_glColor4sv = NULL;
+void APIENTRY glad_debug_impl_glColor4sv(const GLshort * arg0) {
+    _pre_call_callback("glColor4sv", (void*)glColor4sv, 1, arg0);
+    glad_glColor4sv(arg0);
+    _post_call_callback("glColor4sv", (void*)glColor4sv, 1, arg0);
+}
+PFNGLCOLOR4SVPROC glad_debug_glColor4sv = glad_debug_impl_glColor4sv;
 PFNGLCOLOR4UBPROC glad_glColor4ub = NULL;
+void APIENTRY glad_debug_impl_glColor4ub(GLubyte arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3) {
+    _pre_call_callback("glColor4ub", (void*)glColor4ub, 4, arg0, arg1, arg2, arg3);
+    glad_glColor4ub(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColor4ub", (void*)glColor4ub, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLOR4UBPROC glad_debug_glColor4ub = glad_debug_impl_glColor4ub;
 PFNGLCOLOR4UBVPROC glad_glColor4ubv = NULL;
+void APIENTRY glad_debug_impl_glColor4ubv(const GLubyte * arg0) {
+    _pre_call_callback("glColor4ubv", (void*)glColor4ubv, 1, arg0);
+    glad_glColor4ubv(arg0);
+    _post_call_callback("glColor4ubv", (void*)glColor4ubv, 1, arg0);
+}
+PFNGLCOLOR4UBVPROC glad_debug_glColor4ubv = glad_debug_impl_glColor4ubv;
 PFNGLCOLOR4UIPROC glad_glColor4ui = NULL;
+void APIENTRY glad_debug_impl_glColor4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+    _pre_call_callback("glColor4ui", (void*)glColor4ui, 4, arg0, arg1, arg2, arg3);
+    glad_glColor4ui(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColor4ui", (void*)glColor4ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLOR4UIPROC glad_debug_glColor4ui = glad_debug_impl_glColor4ui;
 PFNGLCOLOR4UIVPROC glad_glColor4uiv = NULL;
+void APIENTRY glad_debug_impl_glColor4uiv(const GLuint * arg0) {
+    _pre_call_callback("glColor4uiv", (void*)glColor4uiv, 1, arg0);
+    glad_glColor4uiv(arg0);
+    _post_call_callback("glColor4uiv", (void*)glColor4uiv, 1, arg0);
+}
+PFNGLCOLOR4UIVPROC glad_debug_glColor4uiv = glad_debug_impl_glColor4uiv;
 PFNGLCOLOR4USPROC glad_glColor4us = NULL;
+void APIENTRY glad_debug_impl_glColor4us(GLushort arg0, GLushort arg1, GLushort arg2, GLushort arg3) {
+    _pre_call_callback("glColor4us", (void*)glColor4us, 4, arg0, arg1, arg2, arg3);
+    glad_glColor4us(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColor4us", (void*)glColor4us, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLOR4USPROC glad_debug_glColor4us = glad_debug_impl_glColor4us;
 PFNGLCOLOR4USVPROC glad_glColor4usv = NULL;
+void APIENTRY glad_debug_impl_glColor4usv(const GLushort * arg0) {
+    _pre_call_callback("glColor4usv", (void*)glColor4usv, 1, arg0);
+    glad_glColor4usv(arg0);
+    _post_call_callback("glColor4usv", (void*)glColor4usv, 1, arg0);
+}
+PFNGLCOLOR4USVPROC glad_debug_glColor4usv = glad_debug_impl_glColor4usv;
 PFNGLCOLORMASKPROC glad_glColorMask = NULL;
+void APIENTRY glad_debug_impl_glColorMask(GLboolean arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3) {
+    _pre_call_callback("glColorMask", (void*)glColorMask, 4, arg0, arg1, arg2, arg3);
+    glad_glColorMask(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColorMask", (void*)glColorMask, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLORMASKPROC glad_debug_glColorMask = glad_debug_impl_glColorMask;
 PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
+void APIENTRY glad_debug_impl_glColorMaski(GLuint arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3, GLboolean arg4) {
+    _pre_call_callback("glColorMaski", (void*)glColorMaski, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glColorMaski(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glColorMaski", (void*)glColorMaski, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLCOLORMASKIPROC glad_debug_glColorMaski = glad_debug_impl_glColorMaski;
 PFNGLCOLORMATERIALPROC glad_glColorMaterial = NULL;
+void APIENTRY glad_debug_impl_glColorMaterial(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glColorMaterial", (void*)glColorMaterial, 2, arg0, arg1);
+    glad_glColorMaterial(arg0, arg1);
+    _post_call_callback("glColorMaterial", (void*)glColorMaterial, 2, arg0, arg1);
+}
+PFNGLCOLORMATERIALPROC glad_debug_glColorMaterial = glad_debug_impl_glColorMaterial;
 PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
+void APIENTRY glad_debug_impl_glColorP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glColorP3ui", (void*)glColorP3ui, 2, arg0, arg1);
+    glad_glColorP3ui(arg0, arg1);
+    _post_call_callback("glColorP3ui", (void*)glColorP3ui, 2, arg0, arg1);
+}
+PFNGLCOLORP3UIPROC glad_debug_glColorP3ui = glad_debug_impl_glColorP3ui;
 PFNGLCOLORP3UIVPROC glad_glColorP3uiv = NULL;
+void APIENTRY glad_debug_impl_glColorP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glColorP3uiv", (void*)glColorP3uiv, 2, arg0, arg1);
+    glad_glColorP3uiv(arg0, arg1);
+    _post_call_callback("glColorP3uiv", (void*)glColorP3uiv, 2, arg0, arg1);
+}
+PFNGLCOLORP3UIVPROC glad_debug_glColorP3uiv = glad_debug_impl_glColorP3uiv;
 PFNGLCOLORP4UIPROC glad_glColorP4ui = NULL;
+void APIENTRY glad_debug_impl_glColorP4ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glColorP4ui", (void*)glColorP4ui, 2, arg0, arg1);
+    glad_glColorP4ui(arg0, arg1);
+    _post_call_callback("glColorP4ui", (void*)glColorP4ui, 2, arg0, arg1);
+}
+PFNGLCOLORP4UIPROC glad_debug_glColorP4ui = glad_debug_impl_glColorP4ui;
 PFNGLCOLORP4UIVPROC glad_glColorP4uiv = NULL;
+void APIENTRY glad_debug_impl_glColorP4uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glColorP4uiv", (void*)glColorP4uiv, 2, arg0, arg1);
+    glad_glColorP4uiv(arg0, arg1);
+    _post_call_callback("glColorP4uiv", (void*)glColorP4uiv, 2, arg0, arg1);
+}
+PFNGLCOLORP4UIVPROC glad_debug_glColorP4uiv = glad_debug_impl_glColorP4uiv;
 PFNGLCOLORPOINTERPROC glad_glColorPointer = NULL;
+void APIENTRY glad_debug_impl_glColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+    _pre_call_callback("glColorPointer", (void*)glColorPointer, 4, arg0, arg1, arg2, arg3);
+    glad_glColorPointer(arg0, arg1, arg2, arg3);
+    _post_call_callback("glColorPointer", (void*)glColorPointer, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLCOLORPOINTERPROC glad_debug_glColorPointer = glad_debug_impl_glColorPointer;
 PFNGLCOMPILESHADERPROC glad_glCompileShader = NULL;
+void APIENTRY glad_debug_impl_glCompileShader(GLuint arg0) {
+    _pre_call_callback("glCompileShader", (void*)glCompileShader, 1, arg0);
+    glad_glCompileShader(arg0);
+    _post_call_callback("glCompileShader", (void*)glCompileShader, 1, arg0);
+}
+PFNGLCOMPILESHADERPROC glad_debug_glCompileShader = glad_debug_impl_glCompileShader;
 PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = NULL;
+void APIENTRY glad_debug_impl_glCompressedTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLint arg4, GLsizei arg5, const void * arg6) {
+    _pre_call_callback("glCompressedTexImage1D", (void*)glCompressedTexImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glCompressedTexImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glCompressedTexImage1D", (void*)glCompressedTexImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_glCompressedTexImage1D = glad_debug_impl_glCompressedTexImage1D;
 PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = NULL;
+void APIENTRY glad_debug_impl_glCompressedTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLsizei arg6, const void * arg7) {
+    _pre_call_callback("glCompressedTexImage2D", (void*)glCompressedTexImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    glad_glCompressedTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    _post_call_callback("glCompressedTexImage2D", (void*)glCompressedTexImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_glCompressedTexImage2D = glad_debug_impl_glCompressedTexImage2D;
 PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
+void APIENTRY glad_debug_impl_glCompressedTexImage3D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLsizei arg7, const void * arg8) {
+    _pre_call_callback("glCompressedTexImage3D", (void*)glCompressedTexImage3D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    glad_glCompressedTexImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glCompressedTexImage3D", (void*)glCompressedTexImage3D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_glCompressedTexImage3D = glad_debug_impl_glCompressedTexImage3D;
 PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
+void APIENTRY glad_debug_impl_glCompressedTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+    _pre_call_callback("glCompressedTexSubImage1D", (void*)glCompressedTexSubImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glCompressedTexSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glCompressedTexSubImage1D", (void*)glCompressedTexSubImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_glCompressedTexSubImage1D = glad_debug_impl_glCompressedTexSubImage1D;
 PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
+void APIENTRY glad_debug_impl_glCompressedTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+    _pre_call_callback("glCompressedTexSubImage2D", (void*)glCompressedTexSubImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    glad_glCompressedTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glCompressedTexSubImage2D", (void*)glCompressedTexSubImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_glCompressedTexSubImage2D = glad_debug_impl_glCompressedTexSubImage2D;
 PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
+void APIENTRY glad_debug_impl_glCompressedTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+    _pre_call_callback("glCompressedTexSubImage3D", (void*)glCompressedTexSubImage3D, 11, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+    glad_glCompressedTexSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+    _post_call_callback("glCompressedTexSubImage3D", (void*)glCompressedTexSubImage3D, 11, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_glCompressedTexSubImage3D = glad_debug_impl_glCompressedTexSubImage3D;
 PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
+void APIENTRY glad_debug_impl_glCopyBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+    _pre_call_callback("glCopyBufferSubData", (void*)glCopyBufferSubData, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glCopyBufferSubData(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glCopyBufferSubData", (void*)glCopyBufferSubData, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLCOPYBUFFERSUBDATAPROC glad_debug_glCopyBufferSubData = glad_debug_impl_glCopyBufferSubData;
 PFNGLCOPYPIXELSPROC glad_glCopyPixels = NULL;
+void APIENTRY glad_debug_impl_glCopyPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4) {
+    _pre_call_callback("glCopyPixels", (void*)glCopyPixels, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glCopyPixels(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glCopyPixels", (void*)glCopyPixels, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLCOPYPIXELSPROC glad_debug_glCopyPixels = glad_debug_impl_glCopyPixels;
 PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
+void APIENTRY glad_debug_impl_glCopyTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLint arg6) {
+    _pre_call_callback("glCopyTexImage1D", (void*)glCopyTexImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glCopyTexImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glCopyTexImage1D", (void*)glCopyTexImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLCOPYTEXIMAGE1DPROC glad_debug_glCopyTexImage1D = glad_debug_impl_glCopyTexImage1D;
 PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
+void APIENTRY glad_debug_impl_glCopyTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLint arg7) {
+    _pre_call_callback("glCopyTexImage2D", (void*)glCopyTexImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    glad_glCopyTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    _post_call_callback("glCopyTexImage2D", (void*)glCopyTexImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+PFNGLCOPYTEXIMAGE2DPROC glad_debug_glCopyTexImage2D = glad_debug_impl_glCopyTexImage2D;
 PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
+void APIENTRY glad_debug_impl_glCopyTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+    _pre_call_callback("glCopyTexSubImage1D", (void*)glCopyTexSubImage1D, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glCopyTexSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glCopyTexSubImage1D", (void*)glCopyTexSubImage1D, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_glCopyTexSubImage1D = glad_debug_impl_glCopyTexSubImage1D;
 PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
+void APIENTRY glad_debug_impl_glCopyTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+    _pre_call_callback("glCopyTexSubImage2D", (void*)glCopyTexSubImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    glad_glCopyTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    _post_call_callback("glCopyTexSubImage2D", (void*)glCopyTexSubImage2D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_glCopyTexSubImage2D = glad_debug_impl_glCopyTexSubImage2D;
 PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
+void APIENTRY glad_debug_impl_glCopyTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+    _pre_call_callback("glCopyTexSubImage3D", (void*)glCopyTexSubImage3D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    glad_glCopyTexSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glCopyTexSubImage3D", (void*)glCopyTexSubImage3D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_glCopyTexSubImage3D = glad_debug_impl_glCopyTexSubImage3D;
 PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
+GLuint APIENTRY glad_debug_impl_glCreateProgram(void) {
+    GLuint ret;
+    _pre_call_callback("glCreateProgram", (void*)glCreateProgram, 0);
+    ret = glad_glCreateProgram();
+    _post_call_callback("glCreateProgram", (void*)glCreateProgram, 0);
+    return ret;
+}
+PFNGLCREATEPROGRAMPROC glad_debug_glCreateProgram = glad_debug_impl_glCreateProgram;
 PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
+GLuint APIENTRY glad_debug_impl_glCreateShader(GLenum arg0) {
+    GLuint ret;
+    _pre_call_callback("glCreateShader", (void*)glCreateShader, 1, arg0);
+    ret = glad_glCreateShader(arg0);
+    _post_call_callback("glCreateShader", (void*)glCreateShader, 1, arg0);
+    return ret;
+}
+PFNGLCREATESHADERPROC glad_debug_glCreateShader = glad_debug_impl_glCreateShader;
 PFNGLCULLFACEPROC glad_glCullFace = NULL;
+void APIENTRY glad_debug_impl_glCullFace(GLenum arg0) {
+    _pre_call_callback("glCullFace", (void*)glCullFace, 1, arg0);
+    glad_glCullFace(arg0);
+    _post_call_callback("glCullFace", (void*)glCullFace, 1, arg0);
+}
+PFNGLCULLFACEPROC glad_debug_glCullFace = glad_debug_impl_glCullFace;
+PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
+void APIENTRY glad_debug_impl_glDebugMessageCallback(GLDEBUGPROC arg0, const void * arg1) {
+    _pre_call_callback("glDebugMessageCallback", (void*)glDebugMessageCallback, 2, arg0, arg1);
+    glad_glDebugMessageCallback(arg0, arg1);
+    _post_call_callback("glDebugMessageCallback", (void*)glDebugMessageCallback, 2, arg0, arg1);
+}
+PFNGLDEBUGMESSAGECALLBACKPROC glad_debug_glDebugMessageCallback = glad_debug_impl_glDebugMessageCallback;
+PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
+void APIENTRY glad_debug_impl_glDebugMessageControl(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, const GLuint * arg4, GLboolean arg5) {
+    _pre_call_callback("glDebugMessageControl", (void*)glDebugMessageControl, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glDebugMessageControl(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glDebugMessageControl", (void*)glDebugMessageControl, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLDEBUGMESSAGECONTROLPROC glad_debug_glDebugMessageControl = glad_debug_impl_glDebugMessageControl;
+PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = NULL;
+void APIENTRY glad_debug_impl_glDebugMessageInsert(GLenum arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLsizei arg4, const GLchar * arg5) {
+    _pre_call_callback("glDebugMessageInsert", (void*)glDebugMessageInsert, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glDebugMessageInsert(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glDebugMessageInsert", (void*)glDebugMessageInsert, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLDEBUGMESSAGEINSERTPROC glad_debug_glDebugMessageInsert = glad_debug_impl_glDebugMessageInsert;
 PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
+void APIENTRY glad_debug_impl_glDeleteBuffers(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteBuffers", (void*)glDeleteBuffers, 2, arg0, arg1);
+    glad_glDeleteBuffers(arg0, arg1);
+    _post_call_callback("glDeleteBuffers", (void*)glDeleteBuffers, 2, arg0, arg1);
+}
+PFNGLDELETEBUFFERSPROC glad_debug_glDeleteBuffers = glad_debug_impl_glDeleteBuffers;
 PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
+void APIENTRY glad_debug_impl_glDeleteFramebuffers(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteFramebuffers", (void*)glDeleteFramebuffers, 2, arg0, arg1);
+    glad_glDeleteFramebuffers(arg0, arg1);
+    _post_call_callback("glDeleteFramebuffers", (void*)glDeleteFramebuffers, 2, arg0, arg1);
+}
+PFNGLDELETEFRAMEBUFFERSPROC glad_debug_glDeleteFramebuffers = glad_debug_impl_glDeleteFramebuffers;
 PFNGLDELETELISTSPROC glad_glDeleteLists = NULL;
+void APIENTRY glad_debug_impl_glDeleteLists(GLuint arg0, GLsizei arg1) {
+    _pre_call_callback("glDeleteLists", (void*)glDeleteLists, 2, arg0, arg1);
+    glad_glDeleteLists(arg0, arg1);
+    _post_call_callback("glDeleteLists", (void*)glDeleteLists, 2, arg0, arg1);
+}
+PFNGLDELETELISTSPROC glad_debug_glDeleteLists = glad_debug_impl_glDeleteLists;
 PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
+void APIENTRY glad_debug_impl_glDeleteProgram(GLuint arg0) {
+    _pre_call_callback("glDeleteProgram", (void*)glDeleteProgram, 1, arg0);
+    glad_glDeleteProgram(arg0);
+    _post_call_callback("glDeleteProgram", (void*)glDeleteProgram, 1, arg0);
+}
+PFNGLDELETEPROGRAMPROC glad_debug_glDeleteProgram = glad_debug_impl_glDeleteProgram;
 PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
+void APIENTRY glad_debug_impl_glDeleteQueries(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteQueries", (void*)glDeleteQueries, 2, arg0, arg1);
+    glad_glDeleteQueries(arg0, arg1);
+    _post_call_callback("glDeleteQueries", (void*)glDeleteQueries, 2, arg0, arg1);
+}
+PFNGLDELETEQUERIESPROC glad_debug_glDeleteQueries = glad_debug_impl_glDeleteQueries;
 PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
+void APIENTRY glad_debug_impl_glDeleteRenderbuffers(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteRenderbuffers", (void*)glDeleteRenderbuffers, 2, arg0, arg1);
+    glad_glDeleteRenderbuffers(arg0, arg1);
+    _post_call_callback("glDeleteRenderbuffers", (void*)glDeleteRenderbuffers, 2, arg0, arg1);
+}
+PFNGLDELETERENDERBUFFERSPROC glad_debug_glDeleteRenderbuffers = glad_debug_impl_glDeleteRenderbuffers;
 PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
+void APIENTRY glad_debug_impl_glDeleteSamplers(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteSamplers", (void*)glDeleteSamplers, 2, arg0, arg1);
+    glad_glDeleteSamplers(arg0, arg1);
+    _post_call_callback("glDeleteSamplers", (void*)glDeleteSamplers, 2, arg0, arg1);
+}
+PFNGLDELETESAMPLERSPROC glad_debug_glDeleteSamplers = glad_debug_impl_glDeleteSamplers;
 PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
+void APIENTRY glad_debug_impl_glDeleteShader(GLuint arg0) {
+    _pre_call_callback("glDeleteShader", (void*)glDeleteShader, 1, arg0);
+    glad_glDeleteShader(arg0);
+    _post_call_callback("glDeleteShader", (void*)glDeleteShader, 1, arg0);
+}
+PFNGLDELETESHADERPROC glad_debug_glDeleteShader = glad_debug_impl_glDeleteShader;
 PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
+void APIENTRY glad_debug_impl_glDeleteSync(GLsync arg0) {
+    _pre_call_callback("glDeleteSync", (void*)glDeleteSync, 1, arg0);
+    glad_glDeleteSync(arg0);
+    _post_call_callback("glDeleteSync", (void*)glDeleteSync, 1, arg0);
+}
+PFNGLDELETESYNCPROC glad_debug_glDeleteSync = glad_debug_impl_glDeleteSync;
 PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
+void APIENTRY glad_debug_impl_glDeleteTextures(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteTextures", (void*)glDeleteTextures, 2, arg0, arg1);
+    glad_glDeleteTextures(arg0, arg1);
+    _post_call_callback("glDeleteTextures", (void*)glDeleteTextures, 2, arg0, arg1);
+}
+PFNGLDELETETEXTURESPROC glad_debug_glDeleteTextures = glad_debug_impl_glDeleteTextures;
 PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
+void APIENTRY glad_debug_impl_glDeleteVertexArrays(GLsizei arg0, const GLuint * arg1) {
+    _pre_call_callback("glDeleteVertexArrays", (void*)glDeleteVertexArrays, 2, arg0, arg1);
+    glad_glDeleteVertexArrays(arg0, arg1);
+    _post_call_callback("glDeleteVertexArrays", (void*)glDeleteVertexArrays, 2, arg0, arg1);
+}
+PFNGLDELETEVERTEXARRAYSPROC glad_debug_glDeleteVertexArrays = glad_debug_impl_glDeleteVertexArrays;
 PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
+void APIENTRY glad_debug_impl_glDepthFunc(GLenum arg0) {
+    _pre_call_callback("glDepthFunc", (void*)glDepthFunc, 1, arg0);
+    glad_glDepthFunc(arg0);
+    _post_call_callback("glDepthFunc", (void*)glDepthFunc, 1, arg0);
+}
+PFNGLDEPTHFUNCPROC glad_debug_glDepthFunc = glad_debug_impl_glDepthFunc;
 PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
+void APIENTRY glad_debug_impl_glDepthMask(GLboolean arg0) {
+    _pre_call_callback("glDepthMask", (void*)glDepthMask, 1, arg0);
+    glad_glDepthMask(arg0);
+    _post_call_callback("glDepthMask", (void*)glDepthMask, 1, arg0);
+}
+PFNGLDEPTHMASKPROC glad_debug_glDepthMask = glad_debug_impl_glDepthMask;
 PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
+void APIENTRY glad_debug_impl_glDepthRange(GLdouble arg0, GLdouble arg1) {
+    _pre_call_callback("glDepthRange", (void*)glDepthRange, 2, arg0, arg1);
+    glad_glDepthRange(arg0, arg1);
+    _post_call_callback("glDepthRange", (void*)glDepthRange, 2, arg0, arg1);
+}
+PFNGLDEPTHRANGEPROC glad_debug_glDepthRange = glad_debug_impl_glDepthRange;
 PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
+void APIENTRY glad_debug_impl_glDetachShader(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glDetachShader", (void*)glDetachShader, 2, arg0, arg1);
+    glad_glDetachShader(arg0, arg1);
+    _post_call_callback("glDetachShader", (void*)glDetachShader, 2, arg0, arg1);
+}
+PFNGLDETACHSHADERPROC glad_debug_glDetachShader = glad_debug_impl_glDetachShader;
 PFNGLDISABLEPROC glad_glDisable = NULL;
+void APIENTRY glad_debug_impl_glDisable(GLenum arg0) {
+    _pre_call_callback("glDisable", (void*)glDisable, 1, arg0);
+    glad_glDisable(arg0);
+    _post_call_callback("glDisable", (void*)glDisable, 1, arg0);
+}
+PFNGLDISABLEPROC glad_debug_glDisable = glad_debug_impl_glDisable;
 PFNGLDISABLECLIENTSTATEPROC glad_glDisableClientState = NULL;
+void APIENTRY glad_debug_impl_glDisableClientState(GLenum arg0) {
+    _pre_call_callback("glDisableClientState", (void*)glDisableClientState, 1, arg0);
+    glad_glDisableClientState(arg0);
+    _post_call_callback("glDisableClientState", (void*)glDisableClientState, 1, arg0);
+}
+PFNGLDISABLECLIENTSTATEPROC glad_debug_glDisableClientState = glad_debug_impl_glDisableClientState;
 PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
+void APIENTRY glad_debug_impl_glDisableVertexAttribArray(GLuint arg0) {
+    _pre_call_callback("glDisableVertexAttribArray", (void*)glDisableVertexAttribArray, 1, arg0);
+    glad_glDisableVertexAttribArray(arg0);
+    _post_call_callback("glDisableVertexAttribArray", (void*)glDisableVertexAttribArray, 1, arg0);
+}
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_glDisableVertexAttribArray = glad_debug_impl_glDisableVertexAttribArray;
 PFNGLDISABLEIPROC glad_glDisablei = NULL;
+void APIENTRY glad_debug_impl_glDisablei(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glDisablei", (void*)glDisablei, 2, arg0, arg1);
+    glad_glDisablei(arg0, arg1);
+    _post_call_callback("glDisablei", (void*)glDisablei, 2, arg0, arg1);
+}
+PFNGLDISABLEIPROC glad_debug_glDisablei = glad_debug_impl_glDisablei;
 PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
+void APIENTRY glad_debug_impl_glDrawArrays(GLenum arg0, GLint arg1, GLsizei arg2) {
+    _pre_call_callback("glDrawArrays", (void*)glDrawArrays, 3, arg0, arg1, arg2);
+    glad_glDrawArrays(arg0, arg1, arg2);
+    _post_call_callback("glDrawArrays", (void*)glDrawArrays, 3, arg0, arg1, arg2);
+}
+PFNGLDRAWARRAYSPROC glad_debug_glDrawArrays = glad_debug_impl_glDrawArrays;
 PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
+void APIENTRY glad_debug_impl_glDrawArraysInstanced(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+    _pre_call_callback("glDrawArraysInstanced", (void*)glDrawArraysInstanced, 4, arg0, arg1, arg2, arg3);
+    glad_glDrawArraysInstanced(arg0, arg1, arg2, arg3);
+    _post_call_callback("glDrawArraysInstanced", (void*)glDrawArraysInstanced, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLDRAWARRAYSINSTANCEDPROC glad_debug_glDrawArraysInstanced = glad_debug_impl_glDrawArraysInstanced;
 PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
+void APIENTRY glad_debug_impl_glDrawBuffer(GLenum arg0) {
+    _pre_call_callback("glDrawBuffer", (void*)glDrawBuffer, 1, arg0);
+    glad_glDrawBuffer(arg0);
+    _post_call_callback("glDrawBuffer", (void*)glDrawBuffer, 1, arg0);
+}
+PFNGLDRAWBUFFERPROC glad_debug_glDrawBuffer = glad_debug_impl_glDrawBuffer;
 PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
+void APIENTRY glad_debug_impl_glDrawBuffers(GLsizei arg0, const GLenum * arg1) {
+    _pre_call_callback("glDrawBuffers", (void*)glDrawBuffers, 2, arg0, arg1);
+    glad_glDrawBuffers(arg0, arg1);
+    _post_call_callback("glDrawBuffers", (void*)glDrawBuffers, 2, arg0, arg1);
+}
+PFNGLDRAWBUFFERSPROC glad_debug_glDrawBuffers = glad_debug_impl_glDrawBuffers;
 PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
+void APIENTRY glad_debug_impl_glDrawElements(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3) {
+    _pre_call_callback("glDrawElements", (void*)glDrawElements, 4, arg0, arg1, arg2, arg3);
+    glad_glDrawElements(arg0, arg1, arg2, arg3);
+    _post_call_callback("glDrawElements", (void*)glDrawElements, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLDRAWELEMENTSPROC glad_debug_glDrawElements = glad_debug_impl_glDrawElements;
 PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
+void APIENTRY glad_debug_impl_glDrawElementsBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLint arg4) {
+    _pre_call_callback("glDrawElementsBaseVertex", (void*)glDrawElementsBaseVertex, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glDrawElementsBaseVertex(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glDrawElementsBaseVertex", (void*)glDrawElementsBaseVertex, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_debug_glDrawElementsBaseVertex = glad_debug_impl_glDrawElementsBaseVertex;
 PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
+void APIENTRY glad_debug_impl_glDrawElementsInstanced(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+    _pre_call_callback("glDrawElementsInstanced", (void*)glDrawElementsInstanced, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glDrawElementsInstanced(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glDrawElementsInstanced", (void*)glDrawElementsInstanced, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_debug_glDrawElementsInstanced = glad_debug_impl_glDrawElementsInstanced;
 PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
+void APIENTRY glad_debug_impl_glDrawElementsInstancedBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5) {
+    _pre_call_callback("glDrawElementsInstancedBaseVertex", (void*)glDrawElementsInstancedBaseVertex, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glDrawElementsInstancedBaseVertex(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glDrawElementsInstancedBaseVertex", (void*)glDrawElementsInstancedBaseVertex, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_debug_glDrawElementsInstancedBaseVertex = glad_debug_impl_glDrawElementsInstancedBaseVertex;
 PFNGLDRAWPIXELSPROC glad_glDrawPixels = NULL;
+void APIENTRY glad_debug_impl_glDrawPixels(GLsizei arg0, GLsizei arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+    _pre_call_callback("glDrawPixels", (void*)glDrawPixels, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glDrawPixels(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glDrawPixels", (void*)glDrawPixels, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLDRAWPIXELSPROC glad_debug_glDrawPixels = glad_debug_impl_glDrawPixels;
 PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
+void APIENTRY glad_debug_impl_glDrawRangeElements(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5) {
+    _pre_call_callback("glDrawRangeElements", (void*)glDrawRangeElements, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glDrawRangeElements(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glDrawRangeElements", (void*)glDrawRangeElements, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLDRAWRANGEELEMENTSPROC glad_debug_glDrawRangeElements = glad_debug_impl_glDrawRangeElements;
 PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
+void APIENTRY glad_debug_impl_glDrawRangeElementsBaseVertex(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5, GLint arg6) {
+    _pre_call_callback("glDrawRangeElementsBaseVertex", (void*)glDrawRangeElementsBaseVertex, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glDrawRangeElementsBaseVertex(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glDrawRangeElementsBaseVertex", (void*)glDrawRangeElementsBaseVertex, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_debug_glDrawRangeElementsBaseVertex = glad_debug_impl_glDrawRangeElementsBaseVertex;
 PFNGLEDGEFLAGPROC glad_glEdgeFlag = NULL;
+void APIENTRY glad_debug_impl_glEdgeFlag(GLboolean arg0) {
+    _pre_call_callback("glEdgeFlag", (void*)glEdgeFlag, 1, arg0);
+    glad_glEdgeFlag(arg0);
+    _post_call_callback("glEdgeFlag", (void*)glEdgeFlag, 1, arg0);
+}
+PFNGLEDGEFLAGPROC glad_debug_glEdgeFlag = glad_debug_impl_glEdgeFlag;
 PFNGLEDGEFLAGPOINTERPROC glad_glEdgeFlagPointer = NULL;
+void APIENTRY glad_debug_impl_glEdgeFlagPointer(GLsizei arg0, const void * arg1) {
+    _pre_call_callback("glEdgeFlagPointer", (void*)glEdgeFlagPointer, 2, arg0, arg1);
+    glad_glEdgeFlagPointer(arg0, arg1);
+    _post_call_callback("glEdgeFlagPointer", (void*)glEdgeFlagPointer, 2, arg0, arg1);
+}
+PFNGLEDGEFLAGPOINTERPROC glad_debug_glEdgeFlagPointer = glad_debug_impl_glEdgeFlagPointer;
 PFNGLEDGEFLAGVPROC glad_glEdgeFlagv = NULL;
+void APIENTRY glad_debug_impl_glEdgeFlagv(const GLboolean * arg0) {
+    _pre_call_callback("glEdgeFlagv", (void*)glEdgeFlagv, 1, arg0);
+    glad_glEdgeFlagv(arg0);
+    _post_call_callback("glEdgeFlagv", (void*)glEdgeFlagv, 1, arg0);
+}
+PFNGLEDGEFLAGVPROC glad_debug_glEdgeFlagv = glad_debug_impl_glEdgeFlagv;
 PFNGLENABLEPROC glad_glEnable = NULL;
+void APIENTRY glad_debug_impl_glEnable(GLenum arg0) {
+    _pre_call_callback("glEnable", (void*)glEnable, 1, arg0);
+    glad_glEnable(arg0);
+    _post_call_callback("glEnable", (void*)glEnable, 1, arg0);
+}
+PFNGLENABLEPROC glad_debug_glEnable = glad_debug_impl_glEnable;
 PFNGLENABLECLIENTSTATEPROC glad_glEnableClientState = NULL;
+void APIENTRY glad_debug_impl_glEnableClientState(GLenum arg0) {
+    _pre_call_callback("glEnableClientState", (void*)glEnableClientState, 1, arg0);
+    glad_glEnableClientState(arg0);
+    _post_call_callback("glEnableClientState", (void*)glEnableClientState, 1, arg0);
+}
+PFNGLENABLECLIENTSTATEPROC glad_debug_glEnableClientState = glad_debug_impl_glEnableClientState;
 PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
+void APIENTRY glad_debug_impl_glEnableVertexAttribArray(GLuint arg0) {
+    _pre_call_callback("glEnableVertexAttribArray", (void*)glEnableVertexAttribArray, 1, arg0);
+    glad_glEnableVertexAttribArray(arg0);
+    _post_call_callback("glEnableVertexAttribArray", (void*)glEnableVertexAttribArray, 1, arg0);
+}
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_glEnableVertexAttribArray = glad_debug_impl_glEnableVertexAttribArray;
 PFNGLENABLEIPROC glad_glEnablei = NULL;
+void APIENTRY glad_debug_impl_glEnablei(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glEnablei", (void*)glEnablei, 2, arg0, arg1);
+    glad_glEnablei(arg0, arg1);
+    _post_call_callback("glEnablei", (void*)glEnablei, 2, arg0, arg1);
+}
+PFNGLENABLEIPROC glad_debug_glEnablei = glad_debug_impl_glEnablei;
 PFNGLENDPROC glad_glEnd = NULL;
+void APIENTRY glad_debug_impl_glEnd(void) {
+    _pre_call_callback("glEnd", (void*)glEnd, 0);
+    glad_glEnd();
+    _post_call_callback("glEnd", (void*)glEnd, 0);
+}
+PFNGLENDPROC glad_debug_glEnd = glad_debug_impl_glEnd;
 PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
+void APIENTRY glad_debug_impl_glEndConditionalRender(void) {
+    _pre_call_callback("glEndConditionalRender", (void*)glEndConditionalRender, 0);
+    glad_glEndConditionalRender();
+    _post_call_callback("glEndConditionalRender", (void*)glEndConditionalRender, 0);
+}
+PFNGLENDCONDITIONALRENDERPROC glad_debug_glEndConditionalRender = glad_debug_impl_glEndConditionalRender;
 PFNGLENDLISTPROC glad_glEndList = NULL;
+void APIENTRY glad_debug_impl_glEndList(void) {
+    _pre_call_callback("glEndList", (void*)glEndList, 0);
+    glad_glEndList();
+    _post_call_callback("glEndList", (void*)glEndList, 0);
+}
+PFNGLENDLISTPROC glad_debug_glEndList = glad_debug_impl_glEndList;
 PFNGLENDQUERYPROC glad_glEndQuery = NULL;
+void APIENTRY glad_debug_impl_glEndQuery(GLenum arg0) {
+    _pre_call_callback("glEndQuery", (void*)glEndQuery, 1, arg0);
+    glad_glEndQuery(arg0);
+    _post_call_callback("glEndQuery", (void*)glEndQuery, 1, arg0);
+}
+PFNGLENDQUERYPROC glad_debug_glEndQuery = glad_debug_impl_glEndQuery;
 PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
+void APIENTRY glad_debug_impl_glEndTransformFeedback(void) {
+    _pre_call_callback("glEndTransformFeedback", (void*)glEndTransformFeedback, 0);
+    glad_glEndTransformFeedback();
+    _post_call_callback("glEndTransformFeedback", (void*)glEndTransformFeedback, 0);
+}
+PFNGLENDTRANSFORMFEEDBACKPROC glad_debug_glEndTransformFeedback = glad_debug_impl_glEndTransformFeedback;
 PFNGLEVALCOORD1DPROC glad_glEvalCoord1d = NULL;
+void APIENTRY glad_debug_impl_glEvalCoord1d(GLdouble arg0) {
+    _pre_call_callback("glEvalCoord1d", (void*)glEvalCoord1d, 1, arg0);
+    glad_glEvalCoord1d(arg0);
+    _post_call_callback("glEvalCoord1d", (void*)glEvalCoord1d, 1, arg0);
+}
+PFNGLEVALCOORD1DPROC glad_debug_glEvalCoord1d = glad_debug_impl_glEvalCoord1d;
 PFNGLEVALCOORD1DVPROC glad_glEvalCoord1dv = NULL;
+void APIENTRY glad_debug_impl_glEvalCoord1dv(const GLdouble * arg0) {
+    _pre_call_callback("glEvalCoord1dv", (void*)glEvalCoord1dv, 1, arg0);
+    glad_glEvalCoord1dv(arg0);
+    _post_call_callback("glEvalCoord1dv", (void*)glEvalCoord1dv, 1, arg0);
+}
+PFNGLEVALCOORD1DVPROC glad_debug_glEvalCoord1dv = glad_debug_impl_glEvalCoord1dv;
 PFNGLEVALCOORD1FPROC glad_glEvalCoord1f = NULL;
+void APIENTRY glad_debug_impl_glEvalCoord1f(GLfloat arg0) {
+    _pre_call_callback("glEvalCoord1f", (void*)glEvalCoord1f, 1, arg0);
+    glad_glEvalCoord1f(arg0);
+    _post_call_callback("glEvalCoord1f", (void*)glEvalCoord1f, 1, arg0);
+}
+PFNGLEVALCOORD1FPROC glad_debug_glEvalCoord1f = glad_debug_impl_glEvalCoord1f;
 PFNGLEVALCOORD1FVPROC glad_glEvalCoord1fv = NULL;
+void APIENTRY glad_debug_impl_glEvalCoord1fv(const GLfloat * arg0) {
+    _pre_call_callback("glEvalCoord1fv", (void*)glEvalCoord1fv, 1, arg0);
+    glad_glEvalCoord1fv(arg0);
+    _post_call_callback("glEvalCoord1fv", (void*)glEvalCoord1fv, 1, arg0);
+}
+PFNGLEVALCOORD1FVPROC glad_debug_glEvalCoord1fv = glad_debug_impl_glEvalCoord1fv;
 PFNGLEVALCOORD2DPROC glad_glEvalCoord2d = NULL;
+void APIENTRY glad_debug_impl_glEvalCoord2d(GLdouble arg0, GLdouble arg1) {
+    _pre_call_callback("glEvalCoord2d", (void*)glEvalCoord2d, 2, arg0, arg1);
+    glad_glEvalCoord2d(arg0, arg1);
+    _post_call_callback("glEvalCoord2d", (void*)glEvalCoord2d, 2, arg0, arg1);
+}
+PFNGLEVALCOORD2DPROC glad_debug_glEvalCoord2d = glad_debug_impl_glEvalCoord2d;
 PFNGLEVALCOORD2DVPROC glad_glEvalCoord2dv = NULL;
+void APIENTRY glad_debug_impl_glEvalCoord2dv(const GLdouble * arg0) {
+    _pre_call_callback("glEvalCoord2dv", (void*)glEvalCoord2dv, 1, arg0);
+    glad_glEvalCoord2dv(arg0);
+    _post_call_callback("glEvalCoord2dv", (void*)glEvalCoord2dv, 1, arg0);
+}
+PFNGLEVALCOORD2DVPROC glad_debug_glEvalCoord2dv = glad_debug_impl_glEvalCoord2dv;
 PFNGLEVALCOORD2FPROC glad_glEvalCoord2f = NULL;
+void APIENTRY glad_debug_impl_glEvalCoord2f(GLfloat arg0, GLfloat arg1) {
+    _pre_call_callback("glEvalCoord2f", (void*)glEvalCoord2f, 2, arg0, arg1);
+    glad_glEvalCoord2f(arg0, arg1);
+    _post_call_callback("glEvalCoord2f", (void*)glEvalCoord2f, 2, arg0, arg1);
+}
+PFNGLEVALCOORD2FPROC glad_debug_glEvalCoord2f = glad_debug_impl_glEvalCoord2f;
 PFNGLEVALCOORD2FVPROC glad_glEvalCoord2fv = NULL;
+void APIENTRY glad_debug_impl_glEvalCoord2fv(const GLfloat * arg0) {
+    _pre_call_callback("glEvalCoord2fv", (void*)glEvalCoord2fv, 1, arg0);
+    glad_glEvalCoord2fv(arg0);
+    _post_call_callback("glEvalCoord2fv", (void*)glEvalCoord2fv, 1, arg0);
+}
+PFNGLEVALCOORD2FVPROC glad_debug_glEvalCoord2fv = glad_debug_impl_glEvalCoord2fv;
 PFNGLEVALMESH1PROC glad_glEvalMesh1 = NULL;
+void APIENTRY glad_debug_impl_glEvalMesh1(GLenum arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glEvalMesh1", (void*)glEvalMesh1, 3, arg0, arg1, arg2);
+    glad_glEvalMesh1(arg0, arg1, arg2);
+    _post_call_callback("glEvalMesh1", (void*)glEvalMesh1, 3, arg0, arg1, arg2);
+}
+PFNGLEVALMESH1PROC glad_debug_glEvalMesh1 = glad_debug_impl_glEvalMesh1;
 PFNGLEVALMESH2PROC glad_glEvalMesh2 = NULL;
+void APIENTRY glad_debug_impl_glEvalMesh2(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+    _pre_call_callback("glEvalMesh2", (void*)glEvalMesh2, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glEvalMesh2(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glEvalMesh2", (void*)glEvalMesh2, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLEVALMESH2PROC glad_debug_glEvalMesh2 = glad_debug_impl_glEvalMesh2;
 PFNGLEVALPOINT1PROC glad_glEvalPoint1 = NULL;
+void APIENTRY glad_debug_impl_glEvalPoint1(GLint arg0) {
+    _pre_call_callback("glEvalPoint1", (void*)glEvalPoint1, 1, arg0);
+    glad_glEvalPoint1(arg0);
+    _post_call_callback("glEvalPoint1", (void*)glEvalPoint1, 1, arg0);
+}
+PFNGLEVALPOINT1PROC glad_debug_glEvalPoint1 = glad_debug_impl_glEvalPoint1;
 PFNGLEVALPOINT2PROC glad_glEvalPoint2 = NULL;
+void APIENTRY glad_debug_impl_glEvalPoint2(GLint arg0, GLint arg1) {
+    _pre_call_callback("glEvalPoint2", (void*)glEvalPoint2, 2, arg0, arg1);
+    glad_glEvalPoint2(arg0, arg1);
+    _post_call_callback("glEvalPoint2", (void*)glEvalPoint2, 2, arg0, arg1);
+}
+PFNGLEVALPOINT2PROC glad_debug_glEvalPoint2 = glad_debug_impl_glEvalPoint2;
 PFNGLFEEDBACKBUFFERPROC glad_glFeedbackBuffer = NULL;
+void APIENTRY glad_debug_impl_glFeedbackBuffer(GLsizei arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glFeedbackBuffer", (void*)glFeedbackBuffer, 3, arg0, arg1, arg2);
+    glad_glFeedbackBuffer(arg0, arg1, arg2);
+    _post_call_callback("glFeedbackBuffer", (void*)glFeedbackBuffer, 3, arg0, arg1, arg2);
+}
+PFNGLFEEDBACKBUFFERPROC glad_debug_glFeedbackBuffer = glad_debug_impl_glFeedbackBuffer;
 PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
+GLsync APIENTRY glad_debug_impl_glFenceSync(GLenum arg0, GLbitfield arg1) {
+    GLsync ret;
+    _pre_call_callback("glFenceSync", (void*)glFenceSync, 2, arg0, arg1);
+    ret = glad_glFenceSync(arg0, arg1);
+    _post_call_callback("glFenceSync", (void*)glFenceSync, 2, arg0, arg1);
+    return ret;
+}
+PFNGLFENCESYNCPROC glad_debug_glFenceSync = glad_debug_impl_glFenceSync;
 PFNGLFINISHPROC glad_glFinish = NULL;
+void APIENTRY glad_debug_impl_glFinish(void) {
+    _pre_call_callback("glFinish", (void*)glFinish, 0);
+    glad_glFinish();
+    _post_call_callback("glFinish", (void*)glFinish, 0);
+}
+PFNGLFINISHPROC glad_debug_glFinish = glad_debug_impl_glFinish;
 PFNGLFLUSHPROC glad_glFlush = NULL;
+void APIENTRY glad_debug_impl_glFlush(void) {
+    _pre_call_callback("glFlush", (void*)glFlush, 0);
+    glad_glFlush();
+    _post_call_callback("glFlush", (void*)glFlush, 0);
+}
+PFNGLFLUSHPROC glad_debug_glFlush = glad_debug_impl_glFlush;
 PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
+void APIENTRY glad_debug_impl_glFlushMappedBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2) {
+    _pre_call_callback("glFlushMappedBufferRange", (void*)glFlushMappedBufferRange, 3, arg0, arg1, arg2);
+    glad_glFlushMappedBufferRange(arg0, arg1, arg2);
+    _post_call_callback("glFlushMappedBufferRange", (void*)glFlushMappedBufferRange, 3, arg0, arg1, arg2);
+}
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_debug_glFlushMappedBufferRange = glad_debug_impl_glFlushMappedBufferRange;
 PFNGLFOGCOORDPOINTERPROC glad_glFogCoordPointer = NULL;
+void APIENTRY glad_debug_impl_glFogCoordPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+    _pre_call_callback("glFogCoordPointer", (void*)glFogCoordPointer, 3, arg0, arg1, arg2);
+    glad_glFogCoordPointer(arg0, arg1, arg2);
+    _post_call_callback("glFogCoordPointer", (void*)glFogCoordPointer, 3, arg0, arg1, arg2);
+}
+PFNGLFOGCOORDPOINTERPROC glad_debug_glFogCoordPointer = glad_debug_impl_glFogCoordPointer;
 PFNGLFOGCOORDDPROC glad_glFogCoordd = NULL;
+void APIENTRY glad_debug_impl_glFogCoordd(GLdouble arg0) {
+    _pre_call_callback("glFogCoordd", (void*)glFogCoordd, 1, arg0);
+    glad_glFogCoordd(arg0);
+    _post_call_callback("glFogCoordd", (void*)glFogCoordd, 1, arg0);
+}
+PFNGLFOGCOORDDPROC glad_debug_glFogCoordd = glad_debug_impl_glFogCoordd;
 PFNGLFOGCOORDDVPROC glad_glFogCoorddv = NULL;
+void APIENTRY glad_debug_impl_glFogCoorddv(const GLdouble * arg0) {
+    _pre_call_callback("glFogCoorddv", (void*)glFogCoorddv, 1, arg0);
+    glad_glFogCoorddv(arg0);
+    _post_call_callback("glFogCoorddv", (void*)glFogCoorddv, 1, arg0);
+}
+PFNGLFOGCOORDDVPROC glad_debug_glFogCoorddv = glad_debug_impl_glFogCoorddv;
 PFNGLFOGCOORDFPROC glad_glFogCoordf = NULL;
+void APIENTRY glad_debug_impl_glFogCoordf(GLfloat arg0) {
+    _pre_call_callback("glFogCoordf", (void*)glFogCoordf, 1, arg0);
+    glad_glFogCoordf(arg0);
+    _post_call_callback("glFogCoordf", (void*)glFogCoordf, 1, arg0);
+}
+PFNGLFOGCOORDFPROC glad_debug_glFogCoordf = glad_debug_impl_glFogCoordf;
 PFNGLFOGCOORDFVPROC glad_glFogCoordfv = NULL;
+void APIENTRY glad_debug_impl_glFogCoordfv(const GLfloat * arg0) {
+    _pre_call_callback("glFogCoordfv", (void*)glFogCoordfv, 1, arg0);
+    glad_glFogCoordfv(arg0);
+    _post_call_callback("glFogCoordfv", (void*)glFogCoordfv, 1, arg0);
+}
+PFNGLFOGCOORDFVPROC glad_debug_glFogCoordfv = glad_debug_impl_glFogCoordfv;
 PFNGLFOGFPROC glad_glFogf = NULL;
+void APIENTRY glad_debug_impl_glFogf(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glFogf", (void*)glFogf, 2, arg0, arg1);
+    glad_glFogf(arg0, arg1);
+    _post_call_callback("glFogf", (void*)glFogf, 2, arg0, arg1);
+}
+PFNGLFOGFPROC glad_debug_glFogf = glad_debug_impl_glFogf;
 PFNGLFOGFVPROC glad_glFogfv = NULL;
+void APIENTRY glad_debug_impl_glFogfv(GLenum arg0, const GLfloat * arg1) {
+    _pre_call_callback("glFogfv", (void*)glFogfv, 2, arg0, arg1);
+    glad_glFogfv(arg0, arg1);
+    _post_call_callback("glFogfv", (void*)glFogfv, 2, arg0, arg1);
+}
+PFNGLFOGFVPROC glad_debug_glFogfv = glad_debug_impl_glFogfv;
 PFNGLFOGIPROC glad_glFogi = NULL;
+void APIENTRY glad_debug_impl_glFogi(GLenum arg0, GLint arg1) {
+    _pre_call_callback("glFogi", (void*)glFogi, 2, arg0, arg1);
+    glad_glFogi(arg0, arg1);
+    _post_call_callback("glFogi", (void*)glFogi, 2, arg0, arg1);
+}
+PFNGLFOGIPROC glad_debug_glFogi = glad_debug_impl_glFogi;
 PFNGLFOGIVPROC glad_glFogiv = NULL;
+void APIENTRY glad_debug_impl_glFogiv(GLenum arg0, const GLint * arg1) {
+    _pre_call_callback("glFogiv", (void*)glFogiv, 2, arg0, arg1);
+    glad_glFogiv(arg0, arg1);
+    _post_call_callback("glFogiv", (void*)glFogiv, 2, arg0, arg1);
+}
+PFNGLFOGIVPROC glad_debug_glFogiv = glad_debug_impl_glFogiv;
 PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
+void APIENTRY glad_debug_impl_glFramebufferRenderbuffer(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+    _pre_call_callback("glFramebufferRenderbuffer", (void*)glFramebufferRenderbuffer, 4, arg0, arg1, arg2, arg3);
+    glad_glFramebufferRenderbuffer(arg0, arg1, arg2, arg3);
+    _post_call_callback("glFramebufferRenderbuffer", (void*)glFramebufferRenderbuffer, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_glFramebufferRenderbuffer = glad_debug_impl_glFramebufferRenderbuffer;
 PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
+void APIENTRY glad_debug_impl_glFramebufferTexture(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+    _pre_call_callback("glFramebufferTexture", (void*)glFramebufferTexture, 4, arg0, arg1, arg2, arg3);
+    glad_glFramebufferTexture(arg0, arg1, arg2, arg3);
+    _post_call_callback("glFramebufferTexture", (void*)glFramebufferTexture, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLFRAMEBUFFERTEXTUREPROC glad_debug_glFramebufferTexture = glad_debug_impl_glFramebufferTexture;
 PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
+void APIENTRY glad_debug_impl_glFramebufferTexture1D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+    _pre_call_callback("glFramebufferTexture1D", (void*)glFramebufferTexture1D, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glFramebufferTexture1D(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glFramebufferTexture1D", (void*)glFramebufferTexture1D, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_glFramebufferTexture1D = glad_debug_impl_glFramebufferTexture1D;
 PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
+void APIENTRY glad_debug_impl_glFramebufferTexture2D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+    _pre_call_callback("glFramebufferTexture2D", (void*)glFramebufferTexture2D, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glFramebufferTexture2D(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glFramebufferTexture2D", (void*)glFramebufferTexture2D, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_glFramebufferTexture2D = glad_debug_impl_glFramebufferTexture2D;
 PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = NULL;
+void APIENTRY glad_debug_impl_glFramebufferTexture3D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4, GLint arg5) {
+    _pre_call_callback("glFramebufferTexture3D", (void*)glFramebufferTexture3D, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glFramebufferTexture3D(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glFramebufferTexture3D", (void*)glFramebufferTexture3D, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_glFramebufferTexture3D = glad_debug_impl_glFramebufferTexture3D;
 PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
+void APIENTRY glad_debug_impl_glFramebufferTextureLayer(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+    _pre_call_callback("glFramebufferTextureLayer", (void*)glFramebufferTextureLayer, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glFramebufferTextureLayer(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glFramebufferTextureLayer", (void*)glFramebufferTextureLayer, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_glFramebufferTextureLayer = glad_debug_impl_glFramebufferTextureLayer;
 PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
+void APIENTRY glad_debug_impl_glFrontFace(GLenum arg0) {
+    _pre_call_callback("glFrontFace", (void*)glFrontFace, 1, arg0);
+    glad_glFrontFace(arg0);
+    _post_call_callback("glFrontFace", (void*)glFrontFace, 1, arg0);
+}
+PFNGLFRONTFACEPROC glad_debug_glFrontFace = glad_debug_impl_glFrontFace;
 PFNGLFRUSTUMPROC glad_glFrustum = NULL;
+void APIENTRY glad_debug_impl_glFrustum(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+    _pre_call_callback("glFrustum", (void*)glFrustum, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glFrustum(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glFrustum", (void*)glFrustum, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLFRUSTUMPROC glad_debug_glFrustum = glad_debug_impl_glFrustum;
 PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
+void APIENTRY glad_debug_impl_glGenBuffers(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenBuffers", (void*)glGenBuffers, 2, arg0, arg1);
+    glad_glGenBuffers(arg0, arg1);
+    _post_call_callback("glGenBuffers", (void*)glGenBuffers, 2, arg0, arg1);
+}
+PFNGLGENBUFFERSPROC glad_debug_glGenBuffers = glad_debug_impl_glGenBuffers;
 PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
+void APIENTRY glad_debug_impl_glGenFramebuffers(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenFramebuffers", (void*)glGenFramebuffers, 2, arg0, arg1);
+    glad_glGenFramebuffers(arg0, arg1);
+    _post_call_callback("glGenFramebuffers", (void*)glGenFramebuffers, 2, arg0, arg1);
+}
+PFNGLGENFRAMEBUFFERSPROC glad_debug_glGenFramebuffers = glad_debug_impl_glGenFramebuffers;
 PFNGLGENLISTSPROC glad_glGenLists = NULL;
+GLuint APIENTRY glad_debug_impl_glGenLists(GLsizei arg0) {
+    GLuint ret;
+    _pre_call_callback("glGenLists", (void*)glGenLists, 1, arg0);
+    ret = glad_glGenLists(arg0);
+    _post_call_callback("glGenLists", (void*)glGenLists, 1, arg0);
+    return ret;
+}
+PFNGLGENLISTSPROC glad_debug_glGenLists = glad_debug_impl_glGenLists;
 PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
+void APIENTRY glad_debug_impl_glGenQueries(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenQueries", (void*)glGenQueries, 2, arg0, arg1);
+    glad_glGenQueries(arg0, arg1);
+    _post_call_callback("glGenQueries", (void*)glGenQueries, 2, arg0, arg1);
+}
+PFNGLGENQUERIESPROC glad_debug_glGenQueries = glad_debug_impl_glGenQueries;
 PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
+void APIENTRY glad_debug_impl_glGenRenderbuffers(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenRenderbuffers", (void*)glGenRenderbuffers, 2, arg0, arg1);
+    glad_glGenRenderbuffers(arg0, arg1);
+    _post_call_callback("glGenRenderbuffers", (void*)glGenRenderbuffers, 2, arg0, arg1);
+}
+PFNGLGENRENDERBUFFERSPROC glad_debug_glGenRenderbuffers = glad_debug_impl_glGenRenderbuffers;
 PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
+void APIENTRY glad_debug_impl_glGenSamplers(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenSamplers", (void*)glGenSamplers, 2, arg0, arg1);
+    glad_glGenSamplers(arg0, arg1);
+    _post_call_callback("glGenSamplers", (void*)glGenSamplers, 2, arg0, arg1);
+}
+PFNGLGENSAMPLERSPROC glad_debug_glGenSamplers = glad_debug_impl_glGenSamplers;
 PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
+void APIENTRY glad_debug_impl_glGenTextures(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenTextures", (void*)glGenTextures, 2, arg0, arg1);
+    glad_glGenTextures(arg0, arg1);
+    _post_call_callback("glGenTextures", (void*)glGenTextures, 2, arg0, arg1);
+}
+PFNGLGENTEXTURESPROC glad_debug_glGenTextures = glad_debug_impl_glGenTextures;
 PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
+void APIENTRY glad_debug_impl_glGenVertexArrays(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glGenVertexArrays", (void*)glGenVertexArrays, 2, arg0, arg1);
+    glad_glGenVertexArrays(arg0, arg1);
+    _post_call_callback("glGenVertexArrays", (void*)glGenVertexArrays, 2, arg0, arg1);
+}
+PFNGLGENVERTEXARRAYSPROC glad_debug_glGenVertexArrays = glad_debug_impl_glGenVertexArrays;
 PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
+void APIENTRY glad_debug_impl_glGenerateMipmap(GLenum arg0) {
+    _pre_call_callback("glGenerateMipmap", (void*)glGenerateMipmap, 1, arg0);
+    glad_glGenerateMipmap(arg0);
+    _post_call_callback("glGenerateMipmap", (void*)glGenerateMipmap, 1, arg0);
+}
+PFNGLGENERATEMIPMAPPROC glad_debug_glGenerateMipmap = glad_debug_impl_glGenerateMipmap;
 PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
+void APIENTRY glad_debug_impl_glGetActiveAttrib(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+    _pre_call_callback("glGetActiveAttrib", (void*)glGetActiveAttrib, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glGetActiveAttrib(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glGetActiveAttrib", (void*)glGetActiveAttrib, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLGETACTIVEATTRIBPROC glad_debug_glGetActiveAttrib = glad_debug_impl_glGetActiveAttrib;
 PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
+void APIENTRY glad_debug_impl_glGetActiveUniform(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+    _pre_call_callback("glGetActiveUniform", (void*)glGetActiveUniform, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glGetActiveUniform(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glGetActiveUniform", (void*)glGetActiveUniform, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLGETACTIVEUNIFORMPROC glad_debug_glGetActiveUniform = glad_debug_impl_glGetActiveUniform;
 PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
+void APIENTRY glad_debug_impl_glGetActiveUniformBlockName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+    _pre_call_callback("glGetActiveUniformBlockName", (void*)glGetActiveUniformBlockName, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glGetActiveUniformBlockName(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetActiveUniformBlockName", (void*)glGetActiveUniformBlockName, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_debug_glGetActiveUniformBlockName = glad_debug_impl_glGetActiveUniformBlockName;
 PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
+void APIENTRY glad_debug_impl_glGetActiveUniformBlockiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+    _pre_call_callback("glGetActiveUniformBlockiv", (void*)glGetActiveUniformBlockiv, 4, arg0, arg1, arg2, arg3);
+    glad_glGetActiveUniformBlockiv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetActiveUniformBlockiv", (void*)glGetActiveUniformBlockiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_debug_glGetActiveUniformBlockiv = glad_debug_impl_glGetActiveUniformBlockiv;
 PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = NULL;
+void APIENTRY glad_debug_impl_glGetActiveUniformName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+    _pre_call_callback("glGetActiveUniformName", (void*)glGetActiveUniformName, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glGetActiveUniformName(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetActiveUniformName", (void*)glGetActiveUniformName, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_debug_glGetActiveUniformName = glad_debug_impl_glGetActiveUniformName;
 PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = NULL;
+void APIENTRY glad_debug_impl_glGetActiveUniformsiv(GLuint arg0, GLsizei arg1, const GLuint * arg2, GLenum arg3, GLint * arg4) {
+    _pre_call_callback("glGetActiveUniformsiv", (void*)glGetActiveUniformsiv, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glGetActiveUniformsiv(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetActiveUniformsiv", (void*)glGetActiveUniformsiv, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETACTIVEUNIFORMSIVPROC glad_debug_glGetActiveUniformsiv = glad_debug_impl_glGetActiveUniformsiv;
 PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = NULL;
+void APIENTRY glad_debug_impl_glGetAttachedShaders(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLuint * arg3) {
+    _pre_call_callback("glGetAttachedShaders", (void*)glGetAttachedShaders, 4, arg0, arg1, arg2, arg3);
+    glad_glGetAttachedShaders(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetAttachedShaders", (void*)glGetAttachedShaders, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETATTACHEDSHADERSPROC glad_debug_glGetAttachedShaders = glad_debug_impl_glGetAttachedShaders;
 PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = NULL;
+GLint APIENTRY glad_debug_impl_glGetAttribLocation(GLuint arg0, const GLchar * arg1) {
+    GLint ret;
+    _pre_call_callback("glGetAttribLocation", (void*)glGetAttribLocation, 2, arg0, arg1);
+    ret = glad_glGetAttribLocation(arg0, arg1);
+    _post_call_callback("glGetAttribLocation", (void*)glGetAttribLocation, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETATTRIBLOCATIONPROC glad_debug_glGetAttribLocation = glad_debug_impl_glGetAttribLocation;
 PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = NULL;
+void APIENTRY glad_debug_impl_glGetBooleani_v(GLenum arg0, GLuint arg1, GLboolean * arg2) {
+    _pre_call_callback("glGetBooleani_v", (void*)glGetBooleani_v, 3, arg0, arg1, arg2);
+    glad_glGetBooleani_v(arg0, arg1, arg2);
+    _post_call_callback("glGetBooleani_v", (void*)glGetBooleani_v, 3, arg0, arg1, arg2);
+}
+PFNGLGETBOOLEANI_VPROC glad_debug_glGetBooleani_v = glad_debug_impl_glGetBooleani_v;
 PFNGLGETBOOLEANVPROC glad_glGetBooleanv = NULL;
+void APIENTRY glad_debug_impl_glGetBooleanv(GLenum arg0, GLboolean * arg1) {
+    _pre_call_callback("glGetBooleanv", (void*)glGetBooleanv, 2, arg0, arg1);
+    glad_glGetBooleanv(arg0, arg1);
+    _post_call_callback("glGetBooleanv", (void*)glGetBooleanv, 2, arg0, arg1);
+}
+PFNGLGETBOOLEANVPROC glad_debug_glGetBooleanv = glad_debug_impl_glGetBooleanv;
 PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = NULL;
+void APIENTRY glad_debug_impl_glGetBufferParameteri64v(GLenum arg0, GLenum arg1, GLint64 * arg2) {
+    _pre_call_callback("glGetBufferParameteri64v", (void*)glGetBufferParameteri64v, 3, arg0, arg1, arg2);
+    glad_glGetBufferParameteri64v(arg0, arg1, arg2);
+    _post_call_callback("glGetBufferParameteri64v", (void*)glGetBufferParameteri64v, 3, arg0, arg1, arg2);
+}
+PFNGLGETBUFFERPARAMETERI64VPROC glad_debug_glGetBufferParameteri64v = glad_debug_impl_glGetBufferParameteri64v;
 PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
+void APIENTRY glad_debug_impl_glGetBufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetBufferParameteriv", (void*)glGetBufferParameteriv, 3, arg0, arg1, arg2);
+    glad_glGetBufferParameteriv(arg0, arg1, arg2);
+    _post_call_callback("glGetBufferParameteriv", (void*)glGetBufferParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLGETBUFFERPARAMETERIVPROC glad_debug_glGetBufferParameteriv = glad_debug_impl_glGetBufferParameteriv;
 PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
+void APIENTRY glad_debug_impl_glGetBufferPointerv(GLenum arg0, GLenum arg1, void ** arg2) {
+    _pre_call_callback("glGetBufferPointerv", (void*)glGetBufferPointerv, 3, arg0, arg1, arg2);
+    glad_glGetBufferPointerv(arg0, arg1, arg2);
+    _post_call_callback("glGetBufferPointerv", (void*)glGetBufferPointerv, 3, arg0, arg1, arg2);
+}
+PFNGLGETBUFFERPOINTERVPROC glad_debug_glGetBufferPointerv = glad_debug_impl_glGetBufferPointerv;
 PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
+void APIENTRY glad_debug_impl_glGetBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+    _pre_call_callback("glGetBufferSubData", (void*)glGetBufferSubData, 4, arg0, arg1, arg2, arg3);
+    glad_glGetBufferSubData(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetBufferSubData", (void*)glGetBufferSubData, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETBUFFERSUBDATAPROC glad_debug_glGetBufferSubData = glad_debug_impl_glGetBufferSubData;
 PFNGLGETCLIPPLANEPROC glad_glGetClipPlane = NULL;
+void APIENTRY glad_debug_impl_glGetClipPlane(GLenum arg0, GLdouble * arg1) {
+    _pre_call_callback("glGetClipPlane", (void*)glGetClipPlane, 2, arg0, arg1);
+    glad_glGetClipPlane(arg0, arg1);
+    _post_call_callback("glGetClipPlane", (void*)glGetClipPlane, 2, arg0, arg1);
+}
+PFNGLGETCLIPPLANEPROC glad_debug_glGetClipPlane = glad_debug_impl_glGetClipPlane;
 PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
+void APIENTRY glad_debug_impl_glGetCompressedTexImage(GLenum arg0, GLint arg1, void * arg2) {
+    _pre_call_callback("glGetCompressedTexImage", (void*)glGetCompressedTexImage, 3, arg0, arg1, arg2);
+    glad_glGetCompressedTexImage(arg0, arg1, arg2);
+    _post_call_callback("glGetCompressedTexImage", (void*)glGetCompressedTexImage, 3, arg0, arg1, arg2);
+}
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_glGetCompressedTexImage = glad_debug_impl_glGetCompressedTexImage;
+PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = NULL;
+GLuint APIENTRY glad_debug_impl_glGetDebugMessageLog(GLuint arg0, GLsizei arg1, GLenum * arg2, GLenum * arg3, GLuint * arg4, GLenum * arg5, GLsizei * arg6, GLchar * arg7) {
+    GLuint ret;
+    _pre_call_callback("glGetDebugMessageLog", (void*)glGetDebugMessageLog, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    ret = glad_glGetDebugMessageLog(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    _post_call_callback("glGetDebugMessageLog", (void*)glGetDebugMessageLog, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    return ret;
+}
+PFNGLGETDEBUGMESSAGELOGPROC glad_debug_glGetDebugMessageLog = glad_debug_impl_glGetDebugMessageLog;
 PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
+void APIENTRY glad_debug_impl_glGetDoublev(GLenum arg0, GLdouble * arg1) {
+    _pre_call_callback("glGetDoublev", (void*)glGetDoublev, 2, arg0, arg1);
+    glad_glGetDoublev(arg0, arg1);
+    _post_call_callback("glGetDoublev", (void*)glGetDoublev, 2, arg0, arg1);
+}
+PFNGLGETDOUBLEVPROC glad_debug_glGetDoublev = glad_debug_impl_glGetDoublev;
 PFNGLGETERRORPROC glad_glGetError = NULL;
+GLenum APIENTRY glad_debug_impl_glGetError(void) {
+    GLenum ret;
+    _pre_call_callback("glGetError", (void*)glGetError, 0);
+    ret = glad_glGetError();
+    _post_call_callback("glGetError", (void*)glGetError, 0);
+    return ret;
+}
+PFNGLGETERRORPROC glad_debug_glGetError = glad_debug_impl_glGetError;
 PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
+void APIENTRY glad_debug_impl_glGetFloatv(GLenum arg0, GLfloat * arg1) {
+    _pre_call_callback("glGetFloatv", (void*)glGetFloatv, 2, arg0, arg1);
+    glad_glGetFloatv(arg0, arg1);
+    _post_call_callback("glGetFloatv", (void*)glGetFloatv, 2, arg0, arg1);
+}
+PFNGLGETFLOATVPROC glad_debug_glGetFloatv = glad_debug_impl_glGetFloatv;
 PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
+GLint APIENTRY glad_debug_impl_glGetFragDataIndex(GLuint arg0, const GLchar * arg1) {
+    GLint ret;
+    _pre_call_callback("glGetFragDataIndex", (void*)glGetFragDataIndex, 2, arg0, arg1);
+    ret = glad_glGetFragDataIndex(arg0, arg1);
+    _post_call_callback("glGetFragDataIndex", (void*)glGetFragDataIndex, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETFRAGDATAINDEXPROC glad_debug_glGetFragDataIndex = glad_debug_impl_glGetFragDataIndex;
 PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
+GLint APIENTRY glad_debug_impl_glGetFragDataLocation(GLuint arg0, const GLchar * arg1) {
+    GLint ret;
+    _pre_call_callback("glGetFragDataLocation", (void*)glGetFragDataLocation, 2, arg0, arg1);
+    ret = glad_glGetFragDataLocation(arg0, arg1);
+    _post_call_callback("glGetFragDataLocation", (void*)glGetFragDataLocation, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETFRAGDATALOCATIONPROC glad_debug_glGetFragDataLocation = glad_debug_impl_glGetFragDataLocation;
 PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
+void APIENTRY glad_debug_impl_glGetFramebufferAttachmentParameteriv(GLenum arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+    _pre_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glGetFramebufferAttachmentParameteriv, 4, arg0, arg1, arg2, arg3);
+    glad_glGetFramebufferAttachmentParameteriv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glGetFramebufferAttachmentParameteriv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetFramebufferAttachmentParameteriv = glad_debug_impl_glGetFramebufferAttachmentParameteriv;
 PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
+void APIENTRY glad_debug_impl_glGetInteger64i_v(GLenum arg0, GLuint arg1, GLint64 * arg2) {
+    _pre_call_callback("glGetInteger64i_v", (void*)glGetInteger64i_v, 3, arg0, arg1, arg2);
+    glad_glGetInteger64i_v(arg0, arg1, arg2);
+    _post_call_callback("glGetInteger64i_v", (void*)glGetInteger64i_v, 3, arg0, arg1, arg2);
+}
+PFNGLGETINTEGER64I_VPROC glad_debug_glGetInteger64i_v = glad_debug_impl_glGetInteger64i_v;
 PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
+void APIENTRY glad_debug_impl_glGetInteger64v(GLenum arg0, GLint64 * arg1) {
+    _pre_call_callback("glGetInteger64v", (void*)glGetInteger64v, 2, arg0, arg1);
+    glad_glGetInteger64v(arg0, arg1);
+    _post_call_callback("glGetInteger64v", (void*)glGetInteger64v, 2, arg0, arg1);
+}
+PFNGLGETINTEGER64VPROC glad_debug_glGetInteger64v = glad_debug_impl_glGetInteger64v;
 PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
+void APIENTRY glad_debug_impl_glGetIntegeri_v(GLenum arg0, GLuint arg1, GLint * arg2) {
+    _pre_call_callback("glGetIntegeri_v", (void*)glGetIntegeri_v, 3, arg0, arg1, arg2);
+    glad_glGetIntegeri_v(arg0, arg1, arg2);
+    _post_call_callback("glGetIntegeri_v", (void*)glGetIntegeri_v, 3, arg0, arg1, arg2);
+}
+PFNGLGETINTEGERI_VPROC glad_debug_glGetIntegeri_v = glad_debug_impl_glGetIntegeri_v;
 PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
+void APIENTRY glad_debug_impl_glGetIntegerv(GLenum arg0, GLint * arg1) {
+    _pre_call_callback("glGetIntegerv", (void*)glGetIntegerv, 2, arg0, arg1);
+    glad_glGetIntegerv(arg0, arg1);
+    _post_call_callback("glGetIntegerv", (void*)glGetIntegerv, 2, arg0, arg1);
+}
+PFNGLGETINTEGERVPROC glad_debug_glGetIntegerv = glad_debug_impl_glGetIntegerv;
 PFNGLGETLIGHTFVPROC glad_glGetLightfv = NULL;
+void APIENTRY glad_debug_impl_glGetLightfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetLightfv", (void*)glGetLightfv, 3, arg0, arg1, arg2);
+    glad_glGetLightfv(arg0, arg1, arg2);
+    _post_call_callback("glGetLightfv", (void*)glGetLightfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETLIGHTFVPROC glad_debug_glGetLightfv = glad_debug_impl_glGetLightfv;
 PFNGLGETLIGHTIVPROC glad_glGetLightiv = NULL;
+void APIENTRY glad_debug_impl_glGetLightiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetLightiv", (void*)glGetLightiv, 3, arg0, arg1, arg2);
+    glad_glGetLightiv(arg0, arg1, arg2);
+    _post_call_callback("glGetLightiv", (void*)glGetLightiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETLIGHTIVPROC glad_debug_glGetLightiv = glad_debug_impl_glGetLightiv;
 PFNGLGETMAPDVPROC glad_glGetMapdv = NULL;
+void APIENTRY glad_debug_impl_glGetMapdv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+    _pre_call_callback("glGetMapdv", (void*)glGetMapdv, 3, arg0, arg1, arg2);
+    glad_glGetMapdv(arg0, arg1, arg2);
+    _post_call_callback("glGetMapdv", (void*)glGetMapdv, 3, arg0, arg1, arg2);
+}
+PFNGLGETMAPDVPROC glad_debug_glGetMapdv = glad_debug_impl_glGetMapdv;
 PFNGLGETMAPFVPROC glad_glGetMapfv = NULL;
+void APIENTRY glad_debug_impl_glGetMapfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetMapfv", (void*)glGetMapfv, 3, arg0, arg1, arg2);
+    glad_glGetMapfv(arg0, arg1, arg2);
+    _post_call_callback("glGetMapfv", (void*)glGetMapfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETMAPFVPROC glad_debug_glGetMapfv = glad_debug_impl_glGetMapfv;
 PFNGLGETMAPIVPROC glad_glGetMapiv = NULL;
+void APIENTRY glad_debug_impl_glGetMapiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetMapiv", (void*)glGetMapiv, 3, arg0, arg1, arg2);
+    glad_glGetMapiv(arg0, arg1, arg2);
+    _post_call_callback("glGetMapiv", (void*)glGetMapiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETMAPIVPROC glad_debug_glGetMapiv = glad_debug_impl_glGetMapiv;
 PFNGLGETMATERIALFVPROC glad_glGetMaterialfv = NULL;
+void APIENTRY glad_debug_impl_glGetMaterialfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetMaterialfv", (void*)glGetMaterialfv, 3, arg0, arg1, arg2);
+    glad_glGetMaterialfv(arg0, arg1, arg2);
+    _post_call_callback("glGetMaterialfv", (void*)glGetMaterialfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETMATERIALFVPROC glad_debug_glGetMaterialfv = glad_debug_impl_glGetMaterialfv;
 PFNGLGETMATERIALIVPROC glad_glGetMaterialiv = NULL;
+void APIENTRY glad_debug_impl_glGetMaterialiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetMaterialiv", (void*)glGetMaterialiv, 3, arg0, arg1, arg2);
+    glad_glGetMaterialiv(arg0, arg1, arg2);
+    _post_call_callback("glGetMaterialiv", (void*)glGetMaterialiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETMATERIALIVPROC glad_debug_glGetMaterialiv = glad_debug_impl_glGetMaterialiv;
 PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
+void APIENTRY glad_debug_impl_glGetMultisamplefv(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetMultisamplefv", (void*)glGetMultisamplefv, 3, arg0, arg1, arg2);
+    glad_glGetMultisamplefv(arg0, arg1, arg2);
+    _post_call_callback("glGetMultisamplefv", (void*)glGetMultisamplefv, 3, arg0, arg1, arg2);
+}
+PFNGLGETMULTISAMPLEFVPROC glad_debug_glGetMultisamplefv = glad_debug_impl_glGetMultisamplefv;
+PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = NULL;
+void APIENTRY glad_debug_impl_glGetObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+    _pre_call_callback("glGetObjectLabel", (void*)glGetObjectLabel, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glGetObjectLabel(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetObjectLabel", (void*)glGetObjectLabel, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETOBJECTLABELPROC glad_debug_glGetObjectLabel = glad_debug_impl_glGetObjectLabel;
+PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = NULL;
+void APIENTRY glad_debug_impl_glGetObjectPtrLabel(const void * arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+    _pre_call_callback("glGetObjectPtrLabel", (void*)glGetObjectPtrLabel, 4, arg0, arg1, arg2, arg3);
+    glad_glGetObjectPtrLabel(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetObjectPtrLabel", (void*)glGetObjectPtrLabel, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETOBJECTPTRLABELPROC glad_debug_glGetObjectPtrLabel = glad_debug_impl_glGetObjectPtrLabel;
 PFNGLGETPIXELMAPFVPROC glad_glGetPixelMapfv = NULL;
+void APIENTRY glad_debug_impl_glGetPixelMapfv(GLenum arg0, GLfloat * arg1) {
+    _pre_call_callback("glGetPixelMapfv", (void*)glGetPixelMapfv, 2, arg0, arg1);
+    glad_glGetPixelMapfv(arg0, arg1);
+    _post_call_callback("glGetPixelMapfv", (void*)glGetPixelMapfv, 2, arg0, arg1);
+}
+PFNGLGETPIXELMAPFVPROC glad_debug_glGetPixelMapfv = glad_debug_impl_glGetPixelMapfv;
 PFNGLGETPIXELMAPUIVPROC glad_glGetPixelMapuiv = NULL;
+void APIENTRY glad_debug_impl_glGetPixelMapuiv(GLenum arg0, GLuint * arg1) {
+    _pre_call_callback("glGetPixelMapuiv", (void*)glGetPixelMapuiv, 2, arg0, arg1);
+    glad_glGetPixelMapuiv(arg0, arg1);
+    _post_call_callback("glGetPixelMapuiv", (void*)glGetPixelMapuiv, 2, arg0, arg1);
+}
+PFNGLGETPIXELMAPUIVPROC glad_debug_glGetPixelMapuiv = glad_debug_impl_glGetPixelMapuiv;
 PFNGLGETPIXELMAPUSVPROC glad_glGetPixelMapusv = NULL;
+void APIENTRY glad_debug_impl_glGetPixelMapusv(GLenum arg0, GLushort * arg1) {
+    _pre_call_callback("glGetPixelMapusv", (void*)glGetPixelMapusv, 2, arg0, arg1);
+    glad_glGetPixelMapusv(arg0, arg1);
+    _post_call_callback("glGetPixelMapusv", (void*)glGetPixelMapusv, 2, arg0, arg1);
+}
+PFNGLGETPIXELMAPUSVPROC glad_debug_glGetPixelMapusv = glad_debug_impl_glGetPixelMapusv;
 PFNGLGETPOINTERVPROC glad_glGetPointerv = NULL;
+void APIENTRY glad_debug_impl_glGetPointerv(GLenum arg0, void ** arg1) {
+    _pre_call_callback("glGetPointerv", (void*)glGetPointerv, 2, arg0, arg1);
+    glad_glGetPointerv(arg0, arg1);
+    _post_call_callback("glGetPointerv", (void*)glGetPointerv, 2, arg0, arg1);
+}
+PFNGLGETPOINTERVPROC glad_debug_glGetPointerv = glad_debug_impl_glGetPointerv;
 PFNGLGETPOLYGONSTIPPLEPROC glad_glGetPolygonStipple = NULL;
+void APIENTRY glad_debug_impl_glGetPolygonStipple(GLubyte * arg0) {
+    _pre_call_callback("glGetPolygonStipple", (void*)glGetPolygonStipple, 1, arg0);
+    glad_glGetPolygonStipple(arg0);
+    _post_call_callback("glGetPolygonStipple", (void*)glGetPolygonStipple, 1, arg0);
+}
+PFNGLGETPOLYGONSTIPPLEPROC glad_debug_glGetPolygonStipple = glad_debug_impl_glGetPolygonStipple;
 PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
+void APIENTRY glad_debug_impl_glGetProgramInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+    _pre_call_callback("glGetProgramInfoLog", (void*)glGetProgramInfoLog, 4, arg0, arg1, arg2, arg3);
+    glad_glGetProgramInfoLog(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetProgramInfoLog", (void*)glGetProgramInfoLog, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETPROGRAMINFOLOGPROC glad_debug_glGetProgramInfoLog = glad_debug_impl_glGetProgramInfoLog;
 PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
+void APIENTRY glad_debug_impl_glGetProgramiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetProgramiv", (void*)glGetProgramiv, 3, arg0, arg1, arg2);
+    glad_glGetProgramiv(arg0, arg1, arg2);
+    _post_call_callback("glGetProgramiv", (void*)glGetProgramiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETPROGRAMIVPROC glad_debug_glGetProgramiv = glad_debug_impl_glGetProgramiv;
 PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
+void APIENTRY glad_debug_impl_glGetQueryObjecti64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+    _pre_call_callback("glGetQueryObjecti64v", (void*)glGetQueryObjecti64v, 3, arg0, arg1, arg2);
+    glad_glGetQueryObjecti64v(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryObjecti64v", (void*)glGetQueryObjecti64v, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYOBJECTI64VPROC glad_debug_glGetQueryObjecti64v = glad_debug_impl_glGetQueryObjecti64v;
 PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
+void APIENTRY glad_debug_impl_glGetQueryObjectiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetQueryObjectiv", (void*)glGetQueryObjectiv, 3, arg0, arg1, arg2);
+    glad_glGetQueryObjectiv(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryObjectiv", (void*)glGetQueryObjectiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYOBJECTIVPROC glad_debug_glGetQueryObjectiv = glad_debug_impl_glGetQueryObjectiv;
 PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
+void APIENTRY glad_debug_impl_glGetQueryObjectui64v(GLuint arg0, GLenum arg1, GLuint64 * arg2) {
+    _pre_call_callback("glGetQueryObjectui64v", (void*)glGetQueryObjectui64v, 3, arg0, arg1, arg2);
+    glad_glGetQueryObjectui64v(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryObjectui64v", (void*)glGetQueryObjectui64v, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYOBJECTUI64VPROC glad_debug_glGetQueryObjectui64v = glad_debug_impl_glGetQueryObjectui64v;
 PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
+void APIENTRY glad_debug_impl_glGetQueryObjectuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+    _pre_call_callback("glGetQueryObjectuiv", (void*)glGetQueryObjectuiv, 3, arg0, arg1, arg2);
+    glad_glGetQueryObjectuiv(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryObjectuiv", (void*)glGetQueryObjectuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYOBJECTUIVPROC glad_debug_glGetQueryObjectuiv = glad_debug_impl_glGetQueryObjectuiv;
 PFNGLGETQUERYIVPROC glad_glGetQueryiv = NULL;
+void APIENTRY glad_debug_impl_glGetQueryiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetQueryiv", (void*)glGetQueryiv, 3, arg0, arg1, arg2);
+    glad_glGetQueryiv(arg0, arg1, arg2);
+    _post_call_callback("glGetQueryiv", (void*)glGetQueryiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETQUERYIVPROC glad_debug_glGetQueryiv = glad_debug_impl_glGetQueryiv;
 PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = NULL;
+void APIENTRY glad_debug_impl_glGetRenderbufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetRenderbufferParameteriv", (void*)glGetRenderbufferParameteriv, 3, arg0, arg1, arg2);
+    glad_glGetRenderbufferParameteriv(arg0, arg1, arg2);
+    _post_call_callback("glGetRenderbufferParameteriv", (void*)glGetRenderbufferParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_glGetRenderbufferParameteriv = glad_debug_impl_glGetRenderbufferParameteriv;
 PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = NULL;
+void APIENTRY glad_debug_impl_glGetSamplerParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetSamplerParameterIiv", (void*)glGetSamplerParameterIiv, 3, arg0, arg1, arg2);
+    glad_glGetSamplerParameterIiv(arg0, arg1, arg2);
+    _post_call_callback("glGetSamplerParameterIiv", (void*)glGetSamplerParameterIiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_debug_glGetSamplerParameterIiv = glad_debug_impl_glGetSamplerParameterIiv;
 PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
+void APIENTRY glad_debug_impl_glGetSamplerParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+    _pre_call_callback("glGetSamplerParameterIuiv", (void*)glGetSamplerParameterIuiv, 3, arg0, arg1, arg2);
+    glad_glGetSamplerParameterIuiv(arg0, arg1, arg2);
+    _post_call_callback("glGetSamplerParameterIuiv", (void*)glGetSamplerParameterIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_debug_glGetSamplerParameterIuiv = glad_debug_impl_glGetSamplerParameterIuiv;
 PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
+void APIENTRY glad_debug_impl_glGetSamplerParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetSamplerParameterfv", (void*)glGetSamplerParameterfv, 3, arg0, arg1, arg2);
+    glad_glGetSamplerParameterfv(arg0, arg1, arg2);
+    _post_call_callback("glGetSamplerParameterfv", (void*)glGetSamplerParameterfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSAMPLERPARAMETERFVPROC glad_debug_glGetSamplerParameterfv = glad_debug_impl_glGetSamplerParameterfv;
 PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
+void APIENTRY glad_debug_impl_glGetSamplerParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetSamplerParameteriv", (void*)glGetSamplerParameteriv, 3, arg0, arg1, arg2);
+    glad_glGetSamplerParameteriv(arg0, arg1, arg2);
+    _post_call_callback("glGetSamplerParameteriv", (void*)glGetSamplerParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSAMPLERPARAMETERIVPROC glad_debug_glGetSamplerParameteriv = glad_debug_impl_glGetSamplerParameteriv;
 PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
+void APIENTRY glad_debug_impl_glGetShaderInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+    _pre_call_callback("glGetShaderInfoLog", (void*)glGetShaderInfoLog, 4, arg0, arg1, arg2, arg3);
+    glad_glGetShaderInfoLog(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetShaderInfoLog", (void*)glGetShaderInfoLog, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETSHADERINFOLOGPROC glad_debug_glGetShaderInfoLog = glad_debug_impl_glGetShaderInfoLog;
 PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
+void APIENTRY glad_debug_impl_glGetShaderSource(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+    _pre_call_callback("glGetShaderSource", (void*)glGetShaderSource, 4, arg0, arg1, arg2, arg3);
+    glad_glGetShaderSource(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetShaderSource", (void*)glGetShaderSource, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETSHADERSOURCEPROC glad_debug_glGetShaderSource = glad_debug_impl_glGetShaderSource;
 PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
+void APIENTRY glad_debug_impl_glGetShaderiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetShaderiv", (void*)glGetShaderiv, 3, arg0, arg1, arg2);
+    glad_glGetShaderiv(arg0, arg1, arg2);
+    _post_call_callback("glGetShaderiv", (void*)glGetShaderiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETSHADERIVPROC glad_debug_glGetShaderiv = glad_debug_impl_glGetShaderiv;
 PFNGLGETSTRINGPROC glad_glGetString = NULL;
+const GLubyte * APIENTRY glad_debug_impl_glGetString(GLenum arg0) {
+    const GLubyte * ret;
+    _pre_call_callback("glGetString", (void*)glGetString, 1, arg0);
+    ret = glad_glGetString(arg0);
+    _post_call_callback("glGetString", (void*)glGetString, 1, arg0);
+    return ret;
+}
+PFNGLGETSTRINGPROC glad_debug_glGetString = glad_debug_impl_glGetString;
 PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
+const GLubyte * APIENTRY glad_debug_impl_glGetStringi(GLenum arg0, GLuint arg1) {
+    const GLubyte * ret;
+    _pre_call_callback("glGetStringi", (void*)glGetStringi, 2, arg0, arg1);
+    ret = glad_glGetStringi(arg0, arg1);
+    _post_call_callback("glGetStringi", (void*)glGetStringi, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETSTRINGIPROC glad_debug_glGetStringi = glad_debug_impl_glGetStringi;
 PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
+void APIENTRY glad_debug_impl_glGetSynciv(GLsync arg0, GLenum arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4) {
+    _pre_call_callback("glGetSynciv", (void*)glGetSynciv, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glGetSynciv(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetSynciv", (void*)glGetSynciv, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETSYNCIVPROC glad_debug_glGetSynciv = glad_debug_impl_glGetSynciv;
 PFNGLGETTEXENVFVPROC glad_glGetTexEnvfv = NULL;
+void APIENTRY glad_debug_impl_glGetTexEnvfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetTexEnvfv", (void*)glGetTexEnvfv, 3, arg0, arg1, arg2);
+    glad_glGetTexEnvfv(arg0, arg1, arg2);
+    _post_call_callback("glGetTexEnvfv", (void*)glGetTexEnvfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXENVFVPROC glad_debug_glGetTexEnvfv = glad_debug_impl_glGetTexEnvfv;
 PFNGLGETTEXENVIVPROC glad_glGetTexEnviv = NULL;
+void APIENTRY glad_debug_impl_glGetTexEnviv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetTexEnviv", (void*)glGetTexEnviv, 3, arg0, arg1, arg2);
+    glad_glGetTexEnviv(arg0, arg1, arg2);
+    _post_call_callback("glGetTexEnviv", (void*)glGetTexEnviv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXENVIVPROC glad_debug_glGetTexEnviv = glad_debug_impl_glGetTexEnviv;
 PFNGLGETTEXGENDVPROC glad_glGetTexGendv = NULL;
+void APIENTRY glad_debug_impl_glGetTexGendv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+    _pre_call_callback("glGetTexGendv", (void*)glGetTexGendv, 3, arg0, arg1, arg2);
+    glad_glGetTexGendv(arg0, arg1, arg2);
+    _post_call_callback("glGetTexGendv", (void*)glGetTexGendv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXGENDVPROC glad_debug_glGetTexGendv = glad_debug_impl_glGetTexGendv;
 PFNGLGETTEXGENFVPROC glad_glGetTexGenfv = NULL;
+void APIENTRY glad_debug_impl_glGetTexGenfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetTexGenfv", (void*)glGetTexGenfv, 3, arg0, arg1, arg2);
+    glad_glGetTexGenfv(arg0, arg1, arg2);
+    _post_call_callback("glGetTexGenfv", (void*)glGetTexGenfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXGENFVPROC glad_debug_glGetTexGenfv = glad_debug_impl_glGetTexGenfv;
 PFNGLGETTEXGENIVPROC glad_glGetTexGeniv = NULL;
+void APIENTRY glad_debug_impl_glGetTexGeniv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetTexGeniv", (void*)glGetTexGeniv, 3, arg0, arg1, arg2);
+    glad_glGetTexGeniv(arg0, arg1, arg2);
+    _post_call_callback("glGetTexGeniv", (void*)glGetTexGeniv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXGENIVPROC glad_debug_glGetTexGeniv = glad_debug_impl_glGetTexGeniv;
 PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
+void APIENTRY glad_debug_impl_glGetTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, void * arg4) {
+    _pre_call_callback("glGetTexImage", (void*)glGetTexImage, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glGetTexImage(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glGetTexImage", (void*)glGetTexImage, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLGETTEXIMAGEPROC glad_debug_glGetTexImage = glad_debug_impl_glGetTexImage;
 PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
+void APIENTRY glad_debug_impl_glGetTexLevelParameterfv(GLenum arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+    _pre_call_callback("glGetTexLevelParameterfv", (void*)glGetTexLevelParameterfv, 4, arg0, arg1, arg2, arg3);
+    glad_glGetTexLevelParameterfv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetTexLevelParameterfv", (void*)glGetTexLevelParameterfv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_glGetTexLevelParameterfv = glad_debug_impl_glGetTexLevelParameterfv;
 PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = NULL;
+void APIENTRY glad_debug_impl_glGetTexLevelParameteriv(GLenum arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+    _pre_call_callback("glGetTexLevelParameteriv", (void*)glGetTexLevelParameteriv, 4, arg0, arg1, arg2, arg3);
+    glad_glGetTexLevelParameteriv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetTexLevelParameteriv", (void*)glGetTexLevelParameteriv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_glGetTexLevelParameteriv = glad_debug_impl_glGetTexLevelParameteriv;
 PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
+void APIENTRY glad_debug_impl_glGetTexParameterIiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetTexParameterIiv", (void*)glGetTexParameterIiv, 3, arg0, arg1, arg2);
+    glad_glGetTexParameterIiv(arg0, arg1, arg2);
+    _post_call_callback("glGetTexParameterIiv", (void*)glGetTexParameterIiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXPARAMETERIIVPROC glad_debug_glGetTexParameterIiv = glad_debug_impl_glGetTexParameterIiv;
 PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
+void APIENTRY glad_debug_impl_glGetTexParameterIuiv(GLenum arg0, GLenum arg1, GLuint * arg2) {
+    _pre_call_callback("glGetTexParameterIuiv", (void*)glGetTexParameterIuiv, 3, arg0, arg1, arg2);
+    glad_glGetTexParameterIuiv(arg0, arg1, arg2);
+    _post_call_callback("glGetTexParameterIuiv", (void*)glGetTexParameterIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXPARAMETERIUIVPROC glad_debug_glGetTexParameterIuiv = glad_debug_impl_glGetTexParameterIuiv;
 PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
+void APIENTRY glad_debug_impl_glGetTexParameterfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetTexParameterfv", (void*)glGetTexParameterfv, 3, arg0, arg1, arg2);
+    glad_glGetTexParameterfv(arg0, arg1, arg2);
+    _post_call_callback("glGetTexParameterfv", (void*)glGetTexParameterfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXPARAMETERFVPROC glad_debug_glGetTexParameterfv = glad_debug_impl_glGetTexParameterfv;
 PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
+void APIENTRY glad_debug_impl_glGetTexParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetTexParameteriv", (void*)glGetTexParameteriv, 3, arg0, arg1, arg2);
+    glad_glGetTexParameteriv(arg0, arg1, arg2);
+    _post_call_callback("glGetTexParameteriv", (void*)glGetTexParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLGETTEXPARAMETERIVPROC glad_debug_glGetTexParameteriv = glad_debug_impl_glGetTexParameteriv;
 PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
+void APIENTRY glad_debug_impl_glGetTransformFeedbackVarying(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLsizei * arg4, GLenum * arg5, GLchar * arg6) {
+    _pre_call_callback("glGetTransformFeedbackVarying", (void*)glGetTransformFeedbackVarying, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glGetTransformFeedbackVarying(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glGetTransformFeedbackVarying", (void*)glGetTransformFeedbackVarying, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_debug_glGetTransformFeedbackVarying = glad_debug_impl_glGetTransformFeedbackVarying;
 PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
+GLuint APIENTRY glad_debug_impl_glGetUniformBlockIndex(GLuint arg0, const GLchar * arg1) {
+    GLuint ret;
+    _pre_call_callback("glGetUniformBlockIndex", (void*)glGetUniformBlockIndex, 2, arg0, arg1);
+    ret = glad_glGetUniformBlockIndex(arg0, arg1);
+    _post_call_callback("glGetUniformBlockIndex", (void*)glGetUniformBlockIndex, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_debug_glGetUniformBlockIndex = glad_debug_impl_glGetUniformBlockIndex;
 PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
+void APIENTRY glad_debug_impl_glGetUniformIndices(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, GLuint * arg3) {
+    _pre_call_callback("glGetUniformIndices", (void*)glGetUniformIndices, 4, arg0, arg1, arg2, arg3);
+    glad_glGetUniformIndices(arg0, arg1, arg2, arg3);
+    _post_call_callback("glGetUniformIndices", (void*)glGetUniformIndices, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLGETUNIFORMINDICESPROC glad_debug_glGetUniformIndices = glad_debug_impl_glGetUniformIndices;
 PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
+GLint APIENTRY glad_debug_impl_glGetUniformLocation(GLuint arg0, const GLchar * arg1) {
+    GLint ret;
+    _pre_call_callback("glGetUniformLocation", (void*)glGetUniformLocation, 2, arg0, arg1);
+    ret = glad_glGetUniformLocation(arg0, arg1);
+    _post_call_callback("glGetUniformLocation", (void*)glGetUniformLocation, 2, arg0, arg1);
+    return ret;
+}
+PFNGLGETUNIFORMLOCATIONPROC glad_debug_glGetUniformLocation = glad_debug_impl_glGetUniformLocation;
 PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
+void APIENTRY glad_debug_impl_glGetUniformfv(GLuint arg0, GLint arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetUniformfv", (void*)glGetUniformfv, 3, arg0, arg1, arg2);
+    glad_glGetUniformfv(arg0, arg1, arg2);
+    _post_call_callback("glGetUniformfv", (void*)glGetUniformfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETUNIFORMFVPROC glad_debug_glGetUniformfv = glad_debug_impl_glGetUniformfv;
 PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
+void APIENTRY glad_debug_impl_glGetUniformiv(GLuint arg0, GLint arg1, GLint * arg2) {
+    _pre_call_callback("glGetUniformiv", (void*)glGetUniformiv, 3, arg0, arg1, arg2);
+    glad_glGetUniformiv(arg0, arg1, arg2);
+    _post_call_callback("glGetUniformiv", (void*)glGetUniformiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETUNIFORMIVPROC glad_debug_glGetUniformiv = glad_debug_impl_glGetUniformiv;
 PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
+void APIENTRY glad_debug_impl_glGetUniformuiv(GLuint arg0, GLint arg1, GLuint * arg2) {
+    _pre_call_callback("glGetUniformuiv", (void*)glGetUniformuiv, 3, arg0, arg1, arg2);
+    glad_glGetUniformuiv(arg0, arg1, arg2);
+    _post_call_callback("glGetUniformuiv", (void*)glGetUniformuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETUNIFORMUIVPROC glad_debug_glGetUniformuiv = glad_debug_impl_glGetUniformuiv;
 PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
+void APIENTRY glad_debug_impl_glGetVertexAttribIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetVertexAttribIiv", (void*)glGetVertexAttribIiv, 3, arg0, arg1, arg2);
+    glad_glGetVertexAttribIiv(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribIiv", (void*)glGetVertexAttribIiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBIIVPROC glad_debug_glGetVertexAttribIiv = glad_debug_impl_glGetVertexAttribIiv;
 PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
+void APIENTRY glad_debug_impl_glGetVertexAttribIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+    _pre_call_callback("glGetVertexAttribIuiv", (void*)glGetVertexAttribIuiv, 3, arg0, arg1, arg2);
+    glad_glGetVertexAttribIuiv(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribIuiv", (void*)glGetVertexAttribIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBIUIVPROC glad_debug_glGetVertexAttribIuiv = glad_debug_impl_glGetVertexAttribIuiv;
 PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
+void APIENTRY glad_debug_impl_glGetVertexAttribPointerv(GLuint arg0, GLenum arg1, void ** arg2) {
+    _pre_call_callback("glGetVertexAttribPointerv", (void*)glGetVertexAttribPointerv, 3, arg0, arg1, arg2);
+    glad_glGetVertexAttribPointerv(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribPointerv", (void*)glGetVertexAttribPointerv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_glGetVertexAttribPointerv = glad_debug_impl_glGetVertexAttribPointerv;
 PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
+void APIENTRY glad_debug_impl_glGetVertexAttribdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+    _pre_call_callback("glGetVertexAttribdv", (void*)glGetVertexAttribdv, 3, arg0, arg1, arg2);
+    glad_glGetVertexAttribdv(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribdv", (void*)glGetVertexAttribdv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBDVPROC glad_debug_glGetVertexAttribdv = glad_debug_impl_glGetVertexAttribdv;
 PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
+void APIENTRY glad_debug_impl_glGetVertexAttribfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+    _pre_call_callback("glGetVertexAttribfv", (void*)glGetVertexAttribfv, 3, arg0, arg1, arg2);
+    glad_glGetVertexAttribfv(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribfv", (void*)glGetVertexAttribfv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBFVPROC glad_debug_glGetVertexAttribfv = glad_debug_impl_glGetVertexAttribfv;
 PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
+void APIENTRY glad_debug_impl_glGetVertexAttribiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+    _pre_call_callback("glGetVertexAttribiv", (void*)glGetVertexAttribiv, 3, arg0, arg1, arg2);
+    glad_glGetVertexAttribiv(arg0, arg1, arg2);
+    _post_call_callback("glGetVertexAttribiv", (void*)glGetVertexAttribiv, 3, arg0, arg1, arg2);
+}
+PFNGLGETVERTEXATTRIBIVPROC glad_debug_glGetVertexAttribiv = glad_debug_impl_glGetVertexAttribiv;
 PFNGLHINTPROC glad_glHint = NULL;
+void APIENTRY glad_debug_impl_glHint(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glHint", (void*)glHint, 2, arg0, arg1);
+    glad_glHint(arg0, arg1);
+    _post_call_callback("glHint", (void*)glHint, 2, arg0, arg1);
+}
+PFNGLHINTPROC glad_debug_glHint = glad_debug_impl_glHint;
 PFNGLINDEXMASKPROC glad_glIndexMask = NULL;
+void APIENTRY glad_debug_impl_glIndexMask(GLuint arg0) {
+    _pre_call_callback("glIndexMask", (void*)glIndexMask, 1, arg0);
+    glad_glIndexMask(arg0);
+    _post_call_callback("glIndexMask", (void*)glIndexMask, 1, arg0);
+}
+PFNGLINDEXMASKPROC glad_debug_glIndexMask = glad_debug_impl_glIndexMask;
 PFNGLINDEXPOINTERPROC glad_glIndexPointer = NULL;
+void APIENTRY glad_debug_impl_glIndexPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+    _pre_call_callback("glIndexPointer", (void*)glIndexPointer, 3, arg0, arg1, arg2);
+    glad_glIndexPointer(arg0, arg1, arg2);
+    _post_call_callback("glIndexPointer", (void*)glIndexPointer, 3, arg0, arg1, arg2);
+}
+PFNGLINDEXPOINTERPROC glad_debug_glIndexPointer = glad_debug_impl_glIndexPointer;
 PFNGLINDEXDPROC glad_glIndexd = NULL;
+void APIENTRY glad_debug_impl_glIndexd(GLdouble arg0) {
+    _pre_call_callback("glIndexd", (void*)glIndexd, 1, arg0);
+    glad_glIndexd(arg0);
+    _post_call_callback("glIndexd", (void*)glIndexd, 1, arg0);
+}
+PFNGLINDEXDPROC glad_debug_glIndexd = glad_debug_impl_glIndexd;
 PFNGLINDEXDVPROC glad_glIndexdv = NULL;
+void APIENTRY glad_debug_impl_glIndexdv(const GLdouble * arg0) {
+    _pre_call_callback("glIndexdv", (void*)glIndexdv, 1, arg0);
+    glad_glIndexdv(arg0);
+    _post_call_callback("glIndexdv", (void*)glIndexdv, 1, arg0);
+}
+PFNGLINDEXDVPROC glad_debug_glIndexdv = glad_debug_impl_glIndexdv;
 PFNGLINDEXFPROC glad_glIndexf = NULL;
+void APIENTRY glad_debug_impl_glIndexf(GLfloat arg0) {
+    _pre_call_callback("glIndexf", (void*)glIndexf, 1, arg0);
+    glad_glIndexf(arg0);
+    _post_call_callback("glIndexf", (void*)glIndexf, 1, arg0);
+}
+PFNGLINDEXFPROC glad_debug_glIndexf = glad_debug_impl_glIndexf;
 PFNGLINDEXFVPROC glad_glIndexfv = NULL;
+void APIENTRY glad_debug_impl_glIndexfv(const GLfloat * arg0) {
+    _pre_call_callback("glIndexfv", (void*)glIndexfv, 1, arg0);
+    glad_glIndexfv(arg0);
+    _post_call_callback("glIndexfv", (void*)glIndexfv, 1, arg0);
+}
+PFNGLINDEXFVPROC glad_debug_glIndexfv = glad_debug_impl_glIndexfv;
 PFNGLINDEXIPROC glad_glIndexi = NULL;
+void APIENTRY glad_debug_impl_glIndexi(GLint arg0) {
+    _pre_call_callback("glIndexi", (void*)glIndexi, 1, arg0);
+    glad_glIndexi(arg0);
+    _post_call_callback("glIndexi", (void*)glIndexi, 1, arg0);
+}
+PFNGLINDEXIPROC glad_debug_glIndexi = glad_debug_impl_glIndexi;
 PFNGLINDEXIVPROC glad_glIndexiv = NULL;
+void APIENTRY glad_debug_impl_glIndexiv(const GLint * arg0) {
+    _pre_call_callback("glIndexiv", (void*)glIndexiv, 1, arg0);
+    glad_glIndexiv(arg0);
+    _post_call_callback("glIndexiv", (void*)glIndexiv, 1, arg0);
+}
+PFNGLINDEXIVPROC glad_debug_glIndexiv = glad_debug_impl_glIndexiv;
 PFNGLINDEXSPROC glad_glIndexs = NULL;
+void APIENTRY glad_debug_impl_glIndexs(GLshort arg0) {
+    _pre_call_callback("glIndexs", (void*)glIndexs, 1, arg0);
+    glad_glIndexs(arg0);
+    _post_call_callback("glIndexs", (void*)glIndexs, 1, arg0);
+}
+PFNGLINDEXSPROC glad_debug_glIndexs = glad_debug_impl_glIndexs;
 PFNGLINDEXSVPROC glad_glIndexsv = NULL;
+void APIENTRY glad_debug_impl_glIndexsv(const GLshort * arg0) {
+    _pre_call_callback("glIndexsv", (void*)glIndexsv, 1, arg0);
+    glad_glIndexsv(arg0);
+    _post_call_callback("glIndexsv", (void*)glIndexsv, 1, arg0);
+}
+PFNGLINDEXSVPROC glad_debug_glIndexsv = glad_debug_impl_glIndexsv;
 PFNGLINDEXUBPROC glad_glIndexub = NULL;
+void APIENTRY glad_debug_impl_glIndexub(GLubyte arg0) {
+    _pre_call_callback("glIndexub", (void*)glIndexub, 1, arg0);
+    glad_glIndexub(arg0);
+    _post_call_callback("glIndexub", (void*)glIndexub, 1, arg0);
+}
+PFNGLINDEXUBPROC glad_debug_glIndexub = glad_debug_impl_glIndexub;
 PFNGLINDEXUBVPROC glad_glIndexubv = NULL;
+void APIENTRY glad_debug_impl_glIndexubv(const GLubyte * arg0) {
+    _pre_call_callback("glIndexubv", (void*)glIndexubv, 1, arg0);
+    glad_glIndexubv(arg0);
+    _post_call_callback("glIndexubv", (void*)glIndexubv, 1, arg0);
+}
+PFNGLINDEXUBVPROC glad_debug_glIndexubv = glad_debug_impl_glIndexubv;
 PFNGLINITNAMESPROC glad_glInitNames = NULL;
+void APIENTRY glad_debug_impl_glInitNames(void) {
+    _pre_call_callback("glInitNames", (void*)glInitNames, 0);
+    glad_glInitNames();
+    _post_call_callback("glInitNames", (void*)glInitNames, 0);
+}
+PFNGLINITNAMESPROC glad_debug_glInitNames = glad_debug_impl_glInitNames;
 PFNGLINTERLEAVEDARRAYSPROC glad_glInterleavedArrays = NULL;
+void APIENTRY glad_debug_impl_glInterleavedArrays(GLenum arg0, GLsizei arg1, const void * arg2) {
+    _pre_call_callback("glInterleavedArrays", (void*)glInterleavedArrays, 3, arg0, arg1, arg2);
+    glad_glInterleavedArrays(arg0, arg1, arg2);
+    _post_call_callback("glInterleavedArrays", (void*)glInterleavedArrays, 3, arg0, arg1, arg2);
+}
+PFNGLINTERLEAVEDARRAYSPROC glad_debug_glInterleavedArrays = glad_debug_impl_glInterleavedArrays;
 PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsBuffer(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsBuffer", (void*)glIsBuffer, 1, arg0);
+    ret = glad_glIsBuffer(arg0);
+    _post_call_callback("glIsBuffer", (void*)glIsBuffer, 1, arg0);
+    return ret;
+}
+PFNGLISBUFFERPROC glad_debug_glIsBuffer = glad_debug_impl_glIsBuffer;
 PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsEnabled(GLenum arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsEnabled", (void*)glIsEnabled, 1, arg0);
+    ret = glad_glIsEnabled(arg0);
+    _post_call_callback("glIsEnabled", (void*)glIsEnabled, 1, arg0);
+    return ret;
+}
+PFNGLISENABLEDPROC glad_debug_glIsEnabled = glad_debug_impl_glIsEnabled;
 PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsEnabledi(GLenum arg0, GLuint arg1) {
+    GLboolean ret;
+    _pre_call_callback("glIsEnabledi", (void*)glIsEnabledi, 2, arg0, arg1);
+    ret = glad_glIsEnabledi(arg0, arg1);
+    _post_call_callback("glIsEnabledi", (void*)glIsEnabledi, 2, arg0, arg1);
+    return ret;
+}
+PFNGLISENABLEDIPROC glad_debug_glIsEnabledi = glad_debug_impl_glIsEnabledi;
 PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsFramebuffer(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsFramebuffer", (void*)glIsFramebuffer, 1, arg0);
+    ret = glad_glIsFramebuffer(arg0);
+    _post_call_callback("glIsFramebuffer", (void*)glIsFramebuffer, 1, arg0);
+    return ret;
+}
+PFNGLISFRAMEBUFFERPROC glad_debug_glIsFramebuffer = glad_debug_impl_glIsFramebuffer;
 PFNGLISLISTPROC glad_glIsList = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsList(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsList", (void*)glIsList, 1, arg0);
+    ret = glad_glIsList(arg0);
+    _post_call_callback("glIsList", (void*)glIsList, 1, arg0);
+    return ret;
+}
+PFNGLISLISTPROC glad_debug_glIsList = glad_debug_impl_glIsList;
 PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsProgram(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsProgram", (void*)glIsProgram, 1, arg0);
+    ret = glad_glIsProgram(arg0);
+    _post_call_callback("glIsProgram", (void*)glIsProgram, 1, arg0);
+    return ret;
+}
+PFNGLISPROGRAMPROC glad_debug_glIsProgram = glad_debug_impl_glIsProgram;
 PFNGLISQUERYPROC glad_glIsQuery = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsQuery(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsQuery", (void*)glIsQuery, 1, arg0);
+    ret = glad_glIsQuery(arg0);
+    _post_call_callback("glIsQuery", (void*)glIsQuery, 1, arg0);
+    return ret;
+}
+PFNGLISQUERYPROC glad_debug_glIsQuery = glad_debug_impl_glIsQuery;
 PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsRenderbuffer(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsRenderbuffer", (void*)glIsRenderbuffer, 1, arg0);
+    ret = glad_glIsRenderbuffer(arg0);
+    _post_call_callback("glIsRenderbuffer", (void*)glIsRenderbuffer, 1, arg0);
+    return ret;
+}
+PFNGLISRENDERBUFFERPROC glad_debug_glIsRenderbuffer = glad_debug_impl_glIsRenderbuffer;
 PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsSampler(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsSampler", (void*)glIsSampler, 1, arg0);
+    ret = glad_glIsSampler(arg0);
+    _post_call_callback("glIsSampler", (void*)glIsSampler, 1, arg0);
+    return ret;
+}
+PFNGLISSAMPLERPROC glad_debug_glIsSampler = glad_debug_impl_glIsSampler;
 PFNGLISSHADERPROC glad_glIsShader = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsShader(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsShader", (void*)glIsShader, 1, arg0);
+    ret = glad_glIsShader(arg0);
+    _post_call_callback("glIsShader", (void*)glIsShader, 1, arg0);
+    return ret;
+}
+PFNGLISSHADERPROC glad_debug_glIsShader = glad_debug_impl_glIsShader;
 PFNGLISSYNCPROC glad_glIsSync = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsSync(GLsync arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsSync", (void*)glIsSync, 1, arg0);
+    ret = glad_glIsSync(arg0);
+    _post_call_callback("glIsSync", (void*)glIsSync, 1, arg0);
+    return ret;
+}
+PFNGLISSYNCPROC glad_debug_glIsSync = glad_debug_impl_glIsSync;
 PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsTexture(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsTexture", (void*)glIsTexture, 1, arg0);
+    ret = glad_glIsTexture(arg0);
+    _post_call_callback("glIsTexture", (void*)glIsTexture, 1, arg0);
+    return ret;
+}
+PFNGLISTEXTUREPROC glad_debug_glIsTexture = glad_debug_impl_glIsTexture;
 PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
+GLboolean APIENTRY glad_debug_impl_glIsVertexArray(GLuint arg0) {
+    GLboolean ret;
+    _pre_call_callback("glIsVertexArray", (void*)glIsVertexArray, 1, arg0);
+    ret = glad_glIsVertexArray(arg0);
+    _post_call_callback("glIsVertexArray", (void*)glIsVertexArray, 1, arg0);
+    return ret;
+}
+PFNGLISVERTEXARRAYPROC glad_debug_glIsVertexArray = glad_debug_impl_glIsVertexArray;
 PFNGLLIGHTMODELFPROC glad_glLightModelf = NULL;
+void APIENTRY glad_debug_impl_glLightModelf(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glLightModelf", (void*)glLightModelf, 2, arg0, arg1);
+    glad_glLightModelf(arg0, arg1);
+    _post_call_callback("glLightModelf", (void*)glLightModelf, 2, arg0, arg1);
+}
+PFNGLLIGHTMODELFPROC glad_debug_glLightModelf = glad_debug_impl_glLightModelf;
 PFNGLLIGHTMODELFVPROC glad_glLightModelfv = NULL;
+void APIENTRY glad_debug_impl_glLightModelfv(GLenum arg0, const GLfloat * arg1) {
+    _pre_call_callback("glLightModelfv", (void*)glLightModelfv, 2, arg0, arg1);
+    glad_glLightModelfv(arg0, arg1);
+    _post_call_callback("glLightModelfv", (void*)glLightModelfv, 2, arg0, arg1);
+}
+PFNGLLIGHTMODELFVPROC glad_debug_glLightModelfv = glad_debug_impl_glLightModelfv;
 PFNGLLIGHTMODELIPROC glad_glLightModeli = NULL;
+void APIENTRY glad_debug_impl_glLightModeli(GLenum arg0, GLint arg1) {
+    _pre_call_callback("glLightModeli", (void*)glLightModeli, 2, arg0, arg1);
+    glad_glLightModeli(arg0, arg1);
+    _post_call_callback("glLightModeli", (void*)glLightModeli, 2, arg0, arg1);
+}
+PFNGLLIGHTMODELIPROC glad_debug_glLightModeli = glad_debug_impl_glLightModeli;
 PFNGLLIGHTMODELIVPROC glad_glLightModeliv = NULL;
+void APIENTRY glad_debug_impl_glLightModeliv(GLenum arg0, const GLint * arg1) {
+    _pre_call_callback("glLightModeliv", (void*)glLightModeliv, 2, arg0, arg1);
+    glad_glLightModeliv(arg0, arg1);
+    _post_call_callback("glLightModeliv", (void*)glLightModeliv, 2, arg0, arg1);
+}
+PFNGLLIGHTMODELIVPROC glad_debug_glLightModeliv = glad_debug_impl_glLightModeliv;
 PFNGLLIGHTFPROC glad_glLightf = NULL;
+void APIENTRY glad_debug_impl_glLightf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+    _pre_call_callback("glLightf", (void*)glLightf, 3, arg0, arg1, arg2);
+    glad_glLightf(arg0, arg1, arg2);
+    _post_call_callback("glLightf", (void*)glLightf, 3, arg0, arg1, arg2);
+}
+PFNGLLIGHTFPROC glad_debug_glLightf = glad_debug_impl_glLightf;
 PFNGLLIGHTFVPROC glad_glLightfv = NULL;
+void APIENTRY glad_debug_impl_glLightfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+    _pre_call_callback("glLightfv", (void*)glLightfv, 3, arg0, arg1, arg2);
+    glad_glLightfv(arg0, arg1, arg2);
+    _post_call_callback("glLightfv", (void*)glLightfv, 3, arg0, arg1, arg2);
+}
+PFNGLLIGHTFVPROC glad_debug_glLightfv = glad_debug_impl_glLightfv;
 PFNGLLIGHTIPROC glad_glLighti = NULL;
+void APIENTRY glad_debug_impl_glLighti(GLenum arg0, GLenum arg1, GLint arg2) {
+    _pre_call_callback("glLighti", (void*)glLighti, 3, arg0, arg1, arg2);
+    glad_glLighti(arg0, arg1, arg2);
+    _post_call_callback("glLighti", (void*)glLighti, 3, arg0, arg1, arg2);
+}
+PFNGLLIGHTIPROC glad_debug_glLighti = glad_debug_impl_glLighti;
 PFNGLLIGHTIVPROC glad_glLightiv = NULL;
+void APIENTRY glad_debug_impl_glLightiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glLightiv", (void*)glLightiv, 3, arg0, arg1, arg2);
+    glad_glLightiv(arg0, arg1, arg2);
+    _post_call_callback("glLightiv", (void*)glLightiv, 3, arg0, arg1, arg2);
+}
+PFNGLLIGHTIVPROC glad_debug_glLightiv = glad_debug_impl_glLightiv;
 PFNGLLINESTIPPLEPROC glad_glLineStipple = NULL;
+void APIENTRY glad_debug_impl_glLineStipple(GLint arg0, GLushort arg1) {
+    _pre_call_callback("glLineStipple", (void*)glLineStipple, 2, arg0, arg1);
+    glad_glLineStipple(arg0, arg1);
+    _post_call_callback("glLineStipple", (void*)glLineStipple, 2, arg0, arg1);
+}
+PFNGLLINESTIPPLEPROC glad_debug_glLineStipple = glad_debug_impl_glLineStipple;
 PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
+void APIENTRY glad_debug_impl_glLineWidth(GLfloat arg0) {
+    _pre_call_callback("glLineWidth", (void*)glLineWidth, 1, arg0);
+    glad_glLineWidth(arg0);
+    _post_call_callback("glLineWidth", (void*)glLineWidth, 1, arg0);
+}
+PFNGLLINEWIDTHPROC glad_debug_glLineWidth = glad_debug_impl_glLineWidth;
 PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
+void APIENTRY glad_debug_impl_glLinkProgram(GLuint arg0) {
+    _pre_call_callback("glLinkProgram", (void*)glLinkProgram, 1, arg0);
+    glad_glLinkProgram(arg0);
+    _post_call_callback("glLinkProgram", (void*)glLinkProgram, 1, arg0);
+}
+PFNGLLINKPROGRAMPROC glad_debug_glLinkProgram = glad_debug_impl_glLinkProgram;
 PFNGLLISTBASEPROC glad_glListBase = NULL;
+void APIENTRY glad_debug_impl_glListBase(GLuint arg0) {
+    _pre_call_callback("glListBase", (void*)glListBase, 1, arg0);
+    glad_glListBase(arg0);
+    _post_call_callback("glListBase", (void*)glListBase, 1, arg0);
+}
+PFNGLLISTBASEPROC glad_debug_glListBase = glad_debug_impl_glListBase;
 PFNGLLOADIDENTITYPROC glad_glLoadIdentity = NULL;
+void APIENTRY glad_debug_impl_glLoadIdentity(void) {
+    _pre_call_callback("glLoadIdentity", (void*)glLoadIdentity, 0);
+    glad_glLoadIdentity();
+    _post_call_callback("glLoadIdentity", (void*)glLoadIdentity, 0);
+}
+PFNGLLOADIDENTITYPROC glad_debug_glLoadIdentity = glad_debug_impl_glLoadIdentity;
 PFNGLLOADMATRIXDPROC glad_glLoadMatrixd = NULL;
+void APIENTRY glad_debug_impl_glLoadMatrixd(const GLdouble * arg0) {
+    _pre_call_callback("glLoadMatrixd", (void*)glLoadMatrixd, 1, arg0);
+    glad_glLoadMatrixd(arg0);
+    _post_call_callback("glLoadMatrixd", (void*)glLoadMatrixd, 1, arg0);
+}
+PFNGLLOADMATRIXDPROC glad_debug_glLoadMatrixd = glad_debug_impl_glLoadMatrixd;
 PFNGLLOADMATRIXFPROC glad_glLoadMatrixf = NULL;
+void APIENTRY glad_debug_impl_glLoadMatrixf(const GLfloat * arg0) {
+    _pre_call_callback("glLoadMatrixf", (void*)glLoadMatrixf, 1, arg0);
+    glad_glLoadMatrixf(arg0);
+    _post_call_callback("glLoadMatrixf", (void*)glLoadMatrixf, 1, arg0);
+}
+PFNGLLOADMATRIXFPROC glad_debug_glLoadMatrixf = glad_debug_impl_glLoadMatrixf;
 PFNGLLOADNAMEPROC glad_glLoadName = NULL;
+void APIENTRY glad_debug_impl_glLoadName(GLuint arg0) {
+    _pre_call_callback("glLoadName", (void*)glLoadName, 1, arg0);
+    glad_glLoadName(arg0);
+    _post_call_callback("glLoadName", (void*)glLoadName, 1, arg0);
+}
+PFNGLLOADNAMEPROC glad_debug_glLoadName = glad_debug_impl_glLoadName;
 PFNGLLOADTRANSPOSEMATRIXDPROC glad_glLoadTransposeMatrixd = NULL;
+void APIENTRY glad_debug_impl_glLoadTransposeMatrixd(const GLdouble * arg0) {
+    _pre_call_callback("glLoadTransposeMatrixd", (void*)glLoadTransposeMatrixd, 1, arg0);
+    glad_glLoadTransposeMatrixd(arg0);
+    _post_call_callback("glLoadTransposeMatrixd", (void*)glLoadTransposeMatrixd, 1, arg0);
+}
+PFNGLLOADTRANSPOSEMATRIXDPROC glad_debug_glLoadTransposeMatrixd = glad_debug_impl_glLoadTransposeMatrixd;
 PFNGLLOADTRANSPOSEMATRIXFPROC glad_glLoadTransposeMatrixf = NULL;
+void APIENTRY glad_debug_impl_glLoadTransposeMatrixf(const GLfloat * arg0) {
+    _pre_call_callback("glLoadTransposeMatrixf", (void*)glLoadTransposeMatrixf, 1, arg0);
+    glad_glLoadTransposeMatrixf(arg0);
+    _post_call_callback("glLoadTransposeMatrixf", (void*)glLoadTransposeMatrixf, 1, arg0);
+}
+PFNGLLOADTRANSPOSEMATRIXFPROC glad_debug_glLoadTransposeMatrixf = glad_debug_impl_glLoadTransposeMatrixf;
 PFNGLLOGICOPPROC glad_glLogicOp = NULL;
+void APIENTRY glad_debug_impl_glLogicOp(GLenum arg0) {
+    _pre_call_callback("glLogicOp", (void*)glLogicOp, 1, arg0);
+    glad_glLogicOp(arg0);
+    _post_call_callback("glLogicOp", (void*)glLogicOp, 1, arg0);
+}
+PFNGLLOGICOPPROC glad_debug_glLogicOp = glad_debug_impl_glLogicOp;
 PFNGLMAP1DPROC glad_glMap1d = NULL;
+void APIENTRY glad_debug_impl_glMap1d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, const GLdouble * arg5) {
+    _pre_call_callback("glMap1d", (void*)glMap1d, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glMap1d(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glMap1d", (void*)glMap1d, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLMAP1DPROC glad_debug_glMap1d = glad_debug_impl_glMap1d;
 PFNGLMAP1FPROC glad_glMap1f = NULL;
+void APIENTRY glad_debug_impl_glMap1f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, const GLfloat * arg5) {
+    _pre_call_callback("glMap1f", (void*)glMap1f, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glMap1f(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glMap1f", (void*)glMap1f, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLMAP1FPROC glad_debug_glMap1f = glad_debug_impl_glMap1f;
 PFNGLMAP2DPROC glad_glMap2d = NULL;
+void APIENTRY glad_debug_impl_glMap2d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, GLdouble arg5, GLdouble arg6, GLint arg7, GLint arg8, const GLdouble * arg9) {
+    _pre_call_callback("glMap2d", (void*)glMap2d, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    glad_glMap2d(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    _post_call_callback("glMap2d", (void*)glMap2d, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+PFNGLMAP2DPROC glad_debug_glMap2d = glad_debug_impl_glMap2d;
 PFNGLMAP2FPROC glad_glMap2f = NULL;
+void APIENTRY glad_debug_impl_glMap2f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, GLfloat arg5, GLfloat arg6, GLint arg7, GLint arg8, const GLfloat * arg9) {
+    _pre_call_callback("glMap2f", (void*)glMap2f, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    glad_glMap2f(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    _post_call_callback("glMap2f", (void*)glMap2f, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+PFNGLMAP2FPROC glad_debug_glMap2f = glad_debug_impl_glMap2f;
 PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
+void * APIENTRY glad_debug_impl_glMapBuffer(GLenum arg0, GLenum arg1) {
+    void * ret;
+    _pre_call_callback("glMapBuffer", (void*)glMapBuffer, 2, arg0, arg1);
+    ret = glad_glMapBuffer(arg0, arg1);
+    _post_call_callback("glMapBuffer", (void*)glMapBuffer, 2, arg0, arg1);
+    return ret;
+}
+PFNGLMAPBUFFERPROC glad_debug_glMapBuffer = glad_debug_impl_glMapBuffer;
 PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
+void * APIENTRY glad_debug_impl_glMapBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+    void * ret;
+    _pre_call_callback("glMapBufferRange", (void*)glMapBufferRange, 4, arg0, arg1, arg2, arg3);
+    ret = glad_glMapBufferRange(arg0, arg1, arg2, arg3);
+    _post_call_callback("glMapBufferRange", (void*)glMapBufferRange, 4, arg0, arg1, arg2, arg3);
+    return ret;
+}
+PFNGLMAPBUFFERRANGEPROC glad_debug_glMapBufferRange = glad_debug_impl_glMapBufferRange;
 PFNGLMAPGRID1DPROC glad_glMapGrid1d = NULL;
+void APIENTRY glad_debug_impl_glMapGrid1d(GLint arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glMapGrid1d", (void*)glMapGrid1d, 3, arg0, arg1, arg2);
+    glad_glMapGrid1d(arg0, arg1, arg2);
+    _post_call_callback("glMapGrid1d", (void*)glMapGrid1d, 3, arg0, arg1, arg2);
+}
+PFNGLMAPGRID1DPROC glad_debug_glMapGrid1d = glad_debug_impl_glMapGrid1d;
 PFNGLMAPGRID1FPROC glad_glMapGrid1f = NULL;
+void APIENTRY glad_debug_impl_glMapGrid1f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glMapGrid1f", (void*)glMapGrid1f, 3, arg0, arg1, arg2);
+    glad_glMapGrid1f(arg0, arg1, arg2);
+    _post_call_callback("glMapGrid1f", (void*)glMapGrid1f, 3, arg0, arg1, arg2);
+}
+PFNGLMAPGRID1FPROC glad_debug_glMapGrid1f = glad_debug_impl_glMapGrid1f;
 PFNGLMAPGRID2DPROC glad_glMapGrid2d = NULL;
+void APIENTRY glad_debug_impl_glMapGrid2d(GLint arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLdouble arg4, GLdouble arg5) {
+    _pre_call_callback("glMapGrid2d", (void*)glMapGrid2d, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glMapGrid2d(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glMapGrid2d", (void*)glMapGrid2d, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLMAPGRID2DPROC glad_debug_glMapGrid2d = glad_debug_impl_glMapGrid2d;
 PFNGLMAPGRID2FPROC glad_glMapGrid2f = NULL;
+void APIENTRY glad_debug_impl_glMapGrid2f(GLint arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLfloat arg4, GLfloat arg5) {
+    _pre_call_callback("glMapGrid2f", (void*)glMapGrid2f, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glMapGrid2f(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glMapGrid2f", (void*)glMapGrid2f, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLMAPGRID2FPROC glad_debug_glMapGrid2f = glad_debug_impl_glMapGrid2f;
 PFNGLMATERIALFPROC glad_glMaterialf = NULL;
+void APIENTRY glad_debug_impl_glMaterialf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+    _pre_call_callback("glMaterialf", (void*)glMaterialf, 3, arg0, arg1, arg2);
+    glad_glMaterialf(arg0, arg1, arg2);
+    _post_call_callback("glMaterialf", (void*)glMaterialf, 3, arg0, arg1, arg2);
+}
+PFNGLMATERIALFPROC glad_debug_glMaterialf = glad_debug_impl_glMaterialf;
 PFNGLMATERIALFVPROC glad_glMaterialfv = NULL;
+void APIENTRY glad_debug_impl_glMaterialfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+    _pre_call_callback("glMaterialfv", (void*)glMaterialfv, 3, arg0, arg1, arg2);
+    glad_glMaterialfv(arg0, arg1, arg2);
+    _post_call_callback("glMaterialfv", (void*)glMaterialfv, 3, arg0, arg1, arg2);
+}
+PFNGLMATERIALFVPROC glad_debug_glMaterialfv = glad_debug_impl_glMaterialfv;
 PFNGLMATERIALIPROC glad_glMateriali = NULL;
+void APIENTRY glad_debug_impl_glMateriali(GLenum arg0, GLenum arg1, GLint arg2) {
+    _pre_call_callback("glMateriali", (void*)glMateriali, 3, arg0, arg1, arg2);
+    glad_glMateriali(arg0, arg1, arg2);
+    _post_call_callback("glMateriali", (void*)glMateriali, 3, arg0, arg1, arg2);
+}
+PFNGLMATERIALIPROC glad_debug_glMateriali = glad_debug_impl_glMateriali;
 PFNGLMATERIALIVPROC glad_glMaterialiv = NULL;
+void APIENTRY glad_debug_impl_glMaterialiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glMaterialiv", (void*)glMaterialiv, 3, arg0, arg1, arg2);
+    glad_glMaterialiv(arg0, arg1, arg2);
+    _post_call_callback("glMaterialiv", (void*)glMaterialiv, 3, arg0, arg1, arg2);
+}
+PFNGLMATERIALIVPROC glad_debug_glMaterialiv = glad_debug_impl_glMaterialiv;
 PFNGLMATRIXMODEPROC glad_glMatrixMode = NULL;
+void APIENTRY glad_debug_impl_glMatrixMode(GLenum arg0) {
+    _pre_call_callback("glMatrixMode", (void*)glMatrixMode, 1, arg0);
+    glad_glMatrixMode(arg0);
+    _post_call_callback("glMatrixMode", (void*)glMatrixMode, 1, arg0);
+}
+PFNGLMATRIXMODEPROC glad_debug_glMatrixMode = glad_debug_impl_glMatrixMode;
 PFNGLMULTMATRIXDPROC glad_glMultMatrixd = NULL;
+void APIENTRY glad_debug_impl_glMultMatrixd(const GLdouble * arg0) {
+    _pre_call_callback("glMultMatrixd", (void*)glMultMatrixd, 1, arg0);
+    glad_glMultMatrixd(arg0);
+    _post_call_callback("glMultMatrixd", (void*)glMultMatrixd, 1, arg0);
+}
+PFNGLMULTMATRIXDPROC glad_debug_glMultMatrixd = glad_debug_impl_glMultMatrixd;
 PFNGLMULTMATRIXFPROC glad_glMultMatrixf = NULL;
+void APIENTRY glad_debug_impl_glMultMatrixf(const GLfloat * arg0) {
+    _pre_call_callback("glMultMatrixf", (void*)glMultMatrixf, 1, arg0);
+    glad_glMultMatrixf(arg0);
+    _post_call_callback("glMultMatrixf", (void*)glMultMatrixf, 1, arg0);
+}
+PFNGLMULTMATRIXFPROC glad_debug_glMultMatrixf = glad_debug_impl_glMultMatrixf;
 PFNGLMULTTRANSPOSEMATRIXDPROC glad_glMultTransposeMatrixd = NULL;
+void APIENTRY glad_debug_impl_glMultTransposeMatrixd(const GLdouble * arg0) {
+    _pre_call_callback("glMultTransposeMatrixd", (void*)glMultTransposeMatrixd, 1, arg0);
+    glad_glMultTransposeMatrixd(arg0);
+    _post_call_callback("glMultTransposeMatrixd", (void*)glMultTransposeMatrixd, 1, arg0);
+}
+PFNGLMULTTRANSPOSEMATRIXDPROC glad_debug_glMultTransposeMatrixd = glad_debug_impl_glMultTransposeMatrixd;
 PFNGLMULTTRANSPOSEMATRIXFPROC glad_glMultTransposeMatrixf = NULL;
+void APIENTRY glad_debug_impl_glMultTransposeMatrixf(const GLfloat * arg0) {
+    _pre_call_callback("glMultTransposeMatrixf", (void*)glMultTransposeMatrixf, 1, arg0);
+    glad_glMultTransposeMatrixf(arg0);
+    _post_call_callback("glMultTransposeMatrixf", (void*)glMultTransposeMatrixf, 1, arg0);
+}
+PFNGLMULTTRANSPOSEMATRIXFPROC glad_debug_glMultTransposeMatrixf = glad_debug_impl_glMultTransposeMatrixf;
 PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
+void APIENTRY glad_debug_impl_glMultiDrawArrays(GLenum arg0, const GLint * arg1, const GLsizei * arg2, GLsizei arg3) {
+    _pre_call_callback("glMultiDrawArrays", (void*)glMultiDrawArrays, 4, arg0, arg1, arg2, arg3);
+    glad_glMultiDrawArrays(arg0, arg1, arg2, arg3);
+    _post_call_callback("glMultiDrawArrays", (void*)glMultiDrawArrays, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLMULTIDRAWARRAYSPROC glad_debug_glMultiDrawArrays = glad_debug_impl_glMultiDrawArrays;
 PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
+void APIENTRY glad_debug_impl_glMultiDrawElements(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const* arg3, GLsizei arg4) {
+    _pre_call_callback("glMultiDrawElements", (void*)glMultiDrawElements, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glMultiDrawElements(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glMultiDrawElements", (void*)glMultiDrawElements, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLMULTIDRAWELEMENTSPROC glad_debug_glMultiDrawElements = glad_debug_impl_glMultiDrawElements;
 PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
+void APIENTRY glad_debug_impl_glMultiDrawElementsBaseVertex(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const* arg3, GLsizei arg4, const GLint * arg5) {
+    _pre_call_callback("glMultiDrawElementsBaseVertex", (void*)glMultiDrawElementsBaseVertex, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glMultiDrawElementsBaseVertex(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glMultiDrawElementsBaseVertex", (void*)glMultiDrawElementsBaseVertex, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_debug_glMultiDrawElementsBaseVertex = glad_debug_impl_glMultiDrawElementsBaseVertex;
 PFNGLMULTITEXCOORD1DPROC glad_glMultiTexCoord1d = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord1d(GLenum arg0, GLdouble arg1) {
+    _pre_call_callback("glMultiTexCoord1d", (void*)glMultiTexCoord1d, 2, arg0, arg1);
+    glad_glMultiTexCoord1d(arg0, arg1);
+    _post_call_callback("glMultiTexCoord1d", (void*)glMultiTexCoord1d, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD1DPROC glad_debug_glMultiTexCoord1d = glad_debug_impl_glMultiTexCoord1d;
 PFNGLMULTITEXCOORD1DVPROC glad_glMultiTexCoord1dv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord1dv(GLenum arg0, const GLdouble * arg1) {
+    _pre_call_callback("glMultiTexCoord1dv", (void*)glMultiTexCoord1dv, 2, arg0, arg1);
+    glad_glMultiTexCoord1dv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord1dv", (void*)glMultiTexCoord1dv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD1DVPROC glad_debug_glMultiTexCoord1dv = glad_debug_impl_glMultiTexCoord1dv;
 PFNGLMULTITEXCOORD1FPROC glad_glMultiTexCoord1f = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord1f(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glMultiTexCoord1f", (void*)glMultiTexCoord1f, 2, arg0, arg1);
+    glad_glMultiTexCoord1f(arg0, arg1);
+    _post_call_callback("glMultiTexCoord1f", (void*)glMultiTexCoord1f, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD1FPROC glad_debug_glMultiTexCoord1f = glad_debug_impl_glMultiTexCoord1f;
 PFNGLMULTITEXCOORD1FVPROC glad_glMultiTexCoord1fv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord1fv(GLenum arg0, const GLfloat * arg1) {
+    _pre_call_callback("glMultiTexCoord1fv", (void*)glMultiTexCoord1fv, 2, arg0, arg1);
+    glad_glMultiTexCoord1fv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord1fv", (void*)glMultiTexCoord1fv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD1FVPROC glad_debug_glMultiTexCoord1fv = glad_debug_impl_glMultiTexCoord1fv;
 PFNGLMULTITEXCOORD1IPROC glad_glMultiTexCoord1i = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord1i(GLenum arg0, GLint arg1) {
+    _pre_call_callback("glMultiTexCoord1i", (void*)glMultiTexCoord1i, 2, arg0, arg1);
+    glad_glMultiTexCoord1i(arg0, arg1);
+    _post_call_callback("glMultiTexCoord1i", (void*)glMultiTexCoord1i, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD1IPROC glad_debug_glMultiTexCoord1i = glad_debug_impl_glMultiTexCoord1i;
 PFNGLMULTITEXCOORD1IVPROC glad_glMultiTexCoord1iv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord1iv(GLenum arg0, const GLint * arg1) {
+    _pre_call_callback("glMultiTexCoord1iv", (void*)glMultiTexCoord1iv, 2, arg0, arg1);
+    glad_glMultiTexCoord1iv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord1iv", (void*)glMultiTexCoord1iv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD1IVPROC glad_debug_glMultiTexCoord1iv = glad_debug_impl_glMultiTexCoord1iv;
 PFNGLMULTITEXCOORD1SPROC glad_glMultiTexCoord1s = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord1s(GLenum arg0, GLshort arg1) {
+    _pre_call_callback("glMultiTexCoord1s", (void*)glMultiTexCoord1s, 2, arg0, arg1);
+    glad_glMultiTexCoord1s(arg0, arg1);
+    _post_call_callback("glMultiTexCoord1s", (void*)glMultiTexCoord1s, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD1SPROC glad_debug_glMultiTexCoord1s = glad_debug_impl_glMultiTexCoord1s;
 PFNGLMULTITEXCOORD1SVPROC glad_glMultiTexCoord1sv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord1sv(GLenum arg0, const GLshort * arg1) {
+    _pre_call_callback("glMultiTexCoord1sv", (void*)glMultiTexCoord1sv, 2, arg0, arg1);
+    glad_glMultiTexCoord1sv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord1sv", (void*)glMultiTexCoord1sv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD1SVPROC glad_debug_glMultiTexCoord1sv = glad_debug_impl_glMultiTexCoord1sv;
 PFNGLMULTITEXCOORD2DPROC glad_glMultiTexCoord2d = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord2d(GLenum arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glMultiTexCoord2d", (void*)glMultiTexCoord2d, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoord2d(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoord2d", (void*)glMultiTexCoord2d, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORD2DPROC glad_debug_glMultiTexCoord2d = glad_debug_impl_glMultiTexCoord2d;
 PFNGLMULTITEXCOORD2DVPROC glad_glMultiTexCoord2dv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord2dv(GLenum arg0, const GLdouble * arg1) {
+    _pre_call_callback("glMultiTexCoord2dv", (void*)glMultiTexCoord2dv, 2, arg0, arg1);
+    glad_glMultiTexCoord2dv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord2dv", (void*)glMultiTexCoord2dv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD2DVPROC glad_debug_glMultiTexCoord2dv = glad_debug_impl_glMultiTexCoord2dv;
 PFNGLMULTITEXCOORD2FPROC glad_glMultiTexCoord2f = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord2f(GLenum arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glMultiTexCoord2f", (void*)glMultiTexCoord2f, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoord2f(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoord2f", (void*)glMultiTexCoord2f, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORD2FPROC glad_debug_glMultiTexCoord2f = glad_debug_impl_glMultiTexCoord2f;
 PFNGLMULTITEXCOORD2FVPROC glad_glMultiTexCoord2fv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord2fv(GLenum arg0, const GLfloat * arg1) {
+    _pre_call_callback("glMultiTexCoord2fv", (void*)glMultiTexCoord2fv, 2, arg0, arg1);
+    glad_glMultiTexCoord2fv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord2fv", (void*)glMultiTexCoord2fv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD2FVPROC glad_debug_glMultiTexCoord2fv = glad_debug_impl_glMultiTexCoord2fv;
 PFNGLMULTITEXCOORD2IPROC glad_glMultiTexCoord2i = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord2i(GLenum arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glMultiTexCoord2i", (void*)glMultiTexCoord2i, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoord2i(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoord2i", (void*)glMultiTexCoord2i, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORD2IPROC glad_debug_glMultiTexCoord2i = glad_debug_impl_glMultiTexCoord2i;
 PFNGLMULTITEXCOORD2IVPROC glad_glMultiTexCoord2iv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord2iv(GLenum arg0, const GLint * arg1) {
+    _pre_call_callback("glMultiTexCoord2iv", (void*)glMultiTexCoord2iv, 2, arg0, arg1);
+    glad_glMultiTexCoord2iv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord2iv", (void*)glMultiTexCoord2iv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD2IVPROC glad_debug_glMultiTexCoord2iv = glad_debug_impl_glMultiTexCoord2iv;
 PFNGLMULTITEXCOORD2SPROC glad_glMultiTexCoord2s = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord2s(GLenum arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glMultiTexCoord2s", (void*)glMultiTexCoord2s, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoord2s(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoord2s", (void*)glMultiTexCoord2s, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORD2SPROC glad_debug_glMultiTexCoord2s = glad_debug_impl_glMultiTexCoord2s;
 PFNGLMULTITEXCOORD2SVPROC glad_glMultiTexCoord2sv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord2sv(GLenum arg0, const GLshort * arg1) {
+    _pre_call_callback("glMultiTexCoord2sv", (void*)glMultiTexCoord2sv, 2, arg0, arg1);
+    glad_glMultiTexCoord2sv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord2sv", (void*)glMultiTexCoord2sv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD2SVPROC glad_debug_glMultiTexCoord2sv = glad_debug_impl_glMultiTexCoord2sv;
 PFNGLMULTITEXCOORD3DPROC glad_glMultiTexCoord3d = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord3d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+    _pre_call_callback("glMultiTexCoord3d", (void*)glMultiTexCoord3d, 4, arg0, arg1, arg2, arg3);
+    glad_glMultiTexCoord3d(arg0, arg1, arg2, arg3);
+    _post_call_callback("glMultiTexCoord3d", (void*)glMultiTexCoord3d, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLMULTITEXCOORD3DPROC glad_debug_glMultiTexCoord3d = glad_debug_impl_glMultiTexCoord3d;
 PFNGLMULTITEXCOORD3DVPROC glad_glMultiTexCoord3dv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord3dv(GLenum arg0, const GLdouble * arg1) {
+    _pre_call_callback("glMultiTexCoord3dv", (void*)glMultiTexCoord3dv, 2, arg0, arg1);
+    glad_glMultiTexCoord3dv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord3dv", (void*)glMultiTexCoord3dv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD3DVPROC glad_debug_glMultiTexCoord3dv = glad_debug_impl_glMultiTexCoord3dv;
 PFNGLMULTITEXCOORD3FPROC glad_glMultiTexCoord3f = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord3f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glMultiTexCoord3f", (void*)glMultiTexCoord3f, 4, arg0, arg1, arg2, arg3);
+    glad_glMultiTexCoord3f(arg0, arg1, arg2, arg3);
+    _post_call_callback("glMultiTexCoord3f", (void*)glMultiTexCoord3f, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLMULTITEXCOORD3FPROC glad_debug_glMultiTexCoord3f = glad_debug_impl_glMultiTexCoord3f;
 PFNGLMULTITEXCOORD3FVPROC glad_glMultiTexCoord3fv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord3fv(GLenum arg0, const GLfloat * arg1) {
+    _pre_call_callback("glMultiTexCoord3fv", (void*)glMultiTexCoord3fv, 2, arg0, arg1);
+    glad_glMultiTexCoord3fv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord3fv", (void*)glMultiTexCoord3fv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD3FVPROC glad_debug_glMultiTexCoord3fv = glad_debug_impl_glMultiTexCoord3fv;
 PFNGLMULTITEXCOORD3IPROC glad_glMultiTexCoord3i = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord3i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glMultiTexCoord3i", (void*)glMultiTexCoord3i, 4, arg0, arg1, arg2, arg3);
+    glad_glMultiTexCoord3i(arg0, arg1, arg2, arg3);
+    _post_call_callback("glMultiTexCoord3i", (void*)glMultiTexCoord3i, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLMULTITEXCOORD3IPROC glad_debug_glMultiTexCoord3i = glad_debug_impl_glMultiTexCoord3i;
 PFNGLMULTITEXCOORD3IVPROC glad_glMultiTexCoord3iv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord3iv(GLenum arg0, const GLint * arg1) {
+    _pre_call_callback("glMultiTexCoord3iv", (void*)glMultiTexCoord3iv, 2, arg0, arg1);
+    glad_glMultiTexCoord3iv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord3iv", (void*)glMultiTexCoord3iv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD3IVPROC glad_debug_glMultiTexCoord3iv = glad_debug_impl_glMultiTexCoord3iv;
 PFNGLMULTITEXCOORD3SPROC glad_glMultiTexCoord3s = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord3s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+    _pre_call_callback("glMultiTexCoord3s", (void*)glMultiTexCoord3s, 4, arg0, arg1, arg2, arg3);
+    glad_glMultiTexCoord3s(arg0, arg1, arg2, arg3);
+    _post_call_callback("glMultiTexCoord3s", (void*)glMultiTexCoord3s, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLMULTITEXCOORD3SPROC glad_debug_glMultiTexCoord3s = glad_debug_impl_glMultiTexCoord3s;
 PFNGLMULTITEXCOORD3SVPROC glad_glMultiTexCoord3sv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord3sv(GLenum arg0, const GLshort * arg1) {
+    _pre_call_callback("glMultiTexCoord3sv", (void*)glMultiTexCoord3sv, 2, arg0, arg1);
+    glad_glMultiTexCoord3sv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord3sv", (void*)glMultiTexCoord3sv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD3SVPROC glad_debug_glMultiTexCoord3sv = glad_debug_impl_glMultiTexCoord3sv;
 PFNGLMULTITEXCOORD4DPROC glad_glMultiTexCoord4d = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord4d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+    _pre_call_callback("glMultiTexCoord4d", (void*)glMultiTexCoord4d, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glMultiTexCoord4d(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glMultiTexCoord4d", (void*)glMultiTexCoord4d, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLMULTITEXCOORD4DPROC glad_debug_glMultiTexCoord4d = glad_debug_impl_glMultiTexCoord4d;
 PFNGLMULTITEXCOORD4DVPROC glad_glMultiTexCoord4dv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord4dv(GLenum arg0, const GLdouble * arg1) {
+    _pre_call_callback("glMultiTexCoord4dv", (void*)glMultiTexCoord4dv, 2, arg0, arg1);
+    glad_glMultiTexCoord4dv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord4dv", (void*)glMultiTexCoord4dv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD4DVPROC glad_debug_glMultiTexCoord4dv = glad_debug_impl_glMultiTexCoord4dv;
 PFNGLMULTITEXCOORD4FPROC glad_glMultiTexCoord4f = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord4f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+    _pre_call_callback("glMultiTexCoord4f", (void*)glMultiTexCoord4f, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glMultiTexCoord4f(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glMultiTexCoord4f", (void*)glMultiTexCoord4f, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLMULTITEXCOORD4FPROC glad_debug_glMultiTexCoord4f = glad_debug_impl_glMultiTexCoord4f;
 PFNGLMULTITEXCOORD4FVPROC glad_glMultiTexCoord4fv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord4fv(GLenum arg0, const GLfloat * arg1) {
+    _pre_call_callback("glMultiTexCoord4fv", (void*)glMultiTexCoord4fv, 2, arg0, arg1);
+    glad_glMultiTexCoord4fv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord4fv", (void*)glMultiTexCoord4fv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD4FVPROC glad_debug_glMultiTexCoord4fv = glad_debug_impl_glMultiTexCoord4fv;
 PFNGLMULTITEXCOORD4IPROC glad_glMultiTexCoord4i = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord4i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+    _pre_call_callback("glMultiTexCoord4i", (void*)glMultiTexCoord4i, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glMultiTexCoord4i(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glMultiTexCoord4i", (void*)glMultiTexCoord4i, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLMULTITEXCOORD4IPROC glad_debug_glMultiTexCoord4i = glad_debug_impl_glMultiTexCoord4i;
 PFNGLMULTITEXCOORD4IVPROC glad_glMultiTexCoord4iv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord4iv(GLenum arg0, const GLint * arg1) {
+    _pre_call_callback("glMultiTexCoord4iv", (void*)glMultiTexCoord4iv, 2, arg0, arg1);
+    glad_glMultiTexCoord4iv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord4iv", (void*)glMultiTexCoord4iv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD4IVPROC glad_debug_glMultiTexCoord4iv = glad_debug_impl_glMultiTexCoord4iv;
 PFNGLMULTITEXCOORD4SPROC glad_glMultiTexCoord4s = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord4s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+    _pre_call_callback("glMultiTexCoord4s", (void*)glMultiTexCoord4s, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glMultiTexCoord4s(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glMultiTexCoord4s", (void*)glMultiTexCoord4s, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLMULTITEXCOORD4SPROC glad_debug_glMultiTexCoord4s = glad_debug_impl_glMultiTexCoord4s;
 PFNGLMULTITEXCOORD4SVPROC glad_glMultiTexCoord4sv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoord4sv(GLenum arg0, const GLshort * arg1) {
+    _pre_call_callback("glMultiTexCoord4sv", (void*)glMultiTexCoord4sv, 2, arg0, arg1);
+    glad_glMultiTexCoord4sv(arg0, arg1);
+    _post_call_callback("glMultiTexCoord4sv", (void*)glMultiTexCoord4sv, 2, arg0, arg1);
+}
+PFNGLMULTITEXCOORD4SVPROC glad_debug_glMultiTexCoord4sv = glad_debug_impl_glMultiTexCoord4sv;
 PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoordP1ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glMultiTexCoordP1ui", (void*)glMultiTexCoordP1ui, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoordP1ui(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP1ui", (void*)glMultiTexCoordP1ui, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP1UIPROC glad_debug_glMultiTexCoordP1ui = glad_debug_impl_glMultiTexCoordP1ui;
 PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoordP1uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glMultiTexCoordP1uiv", (void*)glMultiTexCoordP1uiv, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoordP1uiv(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP1uiv", (void*)glMultiTexCoordP1uiv, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP1UIVPROC glad_debug_glMultiTexCoordP1uiv = glad_debug_impl_glMultiTexCoordP1uiv;
 PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoordP2ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glMultiTexCoordP2ui", (void*)glMultiTexCoordP2ui, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoordP2ui(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP2ui", (void*)glMultiTexCoordP2ui, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP2UIPROC glad_debug_glMultiTexCoordP2ui = glad_debug_impl_glMultiTexCoordP2ui;
 PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoordP2uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glMultiTexCoordP2uiv", (void*)glMultiTexCoordP2uiv, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoordP2uiv(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP2uiv", (void*)glMultiTexCoordP2uiv, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP2UIVPROC glad_debug_glMultiTexCoordP2uiv = glad_debug_impl_glMultiTexCoordP2uiv;
 PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoordP3ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glMultiTexCoordP3ui", (void*)glMultiTexCoordP3ui, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoordP3ui(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP3ui", (void*)glMultiTexCoordP3ui, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP3UIPROC glad_debug_glMultiTexCoordP3ui = glad_debug_impl_glMultiTexCoordP3ui;
 PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoordP3uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glMultiTexCoordP3uiv", (void*)glMultiTexCoordP3uiv, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoordP3uiv(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP3uiv", (void*)glMultiTexCoordP3uiv, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP3UIVPROC glad_debug_glMultiTexCoordP3uiv = glad_debug_impl_glMultiTexCoordP3uiv;
 PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoordP4ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glMultiTexCoordP4ui", (void*)glMultiTexCoordP4ui, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoordP4ui(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP4ui", (void*)glMultiTexCoordP4ui, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP4UIPROC glad_debug_glMultiTexCoordP4ui = glad_debug_impl_glMultiTexCoordP4ui;
 PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
+void APIENTRY glad_debug_impl_glMultiTexCoordP4uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glMultiTexCoordP4uiv", (void*)glMultiTexCoordP4uiv, 3, arg0, arg1, arg2);
+    glad_glMultiTexCoordP4uiv(arg0, arg1, arg2);
+    _post_call_callback("glMultiTexCoordP4uiv", (void*)glMultiTexCoordP4uiv, 3, arg0, arg1, arg2);
+}
+PFNGLMULTITEXCOORDP4UIVPROC glad_debug_glMultiTexCoordP4uiv = glad_debug_impl_glMultiTexCoordP4uiv;
 PFNGLNEWLISTPROC glad_glNewList = NULL;
+void APIENTRY glad_debug_impl_glNewList(GLuint arg0, GLenum arg1) {
+    _pre_call_callback("glNewList", (void*)glNewList, 2, arg0, arg1);
+    glad_glNewList(arg0, arg1);
+    _post_call_callback("glNewList", (void*)glNewList, 2, arg0, arg1);
+}
+PFNGLNEWLISTPROC glad_debug_glNewList = glad_debug_impl_glNewList;
 PFNGLNORMAL3BPROC glad_glNormal3b = NULL;
+void APIENTRY glad_debug_impl_glNormal3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+    _pre_call_callback("glNormal3b", (void*)glNormal3b, 3, arg0, arg1, arg2);
+    glad_glNormal3b(arg0, arg1, arg2);
+    _post_call_callback("glNormal3b", (void*)glNormal3b, 3, arg0, arg1, arg2);
+}
+PFNGLNORMAL3BPROC glad_debug_glNormal3b = glad_debug_impl_glNormal3b;
 PFNGLNORMAL3BVPROC glad_glNormal3bv = NULL;
+void APIENTRY glad_debug_impl_glNormal3bv(const GLbyte * arg0) {
+    _pre_call_callback("glNormal3bv", (void*)glNormal3bv, 1, arg0);
+    glad_glNormal3bv(arg0);
+    _post_call_callback("glNormal3bv", (void*)glNormal3bv, 1, arg0);
+}
+PFNGLNORMAL3BVPROC glad_debug_glNormal3bv = glad_debug_impl_glNormal3bv;
 PFNGLNORMAL3DPROC glad_glNormal3d = NULL;
+void APIENTRY glad_debug_impl_glNormal3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glNormal3d", (void*)glNormal3d, 3, arg0, arg1, arg2);
+    glad_glNormal3d(arg0, arg1, arg2);
+    _post_call_callback("glNormal3d", (void*)glNormal3d, 3, arg0, arg1, arg2);
+}
+PFNGLNORMAL3DPROC glad_debug_glNormal3d = glad_debug_impl_glNormal3d;
 PFNGLNORMAL3DVPROC glad_glNormal3dv = NULL;
+void APIENTRY glad_debug_impl_glNormal3dv(const GLdouble * arg0) {
+    _pre_call_callback("glNormal3dv", (void*)glNormal3dv, 1, arg0);
+    glad_glNormal3dv(arg0);
+    _post_call_callback("glNormal3dv", (void*)glNormal3dv, 1, arg0);
+}
+PFNGLNORMAL3DVPROC glad_debug_glNormal3dv = glad_debug_impl_glNormal3dv;
 PFNGLNORMAL3FPROC glad_glNormal3f = NULL;
+void APIENTRY glad_debug_impl_glNormal3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glNormal3f", (void*)glNormal3f, 3, arg0, arg1, arg2);
+    glad_glNormal3f(arg0, arg1, arg2);
+    _post_call_callback("glNormal3f", (void*)glNormal3f, 3, arg0, arg1, arg2);
+}
+PFNGLNORMAL3FPROC glad_debug_glNormal3f = glad_debug_impl_glNormal3f;
 PFNGLNORMAL3FVPROC glad_glNormal3fv = NULL;
+void APIENTRY glad_debug_impl_glNormal3fv(const GLfloat * arg0) {
+    _pre_call_callback("glNormal3fv", (void*)glNormal3fv, 1, arg0);
+    glad_glNormal3fv(arg0);
+    _post_call_callback("glNormal3fv", (void*)glNormal3fv, 1, arg0);
+}
+PFNGLNORMAL3FVPROC glad_debug_glNormal3fv = glad_debug_impl_glNormal3fv;
 PFNGLNORMAL3IPROC glad_glNormal3i = NULL;
+void APIENTRY glad_debug_impl_glNormal3i(GLint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glNormal3i", (void*)glNormal3i, 3, arg0, arg1, arg2);
+    glad_glNormal3i(arg0, arg1, arg2);
+    _post_call_callback("glNormal3i", (void*)glNormal3i, 3, arg0, arg1, arg2);
+}
+PFNGLNORMAL3IPROC glad_debug_glNormal3i = glad_debug_impl_glNormal3i;
 PFNGLNORMAL3IVPROC glad_glNormal3iv = NULL;
+void APIENTRY glad_debug_impl_glNormal3iv(const GLint * arg0) {
+    _pre_call_callback("glNormal3iv", (void*)glNormal3iv, 1, arg0);
+    glad_glNormal3iv(arg0);
+    _post_call_callback("glNormal3iv", (void*)glNormal3iv, 1, arg0);
+}
+PFNGLNORMAL3IVPROC glad_debug_glNormal3iv = glad_debug_impl_glNormal3iv;
 PFNGLNORMAL3SPROC glad_glNormal3s = NULL;
+void APIENTRY glad_debug_impl_glNormal3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glNormal3s", (void*)glNormal3s, 3, arg0, arg1, arg2);
+    glad_glNormal3s(arg0, arg1, arg2);
+    _post_call_callback("glNormal3s", (void*)glNormal3s, 3, arg0, arg1, arg2);
+}
+PFNGLNORMAL3SPROC glad_debug_glNormal3s = glad_debug_impl_glNormal3s;
 PFNGLNORMAL3SVPROC glad_glNormal3sv = NULL;
+void APIENTRY glad_debug_impl_glNormal3sv(const GLshort * arg0) {
+    _pre_call_callback("glNormal3sv", (void*)glNormal3sv, 1, arg0);
+    glad_glNormal3sv(arg0);
+    _post_call_callback("glNormal3sv", (void*)glNormal3sv, 1, arg0);
+}
+PFNGLNORMAL3SVPROC glad_debug_glNormal3sv = glad_debug_impl_glNormal3sv;
 PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
+void APIENTRY glad_debug_impl_glNormalP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glNormalP3ui", (void*)glNormalP3ui, 2, arg0, arg1);
+    glad_glNormalP3ui(arg0, arg1);
+    _post_call_callback("glNormalP3ui", (void*)glNormalP3ui, 2, arg0, arg1);
+}
+PFNGLNORMALP3UIPROC glad_debug_glNormalP3ui = glad_debug_impl_glNormalP3ui;
 PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
+void APIENTRY glad_debug_impl_glNormalP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glNormalP3uiv", (void*)glNormalP3uiv, 2, arg0, arg1);
+    glad_glNormalP3uiv(arg0, arg1);
+    _post_call_callback("glNormalP3uiv", (void*)glNormalP3uiv, 2, arg0, arg1);
+}
+PFNGLNORMALP3UIVPROC glad_debug_glNormalP3uiv = glad_debug_impl_glNormalP3uiv;
 PFNGLNORMALPOINTERPROC glad_glNormalPointer = NULL;
+void APIENTRY glad_debug_impl_glNormalPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+    _pre_call_callback("glNormalPointer", (void*)glNormalPointer, 3, arg0, arg1, arg2);
+    glad_glNormalPointer(arg0, arg1, arg2);
+    _post_call_callback("glNormalPointer", (void*)glNormalPointer, 3, arg0, arg1, arg2);
+}
+PFNGLNORMALPOINTERPROC glad_debug_glNormalPointer = glad_debug_impl_glNormalPointer;
+PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
+void APIENTRY glad_debug_impl_glObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+    _pre_call_callback("glObjectLabel", (void*)glObjectLabel, 4, arg0, arg1, arg2, arg3);
+    glad_glObjectLabel(arg0, arg1, arg2, arg3);
+    _post_call_callback("glObjectLabel", (void*)glObjectLabel, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLOBJECTLABELPROC glad_debug_glObjectLabel = glad_debug_impl_glObjectLabel;
+PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
+void APIENTRY glad_debug_impl_glObjectPtrLabel(const void * arg0, GLsizei arg1, const GLchar * arg2) {
+    _pre_call_callback("glObjectPtrLabel", (void*)glObjectPtrLabel, 3, arg0, arg1, arg2);
+    glad_glObjectPtrLabel(arg0, arg1, arg2);
+    _post_call_callback("glObjectPtrLabel", (void*)glObjectPtrLabel, 3, arg0, arg1, arg2);
+}
+PFNGLOBJECTPTRLABELPROC glad_debug_glObjectPtrLabel = glad_debug_impl_glObjectPtrLabel;
 PFNGLORTHOPROC glad_glOrtho = NULL;
+void APIENTRY glad_debug_impl_glOrtho(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+    _pre_call_callback("glOrtho", (void*)glOrtho, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glOrtho(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glOrtho", (void*)glOrtho, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLORTHOPROC glad_debug_glOrtho = glad_debug_impl_glOrtho;
 PFNGLPASSTHROUGHPROC glad_glPassThrough = NULL;
+void APIENTRY glad_debug_impl_glPassThrough(GLfloat arg0) {
+    _pre_call_callback("glPassThrough", (void*)glPassThrough, 1, arg0);
+    glad_glPassThrough(arg0);
+    _post_call_callback("glPassThrough", (void*)glPassThrough, 1, arg0);
+}
+PFNGLPASSTHROUGHPROC glad_debug_glPassThrough = glad_debug_impl_glPassThrough;
 PFNGLPIXELMAPFVPROC glad_glPixelMapfv = NULL;
+void APIENTRY glad_debug_impl_glPixelMapfv(GLenum arg0, GLsizei arg1, const GLfloat * arg2) {
+    _pre_call_callback("glPixelMapfv", (void*)glPixelMapfv, 3, arg0, arg1, arg2);
+    glad_glPixelMapfv(arg0, arg1, arg2);
+    _post_call_callback("glPixelMapfv", (void*)glPixelMapfv, 3, arg0, arg1, arg2);
+}
+PFNGLPIXELMAPFVPROC glad_debug_glPixelMapfv = glad_debug_impl_glPixelMapfv;
 PFNGLPIXELMAPUIVPROC glad_glPixelMapuiv = NULL;
+void APIENTRY glad_debug_impl_glPixelMapuiv(GLenum arg0, GLsizei arg1, const GLuint * arg2) {
+    _pre_call_callback("glPixelMapuiv", (void*)glPixelMapuiv, 3, arg0, arg1, arg2);
+    glad_glPixelMapuiv(arg0, arg1, arg2);
+    _post_call_callback("glPixelMapuiv", (void*)glPixelMapuiv, 3, arg0, arg1, arg2);
+}
+PFNGLPIXELMAPUIVPROC glad_debug_glPixelMapuiv = glad_debug_impl_glPixelMapuiv;
 PFNGLPIXELMAPUSVPROC glad_glPixelMapusv = NULL;
+void APIENTRY glad_debug_impl_glPixelMapusv(GLenum arg0, GLsizei arg1, const GLushort * arg2) {
+    _pre_call_callback("glPixelMapusv", (void*)glPixelMapusv, 3, arg0, arg1, arg2);
+    glad_glPixelMapusv(arg0, arg1, arg2);
+    _post_call_callback("glPixelMapusv", (void*)glPixelMapusv, 3, arg0, arg1, arg2);
+}
+PFNGLPIXELMAPUSVPROC glad_debug_glPixelMapusv = glad_debug_impl_glPixelMapusv;
 PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
+void APIENTRY glad_debug_impl_glPixelStoref(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glPixelStoref", (void*)glPixelStoref, 2, arg0, arg1);
+    glad_glPixelStoref(arg0, arg1);
+    _post_call_callback("glPixelStoref", (void*)glPixelStoref, 2, arg0, arg1);
+}
+PFNGLPIXELSTOREFPROC glad_debug_glPixelStoref = glad_debug_impl_glPixelStoref;
 PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
+void APIENTRY glad_debug_impl_glPixelStorei(GLenum arg0, GLint arg1) {
+    _pre_call_callback("glPixelStorei", (void*)glPixelStorei, 2, arg0, arg1);
+    glad_glPixelStorei(arg0, arg1);
+    _post_call_callback("glPixelStorei", (void*)glPixelStorei, 2, arg0, arg1);
+}
+PFNGLPIXELSTOREIPROC glad_debug_glPixelStorei = glad_debug_impl_glPixelStorei;
 PFNGLPIXELTRANSFERFPROC glad_glPixelTransferf = NULL;
+void APIENTRY glad_debug_impl_glPixelTransferf(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glPixelTransferf", (void*)glPixelTransferf, 2, arg0, arg1);
+    glad_glPixelTransferf(arg0, arg1);
+    _post_call_callback("glPixelTransferf", (void*)glPixelTransferf, 2, arg0, arg1);
+}
+PFNGLPIXELTRANSFERFPROC glad_debug_glPixelTransferf = glad_debug_impl_glPixelTransferf;
 PFNGLPIXELTRANSFERIPROC glad_glPixelTransferi = NULL;
+void APIENTRY glad_debug_impl_glPixelTransferi(GLenum arg0, GLint arg1) {
+    _pre_call_callback("glPixelTransferi", (void*)glPixelTransferi, 2, arg0, arg1);
+    glad_glPixelTransferi(arg0, arg1);
+    _post_call_callback("glPixelTransferi", (void*)glPixelTransferi, 2, arg0, arg1);
+}
+PFNGLPIXELTRANSFERIPROC glad_debug_glPixelTransferi = glad_debug_impl_glPixelTransferi;
 PFNGLPIXELZOOMPROC glad_glPixelZoom = NULL;
+void APIENTRY glad_debug_impl_glPixelZoom(GLfloat arg0, GLfloat arg1) {
+    _pre_call_callback("glPixelZoom", (void*)glPixelZoom, 2, arg0, arg1);
+    glad_glPixelZoom(arg0, arg1);
+    _post_call_callback("glPixelZoom", (void*)glPixelZoom, 2, arg0, arg1);
+}
+PFNGLPIXELZOOMPROC glad_debug_glPixelZoom = glad_debug_impl_glPixelZoom;
 PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
+void APIENTRY glad_debug_impl_glPointParameterf(GLenum arg0, GLfloat arg1) {
+    _pre_call_callback("glPointParameterf", (void*)glPointParameterf, 2, arg0, arg1);
+    glad_glPointParameterf(arg0, arg1);
+    _post_call_callback("glPointParameterf", (void*)glPointParameterf, 2, arg0, arg1);
+}
+PFNGLPOINTPARAMETERFPROC glad_debug_glPointParameterf = glad_debug_impl_glPointParameterf;
 PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = NULL;
+void APIENTRY glad_debug_impl_glPointParameterfv(GLenum arg0, const GLfloat * arg1) {
+    _pre_call_callback("glPointParameterfv", (void*)glPointParameterfv, 2, arg0, arg1);
+    glad_glPointParameterfv(arg0, arg1);
+    _post_call_callback("glPointParameterfv", (void*)glPointParameterfv, 2, arg0, arg1);
+}
+PFNGLPOINTPARAMETERFVPROC glad_debug_glPointParameterfv = glad_debug_impl_glPointParameterfv;
 PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = NULL;
+void APIENTRY glad_debug_impl_glPointParameteri(GLenum arg0, GLint arg1) {
+    _pre_call_callback("glPointParameteri", (void*)glPointParameteri, 2, arg0, arg1);
+    glad_glPointParameteri(arg0, arg1);
+    _post_call_callback("glPointParameteri", (void*)glPointParameteri, 2, arg0, arg1);
+}
+PFNGLPOINTPARAMETERIPROC glad_debug_glPointParameteri = glad_debug_impl_glPointParameteri;
 PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
+void APIENTRY glad_debug_impl_glPointParameteriv(GLenum arg0, const GLint * arg1) {
+    _pre_call_callback("glPointParameteriv", (void*)glPointParameteriv, 2, arg0, arg1);
+    glad_glPointParameteriv(arg0, arg1);
+    _post_call_callback("glPointParameteriv", (void*)glPointParameteriv, 2, arg0, arg1);
+}
+PFNGLPOINTPARAMETERIVPROC glad_debug_glPointParameteriv = glad_debug_impl_glPointParameteriv;
 PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
+void APIENTRY glad_debug_impl_glPointSize(GLfloat arg0) {
+    _pre_call_callback("glPointSize", (void*)glPointSize, 1, arg0);
+    glad_glPointSize(arg0);
+    _post_call_callback("glPointSize", (void*)glPointSize, 1, arg0);
+}
+PFNGLPOINTSIZEPROC glad_debug_glPointSize = glad_debug_impl_glPointSize;
 PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
+void APIENTRY glad_debug_impl_glPolygonMode(GLenum arg0, GLenum arg1) {
+    _pre_call_callback("glPolygonMode", (void*)glPolygonMode, 2, arg0, arg1);
+    glad_glPolygonMode(arg0, arg1);
+    _post_call_callback("glPolygonMode", (void*)glPolygonMode, 2, arg0, arg1);
+}
+PFNGLPOLYGONMODEPROC glad_debug_glPolygonMode = glad_debug_impl_glPolygonMode;
 PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
+void APIENTRY glad_debug_impl_glPolygonOffset(GLfloat arg0, GLfloat arg1) {
+    _pre_call_callback("glPolygonOffset", (void*)glPolygonOffset, 2, arg0, arg1);
+    glad_glPolygonOffset(arg0, arg1);
+    _post_call_callback("glPolygonOffset", (void*)glPolygonOffset, 2, arg0, arg1);
+}
+PFNGLPOLYGONOFFSETPROC glad_debug_glPolygonOffset = glad_debug_impl_glPolygonOffset;
 PFNGLPOLYGONSTIPPLEPROC glad_glPolygonStipple = NULL;
+void APIENTRY glad_debug_impl_glPolygonStipple(const GLubyte * arg0) {
+    _pre_call_callback("glPolygonStipple", (void*)glPolygonStipple, 1, arg0);
+    glad_glPolygonStipple(arg0);
+    _post_call_callback("glPolygonStipple", (void*)glPolygonStipple, 1, arg0);
+}
+PFNGLPOLYGONSTIPPLEPROC glad_debug_glPolygonStipple = glad_debug_impl_glPolygonStipple;
 PFNGLPOPATTRIBPROC glad_glPopAttrib = NULL;
+void APIENTRY glad_debug_impl_glPopAttrib(void) {
+    _pre_call_callback("glPopAttrib", (void*)glPopAttrib, 0);
+    glad_glPopAttrib();
+    _post_call_callback("glPopAttrib", (void*)glPopAttrib, 0);
+}
+PFNGLPOPATTRIBPROC glad_debug_glPopAttrib = glad_debug_impl_glPopAttrib;
 PFNGLPOPCLIENTATTRIBPROC glad_glPopClientAttrib = NULL;
+void APIENTRY glad_debug_impl_glPopClientAttrib(void) {
+    _pre_call_callback("glPopClientAttrib", (void*)glPopClientAttrib, 0);
+    glad_glPopClientAttrib();
+    _post_call_callback("glPopClientAttrib", (void*)glPopClientAttrib, 0);
+}
+PFNGLPOPCLIENTATTRIBPROC glad_debug_glPopClientAttrib = glad_debug_impl_glPopClientAttrib;
+PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = NULL;
+void APIENTRY glad_debug_impl_glPopDebugGroup(void) {
+    _pre_call_callback("glPopDebugGroup", (void*)glPopDebugGroup, 0);
+    glad_glPopDebugGroup();
+    _post_call_callback("glPopDebugGroup", (void*)glPopDebugGroup, 0);
+}
+PFNGLPOPDEBUGGROUPPROC glad_debug_glPopDebugGroup = glad_debug_impl_glPopDebugGroup;
 PFNGLPOPMATRIXPROC glad_glPopMatrix = NULL;
+void APIENTRY glad_debug_impl_glPopMatrix(void) {
+    _pre_call_callback("glPopMatrix", (void*)glPopMatrix, 0);
+    glad_glPopMatrix();
+    _post_call_callback("glPopMatrix", (void*)glPopMatrix, 0);
+}
+PFNGLPOPMATRIXPROC glad_debug_glPopMatrix = glad_debug_impl_glPopMatrix;
 PFNGLPOPNAMEPROC glad_glPopName = NULL;
+void APIENTRY glad_debug_impl_glPopName(void) {
+    _pre_call_callback("glPopName", (void*)glPopName, 0);
+    glad_glPopName();
+    _post_call_callback("glPopName", (void*)glPopName, 0);
+}
+PFNGLPOPNAMEPROC glad_debug_glPopName = glad_debug_impl_glPopName;
 PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
+void APIENTRY glad_debug_impl_glPrimitiveRestartIndex(GLuint arg0) {
+    _pre_call_callback("glPrimitiveRestartIndex", (void*)glPrimitiveRestartIndex, 1, arg0);
+    glad_glPrimitiveRestartIndex(arg0);
+    _post_call_callback("glPrimitiveRestartIndex", (void*)glPrimitiveRestartIndex, 1, arg0);
+}
+PFNGLPRIMITIVERESTARTINDEXPROC glad_debug_glPrimitiveRestartIndex = glad_debug_impl_glPrimitiveRestartIndex;
 PFNGLPRIORITIZETEXTURESPROC glad_glPrioritizeTextures = NULL;
+void APIENTRY glad_debug_impl_glPrioritizeTextures(GLsizei arg0, const GLuint * arg1, const GLfloat * arg2) {
+    _pre_call_callback("glPrioritizeTextures", (void*)glPrioritizeTextures, 3, arg0, arg1, arg2);
+    glad_glPrioritizeTextures(arg0, arg1, arg2);
+    _post_call_callback("glPrioritizeTextures", (void*)glPrioritizeTextures, 3, arg0, arg1, arg2);
+}
+PFNGLPRIORITIZETEXTURESPROC glad_debug_glPrioritizeTextures = glad_debug_impl_glPrioritizeTextures;
 PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
+void APIENTRY glad_debug_impl_glProvokingVertex(GLenum arg0) {
+    _pre_call_callback("glProvokingVertex", (void*)glProvokingVertex, 1, arg0);
+    glad_glProvokingVertex(arg0);
+    _post_call_callback("glProvokingVertex", (void*)glProvokingVertex, 1, arg0);
+}
+PFNGLPROVOKINGVERTEXPROC glad_debug_glProvokingVertex = glad_debug_impl_glProvokingVertex;
 PFNGLPUSHATTRIBPROC glad_glPushAttrib = NULL;
+void APIENTRY glad_debug_impl_glPushAttrib(GLbitfield arg0) {
+    _pre_call_callback("glPushAttrib", (void*)glPushAttrib, 1, arg0);
+    glad_glPushAttrib(arg0);
+    _post_call_callback("glPushAttrib", (void*)glPushAttrib, 1, arg0);
+}
+PFNGLPUSHATTRIBPROC glad_debug_glPushAttrib = glad_debug_impl_glPushAttrib;
 PFNGLPUSHCLIENTATTRIBPROC glad_glPushClientAttrib = NULL;
+void APIENTRY glad_debug_impl_glPushClientAttrib(GLbitfield arg0) {
+    _pre_call_callback("glPushClientAttrib", (void*)glPushClientAttrib, 1, arg0);
+    glad_glPushClientAttrib(arg0);
+    _post_call_callback("glPushClientAttrib", (void*)glPushClientAttrib, 1, arg0);
+}
+PFNGLPUSHCLIENTATTRIBPROC glad_debug_glPushClientAttrib = glad_debug_impl_glPushClientAttrib;
+PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = NULL;
+void APIENTRY glad_debug_impl_glPushDebugGroup(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+    _pre_call_callback("glPushDebugGroup", (void*)glPushDebugGroup, 4, arg0, arg1, arg2, arg3);
+    glad_glPushDebugGroup(arg0, arg1, arg2, arg3);
+    _post_call_callback("glPushDebugGroup", (void*)glPushDebugGroup, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLPUSHDEBUGGROUPPROC glad_debug_glPushDebugGroup = glad_debug_impl_glPushDebugGroup;
 PFNGLPUSHMATRIXPROC glad_glPushMatrix = NULL;
+void APIENTRY glad_debug_impl_glPushMatrix(void) {
+    _pre_call_callback("glPushMatrix", (void*)glPushMatrix, 0);
+    glad_glPushMatrix();
+    _post_call_callback("glPushMatrix", (void*)glPushMatrix, 0);
+}
+PFNGLPUSHMATRIXPROC glad_debug_glPushMatrix = glad_debug_impl_glPushMatrix;
 PFNGLPUSHNAMEPROC glad_glPushName = NULL;
+void APIENTRY glad_debug_impl_glPushName(GLuint arg0) {
+    _pre_call_callback("glPushName", (void*)glPushName, 1, arg0);
+    glad_glPushName(arg0);
+    _post_call_callback("glPushName", (void*)glPushName, 1, arg0);
+}
+PFNGLPUSHNAMEPROC glad_debug_glPushName = glad_debug_impl_glPushName;
 PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
+void APIENTRY glad_debug_impl_glQueryCounter(GLuint arg0, GLenum arg1) {
+    _pre_call_callback("glQueryCounter", (void*)glQueryCounter, 2, arg0, arg1);
+    glad_glQueryCounter(arg0, arg1);
+    _post_call_callback("glQueryCounter", (void*)glQueryCounter, 2, arg0, arg1);
+}
+PFNGLQUERYCOUNTERPROC glad_debug_glQueryCounter = glad_debug_impl_glQueryCounter;
 PFNGLRASTERPOS2DPROC glad_glRasterPos2d = NULL;
+void APIENTRY glad_debug_impl_glRasterPos2d(GLdouble arg0, GLdouble arg1) {
+    _pre_call_callback("glRasterPos2d", (void*)glRasterPos2d, 2, arg0, arg1);
+    glad_glRasterPos2d(arg0, arg1);
+    _post_call_callback("glRasterPos2d", (void*)glRasterPos2d, 2, arg0, arg1);
+}
+PFNGLRASTERPOS2DPROC glad_debug_glRasterPos2d = glad_debug_impl_glRasterPos2d;
 PFNGLRASTERPOS2DVPROC glad_glRasterPos2dv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos2dv(const GLdouble * arg0) {
+    _pre_call_callback("glRasterPos2dv", (void*)glRasterPos2dv, 1, arg0);
+    glad_glRasterPos2dv(arg0);
+    _post_call_callback("glRasterPos2dv", (void*)glRasterPos2dv, 1, arg0);
+}
+PFNGLRASTERPOS2DVPROC glad_debug_glRasterPos2dv = glad_debug_impl_glRasterPos2dv;
 PFNGLRASTERPOS2FPROC glad_glRasterPos2f = NULL;
+void APIENTRY glad_debug_impl_glRasterPos2f(GLfloat arg0, GLfloat arg1) {
+    _pre_call_callback("glRasterPos2f", (void*)glRasterPos2f, 2, arg0, arg1);
+    glad_glRasterPos2f(arg0, arg1);
+    _post_call_callback("glRasterPos2f", (void*)glRasterPos2f, 2, arg0, arg1);
+}
+PFNGLRASTERPOS2FPROC glad_debug_glRasterPos2f = glad_debug_impl_glRasterPos2f;
 PFNGLRASTERPOS2FVPROC glad_glRasterPos2fv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos2fv(const GLfloat * arg0) {
+    _pre_call_callback("glRasterPos2fv", (void*)glRasterPos2fv, 1, arg0);
+    glad_glRasterPos2fv(arg0);
+    _post_call_callback("glRasterPos2fv", (void*)glRasterPos2fv, 1, arg0);
+}
+PFNGLRASTERPOS2FVPROC glad_debug_glRasterPos2fv = glad_debug_impl_glRasterPos2fv;
 PFNGLRASTERPOS2IPROC glad_glRasterPos2i = NULL;
+void APIENTRY glad_debug_impl_glRasterPos2i(GLint arg0, GLint arg1) {
+    _pre_call_callback("glRasterPos2i", (void*)glRasterPos2i, 2, arg0, arg1);
+    glad_glRasterPos2i(arg0, arg1);
+    _post_call_callback("glRasterPos2i", (void*)glRasterPos2i, 2, arg0, arg1);
+}
+PFNGLRASTERPOS2IPROC glad_debug_glRasterPos2i = glad_debug_impl_glRasterPos2i;
 PFNGLRASTERPOS2IVPROC glad_glRasterPos2iv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos2iv(const GLint * arg0) {
+    _pre_call_callback("glRasterPos2iv", (void*)glRasterPos2iv, 1, arg0);
+    glad_glRasterPos2iv(arg0);
+    _post_call_callback("glRasterPos2iv", (void*)glRasterPos2iv, 1, arg0);
+}
+PFNGLRASTERPOS2IVPROC glad_debug_glRasterPos2iv = glad_debug_impl_glRasterPos2iv;
 PFNGLRASTERPOS2SPROC glad_glRasterPos2s = NULL;
+void APIENTRY glad_debug_impl_glRasterPos2s(GLshort arg0, GLshort arg1) {
+    _pre_call_callback("glRasterPos2s", (void*)glRasterPos2s, 2, arg0, arg1);
+    glad_glRasterPos2s(arg0, arg1);
+    _post_call_callback("glRasterPos2s", (void*)glRasterPos2s, 2, arg0, arg1);
+}
+PFNGLRASTERPOS2SPROC glad_debug_glRasterPos2s = glad_debug_impl_glRasterPos2s;
 PFNGLRASTERPOS2SVPROC glad_glRasterPos2sv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos2sv(const GLshort * arg0) {
+    _pre_call_callback("glRasterPos2sv", (void*)glRasterPos2sv, 1, arg0);
+    glad_glRasterPos2sv(arg0);
+    _post_call_callback("glRasterPos2sv", (void*)glRasterPos2sv, 1, arg0);
+}
+PFNGLRASTERPOS2SVPROC glad_debug_glRasterPos2sv = glad_debug_impl_glRasterPos2sv;
 PFNGLRASTERPOS3DPROC glad_glRasterPos3d = NULL;
+void APIENTRY glad_debug_impl_glRasterPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glRasterPos3d", (void*)glRasterPos3d, 3, arg0, arg1, arg2);
+    glad_glRasterPos3d(arg0, arg1, arg2);
+    _post_call_callback("glRasterPos3d", (void*)glRasterPos3d, 3, arg0, arg1, arg2);
+}
+PFNGLRASTERPOS3DPROC glad_debug_glRasterPos3d = glad_debug_impl_glRasterPos3d;
 PFNGLRASTERPOS3DVPROC glad_glRasterPos3dv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos3dv(const GLdouble * arg0) {
+    _pre_call_callback("glRasterPos3dv", (void*)glRasterPos3dv, 1, arg0);
+    glad_glRasterPos3dv(arg0);
+    _post_call_callback("glRasterPos3dv", (void*)glRasterPos3dv, 1, arg0);
+}
+PFNGLRASTERPOS3DVPROC glad_debug_glRasterPos3dv = glad_debug_impl_glRasterPos3dv;
 PFNGLRASTERPOS3FPROC glad_glRasterPos3f = NULL;
+void APIENTRY glad_debug_impl_glRasterPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glRasterPos3f", (void*)glRasterPos3f, 3, arg0, arg1, arg2);
+    glad_glRasterPos3f(arg0, arg1, arg2);
+    _post_call_callback("glRasterPos3f", (void*)glRasterPos3f, 3, arg0, arg1, arg2);
+}
+PFNGLRASTERPOS3FPROC glad_debug_glRasterPos3f = glad_debug_impl_glRasterPos3f;
 PFNGLRASTERPOS3FVPROC glad_glRasterPos3fv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos3fv(const GLfloat * arg0) {
+    _pre_call_callback("glRasterPos3fv", (void*)glRasterPos3fv, 1, arg0);
+    glad_glRasterPos3fv(arg0);
+    _post_call_callback("glRasterPos3fv", (void*)glRasterPos3fv, 1, arg0);
+}
+PFNGLRASTERPOS3FVPROC glad_debug_glRasterPos3fv = glad_debug_impl_glRasterPos3fv;
 PFNGLRASTERPOS3IPROC glad_glRasterPos3i = NULL;
+void APIENTRY glad_debug_impl_glRasterPos3i(GLint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glRasterPos3i", (void*)glRasterPos3i, 3, arg0, arg1, arg2);
+    glad_glRasterPos3i(arg0, arg1, arg2);
+    _post_call_callback("glRasterPos3i", (void*)glRasterPos3i, 3, arg0, arg1, arg2);
+}
+PFNGLRASTERPOS3IPROC glad_debug_glRasterPos3i = glad_debug_impl_glRasterPos3i;
 PFNGLRASTERPOS3IVPROC glad_glRasterPos3iv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos3iv(const GLint * arg0) {
+    _pre_call_callback("glRasterPos3iv", (void*)glRasterPos3iv, 1, arg0);
+    glad_glRasterPos3iv(arg0);
+    _post_call_callback("glRasterPos3iv", (void*)glRasterPos3iv, 1, arg0);
+}
+PFNGLRASTERPOS3IVPROC glad_debug_glRasterPos3iv = glad_debug_impl_glRasterPos3iv;
 PFNGLRASTERPOS3SPROC glad_glRasterPos3s = NULL;
+void APIENTRY glad_debug_impl_glRasterPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glRasterPos3s", (void*)glRasterPos3s, 3, arg0, arg1, arg2);
+    glad_glRasterPos3s(arg0, arg1, arg2);
+    _post_call_callback("glRasterPos3s", (void*)glRasterPos3s, 3, arg0, arg1, arg2);
+}
+PFNGLRASTERPOS3SPROC glad_debug_glRasterPos3s = glad_debug_impl_glRasterPos3s;
 PFNGLRASTERPOS3SVPROC glad_glRasterPos3sv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos3sv(const GLshort * arg0) {
+    _pre_call_callback("glRasterPos3sv", (void*)glRasterPos3sv, 1, arg0);
+    glad_glRasterPos3sv(arg0);
+    _post_call_callback("glRasterPos3sv", (void*)glRasterPos3sv, 1, arg0);
+}
+PFNGLRASTERPOS3SVPROC glad_debug_glRasterPos3sv = glad_debug_impl_glRasterPos3sv;
 PFNGLRASTERPOS4DPROC glad_glRasterPos4d = NULL;
+void APIENTRY glad_debug_impl_glRasterPos4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+    _pre_call_callback("glRasterPos4d", (void*)glRasterPos4d, 4, arg0, arg1, arg2, arg3);
+    glad_glRasterPos4d(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRasterPos4d", (void*)glRasterPos4d, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRASTERPOS4DPROC glad_debug_glRasterPos4d = glad_debug_impl_glRasterPos4d;
 PFNGLRASTERPOS4DVPROC glad_glRasterPos4dv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos4dv(const GLdouble * arg0) {
+    _pre_call_callback("glRasterPos4dv", (void*)glRasterPos4dv, 1, arg0);
+    glad_glRasterPos4dv(arg0);
+    _post_call_callback("glRasterPos4dv", (void*)glRasterPos4dv, 1, arg0);
+}
+PFNGLRASTERPOS4DVPROC glad_debug_glRasterPos4dv = glad_debug_impl_glRasterPos4dv;
 PFNGLRASTERPOS4FPROC glad_glRasterPos4f = NULL;
+void APIENTRY glad_debug_impl_glRasterPos4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glRasterPos4f", (void*)glRasterPos4f, 4, arg0, arg1, arg2, arg3);
+    glad_glRasterPos4f(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRasterPos4f", (void*)glRasterPos4f, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRASTERPOS4FPROC glad_debug_glRasterPos4f = glad_debug_impl_glRasterPos4f;
 PFNGLRASTERPOS4FVPROC glad_glRasterPos4fv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos4fv(const GLfloat * arg0) {
+    _pre_call_callback("glRasterPos4fv", (void*)glRasterPos4fv, 1, arg0);
+    glad_glRasterPos4fv(arg0);
+    _post_call_callback("glRasterPos4fv", (void*)glRasterPos4fv, 1, arg0);
+}
+PFNGLRASTERPOS4FVPROC glad_debug_glRasterPos4fv = glad_debug_impl_glRasterPos4fv;
 PFNGLRASTERPOS4IPROC glad_glRasterPos4i = NULL;
+void APIENTRY glad_debug_impl_glRasterPos4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glRasterPos4i", (void*)glRasterPos4i, 4, arg0, arg1, arg2, arg3);
+    glad_glRasterPos4i(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRasterPos4i", (void*)glRasterPos4i, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRASTERPOS4IPROC glad_debug_glRasterPos4i = glad_debug_impl_glRasterPos4i;
 PFNGLRASTERPOS4IVPROC glad_glRasterPos4iv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos4iv(const GLint * arg0) {
+    _pre_call_callback("glRasterPos4iv", (void*)glRasterPos4iv, 1, arg0);
+    glad_glRasterPos4iv(arg0);
+    _post_call_callback("glRasterPos4iv", (void*)glRasterPos4iv, 1, arg0);
+}
+PFNGLRASTERPOS4IVPROC glad_debug_glRasterPos4iv = glad_debug_impl_glRasterPos4iv;
 PFNGLRASTERPOS4SPROC glad_glRasterPos4s = NULL;
+void APIENTRY glad_debug_impl_glRasterPos4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+    _pre_call_callback("glRasterPos4s", (void*)glRasterPos4s, 4, arg0, arg1, arg2, arg3);
+    glad_glRasterPos4s(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRasterPos4s", (void*)glRasterPos4s, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRASTERPOS4SPROC glad_debug_glRasterPos4s = glad_debug_impl_glRasterPos4s;
 PFNGLRASTERPOS4SVPROC glad_glRasterPos4sv = NULL;
+void APIENTRY glad_debug_impl_glRasterPos4sv(const GLshort * arg0) {
+    _pre_call_callback("glRasterPos4sv", (void*)glRasterPos4sv, 1, arg0);
+    glad_glRasterPos4sv(arg0);
+    _post_call_callback("glRasterPos4sv", (void*)glRasterPos4sv, 1, arg0);
+}
+PFNGLRASTERPOS4SVPROC glad_debug_glRasterPos4sv = glad_debug_impl_glRasterPos4sv;
 PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
+void APIENTRY glad_debug_impl_glReadBuffer(GLenum arg0) {
+    _pre_call_callback("glReadBuffer", (void*)glReadBuffer, 1, arg0);
+    glad_glReadBuffer(arg0);
+    _post_call_callback("glReadBuffer", (void*)glReadBuffer, 1, arg0);
+}
+PFNGLREADBUFFERPROC glad_debug_glReadBuffer = glad_debug_impl_glReadBuffer;
 PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
+void APIENTRY glad_debug_impl_glReadPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, void * arg6) {
+    _pre_call_callback("glReadPixels", (void*)glReadPixels, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glReadPixels(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glReadPixels", (void*)glReadPixels, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLREADPIXELSPROC glad_debug_glReadPixels = glad_debug_impl_glReadPixels;
 PFNGLRECTDPROC glad_glRectd = NULL;
+void APIENTRY glad_debug_impl_glRectd(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+    _pre_call_callback("glRectd", (void*)glRectd, 4, arg0, arg1, arg2, arg3);
+    glad_glRectd(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRectd", (void*)glRectd, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRECTDPROC glad_debug_glRectd = glad_debug_impl_glRectd;
 PFNGLRECTDVPROC glad_glRectdv = NULL;
+void APIENTRY glad_debug_impl_glRectdv(const GLdouble * arg0, const GLdouble * arg1) {
+    _pre_call_callback("glRectdv", (void*)glRectdv, 2, arg0, arg1);
+    glad_glRectdv(arg0, arg1);
+    _post_call_callback("glRectdv", (void*)glRectdv, 2, arg0, arg1);
+}
+PFNGLRECTDVPROC glad_debug_glRectdv = glad_debug_impl_glRectdv;
 PFNGLRECTFPROC glad_glRectf = NULL;
+void APIENTRY glad_debug_impl_glRectf(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glRectf", (void*)glRectf, 4, arg0, arg1, arg2, arg3);
+    glad_glRectf(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRectf", (void*)glRectf, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRECTFPROC glad_debug_glRectf = glad_debug_impl_glRectf;
 PFNGLRECTFVPROC glad_glRectfv = NULL;
+void APIENTRY glad_debug_impl_glRectfv(const GLfloat * arg0, const GLfloat * arg1) {
+    _pre_call_callback("glRectfv", (void*)glRectfv, 2, arg0, arg1);
+    glad_glRectfv(arg0, arg1);
+    _post_call_callback("glRectfv", (void*)glRectfv, 2, arg0, arg1);
+}
+PFNGLRECTFVPROC glad_debug_glRectfv = glad_debug_impl_glRectfv;
 PFNGLRECTIPROC glad_glRecti = NULL;
+void APIENTRY glad_debug_impl_glRecti(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glRecti", (void*)glRecti, 4, arg0, arg1, arg2, arg3);
+    glad_glRecti(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRecti", (void*)glRecti, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRECTIPROC glad_debug_glRecti = glad_debug_impl_glRecti;
 PFNGLRECTIVPROC glad_glRectiv = NULL;
+void APIENTRY glad_debug_impl_glRectiv(const GLint * arg0, const GLint * arg1) {
+    _pre_call_callback("glRectiv", (void*)glRectiv, 2, arg0, arg1);
+    glad_glRectiv(arg0, arg1);
+    _post_call_callback("glRectiv", (void*)glRectiv, 2, arg0, arg1);
+}
+PFNGLRECTIVPROC glad_debug_glRectiv = glad_debug_impl_glRectiv;
 PFNGLRECTSPROC glad_glRects = NULL;
+void APIENTRY glad_debug_impl_glRects(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+    _pre_call_callback("glRects", (void*)glRects, 4, arg0, arg1, arg2, arg3);
+    glad_glRects(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRects", (void*)glRects, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRECTSPROC glad_debug_glRects = glad_debug_impl_glRects;
 PFNGLRECTSVPROC glad_glRectsv = NULL;
+void APIENTRY glad_debug_impl_glRectsv(const GLshort * arg0, const GLshort * arg1) {
+    _pre_call_callback("glRectsv", (void*)glRectsv, 2, arg0, arg1);
+    glad_glRectsv(arg0, arg1);
+    _post_call_callback("glRectsv", (void*)glRectsv, 2, arg0, arg1);
+}
+PFNGLRECTSVPROC glad_debug_glRectsv = glad_debug_impl_glRectsv;
 PFNGLRENDERMODEPROC glad_glRenderMode = NULL;
+GLint APIENTRY glad_debug_impl_glRenderMode(GLenum arg0) {
+    GLint ret;
+    _pre_call_callback("glRenderMode", (void*)glRenderMode, 1, arg0);
+    ret = glad_glRenderMode(arg0);
+    _post_call_callback("glRenderMode", (void*)glRenderMode, 1, arg0);
+    return ret;
+}
+PFNGLRENDERMODEPROC glad_debug_glRenderMode = glad_debug_impl_glRenderMode;
 PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
+void APIENTRY glad_debug_impl_glRenderbufferStorage(GLenum arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+    _pre_call_callback("glRenderbufferStorage", (void*)glRenderbufferStorage, 4, arg0, arg1, arg2, arg3);
+    glad_glRenderbufferStorage(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRenderbufferStorage", (void*)glRenderbufferStorage, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLRENDERBUFFERSTORAGEPROC glad_debug_glRenderbufferStorage = glad_debug_impl_glRenderbufferStorage;
 PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
+void APIENTRY glad_debug_impl_glRenderbufferStorageMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+    _pre_call_callback("glRenderbufferStorageMultisample", (void*)glRenderbufferStorageMultisample, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glRenderbufferStorageMultisample(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glRenderbufferStorageMultisample", (void*)glRenderbufferStorageMultisample, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glRenderbufferStorageMultisample = glad_debug_impl_glRenderbufferStorageMultisample;
 PFNGLROTATEDPROC glad_glRotated = NULL;
+void APIENTRY glad_debug_impl_glRotated(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+    _pre_call_callback("glRotated", (void*)glRotated, 4, arg0, arg1, arg2, arg3);
+    glad_glRotated(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRotated", (void*)glRotated, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLROTATEDPROC glad_debug_glRotated = glad_debug_impl_glRotated;
 PFNGLROTATEFPROC glad_glRotatef = NULL;
+void APIENTRY glad_debug_impl_glRotatef(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glRotatef", (void*)glRotatef, 4, arg0, arg1, arg2, arg3);
+    glad_glRotatef(arg0, arg1, arg2, arg3);
+    _post_call_callback("glRotatef", (void*)glRotatef, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLROTATEFPROC glad_debug_glRotatef = glad_debug_impl_glRotatef;
 PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
+void APIENTRY glad_debug_impl_glSampleCoverage(GLfloat arg0, GLboolean arg1) {
+    _pre_call_callback("glSampleCoverage", (void*)glSampleCoverage, 2, arg0, arg1);
+    glad_glSampleCoverage(arg0, arg1);
+    _post_call_callback("glSampleCoverage", (void*)glSampleCoverage, 2, arg0, arg1);
+}
+PFNGLSAMPLECOVERAGEPROC glad_debug_glSampleCoverage = glad_debug_impl_glSampleCoverage;
 PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
+void APIENTRY glad_debug_impl_glSampleMaski(GLuint arg0, GLbitfield arg1) {
+    _pre_call_callback("glSampleMaski", (void*)glSampleMaski, 2, arg0, arg1);
+    glad_glSampleMaski(arg0, arg1);
+    _post_call_callback("glSampleMaski", (void*)glSampleMaski, 2, arg0, arg1);
+}
+PFNGLSAMPLEMASKIPROC glad_debug_glSampleMaski = glad_debug_impl_glSampleMaski;
 PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
+void APIENTRY glad_debug_impl_glSamplerParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glSamplerParameterIiv", (void*)glSamplerParameterIiv, 3, arg0, arg1, arg2);
+    glad_glSamplerParameterIiv(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameterIiv", (void*)glSamplerParameterIiv, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERIIVPROC glad_debug_glSamplerParameterIiv = glad_debug_impl_glSamplerParameterIiv;
 PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = NULL;
+void APIENTRY glad_debug_impl_glSamplerParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glSamplerParameterIuiv", (void*)glSamplerParameterIuiv, 3, arg0, arg1, arg2);
+    glad_glSamplerParameterIuiv(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameterIuiv", (void*)glSamplerParameterIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERIUIVPROC glad_debug_glSamplerParameterIuiv = glad_debug_impl_glSamplerParameterIuiv;
 PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = NULL;
+void APIENTRY glad_debug_impl_glSamplerParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+    _pre_call_callback("glSamplerParameterf", (void*)glSamplerParameterf, 3, arg0, arg1, arg2);
+    glad_glSamplerParameterf(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameterf", (void*)glSamplerParameterf, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERFPROC glad_debug_glSamplerParameterf = glad_debug_impl_glSamplerParameterf;
 PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
+void APIENTRY glad_debug_impl_glSamplerParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+    _pre_call_callback("glSamplerParameterfv", (void*)glSamplerParameterfv, 3, arg0, arg1, arg2);
+    glad_glSamplerParameterfv(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameterfv", (void*)glSamplerParameterfv, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERFVPROC glad_debug_glSamplerParameterfv = glad_debug_impl_glSamplerParameterfv;
 PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
+void APIENTRY glad_debug_impl_glSamplerParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+    _pre_call_callback("glSamplerParameteri", (void*)glSamplerParameteri, 3, arg0, arg1, arg2);
+    glad_glSamplerParameteri(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameteri", (void*)glSamplerParameteri, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERIPROC glad_debug_glSamplerParameteri = glad_debug_impl_glSamplerParameteri;
 PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
+void APIENTRY glad_debug_impl_glSamplerParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glSamplerParameteriv", (void*)glSamplerParameteriv, 3, arg0, arg1, arg2);
+    glad_glSamplerParameteriv(arg0, arg1, arg2);
+    _post_call_callback("glSamplerParameteriv", (void*)glSamplerParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLSAMPLERPARAMETERIVPROC glad_debug_glSamplerParameteriv = glad_debug_impl_glSamplerParameteriv;
 PFNGLSCALEDPROC glad_glScaled = NULL;
+void APIENTRY glad_debug_impl_glScaled(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glScaled", (void*)glScaled, 3, arg0, arg1, arg2);
+    glad_glScaled(arg0, arg1, arg2);
+    _post_call_callback("glScaled", (void*)glScaled, 3, arg0, arg1, arg2);
+}
+PFNGLSCALEDPROC glad_debug_glScaled = glad_debug_impl_glScaled;
 PFNGLSCALEFPROC glad_glScalef = NULL;
+void APIENTRY glad_debug_impl_glScalef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glScalef", (void*)glScalef, 3, arg0, arg1, arg2);
+    glad_glScalef(arg0, arg1, arg2);
+    _post_call_callback("glScalef", (void*)glScalef, 3, arg0, arg1, arg2);
+}
+PFNGLSCALEFPROC glad_debug_glScalef = glad_debug_impl_glScalef;
 PFNGLSCISSORPROC glad_glScissor = NULL;
+void APIENTRY glad_debug_impl_glScissor(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+    _pre_call_callback("glScissor", (void*)glScissor, 4, arg0, arg1, arg2, arg3);
+    glad_glScissor(arg0, arg1, arg2, arg3);
+    _post_call_callback("glScissor", (void*)glScissor, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLSCISSORPROC glad_debug_glScissor = glad_debug_impl_glScissor;
 PFNGLSECONDARYCOLOR3BPROC glad_glSecondaryColor3b = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+    _pre_call_callback("glSecondaryColor3b", (void*)glSecondaryColor3b, 3, arg0, arg1, arg2);
+    glad_glSecondaryColor3b(arg0, arg1, arg2);
+    _post_call_callback("glSecondaryColor3b", (void*)glSecondaryColor3b, 3, arg0, arg1, arg2);
+}
+PFNGLSECONDARYCOLOR3BPROC glad_debug_glSecondaryColor3b = glad_debug_impl_glSecondaryColor3b;
 PFNGLSECONDARYCOLOR3BVPROC glad_glSecondaryColor3bv = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3bv(const GLbyte * arg0) {
+    _pre_call_callback("glSecondaryColor3bv", (void*)glSecondaryColor3bv, 1, arg0);
+    glad_glSecondaryColor3bv(arg0);
+    _post_call_callback("glSecondaryColor3bv", (void*)glSecondaryColor3bv, 1, arg0);
+}
+PFNGLSECONDARYCOLOR3BVPROC glad_debug_glSecondaryColor3bv = glad_debug_impl_glSecondaryColor3bv;
 PFNGLSECONDARYCOLOR3DPROC glad_glSecondaryColor3d = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glSecondaryColor3d", (void*)glSecondaryColor3d, 3, arg0, arg1, arg2);
+    glad_glSecondaryColor3d(arg0, arg1, arg2);
+    _post_call_callback("glSecondaryColor3d", (void*)glSecondaryColor3d, 3, arg0, arg1, arg2);
+}
+PFNGLSECONDARYCOLOR3DPROC glad_debug_glSecondaryColor3d = glad_debug_impl_glSecondaryColor3d;
 PFNGLSECONDARYCOLOR3DVPROC glad_glSecondaryColor3dv = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3dv(const GLdouble * arg0) {
+    _pre_call_callback("glSecondaryColor3dv", (void*)glSecondaryColor3dv, 1, arg0);
+    glad_glSecondaryColor3dv(arg0);
+    _post_call_callback("glSecondaryColor3dv", (void*)glSecondaryColor3dv, 1, arg0);
+}
+PFNGLSECONDARYCOLOR3DVPROC glad_debug_glSecondaryColor3dv = glad_debug_impl_glSecondaryColor3dv;
 PFNGLSECONDARYCOLOR3FPROC glad_glSecondaryColor3f = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glSecondaryColor3f", (void*)glSecondaryColor3f, 3, arg0, arg1, arg2);
+    glad_glSecondaryColor3f(arg0, arg1, arg2);
+    _post_call_callback("glSecondaryColor3f", (void*)glSecondaryColor3f, 3, arg0, arg1, arg2);
+}
+PFNGLSECONDARYCOLOR3FPROC glad_debug_glSecondaryColor3f = glad_debug_impl_glSecondaryColor3f;
 PFNGLSECONDARYCOLOR3FVPROC glad_glSecondaryColor3fv = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3fv(const GLfloat * arg0) {
+    _pre_call_callback("glSecondaryColor3fv", (void*)glSecondaryColor3fv, 1, arg0);
+    glad_glSecondaryColor3fv(arg0);
+    _post_call_callback("glSecondaryColor3fv", (void*)glSecondaryColor3fv, 1, arg0);
+}
+PFNGLSECONDARYCOLOR3FVPROC glad_debug_glSecondaryColor3fv = glad_debug_impl_glSecondaryColor3fv;
 PFNGLSECONDARYCOLOR3IPROC glad_glSecondaryColor3i = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3i(GLint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glSecondaryColor3i", (void*)glSecondaryColor3i, 3, arg0, arg1, arg2);
+    glad_glSecondaryColor3i(arg0, arg1, arg2);
+    _post_call_callback("glSecondaryColor3i", (void*)glSecondaryColor3i, 3, arg0, arg1, arg2);
+}
+PFNGLSECONDARYCOLOR3IPROC glad_debug_glSecondaryColor3i = glad_debug_impl_glSecondaryColor3i;
 PFNGLSECONDARYCOLOR3IVPROC glad_glSecondaryColor3iv = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3iv(const GLint * arg0) {
+    _pre_call_callback("glSecondaryColor3iv", (void*)glSecondaryColor3iv, 1, arg0);
+    glad_glSecondaryColor3iv(arg0);
+    _post_call_callback("glSecondaryColor3iv", (void*)glSecondaryColor3iv, 1, arg0);
+}
+PFNGLSECONDARYCOLOR3IVPROC glad_debug_glSecondaryColor3iv = glad_debug_impl_glSecondaryColor3iv;
 PFNGLSECONDARYCOLOR3SPROC glad_glSecondaryColor3s = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glSecondaryColor3s", (void*)glSecondaryColor3s, 3, arg0, arg1, arg2);
+    glad_glSecondaryColor3s(arg0, arg1, arg2);
+    _post_call_callback("glSecondaryColor3s", (void*)glSecondaryColor3s, 3, arg0, arg1, arg2);
+}
+PFNGLSECONDARYCOLOR3SPROC glad_debug_glSecondaryColor3s = glad_debug_impl_glSecondaryColor3s;
 PFNGLSECONDARYCOLOR3SVPROC glad_glSecondaryColor3sv = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3sv(const GLshort * arg0) {
+    _pre_call_callback("glSecondaryColor3sv", (void*)glSecondaryColor3sv, 1, arg0);
+    glad_glSecondaryColor3sv(arg0);
+    _post_call_callback("glSecondaryColor3sv", (void*)glSecondaryColor3sv, 1, arg0);
+}
+PFNGLSECONDARYCOLOR3SVPROC glad_debug_glSecondaryColor3sv = glad_debug_impl_glSecondaryColor3sv;
 PFNGLSECONDARYCOLOR3UBPROC glad_glSecondaryColor3ub = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+    _pre_call_callback("glSecondaryColor3ub", (void*)glSecondaryColor3ub, 3, arg0, arg1, arg2);
+    glad_glSecondaryColor3ub(arg0, arg1, arg2);
+    _post_call_callback("glSecondaryColor3ub", (void*)glSecondaryColor3ub, 3, arg0, arg1, arg2);
+}
+PFNGLSECONDARYCOLOR3UBPROC glad_debug_glSecondaryColor3ub = glad_debug_impl_glSecondaryColor3ub;
 PFNGLSECONDARYCOLOR3UBVPROC glad_glSecondaryColor3ubv = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3ubv(const GLubyte * arg0) {
+    _pre_call_callback("glSecondaryColor3ubv", (void*)glSecondaryColor3ubv, 1, arg0);
+    glad_glSecondaryColor3ubv(arg0);
+    _post_call_callback("glSecondaryColor3ubv", (void*)glSecondaryColor3ubv, 1, arg0);
+}
+PFNGLSECONDARYCOLOR3UBVPROC glad_debug_glSecondaryColor3ubv = glad_debug_impl_glSecondaryColor3ubv;
 PFNGLSECONDARYCOLOR3UIPROC glad_glSecondaryColor3ui = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glSecondaryColor3ui", (void*)glSecondaryColor3ui, 3, arg0, arg1, arg2);
+    glad_glSecondaryColor3ui(arg0, arg1, arg2);
+    _post_call_callback("glSecondaryColor3ui", (void*)glSecondaryColor3ui, 3, arg0, arg1, arg2);
+}
+PFNGLSECONDARYCOLOR3UIPROC glad_debug_glSecondaryColor3ui = glad_debug_impl_glSecondaryColor3ui;
 PFNGLSECONDARYCOLOR3UIVPROC glad_glSecondaryColor3uiv = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3uiv(const GLuint * arg0) {
+    _pre_call_callback("glSecondaryColor3uiv", (void*)glSecondaryColor3uiv, 1, arg0);
+    glad_glSecondaryColor3uiv(arg0);
+    _post_call_callback("glSecondaryColor3uiv", (void*)glSecondaryColor3uiv, 1, arg0);
+}
+PFNGLSECONDARYCOLOR3UIVPROC glad_debug_glSecondaryColor3uiv = glad_debug_impl_glSecondaryColor3uiv;
 PFNGLSECONDARYCOLOR3USPROC glad_glSecondaryColor3us = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+    _pre_call_callback("glSecondaryColor3us", (void*)glSecondaryColor3us, 3, arg0, arg1, arg2);
+    glad_glSecondaryColor3us(arg0, arg1, arg2);
+    _post_call_callback("glSecondaryColor3us", (void*)glSecondaryColor3us, 3, arg0, arg1, arg2);
+}
+PFNGLSECONDARYCOLOR3USPROC glad_debug_glSecondaryColor3us = glad_debug_impl_glSecondaryColor3us;
 PFNGLSECONDARYCOLOR3USVPROC glad_glSecondaryColor3usv = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColor3usv(const GLushort * arg0) {
+    _pre_call_callback("glSecondaryColor3usv", (void*)glSecondaryColor3usv, 1, arg0);
+    glad_glSecondaryColor3usv(arg0);
+    _post_call_callback("glSecondaryColor3usv", (void*)glSecondaryColor3usv, 1, arg0);
+}
+PFNGLSECONDARYCOLOR3USVPROC glad_debug_glSecondaryColor3usv = glad_debug_impl_glSecondaryColor3usv;
 PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColorP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glSecondaryColorP3ui", (void*)glSecondaryColorP3ui, 2, arg0, arg1);
+    glad_glSecondaryColorP3ui(arg0, arg1);
+    _post_call_callback("glSecondaryColorP3ui", (void*)glSecondaryColorP3ui, 2, arg0, arg1);
+}
+PFNGLSECONDARYCOLORP3UIPROC glad_debug_glSecondaryColorP3ui = glad_debug_impl_glSecondaryColorP3ui;
 PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColorP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glSecondaryColorP3uiv", (void*)glSecondaryColorP3uiv, 2, arg0, arg1);
+    glad_glSecondaryColorP3uiv(arg0, arg1);
+    _post_call_callback("glSecondaryColorP3uiv", (void*)glSecondaryColorP3uiv, 2, arg0, arg1);
+}
+PFNGLSECONDARYCOLORP3UIVPROC glad_debug_glSecondaryColorP3uiv = glad_debug_impl_glSecondaryColorP3uiv;
 PFNGLSECONDARYCOLORPOINTERPROC glad_glSecondaryColorPointer = NULL;
+void APIENTRY glad_debug_impl_glSecondaryColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+    _pre_call_callback("glSecondaryColorPointer", (void*)glSecondaryColorPointer, 4, arg0, arg1, arg2, arg3);
+    glad_glSecondaryColorPointer(arg0, arg1, arg2, arg3);
+    _post_call_callback("glSecondaryColorPointer", (void*)glSecondaryColorPointer, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLSECONDARYCOLORPOINTERPROC glad_debug_glSecondaryColorPointer = glad_debug_impl_glSecondaryColorPointer;
 PFNGLSELECTBUFFERPROC glad_glSelectBuffer = NULL;
+void APIENTRY glad_debug_impl_glSelectBuffer(GLsizei arg0, GLuint * arg1) {
+    _pre_call_callback("glSelectBuffer", (void*)glSelectBuffer, 2, arg0, arg1);
+    glad_glSelectBuffer(arg0, arg1);
+    _post_call_callback("glSelectBuffer", (void*)glSelectBuffer, 2, arg0, arg1);
+}
+PFNGLSELECTBUFFERPROC glad_debug_glSelectBuffer = glad_debug_impl_glSelectBuffer;
 PFNGLSHADEMODELPROC glad_glShadeModel = NULL;
+void APIENTRY glad_debug_impl_glShadeModel(GLenum arg0) {
+    _pre_call_callback("glShadeModel", (void*)glShadeModel, 1, arg0);
+    glad_glShadeModel(arg0);
+    _post_call_callback("glShadeModel", (void*)glShadeModel, 1, arg0);
+}
+PFNGLSHADEMODELPROC glad_debug_glShadeModel = glad_debug_impl_glShadeModel;
 PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
+void APIENTRY glad_debug_impl_glShaderSource(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, const GLint * arg3) {
+    _pre_call_callback("glShaderSource", (void*)glShaderSource, 4, arg0, arg1, arg2, arg3);
+    glad_glShaderSource(arg0, arg1, arg2, arg3);
+    _post_call_callback("glShaderSource", (void*)glShaderSource, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLSHADERSOURCEPROC glad_debug_glShaderSource = glad_debug_impl_glShaderSource;
 PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
+void APIENTRY glad_debug_impl_glStencilFunc(GLenum arg0, GLint arg1, GLuint arg2) {
+    _pre_call_callback("glStencilFunc", (void*)glStencilFunc, 3, arg0, arg1, arg2);
+    glad_glStencilFunc(arg0, arg1, arg2);
+    _post_call_callback("glStencilFunc", (void*)glStencilFunc, 3, arg0, arg1, arg2);
+}
+PFNGLSTENCILFUNCPROC glad_debug_glStencilFunc = glad_debug_impl_glStencilFunc;
 PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
+void APIENTRY glad_debug_impl_glStencilFuncSeparate(GLenum arg0, GLenum arg1, GLint arg2, GLuint arg3) {
+    _pre_call_callback("glStencilFuncSeparate", (void*)glStencilFuncSeparate, 4, arg0, arg1, arg2, arg3);
+    glad_glStencilFuncSeparate(arg0, arg1, arg2, arg3);
+    _post_call_callback("glStencilFuncSeparate", (void*)glStencilFuncSeparate, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLSTENCILFUNCSEPARATEPROC glad_debug_glStencilFuncSeparate = glad_debug_impl_glStencilFuncSeparate;
 PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
+void APIENTRY glad_debug_impl_glStencilMask(GLuint arg0) {
+    _pre_call_callback("glStencilMask", (void*)glStencilMask, 1, arg0);
+    glad_glStencilMask(arg0);
+    _post_call_callback("glStencilMask", (void*)glStencilMask, 1, arg0);
+}
+PFNGLSTENCILMASKPROC glad_debug_glStencilMask = glad_debug_impl_glStencilMask;
 PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
+void APIENTRY glad_debug_impl_glStencilMaskSeparate(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glStencilMaskSeparate", (void*)glStencilMaskSeparate, 2, arg0, arg1);
+    glad_glStencilMaskSeparate(arg0, arg1);
+    _post_call_callback("glStencilMaskSeparate", (void*)glStencilMaskSeparate, 2, arg0, arg1);
+}
+PFNGLSTENCILMASKSEPARATEPROC glad_debug_glStencilMaskSeparate = glad_debug_impl_glStencilMaskSeparate;
 PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
+void APIENTRY glad_debug_impl_glStencilOp(GLenum arg0, GLenum arg1, GLenum arg2) {
+    _pre_call_callback("glStencilOp", (void*)glStencilOp, 3, arg0, arg1, arg2);
+    glad_glStencilOp(arg0, arg1, arg2);
+    _post_call_callback("glStencilOp", (void*)glStencilOp, 3, arg0, arg1, arg2);
+}
+PFNGLSTENCILOPPROC glad_debug_glStencilOp = glad_debug_impl_glStencilOp;
 PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
+void APIENTRY glad_debug_impl_glStencilOpSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+    _pre_call_callback("glStencilOpSeparate", (void*)glStencilOpSeparate, 4, arg0, arg1, arg2, arg3);
+    glad_glStencilOpSeparate(arg0, arg1, arg2, arg3);
+    _post_call_callback("glStencilOpSeparate", (void*)glStencilOpSeparate, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLSTENCILOPSEPARATEPROC glad_debug_glStencilOpSeparate = glad_debug_impl_glStencilOpSeparate;
 PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
+void APIENTRY glad_debug_impl_glTexBuffer(GLenum arg0, GLenum arg1, GLuint arg2) {
+    _pre_call_callback("glTexBuffer", (void*)glTexBuffer, 3, arg0, arg1, arg2);
+    glad_glTexBuffer(arg0, arg1, arg2);
+    _post_call_callback("glTexBuffer", (void*)glTexBuffer, 3, arg0, arg1, arg2);
+}
+PFNGLTEXBUFFERPROC glad_debug_glTexBuffer = glad_debug_impl_glTexBuffer;
 PFNGLTEXCOORD1DPROC glad_glTexCoord1d = NULL;
+void APIENTRY glad_debug_impl_glTexCoord1d(GLdouble arg0) {
+    _pre_call_callback("glTexCoord1d", (void*)glTexCoord1d, 1, arg0);
+    glad_glTexCoord1d(arg0);
+    _post_call_callback("glTexCoord1d", (void*)glTexCoord1d, 1, arg0);
+}
+PFNGLTEXCOORD1DPROC glad_debug_glTexCoord1d = glad_debug_impl_glTexCoord1d;
 PFNGLTEXCOORD1DVPROC glad_glTexCoord1dv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord1dv(const GLdouble * arg0) {
+    _pre_call_callback("glTexCoord1dv", (void*)glTexCoord1dv, 1, arg0);
+    glad_glTexCoord1dv(arg0);
+    _post_call_callback("glTexCoord1dv", (void*)glTexCoord1dv, 1, arg0);
+}
+PFNGLTEXCOORD1DVPROC glad_debug_glTexCoord1dv = glad_debug_impl_glTexCoord1dv;
 PFNGLTEXCOORD1FPROC glad_glTexCoord1f = NULL;
+void APIENTRY glad_debug_impl_glTexCoord1f(GLfloat arg0) {
+    _pre_call_callback("glTexCoord1f", (void*)glTexCoord1f, 1, arg0);
+    glad_glTexCoord1f(arg0);
+    _post_call_callback("glTexCoord1f", (void*)glTexCoord1f, 1, arg0);
+}
+PFNGLTEXCOORD1FPROC glad_debug_glTexCoord1f = glad_debug_impl_glTexCoord1f;
 PFNGLTEXCOORD1FVPROC glad_glTexCoord1fv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord1fv(const GLfloat * arg0) {
+    _pre_call_callback("glTexCoord1fv", (void*)glTexCoord1fv, 1, arg0);
+    glad_glTexCoord1fv(arg0);
+    _post_call_callback("glTexCoord1fv", (void*)glTexCoord1fv, 1, arg0);
+}
+PFNGLTEXCOORD1FVPROC glad_debug_glTexCoord1fv = glad_debug_impl_glTexCoord1fv;
 PFNGLTEXCOORD1IPROC glad_glTexCoord1i = NULL;
+void APIENTRY glad_debug_impl_glTexCoord1i(GLint arg0) {
+    _pre_call_callback("glTexCoord1i", (void*)glTexCoord1i, 1, arg0);
+    glad_glTexCoord1i(arg0);
+    _post_call_callback("glTexCoord1i", (void*)glTexCoord1i, 1, arg0);
+}
+PFNGLTEXCOORD1IPROC glad_debug_glTexCoord1i = glad_debug_impl_glTexCoord1i;
 PFNGLTEXCOORD1IVPROC glad_glTexCoord1iv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord1iv(const GLint * arg0) {
+    _pre_call_callback("glTexCoord1iv", (void*)glTexCoord1iv, 1, arg0);
+    glad_glTexCoord1iv(arg0);
+    _post_call_callback("glTexCoord1iv", (void*)glTexCoord1iv, 1, arg0);
+}
+PFNGLTEXCOORD1IVPROC glad_debug_glTexCoord1iv = glad_debug_impl_glTexCoord1iv;
 PFNGLTEXCOORD1SPROC glad_glTexCoord1s = NULL;
+void APIENTRY glad_debug_impl_glTexCoord1s(GLshort arg0) {
+    _pre_call_callback("glTexCoord1s", (void*)glTexCoord1s, 1, arg0);
+    glad_glTexCoord1s(arg0);
+    _post_call_callback("glTexCoord1s", (void*)glTexCoord1s, 1, arg0);
+}
+PFNGLTEXCOORD1SPROC glad_debug_glTexCoord1s = glad_debug_impl_glTexCoord1s;
 PFNGLTEXCOORD1SVPROC glad_glTexCoord1sv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord1sv(const GLshort * arg0) {
+    _pre_call_callback("glTexCoord1sv", (void*)glTexCoord1sv, 1, arg0);
+    glad_glTexCoord1sv(arg0);
+    _post_call_callback("glTexCoord1sv", (void*)glTexCoord1sv, 1, arg0);
+}
+PFNGLTEXCOORD1SVPROC glad_debug_glTexCoord1sv = glad_debug_impl_glTexCoord1sv;
 PFNGLTEXCOORD2DPROC glad_glTexCoord2d = NULL;
+void APIENTRY glad_debug_impl_glTexCoord2d(GLdouble arg0, GLdouble arg1) {
+    _pre_call_callback("glTexCoord2d", (void*)glTexCoord2d, 2, arg0, arg1);
+    glad_glTexCoord2d(arg0, arg1);
+    _post_call_callback("glTexCoord2d", (void*)glTexCoord2d, 2, arg0, arg1);
+}
+PFNGLTEXCOORD2DPROC glad_debug_glTexCoord2d = glad_debug_impl_glTexCoord2d;
 PFNGLTEXCOORD2DVPROC glad_glTexCoord2dv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord2dv(const GLdouble * arg0) {
+    _pre_call_callback("glTexCoord2dv", (void*)glTexCoord2dv, 1, arg0);
+    glad_glTexCoord2dv(arg0);
+    _post_call_callback("glTexCoord2dv", (void*)glTexCoord2dv, 1, arg0);
+}
+PFNGLTEXCOORD2DVPROC glad_debug_glTexCoord2dv = glad_debug_impl_glTexCoord2dv;
 PFNGLTEXCOORD2FPROC glad_glTexCoord2f = NULL;
+void APIENTRY glad_debug_impl_glTexCoord2f(GLfloat arg0, GLfloat arg1) {
+    _pre_call_callback("glTexCoord2f", (void*)glTexCoord2f, 2, arg0, arg1);
+    glad_glTexCoord2f(arg0, arg1);
+    _post_call_callback("glTexCoord2f", (void*)glTexCoord2f, 2, arg0, arg1);
+}
+PFNGLTEXCOORD2FPROC glad_debug_glTexCoord2f = glad_debug_impl_glTexCoord2f;
 PFNGLTEXCOORD2FVPROC glad_glTexCoord2fv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord2fv(const GLfloat * arg0) {
+    _pre_call_callback("glTexCoord2fv", (void*)glTexCoord2fv, 1, arg0);
+    glad_glTexCoord2fv(arg0);
+    _post_call_callback("glTexCoord2fv", (void*)glTexCoord2fv, 1, arg0);
+}
+PFNGLTEXCOORD2FVPROC glad_debug_glTexCoord2fv = glad_debug_impl_glTexCoord2fv;
 PFNGLTEXCOORD2IPROC glad_glTexCoord2i = NULL;
+void APIENTRY glad_debug_impl_glTexCoord2i(GLint arg0, GLint arg1) {
+    _pre_call_callback("glTexCoord2i", (void*)glTexCoord2i, 2, arg0, arg1);
+    glad_glTexCoord2i(arg0, arg1);
+    _post_call_callback("glTexCoord2i", (void*)glTexCoord2i, 2, arg0, arg1);
+}
+PFNGLTEXCOORD2IPROC glad_debug_glTexCoord2i = glad_debug_impl_glTexCoord2i;
 PFNGLTEXCOORD2IVPROC glad_glTexCoord2iv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord2iv(const GLint * arg0) {
+    _pre_call_callback("glTexCoord2iv", (void*)glTexCoord2iv, 1, arg0);
+    glad_glTexCoord2iv(arg0);
+    _post_call_callback("glTexCoord2iv", (void*)glTexCoord2iv, 1, arg0);
+}
+PFNGLTEXCOORD2IVPROC glad_debug_glTexCoord2iv = glad_debug_impl_glTexCoord2iv;
 PFNGLTEXCOORD2SPROC glad_glTexCoord2s = NULL;
+void APIENTRY glad_debug_impl_glTexCoord2s(GLshort arg0, GLshort arg1) {
+    _pre_call_callback("glTexCoord2s", (void*)glTexCoord2s, 2, arg0, arg1);
+    glad_glTexCoord2s(arg0, arg1);
+    _post_call_callback("glTexCoord2s", (void*)glTexCoord2s, 2, arg0, arg1);
+}
+PFNGLTEXCOORD2SPROC glad_debug_glTexCoord2s = glad_debug_impl_glTexCoord2s;
 PFNGLTEXCOORD2SVPROC glad_glTexCoord2sv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord2sv(const GLshort * arg0) {
+    _pre_call_callback("glTexCoord2sv", (void*)glTexCoord2sv, 1, arg0);
+    glad_glTexCoord2sv(arg0);
+    _post_call_callback("glTexCoord2sv", (void*)glTexCoord2sv, 1, arg0);
+}
+PFNGLTEXCOORD2SVPROC glad_debug_glTexCoord2sv = glad_debug_impl_glTexCoord2sv;
 PFNGLTEXCOORD3DPROC glad_glTexCoord3d = NULL;
+void APIENTRY glad_debug_impl_glTexCoord3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glTexCoord3d", (void*)glTexCoord3d, 3, arg0, arg1, arg2);
+    glad_glTexCoord3d(arg0, arg1, arg2);
+    _post_call_callback("glTexCoord3d", (void*)glTexCoord3d, 3, arg0, arg1, arg2);
+}
+PFNGLTEXCOORD3DPROC glad_debug_glTexCoord3d = glad_debug_impl_glTexCoord3d;
 PFNGLTEXCOORD3DVPROC glad_glTexCoord3dv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord3dv(const GLdouble * arg0) {
+    _pre_call_callback("glTexCoord3dv", (void*)glTexCoord3dv, 1, arg0);
+    glad_glTexCoord3dv(arg0);
+    _post_call_callback("glTexCoord3dv", (void*)glTexCoord3dv, 1, arg0);
+}
+PFNGLTEXCOORD3DVPROC glad_debug_glTexCoord3dv = glad_debug_impl_glTexCoord3dv;
 PFNGLTEXCOORD3FPROC glad_glTexCoord3f = NULL;
+void APIENTRY glad_debug_impl_glTexCoord3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glTexCoord3f", (void*)glTexCoord3f, 3, arg0, arg1, arg2);
+    glad_glTexCoord3f(arg0, arg1, arg2);
+    _post_call_callback("glTexCoord3f", (void*)glTexCoord3f, 3, arg0, arg1, arg2);
+}
+PFNGLTEXCOORD3FPROC glad_debug_glTexCoord3f = glad_debug_impl_glTexCoord3f;
 PFNGLTEXCOORD3FVPROC glad_glTexCoord3fv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord3fv(const GLfloat * arg0) {
+    _pre_call_callback("glTexCoord3fv", (void*)glTexCoord3fv, 1, arg0);
+    glad_glTexCoord3fv(arg0);
+    _post_call_callback("glTexCoord3fv", (void*)glTexCoord3fv, 1, arg0);
+}
+PFNGLTEXCOORD3FVPROC glad_debug_glTexCoord3fv = glad_debug_impl_glTexCoord3fv;
 PFNGLTEXCOORD3IPROC glad_glTexCoord3i = NULL;
+void APIENTRY glad_debug_impl_glTexCoord3i(GLint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glTexCoord3i", (void*)glTexCoord3i, 3, arg0, arg1, arg2);
+    glad_glTexCoord3i(arg0, arg1, arg2);
+    _post_call_callback("glTexCoord3i", (void*)glTexCoord3i, 3, arg0, arg1, arg2);
+}
+PFNGLTEXCOORD3IPROC glad_debug_glTexCoord3i = glad_debug_impl_glTexCoord3i;
 PFNGLTEXCOORD3IVPROC glad_glTexCoord3iv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord3iv(const GLint * arg0) {
+    _pre_call_callback("glTexCoord3iv", (void*)glTexCoord3iv, 1, arg0);
+    glad_glTexCoord3iv(arg0);
+    _post_call_callback("glTexCoord3iv", (void*)glTexCoord3iv, 1, arg0);
+}
+PFNGLTEXCOORD3IVPROC glad_debug_glTexCoord3iv = glad_debug_impl_glTexCoord3iv;
 PFNGLTEXCOORD3SPROC glad_glTexCoord3s = NULL;
+void APIENTRY glad_debug_impl_glTexCoord3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glTexCoord3s", (void*)glTexCoord3s, 3, arg0, arg1, arg2);
+    glad_glTexCoord3s(arg0, arg1, arg2);
+    _post_call_callback("glTexCoord3s", (void*)glTexCoord3s, 3, arg0, arg1, arg2);
+}
+PFNGLTEXCOORD3SPROC glad_debug_glTexCoord3s = glad_debug_impl_glTexCoord3s;
 PFNGLTEXCOORD3SVPROC glad_glTexCoord3sv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord3sv(const GLshort * arg0) {
+    _pre_call_callback("glTexCoord3sv", (void*)glTexCoord3sv, 1, arg0);
+    glad_glTexCoord3sv(arg0);
+    _post_call_callback("glTexCoord3sv", (void*)glTexCoord3sv, 1, arg0);
+}
+PFNGLTEXCOORD3SVPROC glad_debug_glTexCoord3sv = glad_debug_impl_glTexCoord3sv;
 PFNGLTEXCOORD4DPROC glad_glTexCoord4d = NULL;
+void APIENTRY glad_debug_impl_glTexCoord4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+    _pre_call_callback("glTexCoord4d", (void*)glTexCoord4d, 4, arg0, arg1, arg2, arg3);
+    glad_glTexCoord4d(arg0, arg1, arg2, arg3);
+    _post_call_callback("glTexCoord4d", (void*)glTexCoord4d, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLTEXCOORD4DPROC glad_debug_glTexCoord4d = glad_debug_impl_glTexCoord4d;
 PFNGLTEXCOORD4DVPROC glad_glTexCoord4dv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord4dv(const GLdouble * arg0) {
+    _pre_call_callback("glTexCoord4dv", (void*)glTexCoord4dv, 1, arg0);
+    glad_glTexCoord4dv(arg0);
+    _post_call_callback("glTexCoord4dv", (void*)glTexCoord4dv, 1, arg0);
+}
+PFNGLTEXCOORD4DVPROC glad_debug_glTexCoord4dv = glad_debug_impl_glTexCoord4dv;
 PFNGLTEXCOORD4FPROC glad_glTexCoord4f = NULL;
+void APIENTRY glad_debug_impl_glTexCoord4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glTexCoord4f", (void*)glTexCoord4f, 4, arg0, arg1, arg2, arg3);
+    glad_glTexCoord4f(arg0, arg1, arg2, arg3);
+    _post_call_callback("glTexCoord4f", (void*)glTexCoord4f, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLTEXCOORD4FPROC glad_debug_glTexCoord4f = glad_debug_impl_glTexCoord4f;
 PFNGLTEXCOORD4FVPROC glad_glTexCoord4fv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord4fv(const GLfloat * arg0) {
+    _pre_call_callback("glTexCoord4fv", (void*)glTexCoord4fv, 1, arg0);
+    glad_glTexCoord4fv(arg0);
+    _post_call_callback("glTexCoord4fv", (void*)glTexCoord4fv, 1, arg0);
+}
+PFNGLTEXCOORD4FVPROC glad_debug_glTexCoord4fv = glad_debug_impl_glTexCoord4fv;
 PFNGLTEXCOORD4IPROC glad_glTexCoord4i = NULL;
+void APIENTRY glad_debug_impl_glTexCoord4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glTexCoord4i", (void*)glTexCoord4i, 4, arg0, arg1, arg2, arg3);
+    glad_glTexCoord4i(arg0, arg1, arg2, arg3);
+    _post_call_callback("glTexCoord4i", (void*)glTexCoord4i, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLTEXCOORD4IPROC glad_debug_glTexCoord4i = glad_debug_impl_glTexCoord4i;
 PFNGLTEXCOORD4IVPROC glad_glTexCoord4iv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord4iv(const GLint * arg0) {
+    _pre_call_callback("glTexCoord4iv", (void*)glTexCoord4iv, 1, arg0);
+    glad_glTexCoord4iv(arg0);
+    _post_call_callback("glTexCoord4iv", (void*)glTexCoord4iv, 1, arg0);
+}
+PFNGLTEXCOORD4IVPROC glad_debug_glTexCoord4iv = glad_debug_impl_glTexCoord4iv;
 PFNGLTEXCOORD4SPROC glad_glTexCoord4s = NULL;
+void APIENTRY glad_debug_impl_glTexCoord4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+    _pre_call_callback("glTexCoord4s", (void*)glTexCoord4s, 4, arg0, arg1, arg2, arg3);
+    glad_glTexCoord4s(arg0, arg1, arg2, arg3);
+    _post_call_callback("glTexCoord4s", (void*)glTexCoord4s, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLTEXCOORD4SPROC glad_debug_glTexCoord4s = glad_debug_impl_glTexCoord4s;
 PFNGLTEXCOORD4SVPROC glad_glTexCoord4sv = NULL;
+void APIENTRY glad_debug_impl_glTexCoord4sv(const GLshort * arg0) {
+    _pre_call_callback("glTexCoord4sv", (void*)glTexCoord4sv, 1, arg0);
+    glad_glTexCoord4sv(arg0);
+    _post_call_callback("glTexCoord4sv", (void*)glTexCoord4sv, 1, arg0);
+}
+PFNGLTEXCOORD4SVPROC glad_debug_glTexCoord4sv = glad_debug_impl_glTexCoord4sv;
 PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
+void APIENTRY glad_debug_impl_glTexCoordP1ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glTexCoordP1ui", (void*)glTexCoordP1ui, 2, arg0, arg1);
+    glad_glTexCoordP1ui(arg0, arg1);
+    _post_call_callback("glTexCoordP1ui", (void*)glTexCoordP1ui, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP1UIPROC glad_debug_glTexCoordP1ui = glad_debug_impl_glTexCoordP1ui;
 PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
+void APIENTRY glad_debug_impl_glTexCoordP1uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glTexCoordP1uiv", (void*)glTexCoordP1uiv, 2, arg0, arg1);
+    glad_glTexCoordP1uiv(arg0, arg1);
+    _post_call_callback("glTexCoordP1uiv", (void*)glTexCoordP1uiv, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP1UIVPROC glad_debug_glTexCoordP1uiv = glad_debug_impl_glTexCoordP1uiv;
 PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
+void APIENTRY glad_debug_impl_glTexCoordP2ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glTexCoordP2ui", (void*)glTexCoordP2ui, 2, arg0, arg1);
+    glad_glTexCoordP2ui(arg0, arg1);
+    _post_call_callback("glTexCoordP2ui", (void*)glTexCoordP2ui, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP2UIPROC glad_debug_glTexCoordP2ui = glad_debug_impl_glTexCoordP2ui;
 PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = NULL;
+void APIENTRY glad_debug_impl_glTexCoordP2uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glTexCoordP2uiv", (void*)glTexCoordP2uiv, 2, arg0, arg1);
+    glad_glTexCoordP2uiv(arg0, arg1);
+    _post_call_callback("glTexCoordP2uiv", (void*)glTexCoordP2uiv, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP2UIVPROC glad_debug_glTexCoordP2uiv = glad_debug_impl_glTexCoordP2uiv;
 PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = NULL;
+void APIENTRY glad_debug_impl_glTexCoordP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glTexCoordP3ui", (void*)glTexCoordP3ui, 2, arg0, arg1);
+    glad_glTexCoordP3ui(arg0, arg1);
+    _post_call_callback("glTexCoordP3ui", (void*)glTexCoordP3ui, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP3UIPROC glad_debug_glTexCoordP3ui = glad_debug_impl_glTexCoordP3ui;
 PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = NULL;
+void APIENTRY glad_debug_impl_glTexCoordP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glTexCoordP3uiv", (void*)glTexCoordP3uiv, 2, arg0, arg1);
+    glad_glTexCoordP3uiv(arg0, arg1);
+    _post_call_callback("glTexCoordP3uiv", (void*)glTexCoordP3uiv, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP3UIVPROC glad_debug_glTexCoordP3uiv = glad_debug_impl_glTexCoordP3uiv;
 PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = NULL;
+void APIENTRY glad_debug_impl_glTexCoordP4ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glTexCoordP4ui", (void*)glTexCoordP4ui, 2, arg0, arg1);
+    glad_glTexCoordP4ui(arg0, arg1);
+    _post_call_callback("glTexCoordP4ui", (void*)glTexCoordP4ui, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP4UIPROC glad_debug_glTexCoordP4ui = glad_debug_impl_glTexCoordP4ui;
 PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = NULL;
+void APIENTRY glad_debug_impl_glTexCoordP4uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glTexCoordP4uiv", (void*)glTexCoordP4uiv, 2, arg0, arg1);
+    glad_glTexCoordP4uiv(arg0, arg1);
+    _post_call_callback("glTexCoordP4uiv", (void*)glTexCoordP4uiv, 2, arg0, arg1);
+}
+PFNGLTEXCOORDP4UIVPROC glad_debug_glTexCoordP4uiv = glad_debug_impl_glTexCoordP4uiv;
 PFNGLTEXCOORDPOINTERPROC glad_glTexCoordPointer = NULL;
+void APIENTRY glad_debug_impl_glTexCoordPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+    _pre_call_callback("glTexCoordPointer", (void*)glTexCoordPointer, 4, arg0, arg1, arg2, arg3);
+    glad_glTexCoordPointer(arg0, arg1, arg2, arg3);
+    _post_call_callback("glTexCoordPointer", (void*)glTexCoordPointer, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLTEXCOORDPOINTERPROC glad_debug_glTexCoordPointer = glad_debug_impl_glTexCoordPointer;
 PFNGLTEXENVFPROC glad_glTexEnvf = NULL;
+void APIENTRY glad_debug_impl_glTexEnvf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+    _pre_call_callback("glTexEnvf", (void*)glTexEnvf, 3, arg0, arg1, arg2);
+    glad_glTexEnvf(arg0, arg1, arg2);
+    _post_call_callback("glTexEnvf", (void*)glTexEnvf, 3, arg0, arg1, arg2);
+}
+PFNGLTEXENVFPROC glad_debug_glTexEnvf = glad_debug_impl_glTexEnvf;
 PFNGLTEXENVFVPROC glad_glTexEnvfv = NULL;
+void APIENTRY glad_debug_impl_glTexEnvfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+    _pre_call_callback("glTexEnvfv", (void*)glTexEnvfv, 3, arg0, arg1, arg2);
+    glad_glTexEnvfv(arg0, arg1, arg2);
+    _post_call_callback("glTexEnvfv", (void*)glTexEnvfv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXENVFVPROC glad_debug_glTexEnvfv = glad_debug_impl_glTexEnvfv;
 PFNGLTEXENVIPROC glad_glTexEnvi = NULL;
+void APIENTRY glad_debug_impl_glTexEnvi(GLenum arg0, GLenum arg1, GLint arg2) {
+    _pre_call_callback("glTexEnvi", (void*)glTexEnvi, 3, arg0, arg1, arg2);
+    glad_glTexEnvi(arg0, arg1, arg2);
+    _post_call_callback("glTexEnvi", (void*)glTexEnvi, 3, arg0, arg1, arg2);
+}
+PFNGLTEXENVIPROC glad_debug_glTexEnvi = glad_debug_impl_glTexEnvi;
 PFNGLTEXENVIVPROC glad_glTexEnviv = NULL;
+void APIENTRY glad_debug_impl_glTexEnviv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glTexEnviv", (void*)glTexEnviv, 3, arg0, arg1, arg2);
+    glad_glTexEnviv(arg0, arg1, arg2);
+    _post_call_callback("glTexEnviv", (void*)glTexEnviv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXENVIVPROC glad_debug_glTexEnviv = glad_debug_impl_glTexEnviv;
 PFNGLTEXGENDPROC glad_glTexGend = NULL;
+void APIENTRY glad_debug_impl_glTexGend(GLenum arg0, GLenum arg1, GLdouble arg2) {
+    _pre_call_callback("glTexGend", (void*)glTexGend, 3, arg0, arg1, arg2);
+    glad_glTexGend(arg0, arg1, arg2);
+    _post_call_callback("glTexGend", (void*)glTexGend, 3, arg0, arg1, arg2);
+}
+PFNGLTEXGENDPROC glad_debug_glTexGend = glad_debug_impl_glTexGend;
 PFNGLTEXGENDVPROC glad_glTexGendv = NULL;
+void APIENTRY glad_debug_impl_glTexGendv(GLenum arg0, GLenum arg1, const GLdouble * arg2) {
+    _pre_call_callback("glTexGendv", (void*)glTexGendv, 3, arg0, arg1, arg2);
+    glad_glTexGendv(arg0, arg1, arg2);
+    _post_call_callback("glTexGendv", (void*)glTexGendv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXGENDVPROC glad_debug_glTexGendv = glad_debug_impl_glTexGendv;
 PFNGLTEXGENFPROC glad_glTexGenf = NULL;
+void APIENTRY glad_debug_impl_glTexGenf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+    _pre_call_callback("glTexGenf", (void*)glTexGenf, 3, arg0, arg1, arg2);
+    glad_glTexGenf(arg0, arg1, arg2);
+    _post_call_callback("glTexGenf", (void*)glTexGenf, 3, arg0, arg1, arg2);
+}
+PFNGLTEXGENFPROC glad_debug_glTexGenf = glad_debug_impl_glTexGenf;
 PFNGLTEXGENFVPROC glad_glTexGenfv = NULL;
+void APIENTRY glad_debug_impl_glTexGenfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+    _pre_call_callback("glTexGenfv", (void*)glTexGenfv, 3, arg0, arg1, arg2);
+    glad_glTexGenfv(arg0, arg1, arg2);
+    _post_call_callback("glTexGenfv", (void*)glTexGenfv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXGENFVPROC glad_debug_glTexGenfv = glad_debug_impl_glTexGenfv;
 PFNGLTEXGENIPROC glad_glTexGeni = NULL;
+void APIENTRY glad_debug_impl_glTexGeni(GLenum arg0, GLenum arg1, GLint arg2) {
+    _pre_call_callback("glTexGeni", (void*)glTexGeni, 3, arg0, arg1, arg2);
+    glad_glTexGeni(arg0, arg1, arg2);
+    _post_call_callback("glTexGeni", (void*)glTexGeni, 3, arg0, arg1, arg2);
+}
+PFNGLTEXGENIPROC glad_debug_glTexGeni = glad_debug_impl_glTexGeni;
 PFNGLTEXGENIVPROC glad_glTexGeniv = NULL;
+void APIENTRY glad_debug_impl_glTexGeniv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glTexGeniv", (void*)glTexGeniv, 3, arg0, arg1, arg2);
+    glad_glTexGeniv(arg0, arg1, arg2);
+    _post_call_callback("glTexGeniv", (void*)glTexGeniv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXGENIVPROC glad_debug_glTexGeniv = glad_debug_impl_glTexGeniv;
 PFNGLTEXIMAGE1DPROC glad_glTexImage1D = NULL;
+void APIENTRY glad_debug_impl_glTexImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLint arg4, GLenum arg5, GLenum arg6, const void * arg7) {
+    _pre_call_callback("glTexImage1D", (void*)glTexImage1D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    glad_glTexImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+    _post_call_callback("glTexImage1D", (void*)glTexImage1D, 8, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+PFNGLTEXIMAGE1DPROC glad_debug_glTexImage1D = glad_debug_impl_glTexImage1D;
 PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
+void APIENTRY glad_debug_impl_glTexImage2D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+    _pre_call_callback("glTexImage2D", (void*)glTexImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    glad_glTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glTexImage2D", (void*)glTexImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLTEXIMAGE2DPROC glad_debug_glTexImage2D = glad_debug_impl_glTexImage2D;
 PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = NULL;
+void APIENTRY glad_debug_impl_glTexImage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+    _pre_call_callback("glTexImage2DMultisample", (void*)glTexImage2DMultisample, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glTexImage2DMultisample(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glTexImage2DMultisample", (void*)glTexImage2DMultisample, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_debug_glTexImage2DMultisample = glad_debug_impl_glTexImage2DMultisample;
 PFNGLTEXIMAGE3DPROC glad_glTexImage3D = NULL;
+void APIENTRY glad_debug_impl_glTexImage3D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLenum arg7, GLenum arg8, const void * arg9) {
+    _pre_call_callback("glTexImage3D", (void*)glTexImage3D, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    glad_glTexImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+    _post_call_callback("glTexImage3D", (void*)glTexImage3D, 10, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+PFNGLTEXIMAGE3DPROC glad_debug_glTexImage3D = glad_debug_impl_glTexImage3D;
 PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = NULL;
+void APIENTRY glad_debug_impl_glTexImage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+    _pre_call_callback("glTexImage3DMultisample", (void*)glTexImage3DMultisample, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glTexImage3DMultisample(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glTexImage3DMultisample", (void*)glTexImage3DMultisample, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_debug_glTexImage3DMultisample = glad_debug_impl_glTexImage3DMultisample;
 PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = NULL;
+void APIENTRY glad_debug_impl_glTexParameterIiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glTexParameterIiv", (void*)glTexParameterIiv, 3, arg0, arg1, arg2);
+    glad_glTexParameterIiv(arg0, arg1, arg2);
+    _post_call_callback("glTexParameterIiv", (void*)glTexParameterIiv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERIIVPROC glad_debug_glTexParameterIiv = glad_debug_impl_glTexParameterIiv;
 PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = NULL;
+void APIENTRY glad_debug_impl_glTexParameterIuiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+    _pre_call_callback("glTexParameterIuiv", (void*)glTexParameterIuiv, 3, arg0, arg1, arg2);
+    glad_glTexParameterIuiv(arg0, arg1, arg2);
+    _post_call_callback("glTexParameterIuiv", (void*)glTexParameterIuiv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERIUIVPROC glad_debug_glTexParameterIuiv = glad_debug_impl_glTexParameterIuiv;
 PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
+void APIENTRY glad_debug_impl_glTexParameterf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+    _pre_call_callback("glTexParameterf", (void*)glTexParameterf, 3, arg0, arg1, arg2);
+    glad_glTexParameterf(arg0, arg1, arg2);
+    _post_call_callback("glTexParameterf", (void*)glTexParameterf, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERFPROC glad_debug_glTexParameterf = glad_debug_impl_glTexParameterf;
 PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
+void APIENTRY glad_debug_impl_glTexParameterfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+    _pre_call_callback("glTexParameterfv", (void*)glTexParameterfv, 3, arg0, arg1, arg2);
+    glad_glTexParameterfv(arg0, arg1, arg2);
+    _post_call_callback("glTexParameterfv", (void*)glTexParameterfv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERFVPROC glad_debug_glTexParameterfv = glad_debug_impl_glTexParameterfv;
 PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
+void APIENTRY glad_debug_impl_glTexParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+    _pre_call_callback("glTexParameteri", (void*)glTexParameteri, 3, arg0, arg1, arg2);
+    glad_glTexParameteri(arg0, arg1, arg2);
+    _post_call_callback("glTexParameteri", (void*)glTexParameteri, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERIPROC glad_debug_glTexParameteri = glad_debug_impl_glTexParameteri;
 PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
+void APIENTRY glad_debug_impl_glTexParameteriv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+    _pre_call_callback("glTexParameteriv", (void*)glTexParameteriv, 3, arg0, arg1, arg2);
+    glad_glTexParameteriv(arg0, arg1, arg2);
+    _post_call_callback("glTexParameteriv", (void*)glTexParameteriv, 3, arg0, arg1, arg2);
+}
+PFNGLTEXPARAMETERIVPROC glad_debug_glTexParameteriv = glad_debug_impl_glTexParameteriv;
 PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
+void APIENTRY glad_debug_impl_glTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+    _pre_call_callback("glTexSubImage1D", (void*)glTexSubImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    glad_glTexSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+    _post_call_callback("glTexSubImage1D", (void*)glTexSubImage1D, 7, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+PFNGLTEXSUBIMAGE1DPROC glad_debug_glTexSubImage1D = glad_debug_impl_glTexSubImage1D;
 PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
+void APIENTRY glad_debug_impl_glTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+    _pre_call_callback("glTexSubImage2D", (void*)glTexSubImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    glad_glTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+    _post_call_callback("glTexSubImage2D", (void*)glTexSubImage2D, 9, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+PFNGLTEXSUBIMAGE2DPROC glad_debug_glTexSubImage2D = glad_debug_impl_glTexSubImage2D;
 PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
+void APIENTRY glad_debug_impl_glTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+    _pre_call_callback("glTexSubImage3D", (void*)glTexSubImage3D, 11, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+    glad_glTexSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+    _post_call_callback("glTexSubImage3D", (void*)glTexSubImage3D, 11, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+PFNGLTEXSUBIMAGE3DPROC glad_debug_glTexSubImage3D = glad_debug_impl_glTexSubImage3D;
 PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
+void APIENTRY glad_debug_impl_glTransformFeedbackVaryings(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, GLenum arg3) {
+    _pre_call_callback("glTransformFeedbackVaryings", (void*)glTransformFeedbackVaryings, 4, arg0, arg1, arg2, arg3);
+    glad_glTransformFeedbackVaryings(arg0, arg1, arg2, arg3);
+    _post_call_callback("glTransformFeedbackVaryings", (void*)glTransformFeedbackVaryings, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_debug_glTransformFeedbackVaryings = glad_debug_impl_glTransformFeedbackVaryings;
 PFNGLTRANSLATEDPROC glad_glTranslated = NULL;
+void APIENTRY glad_debug_impl_glTranslated(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glTranslated", (void*)glTranslated, 3, arg0, arg1, arg2);
+    glad_glTranslated(arg0, arg1, arg2);
+    _post_call_callback("glTranslated", (void*)glTranslated, 3, arg0, arg1, arg2);
+}
+PFNGLTRANSLATEDPROC glad_debug_glTranslated = glad_debug_impl_glTranslated;
 PFNGLTRANSLATEFPROC glad_glTranslatef = NULL;
+void APIENTRY glad_debug_impl_glTranslatef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glTranslatef", (void*)glTranslatef, 3, arg0, arg1, arg2);
+    glad_glTranslatef(arg0, arg1, arg2);
+    _post_call_callback("glTranslatef", (void*)glTranslatef, 3, arg0, arg1, arg2);
+}
+PFNGLTRANSLATEFPROC glad_debug_glTranslatef = glad_debug_impl_glTranslatef;
 PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
+void APIENTRY glad_debug_impl_glUniform1f(GLint arg0, GLfloat arg1) {
+    _pre_call_callback("glUniform1f", (void*)glUniform1f, 2, arg0, arg1);
+    glad_glUniform1f(arg0, arg1);
+    _post_call_callback("glUniform1f", (void*)glUniform1f, 2, arg0, arg1);
+}
+PFNGLUNIFORM1FPROC glad_debug_glUniform1f = glad_debug_impl_glUniform1f;
 PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
+void APIENTRY glad_debug_impl_glUniform1fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+    _pre_call_callback("glUniform1fv", (void*)glUniform1fv, 3, arg0, arg1, arg2);
+    glad_glUniform1fv(arg0, arg1, arg2);
+    _post_call_callback("glUniform1fv", (void*)glUniform1fv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM1FVPROC glad_debug_glUniform1fv = glad_debug_impl_glUniform1fv;
 PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
+void APIENTRY glad_debug_impl_glUniform1i(GLint arg0, GLint arg1) {
+    _pre_call_callback("glUniform1i", (void*)glUniform1i, 2, arg0, arg1);
+    glad_glUniform1i(arg0, arg1);
+    _post_call_callback("glUniform1i", (void*)glUniform1i, 2, arg0, arg1);
+}
+PFNGLUNIFORM1IPROC glad_debug_glUniform1i = glad_debug_impl_glUniform1i;
 PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
+void APIENTRY glad_debug_impl_glUniform1iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+    _pre_call_callback("glUniform1iv", (void*)glUniform1iv, 3, arg0, arg1, arg2);
+    glad_glUniform1iv(arg0, arg1, arg2);
+    _post_call_callback("glUniform1iv", (void*)glUniform1iv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM1IVPROC glad_debug_glUniform1iv = glad_debug_impl_glUniform1iv;
 PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
+void APIENTRY glad_debug_impl_glUniform1ui(GLint arg0, GLuint arg1) {
+    _pre_call_callback("glUniform1ui", (void*)glUniform1ui, 2, arg0, arg1);
+    glad_glUniform1ui(arg0, arg1);
+    _post_call_callback("glUniform1ui", (void*)glUniform1ui, 2, arg0, arg1);
+}
+PFNGLUNIFORM1UIPROC glad_debug_glUniform1ui = glad_debug_impl_glUniform1ui;
 PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
+void APIENTRY glad_debug_impl_glUniform1uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+    _pre_call_callback("glUniform1uiv", (void*)glUniform1uiv, 3, arg0, arg1, arg2);
+    glad_glUniform1uiv(arg0, arg1, arg2);
+    _post_call_callback("glUniform1uiv", (void*)glUniform1uiv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM1UIVPROC glad_debug_glUniform1uiv = glad_debug_impl_glUniform1uiv;
 PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
+void APIENTRY glad_debug_impl_glUniform2f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glUniform2f", (void*)glUniform2f, 3, arg0, arg1, arg2);
+    glad_glUniform2f(arg0, arg1, arg2);
+    _post_call_callback("glUniform2f", (void*)glUniform2f, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2FPROC glad_debug_glUniform2f = glad_debug_impl_glUniform2f;
 PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
+void APIENTRY glad_debug_impl_glUniform2fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+    _pre_call_callback("glUniform2fv", (void*)glUniform2fv, 3, arg0, arg1, arg2);
+    glad_glUniform2fv(arg0, arg1, arg2);
+    _post_call_callback("glUniform2fv", (void*)glUniform2fv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2FVPROC glad_debug_glUniform2fv = glad_debug_impl_glUniform2fv;
 PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
+void APIENTRY glad_debug_impl_glUniform2i(GLint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glUniform2i", (void*)glUniform2i, 3, arg0, arg1, arg2);
+    glad_glUniform2i(arg0, arg1, arg2);
+    _post_call_callback("glUniform2i", (void*)glUniform2i, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2IPROC glad_debug_glUniform2i = glad_debug_impl_glUniform2i;
 PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
+void APIENTRY glad_debug_impl_glUniform2iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+    _pre_call_callback("glUniform2iv", (void*)glUniform2iv, 3, arg0, arg1, arg2);
+    glad_glUniform2iv(arg0, arg1, arg2);
+    _post_call_callback("glUniform2iv", (void*)glUniform2iv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2IVPROC glad_debug_glUniform2iv = glad_debug_impl_glUniform2iv;
 PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
+void APIENTRY glad_debug_impl_glUniform2ui(GLint arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glUniform2ui", (void*)glUniform2ui, 3, arg0, arg1, arg2);
+    glad_glUniform2ui(arg0, arg1, arg2);
+    _post_call_callback("glUniform2ui", (void*)glUniform2ui, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2UIPROC glad_debug_glUniform2ui = glad_debug_impl_glUniform2ui;
 PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
+void APIENTRY glad_debug_impl_glUniform2uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+    _pre_call_callback("glUniform2uiv", (void*)glUniform2uiv, 3, arg0, arg1, arg2);
+    glad_glUniform2uiv(arg0, arg1, arg2);
+    _post_call_callback("glUniform2uiv", (void*)glUniform2uiv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM2UIVPROC glad_debug_glUniform2uiv = glad_debug_impl_glUniform2uiv;
 PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
+void APIENTRY glad_debug_impl_glUniform3f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glUniform3f", (void*)glUniform3f, 4, arg0, arg1, arg2, arg3);
+    glad_glUniform3f(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniform3f", (void*)glUniform3f, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORM3FPROC glad_debug_glUniform3f = glad_debug_impl_glUniform3f;
 PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
+void APIENTRY glad_debug_impl_glUniform3fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+    _pre_call_callback("glUniform3fv", (void*)glUniform3fv, 3, arg0, arg1, arg2);
+    glad_glUniform3fv(arg0, arg1, arg2);
+    _post_call_callback("glUniform3fv", (void*)glUniform3fv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM3FVPROC glad_debug_glUniform3fv = glad_debug_impl_glUniform3fv;
 PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
+void APIENTRY glad_debug_impl_glUniform3i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glUniform3i", (void*)glUniform3i, 4, arg0, arg1, arg2, arg3);
+    glad_glUniform3i(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniform3i", (void*)glUniform3i, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORM3IPROC glad_debug_glUniform3i = glad_debug_impl_glUniform3i;
 PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
+void APIENTRY glad_debug_impl_glUniform3iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+    _pre_call_callback("glUniform3iv", (void*)glUniform3iv, 3, arg0, arg1, arg2);
+    glad_glUniform3iv(arg0, arg1, arg2);
+    _post_call_callback("glUniform3iv", (void*)glUniform3iv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM3IVPROC glad_debug_glUniform3iv = glad_debug_impl_glUniform3iv;
 PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
+void APIENTRY glad_debug_impl_glUniform3ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+    _pre_call_callback("glUniform3ui", (void*)glUniform3ui, 4, arg0, arg1, arg2, arg3);
+    glad_glUniform3ui(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniform3ui", (void*)glUniform3ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORM3UIPROC glad_debug_glUniform3ui = glad_debug_impl_glUniform3ui;
 PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
+void APIENTRY glad_debug_impl_glUniform3uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+    _pre_call_callback("glUniform3uiv", (void*)glUniform3uiv, 3, arg0, arg1, arg2);
+    glad_glUniform3uiv(arg0, arg1, arg2);
+    _post_call_callback("glUniform3uiv", (void*)glUniform3uiv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM3UIVPROC glad_debug_glUniform3uiv = glad_debug_impl_glUniform3uiv;
 PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
+void APIENTRY glad_debug_impl_glUniform4f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+    _pre_call_callback("glUniform4f", (void*)glUniform4f, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glUniform4f(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glUniform4f", (void*)glUniform4f, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLUNIFORM4FPROC glad_debug_glUniform4f = glad_debug_impl_glUniform4f;
 PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
+void APIENTRY glad_debug_impl_glUniform4fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+    _pre_call_callback("glUniform4fv", (void*)glUniform4fv, 3, arg0, arg1, arg2);
+    glad_glUniform4fv(arg0, arg1, arg2);
+    _post_call_callback("glUniform4fv", (void*)glUniform4fv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM4FVPROC glad_debug_glUniform4fv = glad_debug_impl_glUniform4fv;
 PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
+void APIENTRY glad_debug_impl_glUniform4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+    _pre_call_callback("glUniform4i", (void*)glUniform4i, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glUniform4i(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glUniform4i", (void*)glUniform4i, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLUNIFORM4IPROC glad_debug_glUniform4i = glad_debug_impl_glUniform4i;
 PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
+void APIENTRY glad_debug_impl_glUniform4iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+    _pre_call_callback("glUniform4iv", (void*)glUniform4iv, 3, arg0, arg1, arg2);
+    glad_glUniform4iv(arg0, arg1, arg2);
+    _post_call_callback("glUniform4iv", (void*)glUniform4iv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM4IVPROC glad_debug_glUniform4iv = glad_debug_impl_glUniform4iv;
 PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
+void APIENTRY glad_debug_impl_glUniform4ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+    _pre_call_callback("glUniform4ui", (void*)glUniform4ui, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glUniform4ui(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glUniform4ui", (void*)glUniform4ui, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLUNIFORM4UIPROC glad_debug_glUniform4ui = glad_debug_impl_glUniform4ui;
 PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
+void APIENTRY glad_debug_impl_glUniform4uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+    _pre_call_callback("glUniform4uiv", (void*)glUniform4uiv, 3, arg0, arg1, arg2);
+    glad_glUniform4uiv(arg0, arg1, arg2);
+    _post_call_callback("glUniform4uiv", (void*)glUniform4uiv, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORM4UIVPROC glad_debug_glUniform4uiv = glad_debug_impl_glUniform4uiv;
 PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
+void APIENTRY glad_debug_impl_glUniformBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glUniformBlockBinding", (void*)glUniformBlockBinding, 3, arg0, arg1, arg2);
+    glad_glUniformBlockBinding(arg0, arg1, arg2);
+    _post_call_callback("glUniformBlockBinding", (void*)glUniformBlockBinding, 3, arg0, arg1, arg2);
+}
+PFNGLUNIFORMBLOCKBINDINGPROC glad_debug_glUniformBlockBinding = glad_debug_impl_glUniformBlockBinding;
 PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
+void APIENTRY glad_debug_impl_glUniformMatrix2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix2fv", (void*)glUniformMatrix2fv, 4, arg0, arg1, arg2, arg3);
+    glad_glUniformMatrix2fv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix2fv", (void*)glUniformMatrix2fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX2FVPROC glad_debug_glUniformMatrix2fv = glad_debug_impl_glUniformMatrix2fv;
 PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
+void APIENTRY glad_debug_impl_glUniformMatrix2x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix2x3fv", (void*)glUniformMatrix2x3fv, 4, arg0, arg1, arg2, arg3);
+    glad_glUniformMatrix2x3fv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix2x3fv", (void*)glUniformMatrix2x3fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX2X3FVPROC glad_debug_glUniformMatrix2x3fv = glad_debug_impl_glUniformMatrix2x3fv;
 PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
+void APIENTRY glad_debug_impl_glUniformMatrix2x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix2x4fv", (void*)glUniformMatrix2x4fv, 4, arg0, arg1, arg2, arg3);
+    glad_glUniformMatrix2x4fv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix2x4fv", (void*)glUniformMatrix2x4fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX2X4FVPROC glad_debug_glUniformMatrix2x4fv = glad_debug_impl_glUniformMatrix2x4fv;
 PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
+void APIENTRY glad_debug_impl_glUniformMatrix3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix3fv", (void*)glUniformMatrix3fv, 4, arg0, arg1, arg2, arg3);
+    glad_glUniformMatrix3fv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix3fv", (void*)glUniformMatrix3fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX3FVPROC glad_debug_glUniformMatrix3fv = glad_debug_impl_glUniformMatrix3fv;
 PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
+void APIENTRY glad_debug_impl_glUniformMatrix3x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix3x2fv", (void*)glUniformMatrix3x2fv, 4, arg0, arg1, arg2, arg3);
+    glad_glUniformMatrix3x2fv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix3x2fv", (void*)glUniformMatrix3x2fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX3X2FVPROC glad_debug_glUniformMatrix3x2fv = glad_debug_impl_glUniformMatrix3x2fv;
 PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
+void APIENTRY glad_debug_impl_glUniformMatrix3x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix3x4fv", (void*)glUniformMatrix3x4fv, 4, arg0, arg1, arg2, arg3);
+    glad_glUniformMatrix3x4fv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix3x4fv", (void*)glUniformMatrix3x4fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX3X4FVPROC glad_debug_glUniformMatrix3x4fv = glad_debug_impl_glUniformMatrix3x4fv;
 PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
+void APIENTRY glad_debug_impl_glUniformMatrix4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix4fv", (void*)glUniformMatrix4fv, 4, arg0, arg1, arg2, arg3);
+    glad_glUniformMatrix4fv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix4fv", (void*)glUniformMatrix4fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX4FVPROC glad_debug_glUniformMatrix4fv = glad_debug_impl_glUniformMatrix4fv;
 PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
+void APIENTRY glad_debug_impl_glUniformMatrix4x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix4x2fv", (void*)glUniformMatrix4x2fv, 4, arg0, arg1, arg2, arg3);
+    glad_glUniformMatrix4x2fv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix4x2fv", (void*)glUniformMatrix4x2fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX4X2FVPROC glad_debug_glUniformMatrix4x2fv = glad_debug_impl_glUniformMatrix4x2fv;
 PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
+void APIENTRY glad_debug_impl_glUniformMatrix4x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+    _pre_call_callback("glUniformMatrix4x3fv", (void*)glUniformMatrix4x3fv, 4, arg0, arg1, arg2, arg3);
+    glad_glUniformMatrix4x3fv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glUniformMatrix4x3fv", (void*)glUniformMatrix4x3fv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLUNIFORMMATRIX4X3FVPROC glad_debug_glUniformMatrix4x3fv = glad_debug_impl_glUniformMatrix4x3fv;
 PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
+GLboolean APIENTRY glad_debug_impl_glUnmapBuffer(GLenum arg0) {
+    GLboolean ret;
+    _pre_call_callback("glUnmapBuffer", (void*)glUnmapBuffer, 1, arg0);
+    ret = glad_glUnmapBuffer(arg0);
+    _post_call_callback("glUnmapBuffer", (void*)glUnmapBuffer, 1, arg0);
+    return ret;
+}
+PFNGLUNMAPBUFFERPROC glad_debug_glUnmapBuffer = glad_debug_impl_glUnmapBuffer;
 PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
+void APIENTRY glad_debug_impl_glUseProgram(GLuint arg0) {
+    _pre_call_callback("glUseProgram", (void*)glUseProgram, 1, arg0);
+    glad_glUseProgram(arg0);
+    _post_call_callback("glUseProgram", (void*)glUseProgram, 1, arg0);
+}
+PFNGLUSEPROGRAMPROC glad_debug_glUseProgram = glad_debug_impl_glUseProgram;
 PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
+void APIENTRY glad_debug_impl_glValidateProgram(GLuint arg0) {
+    _pre_call_callback("glValidateProgram", (void*)glValidateProgram, 1, arg0);
+    glad_glValidateProgram(arg0);
+    _post_call_callback("glValidateProgram", (void*)glValidateProgram, 1, arg0);
+}
+PFNGLVALIDATEPROGRAMPROC glad_debug_glValidateProgram = glad_debug_impl_glValidateProgram;
 PFNGLVERTEX2DPROC glad_glVertex2d = NULL;
+void APIENTRY glad_debug_impl_glVertex2d(GLdouble arg0, GLdouble arg1) {
+    _pre_call_callback("glVertex2d", (void*)glVertex2d, 2, arg0, arg1);
+    glad_glVertex2d(arg0, arg1);
+    _post_call_callback("glVertex2d", (void*)glVertex2d, 2, arg0, arg1);
+}
+PFNGLVERTEX2DPROC glad_debug_glVertex2d = glad_debug_impl_glVertex2d;
 PFNGLVERTEX2DVPROC glad_glVertex2dv = NULL;
+void APIENTRY glad_debug_impl_glVertex2dv(const GLdouble * arg0) {
+    _pre_call_callback("glVertex2dv", (void*)glVertex2dv, 1, arg0);
+    glad_glVertex2dv(arg0);
+    _post_call_callback("glVertex2dv", (void*)glVertex2dv, 1, arg0);
+}
+PFNGLVERTEX2DVPROC glad_debug_glVertex2dv = glad_debug_impl_glVertex2dv;
 PFNGLVERTEX2FPROC glad_glVertex2f = NULL;
+void APIENTRY glad_debug_impl_glVertex2f(GLfloat arg0, GLfloat arg1) {
+    _pre_call_callback("glVertex2f", (void*)glVertex2f, 2, arg0, arg1);
+    glad_glVertex2f(arg0, arg1);
+    _post_call_callback("glVertex2f", (void*)glVertex2f, 2, arg0, arg1);
+}
+PFNGLVERTEX2FPROC glad_debug_glVertex2f = glad_debug_impl_glVertex2f;
 PFNGLVERTEX2FVPROC glad_glVertex2fv = NULL;
+void APIENTRY glad_debug_impl_glVertex2fv(const GLfloat * arg0) {
+    _pre_call_callback("glVertex2fv", (void*)glVertex2fv, 1, arg0);
+    glad_glVertex2fv(arg0);
+    _post_call_callback("glVertex2fv", (void*)glVertex2fv, 1, arg0);
+}
+PFNGLVERTEX2FVPROC glad_debug_glVertex2fv = glad_debug_impl_glVertex2fv;
 PFNGLVERTEX2IPROC glad_glVertex2i = NULL;
+void APIENTRY glad_debug_impl_glVertex2i(GLint arg0, GLint arg1) {
+    _pre_call_callback("glVertex2i", (void*)glVertex2i, 2, arg0, arg1);
+    glad_glVertex2i(arg0, arg1);
+    _post_call_callback("glVertex2i", (void*)glVertex2i, 2, arg0, arg1);
+}
+PFNGLVERTEX2IPROC glad_debug_glVertex2i = glad_debug_impl_glVertex2i;
 PFNGLVERTEX2IVPROC glad_glVertex2iv = NULL;
+void APIENTRY glad_debug_impl_glVertex2iv(const GLint * arg0) {
+    _pre_call_callback("glVertex2iv", (void*)glVertex2iv, 1, arg0);
+    glad_glVertex2iv(arg0);
+    _post_call_callback("glVertex2iv", (void*)glVertex2iv, 1, arg0);
+}
+PFNGLVERTEX2IVPROC glad_debug_glVertex2iv = glad_debug_impl_glVertex2iv;
 PFNGLVERTEX2SPROC glad_glVertex2s = NULL;
+void APIENTRY glad_debug_impl_glVertex2s(GLshort arg0, GLshort arg1) {
+    _pre_call_callback("glVertex2s", (void*)glVertex2s, 2, arg0, arg1);
+    glad_glVertex2s(arg0, arg1);
+    _post_call_callback("glVertex2s", (void*)glVertex2s, 2, arg0, arg1);
+}
+PFNGLVERTEX2SPROC glad_debug_glVertex2s = glad_debug_impl_glVertex2s;
 PFNGLVERTEX2SVPROC glad_glVertex2sv = NULL;
+void APIENTRY glad_debug_impl_glVertex2sv(const GLshort * arg0) {
+    _pre_call_callback("glVertex2sv", (void*)glVertex2sv, 1, arg0);
+    glad_glVertex2sv(arg0);
+    _post_call_callback("glVertex2sv", (void*)glVertex2sv, 1, arg0);
+}
+PFNGLVERTEX2SVPROC glad_debug_glVertex2sv = glad_debug_impl_glVertex2sv;
 PFNGLVERTEX3DPROC glad_glVertex3d = NULL;
+void APIENTRY glad_debug_impl_glVertex3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glVertex3d", (void*)glVertex3d, 3, arg0, arg1, arg2);
+    glad_glVertex3d(arg0, arg1, arg2);
+    _post_call_callback("glVertex3d", (void*)glVertex3d, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEX3DPROC glad_debug_glVertex3d = glad_debug_impl_glVertex3d;
 PFNGLVERTEX3DVPROC glad_glVertex3dv = NULL;
+void APIENTRY glad_debug_impl_glVertex3dv(const GLdouble * arg0) {
+    _pre_call_callback("glVertex3dv", (void*)glVertex3dv, 1, arg0);
+    glad_glVertex3dv(arg0);
+    _post_call_callback("glVertex3dv", (void*)glVertex3dv, 1, arg0);
+}
+PFNGLVERTEX3DVPROC glad_debug_glVertex3dv = glad_debug_impl_glVertex3dv;
 PFNGLVERTEX3FPROC glad_glVertex3f = NULL;
+void APIENTRY glad_debug_impl_glVertex3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glVertex3f", (void*)glVertex3f, 3, arg0, arg1, arg2);
+    glad_glVertex3f(arg0, arg1, arg2);
+    _post_call_callback("glVertex3f", (void*)glVertex3f, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEX3FPROC glad_debug_glVertex3f = glad_debug_impl_glVertex3f;
 PFNGLVERTEX3FVPROC glad_glVertex3fv = NULL;
+void APIENTRY glad_debug_impl_glVertex3fv(const GLfloat * arg0) {
+    _pre_call_callback("glVertex3fv", (void*)glVertex3fv, 1, arg0);
+    glad_glVertex3fv(arg0);
+    _post_call_callback("glVertex3fv", (void*)glVertex3fv, 1, arg0);
+}
+PFNGLVERTEX3FVPROC glad_debug_glVertex3fv = glad_debug_impl_glVertex3fv;
 PFNGLVERTEX3IPROC glad_glVertex3i = NULL;
+void APIENTRY glad_debug_impl_glVertex3i(GLint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glVertex3i", (void*)glVertex3i, 3, arg0, arg1, arg2);
+    glad_glVertex3i(arg0, arg1, arg2);
+    _post_call_callback("glVertex3i", (void*)glVertex3i, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEX3IPROC glad_debug_glVertex3i = glad_debug_impl_glVertex3i;
 PFNGLVERTEX3IVPROC glad_glVertex3iv = NULL;
+void APIENTRY glad_debug_impl_glVertex3iv(const GLint * arg0) {
+    _pre_call_callback("glVertex3iv", (void*)glVertex3iv, 1, arg0);
+    glad_glVertex3iv(arg0);
+    _post_call_callback("glVertex3iv", (void*)glVertex3iv, 1, arg0);
+}
+PFNGLVERTEX3IVPROC glad_debug_glVertex3iv = glad_debug_impl_glVertex3iv;
 PFNGLVERTEX3SPROC glad_glVertex3s = NULL;
+void APIENTRY glad_debug_impl_glVertex3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glVertex3s", (void*)glVertex3s, 3, arg0, arg1, arg2);
+    glad_glVertex3s(arg0, arg1, arg2);
+    _post_call_callback("glVertex3s", (void*)glVertex3s, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEX3SPROC glad_debug_glVertex3s = glad_debug_impl_glVertex3s;
 PFNGLVERTEX3SVPROC glad_glVertex3sv = NULL;
+void APIENTRY glad_debug_impl_glVertex3sv(const GLshort * arg0) {
+    _pre_call_callback("glVertex3sv", (void*)glVertex3sv, 1, arg0);
+    glad_glVertex3sv(arg0);
+    _post_call_callback("glVertex3sv", (void*)glVertex3sv, 1, arg0);
+}
+PFNGLVERTEX3SVPROC glad_debug_glVertex3sv = glad_debug_impl_glVertex3sv;
 PFNGLVERTEX4DPROC glad_glVertex4d = NULL;
+void APIENTRY glad_debug_impl_glVertex4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+    _pre_call_callback("glVertex4d", (void*)glVertex4d, 4, arg0, arg1, arg2, arg3);
+    glad_glVertex4d(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertex4d", (void*)glVertex4d, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEX4DPROC glad_debug_glVertex4d = glad_debug_impl_glVertex4d;
 PFNGLVERTEX4DVPROC glad_glVertex4dv = NULL;
+void APIENTRY glad_debug_impl_glVertex4dv(const GLdouble * arg0) {
+    _pre_call_callback("glVertex4dv", (void*)glVertex4dv, 1, arg0);
+    glad_glVertex4dv(arg0);
+    _post_call_callback("glVertex4dv", (void*)glVertex4dv, 1, arg0);
+}
+PFNGLVERTEX4DVPROC glad_debug_glVertex4dv = glad_debug_impl_glVertex4dv;
 PFNGLVERTEX4FPROC glad_glVertex4f = NULL;
+void APIENTRY glad_debug_impl_glVertex4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glVertex4f", (void*)glVertex4f, 4, arg0, arg1, arg2, arg3);
+    glad_glVertex4f(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertex4f", (void*)glVertex4f, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEX4FPROC glad_debug_glVertex4f = glad_debug_impl_glVertex4f;
 PFNGLVERTEX4FVPROC glad_glVertex4fv = NULL;
+void APIENTRY glad_debug_impl_glVertex4fv(const GLfloat * arg0) {
+    _pre_call_callback("glVertex4fv", (void*)glVertex4fv, 1, arg0);
+    glad_glVertex4fv(arg0);
+    _post_call_callback("glVertex4fv", (void*)glVertex4fv, 1, arg0);
+}
+PFNGLVERTEX4FVPROC glad_debug_glVertex4fv = glad_debug_impl_glVertex4fv;
 PFNGLVERTEX4IPROC glad_glVertex4i = NULL;
+void APIENTRY glad_debug_impl_glVertex4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glVertex4i", (void*)glVertex4i, 4, arg0, arg1, arg2, arg3);
+    glad_glVertex4i(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertex4i", (void*)glVertex4i, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEX4IPROC glad_debug_glVertex4i = glad_debug_impl_glVertex4i;
 PFNGLVERTEX4IVPROC glad_glVertex4iv = NULL;
+void APIENTRY glad_debug_impl_glVertex4iv(const GLint * arg0) {
+    _pre_call_callback("glVertex4iv", (void*)glVertex4iv, 1, arg0);
+    glad_glVertex4iv(arg0);
+    _post_call_callback("glVertex4iv", (void*)glVertex4iv, 1, arg0);
+}
+PFNGLVERTEX4IVPROC glad_debug_glVertex4iv = glad_debug_impl_glVertex4iv;
 PFNGLVERTEX4SPROC glad_glVertex4s = NULL;
+void APIENTRY glad_debug_impl_glVertex4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+    _pre_call_callback("glVertex4s", (void*)glVertex4s, 4, arg0, arg1, arg2, arg3);
+    glad_glVertex4s(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertex4s", (void*)glVertex4s, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEX4SPROC glad_debug_glVertex4s = glad_debug_impl_glVertex4s;
 PFNGLVERTEX4SVPROC glad_glVertex4sv = NULL;
+void APIENTRY glad_debug_impl_glVertex4sv(const GLshort * arg0) {
+    _pre_call_callback("glVertex4sv", (void*)glVertex4sv, 1, arg0);
+    glad_glVertex4sv(arg0);
+    _post_call_callback("glVertex4sv", (void*)glVertex4sv, 1, arg0);
+}
+PFNGLVERTEX4SVPROC glad_debug_glVertex4sv = glad_debug_impl_glVertex4sv;
 PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib1d(GLuint arg0, GLdouble arg1) {
+    _pre_call_callback("glVertexAttrib1d", (void*)glVertexAttrib1d, 2, arg0, arg1);
+    glad_glVertexAttrib1d(arg0, arg1);
+    _post_call_callback("glVertexAttrib1d", (void*)glVertexAttrib1d, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1DPROC glad_debug_glVertexAttrib1d = glad_debug_impl_glVertexAttrib1d;
 PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib1dv(GLuint arg0, const GLdouble * arg1) {
+    _pre_call_callback("glVertexAttrib1dv", (void*)glVertexAttrib1dv, 2, arg0, arg1);
+    glad_glVertexAttrib1dv(arg0, arg1);
+    _post_call_callback("glVertexAttrib1dv", (void*)glVertexAttrib1dv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1DVPROC glad_debug_glVertexAttrib1dv = glad_debug_impl_glVertexAttrib1dv;
 PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib1f(GLuint arg0, GLfloat arg1) {
+    _pre_call_callback("glVertexAttrib1f", (void*)glVertexAttrib1f, 2, arg0, arg1);
+    glad_glVertexAttrib1f(arg0, arg1);
+    _post_call_callback("glVertexAttrib1f", (void*)glVertexAttrib1f, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1FPROC glad_debug_glVertexAttrib1f = glad_debug_impl_glVertexAttrib1f;
 PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib1fv(GLuint arg0, const GLfloat * arg1) {
+    _pre_call_callback("glVertexAttrib1fv", (void*)glVertexAttrib1fv, 2, arg0, arg1);
+    glad_glVertexAttrib1fv(arg0, arg1);
+    _post_call_callback("glVertexAttrib1fv", (void*)glVertexAttrib1fv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1FVPROC glad_debug_glVertexAttrib1fv = glad_debug_impl_glVertexAttrib1fv;
 PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib1s(GLuint arg0, GLshort arg1) {
+    _pre_call_callback("glVertexAttrib1s", (void*)glVertexAttrib1s, 2, arg0, arg1);
+    glad_glVertexAttrib1s(arg0, arg1);
+    _post_call_callback("glVertexAttrib1s", (void*)glVertexAttrib1s, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1SPROC glad_debug_glVertexAttrib1s = glad_debug_impl_glVertexAttrib1s;
 PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib1sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib1sv", (void*)glVertexAttrib1sv, 2, arg0, arg1);
+    glad_glVertexAttrib1sv(arg0, arg1);
+    _post_call_callback("glVertexAttrib1sv", (void*)glVertexAttrib1sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB1SVPROC glad_debug_glVertexAttrib1sv = glad_debug_impl_glVertexAttrib1sv;
 PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glVertexAttrib2d", (void*)glVertexAttrib2d, 3, arg0, arg1, arg2);
+    glad_glVertexAttrib2d(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttrib2d", (void*)glVertexAttrib2d, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIB2DPROC glad_debug_glVertexAttrib2d = glad_debug_impl_glVertexAttrib2d;
 PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib2dv(GLuint arg0, const GLdouble * arg1) {
+    _pre_call_callback("glVertexAttrib2dv", (void*)glVertexAttrib2dv, 2, arg0, arg1);
+    glad_glVertexAttrib2dv(arg0, arg1);
+    _post_call_callback("glVertexAttrib2dv", (void*)glVertexAttrib2dv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB2DVPROC glad_debug_glVertexAttrib2dv = glad_debug_impl_glVertexAttrib2dv;
 PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib2f(GLuint arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glVertexAttrib2f", (void*)glVertexAttrib2f, 3, arg0, arg1, arg2);
+    glad_glVertexAttrib2f(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttrib2f", (void*)glVertexAttrib2f, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIB2FPROC glad_debug_glVertexAttrib2f = glad_debug_impl_glVertexAttrib2f;
 PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib2fv(GLuint arg0, const GLfloat * arg1) {
+    _pre_call_callback("glVertexAttrib2fv", (void*)glVertexAttrib2fv, 2, arg0, arg1);
+    glad_glVertexAttrib2fv(arg0, arg1);
+    _post_call_callback("glVertexAttrib2fv", (void*)glVertexAttrib2fv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB2FVPROC glad_debug_glVertexAttrib2fv = glad_debug_impl_glVertexAttrib2fv;
 PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib2s(GLuint arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glVertexAttrib2s", (void*)glVertexAttrib2s, 3, arg0, arg1, arg2);
+    glad_glVertexAttrib2s(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttrib2s", (void*)glVertexAttrib2s, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIB2SPROC glad_debug_glVertexAttrib2s = glad_debug_impl_glVertexAttrib2s;
 PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib2sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib2sv", (void*)glVertexAttrib2sv, 2, arg0, arg1);
+    glad_glVertexAttrib2sv(arg0, arg1);
+    _post_call_callback("glVertexAttrib2sv", (void*)glVertexAttrib2sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB2SVPROC glad_debug_glVertexAttrib2sv = glad_debug_impl_glVertexAttrib2sv;
 PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+    _pre_call_callback("glVertexAttrib3d", (void*)glVertexAttrib3d, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttrib3d(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttrib3d", (void*)glVertexAttrib3d, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIB3DPROC glad_debug_glVertexAttrib3d = glad_debug_impl_glVertexAttrib3d;
 PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib3dv(GLuint arg0, const GLdouble * arg1) {
+    _pre_call_callback("glVertexAttrib3dv", (void*)glVertexAttrib3dv, 2, arg0, arg1);
+    glad_glVertexAttrib3dv(arg0, arg1);
+    _post_call_callback("glVertexAttrib3dv", (void*)glVertexAttrib3dv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB3DVPROC glad_debug_glVertexAttrib3dv = glad_debug_impl_glVertexAttrib3dv;
 PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib3f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+    _pre_call_callback("glVertexAttrib3f", (void*)glVertexAttrib3f, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttrib3f(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttrib3f", (void*)glVertexAttrib3f, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIB3FPROC glad_debug_glVertexAttrib3f = glad_debug_impl_glVertexAttrib3f;
 PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib3fv(GLuint arg0, const GLfloat * arg1) {
+    _pre_call_callback("glVertexAttrib3fv", (void*)glVertexAttrib3fv, 2, arg0, arg1);
+    glad_glVertexAttrib3fv(arg0, arg1);
+    _post_call_callback("glVertexAttrib3fv", (void*)glVertexAttrib3fv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB3FVPROC glad_debug_glVertexAttrib3fv = glad_debug_impl_glVertexAttrib3fv;
 PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib3s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+    _pre_call_callback("glVertexAttrib3s", (void*)glVertexAttrib3s, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttrib3s(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttrib3s", (void*)glVertexAttrib3s, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIB3SPROC glad_debug_glVertexAttrib3s = glad_debug_impl_glVertexAttrib3s;
 PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib3sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib3sv", (void*)glVertexAttrib3sv, 2, arg0, arg1);
+    glad_glVertexAttrib3sv(arg0, arg1);
+    _post_call_callback("glVertexAttrib3sv", (void*)glVertexAttrib3sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB3SVPROC glad_debug_glVertexAttrib3sv = glad_debug_impl_glVertexAttrib3sv;
 PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4Nbv(GLuint arg0, const GLbyte * arg1) {
+    _pre_call_callback("glVertexAttrib4Nbv", (void*)glVertexAttrib4Nbv, 2, arg0, arg1);
+    glad_glVertexAttrib4Nbv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nbv", (void*)glVertexAttrib4Nbv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NBVPROC glad_debug_glVertexAttrib4Nbv = glad_debug_impl_glVertexAttrib4Nbv;
 PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4Niv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttrib4Niv", (void*)glVertexAttrib4Niv, 2, arg0, arg1);
+    glad_glVertexAttrib4Niv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Niv", (void*)glVertexAttrib4Niv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NIVPROC glad_debug_glVertexAttrib4Niv = glad_debug_impl_glVertexAttrib4Niv;
 PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4Nsv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib4Nsv", (void*)glVertexAttrib4Nsv, 2, arg0, arg1);
+    glad_glVertexAttrib4Nsv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nsv", (void*)glVertexAttrib4Nsv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NSVPROC glad_debug_glVertexAttrib4Nsv = glad_debug_impl_glVertexAttrib4Nsv;
 PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4Nub(GLuint arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3, GLubyte arg4) {
+    _pre_call_callback("glVertexAttrib4Nub", (void*)glVertexAttrib4Nub, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glVertexAttrib4Nub(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttrib4Nub", (void*)glVertexAttrib4Nub, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIB4NUBPROC glad_debug_glVertexAttrib4Nub = glad_debug_impl_glVertexAttrib4Nub;
 PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4Nubv(GLuint arg0, const GLubyte * arg1) {
+    _pre_call_callback("glVertexAttrib4Nubv", (void*)glVertexAttrib4Nubv, 2, arg0, arg1);
+    glad_glVertexAttrib4Nubv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nubv", (void*)glVertexAttrib4Nubv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NUBVPROC glad_debug_glVertexAttrib4Nubv = glad_debug_impl_glVertexAttrib4Nubv;
 PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4Nuiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttrib4Nuiv", (void*)glVertexAttrib4Nuiv, 2, arg0, arg1);
+    glad_glVertexAttrib4Nuiv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nuiv", (void*)glVertexAttrib4Nuiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NUIVPROC glad_debug_glVertexAttrib4Nuiv = glad_debug_impl_glVertexAttrib4Nuiv;
 PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4Nusv(GLuint arg0, const GLushort * arg1) {
+    _pre_call_callback("glVertexAttrib4Nusv", (void*)glVertexAttrib4Nusv, 2, arg0, arg1);
+    glad_glVertexAttrib4Nusv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4Nusv", (void*)glVertexAttrib4Nusv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4NUSVPROC glad_debug_glVertexAttrib4Nusv = glad_debug_impl_glVertexAttrib4Nusv;
 PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4bv(GLuint arg0, const GLbyte * arg1) {
+    _pre_call_callback("glVertexAttrib4bv", (void*)glVertexAttrib4bv, 2, arg0, arg1);
+    glad_glVertexAttrib4bv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4bv", (void*)glVertexAttrib4bv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4BVPROC glad_debug_glVertexAttrib4bv = glad_debug_impl_glVertexAttrib4bv;
 PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+    _pre_call_callback("glVertexAttrib4d", (void*)glVertexAttrib4d, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glVertexAttrib4d(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttrib4d", (void*)glVertexAttrib4d, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIB4DPROC glad_debug_glVertexAttrib4d = glad_debug_impl_glVertexAttrib4d;
 PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4dv(GLuint arg0, const GLdouble * arg1) {
+    _pre_call_callback("glVertexAttrib4dv", (void*)glVertexAttrib4dv, 2, arg0, arg1);
+    glad_glVertexAttrib4dv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4dv", (void*)glVertexAttrib4dv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4DVPROC glad_debug_glVertexAttrib4dv = glad_debug_impl_glVertexAttrib4dv;
 PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+    _pre_call_callback("glVertexAttrib4f", (void*)glVertexAttrib4f, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glVertexAttrib4f(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttrib4f", (void*)glVertexAttrib4f, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIB4FPROC glad_debug_glVertexAttrib4f = glad_debug_impl_glVertexAttrib4f;
 PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4fv(GLuint arg0, const GLfloat * arg1) {
+    _pre_call_callback("glVertexAttrib4fv", (void*)glVertexAttrib4fv, 2, arg0, arg1);
+    glad_glVertexAttrib4fv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4fv", (void*)glVertexAttrib4fv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4FVPROC glad_debug_glVertexAttrib4fv = glad_debug_impl_glVertexAttrib4fv;
 PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttrib4iv", (void*)glVertexAttrib4iv, 2, arg0, arg1);
+    glad_glVertexAttrib4iv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4iv", (void*)glVertexAttrib4iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4IVPROC glad_debug_glVertexAttrib4iv = glad_debug_impl_glVertexAttrib4iv;
 PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+    _pre_call_callback("glVertexAttrib4s", (void*)glVertexAttrib4s, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glVertexAttrib4s(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttrib4s", (void*)glVertexAttrib4s, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIB4SPROC glad_debug_glVertexAttrib4s = glad_debug_impl_glVertexAttrib4s;
 PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttrib4sv", (void*)glVertexAttrib4sv, 2, arg0, arg1);
+    glad_glVertexAttrib4sv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4sv", (void*)glVertexAttrib4sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4SVPROC glad_debug_glVertexAttrib4sv = glad_debug_impl_glVertexAttrib4sv;
 PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4ubv(GLuint arg0, const GLubyte * arg1) {
+    _pre_call_callback("glVertexAttrib4ubv", (void*)glVertexAttrib4ubv, 2, arg0, arg1);
+    glad_glVertexAttrib4ubv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4ubv", (void*)glVertexAttrib4ubv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4UBVPROC glad_debug_glVertexAttrib4ubv = glad_debug_impl_glVertexAttrib4ubv;
 PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttrib4uiv", (void*)glVertexAttrib4uiv, 2, arg0, arg1);
+    glad_glVertexAttrib4uiv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4uiv", (void*)glVertexAttrib4uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4UIVPROC glad_debug_glVertexAttrib4uiv = glad_debug_impl_glVertexAttrib4uiv;
 PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttrib4usv(GLuint arg0, const GLushort * arg1) {
+    _pre_call_callback("glVertexAttrib4usv", (void*)glVertexAttrib4usv, 2, arg0, arg1);
+    glad_glVertexAttrib4usv(arg0, arg1);
+    _post_call_callback("glVertexAttrib4usv", (void*)glVertexAttrib4usv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIB4USVPROC glad_debug_glVertexAttrib4usv = glad_debug_impl_glVertexAttrib4usv;
 PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribDivisor(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glVertexAttribDivisor", (void*)glVertexAttribDivisor, 2, arg0, arg1);
+    glad_glVertexAttribDivisor(arg0, arg1);
+    _post_call_callback("glVertexAttribDivisor", (void*)glVertexAttribDivisor, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBDIVISORPROC glad_debug_glVertexAttribDivisor = glad_debug_impl_glVertexAttribDivisor;
 PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI1i(GLuint arg0, GLint arg1) {
+    _pre_call_callback("glVertexAttribI1i", (void*)glVertexAttribI1i, 2, arg0, arg1);
+    glad_glVertexAttribI1i(arg0, arg1);
+    _post_call_callback("glVertexAttribI1i", (void*)glVertexAttribI1i, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI1IPROC glad_debug_glVertexAttribI1i = glad_debug_impl_glVertexAttribI1i;
 PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI1iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttribI1iv", (void*)glVertexAttribI1iv, 2, arg0, arg1);
+    glad_glVertexAttribI1iv(arg0, arg1);
+    _post_call_callback("glVertexAttribI1iv", (void*)glVertexAttribI1iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI1IVPROC glad_debug_glVertexAttribI1iv = glad_debug_impl_glVertexAttribI1iv;
 PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI1ui(GLuint arg0, GLuint arg1) {
+    _pre_call_callback("glVertexAttribI1ui", (void*)glVertexAttribI1ui, 2, arg0, arg1);
+    glad_glVertexAttribI1ui(arg0, arg1);
+    _post_call_callback("glVertexAttribI1ui", (void*)glVertexAttribI1ui, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI1UIPROC glad_debug_glVertexAttribI1ui = glad_debug_impl_glVertexAttribI1ui;
 PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI1uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttribI1uiv", (void*)glVertexAttribI1uiv, 2, arg0, arg1);
+    glad_glVertexAttribI1uiv(arg0, arg1);
+    _post_call_callback("glVertexAttribI1uiv", (void*)glVertexAttribI1uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI1UIVPROC glad_debug_glVertexAttribI1uiv = glad_debug_impl_glVertexAttribI1uiv;
 PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI2i(GLuint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glVertexAttribI2i", (void*)glVertexAttribI2i, 3, arg0, arg1, arg2);
+    glad_glVertexAttribI2i(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttribI2i", (void*)glVertexAttribI2i, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIBI2IPROC glad_debug_glVertexAttribI2i = glad_debug_impl_glVertexAttribI2i;
 PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI2iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttribI2iv", (void*)glVertexAttribI2iv, 2, arg0, arg1);
+    glad_glVertexAttribI2iv(arg0, arg1);
+    _post_call_callback("glVertexAttribI2iv", (void*)glVertexAttribI2iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI2IVPROC glad_debug_glVertexAttribI2iv = glad_debug_impl_glVertexAttribI2iv;
 PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI2ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+    _pre_call_callback("glVertexAttribI2ui", (void*)glVertexAttribI2ui, 3, arg0, arg1, arg2);
+    glad_glVertexAttribI2ui(arg0, arg1, arg2);
+    _post_call_callback("glVertexAttribI2ui", (void*)glVertexAttribI2ui, 3, arg0, arg1, arg2);
+}
+PFNGLVERTEXATTRIBI2UIPROC glad_debug_glVertexAttribI2ui = glad_debug_impl_glVertexAttribI2ui;
 PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI2uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttribI2uiv", (void*)glVertexAttribI2uiv, 2, arg0, arg1);
+    glad_glVertexAttribI2uiv(arg0, arg1);
+    _post_call_callback("glVertexAttribI2uiv", (void*)glVertexAttribI2uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI2UIVPROC glad_debug_glVertexAttribI2uiv = glad_debug_impl_glVertexAttribI2uiv;
 PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+    _pre_call_callback("glVertexAttribI3i", (void*)glVertexAttribI3i, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribI3i(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribI3i", (void*)glVertexAttribI3i, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBI3IPROC glad_debug_glVertexAttribI3i = glad_debug_impl_glVertexAttribI3i;
 PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI3iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttribI3iv", (void*)glVertexAttribI3iv, 2, arg0, arg1);
+    glad_glVertexAttribI3iv(arg0, arg1);
+    _post_call_callback("glVertexAttribI3iv", (void*)glVertexAttribI3iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI3IVPROC glad_debug_glVertexAttribI3iv = glad_debug_impl_glVertexAttribI3iv;
 PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI3ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribI3ui", (void*)glVertexAttribI3ui, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribI3ui(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribI3ui", (void*)glVertexAttribI3ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBI3UIPROC glad_debug_glVertexAttribI3ui = glad_debug_impl_glVertexAttribI3ui;
 PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI3uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttribI3uiv", (void*)glVertexAttribI3uiv, 2, arg0, arg1);
+    glad_glVertexAttribI3uiv(arg0, arg1);
+    _post_call_callback("glVertexAttribI3uiv", (void*)glVertexAttribI3uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI3UIVPROC glad_debug_glVertexAttribI3uiv = glad_debug_impl_glVertexAttribI3uiv;
 PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI4bv(GLuint arg0, const GLbyte * arg1) {
+    _pre_call_callback("glVertexAttribI4bv", (void*)glVertexAttribI4bv, 2, arg0, arg1);
+    glad_glVertexAttribI4bv(arg0, arg1);
+    _post_call_callback("glVertexAttribI4bv", (void*)glVertexAttribI4bv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4BVPROC glad_debug_glVertexAttribI4bv = glad_debug_impl_glVertexAttribI4bv;
 PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+    _pre_call_callback("glVertexAttribI4i", (void*)glVertexAttribI4i, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glVertexAttribI4i(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttribI4i", (void*)glVertexAttribI4i, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIBI4IPROC glad_debug_glVertexAttribI4i = glad_debug_impl_glVertexAttribI4i;
 PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI4iv(GLuint arg0, const GLint * arg1) {
+    _pre_call_callback("glVertexAttribI4iv", (void*)glVertexAttribI4iv, 2, arg0, arg1);
+    glad_glVertexAttribI4iv(arg0, arg1);
+    _post_call_callback("glVertexAttribI4iv", (void*)glVertexAttribI4iv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4IVPROC glad_debug_glVertexAttribI4iv = glad_debug_impl_glVertexAttribI4iv;
 PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI4sv(GLuint arg0, const GLshort * arg1) {
+    _pre_call_callback("glVertexAttribI4sv", (void*)glVertexAttribI4sv, 2, arg0, arg1);
+    glad_glVertexAttribI4sv(arg0, arg1);
+    _post_call_callback("glVertexAttribI4sv", (void*)glVertexAttribI4sv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4SVPROC glad_debug_glVertexAttribI4sv = glad_debug_impl_glVertexAttribI4sv;
 PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI4ubv(GLuint arg0, const GLubyte * arg1) {
+    _pre_call_callback("glVertexAttribI4ubv", (void*)glVertexAttribI4ubv, 2, arg0, arg1);
+    glad_glVertexAttribI4ubv(arg0, arg1);
+    _post_call_callback("glVertexAttribI4ubv", (void*)glVertexAttribI4ubv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4UBVPROC glad_debug_glVertexAttribI4ubv = glad_debug_impl_glVertexAttribI4ubv;
 PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+    _pre_call_callback("glVertexAttribI4ui", (void*)glVertexAttribI4ui, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glVertexAttribI4ui(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttribI4ui", (void*)glVertexAttribI4ui, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIBI4UIPROC glad_debug_glVertexAttribI4ui = glad_debug_impl_glVertexAttribI4ui;
 PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI4uiv(GLuint arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexAttribI4uiv", (void*)glVertexAttribI4uiv, 2, arg0, arg1);
+    glad_glVertexAttribI4uiv(arg0, arg1);
+    _post_call_callback("glVertexAttribI4uiv", (void*)glVertexAttribI4uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4UIVPROC glad_debug_glVertexAttribI4uiv = glad_debug_impl_glVertexAttribI4uiv;
 PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribI4usv(GLuint arg0, const GLushort * arg1) {
+    _pre_call_callback("glVertexAttribI4usv", (void*)glVertexAttribI4usv, 2, arg0, arg1);
+    glad_glVertexAttribI4usv(arg0, arg1);
+    _post_call_callback("glVertexAttribI4usv", (void*)glVertexAttribI4usv, 2, arg0, arg1);
+}
+PFNGLVERTEXATTRIBI4USVPROC glad_debug_glVertexAttribI4usv = glad_debug_impl_glVertexAttribI4usv;
 PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribIPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+    _pre_call_callback("glVertexAttribIPointer", (void*)glVertexAttribIPointer, 5, arg0, arg1, arg2, arg3, arg4);
+    glad_glVertexAttribIPointer(arg0, arg1, arg2, arg3, arg4);
+    _post_call_callback("glVertexAttribIPointer", (void*)glVertexAttribIPointer, 5, arg0, arg1, arg2, arg3, arg4);
+}
+PFNGLVERTEXATTRIBIPOINTERPROC glad_debug_glVertexAttribIPointer = glad_debug_impl_glVertexAttribIPointer;
 PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribP1ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribP1ui", (void*)glVertexAttribP1ui, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribP1ui(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP1ui", (void*)glVertexAttribP1ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP1UIPROC glad_debug_glVertexAttribP1ui = glad_debug_impl_glVertexAttribP1ui;
 PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribP1uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+    _pre_call_callback("glVertexAttribP1uiv", (void*)glVertexAttribP1uiv, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribP1uiv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP1uiv", (void*)glVertexAttribP1uiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP1UIVPROC glad_debug_glVertexAttribP1uiv = glad_debug_impl_glVertexAttribP1uiv;
 PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribP2ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribP2ui", (void*)glVertexAttribP2ui, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribP2ui(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP2ui", (void*)glVertexAttribP2ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP2UIPROC glad_debug_glVertexAttribP2ui = glad_debug_impl_glVertexAttribP2ui;
 PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribP2uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+    _pre_call_callback("glVertexAttribP2uiv", (void*)glVertexAttribP2uiv, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribP2uiv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP2uiv", (void*)glVertexAttribP2uiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP2UIVPROC glad_debug_glVertexAttribP2uiv = glad_debug_impl_glVertexAttribP2uiv;
 PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribP3ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribP3ui", (void*)glVertexAttribP3ui, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribP3ui(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP3ui", (void*)glVertexAttribP3ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP3UIPROC glad_debug_glVertexAttribP3ui = glad_debug_impl_glVertexAttribP3ui;
 PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribP3uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+    _pre_call_callback("glVertexAttribP3uiv", (void*)glVertexAttribP3uiv, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribP3uiv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP3uiv", (void*)glVertexAttribP3uiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP3UIVPROC glad_debug_glVertexAttribP3uiv = glad_debug_impl_glVertexAttribP3uiv;
 PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribP4ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+    _pre_call_callback("glVertexAttribP4ui", (void*)glVertexAttribP4ui, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribP4ui(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP4ui", (void*)glVertexAttribP4ui, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP4UIPROC glad_debug_glVertexAttribP4ui = glad_debug_impl_glVertexAttribP4ui;
 PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribP4uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+    _pre_call_callback("glVertexAttribP4uiv", (void*)glVertexAttribP4uiv, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexAttribP4uiv(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexAttribP4uiv", (void*)glVertexAttribP4uiv, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXATTRIBP4UIVPROC glad_debug_glVertexAttribP4uiv = glad_debug_impl_glVertexAttribP4uiv;
 PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
+void APIENTRY glad_debug_impl_glVertexAttribPointer(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLsizei arg4, const void * arg5) {
+    _pre_call_callback("glVertexAttribPointer", (void*)glVertexAttribPointer, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+    glad_glVertexAttribPointer(arg0, arg1, arg2, arg3, arg4, arg5);
+    _post_call_callback("glVertexAttribPointer", (void*)glVertexAttribPointer, 6, arg0, arg1, arg2, arg3, arg4, arg5);
+}
+PFNGLVERTEXATTRIBPOINTERPROC glad_debug_glVertexAttribPointer = glad_debug_impl_glVertexAttribPointer;
 PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
+void APIENTRY glad_debug_impl_glVertexP2ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glVertexP2ui", (void*)glVertexP2ui, 2, arg0, arg1);
+    glad_glVertexP2ui(arg0, arg1);
+    _post_call_callback("glVertexP2ui", (void*)glVertexP2ui, 2, arg0, arg1);
+}
+PFNGLVERTEXP2UIPROC glad_debug_glVertexP2ui = glad_debug_impl_glVertexP2ui;
 PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexP2uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexP2uiv", (void*)glVertexP2uiv, 2, arg0, arg1);
+    glad_glVertexP2uiv(arg0, arg1);
+    _post_call_callback("glVertexP2uiv", (void*)glVertexP2uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXP2UIVPROC glad_debug_glVertexP2uiv = glad_debug_impl_glVertexP2uiv;
 PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
+void APIENTRY glad_debug_impl_glVertexP3ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glVertexP3ui", (void*)glVertexP3ui, 2, arg0, arg1);
+    glad_glVertexP3ui(arg0, arg1);
+    _post_call_callback("glVertexP3ui", (void*)glVertexP3ui, 2, arg0, arg1);
+}
+PFNGLVERTEXP3UIPROC glad_debug_glVertexP3ui = glad_debug_impl_glVertexP3ui;
 PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexP3uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexP3uiv", (void*)glVertexP3uiv, 2, arg0, arg1);
+    glad_glVertexP3uiv(arg0, arg1);
+    _post_call_callback("glVertexP3uiv", (void*)glVertexP3uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXP3UIVPROC glad_debug_glVertexP3uiv = glad_debug_impl_glVertexP3uiv;
 PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
+void APIENTRY glad_debug_impl_glVertexP4ui(GLenum arg0, GLuint arg1) {
+    _pre_call_callback("glVertexP4ui", (void*)glVertexP4ui, 2, arg0, arg1);
+    glad_glVertexP4ui(arg0, arg1);
+    _post_call_callback("glVertexP4ui", (void*)glVertexP4ui, 2, arg0, arg1);
+}
+PFNGLVERTEXP4UIPROC glad_debug_glVertexP4ui = glad_debug_impl_glVertexP4ui;
 PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
+void APIENTRY glad_debug_impl_glVertexP4uiv(GLenum arg0, const GLuint * arg1) {
+    _pre_call_callback("glVertexP4uiv", (void*)glVertexP4uiv, 2, arg0, arg1);
+    glad_glVertexP4uiv(arg0, arg1);
+    _post_call_callback("glVertexP4uiv", (void*)glVertexP4uiv, 2, arg0, arg1);
+}
+PFNGLVERTEXP4UIVPROC glad_debug_glVertexP4uiv = glad_debug_impl_glVertexP4uiv;
 PFNGLVERTEXPOINTERPROC glad_glVertexPointer = NULL;
+void APIENTRY glad_debug_impl_glVertexPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+    _pre_call_callback("glVertexPointer", (void*)glVertexPointer, 4, arg0, arg1, arg2, arg3);
+    glad_glVertexPointer(arg0, arg1, arg2, arg3);
+    _post_call_callback("glVertexPointer", (void*)glVertexPointer, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVERTEXPOINTERPROC glad_debug_glVertexPointer = glad_debug_impl_glVertexPointer;
 PFNGLVIEWPORTPROC glad_glViewport = NULL;
+void APIENTRY glad_debug_impl_glViewport(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+    _pre_call_callback("glViewport", (void*)glViewport, 4, arg0, arg1, arg2, arg3);
+    glad_glViewport(arg0, arg1, arg2, arg3);
+    _post_call_callback("glViewport", (void*)glViewport, 4, arg0, arg1, arg2, arg3);
+}
+PFNGLVIEWPORTPROC glad_debug_glViewport = glad_debug_impl_glViewport;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+void APIENTRY glad_debug_impl_glWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+    _pre_call_callback("glWaitSync", (void*)glWaitSync, 3, arg0, arg1, arg2);
+    glad_glWaitSync(arg0, arg1, arg2);
+    _post_call_callback("glWaitSync", (void*)glWaitSync, 3, arg0, arg1, arg2);
+}
+PFNGLWAITSYNCPROC glad_debug_glWaitSync = glad_debug_impl_glWaitSync;
 PFNGLWINDOWPOS2DPROC glad_glWindowPos2d = NULL;
+void APIENTRY glad_debug_impl_glWindowPos2d(GLdouble arg0, GLdouble arg1) {
+    _pre_call_callback("glWindowPos2d", (void*)glWindowPos2d, 2, arg0, arg1);
+    glad_glWindowPos2d(arg0, arg1);
+    _post_call_callback("glWindowPos2d", (void*)glWindowPos2d, 2, arg0, arg1);
+}
+PFNGLWINDOWPOS2DPROC glad_debug_glWindowPos2d = glad_debug_impl_glWindowPos2d;
 PFNGLWINDOWPOS2DVPROC glad_glWindowPos2dv = NULL;
+void APIENTRY glad_debug_impl_glWindowPos2dv(const GLdouble * arg0) {
+    _pre_call_callback("glWindowPos2dv", (void*)glWindowPos2dv, 1, arg0);
+    glad_glWindowPos2dv(arg0);
+    _post_call_callback("glWindowPos2dv", (void*)glWindowPos2dv, 1, arg0);
+}
+PFNGLWINDOWPOS2DVPROC glad_debug_glWindowPos2dv = glad_debug_impl_glWindowPos2dv;
 PFNGLWINDOWPOS2FPROC glad_glWindowPos2f = NULL;
+void APIENTRY glad_debug_impl_glWindowPos2f(GLfloat arg0, GLfloat arg1) {
+    _pre_call_callback("glWindowPos2f", (void*)glWindowPos2f, 2, arg0, arg1);
+    glad_glWindowPos2f(arg0, arg1);
+    _post_call_callback("glWindowPos2f", (void*)glWindowPos2f, 2, arg0, arg1);
+}
+PFNGLWINDOWPOS2FPROC glad_debug_glWindowPos2f = glad_debug_impl_glWindowPos2f;
 PFNGLWINDOWPOS2FVPROC glad_glWindowPos2fv = NULL;
+void APIENTRY glad_debug_impl_glWindowPos2fv(const GLfloat * arg0) {
+    _pre_call_callback("glWindowPos2fv", (void*)glWindowPos2fv, 1, arg0);
+    glad_glWindowPos2fv(arg0);
+    _post_call_callback("glWindowPos2fv", (void*)glWindowPos2fv, 1, arg0);
+}
+PFNGLWINDOWPOS2FVPROC glad_debug_glWindowPos2fv = glad_debug_impl_glWindowPos2fv;
 PFNGLWINDOWPOS2IPROC glad_glWindowPos2i = NULL;
+void APIENTRY glad_debug_impl_glWindowPos2i(GLint arg0, GLint arg1) {
+    _pre_call_callback("glWindowPos2i", (void*)glWindowPos2i, 2, arg0, arg1);
+    glad_glWindowPos2i(arg0, arg1);
+    _post_call_callback("glWindowPos2i", (void*)glWindowPos2i, 2, arg0, arg1);
+}
+PFNGLWINDOWPOS2IPROC glad_debug_glWindowPos2i = glad_debug_impl_glWindowPos2i;
 PFNGLWINDOWPOS2IVPROC glad_glWindowPos2iv = NULL;
+void APIENTRY glad_debug_impl_glWindowPos2iv(const GLint * arg0) {
+    _pre_call_callback("glWindowPos2iv", (void*)glWindowPos2iv, 1, arg0);
+    glad_glWindowPos2iv(arg0);
+    _post_call_callback("glWindowPos2iv", (void*)glWindowPos2iv, 1, arg0);
+}
+PFNGLWINDOWPOS2IVPROC glad_debug_glWindowPos2iv = glad_debug_impl_glWindowPos2iv;
 PFNGLWINDOWPOS2SPROC glad_glWindowPos2s = NULL;
+void APIENTRY glad_debug_impl_glWindowPos2s(GLshort arg0, GLshort arg1) {
+    _pre_call_callback("glWindowPos2s", (void*)glWindowPos2s, 2, arg0, arg1);
+    glad_glWindowPos2s(arg0, arg1);
+    _post_call_callback("glWindowPos2s", (void*)glWindowPos2s, 2, arg0, arg1);
+}
+PFNGLWINDOWPOS2SPROC glad_debug_glWindowPos2s = glad_debug_impl_glWindowPos2s;
 PFNGLWINDOWPOS2SVPROC glad_glWindowPos2sv = NULL;
+void APIENTRY glad_debug_impl_glWindowPos2sv(const GLshort * arg0) {
+    _pre_call_callback("glWindowPos2sv", (void*)glWindowPos2sv, 1, arg0);
+    glad_glWindowPos2sv(arg0);
+    _post_call_callback("glWindowPos2sv", (void*)glWindowPos2sv, 1, arg0);
+}
+PFNGLWINDOWPOS2SVPROC glad_debug_glWindowPos2sv = glad_debug_impl_glWindowPos2sv;
 PFNGLWINDOWPOS3DPROC glad_glWindowPos3d = NULL;
+void APIENTRY glad_debug_impl_glWindowPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+    _pre_call_callback("glWindowPos3d", (void*)glWindowPos3d, 3, arg0, arg1, arg2);
+    glad_glWindowPos3d(arg0, arg1, arg2);
+    _post_call_callback("glWindowPos3d", (void*)glWindowPos3d, 3, arg0, arg1, arg2);
+}
+PFNGLWINDOWPOS3DPROC glad_debug_glWindowPos3d = glad_debug_impl_glWindowPos3d;
 PFNGLWINDOWPOS3DVPROC glad_glWindowPos3dv = NULL;
+void APIENTRY glad_debug_impl_glWindowPos3dv(const GLdouble * arg0) {
+    _pre_call_callback("glWindowPos3dv", (void*)glWindowPos3dv, 1, arg0);
+    glad_glWindowPos3dv(arg0);
+    _post_call_callback("glWindowPos3dv", (void*)glWindowPos3dv, 1, arg0);
+}
+PFNGLWINDOWPOS3DVPROC glad_debug_glWindowPos3dv = glad_debug_impl_glWindowPos3dv;
 PFNGLWINDOWPOS3FPROC glad_glWindowPos3f = NULL;
+void APIENTRY glad_debug_impl_glWindowPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+    _pre_call_callback("glWindowPos3f", (void*)glWindowPos3f, 3, arg0, arg1, arg2);
+    glad_glWindowPos3f(arg0, arg1, arg2);
+    _post_call_callback("glWindowPos3f", (void*)glWindowPos3f, 3, arg0, arg1, arg2);
+}
+PFNGLWINDOWPOS3FPROC glad_debug_glWindowPos3f = glad_debug_impl_glWindowPos3f;
 PFNGLWINDOWPOS3FVPROC glad_glWindowPos3fv = NULL;
+void APIENTRY glad_debug_impl_glWindowPos3fv(const GLfloat * arg0) {
+    _pre_call_callback("glWindowPos3fv", (void*)glWindowPos3fv, 1, arg0);
+    glad_glWindowPos3fv(arg0);
+    _post_call_callback("glWindowPos3fv", (void*)glWindowPos3fv, 1, arg0);
+}
+PFNGLWINDOWPOS3FVPROC glad_debug_glWindowPos3fv = glad_debug_impl_glWindowPos3fv;
 PFNGLWINDOWPOS3IPROC glad_glWindowPos3i = NULL;
+void APIENTRY glad_debug_impl_glWindowPos3i(GLint arg0, GLint arg1, GLint arg2) {
+    _pre_call_callback("glWindowPos3i", (void*)glWindowPos3i, 3, arg0, arg1, arg2);
+    glad_glWindowPos3i(arg0, arg1, arg2);
+    _post_call_callback("glWindowPos3i", (void*)glWindowPos3i, 3, arg0, arg1, arg2);
+}
+PFNGLWINDOWPOS3IPROC glad_debug_glWindowPos3i = glad_debug_impl_glWindowPos3i;
 PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv = NULL;
+void APIENTRY glad_debug_impl_glWindowPos3iv(const GLint * arg0) {
+    _pre_call_callback("glWindowPos3iv", (void*)glWindowPos3iv, 1, arg0);
+    glad_glWindowPos3iv(arg0);
+    _post_call_callback("glWindowPos3iv", (void*)glWindowPos3iv, 1, arg0);
+}
+PFNGLWINDOWPOS3IVPROC glad_debug_glWindowPos3iv = glad_debug_impl_glWindowPos3iv;
 PFNGLWINDOWPOS3SPROC glad_glWindowPos3s = NULL;
+void APIENTRY glad_debug_impl_glWindowPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+    _pre_call_callback("glWindowPos3s", (void*)glWindowPos3s, 3, arg0, arg1, arg2);
+    glad_glWindowPos3s(arg0, arg1, arg2);
+    _post_call_callback("glWindowPos3s", (void*)glWindowPos3s, 3, arg0, arg1, arg2);
+}
+PFNGLWINDOWPOS3SPROC glad_debug_glWindowPos3s = glad_debug_impl_glWindowPos3s;
 PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv = NULL;
+void APIENTRY glad_debug_impl_glWindowPos3sv(const GLshort * arg0) {
+    _pre_call_callback("glWindowPos3sv", (void*)glWindowPos3sv, 1, arg0);
+    glad_glWindowPos3sv(arg0);
+    _post_call_callback("glWindowPos3sv", (void*)glWindowPos3sv, 1, arg0);
+}
+PFNGLWINDOWPOS3SVPROC glad_debug_glWindowPos3sv = glad_debug_impl_glWindowPos3sv;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1754,9 +6271,22 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_KHR_debug(GLADloadproc load) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+}
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
+	GLAD_GL_KHR_debug = has_ext("GL_KHR_debug");
 	free_exts();
 	return 1;
 }
@@ -1777,7 +6307,7 @@ static void find_coreGL(void) {
         NULL
     };
 
-    version = (const char*) glGetString(GL_VERSION);
+    version = (const char*) glad_glGetString(GL_VERSION);
     if (!version) return;
 
     for (i = 0;  prefixes[i];  i++) {
@@ -1815,11 +6345,1489 @@ static void find_coreGL(void) {
 	}
 }
 
+static int _glad_debug_installed = 0;
+
+void gladInstallGLDebug(void) {
+	glad_debug_glCullFace = glad_debug_impl_glCullFace;
+	glad_debug_glFrontFace = glad_debug_impl_glFrontFace;
+	glad_debug_glHint = glad_debug_impl_glHint;
+	glad_debug_glLineWidth = glad_debug_impl_glLineWidth;
+	glad_debug_glPointSize = glad_debug_impl_glPointSize;
+	glad_debug_glPolygonMode = glad_debug_impl_glPolygonMode;
+	glad_debug_glScissor = glad_debug_impl_glScissor;
+	glad_debug_glTexParameterf = glad_debug_impl_glTexParameterf;
+	glad_debug_glTexParameterfv = glad_debug_impl_glTexParameterfv;
+	glad_debug_glTexParameteri = glad_debug_impl_glTexParameteri;
+	glad_debug_glTexParameteriv = glad_debug_impl_glTexParameteriv;
+	glad_debug_glTexImage1D = glad_debug_impl_glTexImage1D;
+	glad_debug_glTexImage2D = glad_debug_impl_glTexImage2D;
+	glad_debug_glDrawBuffer = glad_debug_impl_glDrawBuffer;
+	glad_debug_glClear = glad_debug_impl_glClear;
+	glad_debug_glClearColor = glad_debug_impl_glClearColor;
+	glad_debug_glClearStencil = glad_debug_impl_glClearStencil;
+	glad_debug_glClearDepth = glad_debug_impl_glClearDepth;
+	glad_debug_glStencilMask = glad_debug_impl_glStencilMask;
+	glad_debug_glColorMask = glad_debug_impl_glColorMask;
+	glad_debug_glDepthMask = glad_debug_impl_glDepthMask;
+	glad_debug_glDisable = glad_debug_impl_glDisable;
+	glad_debug_glEnable = glad_debug_impl_glEnable;
+	glad_debug_glFinish = glad_debug_impl_glFinish;
+	glad_debug_glFlush = glad_debug_impl_glFlush;
+	glad_debug_glBlendFunc = glad_debug_impl_glBlendFunc;
+	glad_debug_glLogicOp = glad_debug_impl_glLogicOp;
+	glad_debug_glStencilFunc = glad_debug_impl_glStencilFunc;
+	glad_debug_glStencilOp = glad_debug_impl_glStencilOp;
+	glad_debug_glDepthFunc = glad_debug_impl_glDepthFunc;
+	glad_debug_glPixelStoref = glad_debug_impl_glPixelStoref;
+	glad_debug_glPixelStorei = glad_debug_impl_glPixelStorei;
+	glad_debug_glReadBuffer = glad_debug_impl_glReadBuffer;
+	glad_debug_glReadPixels = glad_debug_impl_glReadPixels;
+	glad_debug_glGetBooleanv = glad_debug_impl_glGetBooleanv;
+	glad_debug_glGetDoublev = glad_debug_impl_glGetDoublev;
+	glad_debug_glGetError = glad_debug_impl_glGetError;
+	glad_debug_glGetFloatv = glad_debug_impl_glGetFloatv;
+	glad_debug_glGetIntegerv = glad_debug_impl_glGetIntegerv;
+	glad_debug_glGetString = glad_debug_impl_glGetString;
+	glad_debug_glGetTexImage = glad_debug_impl_glGetTexImage;
+	glad_debug_glGetTexParameterfv = glad_debug_impl_glGetTexParameterfv;
+	glad_debug_glGetTexParameteriv = glad_debug_impl_glGetTexParameteriv;
+	glad_debug_glGetTexLevelParameterfv = glad_debug_impl_glGetTexLevelParameterfv;
+	glad_debug_glGetTexLevelParameteriv = glad_debug_impl_glGetTexLevelParameteriv;
+	glad_debug_glIsEnabled = glad_debug_impl_glIsEnabled;
+	glad_debug_glDepthRange = glad_debug_impl_glDepthRange;
+	glad_debug_glViewport = glad_debug_impl_glViewport;
+	glad_debug_glNewList = glad_debug_impl_glNewList;
+	glad_debug_glEndList = glad_debug_impl_glEndList;
+	glad_debug_glCallList = glad_debug_impl_glCallList;
+	glad_debug_glCallLists = glad_debug_impl_glCallLists;
+	glad_debug_glDeleteLists = glad_debug_impl_glDeleteLists;
+	glad_debug_glGenLists = glad_debug_impl_glGenLists;
+	glad_debug_glListBase = glad_debug_impl_glListBase;
+	glad_debug_glBegin = glad_debug_impl_glBegin;
+	glad_debug_glBitmap = glad_debug_impl_glBitmap;
+	glad_debug_glColor3b = glad_debug_impl_glColor3b;
+	glad_debug_glColor3bv = glad_debug_impl_glColor3bv;
+	glad_debug_glColor3d = glad_debug_impl_glColor3d;
+	glad_debug_glColor3dv = glad_debug_impl_glColor3dv;
+	glad_debug_glColor3f = glad_debug_impl_glColor3f;
+	glad_debug_glColor3fv = glad_debug_impl_glColor3fv;
+	glad_debug_glColor3i = glad_debug_impl_glColor3i;
+	glad_debug_glColor3iv = glad_debug_impl_glColor3iv;
+	glad_debug_glColor3s = glad_debug_impl_glColor3s;
+	glad_debug_glColor3sv = glad_debug_impl_glColor3sv;
+	glad_debug_glColor3ub = glad_debug_impl_glColor3ub;
+	glad_debug_glColor3ubv = glad_debug_impl_glColor3ubv;
+	glad_debug_glColor3ui = glad_debug_impl_glColor3ui;
+	glad_debug_glColor3uiv = glad_debug_impl_glColor3uiv;
+	glad_debug_glColor3us = glad_debug_impl_glColor3us;
+	glad_debug_glColor3usv = glad_debug_impl_glColor3usv;
+	glad_debug_glColor4b = glad_debug_impl_glColor4b;
+	glad_debug_glColor4bv = glad_debug_impl_glColor4bv;
+	glad_debug_glColor4d = glad_debug_impl_glColor4d;
+	glad_debug_glColor4dv = glad_debug_impl_glColor4dv;
+	glad_debug_glColor4f = glad_debug_impl_glColor4f;
+	glad_debug_glColor4fv = glad_debug_impl_glColor4fv;
+	glad_debug_glColor4i = glad_debug_impl_glColor4i;
+	glad_debug_glColor4iv = glad_debug_impl_glColor4iv;
+	glad_debug_glColor4s = glad_debug_impl_glColor4s;
+	glad_debug_glColor4sv = glad_debug_impl_glColor4sv;
+	glad_debug_glColor4ub = glad_debug_impl_glColor4ub;
+	glad_debug_glColor4ubv = glad_debug_impl_glColor4ubv;
+	glad_debug_glColor4ui = glad_debug_impl_glColor4ui;
+	glad_debug_glColor4uiv = glad_debug_impl_glColor4uiv;
+	glad_debug_glColor4us = glad_debug_impl_glColor4us;
+	glad_debug_glColor4usv = glad_debug_impl_glColor4usv;
+	glad_debug_glEdgeFlag = glad_debug_impl_glEdgeFlag;
+	glad_debug_glEdgeFlagv = glad_debug_impl_glEdgeFlagv;
+	glad_debug_glEnd = glad_debug_impl_glEnd;
+	glad_debug_glIndexd = glad_debug_impl_glIndexd;
+	glad_debug_glIndexdv = glad_debug_impl_glIndexdv;
+	glad_debug_glIndexf = glad_debug_impl_glIndexf;
+	glad_debug_glIndexfv = glad_debug_impl_glIndexfv;
+	glad_debug_glIndexi = glad_debug_impl_glIndexi;
+	glad_debug_glIndexiv = glad_debug_impl_glIndexiv;
+	glad_debug_glIndexs = glad_debug_impl_glIndexs;
+	glad_debug_glIndexsv = glad_debug_impl_glIndexsv;
+	glad_debug_glNormal3b = glad_debug_impl_glNormal3b;
+	glad_debug_glNormal3bv = glad_debug_impl_glNormal3bv;
+	glad_debug_glNormal3d = glad_debug_impl_glNormal3d;
+	glad_debug_glNormal3dv = glad_debug_impl_glNormal3dv;
+	glad_debug_glNormal3f = glad_debug_impl_glNormal3f;
+	glad_debug_glNormal3fv = glad_debug_impl_glNormal3fv;
+	glad_debug_glNormal3i = glad_debug_impl_glNormal3i;
+	glad_debug_glNormal3iv = glad_debug_impl_glNormal3iv;
+	glad_debug_glNormal3s = glad_debug_impl_glNormal3s;
+	glad_debug_glNormal3sv = glad_debug_impl_glNormal3sv;
+	glad_debug_glRasterPos2d = glad_debug_impl_glRasterPos2d;
+	glad_debug_glRasterPos2dv = glad_debug_impl_glRasterPos2dv;
+	glad_debug_glRasterPos2f = glad_debug_impl_glRasterPos2f;
+	glad_debug_glRasterPos2fv = glad_debug_impl_glRasterPos2fv;
+	glad_debug_glRasterPos2i = glad_debug_impl_glRasterPos2i;
+	glad_debug_glRasterPos2iv = glad_debug_impl_glRasterPos2iv;
+	glad_debug_glRasterPos2s = glad_debug_impl_glRasterPos2s;
+	glad_debug_glRasterPos2sv = glad_debug_impl_glRasterPos2sv;
+	glad_debug_glRasterPos3d = glad_debug_impl_glRasterPos3d;
+	glad_debug_glRasterPos3dv = glad_debug_impl_glRasterPos3dv;
+	glad_debug_glRasterPos3f = glad_debug_impl_glRasterPos3f;
+	glad_debug_glRasterPos3fv = glad_debug_impl_glRasterPos3fv;
+	glad_debug_glRasterPos3i = glad_debug_impl_glRasterPos3i;
+	glad_debug_glRasterPos3iv = glad_debug_impl_glRasterPos3iv;
+	glad_debug_glRasterPos3s = glad_debug_impl_glRasterPos3s;
+	glad_debug_glRasterPos3sv = glad_debug_impl_glRasterPos3sv;
+	glad_debug_glRasterPos4d = glad_debug_impl_glRasterPos4d;
+	glad_debug_glRasterPos4dv = glad_debug_impl_glRasterPos4dv;
+	glad_debug_glRasterPos4f = glad_debug_impl_glRasterPos4f;
+	glad_debug_glRasterPos4fv = glad_debug_impl_glRasterPos4fv;
+	glad_debug_glRasterPos4i = glad_debug_impl_glRasterPos4i;
+	glad_debug_glRasterPos4iv = glad_debug_impl_glRasterPos4iv;
+	glad_debug_glRasterPos4s = glad_debug_impl_glRasterPos4s;
+	glad_debug_glRasterPos4sv = glad_debug_impl_glRasterPos4sv;
+	glad_debug_glRectd = glad_debug_impl_glRectd;
+	glad_debug_glRectdv = glad_debug_impl_glRectdv;
+	glad_debug_glRectf = glad_debug_impl_glRectf;
+	glad_debug_glRectfv = glad_debug_impl_glRectfv;
+	glad_debug_glRecti = glad_debug_impl_glRecti;
+	glad_debug_glRectiv = glad_debug_impl_glRectiv;
+	glad_debug_glRects = glad_debug_impl_glRects;
+	glad_debug_glRectsv = glad_debug_impl_glRectsv;
+	glad_debug_glTexCoord1d = glad_debug_impl_glTexCoord1d;
+	glad_debug_glTexCoord1dv = glad_debug_impl_glTexCoord1dv;
+	glad_debug_glTexCoord1f = glad_debug_impl_glTexCoord1f;
+	glad_debug_glTexCoord1fv = glad_debug_impl_glTexCoord1fv;
+	glad_debug_glTexCoord1i = glad_debug_impl_glTexCoord1i;
+	glad_debug_glTexCoord1iv = glad_debug_impl_glTexCoord1iv;
+	glad_debug_glTexCoord1s = glad_debug_impl_glTexCoord1s;
+	glad_debug_glTexCoord1sv = glad_debug_impl_glTexCoord1sv;
+	glad_debug_glTexCoord2d = glad_debug_impl_glTexCoord2d;
+	glad_debug_glTexCoord2dv = glad_debug_impl_glTexCoord2dv;
+	glad_debug_glTexCoord2f = glad_debug_impl_glTexCoord2f;
+	glad_debug_glTexCoord2fv = glad_debug_impl_glTexCoord2fv;
+	glad_debug_glTexCoord2i = glad_debug_impl_glTexCoord2i;
+	glad_debug_glTexCoord2iv = glad_debug_impl_glTexCoord2iv;
+	glad_debug_glTexCoord2s = glad_debug_impl_glTexCoord2s;
+	glad_debug_glTexCoord2sv = glad_debug_impl_glTexCoord2sv;
+	glad_debug_glTexCoord3d = glad_debug_impl_glTexCoord3d;
+	glad_debug_glTexCoord3dv = glad_debug_impl_glTexCoord3dv;
+	glad_debug_glTexCoord3f = glad_debug_impl_glTexCoord3f;
+	glad_debug_glTexCoord3fv = glad_debug_impl_glTexCoord3fv;
+	glad_debug_glTexCoord3i = glad_debug_impl_glTexCoord3i;
+	glad_debug_glTexCoord3iv = glad_debug_impl_glTexCoord3iv;
+	glad_debug_glTexCoord3s = glad_debug_impl_glTexCoord3s;
+	glad_debug_glTexCoord3sv = glad_debug_impl_glTexCoord3sv;
+	glad_debug_glTexCoord4d = glad_debug_impl_glTexCoord4d;
+	glad_debug_glTexCoord4dv = glad_debug_impl_glTexCoord4dv;
+	glad_debug_glTexCoord4f = glad_debug_impl_glTexCoord4f;
+	glad_debug_glTexCoord4fv = glad_debug_impl_glTexCoord4fv;
+	glad_debug_glTexCoord4i = glad_debug_impl_glTexCoord4i;
+	glad_debug_glTexCoord4iv = glad_debug_impl_glTexCoord4iv;
+	glad_debug_glTexCoord4s = glad_debug_impl_glTexCoord4s;
+	glad_debug_glTexCoord4sv = glad_debug_impl_glTexCoord4sv;
+	glad_debug_glVertex2d = glad_debug_impl_glVertex2d;
+	glad_debug_glVertex2dv = glad_debug_impl_glVertex2dv;
+	glad_debug_glVertex2f = glad_debug_impl_glVertex2f;
+	glad_debug_glVertex2fv = glad_debug_impl_glVertex2fv;
+	glad_debug_glVertex2i = glad_debug_impl_glVertex2i;
+	glad_debug_glVertex2iv = glad_debug_impl_glVertex2iv;
+	glad_debug_glVertex2s = glad_debug_impl_glVertex2s;
+	glad_debug_glVertex2sv = glad_debug_impl_glVertex2sv;
+	glad_debug_glVertex3d = glad_debug_impl_glVertex3d;
+	glad_debug_glVertex3dv = glad_debug_impl_glVertex3dv;
+	glad_debug_glVertex3f = glad_debug_impl_glVertex3f;
+	glad_debug_glVertex3fv = glad_debug_impl_glVertex3fv;
+	glad_debug_glVertex3i = glad_debug_impl_glVertex3i;
+	glad_debug_glVertex3iv = glad_debug_impl_glVertex3iv;
+	glad_debug_glVertex3s = glad_debug_impl_glVertex3s;
+	glad_debug_glVertex3sv = glad_debug_impl_glVertex3sv;
+	glad_debug_glVertex4d = glad_debug_impl_glVertex4d;
+	glad_debug_glVertex4dv = glad_debug_impl_glVertex4dv;
+	glad_debug_glVertex4f = glad_debug_impl_glVertex4f;
+	glad_debug_glVertex4fv = glad_debug_impl_glVertex4fv;
+	glad_debug_glVertex4i = glad_debug_impl_glVertex4i;
+	glad_debug_glVertex4iv = glad_debug_impl_glVertex4iv;
+	glad_debug_glVertex4s = glad_debug_impl_glVertex4s;
+	glad_debug_glVertex4sv = glad_debug_impl_glVertex4sv;
+	glad_debug_glClipPlane = glad_debug_impl_glClipPlane;
+	glad_debug_glColorMaterial = glad_debug_impl_glColorMaterial;
+	glad_debug_glFogf = glad_debug_impl_glFogf;
+	glad_debug_glFogfv = glad_debug_impl_glFogfv;
+	glad_debug_glFogi = glad_debug_impl_glFogi;
+	glad_debug_glFogiv = glad_debug_impl_glFogiv;
+	glad_debug_glLightf = glad_debug_impl_glLightf;
+	glad_debug_glLightfv = glad_debug_impl_glLightfv;
+	glad_debug_glLighti = glad_debug_impl_glLighti;
+	glad_debug_glLightiv = glad_debug_impl_glLightiv;
+	glad_debug_glLightModelf = glad_debug_impl_glLightModelf;
+	glad_debug_glLightModelfv = glad_debug_impl_glLightModelfv;
+	glad_debug_glLightModeli = glad_debug_impl_glLightModeli;
+	glad_debug_glLightModeliv = glad_debug_impl_glLightModeliv;
+	glad_debug_glLineStipple = glad_debug_impl_glLineStipple;
+	glad_debug_glMaterialf = glad_debug_impl_glMaterialf;
+	glad_debug_glMaterialfv = glad_debug_impl_glMaterialfv;
+	glad_debug_glMateriali = glad_debug_impl_glMateriali;
+	glad_debug_glMaterialiv = glad_debug_impl_glMaterialiv;
+	glad_debug_glPolygonStipple = glad_debug_impl_glPolygonStipple;
+	glad_debug_glShadeModel = glad_debug_impl_glShadeModel;
+	glad_debug_glTexEnvf = glad_debug_impl_glTexEnvf;
+	glad_debug_glTexEnvfv = glad_debug_impl_glTexEnvfv;
+	glad_debug_glTexEnvi = glad_debug_impl_glTexEnvi;
+	glad_debug_glTexEnviv = glad_debug_impl_glTexEnviv;
+	glad_debug_glTexGend = glad_debug_impl_glTexGend;
+	glad_debug_glTexGendv = glad_debug_impl_glTexGendv;
+	glad_debug_glTexGenf = glad_debug_impl_glTexGenf;
+	glad_debug_glTexGenfv = glad_debug_impl_glTexGenfv;
+	glad_debug_glTexGeni = glad_debug_impl_glTexGeni;
+	glad_debug_glTexGeniv = glad_debug_impl_glTexGeniv;
+	glad_debug_glFeedbackBuffer = glad_debug_impl_glFeedbackBuffer;
+	glad_debug_glSelectBuffer = glad_debug_impl_glSelectBuffer;
+	glad_debug_glRenderMode = glad_debug_impl_glRenderMode;
+	glad_debug_glInitNames = glad_debug_impl_glInitNames;
+	glad_debug_glLoadName = glad_debug_impl_glLoadName;
+	glad_debug_glPassThrough = glad_debug_impl_glPassThrough;
+	glad_debug_glPopName = glad_debug_impl_glPopName;
+	glad_debug_glPushName = glad_debug_impl_glPushName;
+	glad_debug_glClearAccum = glad_debug_impl_glClearAccum;
+	glad_debug_glClearIndex = glad_debug_impl_glClearIndex;
+	glad_debug_glIndexMask = glad_debug_impl_glIndexMask;
+	glad_debug_glAccum = glad_debug_impl_glAccum;
+	glad_debug_glPopAttrib = glad_debug_impl_glPopAttrib;
+	glad_debug_glPushAttrib = glad_debug_impl_glPushAttrib;
+	glad_debug_glMap1d = glad_debug_impl_glMap1d;
+	glad_debug_glMap1f = glad_debug_impl_glMap1f;
+	glad_debug_glMap2d = glad_debug_impl_glMap2d;
+	glad_debug_glMap2f = glad_debug_impl_glMap2f;
+	glad_debug_glMapGrid1d = glad_debug_impl_glMapGrid1d;
+	glad_debug_glMapGrid1f = glad_debug_impl_glMapGrid1f;
+	glad_debug_glMapGrid2d = glad_debug_impl_glMapGrid2d;
+	glad_debug_glMapGrid2f = glad_debug_impl_glMapGrid2f;
+	glad_debug_glEvalCoord1d = glad_debug_impl_glEvalCoord1d;
+	glad_debug_glEvalCoord1dv = glad_debug_impl_glEvalCoord1dv;
+	glad_debug_glEvalCoord1f = glad_debug_impl_glEvalCoord1f;
+	glad_debug_glEvalCoord1fv = glad_debug_impl_glEvalCoord1fv;
+	glad_debug_glEvalCoord2d = glad_debug_impl_glEvalCoord2d;
+	glad_debug_glEvalCoord2dv = glad_debug_impl_glEvalCoord2dv;
+	glad_debug_glEvalCoord2f = glad_debug_impl_glEvalCoord2f;
+	glad_debug_glEvalCoord2fv = glad_debug_impl_glEvalCoord2fv;
+	glad_debug_glEvalMesh1 = glad_debug_impl_glEvalMesh1;
+	glad_debug_glEvalPoint1 = glad_debug_impl_glEvalPoint1;
+	glad_debug_glEvalMesh2 = glad_debug_impl_glEvalMesh2;
+	glad_debug_glEvalPoint2 = glad_debug_impl_glEvalPoint2;
+	glad_debug_glAlphaFunc = glad_debug_impl_glAlphaFunc;
+	glad_debug_glPixelZoom = glad_debug_impl_glPixelZoom;
+	glad_debug_glPixelTransferf = glad_debug_impl_glPixelTransferf;
+	glad_debug_glPixelTransferi = glad_debug_impl_glPixelTransferi;
+	glad_debug_glPixelMapfv = glad_debug_impl_glPixelMapfv;
+	glad_debug_glPixelMapuiv = glad_debug_impl_glPixelMapuiv;
+	glad_debug_glPixelMapusv = glad_debug_impl_glPixelMapusv;
+	glad_debug_glCopyPixels = glad_debug_impl_glCopyPixels;
+	glad_debug_glDrawPixels = glad_debug_impl_glDrawPixels;
+	glad_debug_glGetClipPlane = glad_debug_impl_glGetClipPlane;
+	glad_debug_glGetLightfv = glad_debug_impl_glGetLightfv;
+	glad_debug_glGetLightiv = glad_debug_impl_glGetLightiv;
+	glad_debug_glGetMapdv = glad_debug_impl_glGetMapdv;
+	glad_debug_glGetMapfv = glad_debug_impl_glGetMapfv;
+	glad_debug_glGetMapiv = glad_debug_impl_glGetMapiv;
+	glad_debug_glGetMaterialfv = glad_debug_impl_glGetMaterialfv;
+	glad_debug_glGetMaterialiv = glad_debug_impl_glGetMaterialiv;
+	glad_debug_glGetPixelMapfv = glad_debug_impl_glGetPixelMapfv;
+	glad_debug_glGetPixelMapuiv = glad_debug_impl_glGetPixelMapuiv;
+	glad_debug_glGetPixelMapusv = glad_debug_impl_glGetPixelMapusv;
+	glad_debug_glGetPolygonStipple = glad_debug_impl_glGetPolygonStipple;
+	glad_debug_glGetTexEnvfv = glad_debug_impl_glGetTexEnvfv;
+	glad_debug_glGetTexEnviv = glad_debug_impl_glGetTexEnviv;
+	glad_debug_glGetTexGendv = glad_debug_impl_glGetTexGendv;
+	glad_debug_glGetTexGenfv = glad_debug_impl_glGetTexGenfv;
+	glad_debug_glGetTexGeniv = glad_debug_impl_glGetTexGeniv;
+	glad_debug_glIsList = glad_debug_impl_glIsList;
+	glad_debug_glFrustum = glad_debug_impl_glFrustum;
+	glad_debug_glLoadIdentity = glad_debug_impl_glLoadIdentity;
+	glad_debug_glLoadMatrixf = glad_debug_impl_glLoadMatrixf;
+	glad_debug_glLoadMatrixd = glad_debug_impl_glLoadMatrixd;
+	glad_debug_glMatrixMode = glad_debug_impl_glMatrixMode;
+	glad_debug_glMultMatrixf = glad_debug_impl_glMultMatrixf;
+	glad_debug_glMultMatrixd = glad_debug_impl_glMultMatrixd;
+	glad_debug_glOrtho = glad_debug_impl_glOrtho;
+	glad_debug_glPopMatrix = glad_debug_impl_glPopMatrix;
+	glad_debug_glPushMatrix = glad_debug_impl_glPushMatrix;
+	glad_debug_glRotated = glad_debug_impl_glRotated;
+	glad_debug_glRotatef = glad_debug_impl_glRotatef;
+	glad_debug_glScaled = glad_debug_impl_glScaled;
+	glad_debug_glScalef = glad_debug_impl_glScalef;
+	glad_debug_glTranslated = glad_debug_impl_glTranslated;
+	glad_debug_glTranslatef = glad_debug_impl_glTranslatef;
+	glad_debug_glDrawArrays = glad_debug_impl_glDrawArrays;
+	glad_debug_glDrawElements = glad_debug_impl_glDrawElements;
+	glad_debug_glGetPointerv = glad_debug_impl_glGetPointerv;
+	glad_debug_glPolygonOffset = glad_debug_impl_glPolygonOffset;
+	glad_debug_glCopyTexImage1D = glad_debug_impl_glCopyTexImage1D;
+	glad_debug_glCopyTexImage2D = glad_debug_impl_glCopyTexImage2D;
+	glad_debug_glCopyTexSubImage1D = glad_debug_impl_glCopyTexSubImage1D;
+	glad_debug_glCopyTexSubImage2D = glad_debug_impl_glCopyTexSubImage2D;
+	glad_debug_glTexSubImage1D = glad_debug_impl_glTexSubImage1D;
+	glad_debug_glTexSubImage2D = glad_debug_impl_glTexSubImage2D;
+	glad_debug_glBindTexture = glad_debug_impl_glBindTexture;
+	glad_debug_glDeleteTextures = glad_debug_impl_glDeleteTextures;
+	glad_debug_glGenTextures = glad_debug_impl_glGenTextures;
+	glad_debug_glIsTexture = glad_debug_impl_glIsTexture;
+	glad_debug_glArrayElement = glad_debug_impl_glArrayElement;
+	glad_debug_glColorPointer = glad_debug_impl_glColorPointer;
+	glad_debug_glDisableClientState = glad_debug_impl_glDisableClientState;
+	glad_debug_glEdgeFlagPointer = glad_debug_impl_glEdgeFlagPointer;
+	glad_debug_glEnableClientState = glad_debug_impl_glEnableClientState;
+	glad_debug_glIndexPointer = glad_debug_impl_glIndexPointer;
+	glad_debug_glInterleavedArrays = glad_debug_impl_glInterleavedArrays;
+	glad_debug_glNormalPointer = glad_debug_impl_glNormalPointer;
+	glad_debug_glTexCoordPointer = glad_debug_impl_glTexCoordPointer;
+	glad_debug_glVertexPointer = glad_debug_impl_glVertexPointer;
+	glad_debug_glAreTexturesResident = glad_debug_impl_glAreTexturesResident;
+	glad_debug_glPrioritizeTextures = glad_debug_impl_glPrioritizeTextures;
+	glad_debug_glIndexub = glad_debug_impl_glIndexub;
+	glad_debug_glIndexubv = glad_debug_impl_glIndexubv;
+	glad_debug_glPopClientAttrib = glad_debug_impl_glPopClientAttrib;
+	glad_debug_glPushClientAttrib = glad_debug_impl_glPushClientAttrib;
+	glad_debug_glDrawRangeElements = glad_debug_impl_glDrawRangeElements;
+	glad_debug_glTexImage3D = glad_debug_impl_glTexImage3D;
+	glad_debug_glTexSubImage3D = glad_debug_impl_glTexSubImage3D;
+	glad_debug_glCopyTexSubImage3D = glad_debug_impl_glCopyTexSubImage3D;
+	glad_debug_glActiveTexture = glad_debug_impl_glActiveTexture;
+	glad_debug_glSampleCoverage = glad_debug_impl_glSampleCoverage;
+	glad_debug_glCompressedTexImage3D = glad_debug_impl_glCompressedTexImage3D;
+	glad_debug_glCompressedTexImage2D = glad_debug_impl_glCompressedTexImage2D;
+	glad_debug_glCompressedTexImage1D = glad_debug_impl_glCompressedTexImage1D;
+	glad_debug_glCompressedTexSubImage3D = glad_debug_impl_glCompressedTexSubImage3D;
+	glad_debug_glCompressedTexSubImage2D = glad_debug_impl_glCompressedTexSubImage2D;
+	glad_debug_glCompressedTexSubImage1D = glad_debug_impl_glCompressedTexSubImage1D;
+	glad_debug_glGetCompressedTexImage = glad_debug_impl_glGetCompressedTexImage;
+	glad_debug_glClientActiveTexture = glad_debug_impl_glClientActiveTexture;
+	glad_debug_glMultiTexCoord1d = glad_debug_impl_glMultiTexCoord1d;
+	glad_debug_glMultiTexCoord1dv = glad_debug_impl_glMultiTexCoord1dv;
+	glad_debug_glMultiTexCoord1f = glad_debug_impl_glMultiTexCoord1f;
+	glad_debug_glMultiTexCoord1fv = glad_debug_impl_glMultiTexCoord1fv;
+	glad_debug_glMultiTexCoord1i = glad_debug_impl_glMultiTexCoord1i;
+	glad_debug_glMultiTexCoord1iv = glad_debug_impl_glMultiTexCoord1iv;
+	glad_debug_glMultiTexCoord1s = glad_debug_impl_glMultiTexCoord1s;
+	glad_debug_glMultiTexCoord1sv = glad_debug_impl_glMultiTexCoord1sv;
+	glad_debug_glMultiTexCoord2d = glad_debug_impl_glMultiTexCoord2d;
+	glad_debug_glMultiTexCoord2dv = glad_debug_impl_glMultiTexCoord2dv;
+	glad_debug_glMultiTexCoord2f = glad_debug_impl_glMultiTexCoord2f;
+	glad_debug_glMultiTexCoord2fv = glad_debug_impl_glMultiTexCoord2fv;
+	glad_debug_glMultiTexCoord2i = glad_debug_impl_glMultiTexCoord2i;
+	glad_debug_glMultiTexCoord2iv = glad_debug_impl_glMultiTexCoord2iv;
+	glad_debug_glMultiTexCoord2s = glad_debug_impl_glMultiTexCoord2s;
+	glad_debug_glMultiTexCoord2sv = glad_debug_impl_glMultiTexCoord2sv;
+	glad_debug_glMultiTexCoord3d = glad_debug_impl_glMultiTexCoord3d;
+	glad_debug_glMultiTexCoord3dv = glad_debug_impl_glMultiTexCoord3dv;
+	glad_debug_glMultiTexCoord3f = glad_debug_impl_glMultiTexCoord3f;
+	glad_debug_glMultiTexCoord3fv = glad_debug_impl_glMultiTexCoord3fv;
+	glad_debug_glMultiTexCoord3i = glad_debug_impl_glMultiTexCoord3i;
+	glad_debug_glMultiTexCoord3iv = glad_debug_impl_glMultiTexCoord3iv;
+	glad_debug_glMultiTexCoord3s = glad_debug_impl_glMultiTexCoord3s;
+	glad_debug_glMultiTexCoord3sv = glad_debug_impl_glMultiTexCoord3sv;
+	glad_debug_glMultiTexCoord4d = glad_debug_impl_glMultiTexCoord4d;
+	glad_debug_glMultiTexCoord4dv = glad_debug_impl_glMultiTexCoord4dv;
+	glad_debug_glMultiTexCoord4f = glad_debug_impl_glMultiTexCoord4f;
+	glad_debug_glMultiTexCoord4fv = glad_debug_impl_glMultiTexCoord4fv;
+	glad_debug_glMultiTexCoord4i = glad_debug_impl_glMultiTexCoord4i;
+	glad_debug_glMultiTexCoord4iv = glad_debug_impl_glMultiTexCoord4iv;
+	glad_debug_glMultiTexCoord4s = glad_debug_impl_glMultiTexCoord4s;
+	glad_debug_glMultiTexCoord4sv = glad_debug_impl_glMultiTexCoord4sv;
+	glad_debug_glLoadTransposeMatrixf = glad_debug_impl_glLoadTransposeMatrixf;
+	glad_debug_glLoadTransposeMatrixd = glad_debug_impl_glLoadTransposeMatrixd;
+	glad_debug_glMultTransposeMatrixf = glad_debug_impl_glMultTransposeMatrixf;
+	glad_debug_glMultTransposeMatrixd = glad_debug_impl_glMultTransposeMatrixd;
+	glad_debug_glBlendFuncSeparate = glad_debug_impl_glBlendFuncSeparate;
+	glad_debug_glMultiDrawArrays = glad_debug_impl_glMultiDrawArrays;
+	glad_debug_glMultiDrawElements = glad_debug_impl_glMultiDrawElements;
+	glad_debug_glPointParameterf = glad_debug_impl_glPointParameterf;
+	glad_debug_glPointParameterfv = glad_debug_impl_glPointParameterfv;
+	glad_debug_glPointParameteri = glad_debug_impl_glPointParameteri;
+	glad_debug_glPointParameteriv = glad_debug_impl_glPointParameteriv;
+	glad_debug_glFogCoordf = glad_debug_impl_glFogCoordf;
+	glad_debug_glFogCoordfv = glad_debug_impl_glFogCoordfv;
+	glad_debug_glFogCoordd = glad_debug_impl_glFogCoordd;
+	glad_debug_glFogCoorddv = glad_debug_impl_glFogCoorddv;
+	glad_debug_glFogCoordPointer = glad_debug_impl_glFogCoordPointer;
+	glad_debug_glSecondaryColor3b = glad_debug_impl_glSecondaryColor3b;
+	glad_debug_glSecondaryColor3bv = glad_debug_impl_glSecondaryColor3bv;
+	glad_debug_glSecondaryColor3d = glad_debug_impl_glSecondaryColor3d;
+	glad_debug_glSecondaryColor3dv = glad_debug_impl_glSecondaryColor3dv;
+	glad_debug_glSecondaryColor3f = glad_debug_impl_glSecondaryColor3f;
+	glad_debug_glSecondaryColor3fv = glad_debug_impl_glSecondaryColor3fv;
+	glad_debug_glSecondaryColor3i = glad_debug_impl_glSecondaryColor3i;
+	glad_debug_glSecondaryColor3iv = glad_debug_impl_glSecondaryColor3iv;
+	glad_debug_glSecondaryColor3s = glad_debug_impl_glSecondaryColor3s;
+	glad_debug_glSecondaryColor3sv = glad_debug_impl_glSecondaryColor3sv;
+	glad_debug_glSecondaryColor3ub = glad_debug_impl_glSecondaryColor3ub;
+	glad_debug_glSecondaryColor3ubv = glad_debug_impl_glSecondaryColor3ubv;
+	glad_debug_glSecondaryColor3ui = glad_debug_impl_glSecondaryColor3ui;
+	glad_debug_glSecondaryColor3uiv = glad_debug_impl_glSecondaryColor3uiv;
+	glad_debug_glSecondaryColor3us = glad_debug_impl_glSecondaryColor3us;
+	glad_debug_glSecondaryColor3usv = glad_debug_impl_glSecondaryColor3usv;
+	glad_debug_glSecondaryColorPointer = glad_debug_impl_glSecondaryColorPointer;
+	glad_debug_glWindowPos2d = glad_debug_impl_glWindowPos2d;
+	glad_debug_glWindowPos2dv = glad_debug_impl_glWindowPos2dv;
+	glad_debug_glWindowPos2f = glad_debug_impl_glWindowPos2f;
+	glad_debug_glWindowPos2fv = glad_debug_impl_glWindowPos2fv;
+	glad_debug_glWindowPos2i = glad_debug_impl_glWindowPos2i;
+	glad_debug_glWindowPos2iv = glad_debug_impl_glWindowPos2iv;
+	glad_debug_glWindowPos2s = glad_debug_impl_glWindowPos2s;
+	glad_debug_glWindowPos2sv = glad_debug_impl_glWindowPos2sv;
+	glad_debug_glWindowPos3d = glad_debug_impl_glWindowPos3d;
+	glad_debug_glWindowPos3dv = glad_debug_impl_glWindowPos3dv;
+	glad_debug_glWindowPos3f = glad_debug_impl_glWindowPos3f;
+	glad_debug_glWindowPos3fv = glad_debug_impl_glWindowPos3fv;
+	glad_debug_glWindowPos3i = glad_debug_impl_glWindowPos3i;
+	glad_debug_glWindowPos3iv = glad_debug_impl_glWindowPos3iv;
+	glad_debug_glWindowPos3s = glad_debug_impl_glWindowPos3s;
+	glad_debug_glWindowPos3sv = glad_debug_impl_glWindowPos3sv;
+	glad_debug_glBlendColor = glad_debug_impl_glBlendColor;
+	glad_debug_glBlendEquation = glad_debug_impl_glBlendEquation;
+	glad_debug_glGenQueries = glad_debug_impl_glGenQueries;
+	glad_debug_glDeleteQueries = glad_debug_impl_glDeleteQueries;
+	glad_debug_glIsQuery = glad_debug_impl_glIsQuery;
+	glad_debug_glBeginQuery = glad_debug_impl_glBeginQuery;
+	glad_debug_glEndQuery = glad_debug_impl_glEndQuery;
+	glad_debug_glGetQueryiv = glad_debug_impl_glGetQueryiv;
+	glad_debug_glGetQueryObjectiv = glad_debug_impl_glGetQueryObjectiv;
+	glad_debug_glGetQueryObjectuiv = glad_debug_impl_glGetQueryObjectuiv;
+	glad_debug_glBindBuffer = glad_debug_impl_glBindBuffer;
+	glad_debug_glDeleteBuffers = glad_debug_impl_glDeleteBuffers;
+	glad_debug_glGenBuffers = glad_debug_impl_glGenBuffers;
+	glad_debug_glIsBuffer = glad_debug_impl_glIsBuffer;
+	glad_debug_glBufferData = glad_debug_impl_glBufferData;
+	glad_debug_glBufferSubData = glad_debug_impl_glBufferSubData;
+	glad_debug_glGetBufferSubData = glad_debug_impl_glGetBufferSubData;
+	glad_debug_glMapBuffer = glad_debug_impl_glMapBuffer;
+	glad_debug_glUnmapBuffer = glad_debug_impl_glUnmapBuffer;
+	glad_debug_glGetBufferParameteriv = glad_debug_impl_glGetBufferParameteriv;
+	glad_debug_glGetBufferPointerv = glad_debug_impl_glGetBufferPointerv;
+	glad_debug_glBlendEquationSeparate = glad_debug_impl_glBlendEquationSeparate;
+	glad_debug_glDrawBuffers = glad_debug_impl_glDrawBuffers;
+	glad_debug_glStencilOpSeparate = glad_debug_impl_glStencilOpSeparate;
+	glad_debug_glStencilFuncSeparate = glad_debug_impl_glStencilFuncSeparate;
+	glad_debug_glStencilMaskSeparate = glad_debug_impl_glStencilMaskSeparate;
+	glad_debug_glAttachShader = glad_debug_impl_glAttachShader;
+	glad_debug_glBindAttribLocation = glad_debug_impl_glBindAttribLocation;
+	glad_debug_glCompileShader = glad_debug_impl_glCompileShader;
+	glad_debug_glCreateProgram = glad_debug_impl_glCreateProgram;
+	glad_debug_glCreateShader = glad_debug_impl_glCreateShader;
+	glad_debug_glDeleteProgram = glad_debug_impl_glDeleteProgram;
+	glad_debug_glDeleteShader = glad_debug_impl_glDeleteShader;
+	glad_debug_glDetachShader = glad_debug_impl_glDetachShader;
+	glad_debug_glDisableVertexAttribArray = glad_debug_impl_glDisableVertexAttribArray;
+	glad_debug_glEnableVertexAttribArray = glad_debug_impl_glEnableVertexAttribArray;
+	glad_debug_glGetActiveAttrib = glad_debug_impl_glGetActiveAttrib;
+	glad_debug_glGetActiveUniform = glad_debug_impl_glGetActiveUniform;
+	glad_debug_glGetAttachedShaders = glad_debug_impl_glGetAttachedShaders;
+	glad_debug_glGetAttribLocation = glad_debug_impl_glGetAttribLocation;
+	glad_debug_glGetProgramiv = glad_debug_impl_glGetProgramiv;
+	glad_debug_glGetProgramInfoLog = glad_debug_impl_glGetProgramInfoLog;
+	glad_debug_glGetShaderiv = glad_debug_impl_glGetShaderiv;
+	glad_debug_glGetShaderInfoLog = glad_debug_impl_glGetShaderInfoLog;
+	glad_debug_glGetShaderSource = glad_debug_impl_glGetShaderSource;
+	glad_debug_glGetUniformLocation = glad_debug_impl_glGetUniformLocation;
+	glad_debug_glGetUniformfv = glad_debug_impl_glGetUniformfv;
+	glad_debug_glGetUniformiv = glad_debug_impl_glGetUniformiv;
+	glad_debug_glGetVertexAttribdv = glad_debug_impl_glGetVertexAttribdv;
+	glad_debug_glGetVertexAttribfv = glad_debug_impl_glGetVertexAttribfv;
+	glad_debug_glGetVertexAttribiv = glad_debug_impl_glGetVertexAttribiv;
+	glad_debug_glGetVertexAttribPointerv = glad_debug_impl_glGetVertexAttribPointerv;
+	glad_debug_glIsProgram = glad_debug_impl_glIsProgram;
+	glad_debug_glIsShader = glad_debug_impl_glIsShader;
+	glad_debug_glLinkProgram = glad_debug_impl_glLinkProgram;
+	glad_debug_glShaderSource = glad_debug_impl_glShaderSource;
+	glad_debug_glUseProgram = glad_debug_impl_glUseProgram;
+	glad_debug_glUniform1f = glad_debug_impl_glUniform1f;
+	glad_debug_glUniform2f = glad_debug_impl_glUniform2f;
+	glad_debug_glUniform3f = glad_debug_impl_glUniform3f;
+	glad_debug_glUniform4f = glad_debug_impl_glUniform4f;
+	glad_debug_glUniform1i = glad_debug_impl_glUniform1i;
+	glad_debug_glUniform2i = glad_debug_impl_glUniform2i;
+	glad_debug_glUniform3i = glad_debug_impl_glUniform3i;
+	glad_debug_glUniform4i = glad_debug_impl_glUniform4i;
+	glad_debug_glUniform1fv = glad_debug_impl_glUniform1fv;
+	glad_debug_glUniform2fv = glad_debug_impl_glUniform2fv;
+	glad_debug_glUniform3fv = glad_debug_impl_glUniform3fv;
+	glad_debug_glUniform4fv = glad_debug_impl_glUniform4fv;
+	glad_debug_glUniform1iv = glad_debug_impl_glUniform1iv;
+	glad_debug_glUniform2iv = glad_debug_impl_glUniform2iv;
+	glad_debug_glUniform3iv = glad_debug_impl_glUniform3iv;
+	glad_debug_glUniform4iv = glad_debug_impl_glUniform4iv;
+	glad_debug_glUniformMatrix2fv = glad_debug_impl_glUniformMatrix2fv;
+	glad_debug_glUniformMatrix3fv = glad_debug_impl_glUniformMatrix3fv;
+	glad_debug_glUniformMatrix4fv = glad_debug_impl_glUniformMatrix4fv;
+	glad_debug_glValidateProgram = glad_debug_impl_glValidateProgram;
+	glad_debug_glVertexAttrib1d = glad_debug_impl_glVertexAttrib1d;
+	glad_debug_glVertexAttrib1dv = glad_debug_impl_glVertexAttrib1dv;
+	glad_debug_glVertexAttrib1f = glad_debug_impl_glVertexAttrib1f;
+	glad_debug_glVertexAttrib1fv = glad_debug_impl_glVertexAttrib1fv;
+	glad_debug_glVertexAttrib1s = glad_debug_impl_glVertexAttrib1s;
+	glad_debug_glVertexAttrib1sv = glad_debug_impl_glVertexAttrib1sv;
+	glad_debug_glVertexAttrib2d = glad_debug_impl_glVertexAttrib2d;
+	glad_debug_glVertexAttrib2dv = glad_debug_impl_glVertexAttrib2dv;
+	glad_debug_glVertexAttrib2f = glad_debug_impl_glVertexAttrib2f;
+	glad_debug_glVertexAttrib2fv = glad_debug_impl_glVertexAttrib2fv;
+	glad_debug_glVertexAttrib2s = glad_debug_impl_glVertexAttrib2s;
+	glad_debug_glVertexAttrib2sv = glad_debug_impl_glVertexAttrib2sv;
+	glad_debug_glVertexAttrib3d = glad_debug_impl_glVertexAttrib3d;
+	glad_debug_glVertexAttrib3dv = glad_debug_impl_glVertexAttrib3dv;
+	glad_debug_glVertexAttrib3f = glad_debug_impl_glVertexAttrib3f;
+	glad_debug_glVertexAttrib3fv = glad_debug_impl_glVertexAttrib3fv;
+	glad_debug_glVertexAttrib3s = glad_debug_impl_glVertexAttrib3s;
+	glad_debug_glVertexAttrib3sv = glad_debug_impl_glVertexAttrib3sv;
+	glad_debug_glVertexAttrib4Nbv = glad_debug_impl_glVertexAttrib4Nbv;
+	glad_debug_glVertexAttrib4Niv = glad_debug_impl_glVertexAttrib4Niv;
+	glad_debug_glVertexAttrib4Nsv = glad_debug_impl_glVertexAttrib4Nsv;
+	glad_debug_glVertexAttrib4Nub = glad_debug_impl_glVertexAttrib4Nub;
+	glad_debug_glVertexAttrib4Nubv = glad_debug_impl_glVertexAttrib4Nubv;
+	glad_debug_glVertexAttrib4Nuiv = glad_debug_impl_glVertexAttrib4Nuiv;
+	glad_debug_glVertexAttrib4Nusv = glad_debug_impl_glVertexAttrib4Nusv;
+	glad_debug_glVertexAttrib4bv = glad_debug_impl_glVertexAttrib4bv;
+	glad_debug_glVertexAttrib4d = glad_debug_impl_glVertexAttrib4d;
+	glad_debug_glVertexAttrib4dv = glad_debug_impl_glVertexAttrib4dv;
+	glad_debug_glVertexAttrib4f = glad_debug_impl_glVertexAttrib4f;
+	glad_debug_glVertexAttrib4fv = glad_debug_impl_glVertexAttrib4fv;
+	glad_debug_glVertexAttrib4iv = glad_debug_impl_glVertexAttrib4iv;
+	glad_debug_glVertexAttrib4s = glad_debug_impl_glVertexAttrib4s;
+	glad_debug_glVertexAttrib4sv = glad_debug_impl_glVertexAttrib4sv;
+	glad_debug_glVertexAttrib4ubv = glad_debug_impl_glVertexAttrib4ubv;
+	glad_debug_glVertexAttrib4uiv = glad_debug_impl_glVertexAttrib4uiv;
+	glad_debug_glVertexAttrib4usv = glad_debug_impl_glVertexAttrib4usv;
+	glad_debug_glVertexAttribPointer = glad_debug_impl_glVertexAttribPointer;
+	glad_debug_glUniformMatrix2x3fv = glad_debug_impl_glUniformMatrix2x3fv;
+	glad_debug_glUniformMatrix3x2fv = glad_debug_impl_glUniformMatrix3x2fv;
+	glad_debug_glUniformMatrix2x4fv = glad_debug_impl_glUniformMatrix2x4fv;
+	glad_debug_glUniformMatrix4x2fv = glad_debug_impl_glUniformMatrix4x2fv;
+	glad_debug_glUniformMatrix3x4fv = glad_debug_impl_glUniformMatrix3x4fv;
+	glad_debug_glUniformMatrix4x3fv = glad_debug_impl_glUniformMatrix4x3fv;
+	glad_debug_glColorMaski = glad_debug_impl_glColorMaski;
+	glad_debug_glGetBooleani_v = glad_debug_impl_glGetBooleani_v;
+	glad_debug_glGetIntegeri_v = glad_debug_impl_glGetIntegeri_v;
+	glad_debug_glEnablei = glad_debug_impl_glEnablei;
+	glad_debug_glDisablei = glad_debug_impl_glDisablei;
+	glad_debug_glIsEnabledi = glad_debug_impl_glIsEnabledi;
+	glad_debug_glBeginTransformFeedback = glad_debug_impl_glBeginTransformFeedback;
+	glad_debug_glEndTransformFeedback = glad_debug_impl_glEndTransformFeedback;
+	glad_debug_glBindBufferRange = glad_debug_impl_glBindBufferRange;
+	glad_debug_glBindBufferBase = glad_debug_impl_glBindBufferBase;
+	glad_debug_glTransformFeedbackVaryings = glad_debug_impl_glTransformFeedbackVaryings;
+	glad_debug_glGetTransformFeedbackVarying = glad_debug_impl_glGetTransformFeedbackVarying;
+	glad_debug_glClampColor = glad_debug_impl_glClampColor;
+	glad_debug_glBeginConditionalRender = glad_debug_impl_glBeginConditionalRender;
+	glad_debug_glEndConditionalRender = glad_debug_impl_glEndConditionalRender;
+	glad_debug_glVertexAttribIPointer = glad_debug_impl_glVertexAttribIPointer;
+	glad_debug_glGetVertexAttribIiv = glad_debug_impl_glGetVertexAttribIiv;
+	glad_debug_glGetVertexAttribIuiv = glad_debug_impl_glGetVertexAttribIuiv;
+	glad_debug_glVertexAttribI1i = glad_debug_impl_glVertexAttribI1i;
+	glad_debug_glVertexAttribI2i = glad_debug_impl_glVertexAttribI2i;
+	glad_debug_glVertexAttribI3i = glad_debug_impl_glVertexAttribI3i;
+	glad_debug_glVertexAttribI4i = glad_debug_impl_glVertexAttribI4i;
+	glad_debug_glVertexAttribI1ui = glad_debug_impl_glVertexAttribI1ui;
+	glad_debug_glVertexAttribI2ui = glad_debug_impl_glVertexAttribI2ui;
+	glad_debug_glVertexAttribI3ui = glad_debug_impl_glVertexAttribI3ui;
+	glad_debug_glVertexAttribI4ui = glad_debug_impl_glVertexAttribI4ui;
+	glad_debug_glVertexAttribI1iv = glad_debug_impl_glVertexAttribI1iv;
+	glad_debug_glVertexAttribI2iv = glad_debug_impl_glVertexAttribI2iv;
+	glad_debug_glVertexAttribI3iv = glad_debug_impl_glVertexAttribI3iv;
+	glad_debug_glVertexAttribI4iv = glad_debug_impl_glVertexAttribI4iv;
+	glad_debug_glVertexAttribI1uiv = glad_debug_impl_glVertexAttribI1uiv;
+	glad_debug_glVertexAttribI2uiv = glad_debug_impl_glVertexAttribI2uiv;
+	glad_debug_glVertexAttribI3uiv = glad_debug_impl_glVertexAttribI3uiv;
+	glad_debug_glVertexAttribI4uiv = glad_debug_impl_glVertexAttribI4uiv;
+	glad_debug_glVertexAttribI4bv = glad_debug_impl_glVertexAttribI4bv;
+	glad_debug_glVertexAttribI4sv = glad_debug_impl_glVertexAttribI4sv;
+	glad_debug_glVertexAttribI4ubv = glad_debug_impl_glVertexAttribI4ubv;
+	glad_debug_glVertexAttribI4usv = glad_debug_impl_glVertexAttribI4usv;
+	glad_debug_glGetUniformuiv = glad_debug_impl_glGetUniformuiv;
+	glad_debug_glBindFragDataLocation = glad_debug_impl_glBindFragDataLocation;
+	glad_debug_glGetFragDataLocation = glad_debug_impl_glGetFragDataLocation;
+	glad_debug_glUniform1ui = glad_debug_impl_glUniform1ui;
+	glad_debug_glUniform2ui = glad_debug_impl_glUniform2ui;
+	glad_debug_glUniform3ui = glad_debug_impl_glUniform3ui;
+	glad_debug_glUniform4ui = glad_debug_impl_glUniform4ui;
+	glad_debug_glUniform1uiv = glad_debug_impl_glUniform1uiv;
+	glad_debug_glUniform2uiv = glad_debug_impl_glUniform2uiv;
+	glad_debug_glUniform3uiv = glad_debug_impl_glUniform3uiv;
+	glad_debug_glUniform4uiv = glad_debug_impl_glUniform4uiv;
+	glad_debug_glTexParameterIiv = glad_debug_impl_glTexParameterIiv;
+	glad_debug_glTexParameterIuiv = glad_debug_impl_glTexParameterIuiv;
+	glad_debug_glGetTexParameterIiv = glad_debug_impl_glGetTexParameterIiv;
+	glad_debug_glGetTexParameterIuiv = glad_debug_impl_glGetTexParameterIuiv;
+	glad_debug_glClearBufferiv = glad_debug_impl_glClearBufferiv;
+	glad_debug_glClearBufferuiv = glad_debug_impl_glClearBufferuiv;
+	glad_debug_glClearBufferfv = glad_debug_impl_glClearBufferfv;
+	glad_debug_glClearBufferfi = glad_debug_impl_glClearBufferfi;
+	glad_debug_glGetStringi = glad_debug_impl_glGetStringi;
+	glad_debug_glIsRenderbuffer = glad_debug_impl_glIsRenderbuffer;
+	glad_debug_glBindRenderbuffer = glad_debug_impl_glBindRenderbuffer;
+	glad_debug_glDeleteRenderbuffers = glad_debug_impl_glDeleteRenderbuffers;
+	glad_debug_glGenRenderbuffers = glad_debug_impl_glGenRenderbuffers;
+	glad_debug_glRenderbufferStorage = glad_debug_impl_glRenderbufferStorage;
+	glad_debug_glGetRenderbufferParameteriv = glad_debug_impl_glGetRenderbufferParameteriv;
+	glad_debug_glIsFramebuffer = glad_debug_impl_glIsFramebuffer;
+	glad_debug_glBindFramebuffer = glad_debug_impl_glBindFramebuffer;
+	glad_debug_glDeleteFramebuffers = glad_debug_impl_glDeleteFramebuffers;
+	glad_debug_glGenFramebuffers = glad_debug_impl_glGenFramebuffers;
+	glad_debug_glCheckFramebufferStatus = glad_debug_impl_glCheckFramebufferStatus;
+	glad_debug_glFramebufferTexture1D = glad_debug_impl_glFramebufferTexture1D;
+	glad_debug_glFramebufferTexture2D = glad_debug_impl_glFramebufferTexture2D;
+	glad_debug_glFramebufferTexture3D = glad_debug_impl_glFramebufferTexture3D;
+	glad_debug_glFramebufferRenderbuffer = glad_debug_impl_glFramebufferRenderbuffer;
+	glad_debug_glGetFramebufferAttachmentParameteriv = glad_debug_impl_glGetFramebufferAttachmentParameteriv;
+	glad_debug_glGenerateMipmap = glad_debug_impl_glGenerateMipmap;
+	glad_debug_glBlitFramebuffer = glad_debug_impl_glBlitFramebuffer;
+	glad_debug_glRenderbufferStorageMultisample = glad_debug_impl_glRenderbufferStorageMultisample;
+	glad_debug_glFramebufferTextureLayer = glad_debug_impl_glFramebufferTextureLayer;
+	glad_debug_glMapBufferRange = glad_debug_impl_glMapBufferRange;
+	glad_debug_glFlushMappedBufferRange = glad_debug_impl_glFlushMappedBufferRange;
+	glad_debug_glBindVertexArray = glad_debug_impl_glBindVertexArray;
+	glad_debug_glDeleteVertexArrays = glad_debug_impl_glDeleteVertexArrays;
+	glad_debug_glGenVertexArrays = glad_debug_impl_glGenVertexArrays;
+	glad_debug_glIsVertexArray = glad_debug_impl_glIsVertexArray;
+	glad_debug_glDrawArraysInstanced = glad_debug_impl_glDrawArraysInstanced;
+	glad_debug_glDrawElementsInstanced = glad_debug_impl_glDrawElementsInstanced;
+	glad_debug_glTexBuffer = glad_debug_impl_glTexBuffer;
+	glad_debug_glPrimitiveRestartIndex = glad_debug_impl_glPrimitiveRestartIndex;
+	glad_debug_glCopyBufferSubData = glad_debug_impl_glCopyBufferSubData;
+	glad_debug_glGetUniformIndices = glad_debug_impl_glGetUniformIndices;
+	glad_debug_glGetActiveUniformsiv = glad_debug_impl_glGetActiveUniformsiv;
+	glad_debug_glGetActiveUniformName = glad_debug_impl_glGetActiveUniformName;
+	glad_debug_glGetUniformBlockIndex = glad_debug_impl_glGetUniformBlockIndex;
+	glad_debug_glGetActiveUniformBlockiv = glad_debug_impl_glGetActiveUniformBlockiv;
+	glad_debug_glGetActiveUniformBlockName = glad_debug_impl_glGetActiveUniformBlockName;
+	glad_debug_glUniformBlockBinding = glad_debug_impl_glUniformBlockBinding;
+	glad_debug_glDrawElementsBaseVertex = glad_debug_impl_glDrawElementsBaseVertex;
+	glad_debug_glDrawRangeElementsBaseVertex = glad_debug_impl_glDrawRangeElementsBaseVertex;
+	glad_debug_glDrawElementsInstancedBaseVertex = glad_debug_impl_glDrawElementsInstancedBaseVertex;
+	glad_debug_glMultiDrawElementsBaseVertex = glad_debug_impl_glMultiDrawElementsBaseVertex;
+	glad_debug_glProvokingVertex = glad_debug_impl_glProvokingVertex;
+	glad_debug_glFenceSync = glad_debug_impl_glFenceSync;
+	glad_debug_glIsSync = glad_debug_impl_glIsSync;
+	glad_debug_glDeleteSync = glad_debug_impl_glDeleteSync;
+	glad_debug_glClientWaitSync = glad_debug_impl_glClientWaitSync;
+	glad_debug_glWaitSync = glad_debug_impl_glWaitSync;
+	glad_debug_glGetInteger64v = glad_debug_impl_glGetInteger64v;
+	glad_debug_glGetSynciv = glad_debug_impl_glGetSynciv;
+	glad_debug_glGetInteger64i_v = glad_debug_impl_glGetInteger64i_v;
+	glad_debug_glGetBufferParameteri64v = glad_debug_impl_glGetBufferParameteri64v;
+	glad_debug_glFramebufferTexture = glad_debug_impl_glFramebufferTexture;
+	glad_debug_glTexImage2DMultisample = glad_debug_impl_glTexImage2DMultisample;
+	glad_debug_glTexImage3DMultisample = glad_debug_impl_glTexImage3DMultisample;
+	glad_debug_glGetMultisamplefv = glad_debug_impl_glGetMultisamplefv;
+	glad_debug_glSampleMaski = glad_debug_impl_glSampleMaski;
+	glad_debug_glBindFragDataLocationIndexed = glad_debug_impl_glBindFragDataLocationIndexed;
+	glad_debug_glGetFragDataIndex = glad_debug_impl_glGetFragDataIndex;
+	glad_debug_glGenSamplers = glad_debug_impl_glGenSamplers;
+	glad_debug_glDeleteSamplers = glad_debug_impl_glDeleteSamplers;
+	glad_debug_glIsSampler = glad_debug_impl_glIsSampler;
+	glad_debug_glBindSampler = glad_debug_impl_glBindSampler;
+	glad_debug_glSamplerParameteri = glad_debug_impl_glSamplerParameteri;
+	glad_debug_glSamplerParameteriv = glad_debug_impl_glSamplerParameteriv;
+	glad_debug_glSamplerParameterf = glad_debug_impl_glSamplerParameterf;
+	glad_debug_glSamplerParameterfv = glad_debug_impl_glSamplerParameterfv;
+	glad_debug_glSamplerParameterIiv = glad_debug_impl_glSamplerParameterIiv;
+	glad_debug_glSamplerParameterIuiv = glad_debug_impl_glSamplerParameterIuiv;
+	glad_debug_glGetSamplerParameteriv = glad_debug_impl_glGetSamplerParameteriv;
+	glad_debug_glGetSamplerParameterIiv = glad_debug_impl_glGetSamplerParameterIiv;
+	glad_debug_glGetSamplerParameterfv = glad_debug_impl_glGetSamplerParameterfv;
+	glad_debug_glGetSamplerParameterIuiv = glad_debug_impl_glGetSamplerParameterIuiv;
+	glad_debug_glQueryCounter = glad_debug_impl_glQueryCounter;
+	glad_debug_glGetQueryObjecti64v = glad_debug_impl_glGetQueryObjecti64v;
+	glad_debug_glGetQueryObjectui64v = glad_debug_impl_glGetQueryObjectui64v;
+	glad_debug_glVertexAttribDivisor = glad_debug_impl_glVertexAttribDivisor;
+	glad_debug_glVertexAttribP1ui = glad_debug_impl_glVertexAttribP1ui;
+	glad_debug_glVertexAttribP1uiv = glad_debug_impl_glVertexAttribP1uiv;
+	glad_debug_glVertexAttribP2ui = glad_debug_impl_glVertexAttribP2ui;
+	glad_debug_glVertexAttribP2uiv = glad_debug_impl_glVertexAttribP2uiv;
+	glad_debug_glVertexAttribP3ui = glad_debug_impl_glVertexAttribP3ui;
+	glad_debug_glVertexAttribP3uiv = glad_debug_impl_glVertexAttribP3uiv;
+	glad_debug_glVertexAttribP4ui = glad_debug_impl_glVertexAttribP4ui;
+	glad_debug_glVertexAttribP4uiv = glad_debug_impl_glVertexAttribP4uiv;
+	glad_debug_glVertexP2ui = glad_debug_impl_glVertexP2ui;
+	glad_debug_glVertexP2uiv = glad_debug_impl_glVertexP2uiv;
+	glad_debug_glVertexP3ui = glad_debug_impl_glVertexP3ui;
+	glad_debug_glVertexP3uiv = glad_debug_impl_glVertexP3uiv;
+	glad_debug_glVertexP4ui = glad_debug_impl_glVertexP4ui;
+	glad_debug_glVertexP4uiv = glad_debug_impl_glVertexP4uiv;
+	glad_debug_glTexCoordP1ui = glad_debug_impl_glTexCoordP1ui;
+	glad_debug_glTexCoordP1uiv = glad_debug_impl_glTexCoordP1uiv;
+	glad_debug_glTexCoordP2ui = glad_debug_impl_glTexCoordP2ui;
+	glad_debug_glTexCoordP2uiv = glad_debug_impl_glTexCoordP2uiv;
+	glad_debug_glTexCoordP3ui = glad_debug_impl_glTexCoordP3ui;
+	glad_debug_glTexCoordP3uiv = glad_debug_impl_glTexCoordP3uiv;
+	glad_debug_glTexCoordP4ui = glad_debug_impl_glTexCoordP4ui;
+	glad_debug_glTexCoordP4uiv = glad_debug_impl_glTexCoordP4uiv;
+	glad_debug_glMultiTexCoordP1ui = glad_debug_impl_glMultiTexCoordP1ui;
+	glad_debug_glMultiTexCoordP1uiv = glad_debug_impl_glMultiTexCoordP1uiv;
+	glad_debug_glMultiTexCoordP2ui = glad_debug_impl_glMultiTexCoordP2ui;
+	glad_debug_glMultiTexCoordP2uiv = glad_debug_impl_glMultiTexCoordP2uiv;
+	glad_debug_glMultiTexCoordP3ui = glad_debug_impl_glMultiTexCoordP3ui;
+	glad_debug_glMultiTexCoordP3uiv = glad_debug_impl_glMultiTexCoordP3uiv;
+	glad_debug_glMultiTexCoordP4ui = glad_debug_impl_glMultiTexCoordP4ui;
+	glad_debug_glMultiTexCoordP4uiv = glad_debug_impl_glMultiTexCoordP4uiv;
+	glad_debug_glNormalP3ui = glad_debug_impl_glNormalP3ui;
+	glad_debug_glNormalP3uiv = glad_debug_impl_glNormalP3uiv;
+	glad_debug_glColorP3ui = glad_debug_impl_glColorP3ui;
+	glad_debug_glColorP3uiv = glad_debug_impl_glColorP3uiv;
+	glad_debug_glColorP4ui = glad_debug_impl_glColorP4ui;
+	glad_debug_glColorP4uiv = glad_debug_impl_glColorP4uiv;
+	glad_debug_glSecondaryColorP3ui = glad_debug_impl_glSecondaryColorP3ui;
+	glad_debug_glSecondaryColorP3uiv = glad_debug_impl_glSecondaryColorP3uiv;
+	glad_debug_glDebugMessageControl = glad_debug_impl_glDebugMessageControl;
+	glad_debug_glDebugMessageInsert = glad_debug_impl_glDebugMessageInsert;
+	glad_debug_glDebugMessageCallback = glad_debug_impl_glDebugMessageCallback;
+	glad_debug_glGetDebugMessageLog = glad_debug_impl_glGetDebugMessageLog;
+	glad_debug_glPushDebugGroup = glad_debug_impl_glPushDebugGroup;
+	glad_debug_glPopDebugGroup = glad_debug_impl_glPopDebugGroup;
+	glad_debug_glObjectLabel = glad_debug_impl_glObjectLabel;
+	glad_debug_glGetObjectLabel = glad_debug_impl_glGetObjectLabel;
+	glad_debug_glObjectPtrLabel = glad_debug_impl_glObjectPtrLabel;
+	glad_debug_glGetObjectPtrLabel = glad_debug_impl_glGetObjectPtrLabel;
+	_glad_debug_installed = 1;
+}
+
+void gladUninstallGLDebug(void) {
+	glad_debug_glCullFace = glad_glCullFace;
+	glad_debug_glFrontFace = glad_glFrontFace;
+	glad_debug_glHint = glad_glHint;
+	glad_debug_glLineWidth = glad_glLineWidth;
+	glad_debug_glPointSize = glad_glPointSize;
+	glad_debug_glPolygonMode = glad_glPolygonMode;
+	glad_debug_glScissor = glad_glScissor;
+	glad_debug_glTexParameterf = glad_glTexParameterf;
+	glad_debug_glTexParameterfv = glad_glTexParameterfv;
+	glad_debug_glTexParameteri = glad_glTexParameteri;
+	glad_debug_glTexParameteriv = glad_glTexParameteriv;
+	glad_debug_glTexImage1D = glad_glTexImage1D;
+	glad_debug_glTexImage2D = glad_glTexImage2D;
+	glad_debug_glDrawBuffer = glad_glDrawBuffer;
+	glad_debug_glClear = glad_glClear;
+	glad_debug_glClearColor = glad_glClearColor;
+	glad_debug_glClearStencil = glad_glClearStencil;
+	glad_debug_glClearDepth = glad_glClearDepth;
+	glad_debug_glStencilMask = glad_glStencilMask;
+	glad_debug_glColorMask = glad_glColorMask;
+	glad_debug_glDepthMask = glad_glDepthMask;
+	glad_debug_glDisable = glad_glDisable;
+	glad_debug_glEnable = glad_glEnable;
+	glad_debug_glFinish = glad_glFinish;
+	glad_debug_glFlush = glad_glFlush;
+	glad_debug_glBlendFunc = glad_glBlendFunc;
+	glad_debug_glLogicOp = glad_glLogicOp;
+	glad_debug_glStencilFunc = glad_glStencilFunc;
+	glad_debug_glStencilOp = glad_glStencilOp;
+	glad_debug_glDepthFunc = glad_glDepthFunc;
+	glad_debug_glPixelStoref = glad_glPixelStoref;
+	glad_debug_glPixelStorei = glad_glPixelStorei;
+	glad_debug_glReadBuffer = glad_glReadBuffer;
+	glad_debug_glReadPixels = glad_glReadPixels;
+	glad_debug_glGetBooleanv = glad_glGetBooleanv;
+	glad_debug_glGetDoublev = glad_glGetDoublev;
+	glad_debug_glGetError = glad_glGetError;
+	glad_debug_glGetFloatv = glad_glGetFloatv;
+	glad_debug_glGetIntegerv = glad_glGetIntegerv;
+	glad_debug_glGetString = glad_glGetString;
+	glad_debug_glGetTexImage = glad_glGetTexImage;
+	glad_debug_glGetTexParameterfv = glad_glGetTexParameterfv;
+	glad_debug_glGetTexParameteriv = glad_glGetTexParameteriv;
+	glad_debug_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+	glad_debug_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+	glad_debug_glIsEnabled = glad_glIsEnabled;
+	glad_debug_glDepthRange = glad_glDepthRange;
+	glad_debug_glViewport = glad_glViewport;
+	glad_debug_glNewList = glad_glNewList;
+	glad_debug_glEndList = glad_glEndList;
+	glad_debug_glCallList = glad_glCallList;
+	glad_debug_glCallLists = glad_glCallLists;
+	glad_debug_glDeleteLists = glad_glDeleteLists;
+	glad_debug_glGenLists = glad_glGenLists;
+	glad_debug_glListBase = glad_glListBase;
+	glad_debug_glBegin = glad_glBegin;
+	glad_debug_glBitmap = glad_glBitmap;
+	glad_debug_glColor3b = glad_glColor3b;
+	glad_debug_glColor3bv = glad_glColor3bv;
+	glad_debug_glColor3d = glad_glColor3d;
+	glad_debug_glColor3dv = glad_glColor3dv;
+	glad_debug_glColor3f = glad_glColor3f;
+	glad_debug_glColor3fv = glad_glColor3fv;
+	glad_debug_glColor3i = glad_glColor3i;
+	glad_debug_glColor3iv = glad_glColor3iv;
+	glad_debug_glColor3s = glad_glColor3s;
+	glad_debug_glColor3sv = glad_glColor3sv;
+	glad_debug_glColor3ub = glad_glColor3ub;
+	glad_debug_glColor3ubv = glad_glColor3ubv;
+	glad_debug_glColor3ui = glad_glColor3ui;
+	glad_debug_glColor3uiv = glad_glColor3uiv;
+	glad_debug_glColor3us = glad_glColor3us;
+	glad_debug_glColor3usv = glad_glColor3usv;
+	glad_debug_glColor4b = glad_glColor4b;
+	glad_debug_glColor4bv = glad_glColor4bv;
+	glad_debug_glColor4d = glad_glColor4d;
+	glad_debug_glColor4dv = glad_glColor4dv;
+	glad_debug_glColor4f = glad_glColor4f;
+	glad_debug_glColor4fv = glad_glColor4fv;
+	glad_debug_glColor4i = glad_glColor4i;
+	glad_debug_glColor4iv = glad_glColor4iv;
+	glad_debug_glColor4s = glad_glColor4s;
+	glad_debug_glColor4sv = glad_glColor4sv;
+	glad_debug_glColor4ub = glad_glColor4ub;
+	glad_debug_glColor4ubv = glad_glColor4ubv;
+	glad_debug_glColor4ui = glad_glColor4ui;
+	glad_debug_glColor4uiv = glad_glColor4uiv;
+	glad_debug_glColor4us = glad_glColor4us;
+	glad_debug_glColor4usv = glad_glColor4usv;
+	glad_debug_glEdgeFlag = glad_glEdgeFlag;
+	glad_debug_glEdgeFlagv = glad_glEdgeFlagv;
+	glad_debug_glEnd = glad_glEnd;
+	glad_debug_glIndexd = glad_glIndexd;
+	glad_debug_glIndexdv = glad_glIndexdv;
+	glad_debug_glIndexf = glad_glIndexf;
+	glad_debug_glIndexfv = glad_glIndexfv;
+	glad_debug_glIndexi = glad_glIndexi;
+	glad_debug_glIndexiv = glad_glIndexiv;
+	glad_debug_glIndexs = glad_glIndexs;
+	glad_debug_glIndexsv = glad_glIndexsv;
+	glad_debug_glNormal3b = glad_glNormal3b;
+	glad_debug_glNormal3bv = glad_glNormal3bv;
+	glad_debug_glNormal3d = glad_glNormal3d;
+	glad_debug_glNormal3dv = glad_glNormal3dv;
+	glad_debug_glNormal3f = glad_glNormal3f;
+	glad_debug_glNormal3fv = glad_glNormal3fv;
+	glad_debug_glNormal3i = glad_glNormal3i;
+	glad_debug_glNormal3iv = glad_glNormal3iv;
+	glad_debug_glNormal3s = glad_glNormal3s;
+	glad_debug_glNormal3sv = glad_glNormal3sv;
+	glad_debug_glRasterPos2d = glad_glRasterPos2d;
+	glad_debug_glRasterPos2dv = glad_glRasterPos2dv;
+	glad_debug_glRasterPos2f = glad_glRasterPos2f;
+	glad_debug_glRasterPos2fv = glad_glRasterPos2fv;
+	glad_debug_glRasterPos2i = glad_glRasterPos2i;
+	glad_debug_glRasterPos2iv = glad_glRasterPos2iv;
+	glad_debug_glRasterPos2s = glad_glRasterPos2s;
+	glad_debug_glRasterPos2sv = glad_glRasterPos2sv;
+	glad_debug_glRasterPos3d = glad_glRasterPos3d;
+	glad_debug_glRasterPos3dv = glad_glRasterPos3dv;
+	glad_debug_glRasterPos3f = glad_glRasterPos3f;
+	glad_debug_glRasterPos3fv = glad_glRasterPos3fv;
+	glad_debug_glRasterPos3i = glad_glRasterPos3i;
+	glad_debug_glRasterPos3iv = glad_glRasterPos3iv;
+	glad_debug_glRasterPos3s = glad_glRasterPos3s;
+	glad_debug_glRasterPos3sv = glad_glRasterPos3sv;
+	glad_debug_glRasterPos4d = glad_glRasterPos4d;
+	glad_debug_glRasterPos4dv = glad_glRasterPos4dv;
+	glad_debug_glRasterPos4f = glad_glRasterPos4f;
+	glad_debug_glRasterPos4fv = glad_glRasterPos4fv;
+	glad_debug_glRasterPos4i = glad_glRasterPos4i;
+	glad_debug_glRasterPos4iv = glad_glRasterPos4iv;
+	glad_debug_glRasterPos4s = glad_glRasterPos4s;
+	glad_debug_glRasterPos4sv = glad_glRasterPos4sv;
+	glad_debug_glRectd = glad_glRectd;
+	glad_debug_glRectdv = glad_glRectdv;
+	glad_debug_glRectf = glad_glRectf;
+	glad_debug_glRectfv = glad_glRectfv;
+	glad_debug_glRecti = glad_glRecti;
+	glad_debug_glRectiv = glad_glRectiv;
+	glad_debug_glRects = glad_glRects;
+	glad_debug_glRectsv = glad_glRectsv;
+	glad_debug_glTexCoord1d = glad_glTexCoord1d;
+	glad_debug_glTexCoord1dv = glad_glTexCoord1dv;
+	glad_debug_glTexCoord1f = glad_glTexCoord1f;
+	glad_debug_glTexCoord1fv = glad_glTexCoord1fv;
+	glad_debug_glTexCoord1i = glad_glTexCoord1i;
+	glad_debug_glTexCoord1iv = glad_glTexCoord1iv;
+	glad_debug_glTexCoord1s = glad_glTexCoord1s;
+	glad_debug_glTexCoord1sv = glad_glTexCoord1sv;
+	glad_debug_glTexCoord2d = glad_glTexCoord2d;
+	glad_debug_glTexCoord2dv = glad_glTexCoord2dv;
+	glad_debug_glTexCoord2f = glad_glTexCoord2f;
+	glad_debug_glTexCoord2fv = glad_glTexCoord2fv;
+	glad_debug_glTexCoord2i = glad_glTexCoord2i;
+	glad_debug_glTexCoord2iv = glad_glTexCoord2iv;
+	glad_debug_glTexCoord2s = glad_glTexCoord2s;
+	glad_debug_glTexCoord2sv = glad_glTexCoord2sv;
+	glad_debug_glTexCoord3d = glad_glTexCoord3d;
+	glad_debug_glTexCoord3dv = glad_glTexCoord3dv;
+	glad_debug_glTexCoord3f = glad_glTexCoord3f;
+	glad_debug_glTexCoord3fv = glad_glTexCoord3fv;
+	glad_debug_glTexCoord3i = glad_glTexCoord3i;
+	glad_debug_glTexCoord3iv = glad_glTexCoord3iv;
+	glad_debug_glTexCoord3s = glad_glTexCoord3s;
+	glad_debug_glTexCoord3sv = glad_glTexCoord3sv;
+	glad_debug_glTexCoord4d = glad_glTexCoord4d;
+	glad_debug_glTexCoord4dv = glad_glTexCoord4dv;
+	glad_debug_glTexCoord4f = glad_glTexCoord4f;
+	glad_debug_glTexCoord4fv = glad_glTexCoord4fv;
+	glad_debug_glTexCoord4i = glad_glTexCoord4i;
+	glad_debug_glTexCoord4iv = glad_glTexCoord4iv;
+	glad_debug_glTexCoord4s = glad_glTexCoord4s;
+	glad_debug_glTexCoord4sv = glad_glTexCoord4sv;
+	glad_debug_glVertex2d = glad_glVertex2d;
+	glad_debug_glVertex2dv = glad_glVertex2dv;
+	glad_debug_glVertex2f = glad_glVertex2f;
+	glad_debug_glVertex2fv = glad_glVertex2fv;
+	glad_debug_glVertex2i = glad_glVertex2i;
+	glad_debug_glVertex2iv = glad_glVertex2iv;
+	glad_debug_glVertex2s = glad_glVertex2s;
+	glad_debug_glVertex2sv = glad_glVertex2sv;
+	glad_debug_glVertex3d = glad_glVertex3d;
+	glad_debug_glVertex3dv = glad_glVertex3dv;
+	glad_debug_glVertex3f = glad_glVertex3f;
+	glad_debug_glVertex3fv = glad_glVertex3fv;
+	glad_debug_glVertex3i = glad_glVertex3i;
+	glad_debug_glVertex3iv = glad_glVertex3iv;
+	glad_debug_glVertex3s = glad_glVertex3s;
+	glad_debug_glVertex3sv = glad_glVertex3sv;
+	glad_debug_glVertex4d = glad_glVertex4d;
+	glad_debug_glVertex4dv = glad_glVertex4dv;
+	glad_debug_glVertex4f = glad_glVertex4f;
+	glad_debug_glVertex4fv = glad_glVertex4fv;
+	glad_debug_glVertex4i = glad_glVertex4i;
+	glad_debug_glVertex4iv = glad_glVertex4iv;
+	glad_debug_glVertex4s = glad_glVertex4s;
+	glad_debug_glVertex4sv = glad_glVertex4sv;
+	glad_debug_glClipPlane = glad_glClipPlane;
+	glad_debug_glColorMaterial = glad_glColorMaterial;
+	glad_debug_glFogf = glad_glFogf;
+	glad_debug_glFogfv = glad_glFogfv;
+	glad_debug_glFogi = glad_glFogi;
+	glad_debug_glFogiv = glad_glFogiv;
+	glad_debug_glLightf = glad_glLightf;
+	glad_debug_glLightfv = glad_glLightfv;
+	glad_debug_glLighti = glad_glLighti;
+	glad_debug_glLightiv = glad_glLightiv;
+	glad_debug_glLightModelf = glad_glLightModelf;
+	glad_debug_glLightModelfv = glad_glLightModelfv;
+	glad_debug_glLightModeli = glad_glLightModeli;
+	glad_debug_glLightModeliv = glad_glLightModeliv;
+	glad_debug_glLineStipple = glad_glLineStipple;
+	glad_debug_glMaterialf = glad_glMaterialf;
+	glad_debug_glMaterialfv = glad_glMaterialfv;
+	glad_debug_glMateriali = glad_glMateriali;
+	glad_debug_glMaterialiv = glad_glMaterialiv;
+	glad_debug_glPolygonStipple = glad_glPolygonStipple;
+	glad_debug_glShadeModel = glad_glShadeModel;
+	glad_debug_glTexEnvf = glad_glTexEnvf;
+	glad_debug_glTexEnvfv = glad_glTexEnvfv;
+	glad_debug_glTexEnvi = glad_glTexEnvi;
+	glad_debug_glTexEnviv = glad_glTexEnviv;
+	glad_debug_glTexGend = glad_glTexGend;
+	glad_debug_glTexGendv = glad_glTexGendv;
+	glad_debug_glTexGenf = glad_glTexGenf;
+	glad_debug_glTexGenfv = glad_glTexGenfv;
+	glad_debug_glTexGeni = glad_glTexGeni;
+	glad_debug_glTexGeniv = glad_glTexGeniv;
+	glad_debug_glFeedbackBuffer = glad_glFeedbackBuffer;
+	glad_debug_glSelectBuffer = glad_glSelectBuffer;
+	glad_debug_glRenderMode = glad_glRenderMode;
+	glad_debug_glInitNames = glad_glInitNames;
+	glad_debug_glLoadName = glad_glLoadName;
+	glad_debug_glPassThrough = glad_glPassThrough;
+	glad_debug_glPopName = glad_glPopName;
+	glad_debug_glPushName = glad_glPushName;
+	glad_debug_glClearAccum = glad_glClearAccum;
+	glad_debug_glClearIndex = glad_glClearIndex;
+	glad_debug_glIndexMask = glad_glIndexMask;
+	glad_debug_glAccum = glad_glAccum;
+	glad_debug_glPopAttrib = glad_glPopAttrib;
+	glad_debug_glPushAttrib = glad_glPushAttrib;
+	glad_debug_glMap1d = glad_glMap1d;
+	glad_debug_glMap1f = glad_glMap1f;
+	glad_debug_glMap2d = glad_glMap2d;
+	glad_debug_glMap2f = glad_glMap2f;
+	glad_debug_glMapGrid1d = glad_glMapGrid1d;
+	glad_debug_glMapGrid1f = glad_glMapGrid1f;
+	glad_debug_glMapGrid2d = glad_glMapGrid2d;
+	glad_debug_glMapGrid2f = glad_glMapGrid2f;
+	glad_debug_glEvalCoord1d = glad_glEvalCoord1d;
+	glad_debug_glEvalCoord1dv = glad_glEvalCoord1dv;
+	glad_debug_glEvalCoord1f = glad_glEvalCoord1f;
+	glad_debug_glEvalCoord1fv = glad_glEvalCoord1fv;
+	glad_debug_glEvalCoord2d = glad_glEvalCoord2d;
+	glad_debug_glEvalCoord2dv = glad_glEvalCoord2dv;
+	glad_debug_glEvalCoord2f = glad_glEvalCoord2f;
+	glad_debug_glEvalCoord2fv = glad_glEvalCoord2fv;
+	glad_debug_glEvalMesh1 = glad_glEvalMesh1;
+	glad_debug_glEvalPoint1 = glad_glEvalPoint1;
+	glad_debug_glEvalMesh2 = glad_glEvalMesh2;
+	glad_debug_glEvalPoint2 = glad_glEvalPoint2;
+	glad_debug_glAlphaFunc = glad_glAlphaFunc;
+	glad_debug_glPixelZoom = glad_glPixelZoom;
+	glad_debug_glPixelTransferf = glad_glPixelTransferf;
+	glad_debug_glPixelTransferi = glad_glPixelTransferi;
+	glad_debug_glPixelMapfv = glad_glPixelMapfv;
+	glad_debug_glPixelMapuiv = glad_glPixelMapuiv;
+	glad_debug_glPixelMapusv = glad_glPixelMapusv;
+	glad_debug_glCopyPixels = glad_glCopyPixels;
+	glad_debug_glDrawPixels = glad_glDrawPixels;
+	glad_debug_glGetClipPlane = glad_glGetClipPlane;
+	glad_debug_glGetLightfv = glad_glGetLightfv;
+	glad_debug_glGetLightiv = glad_glGetLightiv;
+	glad_debug_glGetMapdv = glad_glGetMapdv;
+	glad_debug_glGetMapfv = glad_glGetMapfv;
+	glad_debug_glGetMapiv = glad_glGetMapiv;
+	glad_debug_glGetMaterialfv = glad_glGetMaterialfv;
+	glad_debug_glGetMaterialiv = glad_glGetMaterialiv;
+	glad_debug_glGetPixelMapfv = glad_glGetPixelMapfv;
+	glad_debug_glGetPixelMapuiv = glad_glGetPixelMapuiv;
+	glad_debug_glGetPixelMapusv = glad_glGetPixelMapusv;
+	glad_debug_glGetPolygonStipple = glad_glGetPolygonStipple;
+	glad_debug_glGetTexEnvfv = glad_glGetTexEnvfv;
+	glad_debug_glGetTexEnviv = glad_glGetTexEnviv;
+	glad_debug_glGetTexGendv = glad_glGetTexGendv;
+	glad_debug_glGetTexGenfv = glad_glGetTexGenfv;
+	glad_debug_glGetTexGeniv = glad_glGetTexGeniv;
+	glad_debug_glIsList = glad_glIsList;
+	glad_debug_glFrustum = glad_glFrustum;
+	glad_debug_glLoadIdentity = glad_glLoadIdentity;
+	glad_debug_glLoadMatrixf = glad_glLoadMatrixf;
+	glad_debug_glLoadMatrixd = glad_glLoadMatrixd;
+	glad_debug_glMatrixMode = glad_glMatrixMode;
+	glad_debug_glMultMatrixf = glad_glMultMatrixf;
+	glad_debug_glMultMatrixd = glad_glMultMatrixd;
+	glad_debug_glOrtho = glad_glOrtho;
+	glad_debug_glPopMatrix = glad_glPopMatrix;
+	glad_debug_glPushMatrix = glad_glPushMatrix;
+	glad_debug_glRotated = glad_glRotated;
+	glad_debug_glRotatef = glad_glRotatef;
+	glad_debug_glScaled = glad_glScaled;
+	glad_debug_glScalef = glad_glScalef;
+	glad_debug_glTranslated = glad_glTranslated;
+	glad_debug_glTranslatef = glad_glTranslatef;
+	glad_debug_glDrawArrays = glad_glDrawArrays;
+	glad_debug_glDrawElements = glad_glDrawElements;
+	glad_debug_glGetPointerv = glad_glGetPointerv;
+	glad_debug_glPolygonOffset = glad_glPolygonOffset;
+	glad_debug_glCopyTexImage1D = glad_glCopyTexImage1D;
+	glad_debug_glCopyTexImage2D = glad_glCopyTexImage2D;
+	glad_debug_glCopyTexSubImage1D = glad_glCopyTexSubImage1D;
+	glad_debug_glCopyTexSubImage2D = glad_glCopyTexSubImage2D;
+	glad_debug_glTexSubImage1D = glad_glTexSubImage1D;
+	glad_debug_glTexSubImage2D = glad_glTexSubImage2D;
+	glad_debug_glBindTexture = glad_glBindTexture;
+	glad_debug_glDeleteTextures = glad_glDeleteTextures;
+	glad_debug_glGenTextures = glad_glGenTextures;
+	glad_debug_glIsTexture = glad_glIsTexture;
+	glad_debug_glArrayElement = glad_glArrayElement;
+	glad_debug_glColorPointer = glad_glColorPointer;
+	glad_debug_glDisableClientState = glad_glDisableClientState;
+	glad_debug_glEdgeFlagPointer = glad_glEdgeFlagPointer;
+	glad_debug_glEnableClientState = glad_glEnableClientState;
+	glad_debug_glIndexPointer = glad_glIndexPointer;
+	glad_debug_glInterleavedArrays = glad_glInterleavedArrays;
+	glad_debug_glNormalPointer = glad_glNormalPointer;
+	glad_debug_glTexCoordPointer = glad_glTexCoordPointer;
+	glad_debug_glVertexPointer = glad_glVertexPointer;
+	glad_debug_glAreTexturesResident = glad_glAreTexturesResident;
+	glad_debug_glPrioritizeTextures = glad_glPrioritizeTextures;
+	glad_debug_glIndexub = glad_glIndexub;
+	glad_debug_glIndexubv = glad_glIndexubv;
+	glad_debug_glPopClientAttrib = glad_glPopClientAttrib;
+	glad_debug_glPushClientAttrib = glad_glPushClientAttrib;
+	glad_debug_glDrawRangeElements = glad_glDrawRangeElements;
+	glad_debug_glTexImage3D = glad_glTexImage3D;
+	glad_debug_glTexSubImage3D = glad_glTexSubImage3D;
+	glad_debug_glCopyTexSubImage3D = glad_glCopyTexSubImage3D;
+	glad_debug_glActiveTexture = glad_glActiveTexture;
+	glad_debug_glSampleCoverage = glad_glSampleCoverage;
+	glad_debug_glCompressedTexImage3D = glad_glCompressedTexImage3D;
+	glad_debug_glCompressedTexImage2D = glad_glCompressedTexImage2D;
+	glad_debug_glCompressedTexImage1D = glad_glCompressedTexImage1D;
+	glad_debug_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+	glad_debug_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+	glad_debug_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+	glad_debug_glGetCompressedTexImage = glad_glGetCompressedTexImage;
+	glad_debug_glClientActiveTexture = glad_glClientActiveTexture;
+	glad_debug_glMultiTexCoord1d = glad_glMultiTexCoord1d;
+	glad_debug_glMultiTexCoord1dv = glad_glMultiTexCoord1dv;
+	glad_debug_glMultiTexCoord1f = glad_glMultiTexCoord1f;
+	glad_debug_glMultiTexCoord1fv = glad_glMultiTexCoord1fv;
+	glad_debug_glMultiTexCoord1i = glad_glMultiTexCoord1i;
+	glad_debug_glMultiTexCoord1iv = glad_glMultiTexCoord1iv;
+	glad_debug_glMultiTexCoord1s = glad_glMultiTexCoord1s;
+	glad_debug_glMultiTexCoord1sv = glad_glMultiTexCoord1sv;
+	glad_debug_glMultiTexCoord2d = glad_glMultiTexCoord2d;
+	glad_debug_glMultiTexCoord2dv = glad_glMultiTexCoord2dv;
+	glad_debug_glMultiTexCoord2f = glad_glMultiTexCoord2f;
+	glad_debug_glMultiTexCoord2fv = glad_glMultiTexCoord2fv;
+	glad_debug_glMultiTexCoord2i = glad_glMultiTexCoord2i;
+	glad_debug_glMultiTexCoord2iv = glad_glMultiTexCoord2iv;
+	glad_debug_glMultiTexCoord2s = glad_glMultiTexCoord2s;
+	glad_debug_glMultiTexCoord2sv = glad_glMultiTexCoord2sv;
+	glad_debug_glMultiTexCoord3d = glad_glMultiTexCoord3d;
+	glad_debug_glMultiTexCoord3dv = glad_glMultiTexCoord3dv;
+	glad_debug_glMultiTexCoord3f = glad_glMultiTexCoord3f;
+	glad_debug_glMultiTexCoord3fv = glad_glMultiTexCoord3fv;
+	glad_debug_glMultiTexCoord3i = glad_glMultiTexCoord3i;
+	glad_debug_glMultiTexCoord3iv = glad_glMultiTexCoord3iv;
+	glad_debug_glMultiTexCoord3s = glad_glMultiTexCoord3s;
+	glad_debug_glMultiTexCoord3sv = glad_glMultiTexCoord3sv;
+	glad_debug_glMultiTexCoord4d = glad_glMultiTexCoord4d;
+	glad_debug_glMultiTexCoord4dv = glad_glMultiTexCoord4dv;
+	glad_debug_glMultiTexCoord4f = glad_glMultiTexCoord4f;
+	glad_debug_glMultiTexCoord4fv = glad_glMultiTexCoord4fv;
+	glad_debug_glMultiTexCoord4i = glad_glMultiTexCoord4i;
+	glad_debug_glMultiTexCoord4iv = glad_glMultiTexCoord4iv;
+	glad_debug_glMultiTexCoord4s = glad_glMultiTexCoord4s;
+	glad_debug_glMultiTexCoord4sv = glad_glMultiTexCoord4sv;
+	glad_debug_glLoadTransposeMatrixf = glad_glLoadTransposeMatrixf;
+	glad_debug_glLoadTransposeMatrixd = glad_glLoadTransposeMatrixd;
+	glad_debug_glMultTransposeMatrixf = glad_glMultTransposeMatrixf;
+	glad_debug_glMultTransposeMatrixd = glad_glMultTransposeMatrixd;
+	glad_debug_glBlendFuncSeparate = glad_glBlendFuncSeparate;
+	glad_debug_glMultiDrawArrays = glad_glMultiDrawArrays;
+	glad_debug_glMultiDrawElements = glad_glMultiDrawElements;
+	glad_debug_glPointParameterf = glad_glPointParameterf;
+	glad_debug_glPointParameterfv = glad_glPointParameterfv;
+	glad_debug_glPointParameteri = glad_glPointParameteri;
+	glad_debug_glPointParameteriv = glad_glPointParameteriv;
+	glad_debug_glFogCoordf = glad_glFogCoordf;
+	glad_debug_glFogCoordfv = glad_glFogCoordfv;
+	glad_debug_glFogCoordd = glad_glFogCoordd;
+	glad_debug_glFogCoorddv = glad_glFogCoorddv;
+	glad_debug_glFogCoordPointer = glad_glFogCoordPointer;
+	glad_debug_glSecondaryColor3b = glad_glSecondaryColor3b;
+	glad_debug_glSecondaryColor3bv = glad_glSecondaryColor3bv;
+	glad_debug_glSecondaryColor3d = glad_glSecondaryColor3d;
+	glad_debug_glSecondaryColor3dv = glad_glSecondaryColor3dv;
+	glad_debug_glSecondaryColor3f = glad_glSecondaryColor3f;
+	glad_debug_glSecondaryColor3fv = glad_glSecondaryColor3fv;
+	glad_debug_glSecondaryColor3i = glad_glSecondaryColor3i;
+	glad_debug_glSecondaryColor3iv = glad_glSecondaryColor3iv;
+	glad_debug_glSecondaryColor3s = glad_glSecondaryColor3s;
+	glad_debug_glSecondaryColor3sv = glad_glSecondaryColor3sv;
+	glad_debug_glSecondaryColor3ub = glad_glSecondaryColor3ub;
+	glad_debug_glSecondaryColor3ubv = glad_glSecondaryColor3ubv;
+	glad_debug_glSecondaryColor3ui = glad_glSecondaryColor3ui;
+	glad_debug_glSecondaryColor3uiv = glad_glSecondaryColor3uiv;
+	glad_debug_glSecondaryColor3us = glad_glSecondaryColor3us;
+	glad_debug_glSecondaryColor3usv = glad_glSecondaryColor3usv;
+	glad_debug_glSecondaryColorPointer = glad_glSecondaryColorPointer;
+	glad_debug_glWindowPos2d = glad_glWindowPos2d;
+	glad_debug_glWindowPos2dv = glad_glWindowPos2dv;
+	glad_debug_glWindowPos2f = glad_glWindowPos2f;
+	glad_debug_glWindowPos2fv = glad_glWindowPos2fv;
+	glad_debug_glWindowPos2i = glad_glWindowPos2i;
+	glad_debug_glWindowPos2iv = glad_glWindowPos2iv;
+	glad_debug_glWindowPos2s = glad_glWindowPos2s;
+	glad_debug_glWindowPos2sv = glad_glWindowPos2sv;
+	glad_debug_glWindowPos3d = glad_glWindowPos3d;
+	glad_debug_glWindowPos3dv = glad_glWindowPos3dv;
+	glad_debug_glWindowPos3f = glad_glWindowPos3f;
+	glad_debug_glWindowPos3fv = glad_glWindowPos3fv;
+	glad_debug_glWindowPos3i = glad_glWindowPos3i;
+	glad_debug_glWindowPos3iv = glad_glWindowPos3iv;
+	glad_debug_glWindowPos3s = glad_glWindowPos3s;
+	glad_debug_glWindowPos3sv = glad_glWindowPos3sv;
+	glad_debug_glBlendColor = glad_glBlendColor;
+	glad_debug_glBlendEquation = glad_glBlendEquation;
+	glad_debug_glGenQueries = glad_glGenQueries;
+	glad_debug_glDeleteQueries = glad_glDeleteQueries;
+	glad_debug_glIsQuery = glad_glIsQuery;
+	glad_debug_glBeginQuery = glad_glBeginQuery;
+	glad_debug_glEndQuery = glad_glEndQuery;
+	glad_debug_glGetQueryiv = glad_glGetQueryiv;
+	glad_debug_glGetQueryObjectiv = glad_glGetQueryObjectiv;
+	glad_debug_glGetQueryObjectuiv = glad_glGetQueryObjectuiv;
+	glad_debug_glBindBuffer = glad_glBindBuffer;
+	glad_debug_glDeleteBuffers = glad_glDeleteBuffers;
+	glad_debug_glGenBuffers = glad_glGenBuffers;
+	glad_debug_glIsBuffer = glad_glIsBuffer;
+	glad_debug_glBufferData = glad_glBufferData;
+	glad_debug_glBufferSubData = glad_glBufferSubData;
+	glad_debug_glGetBufferSubData = glad_glGetBufferSubData;
+	glad_debug_glMapBuffer = glad_glMapBuffer;
+	glad_debug_glUnmapBuffer = glad_glUnmapBuffer;
+	glad_debug_glGetBufferParameteriv = glad_glGetBufferParameteriv;
+	glad_debug_glGetBufferPointerv = glad_glGetBufferPointerv;
+	glad_debug_glBlendEquationSeparate = glad_glBlendEquationSeparate;
+	glad_debug_glDrawBuffers = glad_glDrawBuffers;
+	glad_debug_glStencilOpSeparate = glad_glStencilOpSeparate;
+	glad_debug_glStencilFuncSeparate = glad_glStencilFuncSeparate;
+	glad_debug_glStencilMaskSeparate = glad_glStencilMaskSeparate;
+	glad_debug_glAttachShader = glad_glAttachShader;
+	glad_debug_glBindAttribLocation = glad_glBindAttribLocation;
+	glad_debug_glCompileShader = glad_glCompileShader;
+	glad_debug_glCreateProgram = glad_glCreateProgram;
+	glad_debug_glCreateShader = glad_glCreateShader;
+	glad_debug_glDeleteProgram = glad_glDeleteProgram;
+	glad_debug_glDeleteShader = glad_glDeleteShader;
+	glad_debug_glDetachShader = glad_glDetachShader;
+	glad_debug_glDisableVertexAttribArray = glad_glDisableVertexAttribArray;
+	glad_debug_glEnableVertexAttribArray = glad_glEnableVertexAttribArray;
+	glad_debug_glGetActiveAttrib = glad_glGetActiveAttrib;
+	glad_debug_glGetActiveUniform = glad_glGetActiveUniform;
+	glad_debug_glGetAttachedShaders = glad_glGetAttachedShaders;
+	glad_debug_glGetAttribLocation = glad_glGetAttribLocation;
+	glad_debug_glGetProgramiv = glad_glGetProgramiv;
+	glad_debug_glGetProgramInfoLog = glad_glGetProgramInfoLog;
+	glad_debug_glGetShaderiv = glad_glGetShaderiv;
+	glad_debug_glGetShaderInfoLog = glad_glGetShaderInfoLog;
+	glad_debug_glGetShaderSource = glad_glGetShaderSource;
+	glad_debug_glGetUniformLocation = glad_glGetUniformLocation;
+	glad_debug_glGetUniformfv = glad_glGetUniformfv;
+	glad_debug_glGetUniformiv = glad_glGetUniformiv;
+	glad_debug_glGetVertexAttribdv = glad_glGetVertexAttribdv;
+	glad_debug_glGetVertexAttribfv = glad_glGetVertexAttribfv;
+	glad_debug_glGetVertexAttribiv = glad_glGetVertexAttribiv;
+	glad_debug_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+	glad_debug_glIsProgram = glad_glIsProgram;
+	glad_debug_glIsShader = glad_glIsShader;
+	glad_debug_glLinkProgram = glad_glLinkProgram;
+	glad_debug_glShaderSource = glad_glShaderSource;
+	glad_debug_glUseProgram = glad_glUseProgram;
+	glad_debug_glUniform1f = glad_glUniform1f;
+	glad_debug_glUniform2f = glad_glUniform2f;
+	glad_debug_glUniform3f = glad_glUniform3f;
+	glad_debug_glUniform4f = glad_glUniform4f;
+	glad_debug_glUniform1i = glad_glUniform1i;
+	glad_debug_glUniform2i = glad_glUniform2i;
+	glad_debug_glUniform3i = glad_glUniform3i;
+	glad_debug_glUniform4i = glad_glUniform4i;
+	glad_debug_glUniform1fv = glad_glUniform1fv;
+	glad_debug_glUniform2fv = glad_glUniform2fv;
+	glad_debug_glUniform3fv = glad_glUniform3fv;
+	glad_debug_glUniform4fv = glad_glUniform4fv;
+	glad_debug_glUniform1iv = glad_glUniform1iv;
+	glad_debug_glUniform2iv = glad_glUniform2iv;
+	glad_debug_glUniform3iv = glad_glUniform3iv;
+	glad_debug_glUniform4iv = glad_glUniform4iv;
+	glad_debug_glUniformMatrix2fv = glad_glUniformMatrix2fv;
+	glad_debug_glUniformMatrix3fv = glad_glUniformMatrix3fv;
+	glad_debug_glUniformMatrix4fv = glad_glUniformMatrix4fv;
+	glad_debug_glValidateProgram = glad_glValidateProgram;
+	glad_debug_glVertexAttrib1d = glad_glVertexAttrib1d;
+	glad_debug_glVertexAttrib1dv = glad_glVertexAttrib1dv;
+	glad_debug_glVertexAttrib1f = glad_glVertexAttrib1f;
+	glad_debug_glVertexAttrib1fv = glad_glVertexAttrib1fv;
+	glad_debug_glVertexAttrib1s = glad_glVertexAttrib1s;
+	glad_debug_glVertexAttrib1sv = glad_glVertexAttrib1sv;
+	glad_debug_glVertexAttrib2d = glad_glVertexAttrib2d;
+	glad_debug_glVertexAttrib2dv = glad_glVertexAttrib2dv;
+	glad_debug_glVertexAttrib2f = glad_glVertexAttrib2f;
+	glad_debug_glVertexAttrib2fv = glad_glVertexAttrib2fv;
+	glad_debug_glVertexAttrib2s = glad_glVertexAttrib2s;
+	glad_debug_glVertexAttrib2sv = glad_glVertexAttrib2sv;
+	glad_debug_glVertexAttrib3d = glad_glVertexAttrib3d;
+	glad_debug_glVertexAttrib3dv = glad_glVertexAttrib3dv;
+	glad_debug_glVertexAttrib3f = glad_glVertexAttrib3f;
+	glad_debug_glVertexAttrib3fv = glad_glVertexAttrib3fv;
+	glad_debug_glVertexAttrib3s = glad_glVertexAttrib3s;
+	glad_debug_glVertexAttrib3sv = glad_glVertexAttrib3sv;
+	glad_debug_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+	glad_debug_glVertexAttrib4Niv = glad_glVertexAttrib4Niv;
+	glad_debug_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+	glad_debug_glVertexAttrib4Nub = glad_glVertexAttrib4Nub;
+	glad_debug_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+	glad_debug_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+	glad_debug_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+	glad_debug_glVertexAttrib4bv = glad_glVertexAttrib4bv;
+	glad_debug_glVertexAttrib4d = glad_glVertexAttrib4d;
+	glad_debug_glVertexAttrib4dv = glad_glVertexAttrib4dv;
+	glad_debug_glVertexAttrib4f = glad_glVertexAttrib4f;
+	glad_debug_glVertexAttrib4fv = glad_glVertexAttrib4fv;
+	glad_debug_glVertexAttrib4iv = glad_glVertexAttrib4iv;
+	glad_debug_glVertexAttrib4s = glad_glVertexAttrib4s;
+	glad_debug_glVertexAttrib4sv = glad_glVertexAttrib4sv;
+	glad_debug_glVertexAttrib4ubv = glad_glVertexAttrib4ubv;
+	glad_debug_glVertexAttrib4uiv = glad_glVertexAttrib4uiv;
+	glad_debug_glVertexAttrib4usv = glad_glVertexAttrib4usv;
+	glad_debug_glVertexAttribPointer = glad_glVertexAttribPointer;
+	glad_debug_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+	glad_debug_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+	glad_debug_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+	glad_debug_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+	glad_debug_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+	glad_debug_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+	glad_debug_glColorMaski = glad_glColorMaski;
+	glad_debug_glGetBooleani_v = glad_glGetBooleani_v;
+	glad_debug_glGetIntegeri_v = glad_glGetIntegeri_v;
+	glad_debug_glEnablei = glad_glEnablei;
+	glad_debug_glDisablei = glad_glDisablei;
+	glad_debug_glIsEnabledi = glad_glIsEnabledi;
+	glad_debug_glBeginTransformFeedback = glad_glBeginTransformFeedback;
+	glad_debug_glEndTransformFeedback = glad_glEndTransformFeedback;
+	glad_debug_glBindBufferRange = glad_glBindBufferRange;
+	glad_debug_glBindBufferBase = glad_glBindBufferBase;
+	glad_debug_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+	glad_debug_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+	glad_debug_glClampColor = glad_glClampColor;
+	glad_debug_glBeginConditionalRender = glad_glBeginConditionalRender;
+	glad_debug_glEndConditionalRender = glad_glEndConditionalRender;
+	glad_debug_glVertexAttribIPointer = glad_glVertexAttribIPointer;
+	glad_debug_glGetVertexAttribIiv = glad_glGetVertexAttribIiv;
+	glad_debug_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+	glad_debug_glVertexAttribI1i = glad_glVertexAttribI1i;
+	glad_debug_glVertexAttribI2i = glad_glVertexAttribI2i;
+	glad_debug_glVertexAttribI3i = glad_glVertexAttribI3i;
+	glad_debug_glVertexAttribI4i = glad_glVertexAttribI4i;
+	glad_debug_glVertexAttribI1ui = glad_glVertexAttribI1ui;
+	glad_debug_glVertexAttribI2ui = glad_glVertexAttribI2ui;
+	glad_debug_glVertexAttribI3ui = glad_glVertexAttribI3ui;
+	glad_debug_glVertexAttribI4ui = glad_glVertexAttribI4ui;
+	glad_debug_glVertexAttribI1iv = glad_glVertexAttribI1iv;
+	glad_debug_glVertexAttribI2iv = glad_glVertexAttribI2iv;
+	glad_debug_glVertexAttribI3iv = glad_glVertexAttribI3iv;
+	glad_debug_glVertexAttribI4iv = glad_glVertexAttribI4iv;
+	glad_debug_glVertexAttribI1uiv = glad_glVertexAttribI1uiv;
+	glad_debug_glVertexAttribI2uiv = glad_glVertexAttribI2uiv;
+	glad_debug_glVertexAttribI3uiv = glad_glVertexAttribI3uiv;
+	glad_debug_glVertexAttribI4uiv = glad_glVertexAttribI4uiv;
+	glad_debug_glVertexAttribI4bv = glad_glVertexAttribI4bv;
+	glad_debug_glVertexAttribI4sv = glad_glVertexAttribI4sv;
+	glad_debug_glVertexAttribI4ubv = glad_glVertexAttribI4ubv;
+	glad_debug_glVertexAttribI4usv = glad_glVertexAttribI4usv;
+	glad_debug_glGetUniformuiv = glad_glGetUniformuiv;
+	glad_debug_glBindFragDataLocation = glad_glBindFragDataLocation;
+	glad_debug_glGetFragDataLocation = glad_glGetFragDataLocation;
+	glad_debug_glUniform1ui = glad_glUniform1ui;
+	glad_debug_glUniform2ui = glad_glUniform2ui;
+	glad_debug_glUniform3ui = glad_glUniform3ui;
+	glad_debug_glUniform4ui = glad_glUniform4ui;
+	glad_debug_glUniform1uiv = glad_glUniform1uiv;
+	glad_debug_glUniform2uiv = glad_glUniform2uiv;
+	glad_debug_glUniform3uiv = glad_glUniform3uiv;
+	glad_debug_glUniform4uiv = glad_glUniform4uiv;
+	glad_debug_glTexParameterIiv = glad_glTexParameterIiv;
+	glad_debug_glTexParameterIuiv = glad_glTexParameterIuiv;
+	glad_debug_glGetTexParameterIiv = glad_glGetTexParameterIiv;
+	glad_debug_glGetTexParameterIuiv = glad_glGetTexParameterIuiv;
+	glad_debug_glClearBufferiv = glad_glClearBufferiv;
+	glad_debug_glClearBufferuiv = glad_glClearBufferuiv;
+	glad_debug_glClearBufferfv = glad_glClearBufferfv;
+	glad_debug_glClearBufferfi = glad_glClearBufferfi;
+	glad_debug_glGetStringi = glad_glGetStringi;
+	glad_debug_glIsRenderbuffer = glad_glIsRenderbuffer;
+	glad_debug_glBindRenderbuffer = glad_glBindRenderbuffer;
+	glad_debug_glDeleteRenderbuffers = glad_glDeleteRenderbuffers;
+	glad_debug_glGenRenderbuffers = glad_glGenRenderbuffers;
+	glad_debug_glRenderbufferStorage = glad_glRenderbufferStorage;
+	glad_debug_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+	glad_debug_glIsFramebuffer = glad_glIsFramebuffer;
+	glad_debug_glBindFramebuffer = glad_glBindFramebuffer;
+	glad_debug_glDeleteFramebuffers = glad_glDeleteFramebuffers;
+	glad_debug_glGenFramebuffers = glad_glGenFramebuffers;
+	glad_debug_glCheckFramebufferStatus = glad_glCheckFramebufferStatus;
+	glad_debug_glFramebufferTexture1D = glad_glFramebufferTexture1D;
+	glad_debug_glFramebufferTexture2D = glad_glFramebufferTexture2D;
+	glad_debug_glFramebufferTexture3D = glad_glFramebufferTexture3D;
+	glad_debug_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+	glad_debug_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+	glad_debug_glGenerateMipmap = glad_glGenerateMipmap;
+	glad_debug_glBlitFramebuffer = glad_glBlitFramebuffer;
+	glad_debug_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+	glad_debug_glFramebufferTextureLayer = glad_glFramebufferTextureLayer;
+	glad_debug_glMapBufferRange = glad_glMapBufferRange;
+	glad_debug_glFlushMappedBufferRange = glad_glFlushMappedBufferRange;
+	glad_debug_glBindVertexArray = glad_glBindVertexArray;
+	glad_debug_glDeleteVertexArrays = glad_glDeleteVertexArrays;
+	glad_debug_glGenVertexArrays = glad_glGenVertexArrays;
+	glad_debug_glIsVertexArray = glad_glIsVertexArray;
+	glad_debug_glDrawArraysInstanced = glad_glDrawArraysInstanced;
+	glad_debug_glDrawElementsInstanced = glad_glDrawElementsInstanced;
+	glad_debug_glTexBuffer = glad_glTexBuffer;
+	glad_debug_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+	glad_debug_glCopyBufferSubData = glad_glCopyBufferSubData;
+	glad_debug_glGetUniformIndices = glad_glGetUniformIndices;
+	glad_debug_glGetActiveUniformsiv = glad_glGetActiveUniformsiv;
+	glad_debug_glGetActiveUniformName = glad_glGetActiveUniformName;
+	glad_debug_glGetUniformBlockIndex = glad_glGetUniformBlockIndex;
+	glad_debug_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+	glad_debug_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+	glad_debug_glUniformBlockBinding = glad_glUniformBlockBinding;
+	glad_debug_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+	glad_debug_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+	glad_debug_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+	glad_debug_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+	glad_debug_glProvokingVertex = glad_glProvokingVertex;
+	glad_debug_glFenceSync = glad_glFenceSync;
+	glad_debug_glIsSync = glad_glIsSync;
+	glad_debug_glDeleteSync = glad_glDeleteSync;
+	glad_debug_glClientWaitSync = glad_glClientWaitSync;
+	glad_debug_glWaitSync = glad_glWaitSync;
+	glad_debug_glGetInteger64v = glad_glGetInteger64v;
+	glad_debug_glGetSynciv = glad_glGetSynciv;
+	glad_debug_glGetInteger64i_v = glad_glGetInteger64i_v;
+	glad_debug_glGetBufferParameteri64v = glad_glGetBufferParameteri64v;
+	glad_debug_glFramebufferTexture = glad_glFramebufferTexture;
+	glad_debug_glTexImage2DMultisample = glad_glTexImage2DMultisample;
+	glad_debug_glTexImage3DMultisample = glad_glTexImage3DMultisample;
+	glad_debug_glGetMultisamplefv = glad_glGetMultisamplefv;
+	glad_debug_glSampleMaski = glad_glSampleMaski;
+	glad_debug_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+	glad_debug_glGetFragDataIndex = glad_glGetFragDataIndex;
+	glad_debug_glGenSamplers = glad_glGenSamplers;
+	glad_debug_glDeleteSamplers = glad_glDeleteSamplers;
+	glad_debug_glIsSampler = glad_glIsSampler;
+	glad_debug_glBindSampler = glad_glBindSampler;
+	glad_debug_glSamplerParameteri = glad_glSamplerParameteri;
+	glad_debug_glSamplerParameteriv = glad_glSamplerParameteriv;
+	glad_debug_glSamplerParameterf = glad_glSamplerParameterf;
+	glad_debug_glSamplerParameterfv = glad_glSamplerParameterfv;
+	glad_debug_glSamplerParameterIiv = glad_glSamplerParameterIiv;
+	glad_debug_glSamplerParameterIuiv = glad_glSamplerParameterIuiv;
+	glad_debug_glGetSamplerParameteriv = glad_glGetSamplerParameteriv;
+	glad_debug_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+	glad_debug_glGetSamplerParameterfv = glad_glGetSamplerParameterfv;
+	glad_debug_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+	glad_debug_glQueryCounter = glad_glQueryCounter;
+	glad_debug_glGetQueryObjecti64v = glad_glGetQueryObjecti64v;
+	glad_debug_glGetQueryObjectui64v = glad_glGetQueryObjectui64v;
+	glad_debug_glVertexAttribDivisor = glad_glVertexAttribDivisor;
+	glad_debug_glVertexAttribP1ui = glad_glVertexAttribP1ui;
+	glad_debug_glVertexAttribP1uiv = glad_glVertexAttribP1uiv;
+	glad_debug_glVertexAttribP2ui = glad_glVertexAttribP2ui;
+	glad_debug_glVertexAttribP2uiv = glad_glVertexAttribP2uiv;
+	glad_debug_glVertexAttribP3ui = glad_glVertexAttribP3ui;
+	glad_debug_glVertexAttribP3uiv = glad_glVertexAttribP3uiv;
+	glad_debug_glVertexAttribP4ui = glad_glVertexAttribP4ui;
+	glad_debug_glVertexAttribP4uiv = glad_glVertexAttribP4uiv;
+	glad_debug_glVertexP2ui = glad_glVertexP2ui;
+	glad_debug_glVertexP2uiv = glad_glVertexP2uiv;
+	glad_debug_glVertexP3ui = glad_glVertexP3ui;
+	glad_debug_glVertexP3uiv = glad_glVertexP3uiv;
+	glad_debug_glVertexP4ui = glad_glVertexP4ui;
+	glad_debug_glVertexP4uiv = glad_glVertexP4uiv;
+	glad_debug_glTexCoordP1ui = glad_glTexCoordP1ui;
+	glad_debug_glTexCoordP1uiv = glad_glTexCoordP1uiv;
+	glad_debug_glTexCoordP2ui = glad_glTexCoordP2ui;
+	glad_debug_glTexCoordP2uiv = glad_glTexCoordP2uiv;
+	glad_debug_glTexCoordP3ui = glad_glTexCoordP3ui;
+	glad_debug_glTexCoordP3uiv = glad_glTexCoordP3uiv;
+	glad_debug_glTexCoordP4ui = glad_glTexCoordP4ui;
+	glad_debug_glTexCoordP4uiv = glad_glTexCoordP4uiv;
+	glad_debug_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+	glad_debug_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+	glad_debug_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+	glad_debug_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+	glad_debug_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+	glad_debug_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+	glad_debug_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+	glad_debug_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+	glad_debug_glNormalP3ui = glad_glNormalP3ui;
+	glad_debug_glNormalP3uiv = glad_glNormalP3uiv;
+	glad_debug_glColorP3ui = glad_glColorP3ui;
+	glad_debug_glColorP3uiv = glad_glColorP3uiv;
+	glad_debug_glColorP4ui = glad_glColorP4ui;
+	glad_debug_glColorP4uiv = glad_glColorP4uiv;
+	glad_debug_glSecondaryColorP3ui = glad_glSecondaryColorP3ui;
+	glad_debug_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+	glad_debug_glDebugMessageControl = glad_glDebugMessageControl;
+	glad_debug_glDebugMessageInsert = glad_glDebugMessageInsert;
+	glad_debug_glDebugMessageCallback = glad_glDebugMessageCallback;
+	glad_debug_glGetDebugMessageLog = glad_glGetDebugMessageLog;
+	glad_debug_glPushDebugGroup = glad_glPushDebugGroup;
+	glad_debug_glPopDebugGroup = glad_glPopDebugGroup;
+	glad_debug_glObjectLabel = glad_glObjectLabel;
+	glad_debug_glGetObjectLabel = glad_glGetObjectLabel;
+	glad_debug_glObjectPtrLabel = glad_glObjectPtrLabel;
+	glad_debug_glGetObjectPtrLabel = glad_glGetObjectPtrLabel;
+	_glad_debug_installed = 0;
+}
+
 int gladLoadGLLoader(GLADloadproc load) {
 	GLVersion.major = 0; GLVersion.minor = 0;
-	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
-	if(glGetString == NULL) return 0;
-	if(glGetString(GL_VERSION) == NULL) return 0;
+	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glad_glGetString == NULL) return 0;
+	if(glad_glGetString(GL_VERSION) == NULL) return 0;
 	find_coreGL();
 	load_GL_VERSION_1_0(load);
 	load_GL_VERSION_1_1(load);
@@ -1835,6 +7843,8 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_KHR_debug(load);
+	if(!_glad_debug_installed) gladUninstallGLDebug();
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
@@ -0,0 +1,822 @@
+#include "glCapture.h"
+#include "glCaptureFormat.h"
+
+#include <glad/glad.h>
+#include <glHooks.h>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    //------- stream -------
+    struct Mapping
+    {
+        char* pointer;
+        GLintptr offset;
+        GLsizeiptr length;
+        GLbitfield access;
+    };
+
+    struct Recorder
+    {
+        FILE* file = NULL;
+        vector<char> stream;
+        uint64_t written = 0;           // bytes in the file before stream
+        int frameLimit = 0;
+        int frames = 0;
+        bool inFrame = false;
+        uint64_t calls = 0;
+        uint64_t dedupedBytes = 0;
+
+        // identical uploads: the content hash leads to candidate blobs, compared in full
+        vector<vector<char>> blobs;
+        unordered_multimap<uint64_t, uint32_t> blobIndex;
+
+        // what the trampolines need to know to size and classify the memory a call reads
+        GLuint arrayBuffer = 0;
+        GLuint pixelUnpackBuffer = 0;
+        GLuint pixelPackBuffer = 0;
+        GLuint vertexArray = 0;
+        unordered_map<GLuint, GLuint> elementBuffers;   // per vertex array
+        unordered_map<GLenum, Mapping> mappings;        // per target
+        GLint unpackAlignment = 4, unpackRowLength = 0, unpackSkipRows = 0, unpackSkipPixels = 0;
+
+        unordered_map<const char*, bool> known;         // GLAD name literal -> captured
+        bool warnedClientArrays = false;
+    };
+    Recorder rec;
+
+    // a trampoline left in the chain after stop passes calls on and records nothing
+    void raw(const void* data, size_t size)
+    {
+        if (!rec.file)
+            return;
+        rec.stream.insert(rec.stream.end(), (const char*)data, (const char*)data + size);
+    }
+
+    void flush()
+    {
+        if (rec.stream.empty())
+            return;
+        fwrite(rec.stream.data(), 1, rec.stream.size(), rec.file);
+        rec.written += rec.stream.size();
+        rec.stream.clear();
+    }
+
+    void putU8(uint8_t v) { raw(&v, 1); }
+    void putU32(uint32_t v) { raw(&v, 4); }
+    void putI64(int64_t v) { raw(&v, 8); }
+    void putU64(uint64_t v) { raw(&v, 8); }
+
+    void put(unsigned int v) { putU32(v); }
+    void put(int v) { raw(&v, 4); }
+    void put(unsigned char v) { putU32(v); }
+    void put(float v) { raw(&v, 4); }
+    void put(double v) { raw(&v, 8); }
+
+    // a call with plain value arguments
+    template <typename... Args>
+    void record(CaptureOp op, Args... args)
+    {
+        uint16_t code = op;
+        raw(&code, 2);
+        (put(args), ...);
+        rec.calls++;
+    }
+
+    void pad()
+    {
+        if (!rec.file)
+            return;
+        uint64_t offset = rec.written + rec.stream.size();
+        rec.stream.resize(rec.stream.size() + (kCaptureBlobAlignment - offset % kCaptureBlobAlignment) % kCaptureBlobAlignment, 0);
+    }
+
+    uint64_t hashBytes(const void* data, size_t size)
+    {
+        // FNV-1a
+        uint64_t h = 14695981039346656037ull;
+        const unsigned char* p = (const unsigned char*)data;
+        for (size_t i = 0; i < size; i++)
+            h = (h ^ p[i]) * 1099511628211ull;
+        return h;
+    }
+
+    void putBlob(const void* data, size_t size)
+    {
+        if (!rec.file)
+            return;
+        if (!data)
+        {
+            putU8(BlobNull);
+            return;
+        }
+        if (size < kCaptureDedupMinSize)
+        {
+            putU8(BlobInline);
+            putU32((uint32_t)size);
+            pad();
+            raw(data, size);
+            return;
+        }
+        uint64_t hash = hashBytes(data, size);
+        auto range = rec.blobIndex.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            const vector<char>& blob = rec.blobs[it->second];
+            if (blob.size() == size && !memcmp(blob.data(), data, size))
+            {
+                putU8(BlobRef);
+                putU32(it->second);
+                rec.dedupedBytes += size;
+                return;
+            }
+        }
+        rec.blobIndex.emplace(hash, (uint32_t)rec.blobs.size());
+        rec.blobs.emplace_back((const char*)data, (const char*)data + size);
+        putU8(BlobNew);
+        putU32((uint32_t)size);
+        pad();
+        raw(data, size);
+    }
+
+    void putString(const char* s, GLint length)
+    {
+        putBlob(s, s ? (length < 0 ? strlen(s) : (size_t)length) : 0);
+    }
+
+    // a pointer that is an offset into the bound buffer when there is one, client memory otherwise
+    void putPointer(GLuint boundBuffer, const void* pointer, size_t size)
+    {
+        putU8(boundBuffer ? 1 : 0);
+        if (boundBuffer)
+            putU64((uint64_t)(uintptr_t)pointer);
+        else
+            putBlob(pointer, size);
+    }
+
+    void putSync(GLsync sync)
+    {
+        putU64((uint64_t)(uintptr_t)sync);
+    }
+
+    //------- memory sizes -------
+    size_t pixelBytes(GLenum format, GLenum type)
+    {
+        switch (type)
+        {
+        case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+            return 1;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV: case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_4_4_4_4_REV: case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+            return 2;
+        case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV: case GL_UNSIGNED_INT_10_10_10_2:
+        case GL_UNSIGNED_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV:
+        case GL_UNSIGNED_INT_5_9_9_9_REV:
+            return 4;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+            return 8;
+        }
+        size_t component = type == GL_UNSIGNED_SHORT || type == GL_SHORT || type == GL_HALF_FLOAT ? 2 :
+            type == GL_UNSIGNED_INT || type == GL_INT || type == GL_FLOAT ? 4 : 1;
+        switch (format)
+        {
+        case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL: case GL_LUMINANCE_ALPHA:
+            return component * 2;
+        case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+            return component * 3;
+        case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+            return component * 4;
+        default:
+            return component;
+        }
+    }
+
+    // bytes an upload reads from its pointer under the current unpack state
+    size_t imageBytes(GLsizei width, GLsizei height, GLenum format, GLenum type)
+    {
+        if (width <= 0 || height <= 0)
+            return 0;
+        size_t pixel = pixelBytes(format, type);
+        size_t row = (size_t)(rec.unpackRowLength > 0 ? rec.unpackRowLength : width) * pixel;
+        row = (row + rec.unpackAlignment - 1) / rec.unpackAlignment * rec.unpackAlignment;
+        return (size_t)(rec.unpackSkipRows + height - 1) * row + (size_t)(rec.unpackSkipPixels + width) * pixel;
+    }
+
+    size_t indexBytes(GLsizei count, GLenum type)
+    {
+        return (size_t)count * (type == GL_UNSIGNED_INT ? 4 : type == GL_UNSIGNED_SHORT ? 2 : 1);
+    }
+
+    GLuint elementBuffer()
+    {
+        auto it = rec.elementBuffers.find(rec.vertexArray);
+        return it != rec.elementBuffers.end() ? it->second : 0;
+    }
+
+    //------- trampolines -------
+#define GL_CAPTURE_REAL(name) decltype(glad_##name) real_##name = NULL;
+    GL_CAPTURE_CALLS(GL_CAPTURE_REAL)
+#undef GL_CAPTURE_REAL
+
+    // a trampoline that only records value arguments: all of them, or for queries the ones
+    // before the result pointers (replayed into scratch memory)
+#define GL_CAPTURE_QUERY(name, params, args, recorded) \
+    void APIENTRY capture_##name params \
+    { \
+        real_##name args; \
+        record(Op_##name GL_CAPTURE_COMMA recorded); \
+    }
+#define GL_CAPTURE_VALUES(name, params, args) \
+    void APIENTRY capture_##name params \
+    { \
+        real_##name args; \
+        record(Op_##name GL_CAPTURE_COMMA args); \
+    }
+#define GL_CAPTURE_COMMA(...) , __VA_ARGS__
+
+    GL_CAPTURE_VALUES(glActiveTexture, (GLenum texture), (texture))
+    GL_CAPTURE_VALUES(glAttachShader, (GLuint program, GLuint shader), (program, shader))
+    GL_CAPTURE_VALUES(glBeginQuery, (GLenum target, GLuint id), (target, id))
+    GL_CAPTURE_VALUES(glBindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+    GL_CAPTURE_VALUES(glBindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer))
+    GL_CAPTURE_VALUES(glBindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+    GL_CAPTURE_VALUES(glBindTexture, (GLenum target, GLuint texture), (target, texture))
+    GL_CAPTURE_VALUES(glBlendEquation, (GLenum mode), (mode))
+    GL_CAPTURE_VALUES(glBlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+    GL_CAPTURE_VALUES(glBlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha),
+        (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+    GL_CAPTURE_VALUES(glBlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0,
+        GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+    GL_CAPTURE_VALUES(glClear, (GLbitfield mask), (mask))
+    GL_CAPTURE_VALUES(glClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+    GL_CAPTURE_VALUES(glClearDepth, (GLdouble depth), (depth))
+    GL_CAPTURE_VALUES(glColorMask, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+    GL_CAPTURE_VALUES(glCompileShader, (GLuint shader), (shader))
+    GL_CAPTURE_VALUES(glCullFace, (GLenum mode), (mode))
+    GL_CAPTURE_VALUES(glDeleteProgram, (GLuint program), (program))
+    GL_CAPTURE_VALUES(glDeleteShader, (GLuint shader), (shader))
+    GL_CAPTURE_VALUES(glDepthFunc, (GLenum func), (func))
+    GL_CAPTURE_VALUES(glDepthMask, (GLboolean flag), (flag))
+    GL_CAPTURE_VALUES(glDetachShader, (GLuint program, GLuint shader), (program, shader))
+    GL_CAPTURE_VALUES(glDisable, (GLenum cap), (cap))
+    GL_CAPTURE_VALUES(glDisableVertexAttribArray, (GLuint index), (index))
+    GL_CAPTURE_VALUES(glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+    GL_CAPTURE_VALUES(glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount),
+        (mode, first, count, instancecount))
+    GL_CAPTURE_VALUES(glDrawBuffer, (GLenum buf), (buf))
+    GL_CAPTURE_VALUES(glEnable, (GLenum cap), (cap))
+    GL_CAPTURE_VALUES(glEnableVertexAttribArray, (GLuint index), (index))
+    GL_CAPTURE_VALUES(glEndQuery, (GLenum target), (target))
+    GL_CAPTURE_VALUES(glFramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer),
+        (target, attachment, renderbuffertarget, renderbuffer))
+    GL_CAPTURE_VALUES(glFramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level),
+        (target, attachment, textarget, texture, level))
+    GL_CAPTURE_VALUES(glFrontFace, (GLenum mode), (mode))
+    GL_CAPTURE_VALUES(glGenerateMipmap, (GLenum target), (target))
+    GL_CAPTURE_QUERY(glGetIntegerv, (GLenum pname, GLint* data), (pname, data), (pname))
+    GL_CAPTURE_QUERY(glGetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (program, bufSize, length, infoLog), (program, bufSize))
+    GL_CAPTURE_QUERY(glGetProgramiv, (GLuint program, GLenum pname, GLint* params), (program, pname, params), (program, pname))
+    GL_CAPTURE_QUERY(glGetQueryObjectiv, (GLuint id, GLenum pname, GLint* params), (id, pname, params), (id, pname))
+    GL_CAPTURE_QUERY(glGetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64* params), (id, pname, params), (id, pname))
+    GL_CAPTURE_QUERY(glGetQueryObjectuiv, (GLuint id, GLenum pname, GLuint* params), (id, pname, params), (id, pname))
+    GL_CAPTURE_QUERY(glGetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (shader, bufSize, length, infoLog), (shader, bufSize))
+    GL_CAPTURE_QUERY(glGetShaderiv, (GLuint shader, GLenum pname, GLint* params), (shader, pname, params), (shader, pname))
+    GL_CAPTURE_VALUES(glLinkProgram, (GLuint program), (program))
+    GL_CAPTURE_VALUES(glPolygonMode, (GLenum face, GLenum mode), (face, mode))
+    GL_CAPTURE_VALUES(glPolygonOffset, (GLfloat factor, GLfloat units), (factor, units))
+    GL_CAPTURE_VALUES(glQueryCounter, (GLuint id, GLenum target), (id, target))
+    GL_CAPTURE_VALUES(glReadBuffer, (GLenum src), (src))
+    GL_CAPTURE_VALUES(glRenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height),
+        (target, internalformat, width, height))
+    GL_CAPTURE_VALUES(glRenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height),
+        (target, samples, internalformat, width, height))
+    GL_CAPTURE_VALUES(glScissor, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+    GL_CAPTURE_VALUES(glTexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+    GL_CAPTURE_VALUES(glTexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+    GL_CAPTURE_VALUES(glUniform1f, (GLint location, GLfloat v0), (location, v0))
+    GL_CAPTURE_VALUES(glUniform1i, (GLint location, GLint v0), (location, v0))
+    GL_CAPTURE_VALUES(glUniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+    GL_CAPTURE_VALUES(glUniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+    GL_CAPTURE_VALUES(glUniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+    GL_CAPTURE_VALUES(glUniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding),
+        (program, uniformBlockIndex, uniformBlockBinding))
+    GL_CAPTURE_VALUES(glUseProgram, (GLuint program), (program))
+    GL_CAPTURE_VALUES(glVertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor))
+    GL_CAPTURE_VALUES(glViewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+#undef GL_CAPTURE_VALUES
+#undef GL_CAPTURE_QUERY
+
+    void APIENTRY capture_glFinish()
+    {
+        real_glFinish();
+        record(Op_glFinish);
+    }
+
+    void APIENTRY capture_glFlush()
+    {
+        real_glFlush();
+        record(Op_glFlush);
+    }
+
+    void APIENTRY capture_glPopDebugGroup()
+    {
+        real_glPopDebugGroup();
+        record(Op_glPopDebugGroup);
+    }
+
+    GLenum APIENTRY capture_glGetError()
+    {
+        GLenum error = real_glGetError();
+        record(Op_glGetError);
+        return error;
+    }
+
+    const GLubyte* APIENTRY capture_glGetString(GLenum name)
+    {
+        const GLubyte* s = real_glGetString(name);
+        record(Op_glGetString, name);
+        return s;
+    }
+
+    GLenum APIENTRY capture_glCheckFramebufferStatus(GLenum target)
+    {
+        GLenum status = real_glCheckFramebufferStatus(target);
+        record(Op_glCheckFramebufferStatus, target);
+        return status;
+    }
+
+    //------- names -------
+    // glGen* record the names the driver returned, so the replay can map its own onto them
+#define GL_CAPTURE_NAMES(gen, del) \
+    void APIENTRY capture_##gen(GLsizei n, GLuint* names) \
+    { \
+        real_##gen(n, names); \
+        record(Op_##gen, n); \
+        putBlob(names, n > 0 ? n * sizeof(GLuint) : 0); \
+    } \
+    void APIENTRY capture_##del(GLsizei n, const GLuint* names) \
+    { \
+        real_##del(n, names); \
+        record(Op_##del, n); \
+        putBlob(names, n > 0 ? n * sizeof(GLuint) : 0); \
+    }
+
+    GL_CAPTURE_NAMES(glGenBuffers, glDeleteBuffers)
+    GL_CAPTURE_NAMES(glGenFramebuffers, glDeleteFramebuffers)
+    GL_CAPTURE_NAMES(glGenQueries, glDeleteQueries)
+    GL_CAPTURE_NAMES(glGenRenderbuffers, glDeleteRenderbuffers)
+    GL_CAPTURE_NAMES(glGenTextures, glDeleteTextures)
+    GL_CAPTURE_NAMES(glGenVertexArrays, glDeleteVertexArrays)
+#undef GL_CAPTURE_NAMES
+
+    GLuint APIENTRY capture_glCreateProgram()
+    {
+        GLuint program = real_glCreateProgram();
+        record(Op_glCreateProgram, program);
+        return program;
+    }
+
+    GLuint APIENTRY capture_glCreateShader(GLenum type)
+    {
+        GLuint shader = real_glCreateShader(type);
+        record(Op_glCreateShader, type, shader);
+        return shader;
+    }
+
+    GLint APIENTRY capture_glGetUniformLocation(GLuint program, const GLchar* name)
+    {
+        GLint location = real_glGetUniformLocation(program, name);
+        record(Op_glGetUniformLocation, program, location);
+        putString(name, -1);
+        return location;
+    }
+
+    GLuint APIENTRY capture_glGetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName)
+    {
+        GLuint index = real_glGetUniformBlockIndex(program, uniformBlockName);
+        record(Op_glGetUniformBlockIndex, program, index);
+        putString(uniformBlockName, -1);
+        return index;
+    }
+
+    void APIENTRY capture_glBindAttribLocation(GLuint program, GLuint index, const GLchar* name)
+    {
+        real_glBindAttribLocation(program, index, name);
+        record(Op_glBindAttribLocation, program, index);
+        putString(name, -1);
+    }
+
+    void APIENTRY capture_glShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+    {
+        real_glShaderSource(shader, count, string, length);
+        record(Op_glShaderSource, shader, count);
+        for (GLsizei i = 0; i < count; i++)
+            putString(string[i], length ? length[i] : -1);
+    }
+
+    void APIENTRY capture_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar* label)
+    {
+        real_glObjectLabel(identifier, name, length, label);
+        record(Op_glObjectLabel, identifier, name);
+        putString(label, length);
+    }
+
+    void APIENTRY capture_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar* message)
+    {
+        real_glPushDebugGroup(source, id, length, message);
+        record(Op_glPushDebugGroup, source, id);
+        putString(message, length);
+    }
+
+    //------- syncs -------
+    GLsync APIENTRY capture_glFenceSync(GLenum condition, GLbitfield flags)
+    {
+        GLsync sync = real_glFenceSync(condition, flags);
+        record(Op_glFenceSync, condition, flags);
+        putSync(sync);
+        return sync;
+    }
+
+    GLenum APIENTRY capture_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        GLenum result = real_glClientWaitSync(sync, flags, timeout);
+        record(Op_glClientWaitSync);
+        putSync(sync);
+        putU32(flags);
+        putU64(timeout);
+        return result;
+    }
+
+    void APIENTRY capture_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        real_glWaitSync(sync, flags, timeout);
+        record(Op_glWaitSync);
+        putSync(sync);
+        putU32(flags);
+        putU64(timeout);
+    }
+
+    void APIENTRY capture_glDeleteSync(GLsync sync)
+    {
+        real_glDeleteSync(sync);
+        record(Op_glDeleteSync);
+        putSync(sync);
+    }
+
+    //------- buffers -------
+    void APIENTRY capture_glBindBuffer(GLenum target, GLuint buffer)
+    {
+        real_glBindBuffer(target, buffer);
+        record(Op_glBindBuffer, target, buffer);
+        if (target == GL_ARRAY_BUFFER)
+            rec.arrayBuffer = buffer;
+        else if (target == GL_ELEMENT_ARRAY_BUFFER)
+            rec.elementBuffers[rec.vertexArray] = buffer;
+        else if (target == GL_PIXEL_UNPACK_BUFFER)
+            rec.pixelUnpackBuffer = buffer;
+        else if (target == GL_PIXEL_PACK_BUFFER)
+            rec.pixelPackBuffer = buffer;
+    }
+
+    void APIENTRY capture_glBindVertexArray(GLuint array)
+    {
+        real_glBindVertexArray(array);
+        record(Op_glBindVertexArray, array);
+        rec.vertexArray = array;
+    }
+
+    void APIENTRY capture_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        real_glBindBufferRange(target, index, buffer, offset, size);
+        record(Op_glBindBufferRange, target, index, buffer);
+        putI64(offset);
+        putI64(size);
+    }
+
+    void APIENTRY capture_glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+    {
+        real_glBufferData(target, size, data, usage);
+        record(Op_glBufferData, target);
+        putI64(size);
+        putBlob(data, size);
+        putU32(usage);
+    }
+
+    void APIENTRY capture_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+    {
+        real_glBufferSubData(target, offset, size, data);
+        record(Op_glBufferSubData, target);
+        putI64(offset);
+        putI64(size);
+        putBlob(data, size);
+    }
+
+    void APIENTRY capture_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+    {
+        real_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+        record(Op_glCopyBufferSubData, readTarget, writeTarget);
+        putI64(readOffset);
+        putI64(writeOffset);
+        putI64(size);
+    }
+
+    // writes through a mapping reach the stream when they are flushed or unmapped
+    bool mappedForWriting(const Mapping& m)
+    {
+        return m.pointer && (m.access & GL_MAP_WRITE_BIT);
+    }
+
+    void* APIENTRY capture_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+    {
+        void* pointer = real_glMapBufferRange(target, offset, length, access);
+        record(Op_glMapBufferRange, target);
+        putI64(offset);
+        putI64(length);
+        putU32(access);
+        rec.mappings[target] = { (char*)pointer, offset, length, access };
+        return pointer;
+    }
+
+    void* APIENTRY capture_glMapBuffer(GLenum target, GLenum access)
+    {
+        void* pointer = real_glMapBuffer(target, access);
+        record(Op_glMapBuffer, target, access);
+        GLint size = 0;
+        glad_glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+        rec.mappings[target] = { (char*)pointer, 0, size, access == GL_READ_ONLY ? (GLbitfield)GL_MAP_READ_BIT : (GLbitfield)GL_MAP_WRITE_BIT };
+        return pointer;
+    }
+
+    void APIENTRY capture_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+    {
+        const Mapping& m = rec.mappings[target];
+        record(Op_glFlushMappedBufferRange, target);
+        putI64(offset);
+        putI64(length);
+        putBlob(mappedForWriting(m) ? m.pointer + offset : NULL, length);
+        real_glFlushMappedBufferRange(target, offset, length);
+    }
+
+    GLboolean APIENTRY capture_glUnmapBuffer(GLenum target)
+    {
+        Mapping& m = rec.mappings[target];
+        bool whole = mappedForWriting(m) && !(m.access & GL_MAP_FLUSH_EXPLICIT_BIT);
+        record(Op_glUnmapBuffer, target);
+        putBlob(whole ? m.pointer : NULL, m.length);
+        m = {};
+        return real_glUnmapBuffer(target);
+    }
+
+    //------- vertex input and draws -------
+    void warnClientArrays()
+    {
+        if (!rec.warnedClientArrays)
+            printf("WARNING: Client-side vertex arrays are not captured, the replay reads them as buffer offsets.\n");
+        rec.warnedClientArrays = true;
+    }
+
+    void APIENTRY capture_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)
+    {
+        real_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+        record(Op_glVertexAttribPointer, index, size, type, normalized, stride);
+        putU64((uint64_t)(uintptr_t)pointer);
+        if (!rec.arrayBuffer)
+            warnClientArrays();
+    }
+
+    void APIENTRY capture_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer)
+    {
+        real_glVertexAttribIPointer(index, size, type, stride, pointer);
+        record(Op_glVertexAttribIPointer, index, size, type, stride);
+        putU64((uint64_t)(uintptr_t)pointer);
+        if (!rec.arrayBuffer)
+            warnClientArrays();
+    }
+
+    void APIENTRY capture_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+    {
+        real_glDrawElements(mode, count, type, indices);
+        record(Op_glDrawElements, mode, count, type);
+        putPointer(elementBuffer(), indices, indexBytes(count, type));
+    }
+
+    void APIENTRY capture_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex)
+    {
+        real_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+        record(Op_glDrawElementsBaseVertex, mode, count, type);
+        putPointer(elementBuffer(), indices, indexBytes(count, type));
+        put(basevertex);
+    }
+
+    void APIENTRY capture_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount)
+    {
+        real_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+        record(Op_glDrawElementsInstanced, mode, count, type);
+        putPointer(elementBuffer(), indices, indexBytes(count, type));
+        put(instancecount);
+    }
+
+    void APIENTRY capture_glDrawBuffers(GLsizei n, const GLenum* bufs)
+    {
+        real_glDrawBuffers(n, bufs);
+        record(Op_glDrawBuffers, n);
+        putBlob(bufs, n > 0 ? n * sizeof(GLenum) : 0);
+    }
+
+    //------- textures and pixels -------
+    void APIENTRY capture_glPixelStorei(GLenum pname, GLint param)
+    {
+        real_glPixelStorei(pname, param);
+        record(Op_glPixelStorei, pname, param);
+        if (pname == GL_UNPACK_ALIGNMENT)
+            rec.unpackAlignment = param;
+        else if (pname == GL_UNPACK_ROW_LENGTH)
+            rec.unpackRowLength = param;
+        else if (pname == GL_UNPACK_SKIP_ROWS)
+            rec.unpackSkipRows = param;
+        else if (pname == GL_UNPACK_SKIP_PIXELS)
+            rec.unpackSkipPixels = param;
+    }
+
+    void APIENTRY capture_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+        GLint border, GLenum format, GLenum type, const void* pixels)
+    {
+        real_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+        record(Op_glTexImage2D, target, level, internalformat, width, height, border, format, type);
+        putPointer(rec.pixelUnpackBuffer, pixels, imageBytes(width, height, format, type));
+    }
+
+    void APIENTRY capture_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height,
+        GLenum format, GLenum type, const void* pixels)
+    {
+        real_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+        record(Op_glTexSubImage2D, target, level, xoffset, yoffset, width, height, format, type);
+        putPointer(rec.pixelUnpackBuffer, pixels, imageBytes(width, height, format, type));
+    }
+
+    // reads into client memory are replayed into scratch memory, only the offset into a pack buffer matters
+    void APIENTRY capture_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels)
+    {
+        real_glReadPixels(x, y, width, height, format, type, pixels);
+        record(Op_glReadPixels, x, y, width, height, format, type);
+        putU8(rec.pixelPackBuffer ? 1 : 0);
+        putU64(rec.pixelPackBuffer ? (uint64_t)(uintptr_t)pixels : 0);
+    }
+
+    //------- uniform arrays -------
+#define GL_CAPTURE_UNIFORMS(name, type, components) \
+    void APIENTRY capture_##name(GLint location, GLsizei count, const type* value) \
+    { \
+        real_##name(location, count, value); \
+        record(Op_##name, location, count); \
+        putBlob(value, count > 0 ? count * components * sizeof(type) : 0); \
+    }
+
+    GL_CAPTURE_UNIFORMS(glUniform1fv, GLfloat, 1)
+    GL_CAPTURE_UNIFORMS(glUniform2fv, GLfloat, 2)
+    GL_CAPTURE_UNIFORMS(glUniform3fv, GLfloat, 3)
+    GL_CAPTURE_UNIFORMS(glUniform4fv, GLfloat, 4)
+    GL_CAPTURE_UNIFORMS(glUniform1iv, GLint, 1)
+#undef GL_CAPTURE_UNIFORMS
+
+    void APIENTRY capture_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+    {
+        real_glUniformMatrix3fv(location, count, transpose, value);
+        record(Op_glUniformMatrix3fv, location, count, transpose);
+        putBlob(value, count > 0 ? count * 9 * sizeof(GLfloat) : 0);
+    }
+
+    void APIENTRY capture_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+    {
+        real_glUniformMatrix4fv(location, count, transpose, value);
+        record(Op_glUniformMatrix4fv, location, count, transpose);
+        putBlob(value, count > 0 ? count * 16 * sizeof(GLfloat) : 0);
+    }
+
+    //------- install -------
+    // debug output is configured by the application's own layer, a replay has nothing to report to
+    const char* const kIgnored[] = { "glDebugMessageCallback", "glDebugMessageControl", "glDebugMessageInsert",
+        "glGetDebugMessageLog", "glGetObjectLabel" };
+
+    // GLAD pre-call callback: every call passes here, captured or not
+    void noticeCall(const char* name, void* /*funcptr*/, int /*argNum*/, ...)
+    {
+        auto it = rec.known.find(name);
+        if (it != rec.known.end())
+            return;
+#define GL_CAPTURE_NAME(entry) #entry,
+        static const char* const captured[] = { GL_CAPTURE_CALLS(GL_CAPTURE_NAME) };
+#undef GL_CAPTURE_NAME
+        bool known = false;
+        for (const char* c : captured)
+            known = known || !strcmp(c, name);
+        for (const char* c : kIgnored)
+            known = known || !strcmp(c, name);
+        rec.known.emplace(name, known);
+        if (!known)
+            printf("WARNING: %s is not captured, the replay will not make it.\n", name);
+    }
+}
+
+GLCapture& GLCapture::instance()
+{
+    static GLCapture capture;
+    return capture;
+}
+
+bool GLCapture::start(const char* filename, int frameNum, int width, int height)
+{
+    stop();
+    if (width <= 0 || height <= 0)
+    {
+        GLint viewport[4] = {};
+        glad_glGetIntegerv(GL_VIEWPORT, viewport);
+        width = viewport[2];
+        height = viewport[3];
+    }
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+    {
+        printf("ERROR: Cannot write GL capture \"%s\".\n", filename);
+        return false;
+    }
+    rec = Recorder();
+    rec.file = f;
+    rec.frameLimit = frameNum;
+    uint32_t header[5] = { kCaptureMagic, kCaptureVersion, (uint32_t)width, (uint32_t)height, 0 };
+    fwrite(header, sizeof(header), 1, f);
+    rec.written = sizeof(header);
+
+#define GL_CAPTURE_SWAP_IN(name) glHookIn(glad_##name, glad_debug_##name, real_##name, capture_##name);
+    GL_CAPTURE_CALLS(GL_CAPTURE_SWAP_IN)
+#undef GL_CAPTURE_SWAP_IN
+    glAddCallbacks(noticeCall, NULL);
+    return true;
+}
+
+void GLCapture::stop()
+{
+    if (!rec.file)
+        return;
+    // only the entry points that still lead to the capture: hooks swapped in later stay intact
+#define GL_CAPTURE_SWAP_OUT(name) glHookOut(glad_##name, glad_debug_##name, real_##name, capture_##name);
+    GL_CAPTURE_CALLS(GL_CAPTURE_SWAP_OUT)
+#undef GL_CAPTURE_SWAP_OUT
+    glRemoveCallbacks(noticeCall, NULL);
+
+    flush();
+    FILE* f = rec.file;
+    uint32_t frames = rec.frames;
+    bool ok = !ferror(f);
+    fseek(f, 4 * sizeof(uint32_t), SEEK_SET);
+    ok = fwrite(&frames, sizeof(frames), 1, f) == 1 && ok;
+    ok = fclose(f) == 0 && ok;
+    if (!ok)
+        printf("ERROR: Failed writing GL capture.\n");
+    else
+        printf("GL capture: %d frames, %llu calls, %.1f MB (%.1f MB of repeated uploads stored once)\n", rec.frames,
+            (unsigned long long)rec.calls, rec.written / (1024.0 * 1024.0), rec.dedupedBytes / (1024.0 * 1024.0));
+    rec = Recorder();
+}
+
+bool GLCapture::capturing() const
+{
+    return rec.file != NULL;
+}
+
+int GLCapture::frameNum() const
+{
+    return rec.frames;
+}
+
+uint64_t GLCapture::callNum() const
+{
+    return rec.calls;
+}
+
+void GLCapture::beginFrame()
+{
+    if (!rec.file || rec.inFrame)
+        return;
+    uint16_t op = OpBeginFrame;
+    raw(&op, 2);
+    rec.inFrame = true;
+}
+
+void GLCapture::endFrame()
+{
+    if (!rec.file || !rec.inFrame)
+        return;
+    uint16_t op = OpEndFrame;
+    raw(&op, 2);
+    rec.inFrame = false;
+    rec.frames++;
+    flush();
+    if (rec.frames >= rec.frameLimit)
+        stop();
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+// Records the GL command stream for a number of frames into a file that GLReplay (and the
+// glReplay tool) plays back on a headless context.
+//
+//     GLCapture& capture = GLCapture::instance();
+//     capture.start("frames.glcap", 120);      // right after gladLoadGLLoader
+//     ...setup...
+//     capture.beginFrame(); ...frame...; capture.endFrame();   // stops by itself after 120 frames
+//
+// Each captured entry point (GL_CAPTURE_CALLS in glCaptureFormat.h) is swapped for a
+// trampoline that calls the driver and appends the call to the stream, together with the
+// memory it reads: buffer and texture uploads, shader sources, uniform arrays, client-side
+// indices and writes through mapped buffers. Object names, uniform locations and syncs are
+// stored as the application saw them and remapped on replay, framebuffer 0 becomes the
+// replay's render target. Uploads of 256 bytes or more that repeat are stored once.
+//
+// Start before the first object is created: a replay cannot recreate what it has not seen.
+// Calls that are not captured are reported once each; they go through the GLAD debug hooks to
+// be noticed, which GLStats and GpuMemory share (glHooks.h). Single GL thread.
+class GLCapture
+{
+public:
+    static GLCapture& instance();
+
+    // needs a current context with GLAD loaded; width and height describe the default
+    // framebuffer, 0 takes them from the current viewport
+    bool start(const char* filename, int frameNum, int width = 0, int height = 0);
+    void stop();
+    bool capturing() const;
+
+    void beginFrame();
+    void endFrame();
+
+    int frameNum() const;
+    uint64_t callNum() const;
+
+private:
+    // the recording state lives with the trampolines in glCapture.cpp
+    GLCapture() = default;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+// The GLCapture file, little-endian:
+//
+//     header   uint32 magic, version, width, height (default framebuffer), frame count
+//     calls    uint16 op followed by its arguments in parameter order
+//
+// Integer-like arguments (enums, names, counts, booleans, locations) are 32 bits, GLintptr,
+// GLsizeiptr, GLuint64, syncs and buffer offsets 64 bits, floats and doubles keep their size.
+// Referenced memory is a blob: uint8 kind, then for Inline and New a uint32 size, padding to
+// the next multiple of 8 bytes in the file and the bytes; for Ref the uint32 id of an earlier
+// New blob. A pointer that may be a buffer offset is a uint8 flag, 1 followed by the offset
+// or 0 followed by a blob. OpBeginFrame and OpEndFrame bracket the frames.
+//
+// Ops are numbered by their position in GL_CAPTURE_CALLS: append new entry points at the
+// end, or bump kCaptureVersion.
+
+const uint32_t kCaptureMagic = 0x31434C47;     // "GLC1"
+const uint32_t kCaptureVersion = 1;
+const uint32_t kCaptureBlobAlignment = 8;
+const uint32_t kCaptureDedupMinSize = 256;     // smaller blobs are always stored inline
+
+enum CaptureBlob : uint8_t
+{
+    BlobNull,
+    BlobInline,
+    BlobNew,
+    BlobRef,
+};
+
+#define GL_CAPTURE_CALLS(X) \
+    X(glActiveTexture) X(glAttachShader) X(glBeginQuery) X(glBindAttribLocation) X(glBindBuffer) \
+    X(glBindBufferBase) X(glBindBufferRange) X(glBindFramebuffer) X(glBindRenderbuffer) X(glBindTexture) \
+    X(glBindVertexArray) X(glBlendEquation) X(glBlendFunc) X(glBlendFuncSeparate) X(glBlitFramebuffer) \
+    X(glBufferData) X(glBufferSubData) X(glCheckFramebufferStatus) X(glClear) X(glClearColor) \
+    X(glClearDepth) X(glClientWaitSync) X(glColorMask) X(glCompileShader) X(glCopyBufferSubData) \
+    X(glCreateProgram) X(glCreateShader) X(glCullFace) X(glDeleteBuffers) X(glDeleteFramebuffers) \
+    X(glDeleteProgram) X(glDeleteQueries) X(glDeleteRenderbuffers) X(glDeleteShader) X(glDeleteSync) \
+    X(glDeleteTextures) X(glDeleteVertexArrays) X(glDepthFunc) X(glDepthMask) X(glDetachShader) \
+    X(glDisable) X(glDisableVertexAttribArray) X(glDrawArrays) X(glDrawArraysInstanced) X(glDrawBuffer) \
+    X(glDrawBuffers) X(glDrawElements) X(glDrawElementsBaseVertex) X(glDrawElementsInstanced) X(glEnable) \
+    X(glEnableVertexAttribArray) X(glEndQuery) X(glFenceSync) X(glFinish) X(glFlush) \
+    X(glFlushMappedBufferRange) X(glFramebufferRenderbuffer) X(glFramebufferTexture2D) X(glFrontFace) X(glGenBuffers) \
+    X(glGenFramebuffers) X(glGenQueries) X(glGenRenderbuffers) X(glGenTextures) X(glGenVertexArrays) \
+    X(glGenerateMipmap) X(glGetError) X(glGetIntegerv) X(glGetProgramInfoLog) X(glGetProgramiv) \
+    X(glGetQueryObjectiv) X(glGetQueryObjectui64v) X(glGetQueryObjectuiv) X(glGetShaderInfoLog) X(glGetShaderiv) \
+    X(glGetString) X(glGetUniformBlockIndex) X(glGetUniformLocation) X(glLinkProgram) X(glMapBuffer) \
+    X(glMapBufferRange) X(glObjectLabel) X(glPixelStorei) X(glPolygonMode) X(glPolygonOffset) \
+    X(glPopDebugGroup) X(glPushDebugGroup) X(glQueryCounter) X(glReadBuffer) X(glReadPixels) \
+    X(glRenderbufferStorage) X(glRenderbufferStorageMultisample) X(glScissor) X(glShaderSource) X(glTexImage2D) \
+    X(glTexParameterf) X(glTexParameteri) X(glTexSubImage2D) X(glUniform1f) X(glUniform1fv) \
+    X(glUniform1i) X(glUniform1iv) X(glUniform2f) X(glUniform2fv) X(glUniform3f) \
+    X(glUniform3fv) X(glUniform4f) X(glUniform4fv) X(glUniformBlockBinding) X(glUniformMatrix3fv) \
+    X(glUniformMatrix4fv) X(glUnmapBuffer) X(glUseProgram) X(glVertexAttribDivisor) X(glVertexAttribIPointer) \
+    X(glVertexAttribPointer) X(glViewport) X(glWaitSync)
+
+enum CaptureOp : uint16_t
+{
+    OpBeginFrame,
+    OpEndFrame,
+#define GL_CAPTURE_OP(name) Op_##name,
+    GL_CAPTURE_CALLS(GL_CAPTURE_OP)
+#undef GL_CAPTURE_OP
+    OpCount
+};
@@ -0,0 +1,743 @@
+#include "glReplay.h"
+#include "glCaptureFormat.h"
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+//------- decoding -------
+
+bool GLReplay::load(const char* filename)
+{
+    blobs.clear();
+    error = false;
+    if (!file.open(filename))
+    {
+        printf("ERROR: Cannot open GL capture \"%s\".\n", filename);
+        return false;
+    }
+    uint32_t header[5];
+    if (file.size() < sizeof(header))
+    {
+        printf("ERROR: Invalid GL capture \"%s\".\n", filename);
+        return false;
+    }
+    memcpy(header, file.data(), sizeof(header));
+    if (header[0] != kCaptureMagic || header[1] != kCaptureVersion)
+    {
+        printf("ERROR: \"%s\" is not a version %u GL capture.\n", filename, kCaptureVersion);
+        return false;
+    }
+    w = (int)header[2];
+    h = (int)header[3];
+    frames = (int)header[4];
+    cursor = file.data() + sizeof(header);
+    end = file.data() + file.size();
+    return true;
+}
+
+uint8_t GLReplay::u8()
+{
+    uint8_t v = 0;
+    if (cursor + 1 > end)
+        error = true;
+    else
+        v = (uint8_t)*cursor++;
+    return v;
+}
+
+uint32_t GLReplay::u32()
+{
+    uint32_t v = 0;
+    if (cursor + 4 > end)
+        error = true;
+    else
+        memcpy(&v, cursor, 4);
+    cursor += 4;
+    return v;
+}
+
+float GLReplay::f32()
+{
+    uint32_t bits = u32();
+    float v;
+    memcpy(&v, &bits, 4);
+    return v;
+}
+
+uint64_t GLReplay::u64()
+{
+    uint64_t v = 0;
+    if (cursor + 8 > end)
+        error = true;
+    else
+        memcpy(&v, cursor, 8);
+    cursor += 8;
+    return v;
+}
+
+int64_t GLReplay::i64()
+{
+    return (int64_t)u64();
+}
+
+double GLReplay::f64()
+{
+    uint64_t bits = u64();
+    double v;
+    memcpy(&v, &bits, 8);
+    return v;
+}
+
+const void* GLReplay::blob(size_t* size)
+{
+    uint8_t kind = u8();
+    const char* data = nullptr;
+    uint32_t length = 0;
+    if (kind == BlobInline || kind == BlobNew)
+    {
+        length = u32();
+        size_t offset = cursor - file.data();
+        cursor += (kCaptureBlobAlignment - offset % kCaptureBlobAlignment) % kCaptureBlobAlignment;
+        data = cursor;
+        cursor += length;
+        if (cursor > end)
+            error = true;
+        if (kind == BlobNew)
+            blobs.push_back({ data, length });
+    }
+    else if (kind == BlobRef)
+    {
+        uint32_t id = u32();
+        if (id < blobs.size())
+        {
+            data = blobs[id].first;
+            length = blobs[id].second;
+        }
+        else
+            error = true;
+    }
+    else if (kind != BlobNull)
+        error = true;
+    if (size)
+        *size = length;
+    return error ? nullptr : data;
+}
+
+const void* GLReplay::pointer()
+{
+    if (u8())
+        return (const void*)(uintptr_t)u64();
+    return blob();
+}
+
+// captured strings are not terminated: the length goes with them
+const char* GLReplay::string(int& length)
+{
+    size_t size;
+    const char* s = (const char*)blob(&size);
+    length = (int)size;
+    return s;
+}
+
+//------- names -------
+
+void GLReplay::NameMap::set(unsigned int captured, unsigned int name)
+{
+    if (captured >= names.size())
+        names.resize(captured + 1, 0);
+    names[captured] = name;
+}
+
+int GLReplay::location(int captured) const
+{
+    if (captured < 0)
+        return captured;
+    auto it = locations.find((uint64_t)program << 32 | (uint32_t)captured);
+    return it != locations.end() ? it->second : captured;
+}
+
+unsigned int GLReplay::objectName(unsigned int identifier, unsigned int captured) const
+{
+    switch (identifier)
+    {
+    case GL_BUFFER: return buffers(captured);
+    case GL_TEXTURE: return textures(captured);
+    case GL_VERTEX_ARRAY: return vertexArrays(captured);
+    case GL_FRAMEBUFFER: return framebuffer(captured);
+    case GL_RENDERBUFFER: return renderbuffers(captured);
+    case GL_QUERY: return queries(captured);
+    default: return programs(captured);
+    }
+}
+
+unsigned int GLReplay::framebuffer(unsigned int captured) const
+{
+    return captured ? framebuffers(captured) : defaultTarget;
+}
+
+// the default framebuffer's color buffers are the target's first attachment
+unsigned int GLReplay::colorBuffer(unsigned int buffer, bool draw) const
+{
+    if ((draw ? drawFramebuffer : readFramebuffer) || !defaultTarget)
+        return buffer;
+    switch (buffer)
+    {
+    case GL_BACK: case GL_FRONT: case GL_BACK_LEFT: case GL_FRONT_LEFT: case GL_LEFT: case GL_FRONT_AND_BACK:
+        return GL_COLOR_ATTACHMENT0;
+    default:
+        return buffer;
+    }
+}
+
+//------- playback -------
+
+void GLReplay::begin(unsigned int defaultFramebuffer)
+{
+    defaultTarget = defaultFramebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, defaultTarget);
+    drawTarget = defaultTarget;
+    viewport[0] = viewport[1] = 0;
+    viewport[2] = w;
+    viewport[3] = h;
+    memcpy(drawViewport, viewport, sizeof(viewport));
+    glViewport(0, 0, w, h);
+}
+
+bool GLReplay::nextFrame()
+{
+    if (!play(OpBeginFrame))
+        return false;
+    if (!firstFrame)
+    {
+        firstFrame = cursor;
+        firstFrameBlobs = blobs.size();
+    }
+    return true;
+}
+
+bool GLReplay::playFrame()
+{
+    return play(OpEndFrame);
+}
+
+void GLReplay::rewindFrames()
+{
+    if (!firstFrame)
+        return;
+    // the frame's blobs are read again and get the same ids
+    cursor = firstFrame - sizeof(uint16_t);
+    blobs.resize(firstFrameBlobs);
+}
+
+bool GLReplay::play(uint16_t stopOp)
+{
+    while (!error && cursor + sizeof(uint16_t) <= end)
+    {
+        uint16_t op;
+        memcpy(&op, cursor, sizeof(op));
+        cursor += sizeof(op);
+        if (op == stopOp)
+            return true;
+        if (op == OpBeginFrame || op == OpEndFrame)
+            continue;
+        if (op >= OpCount || !call(op))
+            error = true;
+    }
+    if (error)
+        printf("ERROR: Invalid GL capture at byte %llu.\n", (unsigned long long)(cursor - file.data()));
+    return false;
+}
+
+bool GLReplay::call(uint16_t op)
+{
+    calls++;
+    if (scratch.empty())
+        scratch.resize(1 << 16);
+    GLint* scratchInts = (GLint*)scratch.data();
+    switch (op)
+    {
+    //------- state -------
+    case Op_glActiveTexture: glActiveTexture(u32()); break;
+    case Op_glBlendEquation: glBlendEquation(u32()); break;
+    case Op_glBlendFunc: { GLenum s = u32(); glBlendFunc(s, u32()); break; }
+    case Op_glBlendFuncSeparate: { GLenum a = u32(), b = u32(), c = u32(); glBlendFuncSeparate(a, b, c, u32()); break; }
+    case Op_glClear: glClear(u32()); break;
+    case Op_glClearColor: { float r = f32(), g = f32(), b = f32(); glClearColor(r, g, b, f32()); break; }
+    case Op_glClearDepth: glClearDepth(f64()); break;
+    case Op_glColorMask: { GLboolean r = u32(), g = u32(), b = u32(); glColorMask(r, g, b, u32()); break; }
+    case Op_glCullFace: glCullFace(u32()); break;
+    case Op_glDepthFunc: glDepthFunc(u32()); break;
+    case Op_glDepthMask: glDepthMask(u32()); break;
+    case Op_glDisable: glDisable(u32()); break;
+    case Op_glEnable: glEnable(u32()); break;
+    case Op_glFinish: glFinish(); break;
+    case Op_glFlush: glFlush(); break;
+    case Op_glFrontFace: glFrontFace(u32()); break;
+    case Op_glPixelStorei: { GLenum pname = u32(); glPixelStorei(pname, i32()); break; }
+    case Op_glPolygonMode: { GLenum face = u32(); glPolygonMode(face, u32()); break; }
+    case Op_glPolygonOffset: { float factor = f32(); glPolygonOffset(factor, f32()); break; }
+    case Op_glScissor: { int x = i32(), y = i32(), width = i32(); glScissor(x, y, width, i32()); break; }
+    case Op_glViewport:
+        for (int i = 0; i < 4; i++)
+            viewport[i] = i32();
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        break;
+
+    //------- queries -------
+    // made for their cost: the results land in scratch memory
+    case Op_glGetError: glGetError(); break;
+    case Op_glGetString: glGetString(u32()); break;
+    case Op_glGetIntegerv: glGetIntegerv(u32(), scratchInts); break;
+    case Op_glCheckFramebufferStatus: glCheckFramebufferStatus(u32()); break;
+    case Op_glGetProgramiv: { GLuint p = programs(u32()); glGetProgramiv(p, u32(), scratchInts); break; }
+    case Op_glGetShaderiv: { GLuint s = programs(u32()); glGetShaderiv(s, u32(), scratchInts); break; }
+    case Op_glGetProgramInfoLog:
+    {
+        GLuint p = programs(u32());
+        GLsizei size = i32();
+        glGetProgramInfoLog(p, min(size, (GLsizei)scratch.size()), NULL, scratch.data());
+        break;
+    }
+    case Op_glGetShaderInfoLog:
+    {
+        GLuint s = programs(u32());
+        GLsizei size = i32();
+        glGetShaderInfoLog(s, min(size, (GLsizei)scratch.size()), NULL, scratch.data());
+        break;
+    }
+    case Op_glGetQueryObjectiv: { GLuint q = queries(u32()); glGetQueryObjectiv(q, u32(), scratchInts); break; }
+    case Op_glGetQueryObjectuiv: { GLuint q = queries(u32()); glGetQueryObjectuiv(q, u32(), (GLuint*)scratchInts); break; }
+    case Op_glGetQueryObjectui64v: { GLuint q = queries(u32()); glGetQueryObjectui64v(q, u32(), (GLuint64*)scratchInts); break; }
+
+    //------- objects -------
+#define GL_REPLAY_NAMES(gen, del, map) \
+    case Op_##gen: \
+    case Op_##del: \
+    { \
+        GLsizei n = i32(); \
+        const GLuint* captured = (const GLuint*)blob(); \
+        if (!captured || n <= 0) \
+            break; \
+        vector<GLuint> names(n); \
+        if (op == Op_##gen) \
+        { \
+            gen(n, names.data()); \
+            for (GLsizei i = 0; i < n; i++) \
+                map.set(captured[i], names[i]); \
+        } \
+        else \
+        { \
+            for (GLsizei i = 0; i < n; i++) \
+                names[i] = map(captured[i]); \
+            del(n, names.data()); \
+        } \
+        break; \
+    }
+    GL_REPLAY_NAMES(glGenBuffers, glDeleteBuffers, buffers)
+    GL_REPLAY_NAMES(glGenFramebuffers, glDeleteFramebuffers, framebuffers)
+    GL_REPLAY_NAMES(glGenQueries, glDeleteQueries, queries)
+    GL_REPLAY_NAMES(glGenRenderbuffers, glDeleteRenderbuffers, renderbuffers)
+    GL_REPLAY_NAMES(glGenTextures, glDeleteTextures, textures)
+    GL_REPLAY_NAMES(glGenVertexArrays, glDeleteVertexArrays, vertexArrays)
+#undef GL_REPLAY_NAMES
+    case Op_glObjectLabel:
+    {
+        GLenum identifier = u32();
+        GLuint name = objectName(identifier, u32());
+        int length;
+        const char* label = string(length);
+        if (glObjectLabel)
+            glObjectLabel(identifier, name, length, label);
+        break;
+    }
+    case Op_glPushDebugGroup:
+    {
+        GLenum source = u32();
+        GLuint id = u32();
+        int length;
+        const char* message = string(length);
+        if (glPushDebugGroup)
+            glPushDebugGroup(source, id, length, message ? message : "");
+        break;
+    }
+    case Op_glPopDebugGroup:
+        if (glPopDebugGroup)
+            glPopDebugGroup();
+        break;
+
+    //------- buffers -------
+    case Op_glBindBuffer: { GLenum target = u32(); glBindBuffer(target, buffers(u32())); break; }
+    case Op_glBindBufferBase: { GLenum target = u32(); GLuint index = u32(); glBindBufferBase(target, index, buffers(u32())); break; }
+    case Op_glBindBufferRange:
+    {
+        GLenum target = u32();
+        GLuint index = u32();
+        GLuint buffer = buffers(u32());
+        GLintptr offset = (GLintptr)i64();
+        glBindBufferRange(target, index, buffer, offset, (GLsizeiptr)i64());
+        break;
+    }
+    case Op_glBufferData:
+    {
+        GLenum target = u32();
+        GLsizeiptr size = (GLsizeiptr)i64();
+        const void* data = blob();
+        glBufferData(target, size, data, u32());
+        break;
+    }
+    case Op_glBufferSubData:
+    {
+        GLenum target = u32();
+        GLintptr offset = (GLintptr)i64();
+        GLsizeiptr size = (GLsizeiptr)i64();
+        glBufferSubData(target, offset, size, blob());
+        break;
+    }
+    case Op_glCopyBufferSubData:
+    {
+        GLenum readTarget = u32(), writeTarget = u32();
+        GLintptr readOffset = (GLintptr)i64(), writeOffset = (GLintptr)i64();
+        glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, (GLsizeiptr)i64());
+        break;
+    }
+    case Op_glMapBufferRange:
+    {
+        GLenum target = u32();
+        GLintptr offset = (GLintptr)i64();
+        GLsizeiptr length = (GLsizeiptr)i64();
+        mappings[target] = (char*)glMapBufferRange(target, offset, length, u32());
+        break;
+    }
+    case Op_glMapBuffer: { GLenum target = u32(); mappings[target] = (char*)glMapBuffer(target, u32()); break; }
+    case Op_glFlushMappedBufferRange:
+    {
+        GLenum target = u32();
+        GLintptr offset = (GLintptr)i64();
+        GLsizeiptr length = (GLsizeiptr)i64();
+        const void* data = blob();
+        if (data && mappings[target])
+            memcpy(mappings[target] + offset, data, length);
+        glFlushMappedBufferRange(target, offset, length);
+        break;
+    }
+    case Op_glUnmapBuffer:
+    {
+        GLenum target = u32();
+        size_t size;
+        const void* data = blob(&size);
+        if (data && mappings[target])
+            memcpy(mappings[target], data, size);
+        mappings[target] = nullptr;
+        glUnmapBuffer(target);
+        break;
+    }
+
+    //------- vertex input and draws -------
+    case Op_glBindVertexArray: glBindVertexArray(vertexArrays(u32())); break;
+    case Op_glEnableVertexAttribArray: glEnableVertexAttribArray(u32()); break;
+    case Op_glDisableVertexAttribArray: glDisableVertexAttribArray(u32()); break;
+    case Op_glVertexAttribDivisor: { GLuint index = u32(); glVertexAttribDivisor(index, u32()); break; }
+    case Op_glVertexAttribPointer:
+    {
+        GLuint index = u32();
+        GLint size = i32();
+        GLenum type = u32();
+        GLboolean normalized = u32();
+        GLsizei stride = i32();
+        glVertexAttribPointer(index, size, type, normalized, stride, (const void*)(uintptr_t)u64());
+        break;
+    }
+    case Op_glVertexAttribIPointer:
+    {
+        GLuint index = u32();
+        GLint size = i32();
+        GLenum type = u32();
+        GLsizei stride = i32();
+        glVertexAttribIPointer(index, size, type, stride, (const void*)(uintptr_t)u64());
+        break;
+    }
+    case Op_glDrawArrays: { GLenum mode = u32(); GLint first = i32(); glDrawArrays(mode, first, i32()); break; }
+    case Op_glDrawArraysInstanced:
+    {
+        GLenum mode = u32();
+        GLint first = i32();
+        GLsizei count = i32();
+        glDrawArraysInstanced(mode, first, count, i32());
+        break;
+    }
+    case Op_glDrawElements:
+    {
+        GLenum mode = u32();
+        GLsizei count = i32();
+        GLenum type = u32();
+        glDrawElements(mode, count, type, pointer());
+        break;
+    }
+    case Op_glDrawElementsBaseVertex:
+    {
+        GLenum mode = u32();
+        GLsizei count = i32();
+        GLenum type = u32();
+        const void* indices = pointer();
+        glDrawElementsBaseVertex(mode, count, type, indices, i32());
+        break;
+    }
+    case Op_glDrawElementsInstanced:
+    {
+        GLenum mode = u32();
+        GLsizei count = i32();
+        GLenum type = u32();
+        const void* indices = pointer();
+        glDrawElementsInstanced(mode, count, type, indices, i32());
+        break;
+    }
+
+    //------- textures and framebuffers -------
+    case Op_glBindTexture: { GLenum target = u32(); glBindTexture(target, textures(u32())); break; }
+    case Op_glTexParameteri: { GLenum target = u32(), pname = u32(); glTexParameteri(target, pname, i32()); break; }
+    case Op_glTexParameterf: { GLenum target = u32(), pname = u32(); glTexParameterf(target, pname, f32()); break; }
+    case Op_glGenerateMipmap: glGenerateMipmap(u32()); break;
+    case Op_glTexImage2D:
+    {
+        GLenum target = u32();
+        GLint level = i32(), internalformat = i32();
+        GLsizei width = i32(), height = i32();
+        GLint border = i32();
+        GLenum format = u32(), type = u32();
+        glTexImage2D(target, level, internalformat, width, height, border, format, type, pointer());
+        break;
+    }
+    case Op_glTexSubImage2D:
+    {
+        GLenum target = u32();
+        GLint level = i32(), xoffset = i32(), yoffset = i32();
+        GLsizei width = i32(), height = i32();
+        GLenum format = u32(), type = u32();
+        glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pointer());
+        break;
+    }
+    case Op_glBindFramebuffer:
+    {
+        GLenum target = u32();
+        GLuint captured = u32();
+        if (target != GL_READ_FRAMEBUFFER)
+            drawFramebuffer = captured;
+        if (target != GL_DRAW_FRAMEBUFFER)
+            readFramebuffer = captured;
+        glBindFramebuffer(target, framebuffer(captured));
+        break;
+    }
+    case Op_glBindRenderbuffer: { GLenum target = u32(); glBindRenderbuffer(target, renderbuffers(u32())); break; }
+    case Op_glRenderbufferStorage:
+    {
+        GLenum target = u32(), internalformat = u32();
+        GLsizei width = i32();
+        glRenderbufferStorage(target, internalformat, width, i32());
+        break;
+    }
+    case Op_glRenderbufferStorageMultisample:
+    {
+        GLenum target = u32();
+        GLsizei samples = i32();
+        GLenum internalformat = u32();
+        GLsizei width = i32();
+        glRenderbufferStorageMultisample(target, samples, internalformat, width, i32());
+        break;
+    }
+    case Op_glFramebufferTexture2D:
+    {
+        GLenum target = u32(), attachment = u32(), textarget = u32();
+        GLuint texture = textures(u32());
+        glFramebufferTexture2D(target, attachment, textarget, texture, i32());
+        break;
+    }
+    case Op_glFramebufferRenderbuffer:
+    {
+        GLenum target = u32(), attachment = u32(), renderbuffertarget = u32();
+        glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffers(u32()));
+        break;
+    }
+    case Op_glDrawBuffer: glDrawBuffer(colorBuffer(u32(), true)); break;
+    case Op_glReadBuffer: glReadBuffer(colorBuffer(u32(), false)); break;
+    case Op_glDrawBuffers:
+    {
+        GLsizei n = i32();
+        const GLenum* captured = (const GLenum*)blob();
+        if (!captured || n <= 0)
+            break;
+        vector<GLenum> bufs(n);
+        for (GLsizei i = 0; i < n; i++)
+            bufs[i] = colorBuffer(captured[i], true);
+        glDrawBuffers(n, bufs.data());
+        break;
+    }
+    case Op_glBlitFramebuffer:
+    {
+        GLint v[8];
+        for (int i = 0; i < 8; i++)
+            v[i] = i32();
+        GLbitfield mask = u32();
+        glBlitFramebuffer(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], mask, u32());
+        break;
+    }
+    case Op_glReadPixels:
+    {
+        GLint x = i32(), y = i32();
+        GLsizei width = i32(), height = i32();
+        GLenum format = u32(), type = u32();
+        bool packBuffer = u8() != 0;
+        uint64_t offset = u64();
+        void* pixels = (void*)(uintptr_t)offset;
+        if (!packBuffer)
+        {
+            size_t size = (size_t)max(width, 0) * max(height, 0) * 16 + 16;
+            if (scratch.size() < size)
+                scratch.resize(size);
+            pixels = scratch.data();
+        }
+        glReadPixels(x, y, width, height, format, type, pixels);
+        break;
+    }
+
+    //------- shaders and uniforms -------
+    case Op_glCreateShader: { GLenum type = u32(); GLuint shader = glCreateShader(type); programs.set(u32(), shader); break; }
+    case Op_glCreateProgram: programs.set(u32(), glCreateProgram()); break;
+    case Op_glShaderSource:
+    {
+        GLuint shader = programs(u32());
+        GLsizei count = i32();
+        vector<const char*> strings(max(count, 0));
+        vector<GLint> lengths(max(count, 0));
+        for (GLsizei i = 0; i < count; i++)
+        {
+            strings[i] = string(lengths[i]);
+            if (!strings[i])
+                strings[i] = "";
+        }
+        glShaderSource(shader, count, strings.data(), lengths.data());
+        break;
+    }
+    case Op_glCompileShader: glCompileShader(programs(u32())); break;
+    case Op_glAttachShader: { GLuint p = programs(u32()); glAttachShader(p, programs(u32())); break; }
+    case Op_glDetachShader: { GLuint p = programs(u32()); glDetachShader(p, programs(u32())); break; }
+    case Op_glLinkProgram: glLinkProgram(programs(u32())); break;
+    case Op_glDeleteShader: glDeleteShader(programs(u32())); break;
+    case Op_glDeleteProgram: glDeleteProgram(programs(u32())); break;
+    case Op_glUseProgram: program = u32(); glUseProgram(programs(program)); break;
+    case Op_glBindAttribLocation:
+    {
+        GLuint p = programs(u32());
+        GLuint index = u32();
+        int length;
+        const char* name = string(length);
+        glBindAttribLocation(p, index, std::string(name ? name : "", length).c_str());
+        break;
+    }
+    case Op_glGetUniformLocation:
+    {
+        GLuint captured = u32();
+        GLint capturedLocation = i32();
+        int length;
+        const char* name = string(length);
+        GLint replayed = glGetUniformLocation(programs(captured), std::string(name ? name : "", length).c_str());
+        locations[(uint64_t)captured << 32 | (uint32_t)capturedLocation] = replayed;
+        break;
+    }
+    case Op_glGetUniformBlockIndex:
+    {
+        GLuint p = programs(u32());
+        u32();
+        int length;
+        const char* name = string(length);
+        glGetUniformBlockIndex(p, std::string(name ? name : "", length).c_str());
+        break;
+    }
+    case Op_glUniformBlockBinding: { GLuint p = programs(u32()); GLuint index = u32(); glUniformBlockBinding(p, index, u32()); break; }
+    case Op_glUniform1i: { GLint l = location(i32()); glUniform1i(l, i32()); break; }
+    case Op_glUniform1f: { GLint l = location(i32()); glUniform1f(l, f32()); break; }
+    case Op_glUniform2f: { GLint l = location(i32()); float x = f32(); glUniform2f(l, x, f32()); break; }
+    case Op_glUniform3f: { GLint l = location(i32()); float x = f32(), y = f32(); glUniform3f(l, x, y, f32()); break; }
+    case Op_glUniform4f: { GLint l = location(i32()); float x = f32(), y = f32(), z = f32(); glUniform4f(l, x, y, z, f32()); break; }
+#define GL_REPLAY_UNIFORMS(name, type) \
+    case Op_##name: { GLint l = location(i32()); GLsizei count = i32(); name(l, count, (const type*)blob()); break; }
+    GL_REPLAY_UNIFORMS(glUniform1fv, GLfloat)
+    GL_REPLAY_UNIFORMS(glUniform2fv, GLfloat)
+    GL_REPLAY_UNIFORMS(glUniform3fv, GLfloat)
+    GL_REPLAY_UNIFORMS(glUniform4fv, GLfloat)
+    GL_REPLAY_UNIFORMS(glUniform1iv, GLint)
+#undef GL_REPLAY_UNIFORMS
+    case Op_glUniformMatrix3fv:
+    {
+        GLint l = location(i32());
+        GLsizei count = i32();
+        GLboolean transpose = u32();
+        glUniformMatrix3fv(l, count, transpose, (const GLfloat*)blob());
+        break;
+    }
+    case Op_glUniformMatrix4fv:
+    {
+        GLint l = location(i32());
+        GLsizei count = i32();
+        GLboolean transpose = u32();
+        glUniformMatrix4fv(l, count, transpose, (const GLfloat*)blob());
+        break;
+    }
+
+    //------- queries and syncs -------
+    case Op_glBeginQuery: { GLenum target = u32(); glBeginQuery(target, queries(u32())); break; }
+    case Op_glEndQuery: glEndQuery(u32()); break;
+    case Op_glQueryCounter: { GLuint q = queries(u32()); glQueryCounter(q, u32()); break; }
+    case Op_glFenceSync:
+    {
+        GLenum condition = u32();
+        GLbitfield flags = u32();
+        syncs[u64()] = glFenceSync(condition, flags);
+        break;
+    }
+    case Op_glClientWaitSync:
+    {
+        GLsync sync = (GLsync)syncs[u64()];
+        GLbitfield flags = u32();
+        GLuint64 timeout = u64();
+        if (sync)
+            glClientWaitSync(sync, flags, timeout);
+        break;
+    }
+    case Op_glWaitSync:
+    {
+        GLsync sync = (GLsync)syncs[u64()];
+        GLbitfield flags = u32();
+        GLuint64 timeout = u64();
+        if (sync)
+            glWaitSync(sync, flags, timeout);
+        break;
+    }
+    case Op_glDeleteSync:
+    {
+        auto it = syncs.find(u64());
+        if (it != syncs.end())
+        {
+            glDeleteSync((GLsync)it->second);
+            syncs.erase(it);
+        }
+        break;
+    }
+    default:
+        return false;
+    }
+
+    switch (op)
+    {
+    case Op_glDrawArrays: case Op_glDrawArraysInstanced: case Op_glDrawElements:
+    case Op_glDrawElementsBaseVertex: case Op_glDrawElementsInstanced: case Op_glBlitFramebuffer:
+        drawTarget = framebuffer(drawFramebuffer);
+        memcpy(drawViewport, viewport, sizeof(viewport));
+        break;
+    }
+    return !error;
+}
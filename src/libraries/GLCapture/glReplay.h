@@ -0,0 +1,95 @@
+#pragma once
+
+#include <mappedFile.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Plays a GLCapture file back on the current context, as fast as the driver goes.
+//
+//     GLReplay replay;
+//     replay.load("frames.glcap");
+//     RenderTarget target; target.create(replay.width(), replay.height());
+//     replay.begin(target.framebuffer());
+//     while (replay.nextFrame())       // runs what comes before the frame: setup, uploads
+//         replay.playFrame();          // the frame itself, time this
+//
+// Every run issues the same calls with the same data. Names, uniform locations and syncs are
+// mapped from the captured values to the ones this context returns; framebuffer 0 is the
+// framebuffer given to begin(). Queries and readbacks into client memory go to scratch memory.
+// Decoding reads straight from the mapped file: blobs are passed to GL without a copy.
+class GLReplay
+{
+public:
+    bool load(const char* filename);
+
+    int width() const { return w; }
+    int height() const { return h; }
+    int frameNum() const { return frames; }
+
+    // defaultFramebuffer stands in for framebuffer 0 of the captured application
+    void begin(unsigned int defaultFramebuffer);
+    // plays the calls up to the next frame; false at the end of the capture or on an error
+    bool nextFrame();
+    // plays the calls of the frame nextFrame() stopped at
+    bool playFrame();
+    // back to the first frame, the objects created so far stay (to play the frames again)
+    void rewindFrames();
+
+    bool failed() const { return error; }
+    uint64_t callNum() const { return calls; }
+    // framebuffer (this context's name) and viewport of the last draw or blit, to read its result back
+    unsigned int lastDrawFramebuffer() const { return drawTarget; }
+    const int* lastDrawViewport() const { return drawViewport; }
+
+private:
+    struct NameMap
+    {
+        std::vector<unsigned int> names;
+        unsigned int operator()(unsigned int captured) const { return captured < names.size() ? names[captured] : 0; }
+        void set(unsigned int captured, unsigned int name);
+    };
+
+    bool play(uint16_t stopOp);
+    bool call(uint16_t op);
+
+    // the decoder
+    uint8_t u8();
+    uint32_t u32();
+    int32_t i32() { return (int32_t)u32(); }
+    float f32();
+    double f64();
+    int64_t i64();
+    uint64_t u64();
+    const void* blob(size_t* size = nullptr);
+    const void* pointer();
+    const char* string(int& length);
+
+    int location(int captured) const;
+    unsigned int objectName(unsigned int identifier, unsigned int captured) const;
+    unsigned int framebuffer(unsigned int captured) const;
+    unsigned int colorBuffer(unsigned int buffer, bool draw) const;
+
+    MappedFile file;
+    const char* cursor = nullptr;
+    const char* end = nullptr;
+    const char* firstFrame = nullptr;
+    bool error = false;
+    int w = 0, h = 0, frames = 0;
+    uint64_t calls = 0;
+
+    std::vector<std::pair<const char*, uint32_t>> blobs;
+    size_t firstFrameBlobs = 0;
+    NameMap buffers, textures, vertexArrays, framebuffers, renderbuffers, queries;
+    NameMap programs;               // programs and shaders share their names
+    std::unordered_map<uint64_t, void*> syncs;
+    std::unordered_map<uint64_t, int> locations;    // captured program << 32 | captured location
+    std::unordered_map<unsigned int, char*> mappings;   // per target
+    unsigned int program = 0;       // captured name of the current program
+    unsigned int defaultTarget = 0;
+    unsigned int drawFramebuffer = 0, readFramebuffer = 0;  // captured names
+    unsigned int drawTarget = 0;
+    int viewport[4] = {};
+    int drawViewport[4] = {};
+    std::vector<char> scratch;
+};
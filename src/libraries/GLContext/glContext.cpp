@@ -0,0 +1,323 @@
+#include "glContext.h"
+
+#include <glad/glad.h>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#ifdef GL_CONTEXT_GLFW
+#include <GLFW/glfw3.h>
+#endif
+
+#ifdef GL_CONTEXT_EGL
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#ifdef GL_CONTEXT_OSMESA
+// after glad: osmesa.h pulls in GL/gl.h, which glad's guard turns into a no-op
+#include <GL/osmesa.h>
+#endif
+
+using namespace std;
+
+//------- glfw -------
+
+#ifdef GL_CONTEXT_GLFW
+namespace
+{
+    class GlfwContext : public GLContext
+    {
+    public:
+        ~GlfwContext() override
+        {
+            if (handle)
+                glfwDestroyWindow(handle);
+            glfwTerminate();
+        }
+
+        bool init(const ContextDesc& desc)
+        {
+            if (!glfwInit())
+            {
+                cout << "ERROR: Failed to initialize GLFW.\n";
+                return false;
+            }
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+            glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+            glfwWindowHint(GLFW_VISIBLE, desc.visible ? GLFW_TRUE : GLFW_FALSE);
+            glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, desc.debug ? GLFW_TRUE : GLFW_FALSE);
+            handle = glfwCreateWindow(desc.width, desc.height, desc.title, NULL, NULL);
+            if (!handle)
+            {
+                cout << "ERROR: Failed to create GLFW window.\n";
+                return false;
+            }
+            glfwMakeContextCurrent(handle);
+            glfwSwapInterval(desc.vsync ? 1 : 0);
+            return true;
+        }
+
+        ContextBackend backend() const override { return ContextBackend::Glfw; }
+        bool makeCurrent() override { glfwMakeContextCurrent(handle); return true; }
+        void doneCurrent() override { glfwMakeContextCurrent(NULL); }
+        void swapBuffers() override { glfwSwapBuffers(handle); }
+        bool shouldClose() const override { return glfwWindowShouldClose(handle); }
+        void pollEvents() override { glfwPollEvents(); }
+        GLFWwindow* window() const override { return handle; }
+        ProcLoader procLoader() const override { return (ProcLoader)glfwGetProcAddress; }
+
+    private:
+        GLFWwindow* handle = nullptr;
+    };
+}
+#endif
+
+//------- egl surfaceless -------
+
+#ifdef GL_CONTEXT_EGL
+namespace
+{
+    void* eglLoader(const char* name)
+    {
+        return (void*)eglGetProcAddress(name);
+    }
+
+    class EglContext : public GLContext
+    {
+    public:
+        ~EglContext() override
+        {
+            if (display == EGL_NO_DISPLAY)
+                return;
+            eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            if (context != EGL_NO_CONTEXT)
+                eglDestroyContext(display, context);
+            eglTerminate(display);
+        }
+
+        bool init(const ContextDesc& desc)
+        {
+            // the surfaceless platform needs neither a display server nor a GPU device node;
+            // without EGL_MESA_platform_surfaceless fall back to the default display
+            PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+                (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+            const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+            if (getPlatformDisplay && clientExtensions && strstr(clientExtensions, "EGL_MESA_platform_surfaceless"))
+                display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+            if (display == EGL_NO_DISPLAY)
+                display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+            EGLint major, minor;
+            if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+            {
+                cout << "ERROR: Failed to initialize EGL.\n";
+                display = EGL_NO_DISPLAY;
+                return false;
+            }
+            const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+            if (!extensions || !strstr(extensions, "EGL_KHR_surfaceless_context"))
+            {
+                cout << "ERROR: EGL_KHR_surfaceless_context is not supported.\n";
+                return false;
+            }
+            if (!eglBindAPI(EGL_OPENGL_API))
+            {
+                cout << "ERROR: EGL cannot bind the desktop OpenGL API.\n";
+                return false;
+            }
+
+            // no surface is ever created, but the default EGL_SURFACE_TYPE (window) matches nothing here
+            const EGLint configAttribs[] = {
+                EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                EGL_NONE
+            };
+            EGLConfig config;
+            EGLint configNum = 0;
+            if (!eglChooseConfig(display, configAttribs, &config, 1, &configNum) || configNum < 1)
+            {
+                cout << "ERROR: No EGL config supports desktop OpenGL.\n";
+                return false;
+            }
+            const EGLint contextAttribs[] = {
+                EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+                EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+                EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+                EGL_CONTEXT_FLAGS_KHR, desc.debug ? EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR : 0,
+                EGL_NONE
+            };
+            context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+            if (context == EGL_NO_CONTEXT)
+            {
+                cout << "ERROR: Failed to create an EGL OpenGL 3.3 core context (0x" << hex << eglGetError() << dec << ").\n";
+                return false;
+            }
+            return makeCurrent();
+        }
+
+        ContextBackend backend() const override { return ContextBackend::EglSurfaceless; }
+        bool makeCurrent() override { return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context); }
+        void doneCurrent() override { eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT); }
+        ProcLoader procLoader() const override { return eglLoader; }
+
+    private:
+        EGLDisplay display = EGL_NO_DISPLAY;
+        EGLContext context = EGL_NO_CONTEXT;
+    };
+}
+#endif
+
+//------- osmesa -------
+
+#ifdef GL_CONTEXT_OSMESA
+namespace
+{
+    void* osmesaLoader(const char* name)
+    {
+        return (void*)OSMesaGetProcAddress(name);
+    }
+
+    class OSMesaContextImpl : public GLContext
+    {
+    public:
+        ~OSMesaContextImpl() override
+        {
+            if (context)
+                OSMesaDestroyContext(context);
+        }
+
+        bool init(const ContextDesc& desc)
+        {
+            const int attribs[] = {
+                OSMESA_FORMAT, OSMESA_RGBA,
+                OSMESA_DEPTH_BITS, 24,
+                OSMESA_STENCIL_BITS, 8,
+                OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+                OSMESA_CONTEXT_MAJOR_VERSION, 3,
+                OSMESA_CONTEXT_MINOR_VERSION, 3,
+                0
+            };
+            context = OSMesaCreateContextAttribs(attribs, NULL);
+            if (!context)
+            {
+                cout << "ERROR: Failed to create an OSMesa OpenGL 3.3 core context.\n";
+                return false;
+            }
+            // OSMesa always renders into client memory; it becomes the default framebuffer
+            width = desc.width;
+            height = desc.height;
+            buffer.resize((size_t)width * height * 4);
+            return makeCurrent();
+        }
+
+        ContextBackend backend() const override { return ContextBackend::OSMesa; }
+        bool makeCurrent() override { return OSMesaMakeCurrent(context, buffer.data(), GL_UNSIGNED_BYTE, width, height); }
+        void doneCurrent() override { OSMesaMakeCurrent(NULL, NULL, GL_UNSIGNED_BYTE, 0, 0); }
+        ProcLoader procLoader() const override { return osmesaLoader; }
+
+    private:
+        OSMesaContext context = NULL;
+        std::vector<unsigned char> buffer;
+        int width = 0, height = 0;
+    };
+}
+#endif
+
+//------- factory -------
+
+const char* contextBackendName(ContextBackend backend)
+{
+    switch (backend)
+    {
+    case ContextBackend::Glfw: return "glfw";
+    case ContextBackend::EglSurfaceless: return "egl";
+    case ContextBackend::OSMesa: return "osmesa";
+    }
+    return "unknown";
+}
+
+bool parseContextBackend(const char* name, ContextBackend& backend)
+{
+    const ContextBackend backends[] = { ContextBackend::Glfw, ContextBackend::EglSurfaceless, ContextBackend::OSMesa };
+    for (ContextBackend b : backends)
+    {
+        if (!strcmp(name, contextBackendName(b)))
+        {
+            backend = b;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool contextBackendAvailable(ContextBackend backend)
+{
+    switch (backend)
+    {
+#ifdef GL_CONTEXT_GLFW
+    case ContextBackend::Glfw: return true;
+#endif
+#ifdef GL_CONTEXT_EGL
+    case ContextBackend::EglSurfaceless: return true;
+#endif
+#ifdef GL_CONTEXT_OSMESA
+    case ContextBackend::OSMesa: return true;
+#endif
+    default: return false;
+    }
+}
+
+namespace
+{
+    template<typename T>
+    unique_ptr<GLContext> createAs(const ContextDesc& desc)
+    {
+        unique_ptr<T> context(new T());
+        if (!context->init(desc))
+            return nullptr;
+        return context;
+    }
+}
+
+unique_ptr<GLContext> GLContext::create(ContextBackend backend, const ContextDesc& desc)
+{
+    unique_ptr<GLContext> context;
+    switch (backend)
+    {
+#ifdef GL_CONTEXT_GLFW
+    case ContextBackend::Glfw:
+        context = createAs<GlfwContext>(desc);
+        break;
+#endif
+#ifdef GL_CONTEXT_EGL
+    case ContextBackend::EglSurfaceless:
+        context = createAs<EglContext>(desc);
+        break;
+#endif
+#ifdef GL_CONTEXT_OSMESA
+    case ContextBackend::OSMesa:
+        context = createAs<OSMesaContextImpl>(desc);
+        break;
+#endif
+    default:
+        cout << "ERROR: Context backend \"" << contextBackendName(backend) << "\" is not compiled in.\n";
+        return nullptr;
+    }
+    if (!context)
+        return nullptr;
+
+    if (!gladLoadGLLoader((GLADloadproc)context->procLoader()))
+    {
+        cout << "ERROR: Failed to initialize GLAD.\n";
+        return nullptr;
+    }
+    if (GLVersion.major < 3 || (GLVersion.major == 3 && GLVersion.minor < 3))
+    {
+        cout << "ERROR: OpenGL 3.3 is required, the " << contextBackendName(backend)
+            << " context provides " << GLVersion.major << "." << GLVersion.minor << ".\n";
+        return nullptr;
+    }
+    return context;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+
+struct GLFWwindow;
+
+// Where the GL 3.3 core context comes from.
+//   Glfw:           a (possibly hidden) GLFW window, needs a display
+//   EglSurfaceless: EGL on the Mesa surfaceless platform, no display and no default framebuffer
+//   OSMesa:         Mesa's software off-screen context, rendering into client memory
+// Each backend is only compiled in when CMake found it (GL_CONTEXT_GLFW, GL_CONTEXT_EGL, GL_CONTEXT_OSMESA).
+enum class ContextBackend
+{
+    Glfw,
+    EglSurfaceless,
+    OSMesa,
+};
+
+const char* contextBackendName(ContextBackend backend);
+bool parseContextBackend(const char* name, ContextBackend& backend);
+bool contextBackendAvailable(ContextBackend backend);
+
+struct ContextDesc
+{
+    int width = 800;
+    int height = 600;
+    const char* title = "LearnOpenGL";
+    bool visible = true;        // Glfw only
+    bool vsync = true;          // Glfw only
+    bool debug = false;         // debug context (GL_KHR_debug reports more), Glfw and EglSurfaceless
+};
+
+// An OpenGL 3.3 core context, current on the creating thread with GLAD loaded.
+// Headless contexts have no usable default framebuffer: render into a RenderTarget.
+class GLContext
+{
+public:
+    // prints the reason and returns null if the backend is not compiled in or fails
+    static std::unique_ptr<GLContext> create(ContextBackend backend, const ContextDesc& desc = ContextDesc());
+
+    virtual ~GLContext() {}
+
+    virtual ContextBackend backend() const = 0;
+    bool headless() const { return backend() != ContextBackend::Glfw; }
+
+    virtual bool makeCurrent() = 0;
+    virtual void doneCurrent() = 0;
+    // presents the default framebuffer, no-op headless
+    virtual void swapBuffers() {}
+    // window close requested, always false headless
+    virtual bool shouldClose() const { return false; }
+    virtual void pollEvents() {}
+
+    // null unless Glfw
+    virtual GLFWwindow* window() const { return nullptr; }
+
+    typedef void* (*ProcLoader)(const char* name);
+    virtual ProcLoader procLoader() const = 0;
+};
@@ -0,0 +1,85 @@
+#include "renderTarget.h"
+
+#include <glad/glad.h>
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+bool RenderTarget::create(int width, int height)
+{
+    destroy();
+    w = width;
+    h = height;
+
+    glGenTextures(1, &color);
+    glBindTexture(GL_TEXTURE_2D, color);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenRenderbuffers(1, &depthStencil);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthStencil);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, w, h);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthStencil);
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        cout << "ERROR: Framebuffer " << w << "x" << h << " is incomplete (0x" << hex << status << dec << ").\n";
+        destroy();
+        return false;
+    }
+    return true;
+}
+
+void RenderTarget::destroy()
+{
+    if (fbo)
+        glDeleteFramebuffers(1, &fbo);
+    if (color)
+        glDeleteTextures(1, &color);
+    if (depthStencil)
+        glDeleteRenderbuffers(1, &depthStencil);
+    fbo = color = depthStencil = 0;
+}
+
+void RenderTarget::bind() const
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glViewport(0, 0, w, h);
+}
+
+void RenderTarget::unbind()
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void RenderTarget::readPixels(vector<unsigned char>& rgba) const
+{
+    size_t stride = (size_t)w * 4;
+    rgba.resize(stride * h);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, rgba.data());
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    // GL rows start at the bottom
+    vector<unsigned char> row(stride);
+    for (int y = 0; y < h / 2; y++)
+    {
+        unsigned char* a = &rgba[y * stride];
+        unsigned char* b = &rgba[(h - 1 - y) * stride];
+        memcpy(row.data(), a, stride);
+        memcpy(a, b, stride);
+        memcpy(b, row.data(), stride);
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+// Framebuffer object with an RGBA8 color texture and a depth/stencil renderbuffer.
+// The only place headless contexts can draw to; also usable with a window.
+class RenderTarget
+{
+public:
+    RenderTarget() {}
+    ~RenderTarget() { destroy(); }
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator=(const RenderTarget&) = delete;
+
+    bool create(int width, int height);
+    void destroy();
+
+    // bind as draw and read framebuffer and set the viewport to the whole target
+    void bind() const;
+    static void unbind();
+
+    // Synchronous readback of the color attachment as tightly packed RGBA, top row first.
+    // Stalls until the GPU has finished every command writing to the target.
+    void readPixels(std::vector<unsigned char>& rgba) const;
+
+    int width() const { return w; }
+    int height() const { return h; }
+    unsigned int framebuffer() const { return fbo; }
+    unsigned int colorTexture() const { return color; }
+
+private:
+    unsigned int fbo = 0;
+    unsigned int color = 0;
+    unsigned int depthStencil = 0;
+    int w = 0, h = 0;
+};
@@ -0,0 +1,177 @@
+#include "glDebug.h"
+
+#include <glad/glad.h>
+#include <cstdio>
+
+using namespace std;
+
+namespace
+{
+    const char* sourceName(unsigned int source)
+    {
+        switch (source)
+        {
+        case GL_DEBUG_SOURCE_API: return "api";
+        case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window system";
+        case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+        case GL_DEBUG_SOURCE_THIRD_PARTY: return "third party";
+        case GL_DEBUG_SOURCE_APPLICATION: return "application";
+        default: return "other";
+        }
+    }
+
+    const char* typeName(unsigned int type)
+    {
+        switch (type)
+        {
+        case GL_DEBUG_TYPE_ERROR: return "ERROR";
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "DEPRECATED";
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "UNDEFINED";
+        case GL_DEBUG_TYPE_PORTABILITY: return "PORTABILITY";
+        case GL_DEBUG_TYPE_PERFORMANCE: return "PERFORMANCE";
+        default: return "WARNING";
+        }
+    }
+
+    const char* errorName(GLenum error)
+    {
+        switch (error)
+        {
+        case GL_INVALID_ENUM: return "GL_INVALID_ENUM";
+        case GL_INVALID_VALUE: return "GL_INVALID_VALUE";
+        case GL_INVALID_OPERATION: return "GL_INVALID_OPERATION";
+        case GL_INVALID_FRAMEBUFFER_OPERATION: return "GL_INVALID_FRAMEBUFFER_OPERATION";
+        case GL_OUT_OF_MEMORY: return "GL_OUT_OF_MEMORY";
+        case GL_STACK_OVERFLOW: return "GL_STACK_OVERFLOW";
+        case GL_STACK_UNDERFLOW: return "GL_STACK_UNDERFLOW";
+        default: return "unknown GL error";
+        }
+    }
+
+    void APIENTRY debugCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
+        GLsizei /*length*/, const GLchar* message, const void* userParam)
+    {
+        // synchronous output runs on the thread that made the call, so its call site is current
+        ((GLDebug*)userParam)->record(source, type, id, severity, message, GLCallSite::current());
+    }
+}
+
+//------- GLDebug -------
+
+GLDebug& GLDebug::instance()
+{
+    static GLDebug debug;
+    return debug;
+}
+
+bool GLDebug::init(bool synchronous, bool useCallback)
+{
+    shutdown();
+    if (!useCallback || !GLAD_GL_KHR_debug || !glDebugMessageCallback)
+    {
+        if (useCallback)
+            printf("WARNING: GL_KHR_debug is not supported, GL_CHECK falls back to glGetError.\n");
+        polling = true;
+        return false;
+    }
+    GLint flags = 0;
+    glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+    static bool warned = false;
+    if (!(flags & GL_CONTEXT_FLAG_DEBUG_BIT) && !warned)
+    {
+        warned = true;
+        printf("WARNING: Not a debug context, the driver may report fewer GL messages.\n");
+    }
+
+    glEnable(GL_DEBUG_OUTPUT);
+    if (synchronous)
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    else
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDebugMessageCallback(debugCallback, this);
+    // notifications are chatty (buffer placement and the like) and never point at a bug
+    glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
+    callback = true;
+    return true;
+}
+
+void GLDebug::shutdown()
+{
+    if (callback)
+    {
+        glDebugMessageCallback(NULL, NULL);
+        glDisable(GL_DEBUG_OUTPUT);
+    }
+    callback = polling = false;
+}
+
+void GLDebug::record(unsigned int source, unsigned int type, unsigned int id, unsigned int severity,
+    const char* message, const GLCallSite* site)
+{
+    string location;
+    if (site)
+    {
+        char buf[512];
+        snprintf(buf, sizeof(buf), "%s:%d %s", site->file, site->line, site->call);
+        location = buf;
+    }
+    lock_guard<mutex> lock(entriesMutex);
+    messages++;
+    if (type == GL_DEBUG_TYPE_ERROR)
+        errors++;
+    for (Entry& e : entries)
+    {
+        if (e.id == id && e.source == source && e.type == type && e.location == location && e.message == message)
+        {
+            e.count++;
+            return;
+        }
+    }
+    entries.push_back({ source, type, id, severity, message, location, 1, 0 });
+}
+
+void GLDebug::poll(const GLCallSite& site)
+{
+    for (GLenum error = glGetError(); error != GL_NO_ERROR; error = glGetError())
+        record(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, error, GL_DEBUG_SEVERITY_HIGH, errorName(error), &site);
+}
+
+size_t GLDebug::flush()
+{
+    lock_guard<mutex> lock(entriesMutex);
+    size_t printed = 0;
+    for (Entry& e : entries)
+    {
+        // a message is printed once; a repeating one again each time its count doubles
+        if (e.count == e.reported || (e.reported && e.count < e.reported * 2))
+            continue;
+        if (e.reported)
+            printf("%s: (%s, %llu times) %s\n", typeName(e.type), sourceName(e.source),
+                (unsigned long long)e.count, e.message.c_str());
+        else
+            printf("%s: (%s) %s\n", typeName(e.type), sourceName(e.source), e.message.c_str());
+        if (!e.location.empty())
+            printf("    at %s\n", e.location.c_str());
+        e.reported = e.count;
+        printed++;
+    }
+    return printed;
+}
+
+void GLDebug::label(unsigned int identifier, unsigned int name, const char* text)
+{
+    if (callback)
+        glObjectLabel(identifier, name, -1, text);
+}
+
+void GLDebug::pushGroup(const char* name)
+{
+    if (callback)
+        glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+}
+
+void GLDebug::popGroup()
+{
+    if (callback)
+        glPopDebugGroup();
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// GL error reporting without a glGetError after every call.
+//
+//     GL_DEBUG_INIT();                                     // once, with the context current
+//     GL_CHECK(glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW));
+//     { GL_DEBUG_GROUP("shadows"); ... }
+//     GL_DEBUG_FLUSH();                                    // once per frame
+//
+// With GL_KHR_debug (core in 4.3, exposed by most 3.3 drivers) the driver reports errors and
+// warnings through a callback; with synchronous output it fires inside the offending call, so
+// the call site GL_CHECK recorded on the calling thread tells where it came from. Without the
+// extension, GL_CHECK falls back to one glGetError per wrapped call, which stalls.
+// Messages are only recorded in the callback; GL_DEBUG_FLUSH prints them batched, identical
+// messages from the same call site once with a repeat count.
+//
+// Everything is compiled in only when GL_DEBUG_LAYER is defined (Debug builds, or the
+// GL_DEBUG_LAYER CMake option): otherwise GL_CHECK(call) is exactly (call) and the other macros
+// are empty. src/benchmarks/glDebug measures both.
+
+struct GLCallSite;
+
+class GLDebug
+{
+public:
+    static GLDebug& instance();
+
+    // needs a current context; uses KHR_debug when available (and useCallback), otherwise
+    // glGetError polling. Returns whether the callback is used.
+    // synchronous: report inside the offending call (needed for call sites), slower on some drivers
+    bool init(bool synchronous = true, bool useCallback = true);
+    void shutdown();
+    bool usesCallback() const { return callback; }
+    static bool pollsErrors() { return polling; }
+
+    // print the messages recorded since the last flush; returns the number of distinct messages
+    size_t flush();
+
+    uint64_t messageNum() const { return messages; }
+    uint64_t errorNum() const { return errors; }
+
+    // KHR_debug object labels and groups, show up in the messages and in GPU debuggers
+    void label(unsigned int identifier, unsigned int name, const char* text);
+    void pushGroup(const char* name);
+    void popGroup();
+
+    // called by the driver (callback) and by GLCallSite (polling)
+    void record(unsigned int source, unsigned int type, unsigned int id, unsigned int severity,
+        const char* message, const GLCallSite* site);
+    void poll(const GLCallSite& site);
+
+private:
+    struct Entry
+    {
+        unsigned int source, type, id, severity;
+        std::string message;
+        std::string location;       // file:line call, or empty outside GL_CHECK
+        uint64_t count;
+        uint64_t reported;          // count at the last flush
+    };
+
+    GLDebug() = default;
+
+    std::mutex entriesMutex;
+    std::vector<Entry> entries;
+    bool callback = false;
+    static inline bool polling = false;
+    uint64_t messages = 0;
+    uint64_t errors = 0;
+};
+
+// where the GL call currently executing on this thread was made, set by GL_CHECK
+struct GLCallSite
+{
+    GLCallSite(const char* file, int line, const char* call)
+        : file(file), line(line), call(call), previous(top)
+    {
+        top = this;
+    }
+
+    ~GLCallSite()
+    {
+        top = previous;
+        if (GLDebug::pollsErrors())
+            GLDebug::instance().poll(*this);
+    }
+
+    GLCallSite(const GLCallSite&) = delete;
+    GLCallSite& operator=(const GLCallSite&) = delete;
+
+    static const GLCallSite* current() { return top; }
+
+    const char* file;
+    int line;
+    const char* call;
+    const GLCallSite* previous;
+
+private:
+    static inline thread_local const GLCallSite* top = nullptr;
+};
+
+class GLDebugGroup
+{
+public:
+    explicit GLDebugGroup(const char* name) { GLDebug::instance().pushGroup(name); }
+    ~GLDebugGroup() { GLDebug::instance().popGroup(); }
+    GLDebugGroup(const GLDebugGroup&) = delete;
+    GLDebugGroup& operator=(const GLDebugGroup&) = delete;
+};
+
+#define GL_DEBUG_CONCAT_INNER(a, b) a##b
+#define GL_DEBUG_CONCAT(a, b) GL_DEBUG_CONCAT_INNER(a, b)
+#ifdef GL_DEBUG_LAYER
+#define GL_CHECK(call) (GLCallSite(__FILE__, __LINE__, #call), (call))
+#define GL_DEBUG_INIT() GLDebug::instance().init()
+#define GL_DEBUG_FLUSH() GLDebug::instance().flush()
+#define GL_DEBUG_SHUTDOWN() GLDebug::instance().shutdown()
+#define GL_DEBUG_GROUP(name) GLDebugGroup GL_DEBUG_CONCAT(glDebugGroup, __LINE__)(name)
+#define GL_DEBUG_LABEL(identifier, name, text) GLDebug::instance().label(identifier, name, text)
+#else
+#define GL_CHECK(call) (call)
+#define GL_DEBUG_INIT() ((void)0)
+#define GL_DEBUG_FLUSH() ((void)0)
+#define GL_DEBUG_SHUTDOWN() ((void)0)
+#define GL_DEBUG_GROUP(name) ((void)0)
+#define GL_DEBUG_LABEL(identifier, name, text) ((void)0)
+#endif
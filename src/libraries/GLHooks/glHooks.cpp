@@ -0,0 +1,84 @@
+#include "glHooks.h"
+
+#include <cstdio>
+
+namespace
+{
+    const int kMaxCallbacks = 8;
+
+    struct Callbacks
+    {
+        GLADcallback pre, post;
+    };
+    Callbacks callbacks[kMaxCallbacks];
+    int callbackNum = 0;
+
+    void noCall(const char* /*name*/, void* /*funcptr*/, int /*argNum*/, ...)
+    {
+    }
+
+    void preCalls(const char* name, void* funcptr, int /*argNum*/, ...)
+    {
+        for (int i = 0; i < callbackNum; i++)
+        {
+            if (callbacks[i].pre)
+                callbacks[i].pre(name, funcptr, 0);
+        }
+    }
+
+    void postCalls(const char* name, void* funcptr, int /*argNum*/, ...)
+    {
+        for (int i = 0; i < callbackNum; i++)
+        {
+            if (callbacks[i].post)
+                callbacks[i].post(name, funcptr, 0);
+        }
+    }
+
+    // one pair goes to GLAD as it is, the dispatch loop only when there is something to chain
+    void setCallbacks()
+    {
+        if (callbackNum == 1)
+        {
+            glad_set_pre_callback(callbacks[0].pre ? callbacks[0].pre : noCall);
+            glad_set_post_callback(callbacks[0].post ? callbacks[0].post : noCall);
+        }
+        else
+        {
+            glad_set_pre_callback(preCalls);
+            glad_set_post_callback(postCalls);
+        }
+    }
+}
+
+bool glAddCallbacks(GLADcallback pre, GLADcallback post)
+{
+    if (callbackNum == kMaxCallbacks)
+    {
+        printf("ERROR: More than %d GL call callbacks.\n", kMaxCallbacks);
+        return false;
+    }
+    callbacks[callbackNum++] = { pre, post };
+    setCallbacks();
+    if (callbackNum == 1)
+        gladInstallGLDebug();
+    return true;
+}
+
+void glRemoveCallbacks(GLADcallback pre, GLADcallback post)
+{
+    for (int i = 0; i < callbackNum; i++)
+    {
+        if (callbacks[i].pre == pre && callbacks[i].post == post)
+        {
+            for (int j = i + 1; j < callbackNum; j++)
+                callbacks[j - 1] = callbacks[j];
+            callbackNum--;
+            if (callbackNum)
+                setCallbacks();
+            else
+                gladUninstallGLDebug();
+            return;
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+
+// Shared plumbing for the libraries that hook GL calls through GLAD (ChapterBench, GLCapture,
+// GLStats, GpuMemory), so any of them can be on at the same time.
+//
+//     PFNGLDRAWARRAYSPROC nextDrawArrays;
+//     void APIENTRY countDrawArrays(GLenum mode, GLint first, GLsizei count) { ...; nextDrawArrays(mode, first, count); }
+//     glHookIn(glad_glDrawArrays, glad_debug_glDrawArrays, nextDrawArrays, countDrawArrays);
+//     ...
+//     glHookOut(glad_glDrawArrays, glad_debug_glDrawArrays, nextDrawArrays, countDrawArrays);
+//
+// Entry point hooks chain: each calls whatever the entry point was when it was swapped in,
+// the driver or an earlier hook. The gl* macros call glad_debug_*, which is a copy of the
+// glad_* pointer while the GLAD debug hooks are uninstalled and needs the hook too; installed,
+// it calls glad_* itself. A hook that another one was swapped in on top of cannot be taken
+// out of the middle of the chain: glHookOut leaves it there and returns false, and it must
+// then pass calls on without doing anything else.
+//
+// Callbacks: GLAD has one pre-call and one post-call callback, and gladUninstallGLDebug takes
+// the hooks out for everyone. glAddCallbacks installs the debug hooks with the first pair and
+// glRemoveCallbacks uninstalls them with the last. A single pair is called directly; with
+// several, each is called in turn with the name and function pointer, argNum 0 and no
+// arguments, as a variadic call cannot be passed on. Single GL thread.
+
+template <typename Proc>
+void glHookIn(Proc& entry, Proc& debugEntry, Proc& next, Proc hook)
+{
+    // still chained from before, or not loaded
+    if (next || !entry)
+        return;
+    next = entry;
+    entry = hook;
+    if (debugEntry == next)
+        debugEntry = hook;
+}
+
+template <typename Proc>
+bool glHookOut(Proc& entry, Proc& debugEntry, Proc& next, Proc hook)
+{
+    if (!next)
+        return true;
+    if (entry != hook)
+        return false;
+    entry = next;
+    if (debugEntry == hook)
+        debugEntry = next;
+    next = NULL;
+    return true;
+}
+
+// NULL for either when only one is needed; GLAD's default post-call glGetError is not used
+bool glAddCallbacks(GLADcallback pre, GLADcallback post);
+void glRemoveCallbacks(GLADcallback pre, GLADcallback post);
@@ -0,0 +1,161 @@
+#include "glStats.h"
+
+#include <glad/glad.h>
+#include <glHooks.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+
+namespace
+{
+    void preCall(const char* name, void* /*funcptr*/, int /*argNum*/, ...)
+    {
+        GLStats::instance().count(name);
+    }
+
+    bool startsWith(const char* s, const char* prefix)
+    {
+        return !strncmp(s, prefix, strlen(prefix));
+    }
+
+    vector<const GLStats::Entry*> sorted(const vector<GLStats::Entry>& table, uint64_t GLStats::Entry::*calls)
+    {
+        vector<const GLStats::Entry*> out;
+        for (const GLStats::Entry& e : table)
+        {
+            if (e.*calls)
+                out.push_back(&e);
+        }
+        sort(out.begin(), out.end(), [calls](const GLStats::Entry* a, const GLStats::Entry* b) { return a->*calls > b->*calls; });
+        return out;
+    }
+}
+
+GLStats& GLStats::instance()
+{
+    static GLStats stats;
+    return stats;
+}
+
+void GLStats::enable()
+{
+    if (!on)
+        on = glAddCallbacks(preCall, NULL);
+}
+
+void GLStats::disable()
+{
+    if (on)
+        glRemoveCallbacks(preCall, NULL);
+    on = inFrame = false;
+}
+
+void GLStats::reset()
+{
+    for (Entry& e : table)
+        e.frameCalls = e.lastFrameCalls = e.totalCalls = 0;
+    current = last = {};
+    frames = 0;
+}
+
+bool GLStats::isSynchronizing(const char* name)
+{
+    static const char* const calls[] = { "glReadPixels", "glFinish", "glClientWaitSync", "glMapBuffer",
+        "glMapBufferRange", "glCheckFramebufferStatus" };
+    if (startsWith(name, "glGet") || startsWith(name, "glIs"))
+        return true;
+    for (const char* call : calls)
+    {
+        if (!strcmp(name, call))
+            return true;
+    }
+    return false;
+}
+
+bool GLStats::isDraw(const char* name)
+{
+    return startsWith(name, "glDraw") && strcmp(name, "glDrawBuffer") && strcmp(name, "glDrawBuffers");
+}
+
+void GLStats::count(const char* name)
+{
+    auto it = index.find(name);
+    size_t i;
+    if (it == index.end())
+    {
+        i = table.size();
+        index.emplace(name, i);
+        table.push_back({ name, isSynchronizing(name), isDraw(name), 0, 0, 0 });
+    }
+    else
+        i = it->second;
+    Entry& e = table[i];
+    e.totalCalls++;
+    if (!inFrame)
+        return;
+    e.frameCalls++;
+    current.calls++;
+    current.draws += e.draw;
+    current.synchronizing += e.synchronizing;
+}
+
+void GLStats::beginFrame()
+{
+    inFrame = on;
+    current = {};
+}
+
+void GLStats::endFrame()
+{
+    if (!inFrame)
+        return;
+    inFrame = false;
+    for (Entry& e : table)
+    {
+        e.lastFrameCalls = e.frameCalls;
+        e.frameCalls = 0;
+    }
+    last = current;
+    frames++;
+}
+
+const GLStats::Entry* GLStats::find(const char* name) const
+{
+    for (const Entry& e : table)
+    {
+        if (!strcmp(e.name, name))
+            return &e;
+    }
+    return NULL;
+}
+
+void GLStats::printFrame(int topNum) const
+{
+    printf("GL frame %llu: %llu calls, %llu draws, %llu synchronizing\n", (unsigned long long)frames,
+        (unsigned long long)last.calls, (unsigned long long)last.draws, (unsigned long long)last.synchronizing);
+    vector<const Entry*> top = sorted(table, &Entry::lastFrameCalls);
+    for (int i = 0; i < (int)top.size() && i < topNum; i++)
+        printf("  %-32s %8llu\n", top[i]->name, (unsigned long long)top[i]->lastFrameCalls);
+    for (const Entry* e : top)
+    {
+        if (e->synchronizing)
+            printf("  WARNING: %s (%llu calls) synchronizes inside the frame.\n", e->name, (unsigned long long)e->lastFrameCalls);
+    }
+}
+
+void GLStats::print(int topNum) const
+{
+    uint64_t total = 0;
+    for (const Entry& e : table)
+        total += e.totalCalls;
+    printf("GL calls (%llu frames, %llu calls, %zu entry points)\n", (unsigned long long)frames, (unsigned long long)total, table.size());
+    printf("  %-32s %10s %10s\n", "entry point", "total", "per frame");
+    vector<const Entry*> top = sorted(table, &Entry::totalCalls);
+    for (int i = 0; i < (int)top.size() && i < topNum; i++)
+    {
+        printf("  %-32s %10llu %10.1f%s\n", top[i]->name, (unsigned long long)top[i]->totalCalls,
+            frames ? (double)top[i]->totalCalls / frames : 0.0, top[i]->synchronizing ? "  sync" : "");
+    }
+}
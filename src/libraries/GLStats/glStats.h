@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// GL call counts per entry point and per frame, through the GLAD debug hooks.
+//
+//     GLStats& stats = GLStats::instance();
+//     stats.enable();                                      // once GL is loaded
+//     stats.beginFrame(); ...gl calls...; stats.endFrame();
+//     stats.printFrame();                                  // the frame just ended
+//
+// Enabled, every gl* call goes through its glad_debug_impl_* wrapper and is counted in the
+// pre-call callback. Disabled (the default) the hooks are uninstalled and gl* calls the driver
+// pointer directly, the same single indirect call as a GLAD without hooks.
+// Calls that make the driver wait for the GPU or, with a threaded driver, for its command
+// thread (glGet*, glIs*, glReadPixels, glFinish, glMapBuffer, ...) are flagged when they are
+// made inside a frame. Counting is not synchronized: make GL calls from one thread.
+class GLStats
+{
+public:
+    struct Entry
+    {
+        const char* name;
+        bool synchronizing;
+        bool draw;
+        uint64_t frameCalls;        // in the frame in progress
+        uint64_t lastFrameCalls;    // in the last finished frame
+        uint64_t totalCalls;        // since enable or reset
+    };
+
+    struct Frame
+    {
+        uint64_t calls;
+        uint64_t draws;
+        uint64_t synchronizing;
+    };
+
+    static GLStats& instance();
+
+    void enable();
+    void disable();
+    bool enabled() const { return on; }
+    void reset();
+
+    // calls between beginFrame and endFrame count for the frame, the others only in the totals
+    void beginFrame();
+    void endFrame();
+    const Frame& lastFrame() const { return last; }
+    uint64_t frameNum() const { return frames; }
+    const std::vector<Entry>& entries() const { return table; }
+    const Entry* find(const char* name) const;
+
+    // the last frame: its most called entry points and every synchronizing call
+    void printFrame(int topNum = 8) const;
+    // totals and per frame averages since enable or reset
+    void print(int topNum = 16) const;
+
+    static bool isSynchronizing(const char* name);
+    static bool isDraw(const char* name);
+
+    // the GLAD pre-call callback
+    void count(const char* name);
+
+private:
+    GLStats() = default;
+
+    // GLAD passes the same string literal on every call of an entry point, so its address is the key
+    std::unordered_map<const char*, size_t> index;
+    std::vector<Entry> table;
+    bool on = false;
+    bool inFrame = false;
+    Frame current = {};
+    Frame last = {};
+    uint64_t frames = 0;
+};
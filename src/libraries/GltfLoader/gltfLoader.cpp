@@ -0,0 +1,511 @@
+#include "gltfLoader.h"
+#include "jsonSax.h"
+
+#include <stb_image.h>
+#include <stbImageFlip.h>
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+namespace
+{
+    const uint32_t kGlbMagic = 0x46546C67;     // "glTF"
+    const uint32_t kChunkJson = 0x4E4F534A;    // "JSON"
+    const uint32_t kChunkBin = 0x004E4942;     // "BIN\0"
+
+    //------- base64 data uris -------
+
+    struct Base64Table
+    {
+        signed char values[256];
+    };
+
+    constexpr Base64Table makeBase64Table()
+    {
+        Base64Table table = {};
+        for (int i = 0; i < 256; i++)
+            table.values[i] = -1;
+        const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        for (int i = 0; i < 64; i++)
+            table.values[(unsigned char)alphabet[i]] = (signed char)i;
+        return table;
+    }
+
+    // built at compile time, so loaders on several threads never race on it
+    constexpr Base64Table kBase64 = makeBase64Table();
+
+    bool decodeBase64(const char* str, size_t length, vector<unsigned char>& out)
+    {
+        const signed char* table = kBase64.values;
+        out.clear();
+        out.reserve(length / 4 * 3);
+        unsigned int acc = 0;
+        int bits = 0;
+        for (size_t i = 0; i < length; i++)
+        {
+            unsigned char c = (unsigned char)str[i];
+            if (c == '=')
+                break;
+            if (table[c] < 0)
+                return false;
+            acc = (acc << 6) | (unsigned int)table[c];
+            bits += 6;
+            if (bits >= 8)
+            {
+                bits -= 8;
+                out.push_back((unsigned char)(acc >> bits));
+            }
+        }
+        return true;
+    }
+
+    // "data:<mime>;base64,<payload>" -> payload
+    bool dataUriPayload(const string& uri, const char*& payload, size_t& length)
+    {
+        if (uri.compare(0, 5, "data:") != 0)
+            return false;
+        size_t comma = uri.find(";base64,");
+        if (comma == string::npos)
+            return false;
+        payload = uri.c_str() + comma + 8;
+        length = uri.size() - comma - 8;
+        return true;
+    }
+
+    //------- SAX handler building the asset -------
+
+    class GltfHandler : public JsonSaxHandler
+    {
+    public:
+        explicit GltfHandler(GltfAsset& asset) : asset(asset) {}
+
+        bool startObject() override { return beginContainer(false); }
+        bool startArray() override { return beginContainer(true); }
+        bool endObject() override { frames.pop_back(); return true; }
+        bool endArray() override { frames.pop_back(); return true; }
+
+        bool key(const char* str, size_t length) override
+        {
+            frames.back().key.assign(str, length);
+            return true;
+        }
+
+        bool number(double value) override
+        {
+            advance();
+            onNumber(value);
+            return true;
+        }
+
+        bool boolean(bool value) override
+        {
+            advance();
+            if (depth() == 3 && is(0, "accessors") && is(2, "normalized"))
+                asset.accessors.back().normalized = value;
+            return true;
+        }
+
+        bool null() override
+        {
+            advance();
+            return true;
+        }
+
+        bool string(const char* str, size_t length) override
+        {
+            advance();
+            std::string s(str, length);
+            if (depth() == 2 && is(0, "asset") && is(1, "version") && s.compare(0, 2, "2.") != 0)
+            {
+                cout << "ERROR: Unsupported glTF version " << s << ".\n";
+                return false;
+            }
+            if (depth() != 3)
+                return true;
+            if (is(0, "buffers") && is(2, "uri"))
+                asset.buffers.back().uri = s;
+            else if (is(0, "images") && is(2, "uri"))
+                asset.images.back().uri = s;
+            else if (is(0, "images") && is(2, "mimeType"))
+                asset.images.back().mimeType = s;
+            else if (is(0, "accessors") && is(2, "type"))
+                asset.accessors.back().componentNum = typeComponents(s);
+            else if (is(2, "name"))
+            {
+                if (is(0, "meshes"))
+                    asset.meshes.back().name = s;
+                else if (is(0, "materials"))
+                    asset.materials.back().name = s;
+                else if (is(0, "nodes"))
+                    asset.nodes.back().name = s;
+            }
+            return true;
+        }
+
+    private:
+        struct Frame
+        {
+            bool isArray;
+            std::string key;
+            int index;
+        };
+
+        size_t depth() const { return frames.size(); }
+        bool is(size_t d, const char* name) const { return !frames[d].isArray && frames[d].key == name; }
+        int index(size_t d) const { return frames[d].index; }
+
+        // a value starts inside the innermost container
+        void advance()
+        {
+            if (!frames.empty() && frames.back().isArray)
+                frames.back().index++;
+        }
+
+        bool beginContainer(bool isArray)
+        {
+            advance();
+            size_t d = depth();
+            if (!isArray && d == 2 && frames[1].isArray)
+            {
+                // new element of a top level array
+                if (is(0, "buffers")) asset.buffers.emplace_back();
+                else if (is(0, "bufferViews")) asset.bufferViews.emplace_back();
+                else if (is(0, "accessors")) asset.accessors.emplace_back();
+                else if (is(0, "meshes")) asset.meshes.emplace_back();
+                else if (is(0, "materials")) asset.materials.emplace_back();
+                else if (is(0, "images")) asset.images.emplace_back();
+                else if (is(0, "textures")) asset.textures.emplace_back();
+                else if (is(0, "nodes")) asset.nodes.emplace_back();
+                else if (is(0, "scenes")) asset.scenes.emplace_back();
+            }
+            else if (!isArray && d == 4 && is(0, "meshes") && is(2, "primitives"))
+                asset.meshes.back().primitives.emplace_back();
+            else if (!isArray && d == 3 && is(0, "accessors") && is(2, "sparse"))
+                asset.accessors.back().sparse = true;
+            frames.push_back({ isArray, std::string(), -1 });
+            return true;
+        }
+
+        static int typeComponents(const std::string& type)
+        {
+            if (type == "SCALAR") return 1;
+            if (type == "VEC2") return 2;
+            if (type == "VEC3") return 3;
+            if (type == "VEC4") return 4;
+            if (type == "MAT2") return 4;
+            if (type == "MAT3") return 9;
+            if (type == "MAT4") return 16;
+            return 0;
+        }
+
+        void onNumber(double value)
+        {
+            size_t d = depth();
+            int i = (int)value;
+            if (d == 1 && is(0, "scene"))
+                asset.scene = i;
+            else if (d == 3)
+            {
+                if (is(0, "buffers"))
+                {
+                    if (is(2, "byteLength")) asset.buffers.back().byteLength = (size_t)value;
+                }
+                else if (is(0, "bufferViews"))
+                {
+                    GltfBufferView& v = asset.bufferViews.back();
+                    if (is(2, "buffer")) v.buffer = i;
+                    else if (is(2, "byteOffset")) v.byteOffset = (size_t)value;
+                    else if (is(2, "byteLength")) v.byteLength = (size_t)value;
+                    else if (is(2, "byteStride")) v.byteStride = i;
+                    else if (is(2, "target")) v.target = i;
+                }
+                else if (is(0, "accessors"))
+                {
+                    GltfAccessor& a = asset.accessors.back();
+                    if (is(2, "bufferView")) a.bufferView = i;
+                    else if (is(2, "byteOffset")) a.byteOffset = (size_t)value;
+                    else if (is(2, "componentType")) a.componentType = i;
+                    else if (is(2, "count")) a.count = (size_t)value;
+                }
+                else if (is(0, "images") && is(2, "bufferView"))
+                    asset.images.back().bufferView = i;
+                else if (is(0, "textures") && is(2, "source"))
+                    asset.textures.back().source = i;
+                else if (is(0, "nodes") && is(2, "mesh"))
+                    asset.nodes.back().mesh = i;
+            }
+            else if (d == 4)
+            {
+                int k = frames[3].index;
+                if (is(0, "nodes"))
+                {
+                    GltfNode& n = asset.nodes.back();
+                    if (is(2, "children")) n.children.push_back(i);
+                    else if (is(2, "matrix") && k < 16) { n.matrix[k] = (float)value; n.hasMatrix = true; }
+                    else if (is(2, "translation") && k < 3) n.translation[k] = (float)value;
+                    else if (is(2, "rotation") && k < 4) n.rotation[k] = (float)value;
+                    else if (is(2, "scale") && k < 3) n.scale[k] = (float)value;
+                }
+                else if (is(0, "scenes") && is(2, "nodes"))
+                    asset.scenes.back().nodes.push_back(i);
+                else if (is(0, "materials") && is(2, "normalTexture") && is(3, "index"))
+                    asset.materials.back().normalTexture = i;
+            }
+            else if (d == 5)
+            {
+                if (is(0, "meshes") && is(2, "primitives"))
+                {
+                    GltfPrimitive& p = asset.meshes.back().primitives.back();
+                    if (is(4, "indices")) p.indices = i;
+                    else if (is(4, "material")) p.material = i;
+                    else if (is(4, "mode")) p.mode = i;
+                }
+                else if (is(0, "materials") && is(2, "pbrMetallicRoughness"))
+                {
+                    GltfMaterial& m = asset.materials.back();
+                    if (is(3, "baseColorFactor") && frames[4].index < 4)
+                        m.baseColorFactor[frames[4].index] = (float)value;
+                    else if (is(3, "baseColorTexture") && is(4, "index"))
+                        m.baseColorTexture = i;
+                }
+            }
+            else if (d == 6 && is(0, "meshes") && is(2, "primitives") && is(4, "attributes"))
+                asset.meshes.back().primitives.back().attributes[frames[5].key] = i;
+        }
+
+        GltfAsset& asset;
+        vector<Frame> frames;
+    };
+
+    bool resolveBuffers(GltfAsset& asset, const unsigned char* glbBinary, size_t glbBinarySize)
+    {
+        for (size_t i = 0; i < asset.buffers.size(); i++)
+        {
+            GltfBuffer& buffer = asset.buffers[i];
+            const char* payload;
+            size_t payloadLength;
+            if (buffer.uri.empty())
+            {
+                if (i != 0 || !glbBinary)
+                {
+                    cout << "ERROR: glTF buffer " << i << " has no data.\n";
+                    return false;
+                }
+                buffer.data = glbBinary;
+                if (buffer.byteLength > glbBinarySize)
+                    buffer.byteLength = 0;
+            }
+            else if (dataUriPayload(buffer.uri, payload, payloadLength))
+            {
+                // embedded base64 cannot be mapped, this is the only copy on load
+                asset.decodedUris.emplace_back();
+                if (!decodeBase64(payload, payloadLength, asset.decodedUris.back()))
+                {
+                    cout << "ERROR: Invalid base64 data in glTF buffer " << i << ".\n";
+                    return false;
+                }
+                buffer.data = asset.decodedUris.back().data();
+                if (buffer.byteLength > asset.decodedUris.back().size())
+                    buffer.byteLength = 0;
+            }
+            else
+            {
+                unique_ptr<MappedFile> file(new MappedFile());
+                if (!file->open((asset.baseDir + buffer.uri).c_str()))
+                    return false;
+                buffer.data = (const unsigned char*)file->data();
+                if (buffer.byteLength > file->size())
+                    buffer.byteLength = 0;
+                asset.mappedFiles.push_back(std::move(file));
+            }
+            if (buffer.byteLength == 0)
+            {
+                cout << "ERROR: glTF buffer " << i << " is shorter than its byteLength.\n";
+                return false;
+            }
+        }
+        for (size_t i = 0; i < asset.bufferViews.size(); i++)
+        {
+            const GltfBufferView& view = asset.bufferViews[i];
+            if (view.buffer < 0 || view.buffer >= (int)asset.buffers.size() ||
+                view.byteOffset + view.byteLength > asset.buffers[view.buffer].byteLength)
+            {
+                cout << "ERROR: glTF bufferView " << i << " is out of range.\n";
+                return false;
+            }
+        }
+        for (size_t i = 0; i < asset.accessors.size(); i++)
+        {
+            const GltfAccessor& a = asset.accessors[i];
+            if (a.bufferView < 0)
+                continue;
+            if (a.bufferView >= (int)asset.bufferViews.size() || a.componentNum == 0 ||
+                gltfComponentSize(a.componentType) == 0)
+            {
+                cout << "ERROR: glTF accessor " << i << " is invalid.\n";
+                return false;
+            }
+            const GltfBufferView& view = asset.bufferViews[a.bufferView];
+            size_t elementSize = (size_t)gltfComponentSize(a.componentType) * a.componentNum;
+            size_t stride = view.byteStride ? view.byteStride : elementSize;
+            if (a.count > 0 && a.byteOffset + stride * (a.count - 1) + elementSize > view.byteLength)
+            {
+                cout << "ERROR: glTF accessor " << i << " is out of range.\n";
+                return false;
+            }
+        }
+        for (size_t i = 0; i < asset.images.size(); i++)
+        {
+            if (asset.images[i].bufferView >= (int)asset.bufferViews.size())
+            {
+                cout << "ERROR: glTF image " << i << " is invalid.\n";
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int gltfComponentSize(int componentType)
+{
+    switch (componentType)
+    {
+    case 0x1400: // GL_BYTE
+    case 0x1401: // GL_UNSIGNED_BYTE
+        return 1;
+    case 0x1402: // GL_SHORT
+    case 0x1403: // GL_UNSIGNED_SHORT
+        return 2;
+    case 0x1405: // GL_UNSIGNED_INT
+    case 0x1406: // GL_FLOAT
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+const unsigned char* GltfAsset::accessorData(int accessor) const
+{
+    const GltfAccessor& a = accessors[accessor];
+    if (a.bufferView < 0)
+        return nullptr;
+    const GltfBufferView& view = bufferViews[a.bufferView];
+    return buffers[view.buffer].data + view.byteOffset + a.byteOffset;
+}
+
+size_t GltfAsset::accessorStride(int accessor) const
+{
+    const GltfAccessor& a = accessors[accessor];
+    int stride = a.bufferView >= 0 ? bufferViews[a.bufferView].byteStride : 0;
+    return stride ? (size_t)stride : (size_t)gltfComponentSize(a.componentType) * a.componentNum;
+}
+
+bool gltfAccessorIsGpuCompatible(const GltfAsset& asset, int accessor, bool asIndices)
+{
+    const GltfAccessor& a = asset.accessors[accessor];
+    if (a.bufferView < 0 || a.sparse)
+        return false;
+    const GltfBufferView& view = asset.bufferViews[a.bufferView];
+    size_t offset = view.byteOffset + a.byteOffset;
+    if (asIndices)
+    {
+        return view.byteStride == 0 && (a.componentType == 0x1403 || a.componentType == 0x1405) &&
+            offset % gltfComponentSize(a.componentType) == 0;
+    }
+    return offset % 4 == 0 && asset.accessorStride(accessor) % 4 == 0;
+}
+
+bool parseGltfJson(const char* json, size_t size, GltfAsset& asset,
+    const unsigned char* glbBinary, size_t glbBinarySize)
+{
+    GltfHandler handler(asset);
+    size_t errorOffset = 0;
+    if (!parseJson(json, size, handler, &errorOffset))
+    {
+        cout << "ERROR: Invalid glTF JSON near byte " << errorOffset << ".\n";
+        return false;
+    }
+    return resolveBuffers(asset, glbBinary, glbBinarySize);
+}
+
+bool loadGltf(const char* filename, GltfAsset& asset)
+{
+    asset = GltfAsset();
+    std::string path = filename;
+    size_t slash = path.find_last_of("/\\");
+    asset.baseDir = slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+
+    unique_ptr<MappedFile> file(new MappedFile());
+    if (!file->open(filename))
+        return false;
+    const unsigned char* data = (const unsigned char*)file->data();
+    size_t size = file->size();
+    asset.mappedFiles.push_back(std::move(file));
+
+    uint32_t header[3];
+    if (size >= 12 && (memcpy(header, data, 12), header[0] == kGlbMagic))
+    {
+        if (header[1] != 2 || header[2] > size)
+        {
+            cout << "ERROR: Unsupported GLB container \"" << filename << "\".\n";
+            return false;
+        }
+        size = header[2];
+        const char* json = nullptr;
+        size_t jsonSize = 0;
+        const unsigned char* bin = nullptr;
+        size_t binSize = 0;
+        size_t offset = 12;
+        while (offset + 8 <= size)
+        {
+            uint32_t chunk[2];
+            memcpy(chunk, data + offset, 8);
+            offset += 8;
+            if (offset + chunk[0] > size)
+                break;
+            if (chunk[1] == kChunkJson && !json)
+            {
+                json = (const char*)data + offset;
+                jsonSize = chunk[0];
+            }
+            else if (chunk[1] == kChunkBin && !bin)
+            {
+                bin = data + offset;
+                binSize = chunk[0];
+            }
+            offset += (chunk[0] + 3) & ~3u;
+        }
+        if (!json)
+        {
+            cout << "ERROR: GLB file \"" << filename << "\" has no JSON chunk.\n";
+            return false;
+        }
+        return parseGltfJson(json, jsonSize, asset, bin, binSize);
+    }
+    return parseGltfJson((const char*)data, size, asset);
+}
+
+unsigned char* decodeGltfImage(const GltfAsset& asset, int image, int& width, int& height, int channels)
+{
+    const GltfImage& img = asset.images[image];
+    StbiFlipScope topFirst(false);
+    int fileChannels;
+    if (img.bufferView >= 0)
+    {
+        // decode straight from the mapped buffer
+        const GltfBufferView& view = asset.bufferViews[img.bufferView];
+        const unsigned char* data = asset.buffers[view.buffer].data + view.byteOffset;
+        return stbi_load_from_memory(data, (int)view.byteLength, &width, &height, &fileChannels, channels);
+    }
+    const char* payload;
+    size_t length;
+    if (dataUriPayload(img.uri, payload, length))
+    {
+        vector<unsigned char> bytes;
+        if (!decodeBase64(payload, length, bytes))
+            return nullptr;
+        return stbi_load_from_memory(bytes.data(), (int)bytes.size(), &width, &height, &fileChannels, channels);
+    }
+    return stbi_load((asset.baseDir + img.uri).c_str(), &width, &height, &fileChannels, channels);
+}
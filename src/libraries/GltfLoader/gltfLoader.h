@@ -0,0 +1,135 @@
+#pragma once
+
+#include <mappedFile.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// glTF 2.0 scene description. Binary data is never copied on load:
+// GLB BIN chunks and external .bin files stay memory mapped and
+// GltfBuffer::data points straight into the mapping.
+
+struct GltfBuffer
+{
+    const unsigned char* data = nullptr;
+    size_t byteLength = 0;
+    std::string uri;
+};
+
+struct GltfBufferView
+{
+    int buffer = -1;
+    size_t byteOffset = 0;
+    size_t byteLength = 0;
+    int byteStride = 0;     // 0: tightly packed
+    int target = 0;         // GL_ARRAY_BUFFER / GL_ELEMENT_ARRAY_BUFFER or 0
+};
+
+struct GltfAccessor
+{
+    int bufferView = -1;
+    size_t byteOffset = 0;
+    int componentType = 0;  // GL enum: GL_FLOAT, GL_UNSIGNED_SHORT, ...
+    int componentNum = 0;   // 1 for SCALAR ... 16 for MAT4
+    size_t count = 0;
+    bool normalized = false;
+    bool sparse = false;    // not supported: uploadGltf leaves primitives using one empty
+};
+
+struct GltfPrimitive
+{
+    std::map<std::string, int> attributes;  // "POSITION" -> accessor
+    int indices = -1;
+    int material = -1;
+    int mode = 4;           // GL_TRIANGLES
+};
+
+struct GltfMesh
+{
+    std::string name;
+    std::vector<GltfPrimitive> primitives;
+};
+
+struct GltfMaterial
+{
+    std::string name;
+    float baseColorFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    int baseColorTexture = -1;
+    int normalTexture = -1;
+};
+
+struct GltfImage
+{
+    std::string uri;
+    int bufferView = -1;
+    std::string mimeType;
+};
+
+struct GltfTexture
+{
+    int source = -1;
+};
+
+struct GltfNode
+{
+    std::string name;
+    int mesh = -1;
+    std::vector<int> children;
+    bool hasMatrix = false;
+    float matrix[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    float translation[3] = { 0.0f, 0.0f, 0.0f };
+    float rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };    // x, y, z, w
+    float scale[3] = { 1.0f, 1.0f, 1.0f };
+};
+
+struct GltfScene
+{
+    std::vector<int> nodes;
+};
+
+struct GltfAsset
+{
+    std::vector<GltfBuffer> buffers;
+    std::vector<GltfBufferView> bufferViews;
+    std::vector<GltfAccessor> accessors;
+    std::vector<GltfMesh> meshes;
+    std::vector<GltfMaterial> materials;
+    std::vector<GltfImage> images;
+    std::vector<GltfTexture> textures;
+    std::vector<GltfNode> nodes;
+    std::vector<GltfScene> scenes;
+    int scene = 0;
+    std::string baseDir;
+
+    // keep the binary data alive
+    std::vector<std::unique_ptr<MappedFile>> mappedFiles;
+    std::vector<std::vector<unsigned char>> decodedUris;
+
+    // Pointer to the first element of an accessor, nullptr if it has no data
+    const unsigned char* accessorData(int accessor) const;
+    // Distance between elements, resolves a 0 byteStride to the packed size
+    size_t accessorStride(int accessor) const;
+};
+
+// Byte size of a GL component type (GL_BYTE ... GL_FLOAT)
+int gltfComponentSize(int componentType);
+
+// True when the accessor can be bound in place from its bufferView:
+// component offsets aligned, 4-byte aligned vertex stride, 16/32-bit indices
+bool gltfAccessorIsGpuCompatible(const GltfAsset& asset, int accessor, bool asIndices);
+
+// Load a .gltf (JSON + external/embedded buffers) or .glb file
+bool loadGltf(const char* filename, GltfAsset& asset);
+
+// Parse glTF JSON, buffers with a uri are resolved relative to asset.baseDir.
+// glbBinary/glbBinarySize give the BIN chunk of a GLB container.
+bool parseGltfJson(const char* json, size_t size, GltfAsset& asset,
+    const unsigned char* glbBinary = nullptr, size_t glbBinarySize = 0);
+
+// Decode an image with stb_image, reading embedded images in place. Rows come top first as the
+// glTF uv origin wants, whatever stbi_set_flip_vertically_on_load says; the setting is restored.
+// Returns nullptr on failure, free with stbi_image_free.
+unsigned char* decodeGltfImage(const GltfAsset& asset, int image, int& width, int& height, int channels);
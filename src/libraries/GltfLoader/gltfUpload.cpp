@@ -0,0 +1,257 @@
+#include "gltfUpload.h"
+
+#include <stb_image.h>
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+namespace
+{
+    int attribLocation(const string& name, bool& integer)
+    {
+        integer = false;
+        if (name == "POSITION") return GLTF_LOCATION_POSITION;
+        if (name == "COLOR_0") return GLTF_LOCATION_COLOR;
+        if (name == "TEXCOORD_0") return GLTF_LOCATION_TEXCOORD0;
+        if (name == "NORMAL") return GLTF_LOCATION_NORMAL;
+        if (name == "TANGENT") return GLTF_LOCATION_TANGENT;
+        if (name == "TEXCOORD_1") return GLTF_LOCATION_TEXCOORD1;
+        if (name == "WEIGHTS_0") return GLTF_LOCATION_WEIGHTS;
+        if (name == "JOINTS_0")
+        {
+            integer = true;
+            return GLTF_LOCATION_JOINTS;
+        }
+        return -1;
+    }
+
+    float readComponent(const unsigned char* p, int type, bool normalized)
+    {
+        switch (type)
+        {
+        case GL_BYTE: { signed char v = (signed char)*p; return normalized ? max(v / 127.0f, -1.0f) : v; }
+        case GL_UNSIGNED_BYTE: return normalized ? *p / 255.0f : *p;
+        case GL_SHORT: { short v; memcpy(&v, p, 2); return normalized ? max(v / 32767.0f, -1.0f) : v; }
+        case GL_UNSIGNED_SHORT: { unsigned short v; memcpy(&v, p, 2); return normalized ? v / 65535.0f : v; }
+        case GL_UNSIGNED_INT: { unsigned int v; memcpy(&v, p, 4); return (float)v; }
+        case GL_FLOAT: { float v; memcpy(&v, p, 4); return v; }
+        default: return 0.0f;
+        }
+    }
+
+    unsigned int createBuffer(GLenum target, const void* data, size_t size)
+    {
+        unsigned int buffer;
+        glGenBuffers(1, &buffer);
+        glBindBuffer(target, buffer);
+        glBufferData(target, size, data, GL_STATIC_DRAW);
+        return buffer;
+    }
+
+    // GL buffer holding a whole bufferView, uploaded on first use
+    unsigned int viewBuffer(const GltfAsset& asset, GltfGpuScene& scene, int view, GLenum target)
+    {
+        if (scene.viewBuffers[view] == 0)
+        {
+            const GltfBufferView& v = asset.bufferViews[view];
+            scene.viewBuffers[view] = createBuffer(target,
+                asset.buffers[v.buffer].data + v.byteOffset, v.byteLength);
+            scene.directBytes += v.byteLength;
+        }
+        else
+            glBindBuffer(target, scene.viewBuffers[view]);
+        return scene.viewBuffers[view];
+    }
+
+    void bindAttribute(const GltfAsset& asset, GltfGpuScene& scene, int accessor, int location, bool integer)
+    {
+        const GltfAccessor& a = asset.accessors[accessor];
+        if (gltfAccessorIsGpuCompatible(asset, accessor, false))
+        {
+            viewBuffer(asset, scene, a.bufferView, GL_ARRAY_BUFFER);
+            GLsizei stride = (GLsizei)asset.bufferViews[a.bufferView].byteStride;
+            if (integer)
+                glVertexAttribIPointer(location, a.componentNum, a.componentType, stride, (void*)a.byteOffset);
+            else
+                glVertexAttribPointer(location, a.componentNum, a.componentType,
+                    a.normalized ? GL_TRUE : GL_FALSE, stride, (void*)a.byteOffset);
+        }
+        else
+        {
+            // repack to tightly packed floats (zeros for accessors without a bufferView)
+            vector<float> packed(a.count * a.componentNum, 0.0f);
+            const unsigned char* src = asset.accessorData(accessor);
+            if (src)
+            {
+                size_t stride = asset.accessorStride(accessor);
+                int componentSize = gltfComponentSize(a.componentType);
+                for (size_t i = 0; i < a.count; i++)
+                    for (int c = 0; c < a.componentNum; c++)
+                        packed[i * a.componentNum + c] =
+                            readComponent(src + i * stride + c * componentSize, a.componentType, a.normalized);
+            }
+            size_t bytes = packed.size() * sizeof(float);
+            scene.convertedBuffers.push_back(createBuffer(GL_ARRAY_BUFFER, packed.data(), bytes));
+            scene.convertedBytes += bytes;
+            glVertexAttribPointer(location, a.componentNum, GL_FLOAT, GL_FALSE, 0, (void*)0);
+        }
+        glEnableVertexAttribArray(location);
+    }
+
+    // binds the EBO to the current VAO
+    bool bindIndices(const GltfAsset& asset, GltfGpuScene& scene, int accessor, GltfGpuPrimitive& prim)
+    {
+        const GltfAccessor& a = asset.accessors[accessor];
+        prim.count = (GLsizei)a.count;
+        if (gltfAccessorIsGpuCompatible(asset, accessor, true))
+        {
+            viewBuffer(asset, scene, a.bufferView, GL_ELEMENT_ARRAY_BUFFER);
+            prim.indexType = a.componentType;
+            prim.indexOffset = a.byteOffset;
+            return true;
+        }
+        const unsigned char* src = asset.accessorData(accessor);
+        if (!src)
+            return false;
+        size_t stride = asset.accessorStride(accessor);
+        if (a.componentType == GL_UNSIGNED_BYTE || a.componentType == GL_UNSIGNED_SHORT)
+        {
+            // 8-bit indices are slow on most hardware, widen them
+            vector<unsigned short> packed(a.count);
+            for (size_t i = 0; i < a.count; i++)
+                packed[i] = (unsigned short)readComponent(src + i * stride, a.componentType, false);
+            scene.convertedBuffers.push_back(createBuffer(GL_ELEMENT_ARRAY_BUFFER, packed.data(), a.count * 2));
+            scene.convertedBytes += a.count * 2;
+            prim.indexType = GL_UNSIGNED_SHORT;
+        }
+        else if (a.componentType == GL_UNSIGNED_INT)
+        {
+            vector<unsigned int> packed(a.count);
+            for (size_t i = 0; i < a.count; i++)
+                memcpy(&packed[i], src + i * stride, 4);
+            scene.convertedBuffers.push_back(createBuffer(GL_ELEMENT_ARRAY_BUFFER, packed.data(), a.count * 4));
+            scene.convertedBytes += a.count * 4;
+            prim.indexType = GL_UNSIGNED_INT;
+        }
+        else
+            return false;
+        prim.indexOffset = 0;
+        return true;
+    }
+
+    // the first sparse accessor of the primitive, -1 for none: repacking would upload the base
+    // data without the substitutions
+    int sparseAccessor(const GltfAsset& asset, const GltfPrimitive& p)
+    {
+        for (const auto& attribute : p.attributes)
+        {
+            if (attribute.second >= 0 && attribute.second < (int)asset.accessors.size() &&
+                asset.accessors[attribute.second].sparse)
+                return attribute.second;
+        }
+        if (p.indices >= 0 && p.indices < (int)asset.accessors.size() && asset.accessors[p.indices].sparse)
+            return p.indices;
+        return -1;
+    }
+
+    unsigned int uploadTexture(const GltfAsset& asset, int image)
+    {
+        int width, height;
+        unsigned char* data = decodeGltfImage(asset, image, width, height, 4);
+        if (!data)
+        {
+            cout << "ERROR: Failed to decode glTF image " << image << ".\n";
+            return 0;
+        }
+        unsigned int texture;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        stbi_image_free(data);
+        return texture;
+    }
+}
+
+bool uploadGltf(const GltfAsset& asset, GltfGpuScene& scene, bool loadTextures)
+{
+    releaseGltf(scene);
+    scene.viewBuffers.assign(asset.bufferViews.size(), 0);
+    scene.meshes.resize(asset.meshes.size());
+    bool ok = true;
+    for (size_t m = 0; m < asset.meshes.size(); m++)
+    {
+        for (const GltfPrimitive& p : asset.meshes[m].primitives)
+        {
+            GltfGpuPrimitive prim;
+            prim.mode = p.mode;
+            prim.material = p.material;
+            int sparse = sparseAccessor(asset, p);
+            if (sparse >= 0)
+            {
+                cout << "ERROR: Unsupported sparse glTF accessor " << sparse << ", primitive left empty.\n";
+                ok = false;
+                scene.meshes[m].push_back(prim);
+                continue;
+            }
+            glGenVertexArrays(1, &prim.VAO);
+            glBindVertexArray(prim.VAO);
+            for (const auto& attribute : p.attributes)
+            {
+                bool integer;
+                int location = attribLocation(attribute.first, integer);
+                if (location < 0 || attribute.second < 0 || attribute.second >= (int)asset.accessors.size())
+                    continue;
+                bindAttribute(asset, scene, attribute.second, location, integer);
+                if (attribute.first == "POSITION")
+                    prim.count = (GLsizei)asset.accessors[attribute.second].count;
+            }
+            if (p.indices >= 0 && p.indices < (int)asset.accessors.size())
+            {
+                if (!bindIndices(asset, scene, p.indices, prim))
+                {
+                    cout << "ERROR: Unsupported glTF index accessor " << p.indices << ".\n";
+                    ok = false;
+                }
+            }
+            glBindVertexArray(0);
+            scene.meshes[m].push_back(prim);
+        }
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    scene.textures.assign(asset.textures.size(), 0);
+    if (loadTextures)
+    {
+        for (size_t t = 0; t < asset.textures.size(); t++)
+        {
+            int image = asset.textures[t].source;
+            if (image >= 0 && image < (int)asset.images.size())
+                scene.textures[t] = uploadTexture(asset, image);
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+    return ok;
+}
+
+void releaseGltf(GltfGpuScene& scene)
+{
+    for (auto& mesh : scene.meshes)
+        for (GltfGpuPrimitive& prim : mesh)
+            glDeleteVertexArrays(1, &prim.VAO);
+    for (unsigned int buffer : scene.viewBuffers)
+        if (buffer)
+            glDeleteBuffers(1, &buffer);
+    if (!scene.convertedBuffers.empty())
+        glDeleteBuffers((GLsizei)scene.convertedBuffers.size(), scene.convertedBuffers.data());
+    for (unsigned int texture : scene.textures)
+        if (texture)
+            glDeleteTextures(1, &texture);
+    scene = GltfGpuScene();
+}
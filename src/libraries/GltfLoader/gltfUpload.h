@@ -0,0 +1,48 @@
+#pragma once
+
+#include "gltfLoader.h"
+#include <glad/glad.h>
+#include <vector>
+
+// Vertex attribute locations used by uploadGltf, matching the chapter shaders
+// (aPos at 0, aColor at 1, aTexCoord at 2)
+enum GltfAttribLocation
+{
+    GLTF_LOCATION_POSITION = 0,
+    GLTF_LOCATION_COLOR = 1,
+    GLTF_LOCATION_TEXCOORD0 = 2,
+    GLTF_LOCATION_NORMAL = 3,
+    GLTF_LOCATION_TANGENT = 4,
+    GLTF_LOCATION_TEXCOORD1 = 5,
+    GLTF_LOCATION_JOINTS = 6,
+    GLTF_LOCATION_WEIGHTS = 7,
+};
+
+struct GltfGpuPrimitive
+{
+    unsigned int VAO = 0;
+    GLenum mode = GL_TRIANGLES;
+    GLsizei count = 0;              // index count, or vertex count if not indexed
+    GLenum indexType = 0;           // 0: glDrawArrays
+    size_t indexOffset = 0;         // byte offset into the bound EBO
+    int material = -1;
+};
+
+struct GltfGpuScene
+{
+    std::vector<unsigned int> viewBuffers;      // one GL buffer per uploaded bufferView, 0 if unused
+    std::vector<unsigned int> convertedBuffers; // repacked accessors
+    std::vector<std::vector<GltfGpuPrimitive>> meshes;
+    std::vector<unsigned int> textures;         // per glTF texture, 0 if the image failed
+
+    size_t directBytes = 0;         // uploaded straight from the mapped file
+    size_t convertedBytes = 0;      // uploaded after repacking
+};
+
+// Create VAOs/VBOs/EBOs and textures for every mesh of the asset.
+// BufferViews are uploaded once and shared by all accessors that can read them in place,
+// other accessors are repacked (attributes to float, 8-bit indices to 16-bit). A primitive
+// with a sparse accessor is reported and left empty (no VAO, count 0); false is returned.
+bool uploadGltf(const GltfAsset& asset, GltfGpuScene& scene, bool loadTextures = true);
+
+void releaseGltf(GltfGpuScene& scene);
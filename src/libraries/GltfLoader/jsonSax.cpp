@@ -0,0 +1,277 @@
+#include "jsonSax.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    class JsonParser
+    {
+    public:
+        JsonParser(const char* text, size_t size, JsonSaxHandler& handler)
+            : p(text), begin(text), end(text + size), handler(handler) {}
+
+        bool parse()
+        {
+            // 'o' object, 'a' array
+            std::vector<char> stack;
+            skipSpace();
+            if (!value(stack))
+                return false;
+            while (!stack.empty())
+            {
+                skipSpace();
+                if (p >= end)
+                    return false;
+                char scope = stack.back();
+                char c = *p;
+                if (c == (scope == 'o' ? '}' : ']'))
+                {
+                    p++;
+                    stack.pop_back();
+                    if (!(scope == 'o' ? handler.endObject() : handler.endArray()))
+                        return false;
+                    continue;
+                }
+                if (c != ',')
+                    return false;
+                p++;
+                skipSpace();
+                if (scope == 'o' && !member())
+                    return false;
+                if (!value(stack))
+                    return false;
+            }
+            skipSpace();
+            return p == end;
+        }
+
+        size_t offset() const { return p - begin; }
+
+    private:
+        void skipSpace()
+        {
+            while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t'))
+                p++;
+        }
+
+        // "key" :
+        bool member()
+        {
+            const char* str;
+            size_t length;
+            if (!readString(str, length) || !handler.key(str, length))
+                return false;
+            skipSpace();
+            if (p >= end || *p != ':')
+                return false;
+            p++;
+            skipSpace();
+            return true;
+        }
+
+        // Parse one value. Containers push a scope and report their first member,
+        // the rest is handled by the loop in parse().
+        bool value(std::vector<char>& stack)
+        {
+            if (p >= end)
+                return false;
+            switch (*p)
+            {
+            case '{':
+                p++;
+                if (!handler.startObject())
+                    return false;
+                skipSpace();
+                if (p < end && *p == '}')
+                {
+                    p++;
+                    return handler.endObject();
+                }
+                stack.push_back('o');
+                return member() && value(stack);
+            case '[':
+                p++;
+                if (!handler.startArray())
+                    return false;
+                skipSpace();
+                if (p < end && *p == ']')
+                {
+                    p++;
+                    return handler.endArray();
+                }
+                stack.push_back('a');
+                return value(stack);
+            case '"':
+            {
+                const char* str;
+                size_t length;
+                return readString(str, length) && handler.string(str, length);
+            }
+            case 't':
+                return literal("true") && handler.boolean(true);
+            case 'f':
+                return literal("false") && handler.boolean(false);
+            case 'n':
+                return literal("null") && handler.null();
+            default:
+                return readNumber();
+            }
+        }
+
+        bool literal(const char* word)
+        {
+            size_t n = strlen(word);
+            if ((size_t)(end - p) < n || memcmp(p, word, n) != 0)
+                return false;
+            p += n;
+            return true;
+        }
+
+        bool readNumber()
+        {
+            // strtod needs a terminated buffer, numbers are short so copy them
+            char buf[64];
+            size_t n = 0;
+            while (p + n < end && n < sizeof(buf) - 1 && strchr("+-0123456789.eE", p[n]))
+                n++;
+            if (n == 0)
+                return false;
+            memcpy(buf, p, n);
+            buf[n] = 0;
+            char* stop;
+            double v = strtod(buf, &stop);
+            if (stop != buf + n)
+                return false;
+            p += n;
+            return handler.number(v);
+        }
+
+        static void appendUtf8(std::string& out, unsigned int cp)
+        {
+            if (cp < 0x80)
+                out += (char)cp;
+            else if (cp < 0x800)
+            {
+                out += (char)(0xC0 | (cp >> 6));
+                out += (char)(0x80 | (cp & 0x3F));
+            }
+            else if (cp < 0x10000)
+            {
+                out += (char)(0xE0 | (cp >> 12));
+                out += (char)(0x80 | ((cp >> 6) & 0x3F));
+                out += (char)(0x80 | (cp & 0x3F));
+            }
+            else
+            {
+                out += (char)(0xF0 | (cp >> 18));
+                out += (char)(0x80 | ((cp >> 12) & 0x3F));
+                out += (char)(0x80 | ((cp >> 6) & 0x3F));
+                out += (char)(0x80 | (cp & 0x3F));
+            }
+        }
+
+        bool readHex4(unsigned int& cp)
+        {
+            if (end - p < 4)
+                return false;
+            cp = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                char c = *p++;
+                cp <<= 4;
+                if (c >= '0' && c <= '9')
+                    cp |= c - '0';
+                else if (c >= 'a' && c <= 'f')
+                    cp |= c - 'a' + 10;
+                else if (c >= 'A' && c <= 'F')
+                    cp |= c - 'A' + 10;
+                else
+                    return false;
+            }
+            return true;
+        }
+
+        bool readString(const char*& str, size_t& length)
+        {
+            if (p >= end || *p != '"')
+                return false;
+            const char* start = ++p;
+            while (p < end && *p != '"' && *p != '\\')
+                p++;
+            if (p >= end)
+                return false;
+            if (*p == '"')
+            {
+                // fast path, no escapes
+                str = start;
+                length = p - start;
+                p++;
+                return true;
+            }
+            scratch.assign(start, p);
+            while (p < end && *p != '"')
+            {
+                if (*p != '\\')
+                {
+                    scratch += *p++;
+                    continue;
+                }
+                if (++p >= end)
+                    return false;
+                char c = *p++;
+                switch (c)
+                {
+                case '"': scratch += '"'; break;
+                case '\\': scratch += '\\'; break;
+                case '/': scratch += '/'; break;
+                case 'b': scratch += '\b'; break;
+                case 'f': scratch += '\f'; break;
+                case 'n': scratch += '\n'; break;
+                case 'r': scratch += '\r'; break;
+                case 't': scratch += '\t'; break;
+                case 'u':
+                {
+                    unsigned int cp;
+                    if (!readHex4(cp))
+                        return false;
+                    if (cp >= 0xD800 && cp < 0xDC00 && end - p >= 6 && p[0] == '\\' && p[1] == 'u')
+                    {
+                        p += 2;
+                        unsigned int low;
+                        if (!readHex4(low))
+                            return false;
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(scratch, cp);
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+            if (p >= end)
+                return false;
+            p++;
+            str = scratch.data();
+            length = scratch.size();
+            return true;
+        }
+
+        const char* p;
+        const char* begin;
+        const char* end;
+        JsonSaxHandler& handler;
+        std::string scratch;
+    };
+}
+
+bool parseJson(const char* text, size_t size, JsonSaxHandler& handler, size_t* errorOffset)
+{
+    JsonParser parser(text, size, handler);
+    bool ok = parser.parse();
+    if (!ok && errorOffset)
+        *errorOffset = parser.offset();
+    return ok;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Event interface of the SAX JSON parser.
+// Strings and keys point into the source text when they contain no escapes,
+// otherwise into a scratch buffer that is only valid during the call.
+// Returning false from any event aborts parsing.
+class JsonSaxHandler
+{
+public:
+    virtual ~JsonSaxHandler() = default;
+    virtual bool startObject() { return true; }
+    virtual bool endObject() { return true; }
+    virtual bool startArray() { return true; }
+    virtual bool endArray() { return true; }
+    virtual bool key(const char* /*str*/, size_t /*length*/) { return true; }
+    virtual bool string(const char* /*str*/, size_t /*length*/) { return true; }
+    virtual bool number(double /*value*/) { return true; }
+    virtual bool boolean(bool /*value*/) { return true; }
+    virtual bool null() { return true; }
+};
+
+// Parse a JSON document without building a tree.
+// On failure errorOffset (if given) receives the byte offset of the problem.
+bool parseJson(const char* text, size_t size, JsonSaxHandler& handler, size_t* errorOffset = nullptr);
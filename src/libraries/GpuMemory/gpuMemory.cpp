@@ -0,0 +1,960 @@
+#include "gpuMemory.h"
+
+#include <benchUtils.h>
+#include <glad/glad.h>
+#include <glHooks.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+
+namespace
+{
+    const char* const kCategoryNames[] = { "texture", "render target", "vertex buffer", "index buffer",
+        "uniform buffer", "pixel buffer", "other buffer" };
+    const char* const kCategoryKeys[] = { "texture", "render_target", "vertex_buffer", "index_buffer",
+        "uniform_buffer", "pixel_buffer", "other_buffer" };
+
+    thread_local const char* currentTag = "";
+
+    double now()
+    {
+        return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    const char* identifierName(unsigned int identifier)
+    {
+        return identifier == GL_BUFFER ? "buffer" : identifier == GL_TEXTURE ? "texture" : "renderbuffer";
+    }
+
+    //------- sizes -------
+    // bytes per texel of an internal format as the GPU stores it: 3 component formats are padded
+    size_t texelBytes(GLenum format)
+    {
+        switch (format)
+        {
+        case GL_R8: case GL_R8I: case GL_R8UI: case GL_R8_SNORM: case GL_RED: case GL_STENCIL_INDEX8:
+            return 1;
+        case GL_RG8: case GL_RG8I: case GL_RG8UI: case GL_RG8_SNORM: case GL_R16: case GL_R16F: case GL_R16I:
+        case GL_R16UI: case GL_RG: case GL_DEPTH_COMPONENT16: case GL_RGB5_A1: case GL_RGBA4:
+            return 2;
+        case GL_RGBA16: case GL_RGBA16F: case GL_RGBA16I: case GL_RGBA16UI: case GL_RGB16: case GL_RGB16F:
+        case GL_RGB16I: case GL_RGB16UI: case GL_RG32F: case GL_RG32I: case GL_RG32UI: case GL_DEPTH32F_STENCIL8:
+            return 8;
+        case GL_RGB32F: case GL_RGB32I: case GL_RGB32UI: case GL_RGBA32F: case GL_RGBA32I: case GL_RGBA32UI:
+            return 16;
+        default:
+            // RGB(A)8, sRGB, 10/11 bit packed, RG16, R32, depth 24/32, depth-stencil
+            return 4;
+        }
+    }
+
+    // the shadow bindings' slot of a buffer target, -1 for the element array buffer (vertex array
+    // state) and the unknown ones
+    const GLenum kBufferTargets[] = { GL_ARRAY_BUFFER, GL_UNIFORM_BUFFER, GL_PIXEL_PACK_BUFFER, GL_PIXEL_UNPACK_BUFFER,
+        GL_TRANSFORM_FEEDBACK_BUFFER, GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER };
+    const int kBufferTargetNum = sizeof(kBufferTargets) / sizeof(kBufferTargets[0]);
+
+    int bufferSlot(GLenum target)
+    {
+        for (int i = 0; i < kBufferTargetNum; i++)
+        {
+            if (kBufferTargets[i] == target)
+                return i;
+        }
+        return -1;
+    }
+
+    GLenum bufferBinding(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_ARRAY_BUFFER: return GL_ARRAY_BUFFER_BINDING;
+        case GL_ELEMENT_ARRAY_BUFFER: return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+        case GL_UNIFORM_BUFFER: return GL_UNIFORM_BUFFER_BINDING;
+        case GL_PIXEL_PACK_BUFFER: return GL_PIXEL_PACK_BUFFER_BINDING;
+        case GL_PIXEL_UNPACK_BUFFER: return GL_PIXEL_UNPACK_BUFFER_BINDING;
+        case GL_TRANSFORM_FEEDBACK_BUFFER: return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+        // the copy targets are their own binding queries
+        case GL_COPY_READ_BUFFER: case GL_COPY_WRITE_BUFFER: return target;
+        default: return 0;
+        }
+    }
+
+    GpuMemoryCategory bufferCategory(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_ARRAY_BUFFER: return GpuMemoryCategory::VertexBuffer;
+        case GL_ELEMENT_ARRAY_BUFFER: return GpuMemoryCategory::IndexBuffer;
+        case GL_UNIFORM_BUFFER: return GpuMemoryCategory::UniformBuffer;
+        case GL_PIXEL_PACK_BUFFER: case GL_PIXEL_UNPACK_BUFFER: return GpuMemoryCategory::PixelBuffer;
+        default: return GpuMemoryCategory::OtherBuffer;
+        }
+    }
+
+    const GLenum kTextureTargets[] = { GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_RECTANGLE, GL_TEXTURE_1D,
+        GL_TEXTURE_1D_ARRAY, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_3D, GL_TEXTURE_2D_MULTISAMPLE, GL_TEXTURE_2D_MULTISAMPLE_ARRAY };
+    const int kTextureTargetNum = sizeof(kTextureTargets) / sizeof(kTextureTargets[0]);
+
+    // of a glBindTexture target, -1 for the unknown ones
+    int textureSlot(GLenum target)
+    {
+        for (int i = 0; i < kTextureTargetNum; i++)
+        {
+            if (kTextureTargets[i] == target)
+                return i;
+        }
+        return -1;
+    }
+
+    // cube map faces are stored per face under the cube map's binding
+    GLenum textureBinding(GLenum target, int& face)
+    {
+        face = 0;
+        if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+        {
+            face = target - GL_TEXTURE_CUBE_MAP_POSITIVE_X;
+            return GL_TEXTURE_BINDING_CUBE_MAP;
+        }
+        switch (target)
+        {
+        case GL_TEXTURE_2D: return GL_TEXTURE_BINDING_2D;
+        case GL_TEXTURE_CUBE_MAP: return GL_TEXTURE_BINDING_CUBE_MAP;
+        case GL_TEXTURE_RECTANGLE: return GL_TEXTURE_BINDING_RECTANGLE;
+        case GL_TEXTURE_1D: return GL_TEXTURE_BINDING_1D;
+        case GL_TEXTURE_1D_ARRAY: return GL_TEXTURE_BINDING_1D_ARRAY;
+        case GL_TEXTURE_2D_ARRAY: return GL_TEXTURE_BINDING_2D_ARRAY;
+        case GL_TEXTURE_3D: return GL_TEXTURE_BINDING_3D;
+        case GL_TEXTURE_2D_MULTISAMPLE: return GL_TEXTURE_BINDING_2D_MULTISAMPLE;
+        case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY;
+        default: return 0;
+        }
+    }
+
+    GLuint bound(GLenum binding)
+    {
+        GLint name = 0;
+        if (binding)
+            glad_glGetIntegerv(binding, &name);
+        return (GLuint)name;
+    }
+
+    //------- bindings -------
+    // What is bound where, followed through the bind calls so an allocation does not need a
+    // glGetIntegerv, which waits for a threaded driver's command thread. Per thread, as is the
+    // current context. A binding that is not known, made before enable or while disabled, is
+    // queried once; deleting a bound object makes its bindings unknown again.
+    const GLuint kUnknown = ~0u;
+
+    struct Bindings
+    {
+        uint64_t epoch = 0;
+        GLuint buffers[kBufferTargetNum];
+        GLuint vertexArray;
+        unordered_map<GLuint, GLuint> elementBuffers;      // per vertex array
+        GLuint renderbuffer;
+        GLuint activeUnit;
+        vector<array<GLuint, kTextureTargetNum>> units;
+    };
+    thread_local Bindings bindings;
+    atomic<uint64_t> bindingEpoch(0);   // every enable forgets what was followed before
+
+    Bindings& current()
+    {
+        Bindings& b = bindings;
+        uint64_t epoch = bindingEpoch.load(memory_order_relaxed);
+        if (b.epoch != epoch)
+        {
+            b.epoch = epoch;
+            fill(begin(b.buffers), end(b.buffers), kUnknown);
+            b.vertexArray = b.renderbuffer = b.activeUnit = kUnknown;
+            b.elementBuffers.clear();
+            b.units.clear();
+        }
+        return b;
+    }
+
+    GLuint currentVertexArray(Bindings& b)
+    {
+        if (b.vertexArray == kUnknown)
+            b.vertexArray = bound(GL_VERTEX_ARRAY_BINDING);
+        return b.vertexArray;
+    }
+
+    GLuint& textureUnitSlot(Bindings& b, int slot)
+    {
+        if (b.activeUnit == kUnknown)
+            b.activeUnit = bound(GL_ACTIVE_TEXTURE) - GL_TEXTURE0;
+        if (b.activeUnit >= b.units.size())
+        {
+            array<GLuint, kTextureTargetNum> unknown;
+            unknown.fill(kUnknown);
+            b.units.resize(b.activeUnit + 1, unknown);
+        }
+        return b.units[b.activeUnit][slot];
+    }
+
+    GLuint boundBuffer(GLenum target)
+    {
+        Bindings& b = current();
+        if (target == GL_ELEMENT_ARRAY_BUFFER)
+        {
+            GLuint vertexArray = currentVertexArray(b);
+            auto it = b.elementBuffers.find(vertexArray);
+            if (it == b.elementBuffers.end())
+                it = b.elementBuffers.emplace(vertexArray, bound(GL_ELEMENT_ARRAY_BUFFER_BINDING)).first;
+            return it->second;
+        }
+        int slot = bufferSlot(target);
+        if (slot < 0)
+            return bound(bufferBinding(target));
+        if (b.buffers[slot] == kUnknown)
+            b.buffers[slot] = bound(bufferBinding(target));
+        return b.buffers[slot];
+    }
+
+    GLuint boundTexture(GLenum target, int& face)
+    {
+        GLenum binding = textureBinding(target, face);
+        int slot = textureSlot(binding == GL_TEXTURE_BINDING_CUBE_MAP ? GL_TEXTURE_CUBE_MAP : target);
+        if (slot < 0)
+            return bound(binding);
+        GLuint& name = textureUnitSlot(current(), slot);
+        if (name == kUnknown)
+            name = bound(binding);
+        return name;
+    }
+
+    GLuint boundRenderbuffer()
+    {
+        Bindings& b = current();
+        if (b.renderbuffer == kUnknown)
+            b.renderbuffer = bound(GL_RENDERBUFFER_BINDING);
+        return b.renderbuffer;
+    }
+
+    void forgetBuffer(GLuint buffer)
+    {
+        Bindings& b = current();
+        for (GLuint& name : b.buffers)
+        {
+            if (name == buffer)
+                name = kUnknown;
+        }
+        for (auto it = b.elementBuffers.begin(); it != b.elementBuffers.end();)
+            it = it->second == buffer ? b.elementBuffers.erase(it) : next(it);
+    }
+
+    void forgetTexture(GLuint texture)
+    {
+        for (array<GLuint, kTextureTargetNum>& unit : current().units)
+        {
+            for (GLuint& name : unit)
+            {
+                if (name == texture)
+                    name = kUnknown;
+            }
+        }
+    }
+
+    //------- textures -------
+    const int kMaxLevels = 16;
+
+    // every level of every face, a texture is allocated one glTexImage at a time
+    struct TextureLevels
+    {
+        size_t bytes[6][kMaxLevels] = {};
+        int width[6][kMaxLevels] = {};
+        int height[6][kMaxLevels] = {};
+        int depth[6][kMaxLevels] = {};
+        GLenum format = 0;
+        GLenum target = 0;
+        int samples = 1;            // multisample textures have a single level
+
+        size_t total() const
+        {
+            size_t sum = 0;
+            for (int f = 0; f < 6; f++)
+            {
+                for (int l = 0; l < kMaxLevels; l++)
+                    sum += bytes[f][l];
+            }
+            return sum;
+        }
+    };
+    unordered_map<GLuint, TextureLevels> textures;
+
+    void allocateTexture(GLuint texture, const TextureLevels& t)
+    {
+        GpuMemory::Allocation a = {};
+        a.category = GpuMemoryCategory::Texture;
+        a.identifier = GL_TEXTURE;
+        a.name = texture;
+        a.target = t.target;
+        a.format = t.format;
+        a.width = t.width[0][0];
+        a.height = t.height[0][0];
+        a.depth = t.depth[0][0];
+        a.samples = t.samples;
+        a.bytes = t.total();
+        GpuMemory::instance().allocate(a);
+    }
+
+    void specifyLevel(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth,
+        GLsizei samples = 1)
+    {
+        int face;
+        GLuint texture = boundTexture(target, face);
+        if (!texture || level < 0 || level >= kMaxLevels)
+            return;
+        TextureLevels& t = textures[texture];
+        t.target = target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z ? GL_TEXTURE_CUBE_MAP : target;
+        if (level == 0)
+        {
+            t.format = internalformat;
+            t.samples = max(samples, 1);
+        }
+        t.width[face][level] = width;
+        t.height[face][level] = height;
+        t.depth[face][level] = depth;
+        t.bytes[face][level] = (size_t)max(width, 0) * max(height, 0) * max(depth, 0) * t.samples * texelBytes(internalformat);
+        allocateTexture(texture, t);
+    }
+
+    //------- wrappers -------
+    PFNGLBINDBUFFERPROC realBindBuffer;
+    PFNGLBINDBUFFERBASEPROC realBindBufferBase;
+    PFNGLBINDBUFFERRANGEPROC realBindBufferRange;
+    PFNGLBINDVERTEXARRAYPROC realBindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC realDeleteVertexArrays;
+    PFNGLACTIVETEXTUREPROC realActiveTexture;
+    PFNGLBINDTEXTUREPROC realBindTexture;
+    PFNGLBINDRENDERBUFFERPROC realBindRenderbuffer;
+    PFNGLBUFFERDATAPROC realBufferData;
+    PFNGLDELETEBUFFERSPROC realDeleteBuffers;
+    PFNGLTEXIMAGE1DPROC realTexImage1D;
+    PFNGLTEXIMAGE2DPROC realTexImage2D;
+    PFNGLCOPYTEXIMAGE1DPROC realCopyTexImage1D;
+    PFNGLCOPYTEXIMAGE2DPROC realCopyTexImage2D;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC realTexImage2DMultisample;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC realTexImage3DMultisample;
+    PFNGLTEXIMAGE3DPROC realTexImage3D;
+    PFNGLGENERATEMIPMAPPROC realGenerateMipmap;
+    PFNGLDELETETEXTURESPROC realDeleteTextures;
+    PFNGLRENDERBUFFERSTORAGEPROC realRenderbufferStorage;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC realRenderbufferStorageMultisample;
+    PFNGLDELETERENDERBUFFERSPROC realDeleteRenderbuffers;
+    PFNGLFRAMEBUFFERTEXTURE2DPROC realFramebufferTexture2D;
+    PFNGLOBJECTLABELPROC realObjectLabel;
+
+    void bindBuffer(GLenum target, GLuint buffer)
+    {
+        Bindings& b = current();
+        if (target == GL_ELEMENT_ARRAY_BUFFER)
+            b.elementBuffers[currentVertexArray(b)] = buffer;
+        else if (bufferSlot(target) >= 0)
+            b.buffers[bufferSlot(target)] = buffer;
+    }
+
+    void APIENTRY trackBindBuffer(GLenum target, GLuint buffer)
+    {
+        realBindBuffer(target, buffer);
+        bindBuffer(target, buffer);
+    }
+
+    // binding to an indexed target binds to the generic one as well
+    void APIENTRY trackBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        realBindBufferBase(target, index, buffer);
+        bindBuffer(target, buffer);
+    }
+
+    void APIENTRY trackBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        realBindBufferRange(target, index, buffer, offset, size);
+        bindBuffer(target, buffer);
+    }
+
+    void APIENTRY trackBindVertexArray(GLuint array)
+    {
+        realBindVertexArray(array);
+        current().vertexArray = array;
+    }
+
+    void APIENTRY trackDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+    {
+        realDeleteVertexArrays(n, arrays);
+        Bindings& b = current();
+        for (GLsizei i = 0; i < n; i++)
+        {
+            b.elementBuffers.erase(arrays[i]);
+            if (b.vertexArray == arrays[i])
+                b.vertexArray = 0;
+        }
+    }
+
+    void APIENTRY trackActiveTexture(GLenum texture)
+    {
+        realActiveTexture(texture);
+        current().activeUnit = texture - GL_TEXTURE0;
+    }
+
+    void APIENTRY trackBindTexture(GLenum target, GLuint texture)
+    {
+        realBindTexture(target, texture);
+        int slot = textureSlot(target);
+        if (slot >= 0)
+            textureUnitSlot(current(), slot) = texture;
+    }
+
+    void APIENTRY trackBindRenderbuffer(GLenum target, GLuint renderbuffer)
+    {
+        realBindRenderbuffer(target, renderbuffer);
+        current().renderbuffer = renderbuffer;
+    }
+
+    void APIENTRY trackBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+    {
+        realBufferData(target, size, data, usage);
+        GLuint buffer = boundBuffer(target);
+        if (!buffer)
+            return;
+        GpuMemory::Allocation a = {};
+        a.category = bufferCategory(target);
+        a.identifier = GL_BUFFER;
+        a.name = buffer;
+        a.target = target;
+        a.format = usage;
+        a.width = (int)min<GLsizeiptr>(size, INT32_MAX);
+        a.height = a.depth = a.samples = 1;
+        a.bytes = (size_t)max<GLsizeiptr>(size, 0);
+        GpuMemory::instance().allocate(a);
+    }
+
+    void APIENTRY trackDeleteBuffers(GLsizei n, const GLuint* buffers)
+    {
+        realDeleteBuffers(n, buffers);
+        for (GLsizei i = 0; i < n; i++)
+        {
+            forgetBuffer(buffers[i]);
+            GpuMemory::instance().release(GL_BUFFER, buffers[i]);
+        }
+    }
+
+    void APIENTRY trackTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border,
+        GLenum format, GLenum type, const void* pixels)
+    {
+        realTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+        specifyLevel(target, level, internalformat, width, 1, 1);
+    }
+
+    void APIENTRY trackTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+        GLint border, GLenum format, GLenum type, const void* pixels)
+    {
+        realTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+        specifyLevel(target, level, internalformat, width, height, 1);
+    }
+
+    void APIENTRY trackTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+        GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels)
+    {
+        realTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+        specifyLevel(target, level, internalformat, width, height, depth);
+    }
+
+    void APIENTRY trackCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width,
+        GLint border)
+    {
+        realCopyTexImage1D(target, level, internalformat, x, y, width, border);
+        specifyLevel(target, level, internalformat, width, 1, 1);
+    }
+
+    void APIENTRY trackCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width,
+        GLsizei height, GLint border)
+    {
+        realCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+        specifyLevel(target, level, internalformat, width, height, 1);
+    }
+
+    void APIENTRY trackTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width,
+        GLsizei height, GLboolean fixedsamplelocations)
+    {
+        realTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+        specifyLevel(target, 0, internalformat, width, height, 1, samples);
+    }
+
+    void APIENTRY trackTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width,
+        GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+    {
+        realTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+        specifyLevel(target, 0, internalformat, width, height, depth, samples);
+    }
+
+    // the chain below the base level, halving down to 1x1 (array layers do not halve)
+    void APIENTRY trackGenerateMipmap(GLenum target)
+    {
+        realGenerateMipmap(target);
+        int face;
+        GLuint texture = boundTexture(target, face);
+        auto it = textures.find(texture);
+        if (it == textures.end())
+            return;
+        TextureLevels& t = it->second;
+        bool layered = t.target == GL_TEXTURE_2D_ARRAY || t.target == GL_TEXTURE_1D_ARRAY;
+        size_t texel = texelBytes(t.format);
+        for (int f = 0; f < 6; f++)
+        {
+            int width = t.width[f][0], height = t.height[f][0], depth = t.depth[f][0];
+            if (!t.bytes[f][0])
+                continue;
+            for (int l = 1; l < kMaxLevels && (width > 1 || height > 1 || (!layered && depth > 1)); l++)
+            {
+                width = max(width / 2, 1);
+                height = t.target == GL_TEXTURE_1D_ARRAY ? height : max(height / 2, 1);
+                depth = layered ? depth : max(depth / 2, 1);
+                t.width[f][l] = width;
+                t.height[f][l] = height;
+                t.depth[f][l] = depth;
+                t.bytes[f][l] = (size_t)width * height * depth * texel;
+            }
+        }
+        allocateTexture(texture, t);
+    }
+
+    void APIENTRY trackDeleteTextures(GLsizei n, const GLuint* names)
+    {
+        realDeleteTextures(n, names);
+        for (GLsizei i = 0; i < n; i++)
+        {
+            textures.erase(names[i]);
+            forgetTexture(names[i]);
+            GpuMemory::instance().release(GL_TEXTURE, names[i]);
+        }
+    }
+
+    void allocateRenderbuffer(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        GLuint renderbuffer = boundRenderbuffer();
+        if (!renderbuffer)
+            return;
+        GpuMemory::Allocation a = {};
+        a.category = GpuMemoryCategory::RenderTarget;
+        a.identifier = GL_RENDERBUFFER;
+        a.name = renderbuffer;
+        a.target = target;
+        a.format = internalformat;
+        a.width = width;
+        a.height = height;
+        a.depth = 1;
+        a.samples = max(samples, 1);
+        a.bytes = (size_t)max(width, 0) * max(height, 0) * a.samples * texelBytes(internalformat);
+        GpuMemory::instance().allocate(a);
+    }
+
+    void APIENTRY trackRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        realRenderbufferStorage(target, internalformat, width, height);
+        allocateRenderbuffer(target, 1, internalformat, width, height);
+    }
+
+    void APIENTRY trackRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        realRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+        allocateRenderbuffer(target, samples, internalformat, width, height);
+    }
+
+    void APIENTRY trackDeleteRenderbuffers(GLsizei n, const GLuint* names)
+    {
+        realDeleteRenderbuffers(n, names);
+        Bindings& b = current();
+        for (GLsizei i = 0; i < n; i++)
+        {
+            if (b.renderbuffer == names[i])
+                b.renderbuffer = kUnknown;
+            GpuMemory::instance().release(GL_RENDERBUFFER, names[i]);
+        }
+    }
+
+    void APIENTRY trackFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+    {
+        realFramebufferTexture2D(target, attachment, textarget, texture, level);
+        if (texture)
+            GpuMemory::instance().setCategory(GL_TEXTURE, texture, GpuMemoryCategory::RenderTarget);
+    }
+
+    void APIENTRY trackObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar* label)
+    {
+        realObjectLabel(identifier, name, length, label);
+        GpuMemory::instance().label(identifier, name, label, length);
+    }
+
+#define GPU_MEMORY_ENTRIES(X) \
+    X(glBindBuffer, realBindBuffer, trackBindBuffer) \
+    X(glBindBufferBase, realBindBufferBase, trackBindBufferBase) \
+    X(glBindBufferRange, realBindBufferRange, trackBindBufferRange) \
+    X(glBindVertexArray, realBindVertexArray, trackBindVertexArray) \
+    X(glDeleteVertexArrays, realDeleteVertexArrays, trackDeleteVertexArrays) \
+    X(glActiveTexture, realActiveTexture, trackActiveTexture) \
+    X(glBindTexture, realBindTexture, trackBindTexture) \
+    X(glBindRenderbuffer, realBindRenderbuffer, trackBindRenderbuffer) \
+    X(glBufferData, realBufferData, trackBufferData) \
+    X(glDeleteBuffers, realDeleteBuffers, trackDeleteBuffers) \
+    X(glTexImage1D, realTexImage1D, trackTexImage1D) \
+    X(glTexImage2D, realTexImage2D, trackTexImage2D) \
+    X(glTexImage3D, realTexImage3D, trackTexImage3D) \
+    X(glCopyTexImage1D, realCopyTexImage1D, trackCopyTexImage1D) \
+    X(glCopyTexImage2D, realCopyTexImage2D, trackCopyTexImage2D) \
+    X(glTexImage2DMultisample, realTexImage2DMultisample, trackTexImage2DMultisample) \
+    X(glTexImage3DMultisample, realTexImage3DMultisample, trackTexImage3DMultisample) \
+    X(glGenerateMipmap, realGenerateMipmap, trackGenerateMipmap) \
+    X(glDeleteTextures, realDeleteTextures, trackDeleteTextures) \
+    X(glRenderbufferStorage, realRenderbufferStorage, trackRenderbufferStorage) \
+    X(glRenderbufferStorageMultisample, realRenderbufferStorageMultisample, trackRenderbufferStorageMultisample) \
+    X(glDeleteRenderbuffers, realDeleteRenderbuffers, trackDeleteRenderbuffers) \
+    X(glFramebufferTexture2D, realFramebufferTexture2D, trackFramebufferTexture2D) \
+    X(glObjectLabel, realObjectLabel, trackObjectLabel)
+
+    //------- reports -------
+    // the allocation's tag and its size and format, for the tables
+    void printAllocation(const GpuMemory::Allocation& a, uint64_t frame, double seconds)
+    {
+        char size[48];
+        if (a.identifier == GL_BUFFER)
+            snprintf(size, sizeof(size), "usage 0x%04x", a.format);
+        else if (a.depth > 1)
+            snprintf(size, sizeof(size), "%dx%dx%d 0x%04x", a.width, a.height, a.depth, a.format);
+        else if (a.samples > 1)
+            snprintf(size, sizeof(size), "%dx%d 0x%04x %dx", a.width, a.height, a.format, a.samples);
+        else
+            snprintf(size, sizeof(size), "%dx%d 0x%04x", a.width, a.height, a.format);
+        printf("  %-12s %5u %10.3f MB  %-14s %-22s %-24s %6llu frames %8.1f s\n", identifierName(a.identifier), a.name,
+            toMB(a.bytes), gpuMemoryCategoryName(a.category), size, a.tag.empty() ? "(untagged)" : a.tag.c_str(),
+            (unsigned long long)(frame - a.createdFrame), seconds - a.createdSeconds);
+    }
+
+    void writeJsonString(FILE* f, const string& s)
+    {
+        fputc('"', f);
+        for (char c : s)
+        {
+            if (c == '"' || c == '\\')
+                fprintf(f, "\\%c", c);
+            else if ((unsigned char)c < 0x20)
+                fprintf(f, "\\u%04x", c);
+            else
+                fputc(c, f);
+        }
+        fputc('"', f);
+    }
+}
+
+const char* gpuMemoryCategoryName(GpuMemoryCategory category)
+{
+    return kCategoryNames[(int)category];
+}
+
+//------- GpuMemoryTag -------
+
+GpuMemoryTag::GpuMemoryTag(const char* tag)
+    : previous(currentTag)
+{
+    currentTag = tag ? tag : "";
+}
+
+GpuMemoryTag::~GpuMemoryTag()
+{
+    currentTag = previous;
+}
+
+const char* GpuMemoryTag::current()
+{
+    return currentTag;
+}
+
+//------- GpuMemory -------
+
+GpuMemory& GpuMemory::instance()
+{
+    static GpuMemory memory;
+    return memory;
+}
+
+void GpuMemory::enable()
+{
+    if (on)
+        return;
+#define GPU_MEMORY_SWAP_IN(name, real, tracking) glHookIn(glad_##name, glad_debug_##name, real, tracking);
+    GPU_MEMORY_ENTRIES(GPU_MEMORY_SWAP_IN)
+#undef GPU_MEMORY_SWAP_IN
+    bindingEpoch++;
+    enabledAt = now();
+    on = true;
+}
+
+// what was allocated stays accounted: enabling again continues the totals. A tracking hook
+// another hook was swapped in on top of stays in the chain and goes on tracking.
+void GpuMemory::disable()
+{
+    if (!on)
+        return;
+#define GPU_MEMORY_SWAP_OUT(name, real, tracking) glHookOut(glad_##name, glad_debug_##name, real, tracking);
+    GPU_MEMORY_ENTRIES(GPU_MEMORY_SWAP_OUT)
+#undef GPU_MEMORY_SWAP_OUT
+    on = false;
+}
+
+// a texture becomes a render target when it is attached, after its storage was allocated:
+// sampling the categories between frames keeps it out of the texture peak
+void GpuMemory::endFrame()
+{
+    lock_guard<mutex> lock(allocationsMutex);
+    for (Totals& t : categories)
+        t.peakBytes = max(t.peakBytes, t.bytes);
+    frames++;
+}
+
+double GpuMemory::seconds() const
+{
+    return now() - enabledAt;
+}
+
+void GpuMemory::add(GpuMemoryCategory category, size_t size)
+{
+    categories[(int)category].bytes += size;
+    bytes += size;
+    peakBytes = max(peakBytes, bytes);
+}
+
+void GpuMemory::remove(GpuMemoryCategory category, size_t size)
+{
+    categories[(int)category].bytes -= size;
+    bytes -= size;
+}
+
+void GpuMemory::allocate(const Allocation& allocation)
+{
+    lock_guard<mutex> lock(allocationsMutex);
+    uint64_t k = key(allocation.identifier, allocation.name);
+    auto it = live.find(k);
+    if (it != live.end())
+    {
+        Allocation& a = it->second;
+        remove(a.category, a.bytes);
+        GpuMemoryCategory category = a.category;
+        string tag = a.tag.empty() ? GpuMemoryTag::current() : a.tag;
+        uint64_t createdFrame = a.createdFrame;
+        double createdSeconds = a.createdSeconds;
+        a = allocation;
+        a.category = category;
+        a.tag = tag;
+        a.createdFrame = createdFrame;
+        a.createdSeconds = createdSeconds;
+        add(a.category, a.bytes);
+        return;
+    }
+    Allocation& a = live.emplace(k, allocation).first->second;
+    auto label = labels.find(k);
+    if (label != labels.end())
+    {
+        a.tag = label->second;
+        labels.erase(label);
+    }
+    else
+        a.tag = GpuMemoryTag::current();
+    a.createdFrame = frames;
+    a.createdSeconds = seconds();
+    Totals& t = categories[(int)a.category];
+    t.live++;
+    t.created++;
+    add(a.category, a.bytes);
+}
+
+void GpuMemory::release(unsigned int identifier, unsigned int name)
+{
+    lock_guard<mutex> lock(allocationsMutex);
+    uint64_t k = key(identifier, name);
+    labels.erase(k);
+    auto it = live.find(k);
+    if (it == live.end())
+        return;
+    Totals& t = categories[(int)it->second.category];
+    t.live--;
+    t.deleted++;
+    remove(it->second.category, it->second.bytes);
+    live.erase(it);
+}
+
+void GpuMemory::setCategory(unsigned int identifier, unsigned int name, GpuMemoryCategory category)
+{
+    lock_guard<mutex> lock(allocationsMutex);
+    auto it = live.find(key(identifier, name));
+    if (it == live.end() || it->second.category == category)
+        return;
+    Allocation& a = it->second;
+    Totals& from = categories[(int)a.category];
+    Totals& to = categories[(int)category];
+    remove(a.category, a.bytes);
+    from.live--;
+    from.created--;
+    to.live++;
+    to.created++;
+    a.category = category;
+    add(a.category, a.bytes);
+}
+
+void GpuMemory::label(unsigned int identifier, unsigned int name, const char* text, int length)
+{
+    if (!text)
+        return;
+    string s = length < 0 ? string(text) : string(text, length);
+    lock_guard<mutex> lock(allocationsMutex);
+    uint64_t k = key(identifier, name);
+    auto it = live.find(k);
+    if (it != live.end())
+        it->second.tag = s;
+    else
+        labels[k] = s;
+}
+
+void GpuMemory::tag(unsigned int identifier, unsigned int name, const char* text)
+{
+    label(identifier, name, text, -1);
+}
+
+GpuMemory::Totals GpuMemory::totals(GpuMemoryCategory category) const
+{
+    lock_guard<mutex> lock(allocationsMutex);
+    Totals t = categories[(int)category];
+    t.peakBytes = max(t.peakBytes, t.bytes);
+    return t;
+}
+
+GpuMemory::Totals GpuMemory::totals() const
+{
+    lock_guard<mutex> lock(allocationsMutex);
+    Totals sum = {};
+    for (const Totals& t : categories)
+    {
+        sum.live += t.live;
+        sum.created += t.created;
+        sum.deleted += t.deleted;
+    }
+    sum.bytes = bytes;
+    sum.peakBytes = peakBytes;
+    return sum;
+}
+
+vector<GpuMemory::Allocation> GpuMemory::allocations() const
+{
+    vector<Allocation> out;
+    {
+        lock_guard<mutex> lock(allocationsMutex);
+        out.reserve(live.size());
+        for (const auto& entry : live)
+            out.push_back(entry.second);
+    }
+    sort(out.begin(), out.end(), [](const Allocation& a, const Allocation& b) {
+        return a.bytes != b.bytes ? a.bytes > b.bytes : a.createdSeconds < b.createdSeconds; });
+    return out;
+}
+
+void GpuMemory::printSummary() const
+{
+    Totals all = totals();
+    printf("GPU memory: %.2f MB in %llu objects (peak %.2f MB):", toMB(all.bytes), (unsigned long long)all.live, toMB(all.peakBytes));
+    for (int c = 0; c < (int)GpuMemoryCategory::Count; c++)
+    {
+        Totals t = totals((GpuMemoryCategory)c);
+        if (t.peakBytes)
+            printf(" %s %.2f", kCategoryNames[c], toMB(t.bytes));
+    }
+    printf("\n");
+}
+
+void GpuMemory::print(int topNum) const
+{
+    Totals all = totals();
+    printf("GPU memory after %llu frames: %.2f MB live, peak %.2f MB\n", (unsigned long long)frames,
+        toMB(all.bytes), toMB(all.peakBytes));
+    printf("  %-14s %10s %10s %8s %8s %8s\n", "category", "live MB", "peak MB", "live", "created", "deleted");
+    for (int c = 0; c < (int)GpuMemoryCategory::Count; c++)
+    {
+        Totals t = totals((GpuMemoryCategory)c);
+        printf("  %-14s %10.3f %10.3f %8llu %8llu %8llu\n", kCategoryNames[c], toMB(t.bytes), toMB(t.peakBytes),
+            (unsigned long long)t.live, (unsigned long long)t.created, (unsigned long long)t.deleted);
+    }
+    vector<Allocation> list = allocations();
+    if (list.empty())
+        return;
+    printf("largest allocations:\n");
+    double at = seconds();
+    for (int i = 0; i < topNum && i < (int)list.size(); i++)
+        printAllocation(list[i], frames, at);
+}
+
+size_t GpuMemory::reportLeaks() const
+{
+    vector<Allocation> list = allocations();
+    if (list.empty())
+    {
+        printf("GPU memory: no leaks\n");
+        return 0;
+    }
+    size_t leaked = 0;
+    for (const Allocation& a : list)
+        leaked += a.bytes;
+    printf("GPU memory: %zu objects (%.3f MB) were not deleted:\n", list.size(), toMB(leaked));
+    double at = seconds();
+    for (const Allocation& a : list)
+        printAllocation(a, frames, at);
+    return list.size();
+}
+
+bool GpuMemory::writeJson(const char* filename) const
+{
+    FILE* f = fopen(filename, "w");
+    if (!f)
+    {
+        printf("ERROR: Cannot write GPU memory report \"%s\".\n", filename);
+        return false;
+    }
+    Totals all = totals();
+    fprintf(f, "{\n");
+    fprintf(f, "  \"frames\": %llu,\n", (unsigned long long)frames);
+    fprintf(f, "  \"bytes\": %zu,\n", all.bytes);
+    fprintf(f, "  \"peak_bytes\": %zu,\n", all.peakBytes);
+    fprintf(f, "  \"categories\": {\n");
+    for (int c = 0; c < (int)GpuMemoryCategory::Count; c++)
+    {
+        Totals t = totals((GpuMemoryCategory)c);
+        fprintf(f, "    \"%s\": { \"bytes\": %zu, \"peak_bytes\": %zu, \"live\": %llu, \"created\": %llu, \"deleted\": %llu }%s\n",
+            kCategoryKeys[c], t.bytes, t.peakBytes, (unsigned long long)t.live, (unsigned long long)t.created,
+            (unsigned long long)t.deleted, c + 1 < (int)GpuMemoryCategory::Count ? "," : "");
+    }
+    fprintf(f, "  },\n");
+    fprintf(f, "  \"allocations\": [\n");
+    vector<Allocation> list = allocations();
+    for (size_t i = 0; i < list.size(); i++)
+    {
+        const Allocation& a = list[i];
+        fprintf(f, "    { \"object\": \"%s\", \"name\": %u, \"category\": \"%s\", \"bytes\": %zu, \"target\": %u, "
+            "\"format\": %u, \"width\": %d, \"height\": %d, \"depth\": %d, \"samples\": %d, \"tag\": ",
+            identifierName(a.identifier), a.name, kCategoryKeys[(int)a.category], a.bytes, a.target, a.format,
+            a.width, a.height, a.depth, a.samples);
+        writeJsonString(f, a.tag);
+        fprintf(f, ", \"created_frame\": %llu, \"created_s\": %.3f }%s\n", (unsigned long long)a.createdFrame,
+            a.createdSeconds, i + 1 < list.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    bool ok = !ferror(f);
+    ok = fclose(f) == 0 && ok;
+    if (!ok)
+        printf("ERROR: Failed writing GPU memory report \"%s\".\n", filename);
+    return ok;
+}
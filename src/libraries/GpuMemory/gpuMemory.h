@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Accounting of the GPU memory held by buffers, textures and renderbuffers.
+//
+//     GpuMemory& memory = GpuMemory::instance();
+//     memory.enable();                                     // once GL is loaded
+//     { GpuMemoryTag tag("terrain"); ...glGen*, glBufferData, glTexImage2D... }
+//     memory.endFrame();                                   // ages allocations in frames
+//     memory.printSummary();                               // live totals per category
+//     memory.reportLeaks();                                // at shutdown, before the context goes
+//
+// Enabled, the GLAD entry points that allocate or free storage (glBufferData, glTexImage1D/2D/3D,
+// glTexImage*Multisample, glCopyTexImage*, glGenerateMipmap, glRenderbufferStorage*, glDelete*)
+// are swapped for wrappers that record each allocation with its size, format, samples, owner
+// tag and the frame it was made in; raw glGen* code anywhere in the program is accounted
+// without changes. The bind calls are wrapped too, so the allocating object is known without
+// asking the driver. Sizes are what the storage needs at the nominal texel size (RGB8 counts as
+// 4 bytes, as GPUs store it) times the samples, not what the driver reports: alignment and
+// compression are not visible through GL 3.3.
+//
+// Textures attached to a framebuffer with glFramebufferTexture2D and all renderbuffers count
+// as render targets. The owner tag is the innermost GpuMemoryTag on the allocating thread, or
+// the object's glObjectLabel. The wrappers chain with GLCapture's and ChapterBench's in any
+// order (glHooks.h). Wrapped calls are recorded under a mutex, so the totals can be read from
+// another thread.
+enum class GpuMemoryCategory
+{
+    Texture,
+    RenderTarget,
+    VertexBuffer,
+    IndexBuffer,
+    UniformBuffer,
+    PixelBuffer,
+    OtherBuffer,
+    Count
+};
+
+const char* gpuMemoryCategoryName(GpuMemoryCategory category);
+
+class GpuMemory
+{
+public:
+    struct Allocation
+    {
+        GpuMemoryCategory category;
+        unsigned int identifier;    // GL_BUFFER, GL_TEXTURE or GL_RENDERBUFFER
+        unsigned int name;
+        unsigned int target;        // of the allocating call
+        unsigned int format;        // internal format, the usage for buffers
+        int width, height, depth;   // of level 0; buffers: width is the size
+        int samples;
+        size_t bytes;
+        std::string tag;
+        uint64_t createdFrame;
+        double createdSeconds;      // since enable
+    };
+
+    struct Totals
+    {
+        size_t bytes;
+        size_t peakBytes;
+        uint64_t live;
+        uint64_t created;
+        uint64_t deleted;
+    };
+
+    static GpuMemory& instance();
+
+    void enable();
+    void disable();
+    bool enabled() const { return on; }
+
+    void endFrame();
+    uint64_t frameNum() const { return frames; }
+
+    // replaces the owner tag of an allocation made earlier
+    void tag(unsigned int identifier, unsigned int name, const char* text);
+
+    // the peak of a category is sampled at endFrame, the peak of the sum on every allocation
+    Totals totals(GpuMemoryCategory category) const;
+    Totals totals() const;
+    // copies, the live allocations largest first
+    std::vector<Allocation> allocations() const;
+
+    // one line: live and peak bytes, then per category
+    void printSummary() const;
+    // totals per category and the largest allocations
+    void print(int topNum = 16) const;
+    // the allocations still live, with tag and age; returns their number
+    size_t reportLeaks() const;
+    bool writeJson(const char* filename) const;
+
+    // called by the GL wrappers; allocating storage for an object that has some replaces it,
+    // keeping the tag, category and creation frame
+    void allocate(const Allocation& allocation);
+    void release(unsigned int identifier, unsigned int name);
+    void setCategory(unsigned int identifier, unsigned int name, GpuMemoryCategory category);
+    void label(unsigned int identifier, unsigned int name, const char* text, int length);
+
+private:
+    GpuMemory() = default;
+
+    static uint64_t key(unsigned int identifier, unsigned int name) { return (uint64_t)identifier << 32 | name; }
+    void add(GpuMemoryCategory category, size_t bytes);
+    void remove(GpuMemoryCategory category, size_t bytes);
+    double seconds() const;
+
+    mutable std::mutex allocationsMutex;
+    std::unordered_map<uint64_t, Allocation> live;
+    std::unordered_map<uint64_t, std::string> labels;      // glObjectLabel before the storage
+    Totals categories[(int)GpuMemoryCategory::Count] = {};
+    size_t bytes = 0;
+    size_t peakBytes = 0;
+    bool on = false;
+    uint64_t frames = 0;
+    double enabledAt = 0.0;
+};
+
+// Owner tag for the allocations made on this thread while it lives; tags nest.
+class GpuMemoryTag
+{
+public:
+    explicit GpuMemoryTag(const char* tag);
+    ~GpuMemoryTag();
+    GpuMemoryTag(const GpuMemoryTag&) = delete;
+    GpuMemoryTag& operator=(const GpuMemoryTag&) = delete;
+
+    // the innermost tag on this thread, "" outside any
+    static const char* current();
+
+private:
+    const char* previous;
+};
@@ -0,0 +1,486 @@
+#include "imageEncode.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+//------- helpers -------
+
+namespace
+{
+    void put32BE(vector<unsigned char>& out, uint32_t v)
+    {
+        out.push_back((unsigned char)(v >> 24));
+        out.push_back((unsigned char)(v >> 16));
+        out.push_back((unsigned char)(v >> 8));
+        out.push_back((unsigned char)v);
+    }
+
+    struct Crc32Table
+    {
+        uint32_t entries[256];
+        Crc32Table()
+        {
+            for (uint32_t i = 0; i < 256; i++)
+            {
+                uint32_t c = i;
+                for (int k = 0; k < 8; k++)
+                    c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                entries[i] = c;
+            }
+        }
+    };
+
+    uint32_t crc32(const unsigned char* data, size_t n)
+    {
+        static const Crc32Table table;
+        uint32_t crc = 0xFFFFFFFFu;
+        for (size_t i = 0; i < n; i++)
+            crc = table.entries[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    uint32_t adler32(const unsigned char* data, size_t n)
+    {
+        uint32_t a = 1, b = 0;
+        while (n)
+        {
+            // largest block before b can overflow
+            size_t block = n < 5552 ? n : 5552;
+            n -= block;
+            while (block--)
+            {
+                a += *data++;
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+        }
+        return (b << 16) | a;
+    }
+}
+
+//------- deflate -------
+
+// Single fixed-Huffman block with greedy LZ77 matching over a 32 KB window.
+// Dynamic Huffman tables would gain another 10-20%, at a large cost in code and speed.
+namespace
+{
+    const int kWindow = 32768;
+    const int kHashBits = 15;
+    const int kMaxChain = 16;
+    const int kMinMatch = 3;
+    const int kMaxMatch = 258;
+
+    const uint16_t kLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    const uint8_t kLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    const uint16_t kDistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    const uint8_t kDistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    struct DeflateTables
+    {
+        uint8_t lengthCode[kMaxMatch + 1];      // match length -> index into kLengthBase
+        uint8_t distanceCode[512];              // see distanceIndex()
+        DeflateTables()
+        {
+            for (int c = 0; c < 29; c++)
+                for (int l = kLengthBase[c]; l < (c < 28 ? kLengthBase[c + 1] : kMaxMatch + 1); l++)
+                    lengthCode[l] = (uint8_t)c;
+            for (int c = 0; c < 30; c++)
+            {
+                int end = c < 29 ? kDistanceBase[c + 1] : kWindow + 1;
+                for (int d = kDistanceBase[c]; d < end; d++)
+                {
+                    int slot = d <= 256 ? d - 1 : 256 + ((d - 1) >> 7);
+                    distanceCode[slot] = (uint8_t)c;
+                }
+            }
+        }
+        int distanceIndex(int d) const { return distanceCode[d <= 256 ? d - 1 : 256 + ((d - 1) >> 7)]; }
+    };
+
+    class BitWriter
+    {
+    public:
+        explicit BitWriter(vector<unsigned char>& out) : out(out) {}
+
+        void bits(uint32_t value, int count)
+        {
+            acc |= (uint64_t)value << used;
+            used += count;
+            while (used >= 8)
+            {
+                out.push_back((unsigned char)acc);
+                acc >>= 8;
+                used -= 8;
+            }
+        }
+
+        // Huffman codes are stored most significant bit first
+        void code(uint32_t code, int length)
+        {
+            uint32_t reversed = 0;
+            for (int i = 0; i < length; i++)
+                reversed |= ((code >> i) & 1) << (length - 1 - i);
+            bits(reversed, length);
+        }
+
+        void flush()
+        {
+            if (used)
+                out.push_back((unsigned char)acc);
+            acc = 0;
+            used = 0;
+        }
+
+    private:
+        vector<unsigned char>& out;
+        uint64_t acc = 0;
+        int used = 0;
+    };
+
+    void literal(BitWriter& w, int symbol)
+    {
+        if (symbol < 144)
+            w.code(0x30 + symbol, 8);
+        else if (symbol < 256)
+            w.code(0x190 + symbol - 144, 9);
+        else if (symbol < 280)
+            w.code(symbol - 256, 7);
+        else
+            w.code(0xC0 + symbol - 280, 8);
+    }
+
+    void match(BitWriter& w, const DeflateTables& tables, int length, int distance)
+    {
+        int lc = tables.lengthCode[length];
+        literal(w, 257 + lc);
+        if (kLengthExtra[lc])
+            w.bits(length - kLengthBase[lc], kLengthExtra[lc]);
+        int dc = tables.distanceIndex(distance);
+        w.code(dc, 5);
+        if (kDistanceExtra[dc])
+            w.bits(distance - kDistanceBase[dc], kDistanceExtra[dc]);
+    }
+
+    uint32_t hash3(const unsigned char* p)
+    {
+        return ((uint32_t)p[0] << 16 | (uint32_t)p[1] << 8 | p[2]) * 2654435761u >> (32 - kHashBits);
+    }
+
+    // zlib stream of data appended to out
+    void zlibCompress(const unsigned char* data, size_t n, vector<unsigned char>& out)
+    {
+        static const DeflateTables tables;
+        out.push_back(0x78);
+        out.push_back(0x01);
+        BitWriter w(out);
+        w.bits(1, 1);       // final block
+        w.bits(1, 2);       // fixed Huffman codes
+
+        vector<int32_t> head((size_t)1 << kHashBits, -1);
+        vector<int32_t> prev(kWindow, -1);
+        size_t i = 0;
+        while (i < n)
+        {
+            int bestLength = 0, bestDistance = 0;
+            if (i + kMinMatch <= n)
+            {
+                uint32_t h = hash3(data + i);
+                int32_t candidate = head[h];
+                size_t maxLength = n - i < (size_t)kMaxMatch ? n - i : kMaxMatch;
+                for (int chain = 0; candidate >= 0 && chain < kMaxChain; chain++)
+                {
+                    size_t distance = i - candidate;
+                    if (distance > (size_t)kWindow)
+                        break;
+                    const unsigned char* a = data + candidate;
+                    const unsigned char* b = data + i;
+                    size_t length = 0;
+                    while (length < maxLength && a[length] == b[length])
+                        length++;
+                    if ((int)length > bestLength)
+                    {
+                        bestLength = (int)length;
+                        bestDistance = (int)distance;
+                        if (length == maxLength)
+                            break;
+                    }
+                    candidate = prev[candidate % kWindow];
+                }
+            }
+
+            size_t advance = bestLength >= kMinMatch ? bestLength : 1;
+            if (bestLength >= kMinMatch)
+                match(w, tables, bestLength, bestDistance);
+            else
+                literal(w, data[i]);
+            // insert every covered position so later matches can reference them
+            for (size_t end = i + advance; i < end; i++)
+            {
+                if (i + kMinMatch <= n)
+                {
+                    uint32_t h = hash3(data + i);
+                    prev[i % kWindow] = head[h];
+                    head[h] = (int32_t)i;
+                }
+            }
+        }
+        literal(w, 256);    // end of block
+        w.flush();
+        put32BE(out, adler32(data, n));
+    }
+}
+
+//------- png -------
+
+namespace
+{
+    void pngChunk(vector<unsigned char>& out, const char* type, const unsigned char* data, size_t n)
+    {
+        put32BE(out, (uint32_t)n);
+        size_t start = out.size();
+        out.insert(out.end(), type, type + 4);
+        out.insert(out.end(), data, data + n);
+        put32BE(out, crc32(&out[start], out.size() - start));
+    }
+
+    int paeth(int a, int b, int c)
+    {
+        int p = a + b - c;
+        int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+        return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+    }
+}
+
+void encodePng(const unsigned char* pixels, int width, int height, int channels, vector<unsigned char>& out)
+{
+    // filter every row with the type giving the smallest sum of absolute residuals
+    size_t stride = (size_t)width * channels;
+    vector<unsigned char> filtered((stride + 1) * height);
+    vector<unsigned char> candidates[4];
+    for (auto& c : candidates)
+        c.resize(stride);
+    vector<unsigned char> zero(stride, 0);
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char* row = pixels + y * stride;
+        const unsigned char* up = y ? row - stride : zero.data();
+        unsigned int best = 0;
+        uint64_t bestCost = UINT64_MAX;
+        for (unsigned int type = 1; type <= 4; type++)
+        {
+            unsigned char* dst = candidates[type - 1].data();
+            uint64_t cost = 0;
+            for (size_t x = 0; x < stride; x++)
+            {
+                int left = x >= (size_t)channels ? row[x - channels] : 0;
+                int upLeft = x >= (size_t)channels ? up[x - channels] : 0;
+                int predictor = type == 1 ? left : type == 2 ? up[x] : type == 3 ? (left + up[x]) / 2 : paeth(left, up[x], upLeft);
+                dst[x] = (unsigned char)(row[x] - predictor);
+                cost += dst[x] < 128 ? dst[x] : 256 - dst[x];
+            }
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                best = type;
+            }
+        }
+        unsigned char* dst = &filtered[y * (stride + 1)];
+        dst[0] = (unsigned char)best;
+        memcpy(dst + 1, candidates[best - 1].data(), stride);
+    }
+
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    out.assign(signature, signature + 8);
+    unsigned char ihdr[13] = {};
+    ihdr[0] = (unsigned char)(width >> 24); ihdr[1] = (unsigned char)(width >> 16);
+    ihdr[2] = (unsigned char)(width >> 8); ihdr[3] = (unsigned char)width;
+    ihdr[4] = (unsigned char)(height >> 24); ihdr[5] = (unsigned char)(height >> 16);
+    ihdr[6] = (unsigned char)(height >> 8); ihdr[7] = (unsigned char)height;
+    ihdr[8] = 8;
+    ihdr[9] = channels == 4 ? 6 : 2;
+    pngChunk(out, "IHDR", ihdr, sizeof(ihdr));
+    vector<unsigned char> z;
+    z.reserve(filtered.size() / 2);
+    zlibCompress(filtered.data(), filtered.size(), z);
+    pngChunk(out, "IDAT", z.data(), z.size());
+    pngChunk(out, "IEND", NULL, 0);
+}
+
+//------- qoi -------
+
+void encodeQoi(const unsigned char* pixels, int width, int height, int channels, vector<unsigned char>& out)
+{
+    out.clear();
+    out.reserve((size_t)width * height * (channels + 1) / 2 + 22);
+    const char magic[4] = { 'q', 'o', 'i', 'f' };
+    out.insert(out.end(), magic, magic + 4);
+    put32BE(out, (uint32_t)width);
+    put32BE(out, (uint32_t)height);
+    out.push_back((unsigned char)channels);
+    out.push_back(0);       // sRGB with linear alpha
+
+    unsigned char index[64][4] = {};
+    unsigned char prev[4] = { 0, 0, 0, 255 };
+    int run = 0;
+    size_t count = (size_t)width * height;
+    for (size_t i = 0; i < count; i++)
+    {
+        const unsigned char* p = pixels + i * channels;
+        unsigned char px[4] = { p[0], p[1], p[2], channels == 4 ? p[3] : (unsigned char)255 };
+        if (!memcmp(px, prev, 4))
+        {
+            run++;
+            if (run == 62 || i == count - 1)
+            {
+                out.push_back((unsigned char)(0xc0 | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+        if (run)
+        {
+            out.push_back((unsigned char)(0xc0 | (run - 1)));
+            run = 0;
+        }
+        int slot = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64;
+        if (!memcmp(index[slot], px, 4))
+            out.push_back((unsigned char)slot);
+        else
+        {
+            memcpy(index[slot], px, 4);
+            if (px[3] == prev[3])
+            {
+                signed char dr = (signed char)(px[0] - prev[0]);
+                signed char dg = (signed char)(px[1] - prev[1]);
+                signed char db = (signed char)(px[2] - prev[2]);
+                signed char drg = (signed char)(dr - dg), dbg = (signed char)(db - dg);
+                if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1)
+                    out.push_back((unsigned char)(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+                else if (dg >= -32 && dg <= 31 && drg >= -8 && drg <= 7 && dbg >= -8 && dbg <= 7)
+                {
+                    out.push_back((unsigned char)(0x80 | (dg + 32)));
+                    out.push_back((unsigned char)((drg + 8) << 4 | (dbg + 8)));
+                }
+                else
+                {
+                    out.push_back(0xfe);
+                    out.insert(out.end(), px, px + 3);
+                }
+            }
+            else
+            {
+                out.push_back(0xff);
+                out.insert(out.end(), px, px + 4);
+            }
+        }
+        memcpy(prev, px, 4);
+    }
+    const unsigned char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+    out.insert(out.end(), padding, padding + 8);
+}
+
+//------- tga -------
+
+void encodeTga(const unsigned char* pixels, int width, int height, int channels, vector<unsigned char>& out)
+{
+    out.assign(18, 0);
+    out[2] = 2;
+    out[12] = (unsigned char)(width & 0xff);
+    out[13] = (unsigned char)(width >> 8);
+    out[14] = (unsigned char)(height & 0xff);
+    out[15] = (unsigned char)(height >> 8);
+    out[16] = (unsigned char)(channels * 8);
+    out[17] = channels == 4 ? 0x28 : 0x20;     // alpha bits, origin at the top left
+    size_t count = (size_t)width * height;
+    out.resize(18 + count * channels);
+    unsigned char* dst = &out[18];
+    for (size_t i = 0; i < count; i++, dst += channels, pixels += channels)
+    {
+        dst[0] = pixels[2];
+        dst[1] = pixels[1];
+        dst[2] = pixels[0];
+        if (channels == 4)
+            dst[3] = pixels[3];
+    }
+}
+
+//------- files -------
+
+const char* imageFormatName(ImageFormat format)
+{
+    switch (format)
+    {
+    case ImageFormat::Png: return "png";
+    case ImageFormat::Qoi: return "qoi";
+    case ImageFormat::Tga: return "tga";
+    }
+    return "unknown";
+}
+
+bool parseImageFormat(const char* name, ImageFormat& format)
+{
+    const ImageFormat formats[] = { ImageFormat::Png, ImageFormat::Qoi, ImageFormat::Tga };
+    for (ImageFormat f : formats)
+    {
+        if (!strcmp(name, imageFormatName(f)))
+        {
+            format = f;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool imageFormatFromFilename(const char* filename, ImageFormat& format)
+{
+    const char* dot = strrchr(filename, '.');
+    return dot && parseImageFormat(dot + 1, format);
+}
+
+void encodeImage(ImageFormat format, const unsigned char* pixels, int width, int height, int channels,
+    vector<unsigned char>& out)
+{
+    switch (format)
+    {
+    case ImageFormat::Png: encodePng(pixels, width, height, channels, out); break;
+    case ImageFormat::Qoi: encodeQoi(pixels, width, height, channels, out); break;
+    case ImageFormat::Tga: encodeTga(pixels, width, height, channels, out); break;
+    }
+}
+
+bool writeFile(const char* filename, const vector<unsigned char>& data)
+{
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+    {
+        printf("ERROR: Cannot write \"%s\".\n", filename);
+        return false;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+    fclose(f);
+    if (!ok)
+        printf("ERROR: Failed to write \"%s\".\n", filename);
+    return ok;
+}
+
+bool writeImage(const char* filename, const unsigned char* pixels, int width, int height, int channels)
+{
+    ImageFormat format;
+    if (!imageFormatFromFilename(filename, format))
+    {
+        printf("ERROR: Unknown image format of \"%s\", expected .png, .qoi or .tga.\n", filename);
+        return false;
+    }
+    vector<unsigned char> data;
+    encodeImage(format, pixels, width, height, channels, data);
+    return writeFile(filename, data);
+}
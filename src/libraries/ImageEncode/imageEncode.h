@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+// Image writers for the offline tools. Pixels are tightly packed 8 bit RGB or RGBA, top row first.
+// Every encoder is self-contained and thread-safe, so frames can be encoded on worker threads.
+//   Png: deflate with fixed Huffman codes and per-row adaptive filtering,
+//        a few times slower than QOI and usually smaller
+//   Qoi: the "Quite OK Image" format, a single pass with no entropy coding
+//   Tga: uncompressed
+enum class ImageFormat
+{
+    Png,
+    Qoi,
+    Tga,
+};
+
+const char* imageFormatName(ImageFormat format);     // also the file extension
+bool parseImageFormat(const char* name, ImageFormat& format);
+// from the extension of filename
+bool imageFormatFromFilename(const char* filename, ImageFormat& format);
+
+void encodePng(const unsigned char* pixels, int width, int height, int channels, std::vector<unsigned char>& out);
+void encodeQoi(const unsigned char* pixels, int width, int height, int channels, std::vector<unsigned char>& out);
+void encodeTga(const unsigned char* pixels, int width, int height, int channels, std::vector<unsigned char>& out);
+void encodeImage(ImageFormat format, const unsigned char* pixels, int width, int height, int channels,
+    std::vector<unsigned char>& out);
+
+bool writeFile(const char* filename, const std::vector<unsigned char>& data);
+// encode by the extension of filename and write
+bool writeImage(const char* filename, const unsigned char* pixels, int width, int height, int channels);
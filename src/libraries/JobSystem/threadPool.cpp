@@ -0,0 +1,129 @@
+#include "threadPool.h"
+
+ThreadPool::ThreadPool(unsigned int threadNum)
+{
+    if (threadNum == 0)
+    {
+        unsigned int hw = std::thread::hardware_concurrency();
+        threadNum = hw > 1 ? hw - 1 : 1;
+    }
+    workers.reserve(threadNum);
+    for (unsigned int i = 0; i < threadNum; i++)
+        workers.emplace_back([this] { workerLoop(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobReady.notify_all();
+    for (std::thread& t : workers)
+        t.join();
+}
+
+void ThreadPool::submit(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+        pending++;
+    }
+    jobReady.notify_one();
+}
+
+bool ThreadPool::runOne()
+{
+    std::function<void()> job;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (jobs.empty())
+            return false;
+        job = std::move(jobs.front());
+        jobs.pop_front();
+    }
+    job();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pending == 0)
+            jobDone.notify_all();
+    }
+    return true;
+}
+
+void ThreadPool::wait()
+{
+    // help instead of sleeping while there is still queued work
+    while (runOne())
+        ;
+    std::unique_lock<std::mutex> lock(mutex);
+    jobDone.wait(lock, [this] { return pending == 0; });
+}
+
+void ThreadPool::workerLoop()
+{
+    while (true)
+    {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobReady.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (stopping && jobs.empty())
+                return;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        job();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0)
+                jobDone.notify_all();
+        }
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn)
+{
+    if (count == 0)
+        return;
+    if (grain == 0)
+        grain = 1;
+    size_t taskNum = (size_t)size() + 1;
+    size_t chunk = (count + taskNum - 1) / taskNum;
+    if (chunk < grain)
+        chunk = grain;
+    if (chunk >= count)
+    {
+        fn(0, count);
+        return;
+    }
+
+    // a private counter so that nested or concurrent parallelFor calls do not wait on each other
+    std::atomic<size_t> remaining((count + chunk - 1) / chunk - 1);
+    std::mutex doneMutex;
+    std::condition_variable doneCond;
+    for (size_t begin = chunk; begin < count; begin += chunk)
+    {
+        size_t end = begin + chunk < count ? begin + chunk : count;
+        submit([&, begin, end] {
+            fn(begin, end);
+            // decremented under the mutex: the caller takes it before returning, so it cannot
+            // destroy the counter, mutex and condition while this task still touches them
+            std::lock_guard<std::mutex> lock(doneMutex);
+            if (remaining.fetch_sub(1) == 1)
+                doneCond.notify_all();
+        });
+    }
+    fn(0, chunk);
+    while (remaining.load() != 0 && runOne())
+        ;
+    std::unique_lock<std::mutex> lock(doneMutex);
+    doneCond.wait(lock, [&] { return remaining.load() == 0; });
+}
+
+ThreadPool& ThreadPool::global()
+{
+    static ThreadPool pool;
+    return pool;
+}
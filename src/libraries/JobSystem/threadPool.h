@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed set of worker threads consuming a shared FIFO of jobs.
+// The calling thread takes part in parallelFor, so a pool of N workers
+// keeps N + 1 cores busy.
+class ThreadPool
+{
+public:
+    // threadNum == 0 picks hardware_concurrency() - 1 (at least 1)
+    explicit ThreadPool(unsigned int threadNum = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned int size() const { return (unsigned int)workers.size(); }
+
+    // Queue a job, returns immediately
+    void submit(std::function<void()> job);
+
+    // Block until every submitted job has finished
+    void wait();
+
+    // Call fn(begin, end) on disjoint sub-ranges of [0, count) and block until done.
+    // grain is the minimum sub-range length.
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn);
+
+    // Process-wide pool shared by the loaders and systems
+    static ThreadPool& global();
+
+private:
+    void workerLoop();
+    bool runOne();
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable jobReady;
+    std::condition_variable jobDone;
+    size_t pending = 0;
+    bool stopping = false;
+};
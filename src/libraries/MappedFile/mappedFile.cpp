@@ -0,0 +1,139 @@
+#include "mappedFile.h"
+
+#include <iostream>
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        std::swap(mapped, other.mapped);
+        std::swap(length, other.length);
+        std::swap(opened, other.opened);
+#if defined(_WIN32)
+        std::swap(fileHandle, other.fileHandle);
+        std::swap(mappingHandle, other.mappingHandle);
+#endif
+    }
+    return *this;
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::open(const char* filename)
+{
+    close();
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        std::cout << "ERROR: Cannot open file \"" << filename << "\".\n";
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    fileHandle = file;
+    length = (size_t)fileSize.QuadPart;
+    opened = true;
+    if (length == 0)
+        return true;
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+    {
+        std::cout << "ERROR: Cannot map file \"" << filename << "\".\n";
+        close();
+        return false;
+    }
+    mappingHandle = mapping;
+    mapped = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (mapped == nullptr)
+    {
+        std::cout << "ERROR: Cannot map file \"" << filename << "\".\n";
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (mapped)
+        UnmapViewOfFile(mapped);
+    if (mappingHandle)
+        CloseHandle((HANDLE)mappingHandle);
+    if (fileHandle)
+        CloseHandle((HANDLE)fileHandle);
+    mapped = nullptr;
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+    length = 0;
+    opened = false;
+}
+
+#else
+
+bool MappedFile::open(const char* filename)
+{
+    close();
+    int fd = ::open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+        std::cout << "ERROR: Cannot open file \"" << filename << "\".\n";
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        std::cout << "ERROR: Cannot stat file \"" << filename << "\".\n";
+        ::close(fd);
+        return false;
+    }
+    length = (size_t)st.st_size;
+    opened = true;
+    if (length > 0)
+    {
+        void* ptr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED)
+        {
+            std::cout << "ERROR: Cannot map file \"" << filename << "\".\n";
+            ::close(fd);
+            length = 0;
+            opened = false;
+            return false;
+        }
+        madvise(ptr, length, MADV_SEQUENTIAL);
+        mapped = ptr;
+    }
+    // the mapping keeps its own reference to the file
+    ::close(fd);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (mapped)
+        munmap(mapped, length);
+    mapped = nullptr;
+    length = 0;
+    opened = false;
+}
+
+#endif
@@ -0,0 +1,291 @@
+#include "meshPool.h"
+
+#include <benchUtils.h>
+#include <algorithm>
+#include <cstdio>
+
+using namespace std;
+
+namespace
+{
+    unsigned int createBuffer(size_t size)
+    {
+        unsigned int buffer;
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, size, NULL, GL_STATIC_DRAW);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        return buffer;
+    }
+
+    struct Move
+    {
+        uint32_t from, to, size;
+    };
+
+    // one glCopyBufferSubData per run of ranges that stay adjacent
+    uint64_t copyRanges(unsigned int source, unsigned int destination, vector<Move>& moves, uint32_t unit)
+    {
+        sort(moves.begin(), moves.end(), [](const Move& a, const Move& b) { return a.from < b.from; });
+        glBindBuffer(GL_COPY_READ_BUFFER, source);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, destination);
+        uint64_t bytes = 0;
+        for (size_t i = 0; i < moves.size();)
+        {
+            Move run = moves[i++];
+            while (i < moves.size() && moves[i].from == run.from + run.size && moves[i].to == run.to + run.size)
+                run.size += moves[i++].size;
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (GLintptr)run.from * unit,
+                (GLintptr)run.to * unit, (GLsizeiptr)run.size * unit);
+            bytes += (uint64_t)run.size * unit;
+        }
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        return bytes;
+    }
+}
+
+bool MeshPool::create(const MeshAttribute* attributes, int attributeNum, uint32_t vertexStride,
+    uint32_t vertexCapacity, uint32_t indexCapacity)
+{
+    destroy();
+    if (!vertexStride || !vertexCapacity || !indexCapacity)
+    {
+        printf("ERROR: Mesh pool needs a vertex stride and capacities.\n");
+        return false;
+    }
+    format.assign(attributes, attributes + attributeNum);
+    stride = vertexStride;
+    vertexRanges.reset(vertexCapacity);
+    indexRanges.reset(indexCapacity);
+    vbo = createBuffer((size_t)vertexCapacity * stride);
+    ebo = createBuffer((size_t)indexCapacity * sizeof(uint32_t));
+    glGenVertexArrays(1, &vao);
+    setAttributes();
+    return true;
+}
+
+void MeshPool::destroy()
+{
+    if (vao)
+        glDeleteVertexArrays(1, &vao);
+    if (vbo)
+        glDeleteBuffers(1, &vbo);
+    if (ebo)
+        glDeleteBuffers(1, &ebo);
+    vao = vbo = ebo = 0;
+    meshes.clear();
+    freeIds.clear();
+    vertexRanges.reset(0);
+    indexRanges.reset(0);
+    liveNum = growNum = defragmentNum = 0;
+    copied = 0;
+}
+
+void MeshPool::setAttributes() const
+{
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    for (const MeshAttribute& a : format)
+    {
+        glEnableVertexAttribArray(a.location);
+        glVertexAttribPointer(a.location, a.components, a.type, a.normalized ? GL_TRUE : GL_FALSE, stride,
+            (void*)(uintptr_t)a.offset);
+    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+MeshPool::MeshId MeshPool::add(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount)
+{
+    if (!vao || !vertexCount || !indexCount)
+        return kInvalidMesh;
+    Mesh mesh = {};
+    mesh.vertices = vertexRanges.allocate(vertexCount);
+    mesh.indices = indexRanges.allocate(indexCount);
+    if (mesh.vertices.offset == OffsetAllocator::kNoSpace || mesh.indices.offset == OffsetAllocator::kNoSpace)
+    {
+        vertexRanges.free(mesh.vertices);
+        indexRanges.free(mesh.indices);
+        // compacting into buffers with room for this mesh and as much again as is used now
+        uint64_t vertexNeed = (uint64_t)vertexRanges.stats().used + vertexCount;
+        uint64_t indexNeed = (uint64_t)indexRanges.stats().used + indexCount;
+        uint64_t vertexCapacity = max<uint64_t>(vertexRanges.size(), vertexNeed * 2);
+        uint64_t indexCapacity = max<uint64_t>(indexRanges.size(), indexNeed * 2);
+        if (vertexCapacity >= OffsetAllocator::kNoSpace || indexCapacity >= OffsetAllocator::kNoSpace ||
+            !repack((uint32_t)vertexCapacity, (uint32_t)indexCapacity))
+        {
+            printf("ERROR: Mesh pool cannot grow for %u vertices and %u indices.\n", vertexCount, indexCount);
+            return kInvalidMesh;
+        }
+        growNum++;
+        mesh.vertices = vertexRanges.allocate(vertexCount);
+        mesh.indices = indexRanges.allocate(indexCount);
+    }
+    mesh.vertexCount = vertexCount;
+    mesh.indexCount = indexCount;
+    mesh.live = true;
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, vbo);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)mesh.vertices.offset * stride, (GLsizeiptr)vertexCount * stride, vertices);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, ebo);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)mesh.indices.offset * sizeof(uint32_t),
+        (GLsizeiptr)indexCount * sizeof(uint32_t), indices);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    MeshId id;
+    if (!freeIds.empty())
+    {
+        id = freeIds.back();
+        freeIds.pop_back();
+        meshes[id] = mesh;
+    }
+    else
+    {
+        id = (MeshId)meshes.size();
+        meshes.push_back(mesh);
+    }
+    liveNum++;
+    return id;
+}
+
+void MeshPool::remove(MeshId mesh)
+{
+    if (mesh >= meshes.size() || !meshes[mesh].live)
+        return;
+    vertexRanges.free(meshes[mesh].vertices);
+    indexRanges.free(meshes[mesh].indices);
+    meshes[mesh].live = false;
+    freeIds.push_back(mesh);
+    liveNum--;
+}
+
+bool MeshPool::defragment(uint32_t vertexCapacity, uint32_t indexCapacity)
+{
+    if (!vao || !repack(vertexCapacity, indexCapacity))
+        return false;
+    defragmentNum++;
+    return true;
+}
+
+bool MeshPool::repack(uint32_t vertexCapacity, uint32_t indexCapacity)
+{
+    OffsetAllocator::Stats vertexStats = vertexRanges.stats(), indexStats = indexRanges.stats();
+    vertexCapacity = max(vertexCapacity ? vertexCapacity : vertexStats.size, vertexStats.used);
+    indexCapacity = max(indexCapacity ? indexCapacity : indexStats.size, indexStats.used);
+
+    // in address order, so every range moves down or stays; the allocators round up to their
+    // bins, so the ranges may not fit where the sizes add up, and then nothing changes
+    vector<Mesh> previous = meshes;
+    vector<MeshId> order;
+    order.reserve(liveNum);
+    for (MeshId id = 0; id < meshes.size(); id++)
+        if (meshes[id].live)
+            order.push_back(id);
+    sort(order.begin(), order.end(), [&](MeshId a, MeshId b) { return meshes[a].vertices.offset < meshes[b].vertices.offset; });
+    OffsetAllocator newVertexRanges(vertexCapacity);
+    vector<Move> vertexMoves;
+    vertexMoves.reserve(order.size());
+    for (MeshId id : order)
+    {
+        OffsetAllocator::Allocation a = newVertexRanges.allocate(meshes[id].vertexCount);
+        if (a.offset == OffsetAllocator::kNoSpace)
+            break;
+        vertexMoves.push_back({ meshes[id].vertices.offset, a.offset, meshes[id].vertexCount });
+        meshes[id].vertices = a;
+    }
+    sort(order.begin(), order.end(), [&](MeshId a, MeshId b) { return meshes[a].indices.offset < meshes[b].indices.offset; });
+    OffsetAllocator newIndexRanges(indexCapacity);
+    vector<Move> indexMoves;
+    indexMoves.reserve(order.size());
+    for (MeshId id : order)
+    {
+        OffsetAllocator::Allocation a = newIndexRanges.allocate(meshes[id].indexCount);
+        if (a.offset == OffsetAllocator::kNoSpace)
+            break;
+        indexMoves.push_back({ meshes[id].indices.offset, a.offset, meshes[id].indexCount });
+        meshes[id].indices = a;
+    }
+    if (vertexMoves.size() < order.size() || indexMoves.size() < order.size())
+    {
+        meshes = move(previous);
+        printf("ERROR: Mesh pool meshes do not fit into %u vertices and %u indices.\n", vertexCapacity, indexCapacity);
+        return false;
+    }
+
+    // copies between two buffers: ranges of one buffer may not overlap
+    unsigned int newVbo = createBuffer((size_t)vertexCapacity * stride);
+    unsigned int newEbo = createBuffer((size_t)indexCapacity * sizeof(uint32_t));
+    copied += copyRanges(vbo, newVbo, vertexMoves, stride);
+    copied += copyRanges(ebo, newEbo, indexMoves, sizeof(uint32_t));
+    glDeleteBuffers(1, &vbo);
+    glDeleteBuffers(1, &ebo);
+    vbo = newVbo;
+    ebo = newEbo;
+    vertexRanges = move(newVertexRanges);
+    indexRanges = move(newIndexRanges);
+    setAttributes();
+    return true;
+}
+
+void MeshPool::bind() const
+{
+    glBindVertexArray(vao);
+}
+
+void MeshPool::unbind()
+{
+    glBindVertexArray(0);
+}
+
+MeshDraw MeshPool::drawRange(MeshId mesh) const
+{
+    const Mesh& m = meshes[mesh];
+    return { (GLsizei)m.indexCount, m.indices.offset, (GLint)m.vertices.offset };
+}
+
+void MeshPool::draw(MeshId mesh, GLenum mode) const
+{
+    const Mesh& m = meshes[mesh];
+    glDrawElementsBaseVertex(mode, m.indexCount, GL_UNSIGNED_INT, (void*)((uintptr_t)m.indices.offset * sizeof(uint32_t)),
+        m.vertices.offset);
+}
+
+void MeshPool::drawMany(const MeshId* ids, int num, GLenum mode) const
+{
+    drawCounts.resize(num);
+    drawOffsets.resize(num);
+    drawBaseVertices.resize(num);
+    for (int i = 0; i < num; i++)
+    {
+        const Mesh& m = meshes[ids[i]];
+        drawCounts[i] = m.indexCount;
+        drawOffsets[i] = (const void*)((uintptr_t)m.indices.offset * sizeof(uint32_t));
+        drawBaseVertices[i] = m.vertices.offset;
+    }
+    glMultiDrawElementsBaseVertex(mode, drawCounts.data(), GL_UNSIGNED_INT, drawOffsets.data(), num,
+        drawBaseVertices.data());
+}
+
+MeshPool::Stats MeshPool::stats() const
+{
+    return { vertexRanges.stats(), indexRanges.stats(), liveNum, growNum, defragmentNum, copied };
+}
+
+void MeshPool::print() const
+{
+    Stats s = stats();
+    printf("mesh pool: %u meshes, %u grows, %u defragments, %.2f MB copied\n", s.meshes, s.grows, s.defragments,
+        toMB(s.copiedBytes));
+    const char* names[2] = { "vertices", "indices" };
+    const OffsetAllocator::Stats* ranges[2] = { &s.vertices, &s.indices };
+    uint32_t units[2] = { stride, (uint32_t)sizeof(uint32_t) };
+    for (int i = 0; i < 2; i++)
+    {
+        const OffsetAllocator::Stats& r = *ranges[i];
+        printf("  %-8s %10u of %10u used (%.2f of %.2f MB), %u free blocks, largest %u, fragmentation %.1f%%\n",
+            names[i], r.used, r.size, toMB((size_t)r.used * units[i]),
+            toMB((size_t)r.size * units[i]), r.freeBlocks, r.largestFree, r.fragmentation() * 100.0);
+    }
+}
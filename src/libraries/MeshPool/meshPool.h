@@ -0,0 +1,117 @@
+#pragma once
+
+#include "offsetAllocator.h"
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+
+// One interleaved vertex attribute of the pool's format
+struct MeshAttribute
+{
+    unsigned int location;
+    int components;
+    GLenum type;
+    bool normalized;
+    unsigned int offset;        // bytes into the vertex
+};
+
+// Where a mesh lives in the pool's buffers, for building draws by hand
+struct MeshDraw
+{
+    GLsizei indexCount;
+    uint32_t firstIndex;
+    GLint baseVertex;
+};
+
+// Many meshes of one vertex format packed into one VBO and one EBO behind a single VAO.
+//
+//     MeshPool pool;
+//     pool.create(attributes, 2, sizeof(Vertex), 1 << 20, 1 << 22);
+//     MeshPool::MeshId rock = pool.add(vertices, vertexNum, indices, indexNum);
+//     pool.bind();                                 // once for every mesh of the pool
+//     pool.draw(rock);                             // glDrawElementsBaseVertex
+//
+// Vertex and index ranges come from two OffsetAllocators; indices stay relative to the mesh's
+// first vertex and are 32 bit. defragment() packs every mesh to the front of new buffers with
+// GPU to GPU copies (glCopyBufferSubData), MeshIds stay valid. A mesh that does not fit does
+// the same into larger buffers. Uploads and copies go through the copy binding points;
+// create(), and add() or defragment() when they move the meshes, leave no VAO bound.
+class MeshPool
+{
+public:
+    typedef uint32_t MeshId;
+    static constexpr MeshId kInvalidMesh = 0xffffffff;
+
+    struct Stats
+    {
+        OffsetAllocator::Stats vertices;
+        OffsetAllocator::Stats indices;
+        uint32_t meshes;
+        uint32_t grows;
+        uint32_t defragments;
+        uint64_t copiedBytes;       // by growing and defragmenting
+    };
+
+    MeshPool() {}
+    ~MeshPool() { destroy(); }
+    MeshPool(const MeshPool&) = delete;
+    MeshPool& operator=(const MeshPool&) = delete;
+
+    bool create(const MeshAttribute* attributes, int attributeNum, uint32_t vertexStride,
+        uint32_t vertexCapacity, uint32_t indexCapacity);
+    void destroy();
+
+    // kInvalidMesh when the buffers cannot grow enough
+    MeshId add(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+    void remove(MeshId mesh);
+
+    // Moves every mesh to the front of new buffers of the given capacities (0 keeps the
+    // current one, never below what the meshes use)
+    bool defragment(uint32_t vertexCapacity = 0, uint32_t indexCapacity = 0);
+
+    void bind() const;
+    static void unbind();
+
+    MeshDraw drawRange(MeshId mesh) const;
+    // with the pool bound
+    void draw(MeshId mesh, GLenum mode = GL_TRIANGLES) const;
+    // one glMultiDrawElementsBaseVertex for all of them
+    void drawMany(const MeshId* ids, int num, GLenum mode = GL_TRIANGLES) const;
+
+    Stats stats() const;
+    void print() const;
+
+    uint32_t meshNum() const { return liveNum; }
+    unsigned int vertexArray() const { return vao; }
+    unsigned int vertexBuffer() const { return vbo; }
+    unsigned int indexBuffer() const { return ebo; }
+
+private:
+    struct Mesh
+    {
+        OffsetAllocator::Allocation vertices;
+        OffsetAllocator::Allocation indices;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        bool live;
+    };
+
+    void setAttributes() const;
+    bool repack(uint32_t vertexCapacity, uint32_t indexCapacity);
+
+    std::vector<MeshAttribute> format;
+    uint32_t stride = 0;
+    unsigned int vao = 0, vbo = 0, ebo = 0;
+    OffsetAllocator vertexRanges;
+    OffsetAllocator indexRanges;
+    std::vector<Mesh> meshes;
+    std::vector<MeshId> freeIds;
+    uint32_t liveNum = 0;
+    uint32_t growNum = 0;
+    uint32_t defragmentNum = 0;
+    uint64_t copied = 0;
+    // drawMany's arrays, kept to not allocate per call
+    mutable std::vector<GLsizei> drawCounts;
+    mutable std::vector<const void*> drawOffsets;
+    mutable std::vector<GLint> drawBaseVertices;
+};
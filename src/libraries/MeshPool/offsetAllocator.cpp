@@ -0,0 +1,236 @@
+#include "offsetAllocator.h"
+
+#include <algorithm>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+    const uint32_t kMantissaBits = 3;
+    const uint32_t kMantissaValue = 1 << kMantissaBits;
+    const uint32_t kMantissaMask = kMantissaValue - 1;
+
+    uint32_t highestBit(uint32_t v)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse(&index, v);
+        return index;
+#else
+        return 31 - __builtin_clz(v);
+#endif
+    }
+
+    uint32_t lowestBit(uint32_t v)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, v);
+        return index;
+#else
+        return __builtin_ctz(v);
+#endif
+    }
+
+    // lowest set bit at or above start, kNoSpace if none
+    uint32_t lowestBitFrom(uint32_t mask, uint32_t start)
+    {
+        if (start >= 32)
+            return OffsetAllocator::kNoSpace;
+        mask &= ~((1u << start) - 1);
+        return mask ? lowestBit(mask) : OffsetAllocator::kNoSpace;
+    }
+
+    // sizes as small floats: below 8 exact, then 8 steps per power of two
+    uint32_t binRoundUp(uint32_t size)
+    {
+        if (size < kMantissaValue)
+            return size;
+        uint32_t mantissaStart = highestBit(size) - kMantissaBits;
+        uint32_t bin = ((mantissaStart + 1) << kMantissaBits) + ((size >> mantissaStart) & kMantissaMask);
+        // past the mantissa: the next bin, an overflow carries into the exponent
+        return (size & ((1u << mantissaStart) - 1)) ? bin + 1 : bin;
+    }
+
+    uint32_t binRoundDown(uint32_t size)
+    {
+        if (size < kMantissaValue)
+            return size;
+        uint32_t mantissaStart = highestBit(size) - kMantissaBits;
+        return ((mantissaStart + 1) << kMantissaBits) + ((size >> mantissaStart) & kMantissaMask);
+    }
+}
+
+void OffsetAllocator::reset(uint32_t size)
+{
+    totalSize = size;
+    freeStorage = freeBlockNum = allocationNum = 0;
+    usedTopBins = 0;
+    fill(begin(usedLeafBins), end(usedLeafBins), 0);
+    fill(begin(binHeads), end(binHeads), kNone);
+    nodes.clear();
+    freeNodes.clear();
+    if (size)
+        insertFree(0, size, newNode());
+}
+
+uint32_t OffsetAllocator::newNode()
+{
+    uint32_t node;
+    if (!freeNodes.empty())
+    {
+        node = freeNodes.back();
+        freeNodes.pop_back();
+    }
+    else
+    {
+        node = (uint32_t)nodes.size();
+        nodes.push_back(Node());
+    }
+    nodes[node] = { 0, 0, kNone, kNone, kNone, kNone, false };
+    return node;
+}
+
+// node becomes a free block at the head of its bin, neighbors are the caller's business
+uint32_t OffsetAllocator::insertFree(uint32_t offset, uint32_t size, uint32_t node)
+{
+    uint32_t bin = binRoundDown(size);
+    uint32_t top = bin >> kMantissaBits, leaf = bin & kMantissaMask;
+    if (binHeads[bin] == kNone)
+    {
+        usedLeafBins[top] |= 1 << leaf;
+        usedTopBins |= 1u << top;
+    }
+    Node& n = nodes[node];
+    n.offset = offset;
+    n.size = size;
+    n.used = false;
+    n.binPrev = kNone;
+    n.binNext = binHeads[bin];
+    if (n.binNext != kNone)
+        nodes[n.binNext].binPrev = node;
+    binHeads[bin] = node;
+    freeStorage += size;
+    freeBlockNum++;
+    return node;
+}
+
+void OffsetAllocator::removeFree(uint32_t node)
+{
+    Node& n = nodes[node];
+    if (n.binPrev != kNone)
+        nodes[n.binPrev].binNext = n.binNext;
+    else
+    {
+        uint32_t bin = binRoundDown(n.size);
+        binHeads[bin] = n.binNext;
+        if (n.binNext == kNone)
+        {
+            uint32_t top = bin >> kMantissaBits, leaf = bin & kMantissaMask;
+            usedLeafBins[top] &= ~(1 << leaf);
+            if (!usedLeafBins[top])
+                usedTopBins &= ~(1u << top);
+        }
+    }
+    if (n.binNext != kNone)
+        nodes[n.binNext].binPrev = n.binPrev;
+    freeStorage -= n.size;
+    freeBlockNum--;
+}
+
+OffsetAllocator::Allocation OffsetAllocator::allocate(uint32_t size)
+{
+    Allocation allocation;
+    if (!size || size > freeStorage)
+        return allocation;
+
+    // the first non-empty bin whose every block fits
+    uint32_t minBin = binRoundUp(size);
+    uint32_t top = minBin >> kMantissaBits;
+    uint32_t leaf = kNoSpace;
+    if (top < kTopBinNum && (usedTopBins & (1u << top)))
+        leaf = lowestBitFrom(usedLeafBins[top], minBin & kMantissaMask);
+    if (leaf == kNoSpace)
+    {
+        top = lowestBitFrom(usedTopBins, top + 1);
+        if (top == kNoSpace)
+            return allocation;
+        leaf = lowestBit(usedLeafBins[top]);
+    }
+    uint32_t node = binHeads[(top << kMantissaBits) | leaf];
+    removeFree(node);
+
+    uint32_t remainder = nodes[node].size - size;
+    nodes[node].size = size;
+    nodes[node].used = true;
+    if (remainder)
+    {
+        uint32_t rest = newNode();      // may move nodes
+        insertFree(nodes[node].offset + size, remainder, rest);
+        nodes[rest].neighborPrev = node;
+        nodes[rest].neighborNext = nodes[node].neighborNext;
+        if (nodes[rest].neighborNext != kNone)
+            nodes[nodes[rest].neighborNext].neighborPrev = rest;
+        nodes[node].neighborNext = rest;
+    }
+    allocationNum++;
+    allocation.offset = nodes[node].offset;
+    allocation.node = node;
+    return allocation;
+}
+
+void OffsetAllocator::free(Allocation allocation)
+{
+    uint32_t node = allocation.node;
+    if (node == kNoSpace || node >= nodes.size() || !nodes[node].used)
+        return;
+    uint32_t offset = nodes[node].offset;
+    uint32_t size = nodes[node].size;
+
+    uint32_t prev = nodes[node].neighborPrev;
+    if (prev != kNone && !nodes[prev].used)
+    {
+        offset = nodes[prev].offset;
+        size += nodes[prev].size;
+        removeFree(prev);
+        nodes[node].neighborPrev = nodes[prev].neighborPrev;
+        freeNodes.push_back(prev);
+    }
+    uint32_t next = nodes[node].neighborNext;
+    if (next != kNone && !nodes[next].used)
+    {
+        size += nodes[next].size;
+        removeFree(next);
+        nodes[node].neighborNext = nodes[next].neighborNext;
+        freeNodes.push_back(next);
+    }
+    if (nodes[node].neighborPrev != kNone)
+        nodes[nodes[node].neighborPrev].neighborNext = node;
+    if (nodes[node].neighborNext != kNone)
+        nodes[nodes[node].neighborNext].neighborPrev = node;
+    insertFree(offset, size, node);
+    allocationNum--;
+}
+
+OffsetAllocator::Stats OffsetAllocator::stats() const
+{
+    Stats s = {};
+    s.size = totalSize;
+    s.free = freeStorage;
+    s.used = totalSize - freeStorage;
+    s.freeBlocks = freeBlockNum;
+    s.allocations = allocationNum;
+    // blocks of the highest bin are the largest, they only differ inside it
+    if (usedTopBins)
+    {
+        uint32_t top = highestBit(usedTopBins);
+        uint32_t bin = (top << kMantissaBits) | highestBit(usedLeafBins[top]);
+        for (uint32_t n = binHeads[bin]; n != kNone; n = nodes[n].binNext)
+            s.largestFree = max(s.largestFree, nodes[n].size);
+    }
+    return s;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Allocates ranges of [0, size) in abstract units (vertices, indices, bytes), for
+// suballocating GPU buffers: the allocator never touches the memory it manages.
+//
+//     OffsetAllocator vertices(1 << 20);
+//     OffsetAllocator::Allocation a = vertices.allocate(vertexCount);
+//     if (a.offset == OffsetAllocator::kNoSpace) ...
+//     vertices.free(a);
+//
+// Two-level segregated fit (TLSF): free blocks sit in 256 bins whose sizes form a small float
+// (5 bit exponent, 3 bit mantissa), one bitmask per level finds the first non-empty bin large
+// enough in constant time. A block is split on allocation, the remainder going back to a bin,
+// and merged with its free neighbors on free: allocate and free are O(1). The price is that a
+// request rounded up to the next bin ignores blocks of its own bin that might have fit.
+class OffsetAllocator
+{
+public:
+    static constexpr uint32_t kNoSpace = 0xffffffff;
+
+    struct Allocation
+    {
+        uint32_t offset = kNoSpace;
+        uint32_t node = kNoSpace;       // the allocator's handle
+    };
+
+    struct Stats
+    {
+        uint32_t size;
+        uint32_t used;
+        uint32_t free;
+        uint32_t largestFree;
+        uint32_t freeBlocks;
+        uint32_t allocations;
+        // share of the free space outside the largest free block
+        double fragmentation() const { return free ? 1.0 - (double)largestFree / free : 0.0; }
+    };
+
+    explicit OffsetAllocator(uint32_t size = 0) { reset(size); }
+
+    // forgets every allocation
+    void reset(uint32_t size);
+
+    Allocation allocate(uint32_t size);
+    void free(Allocation allocation);
+    uint32_t allocationSize(Allocation allocation) const { return nodes[allocation.node].size; }
+
+    uint32_t size() const { return totalSize; }
+    Stats stats() const;
+
+private:
+    static constexpr int kTopBinNum = 32;
+    static constexpr int kLeafBinsPerTop = 8;
+    static constexpr int kBinNum = kTopBinNum * kLeafBinsPerTop;
+    static constexpr uint32_t kNone = 0xffffffff;
+
+    struct Node
+    {
+        uint32_t offset;
+        uint32_t size;
+        uint32_t binPrev, binNext;              // free list of the bin
+        uint32_t neighborPrev, neighborNext;    // address order
+        bool used;
+    };
+
+    uint32_t newNode();
+    uint32_t insertFree(uint32_t offset, uint32_t size, uint32_t node);
+    void removeFree(uint32_t node);
+
+    uint32_t totalSize = 0;
+    uint32_t freeStorage = 0;
+    uint32_t freeBlockNum = 0;
+    uint32_t allocationNum = 0;
+    uint32_t usedTopBins = 0;
+    uint8_t usedLeafBins[kTopBinNum] = {};
+    uint32_t binHeads[kBinNum];
+    std::vector<Node> nodes;
+    std::vector<uint32_t> freeNodes;            // unused entries of nodes
+};
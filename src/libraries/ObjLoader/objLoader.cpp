@@ -0,0 +1,680 @@
+#include "objLoader.h"
+
+#include <mappedFile.h>
+#include <threadPool.h>
+
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+
+using namespace std;
+
+namespace
+{
+    const int kMissing = INT_MIN;
+
+    //------- float parsing -------
+
+    const double kPow10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    inline bool isDigit(char c) { return (unsigned)(c - '0') < 10; }
+    inline bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+    inline const char* skipBlank(const char* p, const char* end)
+    {
+        while (p < end && isBlank(*p))
+            p++;
+        return p;
+    }
+
+    inline const char* skipLine(const char* p, const char* end)
+    {
+        const char* nl = (const char*)memchr(p, '\n', end - p);
+        return nl ? nl + 1 : end;
+    }
+
+    inline const char* parseInt(const char* p, const char* end, int& value)
+    {
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+        {
+            negative = *p == '-';
+            p++;
+        }
+        if (p >= end || !isDigit(*p))
+            return nullptr;
+        int v = 0;
+        while (p < end && isDigit(*p))
+            v = v * 10 + (*p++ - '0');
+        value = negative ? -v : v;
+        return p;
+    }
+
+    //------- per chunk parse result -------
+
+    struct RawCorner
+    {
+        int v, t, n;
+        unsigned char relative;     // bit0: v, bit1: t, bit2: n are chunk-relative
+    };
+
+    struct MaterialRun
+    {
+        string name;
+        size_t cornerStart;
+        bool inherited;             // chunk start, material set by an earlier chunk
+    };
+
+    struct Chunk
+    {
+        const char* begin;
+        const char* end;
+        vector<float> positions;
+        vector<float> texCoords;
+        vector<float> normals;
+        vector<RawCorner> corners;  // three per triangle
+        vector<MaterialRun> runs;
+        vector<string> mtlLibs;
+        bool error = false;
+
+        // after resolving
+        size_t positionBase = 0, texCoordBase = 0, normalBase = 0;
+        size_t cornerBase = 0;
+        vector<unsigned int> localIndices;
+        vector<RawCorner> uniqueKeys;
+        vector<unsigned int> remap;
+    };
+
+    //------- open addressing hash map of (v, t, n) -> index -------
+
+    class VertexHashMap
+    {
+    public:
+        explicit VertexHashMap(size_t expected)
+        {
+            size_t cap = 16;
+            while (cap < expected * 2)
+                cap <<= 1;
+            keys.resize(cap);
+            values.assign(cap, UINT32_MAX);
+            mask = cap - 1;
+        }
+
+        // returns the existing value, or inserts 'value' and returns it
+        unsigned int findOrInsert(const RawCorner& key, unsigned int value)
+        {
+            if ((count + 1) * 2 > keys.size())
+                grow();
+            size_t i = hash(key) & mask;
+            while (true)
+            {
+                if (values[i] == UINT32_MAX)
+                {
+                    keys[i] = key;
+                    values[i] = value;
+                    count++;
+                    return value;
+                }
+                if (keys[i].v == key.v && keys[i].t == key.t && keys[i].n == key.n)
+                    return values[i];
+                i = (i + 1) & mask;
+            }
+        }
+
+    private:
+        static size_t hash(const RawCorner& k)
+        {
+            uint64_t h = (uint64_t)(uint32_t)k.v * 0x9E3779B97F4A7C15ull;
+            h ^= (uint64_t)(uint32_t)k.t * 0xC2B2AE3D27D4EB4Full + (h >> 29);
+            h ^= (uint64_t)(uint32_t)k.n * 0x165667B19E3779F9ull + (h >> 32);
+            return (size_t)(h ^ (h >> 31));
+        }
+
+        void grow()
+        {
+            vector<RawCorner> oldKeys;
+            vector<unsigned int> oldValues;
+            oldKeys.swap(keys);
+            oldValues.swap(values);
+            keys.resize(oldKeys.size() * 2);
+            values.assign(oldValues.size() * 2, UINT32_MAX);
+            mask = keys.size() - 1;
+            count = 0;
+            for (size_t i = 0; i < oldKeys.size(); i++)
+                if (oldValues[i] != UINT32_MAX)
+                    findOrInsert(oldKeys[i], oldValues[i]);
+        }
+
+        vector<RawCorner> keys;
+        vector<unsigned int> values;
+        size_t mask = 0;
+        size_t count = 0;
+    };
+
+    //------- line parsing -------
+
+    const char* parseFloats(const char* p, const char* end, float* out, int maxNum, int& num)
+    {
+        num = 0;
+        while (num < maxNum)
+        {
+            p = skipBlank(p, end);
+            const char* next = parseFloat(p, end, out[num]);
+            if (next == p)
+                break;
+            p = next;
+            num++;
+        }
+        return p;
+    }
+
+    string parseName(const char* p, const char* end)
+    {
+        p = skipBlank(p, end);
+        const char* e = p;
+        while (e < end && *e != '\n')
+            e++;
+        while (e > p && isBlank(e[-1]))
+            e--;
+        return string(p, e);
+    }
+
+    // "v", "v/t", "v//n", "v/t/n"
+    const char* parseCorner(const char* p, const char* end, const Chunk& chunk, RawCorner& c)
+    {
+        int value;
+        c.relative = 0;
+        c.t = c.n = kMissing;
+        p = parseInt(p, end, value);
+        if (!p || value == 0)
+            return nullptr;
+        if (value < 0)
+        {
+            c.v = (int)(chunk.positions.size() / 3) + value;
+            c.relative |= 1;
+        }
+        else
+            c.v = value - 1;
+        if (p < end && *p == '/')
+        {
+            p++;
+            if (p < end && *p != '/')
+            {
+                p = parseInt(p, end, value);
+                if (!p || value == 0)
+                    return nullptr;
+                if (value < 0)
+                {
+                    c.t = (int)(chunk.texCoords.size() / 2) + value;
+                    c.relative |= 2;
+                }
+                else
+                    c.t = value - 1;
+            }
+            if (p < end && *p == '/')
+            {
+                p++;
+                p = parseInt(p, end, value);
+                if (!p || value == 0)
+                    return nullptr;
+                if (value < 0)
+                {
+                    c.n = (int)(chunk.normals.size() / 3) + value;
+                    c.relative |= 4;
+                }
+                else
+                    c.n = value - 1;
+            }
+        }
+        return p;
+    }
+
+    void parseChunk(Chunk& chunk)
+    {
+        const char* p = chunk.begin;
+        const char* end = chunk.end;
+        chunk.runs.push_back({ "", 0, true });
+        vector<RawCorner> polygon;  // reused, grows to the largest face
+        while (p < end)
+        {
+            p = skipBlank(p, end);
+            if (p >= end)
+                break;
+            char c0 = *p;
+            char c1 = p + 1 < end ? p[1] : '\n';
+            if (c0 == 'v' && isBlank(c1))
+            {
+                float v[3] = { 0.0f, 0.0f, 0.0f };
+                int num;
+                parseFloats(p + 2, end, v, 3, num);
+                chunk.positions.insert(chunk.positions.end(), v, v + 3);
+            }
+            else if (c0 == 'v' && c1 == 't')
+            {
+                float v[2] = { 0.0f, 0.0f };
+                int num;
+                parseFloats(p + 2, end, v, 2, num);
+                chunk.texCoords.insert(chunk.texCoords.end(), v, v + 2);
+            }
+            else if (c0 == 'v' && c1 == 'n')
+            {
+                float v[3] = { 0.0f, 0.0f, 0.0f };
+                int num;
+                parseFloats(p + 2, end, v, 3, num);
+                chunk.normals.insert(chunk.normals.end(), v, v + 3);
+            }
+            else if (c0 == 'f' && isBlank(c1))
+            {
+                const char* q = p + 1;
+                polygon.clear();
+                while (true)
+                {
+                    q = skipBlank(q, end);
+                    if (q >= end || *q == '\n' || *q == '#')
+                        break;
+                    RawCorner c;
+                    q = parseCorner(q, end, chunk, c);
+                    if (!q)
+                    {
+                        chunk.error = true;
+                        return;
+                    }
+                    polygon.push_back(c);
+                }
+                for (size_t i = 2; i < polygon.size(); i++)
+                {
+                    chunk.corners.push_back(polygon[0]);
+                    chunk.corners.push_back(polygon[i - 1]);
+                    chunk.corners.push_back(polygon[i]);
+                }
+            }
+            else if (c0 == 'u' && end - p > 6 && memcmp(p, "usemtl", 6) == 0)
+            {
+                chunk.runs.push_back({ parseName(p + 6, end), chunk.corners.size(), false });
+            }
+            else if (c0 == 'm' && end - p > 6 && memcmp(p, "mtllib", 6) == 0)
+            {
+                chunk.mtlLibs.push_back(parseName(p + 6, end));
+            }
+            p = skipLine(p, end);
+        }
+    }
+
+    // Turn chunk-relative and 1-based indices into absolute 0-based ones, then
+    // deduplicate the corners of this chunk locally.
+    bool resolveChunk(Chunk& chunk, size_t positionNum, size_t texCoordNum, size_t normalNum)
+    {
+        VertexHashMap map(chunk.corners.size() / 4 + 16);
+        chunk.localIndices.resize(chunk.corners.size());
+        for (size_t i = 0; i < chunk.corners.size(); i++)
+        {
+            RawCorner c = chunk.corners[i];
+            if (c.relative & 1)
+                c.v += (int)chunk.positionBase;
+            if (c.t != kMissing && (c.relative & 2))
+                c.t += (int)chunk.texCoordBase;
+            if (c.n != kMissing && (c.relative & 4))
+                c.n += (int)chunk.normalBase;
+            c.relative = 0;
+            if (c.v < 0 || (size_t)c.v >= positionNum)
+                return false;
+            if (c.t != kMissing && (c.t < 0 || (size_t)c.t >= texCoordNum))
+                return false;
+            if (c.n != kMissing && (c.n < 0 || (size_t)c.n >= normalNum))
+                return false;
+            unsigned int id = map.findOrInsert(c, (unsigned int)chunk.uniqueKeys.size());
+            if (id == chunk.uniqueKeys.size())
+                chunk.uniqueKeys.push_back(c);
+            chunk.localIndices[i] = id;
+        }
+        vector<RawCorner>().swap(chunk.corners);
+        return true;
+    }
+
+    template<typename F>
+    void forEachChunk(ThreadPool* pool, size_t chunkNum, const F& fn)
+    {
+        if (!pool || chunkNum == 1)
+        {
+            for (size_t i = 0; i < chunkNum; i++)
+                fn(i);
+            return;
+        }
+        pool->parallelFor(chunkNum, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                fn(i);
+        });
+    }
+
+    string directoryOf(const string& path)
+    {
+        size_t pos = path.find_last_of("/\\");
+        return pos == string::npos ? string() : path.substr(0, pos + 1);
+    }
+}
+
+const char* parseFloat(const char* p, const char* end, float& value)
+{
+    const char* start = p;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        p++;
+    }
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    int digits = 0;
+    bool any = false;
+    while (p < end && isDigit(*p))
+    {
+        if (digits < 19)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+            if (mantissa)
+                digits++;
+        }
+        else
+            exponent++;
+        p++;
+        any = true;
+    }
+    if (p < end && *p == '.')
+    {
+        p++;
+        while (p < end && isDigit(*p))
+        {
+            if (digits < 19)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                if (mantissa)
+                    digits++;
+                exponent--;
+            }
+            p++;
+            any = true;
+        }
+    }
+    if (!any)
+        return start;
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        int e;
+        const char* q = parseInt(p + 1, end, e);
+        if (q)
+        {
+            exponent += e;
+            p = q;
+        }
+    }
+    double v = (double)mantissa;
+    if (exponent < 0)
+        v = exponent >= -22 ? v / kPow10[-exponent] : v * pow(10.0, exponent);
+    else if (exponent > 0)
+        v = exponent <= 22 ? v * kPow10[exponent] : v * pow(10.0, exponent);
+    value = (float)(negative ? -v : v);
+    return p;
+}
+
+void parseMtl(const char* text, size_t size, vector<ObjMaterial>& materials)
+{
+    const char* p = text;
+    const char* end = text + size;
+    ObjMaterial* current = nullptr;
+    while (p < end)
+    {
+        p = skipBlank(p, end);
+        const char* lineEnd = skipLine(p, end);
+        size_t len = lineEnd - p;
+        int num;
+        if (len > 6 && memcmp(p, "newmtl", 6) == 0)
+        {
+            materials.emplace_back();
+            current = &materials.back();
+            current->name = parseName(p + 6, end);
+        }
+        else if (current && len > 2 && p[0] == 'K' && isBlank(p[2]))
+        {
+            float* dst = p[1] == 'a' ? current->ambient : p[1] == 'd' ? current->diffuse :
+                p[1] == 's' ? current->specular : nullptr;
+            if (dst)
+                parseFloats(p + 2, end, dst, 3, num);
+        }
+        else if (current && len > 2 && p[0] == 'N' && p[1] == 's')
+            parseFloats(p + 2, end, &current->shininess, 1, num);
+        else if (current && len > 1 && p[0] == 'd' && isBlank(p[1]))
+            parseFloats(p + 1, end, &current->opacity, 1, num);
+        else if (current && len > 2 && p[0] == 'T' && p[1] == 'r')
+        {
+            float tr;
+            parseFloats(p + 2, end, &tr, 1, num);
+            if (num)
+                current->opacity = 1.0f - tr;
+        }
+        else if (current && len > 6 && memcmp(p, "map_Kd", 6) == 0)
+            current->diffuseMap = parseName(p + 6, end);
+        else if (current && len > 6 && memcmp(p, "map_Ks", 6) == 0)
+            current->specularMap = parseName(p + 6, end);
+        else if (current && len > 8 && memcmp(p, "map_Bump", 8) == 0)
+            current->normalMap = parseName(p + 8, end);
+        else if (current && len > 4 && memcmp(p, "bump", 4) == 0)
+            current->normalMap = parseName(p + 4, end);
+        p = lineEnd;
+    }
+}
+
+bool parseObj(const char* text, size_t size, ObjMesh& mesh, const ObjLoadOptions& options, const string& mtlDir)
+{
+    mesh = ObjMesh();
+    ThreadPool* pool = nullptr;
+    if (options.multithread)
+        pool = options.pool ? options.pool : &ThreadPool::global();
+
+    //------- split at line boundaries -------
+    vector<Chunk> chunks;
+    size_t chunkSize = pool ? (options.chunkSize ? options.chunkSize : 1) : (size ? size : 1);
+    const char* end = text + size;
+    const char* p = text;
+    do
+    {
+        Chunk chunk;
+        chunk.begin = p;
+        p = (size_t)(end - p) > chunkSize ? skipLine(p + chunkSize, end) : end;
+        chunk.end = p;
+        chunks.push_back(std::move(chunk));
+    } while (p < end);
+
+    //------- parse -------
+    forEachChunk(pool, chunks.size(), [&](size_t i) { parseChunk(chunks[i]); });
+
+    size_t positionNum = 0, texCoordNum = 0, normalNum = 0, cornerNum = 0;
+    for (Chunk& chunk : chunks)
+    {
+        if (chunk.error)
+        {
+            cout << "ERROR: Malformed face in OBJ data.\n";
+            return false;
+        }
+        chunk.positionBase = positionNum;
+        chunk.texCoordBase = texCoordNum;
+        chunk.normalBase = normalNum;
+        chunk.cornerBase = cornerNum;
+        positionNum += chunk.positions.size() / 3;
+        texCoordNum += chunk.texCoords.size() / 2;
+        normalNum += chunk.normals.size() / 3;
+        cornerNum += chunk.corners.size();
+    }
+
+    //------- resolve and deduplicate per chunk -------
+    vector<char> ok(chunks.size(), 1);
+    forEachChunk(pool, chunks.size(), [&](size_t i) {
+        ok[i] = resolveChunk(chunks[i], positionNum, texCoordNum, normalNum);
+    });
+    for (char c : ok)
+    {
+        if (!c)
+        {
+            cout << "ERROR: Face index out of range in OBJ data.\n";
+            return false;
+        }
+    }
+
+    //------- merge chunk-unique vertices globally -------
+    size_t localUniqueNum = 0;
+    for (Chunk& chunk : chunks)
+        localUniqueNum += chunk.uniqueKeys.size();
+    VertexHashMap globalMap(chunks.size() == 1 ? 0 : localUniqueNum / 2 + 16);
+    vector<RawCorner> keys;
+    if (chunks.size() == 1)
+        keys.swap(chunks[0].uniqueKeys);
+    else
+    {
+        keys.reserve(localUniqueNum);
+        for (Chunk& chunk : chunks)
+        {
+            chunk.remap.resize(chunk.uniqueKeys.size());
+            for (size_t i = 0; i < chunk.uniqueKeys.size(); i++)
+            {
+                unsigned int id = globalMap.findOrInsert(chunk.uniqueKeys[i], (unsigned int)keys.size());
+                if (id == keys.size())
+                    keys.push_back(chunk.uniqueKeys[i]);
+                chunk.remap[i] = id;
+            }
+            vector<RawCorner>().swap(chunk.uniqueKeys);
+        }
+    }
+    for (const RawCorner& k : keys)
+    {
+        mesh.hasTexCoord |= k.t != kMissing;
+        mesh.hasNormal |= k.n != kMissing;
+    }
+
+    //------- gather positions/attributes into flat arrays -------
+    vector<float> positions, texCoords, normals;
+    positions.reserve(positionNum * 3);
+    texCoords.reserve(texCoordNum * 2);
+    normals.reserve(normalNum * 3);
+    for (Chunk& chunk : chunks)
+    {
+        positions.insert(positions.end(), chunk.positions.begin(), chunk.positions.end());
+        texCoords.insert(texCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end());
+        normals.insert(normals.end(), chunk.normals.begin(), chunk.normals.end());
+        vector<float>().swap(chunk.positions);
+        vector<float>().swap(chunk.texCoords);
+        vector<float>().swap(chunk.normals);
+    }
+
+    //------- emit interleaved vertices and indices -------
+    int stride = mesh.stride();
+    int normalOffset = mesh.normalOffset();
+    int texCoordOffset = mesh.texCoordOffset();
+    mesh.vertices.resize(keys.size() * stride);
+    const size_t vertexGrain = 1 << 14;
+    auto writeVertices = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            const RawCorner& k = keys[i];
+            float* dst = &mesh.vertices[i * stride];
+            memcpy(dst, &positions[(size_t)k.v * 3], 3 * sizeof(float));
+            if (mesh.hasNormal)
+            {
+                if (k.n != kMissing)
+                    memcpy(dst + normalOffset, &normals[(size_t)k.n * 3], 3 * sizeof(float));
+                else
+                    dst[normalOffset] = dst[normalOffset + 1] = dst[normalOffset + 2] = 0.0f;
+            }
+            if (mesh.hasTexCoord)
+            {
+                if (k.t != kMissing)
+                    memcpy(dst + texCoordOffset, &texCoords[(size_t)k.t * 2], 2 * sizeof(float));
+                else
+                    dst[texCoordOffset] = dst[texCoordOffset + 1] = 0.0f;
+            }
+        }
+    };
+    if (pool)
+        pool->parallelFor(keys.size(), vertexGrain, writeVertices);
+    else
+        writeVertices(0, keys.size());
+
+    mesh.indices.resize(cornerNum);
+    forEachChunk(pool, chunks.size(), [&](size_t c) {
+        Chunk& chunk = chunks[c];
+        unsigned int* dst = mesh.indices.data() + chunk.cornerBase;
+        if (chunk.remap.empty())
+        {
+            if (!chunk.localIndices.empty())    // data() may be null
+                memcpy(dst, chunk.localIndices.data(), chunk.localIndices.size() * sizeof(unsigned int));
+        }
+        else
+            for (size_t i = 0; i < chunk.localIndices.size(); i++)
+                dst[i] = chunk.remap[chunk.localIndices[i]];
+        vector<unsigned int>().swap(chunk.localIndices);
+    });
+
+    //------- materials -------
+    if (options.loadMaterials)
+    {
+        for (const Chunk& chunk : chunks)
+        {
+            for (const string& lib : chunk.mtlLibs)
+            {
+                MappedFile file;
+                if (file.open((mtlDir + lib).c_str()))
+                    parseMtl(file.data(), file.size(), mesh.materials);
+            }
+        }
+    }
+    unordered_map<string, int> materialIds;
+    for (size_t i = 0; i < mesh.materials.size(); i++)
+        materialIds.emplace(mesh.materials[i].name, (int)i);
+
+    int material = -1;
+    for (const Chunk& chunk : chunks)
+    {
+        for (size_t r = 0; r < chunk.runs.size(); r++)
+        {
+            const MaterialRun& run = chunk.runs[r];
+            if (!run.inherited)
+            {
+                auto it = materialIds.find(run.name);
+                material = it == materialIds.end() ? -1 : it->second;
+            }
+            size_t begin = chunk.cornerBase + run.cornerStart;
+            if (!mesh.submeshes.empty() && mesh.submeshes.back().material == material)
+                continue;
+            if (!mesh.submeshes.empty())
+                mesh.submeshes.back().indexCount = begin - mesh.submeshes.back().indexOffset;
+            mesh.submeshes.push_back({ material, begin, 0 });
+        }
+    }
+    if (!mesh.submeshes.empty())
+        mesh.submeshes.back().indexCount = cornerNum - mesh.submeshes.back().indexOffset;
+    // drop empty runs, e.g. a "usemtl" directly followed by another
+    size_t kept = 0;
+    for (size_t i = 0; i < mesh.submeshes.size(); i++)
+    {
+        if (mesh.submeshes[i].indexCount == 0)
+            continue;
+        if (kept > 0 && mesh.submeshes[kept - 1].material == mesh.submeshes[i].material)
+            mesh.submeshes[kept - 1].indexCount += mesh.submeshes[i].indexCount;
+        else
+            mesh.submeshes[kept++] = mesh.submeshes[i];
+    }
+    mesh.submeshes.resize(kept);
+    return true;
+}
+
+bool loadObj(const char* filename, ObjMesh& mesh, const ObjLoadOptions& options)
+{
+    MappedFile file;
+    if (!file.open(filename))
+        return false;
+    return parseObj(file.data(), file.size(), mesh, options, directoryOf(filename));
+}
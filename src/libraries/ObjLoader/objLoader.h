@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+struct ObjMaterial
+{
+    std::string name;
+    float ambient[3] = { 0.0f, 0.0f, 0.0f };
+    float diffuse[3] = { 1.0f, 1.0f, 1.0f };
+    float specular[3] = { 0.0f, 0.0f, 0.0f };
+    float shininess = 0.0f;
+    float opacity = 1.0f;
+    std::string diffuseMap;
+    std::string specularMap;
+    std::string normalMap;
+};
+
+// A run of indices drawn with one material
+struct ObjSubmesh
+{
+    int material = -1;          // index into ObjMesh::materials, -1 for none
+    size_t indexOffset = 0;
+    size_t indexCount = 0;
+};
+
+// Indexed mesh ready for glBufferData:
+// interleaved vertices [position(3) | normal(3) | texCoord(2)], optional parts omitted,
+// and 32-bit triangle indices.
+struct ObjMesh
+{
+    std::vector<float> vertices;
+    std::vector<unsigned int> indices;
+    std::vector<ObjSubmesh> submeshes;
+    std::vector<ObjMaterial> materials;
+
+    bool hasNormal = false;
+    bool hasTexCoord = false;
+
+    // in floats
+    int stride() const { return 3 + (hasNormal ? 3 : 0) + (hasTexCoord ? 2 : 0); }
+    int normalOffset() const { return 3; }
+    int texCoordOffset() const { return hasNormal ? 6 : 3; }
+    size_t vertexCount() const { return vertices.size() / stride(); }
+};
+
+struct ObjLoadOptions
+{
+    ThreadPool* pool = nullptr; // nullptr uses ThreadPool::global()
+    bool multithread = true;    // false parses the whole file on the calling thread
+    size_t chunkSize = 4 << 20; // bytes of text handed to one parse job
+    bool loadMaterials = true;
+};
+
+// Load a Wavefront OBJ file (and the MTL libraries it references).
+// Polygons are triangulated as fans, negative (relative) indices are supported.
+bool loadObj(const char* filename, ObjMesh& mesh, const ObjLoadOptions& options = ObjLoadOptions());
+
+// Parse OBJ text already in memory. mtlDir is prepended to "mtllib" names.
+bool parseObj(const char* text, size_t size, ObjMesh& mesh,
+    const ObjLoadOptions& options = ObjLoadOptions(), const std::string& mtlDir = "");
+
+// Parse MTL text and append its materials
+void parseMtl(const char* text, size_t size, std::vector<ObjMaterial>& materials);
+
+// Locale independent float parser, stops at the first character that is not part of the number
+const char* parseFloat(const char* p, const char* end, float& value);
@@ -0,0 +1,164 @@
+#include "cpuProfiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#if !defined(PROFILER_STEADY_CLOCK) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define PROFILER_USE_TSC
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace
+{
+    int64_t steadyNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void writeEscaped(FILE* f, const char* s)
+    {
+        for (; *s; s++)
+        {
+            if (*s == '"' || *s == '\\')
+                fputc('\\', f);
+            if ((unsigned char)*s >= 0x20)
+                fputc(*s, f);
+        }
+    }
+}
+
+CpuProfiler& CpuProfiler::instance()
+{
+    static CpuProfiler profiler;
+    return profiler;
+}
+
+CpuProfiler::CpuProfiler()
+{
+    startTicks = now();
+    startNanoseconds = steadyNanoseconds();
+}
+
+uint64_t CpuProfiler::now()
+{
+#ifdef PROFILER_USE_TSC
+    return __rdtsc();
+#else
+    return (uint64_t)steadyNanoseconds();
+#endif
+}
+
+double CpuProfiler::ticksPerMicrosecond() const
+{
+#ifdef PROFILER_USE_TSC
+    // invariant TSC: one linear fit over the whole run is accurate enough for traces
+    uint64_t ticks = now() - startTicks;
+    int64_t ns = steadyNanoseconds() - startNanoseconds;
+    return ns > 0 ? ticks * 1000.0 / ns : 1000.0;
+#else
+    return 1000.0;
+#endif
+}
+
+CpuProfiler::ThreadBuffer* CpuProfiler::registerThread()
+{
+    std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer());
+    buffer->events.reset(new CpuEvent[kEventsPerThread]);
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    buffer->id = (uint32_t)threads.size();
+    buffer->name = "thread " + std::to_string(buffer->id);
+    threads.push_back(std::move(buffer));
+    return threads.back().get();
+}
+
+void CpuProfiler::setThreadName(const char* name)
+{
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    buffer.name = name;
+}
+
+size_t CpuProfiler::threadNum() const
+{
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    return threads.size();
+}
+
+std::vector<CpuEvent> CpuProfiler::collect(uint32_t threadIndex, uint32_t firstFrame, uint32_t lastFrame) const
+{
+    const ThreadBuffer* buffer;
+    {
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        if (threadIndex >= threads.size())
+            return std::vector<CpuEvent>();
+        buffer = threads[threadIndex].get();
+    }
+    uint64_t end = buffer->count.load(std::memory_order_acquire);
+    uint64_t begin = end > kEventsPerThread ? end - kEventsPerThread : 0;
+    std::vector<CpuEvent> copy;
+    copy.reserve((size_t)(end - begin));
+    for (uint64_t i = begin; i < end; i++)
+        copy.push_back(buffer->events[i & (kEventsPerThread - 1)]);
+
+    // anything the owner wrapped around onto while we copied may be torn
+    uint64_t after = buffer->count.load(std::memory_order_acquire);
+    uint64_t valid = after > kEventsPerThread ? after - kEventsPerThread : 0;
+    size_t skip = valid > begin ? (size_t)std::min<uint64_t>(valid - begin, copy.size()) : 0;
+
+    std::vector<CpuEvent> events;
+    events.reserve(copy.size() - skip);
+    for (size_t i = skip; i < copy.size(); i++)
+        if (copy[i].frame >= firstFrame && copy[i].frame <= lastFrame)
+            events.push_back(copy[i]);
+    return events;
+}
+
+bool CpuProfiler::writeChromeTrace(const char* filename, uint32_t firstFrame, uint32_t lastFrame) const
+{
+    FILE* f = fopen(filename, "w");
+    if (!f)
+    {
+        printf("ERROR: Cannot write trace \"%s\".\n", filename);
+        return false;
+    }
+    double scale = 1.0 / ticksPerMicrosecond();
+    size_t threadCount = threadNum();
+    bool first = true;
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (uint32_t t = 0; t < threadCount; t++)
+    {
+        std::string name;
+        {
+            std::lock_guard<std::mutex> lock(threadsMutex);
+            name = threads[t]->name;
+        }
+        fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", first ? "" : ",\n", t);
+        writeEscaped(f, name.c_str());
+        fprintf(f, "\"}}");
+        first = false;
+
+        // parents end after their children, sort by begin so viewers nest them without guessing
+        std::vector<CpuEvent> events = collect(t, firstFrame, lastFrame);
+        std::sort(events.begin(), events.end(), [](const CpuEvent& a, const CpuEvent& b) {
+            return a.begin != b.begin ? a.begin < b.begin : a.depth < b.depth;
+        });
+        for (const CpuEvent& e : events)
+        {
+            fprintf(f, ",\n{\"name\":\"");
+            writeEscaped(f, e.name);
+            fprintf(f, "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%u}}",
+                t, (int64_t)(e.begin - startTicks) * scale, (e.end - e.begin) * scale, e.frame);
+        }
+    }
+    fprintf(f, "\n]}\n");
+    bool ok = !ferror(f);
+    fclose(f);
+    if (!ok)
+        printf("ERROR: Failed writing trace \"%s\".\n", filename);
+    return ok;
+}
@@ -0,0 +1,187 @@
+#include "gpuProfiler.h"
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdio>
+
+GpuProfiler::GpuProfiler(int latencyFrames, int historyFrames)
+    : history(std::max(historyFrames, 1)), frames(std::max(latencyFrames, 2))
+{
+}
+
+GpuProfiler::~GpuProfiler()
+{
+    for (Frame& f : frames)
+        if (!f.queries.empty())
+            glDeleteQueries((GLsizei)f.queries.size(), f.queries.data());
+}
+
+bool GpuProfiler::init()
+{
+    supported = GLAD_GL_VERSION_3_3 != 0;
+    if (!supported)
+        std::printf("WARNING: GL_TIMESTAMP queries need GL 3.3, GPU profiling disabled.\n");
+    enabled = supported;
+    return supported;
+}
+
+size_t GpuProfiler::nextQuery(Frame& frame)
+{
+    if (frame.queryNum == frame.queries.size())
+    {
+        // grow in blocks; a frame keeps its queries for reuse once it has been resolved
+        size_t grow = std::max<size_t>(frame.queries.size(), 16);
+        frame.queries.resize(frame.queries.size() + grow);
+        glGenQueries((GLsizei)grow, frame.queries.data() + frame.queryNum);
+    }
+    return frame.queryNum++;
+}
+
+void GpuProfiler::push(const char* name)
+{
+    if (!enabled)
+        return;
+    Frame& frame = frames[current];
+    Scope scope;
+    scope.name = name;
+    scope.parent = open.empty() ? -1 : open.back();
+    scope.begin = nextQuery(frame);
+    scope.end = scope.begin;
+    glQueryCounter(frame.queries[scope.begin], GL_TIMESTAMP);
+    open.push_back((int)frame.scopes.size());
+    frame.scopes.push_back(scope);
+}
+
+void GpuProfiler::pop()
+{
+    if (!enabled || open.empty())
+        return;
+    Frame& frame = frames[current];
+    Scope& scope = frame.scopes[open.back()];
+    scope.end = nextQuery(frame);
+    glQueryCounter(frame.queries[scope.end], GL_TIMESTAMP);
+    open.pop_back();
+}
+
+void GpuProfiler::beginFrame()
+{
+    if (!enabled)
+        return;
+    // resolve every older frame that is ready, oldest first: the one about to be reused
+    // gets its last chance before it is dropped
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        Frame& f = frames[(current + i) % frames.size()];
+        if (f.pending && resolve(f))
+            f.pending = false;
+    }
+    Frame& frame = frames[current];
+    if (frame.pending)
+    {
+        // still in flight after a full ring: give up on it instead of stalling
+        frame.pending = false;
+        droppedNum++;
+    }
+    frame.scopes.clear();
+    frame.queryNum = 0;
+    open.clear();
+    push("frame");
+}
+
+void GpuProfiler::endFrame()
+{
+    if (!enabled)
+        return;
+    while (!open.empty())
+        pop();
+    frames[current].pending = true;
+    current = (current + 1) % frames.size();
+}
+
+bool GpuProfiler::resolve(Frame& frame)
+{
+    if (frame.scopes.empty())
+        return true;
+    // timestamps complete in order, so the last query of the frame stands for all of them
+    GLint available = 0;
+    glGetQueryObjectiv(frame.queries[frame.queryNum - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+        return false;
+
+    timestamps.resize(frame.queryNum);
+    for (size_t i = 0; i < frame.queryNum; i++)
+    {
+        GLuint64 t = 0;
+        glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &t);
+        timestamps[i] = t;
+    }
+    frameStats.resize(frame.scopes.size());
+    for (size_t s = 0; s < frame.scopes.size(); s++)
+    {
+        const Scope& scope = frame.scopes[s];
+        std::string path = scope.parent < 0 ? scope.name : stats[frameStats[scope.parent]].path + "/" + scope.name;
+        auto it = statIndex.find(path);
+        if (it == statIndex.end())
+        {
+            ScopeStats st = { path, scope.name, scope.parent < 0 ? 0 : stats[frameStats[scope.parent]].depth + 1, 0, 0, 0, 0, 0 };
+            // keep parents before children: insert after the parent's last descendant
+            size_t at = stats.size();
+            if (scope.parent >= 0)
+            {
+                size_t p = frameStats[scope.parent];
+                at = p + 1;
+                while (at < stats.size() && stats[at].depth > stats[p].depth)
+                    at++;
+            }
+            stats.insert(stats.begin() + at, st);
+            samples.insert(samples.begin() + at, std::vector<float>());
+            for (auto& kv : statIndex)
+                if (kv.second >= at)
+                    kv.second++;
+            for (size_t k = 0; k < s; k++)
+                if (frameStats[k] >= at)
+                    frameStats[k]++;
+            it = statIndex.emplace(path, at).first;
+        }
+        frameStats[s] = it->second;
+        addSample(it->second, (float)((timestamps[scope.end] - timestamps[scope.begin]) * 1e-6));
+    }
+    resolvedNum++;
+    return true;
+}
+
+void GpuProfiler::addSample(size_t stat, float ms)
+{
+    ScopeStats& st = stats[stat];
+    std::vector<float>& ring = samples[stat];
+    if (ring.size() < (size_t)history)
+        ring.push_back(ms);
+    else
+        ring[st.sampleNum % history] = ms;
+    st.sampleNum++;
+    st.lastMs = ms;
+    st.minMs = st.maxMs = ms;
+    float sum = 0.0f;
+    for (float v : ring)
+    {
+        st.minMs = std::min(st.minMs, v);
+        st.maxMs = std::max(st.maxMs, v);
+        sum += v;
+    }
+    st.avgMs = sum / ring.size();
+}
+
+const GpuProfiler::ScopeStats* GpuProfiler::find(const std::string& path) const
+{
+    auto it = statIndex.find(path);
+    return it == statIndex.end() ? nullptr : &stats[it->second];
+}
+
+void GpuProfiler::print() const
+{
+    std::printf("GPU profile (%llu frames resolved, %llu dropped)\n",
+        (unsigned long long)resolvedNum, (unsigned long long)droppedNum);
+    std::printf("  %-32s %9s %9s %9s\n", "scope", "min ms", "avg ms", "max ms");
+    for (const ScopeStats& st : stats)
+        std::printf("  %*s%-*s %9.3f %9.3f %9.3f\n", st.depth * 2, "", 32 - st.depth * 2, st.name, st.minMs, st.avgMs, st.maxMs);
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// GPU pass timing with GL_TIMESTAMP queries (core since GL 3.3).
+// Every scope writes a timestamp when it opens and one when it closes, so scopes nest freely
+// (GL_TIME_ELAPSED queries cannot). Queries of a frame are only read back 'latency' frames later
+// and only if the GPU already finished them; a frame whose results are still pending when its
+// queries are needed again is dropped rather than waited for. The hot path is two
+// glQueryCounter calls per scope, cheap enough to leave enabled.
+//
+//     profiler.beginFrame();
+//     { GpuScope s(profiler, "shadows"); ... }
+//     { GpuScope s(profiler, "opaque"); ... }
+//     profiler.endFrame();
+//
+// Scope names must outlive the profiler (string literals).
+class GpuProfiler
+{
+public:
+    struct ScopeStats
+    {
+        std::string path;       // "frame/opaque"
+        const char* name;
+        int depth;
+        float lastMs, minMs, avgMs, maxMs;
+        unsigned sampleNum;
+    };
+
+    explicit GpuProfiler(int latencyFrames = 4, int historyFrames = 64);
+    ~GpuProfiler();
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    // needs a current context; returns false (and stays disabled) without timer query support
+    bool init();
+    void setEnabled(bool enable) { enabled = enable && supported; }
+    bool isEnabled() const { return enabled; }
+
+    // beginFrame() opens a root "frame" scope and collects finished older frames
+    void beginFrame();
+    void endFrame();
+
+    void push(const char* name);
+    void pop();
+
+    // stats over the last historyFrames resolved frames, parents before children
+    const std::vector<ScopeStats>& results() const { return stats; }
+    const ScopeStats* find(const std::string& path) const;
+    uint64_t resolvedFrames() const { return resolvedNum; }
+    uint64_t droppedFrames() const { return droppedNum; }
+
+    void print() const;
+
+private:
+    struct Scope
+    {
+        const char* name;
+        int parent;         // index in the frame's scope list, -1 for roots
+        size_t begin, end;      // indices into the frame's queries
+    };
+
+    struct Frame
+    {
+        std::vector<Scope> scopes;
+        std::vector<unsigned> queries;
+        size_t queryNum = 0;
+        bool pending = false;
+    };
+
+    size_t nextQuery(Frame& frame);
+    bool resolve(Frame& frame);
+    void addSample(size_t stat, float ms);
+
+    bool supported = false;
+    bool enabled = false;
+    int history;
+    std::vector<Frame> frames;
+    size_t current = 0;
+    std::vector<int> open;      // scope stack of the current frame
+
+    std::vector<ScopeStats> stats;
+    std::vector<std::vector<float>> samples;    // ring of the last 'history' values per stat
+    std::unordered_map<std::string, size_t> statIndex;
+    std::vector<uint64_t> timestamps;
+    std::vector<size_t> frameStats;
+    uint64_t resolvedNum = 0;
+    uint64_t droppedNum = 0;
+};
+
+class GpuScope
+{
+public:
+    GpuScope(GpuProfiler& p, const char* name) : profiler(p) { profiler.push(name); }
+    ~GpuScope() { profiler.pop(); }
+    GpuScope(const GpuScope&) = delete;
+    GpuScope& operator=(const GpuScope&) = delete;
+
+private:
+    GpuProfiler& profiler;
+};
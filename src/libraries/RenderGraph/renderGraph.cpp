@@ -0,0 +1,610 @@
+#include "renderGraph.h"
+
+#include <gpuProfiler.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+
+namespace
+{
+    const int kMaxColors = 8;
+
+    bool contains(const vector<int>& v, int x)
+    {
+        return find(v.begin(), v.end(), x) != v.end();
+    }
+
+    bool sameDesc(const TargetDesc& a, const TargetDesc& b)
+    {
+        return a.format == b.format && a.width == b.width && a.height == b.height && a.scale == b.scale &&
+            max(a.samples, 1) == max(b.samples, 1);
+    }
+
+    void describe(const TargetDesc& desc, char* text, size_t size)
+    {
+        int n = desc.scale > 0.0f ? snprintf(text, size, "%s %gx screen", TargetPool::formatName(desc.format), desc.scale) :
+            snprintf(text, size, "%s %dx%d", TargetPool::formatName(desc.format), desc.width, desc.height);
+        if (desc.samples > 1 && n > 0 && (size_t)n < size)
+            snprintf(text + n, size - n, " x%d", desc.samples);
+    }
+}
+
+//------- declaration -------
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::read(Resource resource)
+{
+    graph.passes[pass].reads.push_back(resource);
+    graph.isCompiled = false;
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::write(Resource resource)
+{
+    graph.passes[pass].writes.push_back(resource);
+    graph.isCompiled = false;
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::depth(Resource resource)
+{
+    graph.passes[pass].depth = resource;
+    graph.isCompiled = false;
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::clear(float r, float g, float b, float a)
+{
+    PassNode& p = graph.passes[pass];
+    p.clears = true;
+    p.clearColor[0] = r;
+    p.clearColor[1] = g;
+    p.clearColor[2] = b;
+    p.clearColor[3] = a;
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::sideEffect()
+{
+    graph.passes[pass].sideEffect = true;
+    graph.isCompiled = false;
+    return *this;
+}
+
+RenderGraph::Resource RenderGraph::createTarget(const char* name, const TargetDesc& desc)
+{
+    resources.push_back({ name, desc, false, -1, -1, -1, 0 });
+    isCompiled = false;
+    return (Resource)resources.size() - 1;
+}
+
+RenderGraph::Resource RenderGraph::importBackbuffer(const char* name)
+{
+    resources.push_back({ name, TargetDesc::screen(GL_RGBA8), true, -1, -1, -1, 0 });
+    isCompiled = false;
+    return (Resource)resources.size() - 1;
+}
+
+RenderGraph::PassBuilder RenderGraph::addPass(const char* name, Execute execute)
+{
+    PassNode p = {};
+    p.name = name;
+    p.execute = move(execute);
+    p.depth = -1;
+    p.group = -1;
+    passes.push_back(move(p));
+    isCompiled = false;
+    return PassBuilder(*this, (int)passes.size() - 1);
+}
+
+void RenderGraph::clear()
+{
+    resources.clear();
+    passes.clear();
+    order.clear();
+    groups.clear();
+    isCompiled = false;
+}
+
+//------- compilation -------
+bool RenderGraph::writesBackbuffer(int pass) const
+{
+    const PassNode& p = passes[pass];
+    return (!p.writes.empty() && resources[p.writes[0]].imported) || (p.depth >= 0 && resources[p.depth].imported);
+}
+
+bool RenderGraph::sameAttachments(int a, int b) const
+{
+    return passes[a].writes == passes[b].writes && passes[a].depth == passes[b].depth;
+}
+
+// does 'pass' sample what 'attachmentsOf' renders to
+bool RenderGraph::samples(int pass, int attachmentsOf) const
+{
+    const PassNode& p = passes[pass];
+    const PassNode& a = passes[attachmentsOf];
+    for (Resource r : p.reads)
+        if (contains(a.writes, r) || r == a.depth)
+            return true;
+    return false;
+}
+
+bool RenderGraph::compile()
+{
+    isCompiled = false;
+    order.clear();
+    groups.clear();
+    int passCount = (int)passes.size();
+    int resourceCount = (int)resources.size();
+
+    for (const PassNode& p : passes)
+    {
+        bool backbuffer = false, targets = false;
+        for (Resource r : p.writes)
+            (resources[r].imported ? backbuffer : targets) = true;
+        if (p.depth >= 0)
+            (resources[p.depth].imported ? backbuffer : targets) = true;
+        if (backbuffer && (targets || p.writes.size() > 1))
+        {
+            printf("ERROR: Pass \"%s\" writes the backbuffer together with other attachments.\n", p.name);
+            return false;
+        }
+        if (p.writes.size() > kMaxColors)
+        {
+            printf("ERROR: Pass \"%s\" writes %d color attachments, at most %d.\n", p.name, (int)p.writes.size(), kMaxColors);
+            return false;
+        }
+        for (Resource r : p.reads)
+        {
+            if (resources[r].imported)
+            {
+                printf("ERROR: Pass \"%s\" samples the backbuffer \"%s\".\n", p.name, resources[r].name);
+                return false;
+            }
+            if (contains(p.writes, r) || r == p.depth)
+            {
+                printf("ERROR: Pass \"%s\" samples \"%s\" while rendering to it.\n", p.name, resources[r].name);
+                return false;
+            }
+        }
+    }
+
+    // culling: an attachment is needed while it is the backbuffer, a live pass samples it or a
+    // live pass declared later loads it by drawing onto it without a clear; a pass none of whose
+    // attachments are needed is culled, which releases what it samples and loads in turn
+    auto attachment = [&](int pass, int a) {
+        const PassNode& p = passes[pass];
+        return a < (int)p.writes.size() ? p.writes[a] : p.depth;
+    };
+    auto attachmentNum = [&](int pass) {
+        return (int)passes[pass].writes.size() + (passes[pass].depth >= 0 ? 1 : 0);
+    };
+    auto loads = [&](int pass, Resource r) {
+        const PassNode& p = passes[pass];
+        return !p.clears && (contains(p.writes, r) || p.depth == r);
+    };
+    vector<vector<int>> consumers(passCount);
+    vector<int> references(passCount, 0), pending;
+    for (int i = 0; i < passCount; i++)
+    {
+        passes[i].culled = false;
+        passes[i].group = -1;
+        consumers[i].assign(attachmentNum(i), 0);
+    }
+    for (int i = 0; i < passCount; i++)
+    {
+        for (int a = 0; a < attachmentNum(i); a++)
+        {
+            Resource r = attachment(i, a);
+            int& n = consumers[i][a];
+            if (resources[r].imported)
+                n = 1;
+            else
+                for (int j = 0; j < passCount; j++)
+                    n += (int)count(passes[j].reads.begin(), passes[j].reads.end(), r) + (j > i && loads(j, r) ? 1 : 0);
+            if (n)
+                references[i]++;
+        }
+        if (!references[i] && !passes[i].sideEffect)
+        {
+            passes[i].culled = true;
+            pending.push_back(i);
+        }
+    }
+    // one consumer of 'r' is gone, for the writers declared before 'writersBefore'
+    auto release = [&](Resource r, int writersBefore) {
+        if (resources[r].imported)
+            return;
+        for (int i = 0; i < writersBefore; i++)
+        {
+            for (int a = 0; a < attachmentNum(i); a++)
+            {
+                if (attachment(i, a) != r || --consumers[i][a] || --references[i])
+                    continue;
+                if (!passes[i].culled && !passes[i].sideEffect)
+                {
+                    passes[i].culled = true;
+                    pending.push_back(i);
+                }
+            }
+        }
+    };
+    while (!pending.empty())
+    {
+        int pass = pending.back();
+        pending.pop_back();
+        for (Resource r : passes[pass].reads)
+            release(r, passCount);
+        if (!passes[pass].clears)
+            for (int a = 0; a < attachmentNum(pass); a++)
+                release(attachment(pass, a), pass);
+    }
+
+    // dependencies: one writer goes before all readers wherever they are declared, with several
+    // writers the declaration order tells which version a reader sees
+    vector<vector<int>> next(passCount);
+    vector<int> indegree(passCount, 0);
+    auto depend = [&](int before, int after) {
+        if (before != after && !contains(next[before], after))
+        {
+            next[before].push_back(after);
+            indegree[after]++;
+        }
+    };
+    for (Resource r = 0; r < resourceCount; r++)
+    {
+        vector<int> writers;
+        for (int i = 0; i < passCount; i++)
+            if (!passes[i].culled && (contains(passes[i].writes, r) || passes[i].depth == r))
+                writers.push_back(i);
+        int lastWriter = -1;
+        vector<int> readersSince;
+        for (int i = 0; i < passCount; i++)
+        {
+            const PassNode& p = passes[i];
+            if (p.culled)
+                continue;
+            if (contains(p.reads, r))
+            {
+                if (writers.empty())
+                {
+                    printf("ERROR: Pass \"%s\" reads \"%s\", which no pass writes.\n", p.name, resources[r].name);
+                    return false;
+                }
+                if (writers.size() == 1)
+                    depend(writers[0], i);
+                else if (lastWriter < 0)
+                {
+                    printf("ERROR: Pass \"%s\" reads \"%s\" before any of its writers.\n", p.name, resources[r].name);
+                    return false;
+                }
+                else
+                    depend(lastWriter, i);
+                readersSince.push_back(i);
+            }
+            if (writers.size() > 1 && (contains(p.writes, r) || p.depth == r))
+            {
+                if (lastWriter >= 0)
+                    depend(lastWriter, i);
+                for (int reader : readersSince)
+                    depend(reader, i);
+                readersSince.clear();
+                lastWriter = i;
+            }
+        }
+    }
+
+    // topological order, keeping passes with the same attachments together
+    vector<int> ready;
+    int executed = 0;
+    for (int i = 0; i < passCount; i++)
+    {
+        if (passes[i].culled)
+            continue;
+        executed++;
+        if (!indegree[i])
+            ready.push_back(i);
+    }
+    while (!ready.empty())
+    {
+        size_t pick = 0;
+        for (size_t k = 0; k < ready.size(); k++)
+        {
+            if (ready[k] < ready[pick])
+                pick = k;
+        }
+        if (!order.empty())
+        {
+            int previous = order.back();
+            for (size_t k = 0; k < ready.size(); k++)
+            {
+                bool merges = sameAttachments(ready[k], previous) && !samples(ready[k], previous);
+                bool pickMerges = sameAttachments(ready[pick], previous) && !samples(ready[pick], previous);
+                if (merges && (!pickMerges || ready[k] < ready[pick]))
+                    pick = k;
+            }
+        }
+        int pass = ready[pick];
+        ready.erase(ready.begin() + pick);
+        order.push_back(pass);
+        for (int n : next[pass])
+            if (--indegree[n] == 0)
+                ready.push_back(n);
+    }
+    if ((int)order.size() != executed)
+    {
+        printf("ERROR: Render graph has a cycle between its passes:");
+        for (int i = 0; i < passCount; i++)
+            if (!passes[i].culled && indegree[i])
+                printf(" \"%s\"", passes[i].name);
+        printf("\n");
+        order.clear();
+        return false;
+    }
+
+    // groups of passes sharing one framebuffer
+    for (int k = 0; k < (int)order.size(); k++)
+    {
+        int pass = order[k];
+        if (k == 0 || !sameAttachments(pass, order[k - 1]) || samples(pass, order[k - 1]))
+            groups.push_back({ k, 0, {}, {} });
+        groups.back().count++;
+        passes[pass].group = (int)groups.size() - 1;
+    }
+
+    // lifetimes in execution order
+    for (ResourceNode& r : resources)
+    {
+        r.first = r.last = r.slot = -1;
+        r.texture = 0;
+    }
+    for (int k = 0; k < (int)order.size(); k++)
+    {
+        const PassNode& p = passes[order[k]];
+        auto use = [&](Resource r) {
+            if (resources[r].first < 0)
+                resources[r].first = k;
+            resources[r].last = k;
+        };
+        for (Resource r : p.reads)
+            use(r);
+        for (Resource r : p.writes)
+            use(r);
+        if (p.depth >= 0)
+            use(p.depth);
+    }
+    for (Group& g : groups)
+    {
+        for (Resource r = 0; r < resourceCount; r++)
+        {
+            const ResourceNode& node = resources[r];
+            if (node.imported || node.first < 0)
+                continue;
+            if (node.first >= g.first && node.first < g.first + g.count)
+                g.acquires.push_back(r);
+            if (node.last >= g.first && node.last < g.first + g.count)
+                g.releases.push_back(r);
+        }
+    }
+
+    // the textures the pool will share, for print(): it hands out the first free one that matches
+    vector<TargetDesc> slotDescs;
+    vector<bool> slotUsed;
+    for (const Group& g : groups)
+    {
+        for (Resource r : g.acquires)
+        {
+            size_t slot = 0;
+            while (slot < slotDescs.size() && (slotUsed[slot] || !sameDesc(slotDescs[slot], resources[r].desc)))
+                slot++;
+            if (slot == slotDescs.size())
+            {
+                slotDescs.push_back(resources[r].desc);
+                slotUsed.push_back(false);
+            }
+            slotUsed[slot] = true;
+            resources[r].slot = (int)slot;
+        }
+        for (Resource r : g.releases)
+            slotUsed[resources[r].slot] = false;
+    }
+    isCompiled = true;
+    return true;
+}
+
+//------- execution -------
+void RenderGraph::bindGroup(const Group& group, TargetPool& pool) const
+{
+    int pass = order[group.first];
+    const PassNode& p = passes[pass];
+    if (writesBackbuffer(pass))
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, pool.screenWidth(), pool.screenHeight());
+        return;
+    }
+    if (p.writes.empty() && p.depth < 0)
+        return;
+    unsigned int colors[kMaxColors];
+    for (size_t i = 0; i < p.writes.size(); i++)
+        colors[i] = resources[p.writes[i]].texture;
+    pool.bindFramebuffer(colors, (int)p.writes.size(), p.depth >= 0 ? resources[p.depth].texture : 0);
+}
+
+void RenderGraph::execute(TargetPool& pool, GpuProfiler* gpuProfiler)
+{
+    if (!isCompiled && !compile())
+        return;
+    lastPool = &pool;
+    for (const Group& g : groups)
+    {
+        for (Resource r : g.acquires)
+            resources[r].texture = pool.acquire(resources[r].desc);
+        bindGroup(g, pool);
+        for (int k = g.first; k < g.first + g.count; k++)
+        {
+            PassNode& p = passes[order[k]];
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            if (gpuProfiler)
+                gpuProfiler->push(p.name);
+            if (p.clears)
+            {
+                glClearColor(p.clearColor[0], p.clearColor[1], p.clearColor[2], p.clearColor[3]);
+                bool depth = p.depth >= 0 || writesBackbuffer(order[k]);
+                glClear(GL_COLOR_BUFFER_BIT | (depth ? GL_DEPTH_BUFFER_BIT : 0));
+            }
+            p.execute(*this);
+            if (gpuProfiler)
+                gpuProfiler->pop();
+            double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            PassTiming& t = p.timing;
+            t.frames++;
+            t.lastMs = ms;
+            t.avgMs += (ms - t.avgMs) / t.frames;
+            t.maxMs = max(t.maxMs, ms);
+        }
+        for (Resource r : g.releases)
+        {
+            pool.release(resources[r].texture);
+            resources[r].texture = 0;
+        }
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+int RenderGraph::width(Resource resource) const
+{
+    if (!lastPool)
+        return 0;
+    return resources[resource].imported ? lastPool->screenWidth() : lastPool->width(resources[resource].texture);
+}
+
+int RenderGraph::height(Resource resource) const
+{
+    if (!lastPool)
+        return 0;
+    return resources[resource].imported ? lastPool->screenHeight() : lastPool->height(resources[resource].texture);
+}
+
+//------- reports -------
+int RenderGraph::culledNum() const
+{
+    int n = 0;
+    for (const PassNode& p : passes)
+        n += p.culled ? 1 : 0;
+    return n;
+}
+
+void RenderGraph::print() const
+{
+    if (!isCompiled)
+    {
+        printf("render graph: %d passes, not compiled\n", passNum());
+        return;
+    }
+    printf("render graph: %d passes, %d culled, %d executed in %d framebuffer binds, %d resources\n", passNum(),
+        culledNum(), executedNum(), groupNum(), (int)resources.size());
+    for (int k = 0; k < (int)order.size(); k++)
+    {
+        const PassNode& p = passes[order[k]];
+        printf("  %2d  group %-2d %-16s", k, p.group, p.name);
+        if (!p.reads.empty())
+        {
+            printf(" reads");
+            for (Resource r : p.reads)
+                printf(" %s", resources[r].name);
+        }
+        if (!p.writes.empty() || p.depth >= 0)
+        {
+            printf(" writes");
+            for (Resource r : p.writes)
+                printf(" %s", resources[r].name);
+            if (p.depth >= 0)
+                printf(" %s(depth)", resources[p.depth].name);
+        }
+        printf("%s%s\n", p.clears ? ", clears" : "", p.sideEffect ? ", side effect" : "");
+    }
+    for (const PassNode& p : passes)
+        if (p.culled)
+            printf("  --  culled   %s\n", p.name);
+    for (const ResourceNode& r : resources)
+    {
+        char desc[64];
+        describe(r.desc, desc, sizeof(desc));
+        if (r.imported)
+            printf("  %-16s imported\n", r.name);
+        else if (r.first < 0)
+            printf("  %-16s %-24s unused\n", r.name, desc);
+        else
+            printf("  %-16s %-24s passes %d..%d, texture %d\n", r.name, desc, r.first, r.last, r.slot);
+    }
+}
+
+void RenderGraph::printTimings(const GpuProfiler* gpuProfiler) const
+{
+    printf("  %-16s %10s %10s %10s %10s\n", "pass", "cpu ms", "avg", "max", "gpu avg");
+    for (int pass : order)
+    {
+        const PassNode& p = passes[pass];
+        const PassTiming& t = p.timing;
+        printf("  %-16s %10.3f %10.3f %10.3f", p.name, t.lastMs, t.avgMs, t.maxMs);
+        const GpuProfiler::ScopeStats* gpu = nullptr;
+        if (gpuProfiler)
+            for (const GpuProfiler::ScopeStats& s : gpuProfiler->results())
+                if (!strcmp(s.name, p.name))
+                    gpu = &s;
+        if (gpu)
+            printf(" %10.3f", gpu->avgMs);
+        printf("\n");
+    }
+}
+
+bool RenderGraph::writeDot(const char* filename) const
+{
+    FILE* f = fopen(filename, "w");
+    if (!f)
+    {
+        printf("ERROR: Cannot write render graph \"%s\".\n", filename);
+        return false;
+    }
+    fprintf(f, "digraph RenderGraph {\n    rankdir=LR;\n    node [fontname=\"Helvetica\", fontsize=10];\n");
+    for (int i = 0; i < (int)passes.size(); i++)
+    {
+        const PassNode& p = passes[i];
+        if (p.culled || !isCompiled)
+            fprintf(f, "    p%d [shape=box, style=dashed, color=gray, label=\"%s\\nculled\"];\n", i, p.name);
+        else
+        {
+            int k = (int)(find(order.begin(), order.end(), i) - order.begin());
+            fprintf(f, "    p%d [shape=box, style=filled, fillcolor=\"/pastel19/%d\", label=\"%s\\n#%d group %d\"];\n", i,
+                p.group % 9 + 1, p.name, k, p.group);
+        }
+    }
+    for (int i = 0; i < (int)resources.size(); i++)
+    {
+        const ResourceNode& r = resources[i];
+        char desc[64];
+        describe(r.desc, desc, sizeof(desc));
+        if (r.imported)
+            fprintf(f, "    r%d [shape=ellipse, style=bold, label=\"%s\"];\n", i, r.name);
+        else if (r.first < 0)
+            fprintf(f, "    r%d [shape=ellipse, color=gray, label=\"%s\\n%s\"];\n", i, r.name, desc);
+        else
+            fprintf(f, "    r%d [shape=ellipse, label=\"%s\\n%s\\n%d..%d texture %d\"];\n", i, r.name, desc, r.first,
+                r.last, r.slot);
+    }
+    for (int i = 0; i < (int)passes.size(); i++)
+    {
+        const PassNode& p = passes[i];
+        for (Resource r : p.reads)
+            fprintf(f, "    r%d -> p%d;\n", r, i);
+        for (Resource r : p.writes)
+            fprintf(f, "    p%d -> r%d;\n", i, r);
+        if (p.depth >= 0)
+            fprintf(f, "    p%d -> r%d [style=dashed];\n", i, p.depth);
+    }
+    fprintf(f, "}\n");
+    fclose(f);
+    return true;
+}
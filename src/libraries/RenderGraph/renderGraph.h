@@ -0,0 +1,153 @@
+#pragma once
+
+#include <targetPool.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class GpuProfiler;
+
+// Passes that declare which targets they read and write; compile() derives everything else.
+//
+//     RenderGraph graph;
+//     RenderGraph::Resource hdr = graph.createTarget("hdr", TargetDesc::screen(GL_RGBA16F));
+//     RenderGraph::Resource depth = graph.createTarget("depth", TargetDesc::screen(GL_DEPTH24_STENCIL8));
+//     RenderGraph::Resource screen = graph.importBackbuffer("backbuffer");
+//     graph.addPass("scene", [&](const RenderGraph&) { ...draw... }).write(hdr).depth(depth).clear(0, 0, 0);
+//     graph.addPass("tonemap", [&](const RenderGraph& g) { ...g.texture(hdr)... }).read(hdr).write(screen);
+//     graph.compile();                                 // once, or after changing the passes
+//     graph.print();
+//     pool.beginFrame();                               // every frame
+//     graph.execute(pool, &gpuProfiler);
+//
+// compile():
+// - culls passes none of whose writes reach the backbuffer or a pass marked sideEffect, and
+//   then the passes only they read from, until nothing changes. A pass that draws onto a
+//   target without clear() loads it, so the passes declared before it that write the target
+//   are kept: a depth prepass stays for the scene that depth tests against it;
+// - orders the rest topologically: the writer of a target before its readers, wherever they
+//   are declared; with several writers (a clear, then draws on top) declaration order tells
+//   which of them a reader follows. Among the passes that are ready, one with the attachments
+//   of the previous pass goes first, then declaration order;
+// - gives every target the lifetime from its first to its last pass: execute() acquires it
+//   from the TargetPool before the first and releases it after the last, so targets whose
+//   lifetimes do not overlap share textures;
+// - merges runs of passes with the same attachments that do not sample them into one group
+//   with one framebuffer bind.
+// execute() does no allocation once the pool holds its textures. Every pass is timed on the
+// CPU, and with a GpuProfiler on the GPU inside the caller's open scope.
+// Pass and target names must be string literals or otherwise outlive the graph and the profilers.
+class RenderGraph
+{
+public:
+    typedef int Resource;
+    typedef std::function<void(const RenderGraph&)> Execute;
+
+    struct PassTiming
+    {
+        double lastMs, avgMs, maxMs;    // CPU, execute callback and clears
+        uint64_t frames;
+    };
+
+    class PassBuilder
+    {
+    public:
+        // sampled by the pass
+        PassBuilder& read(Resource resource);
+        // the next color attachment
+        PassBuilder& write(Resource resource);
+        PassBuilder& depth(Resource resource);
+        // clears color and depth before the pass; without it the pass loads its attachments
+        PassBuilder& clear(float r, float g, float b, float a = 1.0f);
+        // never culled, for passes with effects outside the graph (readbacks, queries)
+        PassBuilder& sideEffect();
+
+    private:
+        friend class RenderGraph;
+        PassBuilder(RenderGraph& g, int p) : graph(g), pass(p) {}
+        RenderGraph& graph;
+        int pass;
+    };
+
+    RenderGraph() {}
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+
+    Resource createTarget(const char* name, const TargetDesc& desc);
+    // the default framebuffer, color and depth; what is written to it is the graph's output
+    Resource importBackbuffer(const char* name = "backbuffer");
+    PassBuilder addPass(const char* name, Execute execute);
+    // forgets every pass and resource
+    void clear();
+
+    bool compile();
+    bool compiled() const { return isCompiled; }
+    // binds the default framebuffer at the end
+    void execute(TargetPool& pool, GpuProfiler* gpuProfiler = nullptr);
+
+    // inside execute: the texture of a target, 0 for the backbuffer
+    unsigned int texture(Resource resource) const { return resources[resource].texture; }
+    int width(Resource resource) const;
+    int height(Resource resource) const;
+
+    // passes in execution order with their groups, lifetimes and the texture they would share
+    void print() const;
+    // CPU times per pass, GPU times from the profiler the passes were timed with
+    void printTimings(const GpuProfiler* gpuProfiler = nullptr) const;
+    // Graphviz: passes as boxes (culled ones dashed), targets as ellipses
+    bool writeDot(const char* filename) const;
+
+    int passNum() const { return (int)passes.size(); }
+    int culledNum() const;
+    // framebuffer binds per frame, and what they would be without merging
+    int groupNum() const { return (int)groups.size(); }
+    int executedNum() const { return (int)order.size(); }
+    // execution order by declaration index
+    const std::vector<int>& executionOrder() const { return order; }
+    const PassTiming& timing(int pass) const { return passes[pass].timing; }
+
+private:
+    struct ResourceNode
+    {
+        const char* name;
+        TargetDesc desc;
+        bool imported;
+        int first, last;            // in execution order, -1 if unused
+        int slot;                   // shared texture, by simulating the pool
+        unsigned int texture;
+    };
+
+    struct PassNode
+    {
+        const char* name;
+        Execute execute;
+        std::vector<Resource> reads;
+        std::vector<Resource> writes;
+        Resource depth;
+        bool clears;
+        float clearColor[4];
+        bool sideEffect;
+        bool culled;
+        int group;
+        PassTiming timing;
+    };
+
+    struct Group
+    {
+        int first, count;           // range of order
+        std::vector<Resource> acquires;     // before the group
+        std::vector<Resource> releases;     // after it
+    };
+
+    bool sameAttachments(int a, int b) const;
+    bool samples(int pass, int attachmentsOf) const;
+    bool writesBackbuffer(int pass) const;
+    void bindGroup(const Group& group, TargetPool& pool) const;
+
+    std::vector<ResourceNode> resources;
+    std::vector<PassNode> passes;
+    std::vector<int> order;
+    std::vector<Group> groups;
+    bool isCompiled = false;
+    const TargetPool* lastPool = nullptr;
+};
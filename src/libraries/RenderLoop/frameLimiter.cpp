@@ -0,0 +1,86 @@
+#include "frameLimiter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <timeapi.h>
+#endif
+
+namespace
+{
+    void raiseTimerResolution()
+    {
+#ifdef _WIN32
+        // default Windows sleep granularity is 15.6 ms, far too coarse for frame pacing
+        static bool raised = timeBeginPeriod(1) == TIMERR_NOERROR;
+        (void)raised;
+#endif
+    }
+}
+
+FrameLimiter::FrameLimiter(double targetFps)
+{
+    raiseTimerResolution();
+    setTarget(targetFps);
+}
+
+void FrameLimiter::setTarget(double targetFps)
+{
+    fps = targetFps;
+    period = fps > 0.0 ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / fps)) : Clock::duration::zero();
+    started = false;
+}
+
+void FrameLimiter::wait()
+{
+    if (fps <= 0.0)
+        return;
+    Clock::time_point now = Clock::now();
+    if (!started)
+    {
+        next = now + period;
+        started = true;
+        return;
+    }
+    if (now < next)
+    {
+        waitUntil(next);
+        next += period;
+    }
+    else
+    {
+        next = now + period;
+    }
+}
+
+void FrameLimiter::waitUntil(Clock::time_point deadline)
+{
+    const std::chrono::microseconds slice(1000);
+    for (;;)
+    {
+        Clock::time_point now = Clock::now();
+        double remaining = std::chrono::duration<double>(deadline - now).count();
+        if (remaining <= overshoot)
+            break;
+        std::this_thread::sleep_for(slice);
+        // smoothed mean and deviation of the oversleep, spin margin is mean + 2 sigma.
+        // Preemptions are clamped so a single long stall does not turn the limiter into a spin loop.
+        double late = std::chrono::duration<double>(Clock::now() - now).count() - 0.001;
+        late = std::min(std::max(late, 0.0), 0.004);
+        double delta = late - lateMean;
+        lateMean += delta * 0.05;
+        lateVariance = (lateVariance + delta * delta * 0.05) * 0.95;
+        overshoot = std::min(std::max(lateMean + 2.0 * std::sqrt(lateVariance), 0.0002), 0.008);
+    }
+    while (Clock::now() < deadline)
+        ;
+}
+
+void FrameLimiter::sleepUntil(Clock::time_point deadline)
+{
+    std::this_thread::sleep_until(deadline);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+
+// Precise frame rate cap.
+// The OS sleep is only accurate to about a scheduler quantum, so wait() sleeps in short
+// slices until the remaining time is below the measured sleep overshoot and spins the rest.
+class FrameLimiter
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    explicit FrameLimiter(double targetFps = 0.0);
+
+    // 0 disables the cap
+    void setTarget(double fps);
+    double target() const { return fps; }
+
+    // block until the next frame slot. A frame that ran late restarts the schedule
+    // instead of rushing the following frames to catch up.
+    void wait();
+
+    // hybrid sleep/spin wait, usable on its own
+    void waitUntil(Clock::time_point deadline);
+
+    // current estimate of how late a 1 ms sleep returns, in seconds
+    double sleepOvershoot() const { return overshoot; }
+
+    // plain OS sleep to the deadline, kept for comparison in benchmarks
+    static void sleepUntil(Clock::time_point deadline);
+
+private:
+    double fps = 0.0;
+    Clock::duration period = Clock::duration::zero();
+    Clock::time_point next;
+    bool started = false;
+    double overshoot = 0.002;
+    double lateMean = 0.001;
+    double lateVariance = 0.0;
+};
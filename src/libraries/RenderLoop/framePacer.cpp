@@ -0,0 +1,160 @@
+#include "framePacer.h"
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    const size_t kMaxInFlight = 8;
+    const double kLateSampleMargin = 0.002;     // keep this much slack before the refresh deadline
+}
+
+const char* pacingModeName(PacingMode mode)
+{
+    switch (mode)
+    {
+    case PacingMode::VSync: return "vsync";
+    case PacingMode::Adaptive: return "adaptive";
+    case PacingMode::Uncapped: return "uncapped";
+    case PacingMode::LowLatency: return "lowlatency";
+    }
+    return "unknown";
+}
+
+bool parsePacingMode(const char* name, PacingMode& mode)
+{
+    const PacingMode modes[] = { PacingMode::VSync, PacingMode::Adaptive, PacingMode::Uncapped, PacingMode::LowLatency };
+    for (PacingMode m : modes)
+    {
+        if (!strcmp(name, pacingModeName(m)))
+        {
+            mode = m;
+            return true;
+        }
+    }
+    return false;
+}
+
+int pacingSwapInterval(PacingMode mode)
+{
+    switch (mode)
+    {
+    case PacingMode::Adaptive: return -1;
+    case PacingMode::Uncapped: return 0;
+    default: return 1;
+    }
+}
+
+FramePacer::FramePacer(PacingMode mode, int maxQueuedFrames, double fpsLimit)
+    : pacing(mode), maxQueued((size_t)std::max(maxQueuedFrames, 1)), limiter(fpsLimit)
+{
+    inFlight.reserve(kMaxInFlight);
+    latencies.reserve(1 << 16);
+}
+
+FramePacer::~FramePacer()
+{
+    for (InFlight& f : inFlight)
+        glDeleteSync((GLsync)f.fence);
+}
+
+void FramePacer::setRefreshRate(double hz)
+{
+    if (hz > 0.0)
+        refreshPeriod = 1.0 / hz;
+}
+
+void FramePacer::retire(size_t keep, bool block)
+{
+    size_t done = 0;
+    for (; done < inFlight.size(); done++)
+    {
+        bool mustWait = block && inFlight.size() - done > keep;
+        GLenum r = glClientWaitSync((GLsync)inFlight[done].fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+            mustWait ? 1000000000ull : 0);
+        if (r == GL_TIMEOUT_EXPIRED)
+            break;
+        latencies.push_back(std::chrono::duration<float, std::milli>(Clock::now() - inFlight[done].sampled).count());
+        glDeleteSync((GLsync)inFlight[done].fence);
+    }
+    inFlight.erase(inFlight.begin(), inFlight.begin() + done);
+}
+
+void FramePacer::beginFrame()
+{
+    if (pacing == PacingMode::LowLatency)
+    {
+        // no more than maxQueued frames between the CPU and the display
+        retire(maxQueued - 1, true);
+        // start as late as the measured frame cost allows before the next refresh
+        if (hasLastSwap && maxQueued == 1)
+        {
+            double delay = refreshPeriod - workEstimate - kLateSampleMargin;
+            if (delay > 0.0)
+                limiter.waitUntil(lastSwap + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(delay)));
+        }
+    }
+    else
+    {
+        retire(kMaxInFlight - 1, true);
+        limiter.wait();
+    }
+    frameStart = Clock::now();
+    workEnded = false;
+}
+
+void FramePacer::addWork(double work)
+{
+    // rises at once, decays slowly: a frame that overruns costs a missed refresh
+    workEstimate = workEstimate == 0.0 ? work : std::max(work, workEstimate * 0.95 + work * 0.05);
+}
+
+void FramePacer::endWork()
+{
+    addWork(std::chrono::duration<double>(Clock::now() - frameStart).count());
+    workEnded = true;
+}
+
+void FramePacer::endFrame()
+{
+    Clock::time_point now = Clock::now();
+    if (!workEnded)
+    {
+        // the swap may have blocked on vsync, so only count it when it is plausibly CPU work
+        double work = std::chrono::duration<double>(now - frameStart).count();
+        if (work < refreshPeriod)
+            addWork(work);
+    }
+    lastSwap = now;
+    hasLastSwap = true;
+    inFlight.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), frameStart });
+    retire(kMaxInFlight, false);
+}
+
+double FramePacer::meanLatencyMs() const
+{
+    if (latencies.empty())
+        return 0.0;
+    double sum = 0.0;
+    for (float l : latencies)
+        sum += l;
+    return sum / latencies.size();
+}
+
+double FramePacer::percentileLatencyMs(double p) const
+{
+    if (latencies.empty())
+        return 0.0;
+    std::vector<float> sorted(latencies);
+    size_t k = std::min(sorted.size() - 1, (size_t)(p / 100.0 * (sorted.size() - 1) + 0.5));
+    std::nth_element(sorted.begin(), sorted.begin() + k, sorted.end());
+    return sorted[k];
+}
+
+void FramePacer::print() const
+{
+    printf("  %-10s sample->gpu done latency %7.3f ms mean, %7.3f ms p99 (%zu frames)\n",
+        pacingModeName(pacing), meanLatencyMs(), percentileLatencyMs(99.0), latencies.size());
+}
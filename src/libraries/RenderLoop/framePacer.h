@@ -0,0 +1,81 @@
+#pragma once
+
+#include "frameLimiter.h"
+#include <vector>
+
+// How the render thread presents frames.
+//   VSync:      swap interval 1, the driver queues frames freely
+//   Adaptive:   swap interval -1 (late frames tear instead of waiting a whole refresh)
+//   Uncapped:   swap interval 0, optionally capped by the frame limiter
+//   LowLatency: swap interval 1, at most maxQueuedFrames in flight (bounded with fences),
+//               and the frame start is delayed so state is sampled as late as possible
+enum class PacingMode
+{
+    VSync,
+    Adaptive,
+    Uncapped,
+    LowLatency,
+};
+
+const char* pacingModeName(PacingMode mode);
+bool parsePacingMode(const char* name, PacingMode& mode);
+int pacingSwapInterval(PacingMode mode);
+
+// Render thread side of frame pacing. Needs the GL context current on the calling thread.
+//
+//     pacer.beginFrame();      // throttle, then sample the newest state
+//     ... draw ...
+//     pacer.endWork();         // the frame's CPU cost, without the swap's vsync wait
+//     swap buffers
+//     pacer.endFrame();        // fence for this frame
+class FramePacer
+{
+public:
+    explicit FramePacer(PacingMode mode = PacingMode::VSync, int maxQueuedFrames = 1, double fpsLimit = 0.0);
+    ~FramePacer();
+
+    PacingMode mode() const { return pacing; }
+
+    // refresh period of the display, used by LowLatency to place the frame start
+    void setRefreshRate(double hz);
+
+    void beginFrame();
+    // Before the swap: LowLatency delays the next beginFrame() by what is left of the refresh
+    // after this cost. Without it endFrame() measures, and frames whose swap blocked are dropped.
+    void endWork();
+    void endFrame();
+
+    // Estimated latency of each finished frame: time from beginFrame() (state sampled)
+    // until its fence was seen signaled, i.e. the GPU finished the frame.
+    // Presentation adds up to one more refresh on top.
+    const std::vector<float>& latenciesMs() const { return latencies; }
+    double meanLatencyMs() const;
+    double percentileLatencyMs(double p) const;
+
+    void print() const;
+
+private:
+    typedef FrameLimiter::Clock Clock;
+
+    struct InFlight
+    {
+        void* fence;
+        Clock::time_point sampled;
+    };
+
+    // collect signaled fences; block on the oldest ones while more than 'keep' are in flight
+    void retire(size_t keep, bool block);
+    void addWork(double work);
+
+    PacingMode pacing;
+    size_t maxQueued;
+    FrameLimiter limiter;
+    double refreshPeriod = 1.0 / 60.0;
+    double workEstimate = 0.0;      // smoothed beginFrame() -> endWork() time
+    bool workEnded = false;
+    Clock::time_point frameStart;
+    Clock::time_point lastSwap;
+    bool hasLastSwap = false;
+    std::vector<InFlight> inFlight;
+    std::vector<float> latencies;
+};
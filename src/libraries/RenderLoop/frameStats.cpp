@@ -0,0 +1,97 @@
+#include "frameStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+double threadCpuSeconds()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+        return 0.0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    return (k.QuadPart + u.QuadPart) * 1e-7;
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts))
+        return 0.0;
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#else
+    return 0.0;
+#endif
+}
+
+FrameStats::FrameStats()
+{
+    intervals.reserve(1 << 16);
+}
+
+void FrameStats::frame()
+{
+    Clock::time_point now = Clock::now();
+    if (!started)
+    {
+        first = last = now;
+        cpuStart = threadCpuSeconds();
+        started = true;
+        return;
+    }
+    intervals.push_back(std::chrono::duration<float, std::milli>(now - last).count());
+    last = now;
+    wall = std::chrono::duration<double>(now - first).count();
+    cpu = threadCpuSeconds() - cpuStart;
+}
+
+void FrameStats::beginWork()
+{
+    workStart = Clock::now();
+}
+
+void FrameStats::endWork()
+{
+    if (started)
+        busy += std::chrono::duration<double>(Clock::now() - workStart).count();
+}
+
+double FrameStats::meanFrameMs() const
+{
+    return intervals.empty() ? 0.0 : wall * 1000.0 / intervals.size();
+}
+
+double FrameStats::percentileFrameMs(double p) const
+{
+    if (intervals.empty())
+        return 0.0;
+    std::vector<float> sorted(intervals);
+    size_t k = std::min(sorted.size() - 1, (size_t)(p / 100.0 * (sorted.size() - 1) + 0.5));
+    std::nth_element(sorted.begin(), sorted.begin() + k, sorted.end());
+    return sorted[k];
+}
+
+double FrameStats::stdDevFrameMs() const
+{
+    if (intervals.empty())
+        return 0.0;
+    double mean = meanFrameMs(), sum = 0.0;
+    for (float t : intervals)
+        sum += (t - mean) * (t - mean);
+    return std::sqrt(sum / intervals.size());
+}
+
+void FrameStats::print(const char* name) const
+{
+    printf("  %-10s %6zu frames, %7.3f ms mean, %7.3f ms p99, %6.3f ms stddev, busy %5.1f%%, cpu %5.1f%%\n",
+        name, frameNum(), meanFrameMs(), percentileFrameMs(99.0), stdDevFrameMs(), busyRatio() * 100.0, cpuRatio() * 100.0);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+// Per-thread loop statistics: frame intervals, time spent in work sections
+// and CPU time actually consumed by the thread.
+// All calls must come from the measured thread; read the results after it finished.
+class FrameStats
+{
+public:
+    FrameStats();
+
+    // frame boundary, the first call starts the measurement
+    void frame();
+
+    // time between beginWork() and endWork() counts as busy, the rest as waiting
+    void beginWork();
+    void endWork();
+
+    size_t frameNum() const { return intervals.size(); }
+    double wallSeconds() const { return wall; }
+    double meanFrameMs() const;
+    double percentileFrameMs(double p) const;
+    double stdDevFrameMs() const;
+    double busyRatio() const { return wall > 0.0 ? busy / wall : 0.0; }
+    double cpuRatio() const { return wall > 0.0 ? cpu / wall : 0.0; }
+
+    void print(const char* name) const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    std::vector<float> intervals;
+    Clock::time_point first, last, workStart;
+    double cpuStart = 0.0;
+    double wall = 0.0, busy = 0.0, cpu = 0.0;
+    bool started = false;
+};
+
+// CPU time consumed by the calling thread, in seconds (0 if unsupported)
+double threadCpuSeconds();
@@ -0,0 +1,39 @@
+#include "renderThread.h"
+
+void RenderThread::start(std::function<bool()> init, std::function<bool()> frame, std::function<void()> shutdown)
+{
+    stop();
+    initFn = std::move(init);
+    frameFn = std::move(frame);
+    shutdownFn = std::move(shutdown);
+    stopRequested = false;
+    initFailed = false;
+    active = true;
+    thread = std::thread(&RenderThread::run, this);
+}
+
+void RenderThread::stop()
+{
+    stopRequested = true;
+    if (thread.joinable())
+        thread.join();
+}
+
+void RenderThread::run()
+{
+    if (initFn && !initFn())
+    {
+        initFailed = true;
+        active.store(false, std::memory_order_release);
+        return;
+    }
+    while (!stopRequested.load(std::memory_order_relaxed))
+    {
+        frameStats.frame();
+        if (!frameFn())
+            break;
+    }
+    if (shutdownFn)
+        shutdownFn();
+    active.store(false, std::memory_order_release);
+}
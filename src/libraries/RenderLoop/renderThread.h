@@ -0,0 +1,43 @@
+#pragma once
+
+#include "frameStats.h"
+#include <atomic>
+#include <functional>
+#include <thread>
+
+// Owns the thread that owns the GL context.
+// init() runs first on the new thread (make the context current, load GL, create resources),
+// then frame() is called until it returns false or stop() is requested, then shutdown().
+class RenderThread
+{
+public:
+    RenderThread() = default;
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+    ~RenderThread() { stop(); }
+
+    void start(std::function<bool()> init, std::function<bool()> frame, std::function<void()> shutdown);
+
+    // request the loop to end and join the thread
+    void stop();
+
+    bool running() const { return active.load(std::memory_order_acquire); }
+    bool failed() const { return initFailed; }
+
+    // frame() timing as seen by the render thread; valid after stop()
+    const FrameStats& stats() const { return frameStats; }
+    // the frame callback brackets its own work with these so waits (swap, fences) count as idle
+    FrameStats& mutableStats() { return frameStats; }
+
+private:
+    void run();
+
+    std::thread thread;
+    std::function<bool()> initFn;
+    std::function<bool()> frameFn;
+    std::function<void()> shutdownFn;
+    std::atomic<bool> active{ false };
+    std::atomic<bool> stopRequested{ false };
+    bool initFailed = false;
+    FrameStats frameStats;
+};
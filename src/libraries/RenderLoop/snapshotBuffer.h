@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+// Hands immutable frame snapshots from the simulation thread to the render thread.
+// Three slots rotate through an atomic exchange: the writer fills its slot and publishes it,
+// the reader swaps the newest published slot for its own. Neither side takes a lock.
+//
+// Triple: the writer never waits, the reader always gets the newest snapshot and stale
+//         ones are dropped.
+// Double: the writer waits in publish() until the reader took the previous snapshot,
+//         so the simulation runs at most one frame ahead of rendering.
+template<typename T>
+class SnapshotBuffer
+{
+public:
+    enum Mode { Double, Triple };
+
+    explicit SnapshotBuffer(Mode bufferMode = Triple) : mode(bufferMode) {}
+
+    //------- writer -------
+    T& writeSlot() { return slots[writeIndex].value; }
+
+    void publish()
+    {
+        if (mode == Double)
+        {
+            while ((state.load(std::memory_order_acquire) & kFresh) && !closed.load(std::memory_order_relaxed))
+                std::this_thread::yield();
+        }
+        uint8_t old = state.exchange((uint8_t)(writeIndex | kFresh), std::memory_order_acq_rel);
+        if (old & kFresh)
+            droppedNum.fetch_add(1, std::memory_order_relaxed);
+        writeIndex = old & kIndexMask;
+        publishedNum.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //------- reader -------
+    // Take the newest snapshot. Returns false if nothing was published since the last call,
+    // in which case readSlot() keeps returning the previous one.
+    bool acquire()
+    {
+        if (!(state.load(std::memory_order_relaxed) & kFresh))
+            return false;
+        uint8_t old = state.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = old & kIndexMask;
+        return true;
+    }
+
+    const T& readSlot() const { return slots[readIndex].value; }
+
+    // unblock a writer waiting in Double mode, e.g. when the reader shuts down
+    void close() { closed.store(true, std::memory_order_relaxed); }
+    bool isClosed() const { return closed.load(std::memory_order_relaxed); }
+
+    uint64_t published() const { return publishedNum.load(std::memory_order_relaxed); }
+    uint64_t dropped() const { return droppedNum.load(std::memory_order_relaxed); }
+
+private:
+    static const uint8_t kIndexMask = 3;
+    static const uint8_t kFresh = 4;
+
+    struct alignas(64) Slot
+    {
+        T value;
+    };
+
+    Mode mode;
+    Slot slots[3];
+    unsigned char writeIndex = 0;
+    unsigned char readIndex = 2;
+    alignas(64) std::atomic<uint8_t> state{ 1 };    // index of the middle slot | kFresh
+    std::atomic<bool> closed{ false };
+    std::atomic<uint64_t> publishedNum{ 0 };
+    std::atomic<uint64_t> droppedNum{ 0 };
+};
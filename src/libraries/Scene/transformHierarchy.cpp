@@ -0,0 +1,152 @@
+#include "transformHierarchy.h"
+
+#include <threadPool.h>
+#include <atomic>
+
+glm::mat4 composeTRS(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+{
+    glm::mat3 r = glm::mat3_cast(rotation);
+    return glm::mat4(
+        glm::vec4(r[0] * scale.x, 0.0f),
+        glm::vec4(r[1] * scale.y, 0.0f),
+        glm::vec4(r[2] * scale.z, 0.0f),
+        glm::vec4(position, 1.0f));
+}
+
+void TransformHierarchy::reserve(size_t nodeNum)
+{
+    parents.reserve(nodeNum);
+    positions.reserve(nodeNum);
+    rotations.reserve(nodeNum);
+    scales.reserve(nodeNum);
+    worlds.reserve(nodeNum);
+    dirty.reserve(nodeNum);
+    changed.reserve(nodeNum);
+    depths.reserve(nodeNum);
+}
+
+void TransformHierarchy::clear()
+{
+    *this = TransformHierarchy();
+}
+
+int TransformHierarchy::create(int parent, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+{
+    int node = (int)parents.size();
+    if (parent >= node)
+        parent = kNoParent;
+    parents.push_back(parent);
+    positions.push_back(position);
+    rotations.push_back(rotation);
+    scales.push_back(scale);
+    worlds.push_back(glm::mat4(1.0f));
+    dirty.push_back(0);
+    changed.push_back(0);
+    depths.push_back(parent == kNoParent ? 0 : depths[parent] + 1);
+    markDirty(node);
+    levelsValid = false;
+    return node;
+}
+
+void TransformHierarchy::setLocal(int node, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+{
+    positions[node] = position;
+    rotations[node] = rotation;
+    scales[node] = scale;
+    markDirty(node);
+}
+
+void TransformHierarchy::rebuildLevels()
+{
+    // counting sort by depth keeps the parent-before-child order inside each level
+    int maxDepth = 0;
+    for (int d : depths)
+        maxDepth = d > maxDepth ? d : maxDepth;
+    levelOffsets.assign(maxDepth + 2, 0);
+    for (int d : depths)
+        levelOffsets[d + 1]++;
+    for (size_t i = 1; i < levelOffsets.size(); i++)
+        levelOffsets[i] += levelOffsets[i - 1];
+    levelOrder.resize(depths.size());
+    std::vector<size_t> cursor(levelOffsets.begin(), levelOffsets.end() - 1);
+    for (size_t i = 0; i < depths.size(); i++)
+        levelOrder[cursor[depths[i]]++] = (int)i;
+    levelsValid = true;
+}
+
+inline void TransformHierarchy::updateNode(int node)
+{
+    int p = parents[node];
+    bool parentChanged = p != kNoParent && changed[p];
+    if (dirty[node] || parentChanged)
+    {
+        glm::mat4 local = composeTRS(positions[node], rotations[node], scales[node]);
+        worlds[node] = p == kNoParent ? local : worlds[p] * local;
+        dirty[node] = 0;
+        changed[node] = 1;
+    }
+    else
+        changed[node] = 0;
+}
+
+void TransformHierarchy::update(ThreadPool* pool)
+{
+    size_t n = parents.size();
+    if (dirtyNum == 0)
+    {
+        // nothing edited: only reset the change flags of the previous update
+        if (updatedNum)
+            std::fill(changed.begin(), changed.end(), 0);
+        updatedNum = 0;
+        return;
+    }
+
+    // small hierarchies are not worth the synchronisation of one task per level
+    if (!pool || n < 4096)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            updateNode((int)i);
+            count += changed[i];
+        }
+        updatedNum = count;
+        dirtyNum = 0;
+        return;
+    }
+
+    if (!levelsValid)
+        rebuildLevels();
+    std::atomic<size_t> count(0);
+    for (size_t level = 0; level + 1 < levelOffsets.size(); level++)
+    {
+        size_t begin = levelOffsets[level];
+        size_t levelSize = levelOffsets[level + 1] - begin;
+        const int* order = levelOrder.data() + begin;
+        pool->parallelFor(levelSize, 2048, [&](size_t from, size_t to) {
+            size_t local = 0;
+            for (size_t i = from; i < to; i++)
+            {
+                updateNode(order[i]);
+                local += changed[order[i]];
+            }
+            count += local;
+        });
+    }
+    updatedNum = count;
+    dirtyNum = 0;
+}
+
+void TransformHierarchy::updateAll()
+{
+    for (size_t i = 0; i < parents.size(); i++)
+    {
+        int p = parents[i];
+        glm::mat4 local = composeTRS(positions[i], rotations[i], scales[i]);
+        worlds[i] = p == kNoParent ? local : worlds[p] * local;
+        dirty[i] = 0;
+        changed[i] = 1;
+    }
+    updatedNum = parents.size();
+    dirtyNum = 0;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+// Local/world transforms of a node hierarchy stored as structure-of-arrays.
+// Nodes are only appended and a parent always has a smaller index than its children,
+// so one forward pass propagates dirty flags and world matrices.
+class TransformHierarchy
+{
+public:
+    static const int kNoParent = -1;
+
+    void reserve(size_t nodeNum);
+    void clear();
+
+    // Append a node, parent must already exist (or kNoParent)
+    int create(int parent,
+        const glm::vec3& position = glm::vec3(0.0f),
+        const glm::quat& rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f),
+        const glm::vec3& scale = glm::vec3(1.0f));
+
+    void setPosition(int node, const glm::vec3& position) { positions[node] = position; markDirty(node); }
+    void setRotation(int node, const glm::quat& rotation) { rotations[node] = rotation; markDirty(node); }
+    void setScale(int node, const glm::vec3& scale) { scales[node] = scale; markDirty(node); }
+    void setLocal(int node, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+
+    const glm::vec3& position(int node) const { return positions[node]; }
+    const glm::quat& rotation(int node) const { return rotations[node]; }
+    const glm::vec3& scale(int node) const { return scales[node]; }
+    int parent(int node) const { return parents[node]; }
+    size_t size() const { return parents.size(); }
+
+    // Recompute the world matrices of changed nodes and their descendants.
+    // With a pool, nodes of one depth level are updated in parallel.
+    void update(ThreadPool* pool = nullptr);
+
+    // Recompute every world matrix regardless of dirty flags (reference path)
+    void updateAll();
+
+    const glm::mat4& world(int node) const { return worlds[node]; }
+    const glm::mat4* worldData() const { return worlds.data(); }
+    // true if world(node) changed in the last update()
+    bool worldChanged(int node) const { return changed[node] != 0; }
+    size_t lastUpdatedNum() const { return updatedNum; }
+
+private:
+    void markDirty(int node)
+    {
+        if (!dirty[node])
+        {
+            dirty[node] = 1;
+            dirtyNum++;
+        }
+    }
+    void rebuildLevels();
+    void updateNode(int node);
+
+    // hot data, one entry per node
+    std::vector<int> parents;
+    std::vector<glm::vec3> positions;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> scales;
+    std::vector<glm::mat4> worlds;
+    std::vector<uint8_t> dirty;         // local transform edited since last update
+    std::vector<uint8_t> changed;       // world recomputed in the last update
+
+    // depth-sorted order for the parallel path
+    std::vector<int> depths;
+    std::vector<int> levelOrder;
+    std::vector<size_t> levelOffsets;
+    bool levelsValid = false;
+
+    size_t dirtyNum = 0;
+    size_t updatedNum = 0;
+};
+
+// T * R * S without the intermediate matrices of glm::translate/rotate/scale
+glm::mat4 composeTRS(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
@@ -0,0 +1,54 @@
+#include "cameraController.h"
+
+namespace
+{
+    // GLFW key codes
+    const int kKeyW = 87;
+    const int kKeyS = 83;
+    const int kKeyA = 65;
+    const int kKeyD = 68;
+    const int kKeySpace = 32;
+    const int kKeyLeftShift = 340;
+}
+
+glm::vec3 CameraState::front() const
+{
+    glm::vec3 f;
+    f.x = cos(glm::radians(pitch)) * cos(glm::radians(yaw));
+    f.y = sin(glm::radians(pitch));
+    f.z = cos(glm::radians(pitch)) * sin(glm::radians(yaw));
+    return glm::normalize(f);
+}
+
+void simulateCamera(CameraState& camera, const InputFrame& input, float dt, const CameraSettings& settings)
+{
+    // y is reversed: screen coordinates grow downwards
+    camera.yaw += (float)input.mouseDX * settings.sensitivity;
+    camera.pitch -= (float)input.mouseDY * settings.sensitivity;
+    camera.pitch = camera.pitch > 89 ? 89 : camera.pitch < -89 ? -89 : camera.pitch;
+
+    glm::vec3 front = camera.front();
+    glm::vec3 right = glm::normalize(glm::cross(front, settings.up));
+    float step = settings.speed * dt;
+    if (input.keyDown[kKeyW])
+        camera.position += front * step;
+    if (input.keyDown[kKeyS])
+        camera.position -= front * step;
+    if (input.keyDown[kKeyA])
+        camera.position -= right * step;
+    if (input.keyDown[kKeyD])
+        camera.position += right * step;
+    if (input.keyDown[kKeySpace])
+        camera.position += settings.up * step;
+    if (input.keyDown[kKeyLeftShift])
+        camera.position -= settings.up * step;
+}
+
+CameraState interpolateCamera(const CameraState& previous, const CameraState& current, float alpha)
+{
+    CameraState s;
+    s.position = glm::mix(previous.position, current.position, alpha);
+    s.yaw = glm::mix(previous.yaw, current.yaw, alpha);
+    s.pitch = glm::mix(previous.pitch, current.pitch, alpha);
+    return s;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "inputSystem.h"
+#include <glm/glm.hpp>
+
+// Fly camera state advanced by the fixed-step simulation
+struct CameraState
+{
+    glm::vec3 position = glm::vec3(0.0f, 0.0f, 3.0f);
+    float yaw = -90.0f;
+    float pitch = 0.0f;
+
+    glm::vec3 front() const;
+};
+
+struct CameraSettings
+{
+    float speed = 2.0f;
+    float sensitivity = 0.1f;
+    glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f);
+};
+
+// One tick of WASD / space / shift movement and mouse look
+void simulateCamera(CameraState& camera, const InputFrame& input, float dt, const CameraSettings& settings);
+
+// State to render between two ticks, alpha in [0, 1]
+CameraState interpolateCamera(const CameraState& previous, const CameraState& current, float alpha);
@@ -0,0 +1,56 @@
+#pragma once
+
+// Accumulator for a fixed-rate simulation driven by a variable-rate frame loop.
+// advance() runs as many whole steps as fit into the elapsed real time and returns
+// the interpolation factor between the last two simulated states for rendering.
+class FixedTimestep
+{
+public:
+    explicit FixedTimestep(double step = 1.0 / 120.0, int maxStepsPerFrame = 8)
+        : stepSize(step), maxSteps(maxStepsPerFrame) {}
+
+    // Pin tick boundaries to start + k * step, so runs sharing a time base tick identically
+    void reset(double start)
+    {
+        simTime = start;
+        started = true;
+        tickNum = 0;
+    }
+
+    // simulate(tickStart, tickEnd) is called once per step
+    template<typename F>
+    float advance(double now, F&& simulate)
+    {
+        if (!started)
+        {
+            simTime = now;
+            started = true;
+        }
+        int steps = 0;
+        while (simTime + stepSize <= now)
+        {
+            if (steps == maxSteps)
+            {
+                // spiral of death: drop the backlog instead of falling further behind
+                simTime = now - stepSize * 0.5;
+                break;
+            }
+            simulate(simTime, simTime + stepSize);
+            simTime += stepSize;
+            tickNum++;
+            steps++;
+        }
+        return (float)((now - simTime) / stepSize);
+    }
+
+    double step() const { return stepSize; }
+    double time() const { return simTime; }
+    unsigned long long ticks() const { return tickNum; }
+
+private:
+    double stepSize;
+    int maxSteps;
+    double simTime = 0.0;
+    bool started = false;
+    unsigned long long tickNum = 0;
+};
@@ -0,0 +1,133 @@
+#include "inputSystem.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+    const int kActionRelease = 0;
+    const int kActionPress = 1;
+    const uint32_t kRecordingMagic = 0x31504E49;   // "INP1"
+}
+
+bool InputSystem::push(const InputEvent& event)
+{
+    if (queue.push(event))
+        return true;
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void InputSystem::apply(const InputEvent& event)
+{
+    switch (event.type)
+    {
+    case InputEventType::Key:
+        if (event.code >= 0 && event.code < kInputKeyNum)
+        {
+            if (event.action == kActionPress && !current.keyDown[event.code])
+                current.keyPressed[event.code] = true;
+            if (event.action != kActionRelease)
+                current.keyDown[event.code] = true;
+            else
+                current.keyDown[event.code] = false;
+        }
+        break;
+    case InputEventType::MouseMove:
+        // high rate motion only accumulates, whatever the number of events in the tick
+        if (current.hasMouse)
+        {
+            current.mouseDX += event.x - current.mouseX;
+            current.mouseDY += event.y - current.mouseY;
+        }
+        current.mouseX = event.x;
+        current.mouseY = event.y;
+        current.hasMouse = true;
+        break;
+    case InputEventType::MouseButton:
+        if (event.code >= 0 && event.code < kInputButtonNum)
+            current.buttonDown[event.code] = event.action != kActionRelease;
+        break;
+    case InputEventType::Scroll:
+        current.scrollX += event.x;
+        current.scrollY += event.y;
+        break;
+    }
+    current.rawEventNum++;
+}
+
+const InputFrame& InputSystem::collect(double tickEnd)
+{
+    memset(current.keyPressed, 0, sizeof(current.keyPressed));
+    current.mouseDX = current.mouseDY = 0.0;
+    current.scrollX = current.scrollY = 0.0;
+    current.rawEventNum = 0;
+
+    // events are ordered by time, stop at the first one belonging to a later tick
+    while (const InputEvent* e = queue.front())
+    {
+        if (e->time >= tickEnd)
+            break;
+        apply(*e);
+        if (recording)
+            recorded.push_back(*e);
+        queue.popFront();
+    }
+    return current;
+}
+
+bool InputSystem::saveEvents(const char* filename, const std::vector<InputEvent>& events)
+{
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+    {
+        std::cout << "ERROR: Cannot write input recording \"" << filename << "\".\n";
+        return false;
+    }
+    uint32_t header[2] = { kRecordingMagic, (uint32_t)events.size() };
+    fwrite(header, sizeof(header), 1, f);
+    for (const InputEvent& e : events)
+    {
+        // fixed little-endian-host layout, independent of struct padding
+        uint8_t type = (uint8_t)e.type;
+        int32_t codes[2] = { e.code, e.action };
+        fwrite(&e.time, sizeof(double), 1, f);
+        fwrite(&type, 1, 1, f);
+        fwrite(codes, sizeof(codes), 1, f);
+        fwrite(&e.x, sizeof(double), 1, f);
+        fwrite(&e.y, sizeof(double), 1, f);
+    }
+    fclose(f);
+    return true;
+}
+
+bool InputSystem::loadEvents(const char* filename, std::vector<InputEvent>& events)
+{
+    FILE* f = fopen(filename, "rb");
+    if (!f)
+    {
+        std::cout << "ERROR: Cannot open input recording \"" << filename << "\".\n";
+        return false;
+    }
+    uint32_t header[2];
+    bool ok = fread(header, sizeof(header), 1, f) == 1 && header[0] == kRecordingMagic;
+    events.clear();
+    for (uint32_t i = 0; ok && i < header[1]; i++)
+    {
+        InputEvent e;
+        uint8_t type;
+        int32_t codes[2];
+        ok = fread(&e.time, sizeof(double), 1, f) == 1 && fread(&type, 1, 1, f) == 1 &&
+            fread(codes, sizeof(codes), 1, f) == 1 && fread(&e.x, sizeof(double), 1, f) == 1 &&
+            fread(&e.y, sizeof(double), 1, f) == 1;
+        e.type = (InputEventType)type;
+        e.code = codes[0];
+        e.action = codes[1];
+        events.push_back(e);
+    }
+    fclose(f);
+    if (!ok)
+        std::cout << "ERROR: Invalid input recording \"" << filename << "\".\n";
+    return ok;
+}
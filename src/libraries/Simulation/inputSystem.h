@@ -0,0 +1,75 @@
+#pragma once
+
+#include "spscQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Raw window events, timestamped by the producer (the window callbacks).
+// Codes and actions use the GLFW values, but nothing here depends on GLFW.
+enum class InputEventType : uint8_t
+{
+    Key,            // code: key, action: press/release/repeat
+    MouseMove,      // x, y: absolute cursor position
+    MouseButton,    // code: button, action: press/release
+    Scroll,         // x, y: offsets
+};
+
+struct InputEvent
+{
+    double time;
+    InputEventType type;
+    int code;
+    int action;
+    double x, y;
+};
+
+const int kInputKeyNum = 512;
+const int kInputButtonNum = 8;
+
+// Input as seen by one simulation tick
+struct InputFrame
+{
+    bool keyDown[kInputKeyNum] = {};
+    bool keyPressed[kInputKeyNum] = {};     // went down during this tick
+    bool buttonDown[kInputButtonNum] = {};
+    double mouseX = 0.0, mouseY = 0.0;
+    double mouseDX = 0.0, mouseDY = 0.0;    // motion of all move events of the tick, coalesced
+    double scrollX = 0.0, scrollY = 0.0;
+    bool hasMouse = false;                  // a position has been seen
+    int rawEventNum = 0;                    // events folded into this tick
+};
+
+// Thread boundary between the window callbacks and the simulation.
+// Callbacks push() events into a lock-free queue; the simulation calls
+// collect() once per tick to fold every event up to the tick's end time into an InputFrame.
+class InputSystem
+{
+public:
+    // producer side, never blocks; returns false if the queue was full and the event dropped
+    bool push(const InputEvent& event);
+
+    // consumer side: apply events with time < tickEnd and return the tick's view
+    const InputFrame& collect(double tickEnd);
+
+    const InputFrame& frame() const { return current; }
+    uint64_t droppedNum() const { return dropped.load(std::memory_order_relaxed); }
+
+    // Recording of every consumed event, for deterministic replay
+    void startRecording() { recording = true; recorded.clear(); }
+    void stopRecording() { recording = false; }
+    const std::vector<InputEvent>& recordedEvents() const { return recorded; }
+
+    static bool saveEvents(const char* filename, const std::vector<InputEvent>& events);
+    static bool loadEvents(const char* filename, std::vector<InputEvent>& events);
+
+private:
+    void apply(const InputEvent& event);
+
+    SpscQueue<InputEvent, 16384> queue;
+    std::atomic<uint64_t> dropped{ 0 };
+    InputFrame current;
+    bool recording = false;
+    std::vector<InputEvent> recorded;
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// Bounded single-producer single-consumer ring buffer.
+// push() may only be called from one thread and front()/pop() from one other thread.
+// Head and tail live on separate cache lines and each side caches the other's index,
+// so the common case touches no shared line.
+template<typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    bool push(const T& value)
+    {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead == Capacity)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead == Capacity)
+                return false;
+        }
+        slots[t & (Capacity - 1)] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // nullptr when empty
+    const T* front()
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail)
+                return nullptr;
+        }
+        return &slots[h & (Capacity - 1)];
+    }
+
+    // only after front() returned an element
+    void popFront()
+    {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    bool pop(T& value)
+    {
+        const T* p = front();
+        if (!p)
+            return false;
+        value = *p;
+        popFront();
+        return true;
+    }
+
+    size_t sizeApprox() const
+    {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    alignas(64) std::atomic<size_t> head{ 0 };
+    size_t cachedTail = 0;      // consumer side copy of tail
+    alignas(64) std::atomic<size_t> tail{ 0 };
+    size_t cachedHead = 0;      // producer side copy of head
+    alignas(64) T slots[Capacity];
+};
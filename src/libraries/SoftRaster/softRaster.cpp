@@ -0,0 +1,358 @@
+#include "softRaster.h"
+
+#include <threadPool.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SOFT_RASTER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+    const float kGuardBand = 8.0f;          // clip x/y at 8x the viewport, the rest is scissored
+    const float kSubpixel = 256.0f;         // vertex snapping
+
+    inline uint32_t packColor(const glm::vec4& c)
+    {
+        glm::vec4 v = glm::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f;
+        return (uint32_t)v.r | (uint32_t)v.g << 8 | (uint32_t)v.b << 16 | (uint32_t)v.a << 24;
+    }
+
+    // Coverage of the 2x2 quad whose lower left pixel center is (x, y) relative to the triangle origin.
+    // Lane order: (0,0) (1,0) (0,1) (1,1). Returns the lane mask and the three edge values per lane.
+    inline int quadCoverage(const float* a, const float* b, const float* c, const bool* topLeft,
+        float x, float y, float e[3][4])
+    {
+#if SOFT_RASTER_SSE2
+        const __m128 dx = _mm_setr_ps(0.0f, 1.0f, 0.0f, 1.0f);
+        const __m128 dy = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+        __m128 px = _mm_add_ps(_mm_set1_ps(x), dx);
+        __m128 py = _mm_add_ps(_mm_set1_ps(y), dy);
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int i = 0; i < 3; i++)
+        {
+            __m128 v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[i]), px), _mm_mul_ps(_mm_set1_ps(b[i]), py)), _mm_set1_ps(c[i]));
+            _mm_storeu_ps(e[i], v);
+            // top-left rule: pixels exactly on an edge belong to one of the two triangles sharing it
+            __m128 pass = topLeft[i] ? _mm_cmpge_ps(v, _mm_setzero_ps()) : _mm_cmpgt_ps(v, _mm_setzero_ps());
+            inside = _mm_and_ps(inside, pass);
+        }
+        return _mm_movemask_ps(inside);
+#else
+        int mask = 0xf;
+        for (int i = 0; i < 3; i++)
+        {
+            for (int l = 0; l < 4; l++)
+            {
+                float v = a[i] * (x + (l & 1)) + b[i] * (y + (l >> 1)) + c[i];
+                e[i][l] = v;
+                if (topLeft[i] ? v < 0.0f : v <= 0.0f)
+                    mask &= ~(1 << l);
+            }
+        }
+        return mask;
+#endif
+    }
+}
+
+const char* softRasterPath()
+{
+#if SOFT_RASTER_SSE2
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+SoftRasterizer::SoftRasterizer(ThreadPool* pool, int tileSize)
+    : pool(pool), tileSize(max(tileSize & ~1, 8))
+{
+    materials.push_back({ nullptr, nullptr, 0.2f });
+}
+
+void SoftRasterizer::resize(int width, int height)
+{
+    finish();
+    w = width;
+    h = height;
+    tilesX = (w + tileSize - 1) / tileSize;
+    tilesY = (h + tileSize - 1) / tileSize;
+    color.assign((size_t)w * h, 0);
+    depth.assign((size_t)w * h, 1.0f);
+    bins.assign((size_t)tilesX * tilesY, vector<uint32_t>());
+}
+
+void SoftRasterizer::clear(const glm::vec4& c, float d)
+{
+    finish();
+    fill(color.begin(), color.end(), packColor(c));
+    fill(depth.begin(), depth.end(), d);
+}
+
+void SoftRasterizer::setTextures(const SoftTexture* texture0, const SoftTexture* texture1, float mixFactor)
+{
+    const Material& last = materials.back();
+    if (last.texture0 != texture0 || last.texture1 != texture1 || last.mixFactor != mixFactor)
+        materials.push_back({ texture0, texture1, mixFactor });
+}
+
+//------- geometry -------
+
+void SoftRasterizer::drawIndexed(const SoftVertex* vertices, const unsigned int* indices, size_t indexNum, const glm::mat4& mvp)
+{
+    for (size_t i = 0; i + 2 < indexNum; i += 3)
+    {
+        ClipVertex v[3];
+        bool allInside = true;
+        for (int k = 0; k < 3; k++)
+        {
+            const SoftVertex& src = vertices[indices[i + k]];
+            v[k].position = mvp * glm::vec4(src.position, 1.0f);
+            v[k].uv = src.uv;
+            const glm::vec4& p = v[k].position;
+            float guard = kGuardBand * p.w;
+            allInside = allInside && p.z >= -p.w && p.z <= p.w && fabs(p.x) <= guard && fabs(p.y) <= guard;
+        }
+        counters.triangles++;
+        if (allInside)
+            setupTriangle(v[0], v[1], v[2]);
+        else
+            clipTriangle(v[0], v[1], v[2]);
+    }
+}
+
+void SoftRasterizer::clipTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2)
+{
+    // Sutherland-Hodgman against near, far and the guard band planes, distance >= 0 is inside
+    auto distance = [](int plane, const glm::vec4& p) {
+        switch (plane)
+        {
+        case 0: return p.z + p.w;
+        case 1: return p.w - p.z;
+        case 2: return kGuardBand * p.w - p.x;
+        case 3: return kGuardBand * p.w + p.x;
+        case 4: return kGuardBand * p.w - p.y;
+        default: return kGuardBand * p.w + p.y;
+        }
+    };
+    ClipVertex buffers[2][9];
+    int count = 3;
+    buffers[0][0] = v0;
+    buffers[0][1] = v1;
+    buffers[0][2] = v2;
+    int src = 0;
+    for (int plane = 0; plane < 6 && count >= 3; plane++)
+    {
+        const ClipVertex* in = buffers[src];
+        ClipVertex* out = buffers[1 - src];
+        int outCount = 0;
+        for (int i = 0; i < count; i++)
+        {
+            const ClipVertex& a = in[i];
+            const ClipVertex& b = in[(i + 1) % count];
+            float da = distance(plane, a.position), db = distance(plane, b.position);
+            if (da >= 0.0f)
+                out[outCount++] = a;
+            if ((da >= 0.0f) != (db >= 0.0f))
+            {
+                float t = da / (da - db);
+                out[outCount].position = glm::mix(a.position, b.position, t);
+                out[outCount].uv = glm::mix(a.uv, b.uv, t);
+                outCount++;
+            }
+        }
+        count = outCount;
+        src = 1 - src;
+    }
+    for (int i = 1; i + 1 < count; i++)
+        setupTriangle(buffers[src][0], buffers[src][i], buffers[src][i + 1]);
+}
+
+void SoftRasterizer::setupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2)
+{
+    const ClipVertex* v[3] = { &v0, &v1, &v2 };
+    double sx[3], sy[3];
+    Triangle t;
+    for (int k = 0; k < 3; k++)
+    {
+        const glm::vec4& p = v[k]->position;
+        float invW = 1.0f / p.w;
+        // viewport transform, snapped so shared edges evaluate the same on both sides
+        sx[k] = floor(((p.x * invW) * 0.5 + 0.5) * w * kSubpixel + 0.5) / kSubpixel;
+        sy[k] = floor(((p.y * invW) * 0.5 + 0.5) * h * kSubpixel + 0.5) / kSubpixel;
+        t.z[k] = (p.z * invW) * 0.5f + 0.5f;
+        t.invW[k] = invW;
+        t.uOverW[k] = v[k]->uv.x * invW;
+        t.vOverW[k] = v[k]->uv.y * invW;
+    }
+
+    // counter-clockwise in the y-up framebuffer; flip the others (no culling)
+    double area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sy[1] - sy[0]) * (sx[2] - sx[0]);
+    if (area == 0.0 || !std::isfinite(area))
+        return;
+    if (area < 0.0)
+    {
+        swap(sx[1], sx[2]);
+        swap(sy[1], sy[2]);
+        swap(t.z[1], t.z[2]);
+        swap(t.invW[1], t.invW[2]);
+        swap(t.uOverW[1], t.uOverW[2]);
+        swap(t.vOverW[1], t.vOverW[2]);
+        area = -area;
+    }
+
+    // pixel i is a candidate when its center i + 0.5 lies within the bounds
+    double minX = min(sx[0], min(sx[1], sx[2])), maxX = max(sx[0], max(sx[1], sx[2]));
+    double minY = min(sy[0], min(sy[1], sy[2])), maxY = max(sy[0], max(sy[1], sy[2]));
+    t.minX = max((int)ceil(minX - 0.5), 0);
+    t.minY = max((int)ceil(minY - 0.5), 0);
+    t.maxX = min((int)floor(maxX - 0.5), w - 1);
+    t.maxY = min((int)floor(maxY - 0.5), h - 1);
+    if (t.minX > t.maxX || t.minY > t.maxY)
+        return;
+
+    // edge i is opposite vertex i: E_i(p) = A x + B y + C, positive inside, relative to the origin
+    t.originX = t.minX;
+    t.originY = t.minY;
+    for (int i = 0; i < 3; i++)
+    {
+        int a = (i + 1) % 3, b = (i + 2) % 3;
+        double A = sy[a] - sy[b];
+        double B = sx[b] - sx[a];
+        double C = -(A * (sx[a] - t.originX) + B * (sy[a] - t.originY));
+        t.edgeA[i] = (float)A;
+        t.edgeB[i] = (float)B;
+        t.edgeC[i] = (float)C;
+        t.topLeft[i] = A > 0.0 || (A == 0.0 && B > 0.0);
+    }
+    t.invArea = (float)(1.0 / area);
+    t.material = (int)materials.size() - 1;
+
+    uint32_t index = (uint32_t)triangles.size();
+    triangles.push_back(t);
+    counters.rasterized++;
+    for (int ty = t.minY / tileSize; ty <= t.maxY / tileSize; ty++)
+    {
+        for (int tx = t.minX / tileSize; tx <= t.maxX / tileSize; tx++)
+        {
+            bins[ty * tilesX + tx].push_back(index);
+            counters.binned++;
+        }
+    }
+}
+
+//------- rasterization -------
+
+void SoftRasterizer::finish()
+{
+    if (triangles.empty())
+        return;
+    atomic<uint64_t> covered{ 0 }, shaded{ 0 };
+    auto rasterRange = [&](size_t begin, size_t end) {
+        SoftRasterStats local;
+        for (size_t tile = begin; tile < end; tile++)
+            rasterTile((int)tile, local);
+        covered += local.pixelsCovered;
+        shaded += local.pixelsShaded;
+    };
+    if (pool)
+        pool->parallelFor(bins.size(), 1, rasterRange);
+    else
+        rasterRange(0, bins.size());
+    counters.pixelsCovered += covered;
+    counters.pixelsShaded += shaded;
+
+    triangles.clear();
+    for (auto& bin : bins)
+        bin.clear();
+    Material current = materials.back();
+    materials.assign(1, current);
+}
+
+void SoftRasterizer::rasterTile(int tile, SoftRasterStats& tileStats)
+{
+    const vector<uint32_t>& bin = bins[tile];
+    if (bin.empty())
+        return;
+    int tileX0 = (tile % tilesX) * tileSize, tileY0 = (tile / tilesX) * tileSize;
+    int tileX1 = min(tileX0 + tileSize, w), tileY1 = min(tileY0 + tileSize, h);
+
+    for (uint32_t index : bin)
+    {
+        const Triangle& t = triangles[index];
+        const Material& material = materials[t.material];
+        const SoftTexture* textures[2] = { material.texture0, material.texture1 };
+        // quads start on even pixels; tiles are even sized so a quad never spans two tiles
+        int x0 = max(t.minX, tileX0) & ~1, y0 = max(t.minY, tileY0) & ~1;
+        int x1 = min(t.maxX + 1, tileX1), y1 = min(t.maxY + 1, tileY1);
+        for (int y = y0; y < y1; y += 2)
+        {
+            for (int x = x0; x < x1; x += 2)
+            {
+                float e[3][4];
+                int mask = quadCoverage(t.edgeA, t.edgeB, t.edgeC, t.topLeft,
+                    x + 0.5f - t.originX, y + 0.5f - t.originY, e);
+                // lanes past the tile (odd framebuffer sizes)
+                if (x + 1 >= x1)
+                    mask &= 0x5;
+                if (y + 1 >= y1)
+                    mask &= 0x3;
+                if (!mask)
+                    continue;
+
+                // interpolate all four lanes: the uncovered ones act as helpers for the derivatives
+                float z[4], u[4], v[4];
+                for (int l = 0; l < 4; l++)
+                {
+                    float b0 = e[0][l] * t.invArea, b1 = e[1][l] * t.invArea, b2 = e[2][l] * t.invArea;
+                    z[l] = b0 * t.z[0] + b1 * t.z[1] + b2 * t.z[2];
+                    float invW = b0 * t.invW[0] + b1 * t.invW[1] + b2 * t.invW[2];
+                    float wl = invW > 0.0f ? 1.0f / invW : 0.0f;
+                    u[l] = (b0 * t.uOverW[0] + b1 * t.uOverW[1] + b2 * t.uOverW[2]) * wl;
+                    v[l] = (b0 * t.vOverW[0] + b1 * t.vOverW[1] + b2 * t.vOverW[2]) * wl;
+                }
+                // one level of detail per quad and texture, from the UV derivatives across the quad
+                glm::vec2 dx(u[1] - u[0], v[1] - v[0]), dy(u[2] - u[0], v[2] - v[0]);
+                float lod[2] = { 0.0f, 0.0f };
+                for (int k = 0; k < 2; k++)
+                {
+                    if (!textures[k] || textures[k]->minFilter == SoftTexture::Linear)
+                        continue;
+                    glm::vec2 size((float)textures[k]->width(), (float)textures[k]->height());
+                    float rho = max(glm::length(dx * size), glm::length(dy * size));
+                    lod[k] = rho > 0.0f ? log2(rho) : 0.0f;
+                }
+
+                for (int l = 0; l < 4; l++)
+                {
+                    if (!(mask & (1 << l)))
+                        continue;
+                    tileStats.pixelsCovered++;
+                    size_t p = (size_t)(y + (l >> 1)) * w + x + (l & 1);
+                    if (!(z[l] < depth[p]))
+                        continue;
+                    depth[p] = z[l];
+                    glm::vec2 uv(u[l], v[l]);
+                    glm::vec4 c0 = textures[0] ? textures[0]->sample(uv, lod[0]) : glm::vec4(1.0f);
+                    glm::vec4 c1 = textures[1] ? textures[1]->sample(uv, lod[1]) : glm::vec4(1.0f);
+                    color[p] = packColor(glm::mix(c0, c1, material.mixFactor));
+                    tileStats.pixelsShaded++;
+                }
+            }
+        }
+    }
+}
+
+void SoftRasterizer::readPixels(vector<unsigned char>& rgba)
+{
+    finish();
+    rgba.resize((size_t)w * h * 4);
+    for (int y = 0; y < h; y++)
+        memcpy(&rgba[(size_t)y * w * 4], &color[(size_t)(h - 1 - y) * w], (size_t)w * 4);
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "softTexture.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+// "sse2" or "scalar", the edge function implementation compiled in
+const char* softRasterPath();
+
+struct SoftVertex
+{
+    glm::vec3 position;
+    glm::vec2 uv;
+};
+
+struct SoftRasterStats
+{
+    uint64_t triangles = 0;         // submitted
+    uint64_t rasterized = 0;        // after clipping, non degenerate
+    uint64_t binned = 0;            // triangle/tile pairs
+    uint64_t pixelsCovered = 0;     // inside a triangle, before the depth test
+    uint64_t pixelsShaded = 0;      // passed the depth test and written
+};
+
+// CPU implementation of the subset of GL the getting-started chapters use:
+// indexed triangles transformed by one MVP (shaderMVP.vert), clipping, GL_LESS depth test,
+// perspective-correct UVs and the two-texture mix of shader.frag. No face culling, like the chapters.
+//
+// Draws only transform, clip and bin the triangles into square tiles; finish() rasterizes the
+// tiles in parallel on the pool, each tile walking its triangles in submission order, so the
+// result does not depend on the thread count. Coverage is evaluated for 2x2 pixel quads at once
+// (SSE2 edge functions), which also gives the UV derivatives for mipmap selection.
+// The framebuffer has its origin at the bottom left, like GL.
+class SoftRasterizer
+{
+public:
+    explicit SoftRasterizer(ThreadPool* pool = nullptr, int tileSize = 64);
+
+    void resize(int width, int height);
+    int width() const { return w; }
+    int height() const { return h; }
+
+    // finishes pending draws first
+    void clear(const glm::vec4& color, float depth = 1.0f);
+
+    // FragColor = mix(texture(texture0, uv), texture(texture1, uv), mixFactor)
+    void setTextures(const SoftTexture* texture0, const SoftTexture* texture1, float mixFactor = 0.2f);
+
+    // gl_Position = mvp * vec4(position, 1.0)
+    void drawIndexed(const SoftVertex* vertices, const unsigned int* indices, size_t indexNum, const glm::mat4& mvp);
+
+    // rasterize everything drawn since the last finish()
+    void finish();
+
+    // tightly packed RGBA, top row first (like RenderTarget::readPixels)
+    void readPixels(std::vector<unsigned char>& rgba);
+
+    const SoftRasterStats& stats() const { return counters; }
+    void resetStats() { counters = SoftRasterStats(); }
+
+private:
+    struct ClipVertex
+    {
+        glm::vec4 position;
+        glm::vec2 uv;
+    };
+
+    // screen space setup of one triangle, edge functions relative to (originX, originY)
+    struct Triangle
+    {
+        float edgeA[3], edgeB[3], edgeC[3];
+        bool topLeft[3];
+        float z[3];
+        float invW[3];
+        float uOverW[3], vOverW[3];
+        float invArea;
+        int originX, originY;
+        int minX, minY, maxX, maxY;
+        int material;
+    };
+
+    struct Material
+    {
+        const SoftTexture* texture0;
+        const SoftTexture* texture1;
+        float mixFactor;
+    };
+
+    void setupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2);
+    void clipTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2);
+    void rasterTile(int tile, SoftRasterStats& tileStats);
+
+    ThreadPool* pool;
+    int tileSize;
+    int w = 0, h = 0;
+    int tilesX = 0, tilesY = 0;
+    std::vector<uint32_t> color;        // RGBA8, rows bottom first
+    std::vector<float> depth;
+    std::vector<Triangle> triangles;
+    std::vector<std::vector<uint32_t>> bins;
+    std::vector<Material> materials;
+    SoftRasterStats counters;
+};
@@ -0,0 +1,124 @@
+#include "softTexture.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SOFT_TEXTURE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+    inline uint32_t pack(unsigned r, unsigned g, unsigned b, unsigned a)
+    {
+        return r | g << 8 | b << 16 | a << 24;
+    }
+
+    inline glm::vec4 unpack(uint32_t t)
+    {
+        return glm::vec4((float)(t & 0xff), (float)(t >> 8 & 0xff), (float)(t >> 16 & 0xff), (float)(t >> 24));
+    }
+
+    inline int floorToInt(float x)
+    {
+        int i = (int)x;
+        return x < (float)i ? i - 1 : i;
+    }
+
+#if SOFT_TEXTURE_SSE2
+    inline __m128 unpack4(uint32_t t)
+    {
+        __m128i zero = _mm_setzero_si128();
+        return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)t), zero), zero));
+    }
+
+    inline __m128 lerp4(__m128 a, __m128 b, __m128 t)
+    {
+        return _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t));
+    }
+#endif
+
+    inline int wrap(int i, int n)
+    {
+        if ((unsigned)i < (unsigned)n)
+            return i;
+        i %= n;
+        return i < 0 ? i + n : i;
+    }
+}
+
+void SoftTexture::create(const unsigned char* pixels, int width, int height, int channels)
+{
+    levels.clear();
+    Level base;
+    base.width = width;
+    base.height = height;
+    base.texels.resize((size_t)width * height);
+    for (size_t i = 0; i < base.texels.size(); i++)
+    {
+        const unsigned char* p = pixels + i * channels;
+        base.texels[i] = pack(p[0], p[1], p[2], channels == 4 ? p[3] : 255);
+    }
+    levels.push_back(move(base));
+
+    // like glGenerateMipmap: halve (rounding down, at least 1) down to 1x1 with a 2x2 box filter
+    while (levels.back().width > 1 || levels.back().height > 1)
+    {
+        const Level& src = levels.back();
+        Level dst;
+        dst.width = max(src.width / 2, 1);
+        dst.height = max(src.height / 2, 1);
+        dst.texels.resize((size_t)dst.width * dst.height);
+        for (int y = 0; y < dst.height; y++)
+        {
+            int y0 = min(y * 2, src.height - 1), y1 = min(y * 2 + 1, src.height - 1);
+            for (int x = 0; x < dst.width; x++)
+            {
+                int x0 = min(x * 2, src.width - 1), x1 = min(x * 2 + 1, src.width - 1);
+                glm::vec4 sum = unpack(src.texels[y0 * src.width + x0]) + unpack(src.texels[y0 * src.width + x1]) +
+                    unpack(src.texels[y1 * src.width + x0]) + unpack(src.texels[y1 * src.width + x1]);
+                sum = sum * 0.25f + 0.5f;
+                dst.texels[y * dst.width + x] = pack((unsigned)sum.r, (unsigned)sum.g, (unsigned)sum.b, (unsigned)sum.a);
+            }
+        }
+        levels.push_back(move(dst));
+    }
+}
+
+glm::vec4 SoftTexture::bilinear(const Level& level, glm::vec2 uv) const
+{
+    float x = uv.x * level.width - 0.5f;
+    float y = uv.y * level.height - 0.5f;
+    int ix = floorToInt(x), iy = floorToInt(y);
+    float ax = x - ix, ay = y - iy;
+    int x0 = wrap(ix, level.width), x1 = wrap(ix + 1, level.width);
+    int y0 = wrap(iy, level.height), y1 = wrap(iy + 1, level.height);
+    const uint32_t* row0 = &level.texels[(size_t)y0 * level.width];
+    const uint32_t* row1 = &level.texels[(size_t)y1 * level.width];
+#if SOFT_TEXTURE_SSE2
+    __m128 wx = _mm_set1_ps(ax);
+    __m128 top = lerp4(unpack4(row0[x0]), unpack4(row0[x1]), wx);
+    __m128 bottom = lerp4(unpack4(row1[x0]), unpack4(row1[x1]), wx);
+    glm::vec4 result;
+    _mm_storeu_ps(&result.x, _mm_mul_ps(lerp4(top, bottom, _mm_set1_ps(ay)), _mm_set1_ps(1.0f / 255.0f)));
+    return result;
+#else
+    glm::vec4 top = glm::mix(unpack(row0[x0]), unpack(row0[x1]), ax);
+    glm::vec4 bottom = glm::mix(unpack(row1[x0]), unpack(row1[x1]), ax);
+    return glm::mix(top, bottom, ay) * (1.0f / 255.0f);
+#endif
+}
+
+glm::vec4 SoftTexture::sample(glm::vec2 uv, float lod) const
+{
+    if (lod <= 0.0f || minFilter == Linear || levels.size() == 1)
+        return bilinear(levels[0], uv);
+    float maxLevel = (float)(levels.size() - 1);
+    lod = min(lod, maxLevel);
+    int l0 = (int)lod;
+    int l1 = min(l0 + 1, (int)maxLevel);
+    return glm::mix(bilinear(levels[l0], uv), bilinear(levels[l1], uv), lod - l0);
+}
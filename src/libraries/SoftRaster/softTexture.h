@@ -0,0 +1,39 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+// 2D RGBA8 texture with a box-filtered mip chain, sampled like a GL texture with REPEAT wrapping.
+class SoftTexture
+{
+public:
+    enum Filter
+    {
+        Linear,                 // bilinear on level 0 (GL_LINEAR)
+        LinearMipmapLinear,     // trilinear (GL_LINEAR_MIPMAP_LINEAR)
+    };
+
+    // rows bottom first like glTexImage2D, channels 3 or 4
+    void create(const unsigned char* pixels, int width, int height, int channels);
+
+    Filter minFilter = Linear;
+
+    int width() const { return levels.empty() ? 0 : levels[0].width; }
+    int height() const { return levels.empty() ? 0 : levels[0].height; }
+    int levelNum() const { return (int)levels.size(); }
+
+    // lod: log2 of the texel/pixel ratio; <= 0 magnifies (always bilinear on level 0)
+    glm::vec4 sample(glm::vec2 uv, float lod) const;
+
+private:
+    struct Level
+    {
+        int width, height;
+        std::vector<uint32_t> texels;
+    };
+
+    glm::vec4 bilinear(const Level& level, glm::vec2 uv) const;
+
+    std::vector<Level> levels;
+};
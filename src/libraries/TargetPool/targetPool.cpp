@@ -0,0 +1,361 @@
+#include "targetPool.h"
+
+#include <benchUtils.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+using namespace std;
+
+namespace
+{
+    struct FormatInfo
+    {
+        GLenum internalFormat;
+        GLenum format;
+        GLenum type;
+        int bytes;
+        const char* name;
+    };
+
+    const FormatInfo kFormats[] = {
+        { GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1, "R8" },
+        { GL_RG8, GL_RG, GL_UNSIGNED_BYTE, 2, "RG8" },
+        { GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4, "RGBA8" },
+        { GL_SRGB8_ALPHA8, GL_RGBA, GL_UNSIGNED_BYTE, 4, "SRGB8_ALPHA8" },
+        { GL_RGB10_A2, GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV, 4, "RGB10_A2" },
+        { GL_R11F_G11F_B10F, GL_RGB, GL_UNSIGNED_INT_10F_11F_11F_REV, 4, "R11F_G11F_B10F" },
+        { GL_R16F, GL_RED, GL_HALF_FLOAT, 2, "R16F" },
+        { GL_RG16F, GL_RG, GL_HALF_FLOAT, 4, "RG16F" },
+        { GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, 8, "RGBA16F" },
+        { GL_R32F, GL_RED, GL_FLOAT, 4, "R32F" },
+        { GL_RG32F, GL_RG, GL_FLOAT, 8, "RG32F" },
+        { GL_RGBA32F, GL_RGBA, GL_FLOAT, 16, "RGBA32F" },
+        { GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, 2, "DEPTH16" },
+        { GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, 4, "DEPTH24" },
+        { GL_DEPTH_COMPONENT32F, GL_DEPTH_COMPONENT, GL_FLOAT, 4, "DEPTH32F" },
+        { GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, 4, "DEPTH24_STENCIL8" },
+        { GL_DEPTH32F_STENCIL8, GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, 8, "DEPTH32F_STENCIL8" },
+    };
+
+    const FormatInfo* formatInfo(GLenum internalFormat)
+    {
+        for (const FormatInfo& f : kFormats)
+            if (f.internalFormat == internalFormat)
+                return &f;
+        return NULL;
+    }
+
+    const int kMaxColors = 8;
+
+    int screenSize(int size, float scale)
+    {
+        return max(1, (int)lround(size * (double)scale));
+    }
+}
+
+TargetDesc TargetDesc::screen(GLenum format, float scale, int samples)
+{
+    TargetDesc desc;
+    desc.format = format;
+    desc.scale = scale;
+    desc.samples = samples;
+    return desc;
+}
+
+TargetDesc TargetDesc::fixed(GLenum format, int width, int height, int samples)
+{
+    TargetDesc desc;
+    desc.format = format;
+    desc.width = width;
+    desc.height = height;
+    desc.scale = 0.0f;
+    desc.samples = samples;
+    return desc;
+}
+
+bool TargetPool::isDepthFormat(GLenum format)
+{
+    const FormatInfo* info = formatInfo(format);
+    return info && (info->format == GL_DEPTH_COMPONENT || info->format == GL_DEPTH_STENCIL);
+}
+
+int TargetPool::texelBytes(GLenum format)
+{
+    const FormatInfo* info = formatInfo(format);
+    return info ? info->bytes : 0;
+}
+
+const char* TargetPool::formatName(GLenum format)
+{
+    const FormatInfo* info = formatInfo(format);
+    return info ? info->name : "?";
+}
+
+void TargetPool::setScreenSize(int width, int height)
+{
+    screenW = width;
+    screenH = height;
+}
+
+void TargetPool::beginFrame()
+{
+    lastRequested = frameRequested;
+    lastInUse = frameInUse;
+    frameRequested = 0;
+    frameInUse = inUseBytes;
+    frame++;
+    for (size_t i = textures.size(); i-- > 0;)
+    {
+        const Texture& t = textures[i];
+        if (t.inUse)
+            continue;
+        bool resized = t.scale > 0.0f && (t.width != screenSize(screenW, t.scale) || t.height != screenSize(screenH, t.scale));
+        if (resized || frame - t.lastUsed > (uint64_t)retainFrames)
+            remove(i);
+    }
+}
+
+void TargetPool::destroy()
+{
+    while (!textures.empty())
+        remove(textures.size() - 1);
+    inUseBytes = 0;
+}
+
+unsigned int TargetPool::acquire(const TargetDesc& desc)
+{
+    int w = desc.width, h = desc.height;
+    if (desc.scale > 0.0f)
+    {
+        w = screenSize(screenW, desc.scale);
+        h = screenSize(screenH, desc.scale);
+    }
+    int samples = max(desc.samples, 1);
+    if (w <= 0 || h <= 0)
+    {
+        printf("ERROR: Render target of %dx%d pixels.\n", w, h);
+        return 0;
+    }
+
+    acquires++;
+    Texture* texture = NULL;
+    for (Texture& t : textures)
+    {
+        if (!t.inUse && t.format == desc.format && t.width == w && t.height == h && t.samples == samples)
+        {
+            texture = &t;
+            reuses++;
+            break;
+        }
+    }
+    if (!texture)
+    {
+        if (!create(desc, w, h))
+            return 0;
+        texture = &textures.back();
+    }
+    texture->inUse = true;
+    texture->lastUsed = frame;
+    inUseBytes += texture->bytes;
+    frameRequested += texture->bytes;
+    frameInUse = max(frameInUse, inUseBytes);
+    return texture->name;
+}
+
+void TargetPool::release(unsigned int texture)
+{
+    Texture* t = find(texture);
+    if (!t || !t->inUse)
+    {
+        printf("ERROR: Texture %u is not acquired from the pool.\n", texture);
+        return;
+    }
+    t->inUse = false;
+    t->lastUsed = frame;
+    inUseBytes -= t->bytes;
+}
+
+unsigned int TargetPool::create(const TargetDesc& desc, int width, int height)
+{
+    const FormatInfo* info = formatInfo(desc.format);
+    if (!info)
+    {
+        printf("ERROR: Render target format 0x%x is not known.\n", desc.format);
+        return 0;
+    }
+    Texture t = {};
+    t.format = desc.format;
+    t.width = width;
+    t.height = height;
+    t.samples = max(desc.samples, 1);
+    t.bytes = (size_t)width * height * info->bytes * t.samples;
+    t.scale = max(desc.scale, 0.0f);
+    glGenTextures(1, &t.name);
+    if (t.samples > 1)
+    {
+        glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, t.name);
+        glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, t.samples, desc.format, width, height, GL_TRUE);
+        glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
+    }
+    else
+    {
+        GLint filter = isDepthFormat(desc.format) ? GL_NEAREST : GL_LINEAR;
+        glBindTexture(GL_TEXTURE_2D, t.name);
+        glTexImage2D(GL_TEXTURE_2D, 0, desc.format, width, height, 0, info->format, info->type, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+    textures.push_back(t);
+    bytes += t.bytes;
+    peakBytes = max(peakBytes, bytes);
+    created++;
+    return t.name;
+}
+
+void TargetPool::remove(size_t index)
+{
+    unsigned int name = textures[index].name;
+    for (size_t i = framebuffers.size(); i-- > 0;)
+    {
+        const unsigned int* a = framebuffers[i].attachments;
+        if (std::find(a, a + kMaxColors + 1, name) != a + kMaxColors + 1)
+        {
+            glDeleteFramebuffers(1, &framebuffers[i].name);
+            framebuffers[i] = framebuffers.back();
+            framebuffers.pop_back();
+        }
+    }
+    glDeleteTextures(1, &name);
+    bytes -= textures[index].bytes;
+    if (textures[index].inUse)
+        inUseBytes -= textures[index].bytes;
+    textures[index] = textures.back();
+    textures.pop_back();
+    deleted++;
+}
+
+TargetPool::Texture* TargetPool::find(unsigned int texture)
+{
+    for (Texture& t : textures)
+        if (t.name == texture)
+            return &t;
+    return NULL;
+}
+
+const TargetPool::Texture* TargetPool::find(unsigned int texture) const
+{
+    for (const Texture& t : textures)
+        if (t.name == texture)
+            return &t;
+    return NULL;
+}
+
+int TargetPool::width(unsigned int texture) const
+{
+    const Texture* t = find(texture);
+    return t ? t->width : 0;
+}
+
+int TargetPool::height(unsigned int texture) const
+{
+    const Texture* t = find(texture);
+    return t ? t->height : 0;
+}
+
+unsigned int TargetPool::framebuffer(const unsigned int* colors, int colorNum, unsigned int depth)
+{
+    if (colorNum > kMaxColors)
+    {
+        printf("ERROR: %d color attachments, at most %d.\n", colorNum, kMaxColors);
+        return 0;
+    }
+    unsigned int attachments[kMaxColors + 1] = {};
+    copy(colors, colors + colorNum, attachments);
+    attachments[kMaxColors] = depth;
+    for (const Framebuffer& f : framebuffers)
+        if (equal(attachments, attachments + kMaxColors + 1, f.attachments))
+            return f.name;
+
+    Framebuffer f = {};
+    copy(attachments, attachments + kMaxColors + 1, f.attachments);
+    GLenum drawBuffers[kMaxColors];
+    glGenFramebuffers(1, &f.name);
+    glBindFramebuffer(GL_FRAMEBUFFER, f.name);
+    for (int i = 0; i <= kMaxColors; i++)
+    {
+        const Texture* t = attachments[i] ? find(attachments[i]) : NULL;
+        if (!t)
+            continue;
+        GLenum attachment = GL_COLOR_ATTACHMENT0 + i;
+        if (i == kMaxColors)
+            attachment = t->format == GL_DEPTH24_STENCIL8 || t->format == GL_DEPTH32F_STENCIL8 ?
+                GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+        glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, t->samples > 1 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D,
+            t->name, 0);
+        f.width = t->width;
+        f.height = t->height;
+    }
+    for (int i = 0; i < colorNum; i++)
+        drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+    if (colorNum)
+        glDrawBuffers(colorNum, drawBuffers);
+    else
+        glDrawBuffer(GL_NONE);
+    glReadBuffer(colorNum ? GL_COLOR_ATTACHMENT0 : GL_NONE);
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        printf("ERROR: Pooled framebuffer %dx%d is incomplete (0x%x).\n", f.width, f.height, status);
+        glDeleteFramebuffers(1, &f.name);
+        return 0;
+    }
+    framebuffers.push_back(f);
+    return f.name;
+}
+
+unsigned int TargetPool::bindFramebuffer(const unsigned int* colors, int colorNum, unsigned int depth)
+{
+    unsigned int name = framebuffer(colors, colorNum, depth);
+    glBindFramebuffer(GL_FRAMEBUFFER, name);
+    if (name)
+    {
+        const Texture* t = find(colorNum ? colors[0] : depth);
+        glViewport(0, 0, t->width, t->height);
+    }
+    return name;
+}
+
+TargetPool::Stats TargetPool::stats() const
+{
+    Stats s = {};
+    s.bytes = bytes;
+    s.peakBytes = peakBytes;
+    s.requestedBytes = lastRequested;
+    s.frameBytes = lastInUse;
+    s.textures = (uint32_t)textures.size();
+    s.framebuffers = (uint32_t)framebuffers.size();
+    s.created = created;
+    s.deleted = deleted;
+    s.acquires = acquires;
+    s.reuses = reuses;
+    return s;
+}
+
+void TargetPool::print() const
+{
+    Stats s = stats();
+    printf("target pool: %u textures %.2f MB (peak %.2f MB), %u framebuffers, %llu created, %llu deleted, "
+        "%llu of %llu acquires reused\n", s.textures, toMB(s.bytes), toMB(s.peakBytes), s.framebuffers,
+        (unsigned long long)s.created, (unsigned long long)s.deleted, (unsigned long long)s.reuses,
+        (unsigned long long)s.acquires);
+    printf("  last frame: %.2f MB acquired, %.2f MB in use at most, %.2f MB saved by aliasing\n",
+        toMB(s.requestedBytes), toMB(s.frameBytes), toMB(s.requestedBytes - min(s.requestedBytes, s.bytes)));
+    for (const Texture& t : textures)
+        printf("  %-18s %5dx%-5d x%d %8.2f MB%s%s\n", formatName(t.format), t.width, t.height, t.samples,
+            toMB(t.bytes), t.scale > 0.0f ? " screen" : "", t.inUse ? " in use" : "");
+}
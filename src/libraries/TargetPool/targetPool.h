@@ -0,0 +1,134 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// What a pass needs to render into: a fixed size in pixels, or a fraction of the screen that
+// follows it when the window is resized.
+struct TargetDesc
+{
+    GLenum format = GL_RGBA8;   // sized internal format, depth formats become depth attachments
+    int width = 0, height = 0;  // fixed size, used when scale is 0
+    float scale = 1.0f;         // of the screen size
+    int samples = 1;
+
+    static TargetDesc screen(GLenum format, float scale = 1.0f, int samples = 1);
+    static TargetDesc fixed(GLenum format, int width, int height, int samples = 1);
+};
+
+// Textures for the render targets that live within a frame, handed out by (size, format,
+// samples) and recycled across passes and frames, with cached framebuffers over them.
+//
+//     TargetPool pool;
+//     pool.setScreenSize(width, height);               // from framebuffer_size_callback's size
+//     pool.beginFrame();
+//     unsigned int hdr = pool.acquire(TargetDesc::screen(GL_RGBA16F));
+//     unsigned int depth = pool.acquire(TargetDesc::screen(GL_DEPTH24_STENCIL8));
+//     pool.bindFramebuffer(&hdr, 1, depth);            // draw the scene
+//     pool.release(depth);                             // after its last reader
+//     unsigned int bright = pool.acquire(TargetDesc::screen(GL_RGBA16F, 0.5f));
+//     ...
+//
+// Aliasing: a released texture is handed to the next acquire with the same description, in
+// the same frame or a later one, so passes whose targets do not live at the same time share
+// memory. Releasing right after the last pass that reads a target is what makes the sharing;
+// the pool only ever holds as many textures of a kind as were in use at once. GL 3.3 has no
+// placement of textures in shared memory, so only identical descriptions alias.
+//
+// Resizing only records the new size: screen-sized textures are created at the new size by
+// the next acquire, and the free ones of the old size are deleted by the next beginFrame
+// together with those unused for retainFrames. Deleting a texture drops its framebuffers.
+// GL calls happen in acquire, bindFramebuffer, beginFrame and destroy, on the context's thread.
+class TargetPool
+{
+public:
+    struct Stats
+    {
+        size_t bytes;               // held by the pool's textures
+        size_t peakBytes;
+        size_t requestedBytes;      // acquired in the last frame: one texture for every acquire
+        size_t frameBytes;          // most in use at once in the last frame
+        uint32_t textures;
+        uint32_t framebuffers;
+        uint64_t created;
+        uint64_t deleted;
+        uint64_t acquires;
+        uint64_t reuses;            // acquires served by an existing texture
+    };
+
+    TargetPool() {}
+    ~TargetPool() { destroy(); }
+    TargetPool(const TargetPool&) = delete;
+    TargetPool& operator=(const TargetPool&) = delete;
+
+    // frames a free texture is kept before it is deleted
+    void setRetainFrames(int frames) { retainFrames = frames; }
+    void setScreenSize(int width, int height);
+    int screenWidth() const { return screenW; }
+    int screenHeight() const { return screenH; }
+
+    // Ends the previous frame's statistics, trims textures; every texture must be released.
+    void beginFrame();
+    // deletes every texture and framebuffer
+    void destroy();
+
+    // a texture of the description, 0 when the format is not known
+    unsigned int acquire(const TargetDesc& desc);
+    void release(unsigned int texture);
+
+    // Cached framebuffer with the textures attached as color 0..colorNum-1 and the depth
+    // texture (0 for none); bound as draw and read framebuffer, viewport set to its size.
+    unsigned int bindFramebuffer(const unsigned int* colors, int colorNum, unsigned int depth);
+    unsigned int framebuffer(const unsigned int* colors, int colorNum, unsigned int depth);
+
+    // size of an acquired texture
+    int width(unsigned int texture) const;
+    int height(unsigned int texture) const;
+
+    Stats stats() const;
+    // totals, the last frame and the textures held
+    void print() const;
+
+    static bool isDepthFormat(GLenum format);
+    // bytes of one texel of a sized internal format, 0 when it is not known
+    static int texelBytes(GLenum format);
+    // "RGBA16F", "?" when it is not known
+    static const char* formatName(GLenum format);
+
+private:
+    struct Texture
+    {
+        unsigned int name;
+        GLenum format;
+        int width, height, samples;
+        size_t bytes;
+        float scale;                // of the screen, 0 for a fixed size
+        bool inUse;
+        uint64_t lastUsed;          // frame
+    };
+
+    struct Framebuffer
+    {
+        unsigned int name;
+        unsigned int attachments[9];    // 8 colors and depth, 0 unused
+        int width, height;
+    };
+
+    Texture* find(unsigned int texture);
+    const Texture* find(unsigned int texture) const;
+    unsigned int create(const TargetDesc& desc, int width, int height);
+    void remove(size_t index);
+
+    std::vector<Texture> textures;
+    std::vector<Framebuffer> framebuffers;
+    int screenW = 0, screenH = 0;
+    int retainFrames = 2;
+    uint64_t frame = 0;
+    size_t bytes = 0, peakBytes = 0;
+    size_t inUseBytes = 0;
+    size_t frameRequested = 0, frameInUse = 0;
+    size_t lastRequested = 0, lastInUse = 0;
+    uint64_t created = 0, deleted = 0, acquires = 0, reuses = 0;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+// stb_image keeps its vertical flip in a global without a getter, and its per-thread override
+// can never be taken back: once set, the thread ignores the global for good. Loaders that need
+// a known orientation set the global for a scope instead, it is restored after. Like the
+// global itself, not for loading on several threads at once.
+
+class StbiFlipScope
+{
+public:
+    explicit StbiFlipScope(bool flip);
+    ~StbiFlipScope();
+    StbiFlipScope(const StbiFlipScope&) = delete;
+    StbiFlipScope& operator=(const StbiFlipScope&) = delete;
+
+private:
+    int previous;
+};
@@ -1,2 +1,14 @@
 #define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
\ No newline at end of file
+#include "stb_image.h"
+#include "stbImageFlip.h"
+
+StbiFlipScope::StbiFlipScope(bool flip)
+    : previous(stbi__vertically_flip_on_load_global)
+{
+    stbi_set_flip_vertically_on_load(flip);
+}
+
+StbiFlipScope::~StbiFlipScope()
+{
+    stbi_set_flip_vertically_on_load(previous);
+}
\ No newline at end of file
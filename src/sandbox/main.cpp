@@ -0,0 +1,663 @@
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <stb_image.h>
+#include <batchMath.h>
+#include <inputSystem.h>
+#include <fixedTimestep.h>
+#include <cameraController.h>
+#include <snapshotBuffer.h>
+#include <renderThread.h>
+#include <framePacer.h>
+#include <gpuProfiler.h>
+#include <cpuProfiler.h>
+#include <videoCapture.h>
+#include <glDebug.h>
+#include <glStats.h>
+#include <glCapture.h>
+#include <gpuMemory.h>
+#include <frameAllocator.h>
+#include <allocTracker.h>
+#include <targetPool.h>
+#include <renderGraph.h>
+#include <world.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// The 6_camera scene on top of the engine libraries:
+// window callbacks only timestamp and queue input, a fixed-step simulation consumes it,
+// and a render thread that owns the GL context draws the newest published snapshot,
+// interpolating between its two simulated states.
+
+char infoLog[2048];
+
+std::atomic<int> screenWidth{ 800 };
+std::atomic<int> screenHeight{ 600 };
+
+//------- input / simulation -------
+InputSystem input;
+double startTime = 0.0;
+const double simulationStep = 1.0 / 120.0;
+
+//------- scene -------
+const glm::vec3 cubePositions[] = {
+    glm::vec3(0.0f,  0.0f,  0.0f),
+    glm::vec3(2.0f,  5.0f, -15.0f),
+    glm::vec3(-1.5f, -2.2f, -2.5f),
+    glm::vec3(-3.8f, -2.0f, -12.3f),
+    glm::vec3(2.4f, -0.4f, -3.5f),
+    glm::vec3(-1.7f,  3.0f, -7.5f),
+    glm::vec3(1.3f, -2.0f, -2.5f),
+    glm::vec3(1.5f,  2.0f, -2.5f),
+    glm::vec3(1.5f,  0.2f, -1.5f),
+    glm::vec3(-1.3f,  1.0f, -1.5f)
+};
+const int objectNum = sizeof(cubePositions) / sizeof(cubePositions[0]);
+
+// Transforms as ECS columns, laid out like the glm arrays composeMVPBatch reads
+struct Position { glm::vec3 value; };
+struct Rotation { glm::quat value; };
+struct Scale { glm::vec3 value; };
+static_assert(sizeof(Position) == sizeof(glm::vec3) && sizeof(Rotation) == sizeof(glm::quat) &&
+    sizeof(Scale) == sizeof(glm::vec3), "components must be laid out like their values");
+
+// filled before the render thread starts, then only read by it
+World scene;
+
+// Everything the render thread needs for a frame, written by the simulation and never modified after publish
+struct FrameSnapshot
+{
+    CameraState previous, current;
+    double tickTime = 0.0;      // end of the tick that produced 'current'
+    int width = 800, height = 600;
+};
+
+double appTime()
+{
+    return glfwGetTime() - startTime;
+}
+
+// runs on the main thread, the render thread picks the size up from the next snapshot
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+    screenWidth = width;
+    screenHeight = height;
+}
+
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    input.push({ appTime(), InputEventType::Key, key, action, 0.0, 0.0 });
+}
+
+void mouse_callback(GLFWwindow* window, double xpos, double ypos)
+{
+    input.push({ appTime(), InputEventType::MouseMove, 0, 0, xpos, ypos });
+}
+
+void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
+{
+    input.push({ appTime(), InputEventType::MouseButton, button, action, 0.0, 0.0 });
+}
+
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
+{
+    input.push({ appTime(), InputEventType::Scroll, 0, 0, xoffset, yoffset });
+}
+
+bool compileOutput(unsigned int shader)
+{
+    int  success;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(shader, 2048, NULL, infoLog);
+        cout << "ERROR: Compilation failed.\n" << infoLog << endl;
+    }
+    return success;
+}
+
+bool linkOutput(unsigned int shaderProgram)
+{
+    int  success;
+    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(shaderProgram, 2048, NULL, infoLog);
+        cout << "ERROR: Link failed.\n" << infoLog << endl;
+    }
+    return success;
+}
+
+string openGLSLProgram(const char* filename)
+{
+    ifstream f(filename);
+    if (!f.is_open())
+    {
+        cout << "ERROR: Cannot open GLSL program \"" << filename << "\".\n";
+        exit(-1);
+    }
+    stringstream buf;
+    buf << f.rdbuf();
+    return buf.str();
+}
+
+unsigned int loadTexture(const char* filename, GLenum texID)
+{
+    GpuMemoryTag tag(filename);
+    stbi_set_flip_vertically_on_load(true);
+    unsigned int texture;
+    glGenTextures(1, &texture);
+    glActiveTexture(texID);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    int width, height, nrChannels;
+    unsigned char* data = stbi_load(filename, &width, &height, &nrChannels, 3);
+    if (data)
+    {
+        GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data));
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    else
+    {
+        cout << "ERROR: Failed to load texture \"" << filename << "\".\n";
+    }
+    stbi_image_free(data);
+    return texture;
+}
+
+unsigned int createProgram(const char* vertexPath, const char* fragmentPath)
+{
+    string vertexSource = openGLSLProgram(vertexPath);
+    string fragmentSource = openGLSLProgram(fragmentPath);
+    const char* source;
+
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    source = vertexSource.c_str();
+    glShaderSource(vertexShader, 1, &source, NULL);
+    glCompileShader(vertexShader);
+    compileOutput(vertexShader);
+
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    source = fragmentSource.c_str();
+    glShaderSource(fragmentShader, 1, &source, NULL);
+    glCompileShader(fragmentShader);
+    compileOutput(fragmentShader);
+
+    unsigned int shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, vertexShader);
+    glAttachShader(shaderProgram, fragmentShader);
+    glLinkProgram(shaderProgram);
+    linkOutput(shaderProgram);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    return shaderProgram;
+}
+
+unsigned int createCube()
+{
+    float vertices[] = {
+         0.5f,  0.5f,  0.5f,   1.0f, 1.0f,
+         0.5f, -0.5f,  0.5f,   1.0f, 0.0f,
+        -0.5f, -0.5f,  0.5f,   0.0f, 0.0f,
+        -0.5f,  0.5f,  0.5f,   0.0f, 1.0f,
+        -0.5f,  0.5f, -0.5f,   1.0f, 1.0f,
+        -0.5f, -0.5f, -0.5f,   1.0f, 0.0f,
+         0.5f, -0.5f, -0.5f,   0.0f, 0.0f,
+         0.5f,  0.5f, -0.5f,   0.0f, 1.0f,
+        -0.5f,  0.5f,  0.5f,   1.0f, 1.0f,
+        -0.5f, -0.5f,  0.5f,   1.0f, 0.0f,
+        -0.5f, -0.5f, -0.5f,   0.0f, 0.0f,
+        -0.5f,  0.5f, -0.5f,   0.0f, 1.0f,
+         0.5f,  0.5f, -0.5f,   1.0f, 1.0f,
+         0.5f, -0.5f, -0.5f,   1.0f, 0.0f,
+         0.5f, -0.5f,  0.5f,   0.0f, 0.0f,
+         0.5f,  0.5f,  0.5f,   0.0f, 1.0f,
+         0.5f,  0.5f, -0.5f,   1.0f, 1.0f,
+         0.5f,  0.5f,  0.5f,   1.0f, 0.0f,
+        -0.5f,  0.5f,  0.5f,   0.0f, 0.0f,
+        -0.5f,  0.5f, -0.5f,   0.0f, 1.0f,
+         0.5f, -0.5f, -0.5f,   1.0f, 1.0f,
+         0.5f, -0.5f,  0.5f,   1.0f, 0.0f,
+        -0.5f, -0.5f,  0.5f,   0.0f, 0.0f,
+        -0.5f, -0.5f, -0.5f,   0.0f, 1.0f
+    };
+    unsigned int indices[] = {
+        0, 1, 3,    1, 2, 3,
+        4, 5, 7,    5, 6, 7,
+        8, 9, 11,   9, 10, 11,
+        12, 13, 15, 13, 14, 15,
+        16, 17, 19, 17, 18, 19,
+        20, 21, 23, 21, 22, 23,
+    };
+
+    GpuMemoryTag tag("cube");
+    unsigned int VAO, VBO, EBO;
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+    glGenBuffers(1, &VBO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW));
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(2);
+    glGenBuffers(1, &EBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW));
+    glBindVertexArray(0);
+    return VAO;
+}
+
+// usage: sandbox [--record file] [--replay file] [--buffering double|triple]
+//                [--pacing vsync|adaptive|uncapped|lowlatency] [--fps N] [--queued N]
+//                [--trace file.json] [--trace-frames first:last]
+//                [--capture file.y4m|file.yuv] [--gl-stats every_N_frames]
+//                [--gl-capture file.glcap] [--gl-capture-frames N]
+//                [--gpu-memory every_N_frames] [--gpu-memory-json file.json]
+//                [--alloc-stats every_N_frames] [--alloc-guard warmup_frames]
+//                [--alloc-guard-mode log|abort] [--alloc-call-sites N]
+//                [--graph-dot file.dot]
+int main(int argc, char** argv)
+{
+    const char* recordPath = NULL;
+    const char* replayPath = NULL;
+    SnapshotBuffer<FrameSnapshot>::Mode buffering = SnapshotBuffer<FrameSnapshot>::Triple;
+    PacingMode pacing = PacingMode::VSync;
+    double fpsLimit = 0.0;
+    int queuedFrames = 1;
+    const char* tracePath = NULL;
+    unsigned traceFirst = 0, traceLast = UINT32_MAX;
+    const char* capturePath = NULL;
+    int glStatsInterval = 0;
+    const char* glCapturePath = NULL;
+    int glCaptureFrames = 120;
+    int gpuMemoryInterval = 0;
+    const char* gpuMemoryPath = NULL;
+    int allocStatsInterval = 0;
+    int allocGuardWarmup = -1;
+    AllocViolation allocGuardMode = AllocViolation::Log;
+    int allocCallSites = 0;
+    const char* graphDotPath = NULL;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (!strcmp(argv[i], "--record"))
+            recordPath = argv[++i];
+        else if (!strcmp(argv[i], "--replay"))
+            replayPath = argv[++i];
+        else if (!strcmp(argv[i], "--buffering"))
+            buffering = !strcmp(argv[++i], "double") ? SnapshotBuffer<FrameSnapshot>::Double : SnapshotBuffer<FrameSnapshot>::Triple;
+        else if (!strcmp(argv[i], "--pacing") && !parsePacingMode(argv[++i], pacing))
+            cout << "ERROR: Unknown pacing mode \"" << argv[i] << "\".\n";
+        else if (!strcmp(argv[i], "--fps"))
+            fpsLimit = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--queued"))
+            queuedFrames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--trace"))
+            tracePath = argv[++i];
+        else if (!strcmp(argv[i], "--trace-frames"))
+            sscanf(argv[++i], "%u:%u", &traceFirst, &traceLast);
+        else if (!strcmp(argv[i], "--capture"))
+            capturePath = argv[++i];
+        else if (!strcmp(argv[i], "--gl-stats"))
+            glStatsInterval = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--gl-capture"))
+            glCapturePath = argv[++i];
+        else if (!strcmp(argv[i], "--gl-capture-frames"))
+            glCaptureFrames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--gpu-memory"))
+            gpuMemoryInterval = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--gpu-memory-json"))
+            gpuMemoryPath = argv[++i];
+        else if (!strcmp(argv[i], "--alloc-stats"))
+            allocStatsInterval = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--alloc-guard"))
+            allocGuardWarmup = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--alloc-guard-mode"))
+            allocGuardMode = !strcmp(argv[++i], "abort") ? AllocViolation::Abort : AllocViolation::Log;
+        else if (!strcmp(argv[i], "--alloc-call-sites"))
+            allocCallSites = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--graph-dot"))
+            graphDotPath = argv[++i];
+    }
+    bool allocTracking = allocStatsInterval > 0 || allocGuardWarmup >= 0 || allocCallSites > 0;
+    if (allocTracking)
+    {
+        AllocTracker::instance().enable(allocCallSites > 0);
+        AllocTracker::instance().guard(allocGuardWarmup, allocGuardMode);
+    }
+    vector<InputEvent> replayEvents;
+    size_t replayCursor = 0;
+    if (replayPath && !InputSystem::loadEvents(replayPath, replayEvents))
+        return -1;
+
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef GL_DEBUG_LAYER
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+#endif
+
+    GLFWwindow* window = glfwCreateWindow(800, 600, "LearnOpenGL", NULL, NULL);
+    if (window == NULL)
+    {
+        cout << "Failed to create GLFW window" << endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    if (glfwRawMouseMotionSupported())
+        glfwSetInputMode(window, GLFW_RAW_MOUSE_MOTION, GLFW_TRUE);
+
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    if (!replayPath)
+    {
+        glfwSetKeyCallback(window, key_callback);
+        glfwSetCursorPosCallback(window, mouse_callback);
+        glfwSetMouseButtonCallback(window, mouse_button_callback);
+        glfwSetScrollCallback(window, scroll_callback);
+    }
+
+    // monitor queries are main thread only
+    const GLFWvidmode* videoMode = glfwGetVideoMode(glfwGetPrimaryMonitor());
+    double refreshRate = videoMode ? videoMode->refreshRate : 60.0;
+
+    CameraSettings cameraSettings;
+    SnapshotBuffer<FrameSnapshot> snapshots(buffering);
+
+    //------- render thread -------
+    // owns the context from here on; the main thread never makes a GL call
+    RenderThread renderThread;
+    unique_ptr<FramePacer> pacer;
+    unique_ptr<GpuProfiler> gpuProfiler;
+    unique_ptr<VideoCapture> capture;
+    unsigned int VAO = 0, shaderProgram = 0;
+    int mvpLocation = -1;
+    int viewportWidth = 0, viewportHeight = 0;
+    // window sized targets follow the snapshots' size, re-created on the first frame after a resize
+    TargetPool targetPool;
+    RenderGraph graph;
+    glm::mat4 viewProjection(1.0f);
+    for (int i = 0; i < objectNum; i++)
+    {
+        scene.create(Position{ cubePositions[i] },
+            Rotation{ glm::angleAxis((float)(i), glm::normalize(glm::vec3(1.0f, 0.3f, 0.5f))) },
+            Scale{ glm::vec3(1.0f) });
+    }
+
+    CpuProfiler::instance().setThreadName("main");
+    renderThread.start([&]() {
+        CpuProfiler::instance().setThreadName("render");
+        PROFILE_SCOPE("render init");
+        glfwMakeContextCurrent(window);
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        {
+            cout << "Failed to initialize GLAD" << endl;
+            return false;
+        }
+        // before any object is created, the replay has to see them all
+        if (glCapturePath && !GLCapture::instance().start(glCapturePath, glCaptureFrames))
+            return false;
+        GL_DEBUG_INIT();
+        if (glStatsInterval > 0)
+            GLStats::instance().enable();
+        if (gpuMemoryInterval > 0 || gpuMemoryPath)
+            GpuMemory::instance().enable();
+        if (pacing == PacingMode::Adaptive &&
+            !glfwExtensionSupported("WGL_EXT_swap_control_tear") && !glfwExtensionSupported("GLX_EXT_swap_control_tear"))
+        {
+            cout << "WARNING: Adaptive vsync is not supported, using vsync.\n";
+            pacing = PacingMode::VSync;
+        }
+        glfwSwapInterval(pacingSwapInterval(pacing));
+        pacer.reset(new FramePacer(pacing, queuedFrames, fpsLimit));
+        pacer->setRefreshRate(refreshRate);
+        gpuProfiler.reset(new GpuProfiler());
+        gpuProfiler->init();
+        if (capturePath)
+            capture.reset(new VideoCapture());
+        {
+            PROFILE_SCOPE("load textures");
+            loadTexture("../data/container.jpg", GL_TEXTURE0);
+            loadTexture("../data/awesomeface.png", GL_TEXTURE1);
+        }
+        {
+            PROFILE_SCOPE("load shaders");
+            shaderProgram = createProgram("../src/sandbox/shaders/shader.vert", "../src/sandbox/shaders/shader.frag");
+        }
+        VAO = createCube();
+        glUseProgram(shaderProgram);
+        glUniform1i(glGetUniformLocation(shaderProgram, "texture0"), 0);
+        glUniform1i(glGetUniformLocation(shaderProgram, "texture1"), 1);
+        mvpLocation = glGetUniformLocation(shaderProgram, "mvp");
+        glUseProgram(0);
+        glEnable(GL_DEPTH_TEST);
+
+        RenderGraph::Resource backbuffer = graph.importBackbuffer();
+        graph.addPass("clear", [](const RenderGraph&) {}).write(backbuffer).clear(0.2f, 0.3f, 0.3f);
+        graph.addPass("cubes", [&](const RenderGraph&) {
+            glUseProgram(shaderProgram);
+            glBindVertexArray(VAO);
+            scene.eachChunk<Position, Rotation, Scale>([&](size_t n, const Entity*, Position* p, Rotation* r, Scale* s) {
+                glm::mat4* mvps = FrameAllocator::instance().allocateArray<glm::mat4>(n);
+                composeMVPBatch(viewProjection, &p->value, &r->value, &s->value, NULL, mvps, n);
+                for (size_t i = 0; i < n; i++)
+                {
+                    glUniformMatrix4fv(mvpLocation, 1, GL_FALSE, glm::value_ptr(mvps[i]));
+                    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, NULL);
+                }
+            });
+            glBindVertexArray(0);
+            glUseProgram(0);
+        }).write(backbuffer);
+        if (!graph.compile())
+            return false;
+        if (graphDotPath)
+        {
+            graph.print();
+            graph.writeDot(graphDotPath);
+        }
+        return true;
+    }, [&]() {
+        FrameStats& stats = renderThread.mutableStats();
+        CpuProfiler::instance().beginFrame();
+        PROFILE_SCOPE("frame");
+        AllocTracker::instance().beginFrame();
+        {
+            PROFILE_SCOPE("pace");
+            pacer->beginFrame();
+            if (!snapshots.acquire() && buffering == SnapshotBuffer<FrameSnapshot>::Double)
+            {
+                // lockstep: draw each snapshot once, wait for the next one
+                while (!snapshots.acquire())
+                {
+                    if (snapshots.isClosed())
+                        return false;
+                    this_thread::yield();
+                }
+            }
+        }
+        stats.beginWork();
+        // the render thread is the only one allocating from the frame allocator
+        FrameAllocator::instance().beginFrame();
+        GLStats::instance().beginFrame();
+        GLCapture::instance().beginFrame();
+        {
+            PROFILE_SCOPE("submit");
+            const FrameSnapshot& snapshot = snapshots.readSlot();
+            float alpha = (float)std::min(std::max((appTime() - snapshot.tickTime) / simulationStep, 0.0), 1.0);
+            CameraState view = interpolateCamera(snapshot.previous, snapshot.current, alpha);
+            if (snapshot.width != viewportWidth || snapshot.height != viewportHeight)
+            {
+                viewportWidth = snapshot.width;
+                viewportHeight = snapshot.height;
+                targetPool.setScreenSize(viewportWidth, viewportHeight);
+            }
+            // the video keeps the size of the first frame, later resizes are cropped or padded
+            if (capture && !capture->recording() && capture->capturedNum() == 0 &&
+                !capture->start(capturePath, viewportWidth, viewportHeight, (int)(refreshRate + 0.5)))
+                capture.reset();
+
+            glm::mat4 viewMatrix = glm::lookAt(view.position, view.position + view.front(), cameraSettings.up);
+            glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)viewportWidth / std::max(viewportHeight, 1), 0.1f, 100.0f);
+            viewProjection = projection * viewMatrix;
+
+            // every pass is a GPU scope of its own
+            gpuProfiler->beginFrame();
+            targetPool.beginFrame();
+            graph.execute(targetPool, gpuProfiler.get());
+            gpuProfiler->endFrame();
+            if (capture)
+            {
+                PROFILE_SCOPE("capture");
+                capture->capture();
+            }
+        }
+        GLCapture::instance().endFrame();
+        GLStats::instance().endFrame();
+        stats.endWork();
+        pacer->endWork();
+        {
+            // the periodic reports allocate, that is not the frame's doing
+            AllocAllowScope allow;
+            if (glStatsInterval > 0 && GLStats::instance().frameNum() % glStatsInterval == 0)
+                GLStats::instance().printFrame();
+            GpuMemory::instance().endFrame();
+            if (gpuMemoryInterval > 0 && GpuMemory::instance().frameNum() % gpuMemoryInterval == 0)
+                GpuMemory::instance().printSummary();
+        }
+
+        PROFILE_SCOPE("swap");
+        glfwSwapBuffers(window);
+        pacer->endFrame();
+        GL_DEBUG_FLUSH();
+        AllocTracker::instance().endFrame();
+        if (allocStatsInterval > 0 && AllocTracker::instance().frameNum() % allocStatsInterval == 0)
+            AllocTracker::instance().printFrame();
+        return true;
+    }, [&]() {
+        if (pacer)
+            pacer->print();
+        pacer.reset();
+        if (graph.compiled())
+            graph.printTimings(gpuProfiler.get());
+        if (gpuProfiler)
+            gpuProfiler->print();
+        gpuProfiler.reset();
+        if (capture)
+        {
+            capture->stop();
+            capture->print();
+        }
+        capture.reset();
+        if (GpuMemory::instance().enabled())
+        {
+            GpuMemory::instance().print();
+            GpuMemory::instance().reportLeaks();
+            if (gpuMemoryPath)
+                GpuMemory::instance().writeJson(gpuMemoryPath);
+            GpuMemory::instance().disable();
+        }
+        GLCapture::instance().stop();
+        if (GLStats::instance().enabled())
+        {
+            GLStats::instance().print();
+            GLStats::instance().disable();
+        }
+        targetPool.destroy();
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteProgram(shaderProgram);
+        GL_DEBUG_FLUSH();
+        GL_DEBUG_SHUTDOWN();
+        glfwMakeContextCurrent(NULL);
+    });
+
+    //------- simulation on the main thread -------
+    CameraState camera, previousCamera;
+    FixedTimestep simulation(simulationStep);
+    FrameStats simulationStats;
+    if (recordPath)
+        input.startRecording();
+    startTime = glfwGetTime();
+    simulation.reset(0.0);
+
+    while (!glfwWindowShouldClose(window) && renderThread.running())
+    {
+        {
+            // sleep in the event wait until the next tick is due
+            PROFILE_SCOPE("wait events");
+            glfwWaitEventsTimeout(std::max(simulation.time() + simulationStep - appTime(), 0.0));
+        }
+        double now = appTime();
+        simulationStats.beginWork();
+        PROFILE_SCOPE("simulate");
+        if (replayPath)
+        {
+            while (replayCursor < replayEvents.size() && replayEvents[replayCursor].time <= now)
+                input.push(replayEvents[replayCursor++]);
+            if (replayCursor == replayEvents.size() && (replayEvents.empty() || now > replayEvents.back().time + 1.0))
+                glfwSetWindowShouldClose(window, true);
+        }
+
+        unsigned long long ticks = simulation.ticks();
+        simulation.advance(now, [&](double /*tickStart*/, double tickEnd) {
+            const InputFrame& frame = input.collect(tickEnd);
+            if (frame.keyDown[GLFW_KEY_ESCAPE])
+                glfwSetWindowShouldClose(window, true);
+            previousCamera = camera;
+            simulateCamera(camera, frame, (float)simulationStep, cameraSettings);
+        });
+        simulationStats.endWork();
+        if (simulation.ticks() == ticks)
+            continue;
+
+        simulationStats.frame();
+        FrameSnapshot& snapshot = snapshots.writeSlot();
+        snapshot.previous = previousCamera;
+        snapshot.current = camera;
+        snapshot.tickTime = simulation.time();
+        snapshot.width = screenWidth;
+        snapshot.height = screenHeight;
+        snapshots.publish();
+    }
+    snapshots.close();
+    renderThread.stop();
+    if (allocTracking)
+    {
+        AllocTracker::instance().print(allocCallSites);
+        AllocTracker::instance().disable();
+    }
+    if (tracePath)
+        CpuProfiler::instance().writeChromeTrace(tracePath, traceFirst, traceLast);
+
+    if (recordPath)
+        InputSystem::saveEvents(recordPath, input.recordedEvents());
+    if (input.droppedNum())
+        cout << "WARNING: " << input.droppedNum() << " input events dropped.\n";
+    cout << "Simulated " << simulation.ticks() << " ticks, final camera ("
+         << camera.position.x << ", " << camera.position.y << ", " << camera.position.z << ")\n";
+    printf("%s buffering, %llu snapshots published, %llu never drawn\n",
+        buffering == SnapshotBuffer<FrameSnapshot>::Double ? "double" : "triple",
+        (unsigned long long)snapshots.published(), (unsigned long long)snapshots.dropped());
+    simulationStats.print("simulate");
+    renderThread.stats().print("render");
+
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,342 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <renderTarget.h>
+#include <cubeScene.h>
+#include <imageEncode.h>
+#include <threadPool.h>
+#include <benchUtils.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct BatchOptions
+{
+    int frames = 360;
+    int width = 1280, height = 720;
+    int ring = 3;
+    bool encode = true;
+    ImageFormat format = ImageFormat::Qoi;
+    const char* outDir = NULL;      // encode only (no disk I/O) when null
+};
+
+struct BatchResult
+{
+    double seconds = 0.0;
+    double waitMs = 0.0;            // render thread blocked on readback (fences or glReadPixels)
+    double encodeMs = 0.0;          // render thread encoding, sync mode only
+    size_t encodedBytes = 0;
+    bool ok = true;
+};
+
+//------- encode workers -------
+
+// Fixed set of frame buffers cycling between the render thread (filling them from PBOs)
+// and the encode jobs. Bounds memory: the render thread blocks when every buffer is queued.
+class EncodeQueue
+{
+public:
+    EncodeQueue(ThreadPool& pool, const BatchOptions& options, size_t bufferNum)
+        : pool(pool), options(options), buffers(bufferNum)
+    {
+        for (size_t i = 0; i < bufferNum; i++)
+        {
+            buffers[i].resize((size_t)options.width * options.height * 4);
+            freeList.push_back(i);
+        }
+    }
+
+    size_t acquire(double& waitMs)
+    {
+        Timer timer;
+        unique_lock<mutex> lock(m);
+        released.wait(lock, [&] { return !freeList.empty(); });
+        size_t b = freeList.back();
+        freeList.pop_back();
+        waitMs += timer.milliseconds();
+        return b;
+    }
+
+    unsigned char* data(size_t buffer) { return buffers[buffer].data(); }
+
+    void submit(size_t buffer, int frame)
+    {
+        pool.submit([this, buffer, frame] {
+            vector<unsigned char> encoded;
+            encodeImage(options.format, buffers[buffer].data(), options.width, options.height, 4, encoded);
+            encodedBytes += encoded.size();
+            if (options.outDir && !writeFrame(options, frame, encoded))
+                failed = true;
+            lock_guard<mutex> lock(m);
+            freeList.push_back(buffer);
+            released.notify_one();
+        });
+    }
+
+    static bool writeFrame(const BatchOptions& options, int frame, const vector<unsigned char>& encoded)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "/frame_%05d.%s", frame, imageFormatName(options.format));
+        return writeFile((string(options.outDir) + name).c_str(), encoded);
+    }
+
+    atomic<size_t> encodedBytes{ 0 };
+    atomic<bool> failed{ false };
+
+private:
+    ThreadPool& pool;
+    const BatchOptions& options;
+    vector<vector<unsigned char>> buffers;
+    vector<size_t> freeList;
+    mutex m;
+    condition_variable released;
+};
+
+//------- render loops -------
+
+glm::mat4 turntableView(int frame, int frames)
+{
+    return CubeScene::orbitView(6.2831853f * frame / frames);
+}
+
+// Baseline: glReadPixels straight into client memory, then encode, all on the render thread.
+// Every readback drains the GPU pipeline before the next frame can be queued.
+BatchResult renderSync(CubeScene& scene, const BatchOptions& options)
+{
+    BatchResult result;
+    RenderTarget target;
+    if (!target.create(options.width, options.height))
+    {
+        result.ok = false;
+        return result;
+    }
+    vector<unsigned char> pixels, encoded;
+    Timer total;
+    for (int f = 0; f < options.frames; f++)
+    {
+        target.bind();
+        scene.draw(turntableView(f, options.frames), (float)options.width / options.height);
+        Timer timer;
+        target.readPixels(pixels);
+        result.waitMs += timer.milliseconds();
+        if (options.encode)
+        {
+            timer.reset();
+            encodeImage(options.format, pixels.data(), options.width, options.height, 4, encoded);
+            result.encodedBytes += encoded.size();
+            if (options.outDir && !EncodeQueue::writeFrame(options, f, encoded))
+                result.ok = false;
+            result.encodeMs += timer.milliseconds();
+        }
+    }
+    RenderTarget::unbind();
+    result.seconds = total.seconds();
+    return result;
+}
+
+// Ring of FBOs, each read back into its own PBO behind a fence.
+// A slot is only touched again 'ring' frames later, so by then the copy has usually landed
+// and mapping the PBO does not wait; the pixels then go to the encode workers.
+BatchResult renderPipelined(CubeScene& scene, const BatchOptions& options, ThreadPool& pool)
+{
+    struct Slot
+    {
+        RenderTarget target;
+        unsigned int pbo = 0;
+        GLsync fence = 0;
+        int frame = -1;
+    };
+
+    BatchResult result;
+    size_t frameBytes = (size_t)options.width * options.height * 4;
+    vector<unique_ptr<Slot>> slots;
+    for (int i = 0; i < options.ring; i++)
+    {
+        unique_ptr<Slot> slot(new Slot());
+        if (!slot->target.create(options.width, options.height))
+        {
+            result.ok = false;
+            return result;
+        }
+        glGenBuffers(1, &slot->pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, frameBytes, NULL, GL_STREAM_READ);
+        slots.push_back(move(slot));
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    EncodeQueue queue(pool, options, pool.size() * 2 + 1);
+    vector<unsigned char> pixels(frameBytes), encoded;
+
+    // wait for the slot's copy, move the pixels out (flipped to top row first) and hand them off
+    auto retire = [&](Slot& slot) {
+        Timer timer;
+        glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+        glDeleteSync(slot.fence);
+        slot.fence = 0;
+        result.waitMs += timer.milliseconds();
+
+        size_t buffer = 0;
+        unsigned char* dst = pixels.data();
+        if (options.encode)
+        {
+            buffer = queue.acquire(result.waitMs);
+            dst = queue.data(buffer);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        const unsigned char* src = (const unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frameBytes, GL_MAP_READ_BIT);
+        if (src)
+        {
+            size_t stride = (size_t)options.width * 4;
+            for (int y = 0; y < options.height; y++)
+                memcpy(dst + y * stride, src + (options.height - 1 - y) * stride, stride);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        else
+            result.ok = false;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        if (options.encode)
+            queue.submit(buffer, slot.frame);
+    };
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    Timer total;
+    for (int f = 0; f < options.frames; f++)
+    {
+        Slot& slot = *slots[f % options.ring];
+        if (slot.fence)
+            retire(slot);
+        slot.target.bind();
+        scene.draw(turntableView(f, options.frames), (float)options.width / options.height);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        glReadPixels(0, 0, options.width, options.height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.frame = f;
+        glFlush();
+    }
+    for (int i = 0; i < options.ring; i++)
+    {
+        Slot& slot = *slots[(options.frames + i) % options.ring];
+        if (slot.fence)
+            retire(slot);
+    }
+    pool.wait();
+    RenderTarget::unbind();
+    result.seconds = total.seconds();
+    result.encodedBytes = queue.encodedBytes;
+    result.ok = result.ok && !queue.failed;
+
+    for (auto& slot : slots)
+        glDeleteBuffers(1, &slot->pbo);
+    return result;
+}
+
+void printResult(const char* name, const BatchResult& r, const BatchOptions& options)
+{
+    double frameMB = toMB((size_t)options.width * options.height * 4);
+    printf("  %-10s %8.1f fps  %7.2f ms/frame  readback %6.1f MB/s  waiting %6.2f ms/frame",
+        name, options.frames / r.seconds, r.seconds * 1000.0 / options.frames,
+        frameMB * options.frames / r.seconds, r.waitMs / options.frames);
+    if (r.encodeMs > 0.0)
+        printf("  encoding %6.2f ms/frame", r.encodeMs / options.frames);
+    if (options.encode)
+        printf("  %.0f KB/image", r.encodedBytes / 1024.0 / options.frames);
+    printf("%s\n", r.ok ? "" : "  (errors)");
+}
+
+// Renders a turntable of the 6_camera scene to images without a display.
+// usage: batchRender [--backend glfw|egl|osmesa] [--frames N] [--size WxH] [--ring N]
+//                    [--format png|qoi|tga|none] [--out DIR] [--threads N]
+//                    [--mode sync|pipelined|both] [--textures DIR]
+int main(int argc, char** argv)
+{
+    BatchOptions options;
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    const char* mode = "both";
+    const char* textureDir = NULL;
+    unsigned int threads = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--backend") && i + 1 < argc)
+        {
+            if (!parseContextBackend(argv[++i], backend))
+            {
+                printf("ERROR: Unknown backend \"%s\", expected glfw, egl or osmesa.\n", argv[i]);
+                return -1;
+            }
+        }
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            options.frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--size") && i + 1 < argc)
+            sscanf(argv[++i], "%dx%d", &options.width, &options.height);
+        else if (!strcmp(argv[i], "--ring") && i + 1 < argc)
+            options.ring = atoi(argv[++i]) < 1 ? 1 : atoi(argv[i]);
+        else if (!strcmp(argv[i], "--format") && i + 1 < argc)
+        {
+            options.encode = strcmp(argv[++i], "none") != 0;
+            if (options.encode && !parseImageFormat(argv[i], options.format))
+            {
+                printf("ERROR: Unknown format \"%s\", expected png, qoi, tga or none.\n", argv[i]);
+                return -1;
+            }
+        }
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+            options.outDir = argv[++i];
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            threads = (unsigned int)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--mode") && i + 1 < argc)
+            mode = argv[++i];
+        else if (!strcmp(argv[i], "--textures") && i + 1 < argc)
+            textureDir = argv[++i];
+    }
+    if (options.outDir && !options.encode)
+    {
+        printf("ERROR: --out needs an image format.\n");
+        return -1;
+    }
+
+    ContextDesc desc;
+    desc.width = options.width;
+    desc.height = options.height;
+    desc.visible = false;
+    unique_ptr<GLContext> context = GLContext::create(backend, desc);
+    if (!context)
+        return -1;
+    ThreadPool pool(threads);
+    printf("%s context: %s\n", contextBackendName(backend), (const char*)glGetString(GL_RENDERER));
+    printf("%d frames %dx%d, %s, ring of %d, %u encode threads\n", options.frames, options.width, options.height,
+        options.encode ? imageFormatName(options.format) : "no encoding", options.ring, pool.size());
+
+    bool ok = true;
+    {
+        CubeScene scene;
+        if (!scene.init(textureDir))
+            return -1;
+        bool sync = !strcmp(mode, "sync") || !strcmp(mode, "both");
+        bool pipelined = !strcmp(mode, "pipelined") || !strcmp(mode, "both");
+        BatchResult syncResult, pipelinedResult;
+        if (sync)
+        {
+            syncResult = renderSync(scene, options);
+            printResult("sync", syncResult, options);
+            ok = ok && syncResult.ok;
+        }
+        if (pipelined)
+        {
+            pipelinedResult = renderPipelined(scene, options, pool);
+            printResult("pipelined", pipelinedResult, options);
+            ok = ok && pipelinedResult.ok;
+        }
+        if (sync && pipelined)
+            printf("  speedup    %8.2fx\n", syncResult.seconds / pipelinedResult.seconds);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <renderTarget.h>
+#include <glReplay.h>
+#include <benchUtils.h>
+#include <imageEncode.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    struct FrameTime
+    {
+        double submitMs;        // decoding and issuing the calls
+        double totalMs;         // until the GPU finished them
+    };
+
+    double percentile(vector<double> values, double p)
+    {
+        if (values.empty())
+            return 0.0;
+        sort(values.begin(), values.end());
+        return values[min(values.size() - 1, (size_t)(p * (values.size() - 1) + 0.5))];
+    }
+
+    // color of the last draw's framebuffer inside its viewport, top row first
+    void readLastDraw(const GLReplay& replay, vector<unsigned char>& rgba, int& width, int& height)
+    {
+        const int* viewport = replay.lastDrawViewport();
+        width = viewport[2];
+        height = viewport[3];
+        vector<unsigned char> rows((size_t)width * height * 4);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, replay.lastDrawFramebuffer());
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        glReadPixels(viewport[0], viewport[1], width, height, GL_RGBA, GL_UNSIGNED_BYTE, rows.data());
+        rgba.resize(rows.size());
+        size_t stride = (size_t)width * 4;
+        for (int y = 0; y < height; y++)
+            memcpy(&rgba[y * stride], &rows[(height - 1 - y) * stride], stride);
+    }
+
+    uint64_t checksum(const vector<unsigned char>& data)
+    {
+        // FNV-1a
+        uint64_t h = 14695981039346656037ull;
+        for (unsigned char c : data)
+            h = (h ^ c) * 1099511628211ull;
+        return h;
+    }
+}
+
+// Plays a GLCapture file (sandbox or headlessRender --gl-capture) on a headless context as
+// fast as the driver goes and reports per-frame timings. Setup calls before the first frame
+// are not timed. --loops plays the frames again (uploads made inside frames are repeated).
+// The checksum of the last frame's image is the same on every run of the same driver.
+// usage: glReplay FILE [--backend glfw|egl|osmesa] [--loops N] [--out FILE.png|qoi|tga] [--csv FILE] [--quiet]
+int main(int argc, char** argv)
+{
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    const char* captureFile = NULL;
+    int loops = 1;
+    const char* outFile = NULL;
+    const char* csvFile = NULL;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--backend") && i + 1 < argc)
+        {
+            if (!parseContextBackend(argv[++i], backend))
+            {
+                printf("ERROR: Unknown backend \"%s\", expected glfw, egl or osmesa.\n", argv[i]);
+                return -1;
+            }
+        }
+        else if (!strcmp(argv[i], "--loops") && i + 1 < argc)
+            loops = max(1, atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+            outFile = argv[++i];
+        else if (!strcmp(argv[i], "--csv") && i + 1 < argc)
+            csvFile = argv[++i];
+        else if (!strcmp(argv[i], "--quiet"))
+            quiet = true;
+        else if (argv[i][0] != '-')
+            captureFile = argv[i];
+    }
+    if (!captureFile)
+    {
+        printf("usage: glReplay FILE [--backend glfw|egl|osmesa] [--loops N] [--out FILE.png|qoi|tga] [--csv FILE] [--quiet]\n");
+        return -1;
+    }
+
+    GLReplay replay;
+    if (!replay.load(captureFile))
+        return -1;
+    ContextDesc desc;
+    desc.width = replay.width();
+    desc.height = replay.height();
+    desc.visible = false;
+    unique_ptr<GLContext> context = GLContext::create(backend, desc);
+    if (!context)
+        return -1;
+    printf("%s context: %s, %s\n", contextBackendName(backend),
+        (const char*)glGetString(GL_VERSION), (const char*)glGetString(GL_RENDERER));
+    printf("%s: %dx%d, %d frames\n", captureFile, replay.width(), replay.height(), replay.frameNum());
+
+    vector<FrameTime> times;
+    {
+        // GL objects go before the context
+        RenderTarget target;
+        if (!target.create(replay.width(), replay.height()))
+            return -1;
+        replay.begin(target.framebuffer());
+
+        Timer setup;
+        bool playing = replay.nextFrame();
+        glFinish();
+        printf("setup: %.2f ms, %llu calls\n", setup.milliseconds(), (unsigned long long)replay.callNum());
+
+        for (int loop = 0; loop < loops && !replay.failed(); loop++)
+        {
+            if (loop > 0)
+            {
+                replay.rewindFrames();
+                playing = replay.nextFrame();
+            }
+            while (playing)
+            {
+                Timer timer;
+                if (!replay.playFrame())
+                    break;
+                double submitMs = timer.milliseconds();
+                glFinish();
+                times.push_back({ submitMs, timer.milliseconds() });
+                if (!quiet)
+                    printf("frame %5zu  submit %8.3f ms  total %8.3f ms\n", times.size() - 1, submitMs, times.back().totalMs);
+                playing = replay.nextFrame();
+            }
+        }
+        if (replay.failed())
+            return -1;
+
+        if (!times.empty())
+        {
+            vector<unsigned char> pixels;
+            int width, height;
+            readLastDraw(replay, pixels, width, height);
+            printf("last frame: %dx%d, checksum %016llx\n", width, height, (unsigned long long)checksum(pixels));
+            if (outFile && !writeImage(outFile, pixels.data(), width, height, 4))
+                return -1;
+        }
+    }
+    if (times.empty())
+    {
+        printf("ERROR: \"%s\" has no frames.\n", captureFile);
+        return -1;
+    }
+
+    vector<double> submit, total;
+    double totalSum = 0.0;
+    for (const FrameTime& t : times)
+    {
+        submit.push_back(t.submitMs);
+        total.push_back(t.totalMs);
+        totalSum += t.totalMs;
+    }
+    printf("%zu frames, %llu calls: submit p50 %.3f ms p99 %.3f ms, total mean %.3f ms p50 %.3f ms p99 %.3f ms max %.3f ms, %.1f fps\n",
+        times.size(), (unsigned long long)replay.callNum(), percentile(submit, 0.5), percentile(submit, 0.99),
+        totalSum / times.size(), percentile(total, 0.5), percentile(total, 0.99), percentile(total, 1.0),
+        1000.0 * times.size() / totalSum);
+
+    if (csvFile)
+    {
+        FILE* f = fopen(csvFile, "w");
+        if (!f)
+        {
+            printf("ERROR: Cannot write \"%s\".\n", csvFile);
+            return -1;
+        }
+        fprintf(f, "frame,submit_ms,total_ms\n");
+        for (size_t i = 0; i < times.size(); i++)
+            fprintf(f, "%zu,%.4f,%.4f\n", i, times[i].submitMs, times[i].totalMs);
+        fclose(f);
+    }
+    return 0;
+}
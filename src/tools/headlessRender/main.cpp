@@ -0,0 +1,168 @@
+#include <glad/glad.h>
+#include <glContext.h>
+#include <renderTarget.h>
+#include <glCapture.h>
+#include <cubeScene.h>
+#include <softCubeScene.h>
+#include <threadPool.h>
+#include <imageEncode.h>
+#include <stb_image.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const char* kDefaultReference = "../src/tools/headlessRender/reference/6_camera.png";
+
+// Rasterization and filtering differ slightly between GL implementations,
+// so pixels may deviate by 'tolerance' per channel and a small fraction may differ completely.
+bool compareReference(const char* filename, const vector<unsigned char>& rgba, int width, int height,
+    int tolerance, double maxMismatch)
+{
+    int refWidth, refHeight, channels;
+    stbi_set_flip_vertically_on_load(false);
+    unsigned char* reference = stbi_load(filename, &refWidth, &refHeight, &channels, 4);
+    if (!reference)
+    {
+        printf("ERROR: Cannot load reference image \"%s\".\n", filename);
+        return false;
+    }
+    if (refWidth != width || refHeight != height)
+    {
+        printf("FAIL: reference is %dx%d, render is %dx%d\n", refWidth, refHeight, width, height);
+        stbi_image_free(reference);
+        return false;
+    }
+    size_t mismatches = 0;
+    double diffSum = 0.0;
+    int diffMax = 0;
+    for (size_t p = 0; p < (size_t)width * height; p++)
+    {
+        int pixelMax = 0;
+        for (int c = 0; c < 3; c++)
+        {
+            int d = abs((int)rgba[p * 4 + c] - (int)reference[p * 4 + c]);
+            diffSum += d;
+            pixelMax = d > pixelMax ? d : pixelMax;
+        }
+        diffMax = pixelMax > diffMax ? pixelMax : diffMax;
+        if (pixelMax > tolerance)
+            mismatches++;
+    }
+    stbi_image_free(reference);
+
+    double mismatchRatio = (double)mismatches / ((double)width * height);
+    bool pass = mismatchRatio <= maxMismatch;
+    printf("%s: %zu pixels off by more than %d (%.3f%%, limit %.3f%%), mean error %.3f, max %d\n",
+        pass ? "PASS" : "FAIL", mismatches, tolerance, mismatchRatio * 100.0, maxMismatch * 100.0,
+        diffSum / ((double)width * height * 3), diffMax);
+    return pass;
+}
+
+// Renders the 6_camera scene from the chapter's start pose without a display,
+// optionally comparing it with a reference image. Exit code 0 when it matches.
+// --renderer soft uses the software rasterizer instead of GL, checked against the same reference.
+// --gl-capture records the GL calls of the frame for the glReplay tool.
+// usage: headlessRender [--renderer gl|soft] [--backend glfw|egl|osmesa] [--size WxH] [--textures DIR]
+//                       [--out FILE.png|qoi|tga] [--reference FILE | --no-reference] [--gl-capture FILE]
+//                       [--tolerance N] [--max-mismatch PERCENT]
+int main(int argc, char** argv)
+{
+    ContextBackend backend = contextBackendAvailable(ContextBackend::EglSurfaceless) ? ContextBackend::EglSurfaceless :
+        contextBackendAvailable(ContextBackend::OSMesa) ? ContextBackend::OSMesa : ContextBackend::Glfw;
+    bool soft = false;
+    int width = 800, height = 600;
+    const char* textureDir = NULL;
+    const char* outFile = NULL;
+    const char* referenceFile = kDefaultReference;
+    int tolerance = 16;
+    double maxMismatch = 0.5;
+    const char* captureFile = NULL;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--renderer") && i + 1 < argc)
+        {
+            soft = !strcmp(argv[++i], "soft");
+            if (!soft && strcmp(argv[i], "gl"))
+            {
+                printf("ERROR: Unknown renderer \"%s\", expected gl or soft.\n", argv[i]);
+                return -1;
+            }
+        }
+        else if (!strcmp(argv[i], "--backend") && i + 1 < argc)
+        {
+            if (!parseContextBackend(argv[++i], backend))
+            {
+                printf("ERROR: Unknown backend \"%s\", expected glfw, egl or osmesa.\n", argv[i]);
+                return -1;
+            }
+        }
+        else if (!strcmp(argv[i], "--size") && i + 1 < argc)
+            sscanf(argv[++i], "%dx%d", &width, &height);
+        else if (!strcmp(argv[i], "--textures") && i + 1 < argc)
+            textureDir = argv[++i];
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc)
+            outFile = argv[++i];
+        else if (!strcmp(argv[i], "--reference") && i + 1 < argc)
+            referenceFile = argv[++i];
+        else if (!strcmp(argv[i], "--no-reference"))
+            referenceFile = NULL;
+        else if (!strcmp(argv[i], "--tolerance") && i + 1 < argc)
+            tolerance = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--max-mismatch") && i + 1 < argc)
+            maxMismatch = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--gl-capture") && i + 1 < argc)
+            captureFile = argv[++i];
+    }
+    maxMismatch /= 100.0;
+
+    vector<unsigned char> pixels;
+    if (soft)
+    {
+        ThreadPool pool;
+        SoftRasterizer rasterizer(&pool);
+        SoftCubeScene scene;
+        if (!scene.init(textureDir))
+            return -1;
+        printf("software rasterizer, %u threads\n", pool.size() + 1);
+        rasterizer.resize(width, height);
+        scene.draw(rasterizer, CubeScene::defaultView(), (float)width / height);
+        rasterizer.readPixels(pixels);
+    }
+    else
+    {
+        ContextDesc desc;
+        desc.width = width;
+        desc.height = height;
+        desc.visible = false;
+        unique_ptr<GLContext> context = GLContext::create(backend, desc);
+        if (!context)
+            return -1;
+        printf("%s context: %s, %s\n", contextBackendName(backend),
+            (const char*)glGetString(GL_VERSION), (const char*)glGetString(GL_RENDERER));
+        if (captureFile && !GLCapture::instance().start(captureFile, 1, width, height))
+            return -1;
+
+        // GL objects go before the context
+        RenderTarget target;
+        CubeScene scene;
+        if (!target.create(width, height) || !scene.init(textureDir))
+            return -1;
+        GLCapture::instance().beginFrame();
+        target.bind();
+        scene.draw(CubeScene::defaultView(), (float)width / height);
+        GLCapture::instance().endFrame();
+        target.readPixels(pixels);
+        RenderTarget::unbind();
+    }
+
+    if (outFile && !writeImage(outFile, pixels.data(), width, height, 4))
+        return -1;
+    if (referenceFile && !compareReference(referenceFile, pixels, width, height, tolerance, maxMismatch))
+        return 1;
+    return 0;
+}